@@ -5,6 +5,7 @@
 #include "op.hpp"
 #include <details/ie_exception.hpp>
 #include <ie_layouts.h>
+#include <ie_parallel.hpp>
 
 using namespace TemplateExtension;
 
@@ -34,7 +35,8 @@ OpImplementation::OpImplementation(const std::shared_ptr<ngraph::Node> &node) {
 //! [cpu_implementation:getSupportedConfigurations]
 InferenceEngine::StatusCode OpImplementation::getSupportedConfigurations(std::vector<InferenceEngine::LayerConfig> &conf,
                                                                          InferenceEngine::ResponseDesc *resp) noexcept {
-    auto createConfig = [](const InferenceEngine::SizeVector inShape, const InferenceEngine::SizeVector& outShape, bool planar) {
+    auto createConfig = [](const InferenceEngine::SizeVector inShape, const InferenceEngine::SizeVector& outShape,
+                           InferenceEngine::Layout layout) {
         InferenceEngine::LayerConfig config;
         config.dynBatchSupport = false;
         InferenceEngine::DataConfig inData;
@@ -42,10 +44,19 @@ InferenceEngine::StatusCode OpImplementation::getSupportedConfigurations(std::ve
         InferenceEngine::SizeVector order = {0, 1, 2, 3};
         // Allow any offset before data
         size_t offset((std::numeric_limits<size_t>::max)());
-        if (planar) {
-            inData.desc = InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, inShape, {inShape, order, offset});
+        if (layout == InferenceEngine::NCHW || layout == InferenceEngine::NHWC) {
+            if (layout == InferenceEngine::NHWC)
+                order = {0, 2, 3, 1};
+            InferenceEngine::SizeVector inBlkDims, outBlkDims;
+            for (auto axis : order) {
+                inBlkDims.push_back(inShape[axis]);
+                outBlkDims.push_back(outShape[axis]);
+            }
+            inData.desc = InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, inShape, {inBlkDims, order, offset});
             config.inConfs.push_back(inData);
-            outData.desc = InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, outShape, {outShape, order, offset});
+            outData.desc = InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, outShape, {outBlkDims, order, offset});
+            // The operation is element-wise, so the output may be written over the input memory
+            outData.inPlace = 0;
             config.outConfs.push_back(outData);
         } else {
             // Add blocked (nChw8c) format
@@ -77,9 +88,11 @@ InferenceEngine::StatusCode OpImplementation::getSupportedConfigurations(std::ve
         return InferenceEngine::GENERAL_ERROR;
     }
     // Add planar format
-    conf.emplace_back(createConfig(inShape, outShape, true));
+    conf.emplace_back(createConfig(inShape, outShape, InferenceEngine::NCHW));
+    // Add channels last format
+    conf.emplace_back(createConfig(inShape, outShape, InferenceEngine::NHWC));
     // Add blocked format nChw8c
-    conf.emplace_back(createConfig(inShape, outShape, false));
+    conf.emplace_back(createConfig(inShape, outShape, InferenceEngine::BLOCKED));
     return InferenceEngine::OK;
 }
 //! [cpu_implementation:getSupportedConfigurations]
@@ -118,9 +131,21 @@ InferenceEngine::StatusCode OpImplementation::execute(std::vector<InferenceEngin
     const float* src_data = inputs[0]->cbuffer().as<const float *>() + inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
     float *dst_data = outputs[0]->buffer().as<float *>() + outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
-    for (size_t i = 0; i < inputs[0]->size(); i++) {
-        dst_data[i] = src_data[i] + add;
-    }
+    // The kernel is executed in the threads of the stream that runs the inference request
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(inputs[0]->size(), nthr, ithr, start, end);
+        compute(src_data + start, dst_data + start, end - start);
+    });
     return InferenceEngine::OK;
 }
 //! [cpu_implementation:execute]
+
+//! [cpu_implementation:compute]
+void OpImplementation::compute(const float* src, float* dst, size_t count) const noexcept {
+    const float value = static_cast<float>(add);
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = src[i] + value;
+    }
+}
+//! [cpu_implementation:compute]
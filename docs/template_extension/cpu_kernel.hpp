@@ -10,7 +10,7 @@
 namespace TemplateExtension {
 
 //! [cpu_implementation:header]
-class OpImplementation : public InferenceEngine::ILayerExecImpl {
+class OpImplementation : public InferenceEngine::ILayerEltwiseImpl {
 public:
     explicit OpImplementation(const std::shared_ptr<ngraph::Node>& node);
     InferenceEngine::StatusCode getSupportedConfigurations(std::vector<InferenceEngine::LayerConfig> &conf,
@@ -20,6 +20,7 @@ public:
     InferenceEngine::StatusCode execute(std::vector<InferenceEngine::Blob::Ptr> &inputs,
                                         std::vector<InferenceEngine::Blob::Ptr> &outputs,
                                         InferenceEngine::ResponseDesc *resp) noexcept override;
+    void compute(const float* src, float* dst, size_t count) const noexcept override;
 private:
     int64_t add;
     ngraph::Shape inShape;
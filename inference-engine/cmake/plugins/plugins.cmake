@@ -97,6 +97,9 @@ function(ie_add_plugin)
     if(TARGET inference_engine_onnx_reader)
         add_dependencies(${IE_PLUGIN_NAME} inference_engine_onnx_reader)
     endif()
+    if(TARGET inference_engine_binary_reader)
+        add_dependencies(${IE_PLUGIN_NAME} inference_engine_binary_reader)
+    endif()
 
     # install rules
 
@@ -596,6 +596,31 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_get_blob(ie_i
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_blob(ie_infer_request_t *infer_request, const char *name, const ie_blob_t *blob);
 
+/**
+ * @brief Sets several input/output blobs at once. Blobs stay bound to the infer request, so the following inferences
+ * read inputs from and write outputs to their memory (e.g. created by ie_blob_make_memory_from_preallocated)
+ * without any calls by name or allocations.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param names Names of input or output blobs.
+ * @param blobs Input or output blobs in the order of names.
+ * @param count Number of names and blobs.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_blobs(ie_infer_request_t *infer_request, const char *const *names,
+                                                                             const ie_blob_t *const *blobs, size_t count);
+
+/**
+ * @brief Gets a pointer to the memory of input/output data without creating ie_blob_t.
+ * The pointer is valid until the blob is replaced or the infer request is freed.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param name Name of input or output blob.
+ * @param blob_buffer A pointer to the memory of input or output blob.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_get_blob_buffer(ie_infer_request_t *infer_request, const char *name, ie_blob_buffer_t *blob_buffer);
+
 /**
  * @brief Starts synchronous inference of the infer request and fill outputs.
  * @ingroup InferRequest
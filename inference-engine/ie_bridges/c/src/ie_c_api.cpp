@@ -1286,6 +1286,50 @@ IEStatusCode ie_infer_request_set_blob(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_infer_request_set_blobs(ie_infer_request_t *infer_request, const char *const *names,
+                                        const ie_blob_t *const *blobs, size_t count) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || names == nullptr || blobs == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        for (size_t i = 0; i < count; ++i) {
+            if (names[i] == nullptr || blobs[i] == nullptr) {
+                return IEStatusCode::GENERAL_ERROR;
+            }
+            infer_request->object.SetBlob(names[i], blobs[i]->object);
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_get_blob_buffer(ie_infer_request_t *infer_request, const char *name, ie_blob_buffer_t *blob_buffer) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || name == nullptr || blob_buffer == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        blob_buffer->buffer = infer_request->object.GetBlob(name)->buffer();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
 IEStatusCode ie_infer_request_infer(ie_infer_request_t *infer_request) {
     IEStatusCode status = IEStatusCode::OK;
 
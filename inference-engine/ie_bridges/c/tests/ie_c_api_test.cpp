@@ -1033,6 +1033,62 @@ TEST(ie_infer_request_infer, infer) {
     ie_core_free(&core);
 }
 
+TEST(ie_infer_request_set_blobs, inferWithBoundPreallocatedBlobs) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+    dimensions_t input_dims;
+    IE_EXPECT_OK(ie_network_get_input_dims(network, "data", &input_dims));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_infer_request_t *infer_request = nullptr;
+    IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_request));
+    EXPECT_NE(nullptr, infer_request);
+
+    std::vector<uint8_t> input_data(input_dims.dims[0] * input_dims.dims[1] * input_dims.dims[2] * input_dims.dims[3]);
+    tensor_desc_t input_tensor = {layout_e::NCHW, input_dims, precision_e::U8};
+    ie_blob_t *input_blob = nullptr;
+    IE_EXPECT_OK(ie_blob_make_memory_from_preallocated(&input_tensor, input_data.data(), input_data.size(), &input_blob));
+
+    std::vector<float> output_data(10);
+    dimensions_t output_dims = {2, {1, 10}};
+    tensor_desc_t output_tensor = {layout_e::NC, output_dims, precision_e::FP32};
+    ie_blob_t *output_blob = nullptr;
+    IE_EXPECT_OK(ie_blob_make_memory_from_preallocated(&output_tensor, output_data.data(), output_data.size(), &output_blob));
+
+    const char *names[] = {"data", "fc_out"};
+    const ie_blob_t *blobs[] = {input_blob, output_blob};
+    IE_EXPECT_OK(ie_infer_request_set_blobs(infer_request, names, blobs, 2));
+
+    cv::Mat image = cv::imread(input_image);
+    Mat2Blob(image, input_blob);
+
+    IE_EXPECT_OK(ie_infer_request_infer(infer_request));
+    EXPECT_NEAR(output_data[9], 0.f, 1.e-5);
+
+    ie_blob_buffer_t buffer;
+    IE_EXPECT_OK(ie_infer_request_get_blob_buffer(infer_request, "fc_out", &buffer));
+    EXPECT_EQ(output_data.data(), buffer.buffer);
+
+    ie_blob_free(&output_blob);
+    ie_blob_free(&input_blob);
+    ie_infer_request_free(&infer_request);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_infer_request_infer_async, inferAsyncWaitFinish) {
     ie_core_t *core = nullptr;
     IE_ASSERT_OK(ie_core_create("", &core));
@@ -1,4 +1,4 @@
 from .ie_api import *
-__all__ = ['IENetwork', "TensorDesc", "IECore", "Blob", "PreProcessInfo", "get_version"]
+__all__ = ['IENetwork', "TensorDesc", "IECore", "Blob", "PreProcessInfo", "AsyncInferQueue", "get_version"]
 __version__ = get_version()
 
@@ -15,6 +15,7 @@ from libc.string cimport memcpy
 import os
 from fnmatch import fnmatch
 import threading
+import asyncio
 import warnings
 from copy import deepcopy
 from collections import OrderedDict, namedtuple
@@ -790,8 +791,8 @@ cdef class ExecutableNetwork:
         current_request = self.requests[0]
         current_request.infer(inputs)
         res = {}
-        for name, value in current_request.output_blobs.items():
-            res[name] = deepcopy(value.buffer)
+        for name in current_request._outputs_list:
+            res[name] = deepcopy(current_request._get_blob_buffer(name.encode()).to_numpy())
         return res
 
 
@@ -941,13 +942,29 @@ cdef class ExecutableNetwork:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        cdef int c_num_requests = num_requests
+        cdef int64_t c_timeout = timeout
+        cdef int status
+        with nogil:
+            status = deref(self.impl).wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
     cpdef get_idle_request_id(self):
         return deref(self.impl).getIdleRequestId()
 
+    def _start_collecting_completed(self):
+        deref(self.impl).startCollectingCompleted()
+
+    # Returns a list of (request index, status code) pairs of all requests completed since the previous call
+    def _wait_completed(self, timeout):
+        cdef int64_t c_timeout = timeout
+        cdef vector[pair[int, int]] c_completed
+        with nogil:
+            c_completed = deref(self.impl).waitCompleted(c_timeout)
+        return c_completed
+
 ctypedef extern void (*cb_type)(void*, int) with gil
 
 ## This class provides an interface to infer requests of `ExecutableNetwork` and serves to handle infer requests execution
@@ -1082,7 +1099,9 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        # other Python threads can run their requests meanwhile
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
@@ -1101,7 +1120,8 @@ cdef class InferRequest:
             self._fill_inputs(inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -1135,7 +1155,11 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef int64_t c_timeout = timeout
+        cdef int status
+        with nogil:
+            status = deref(self.impl).wait(c_timeout)
+        return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1223,11 +1247,123 @@ cdef class InferRequest:
             raise ValueError("Batch size should be positive integer number but {} specified".format(size))
         deref(self.impl).setBatch(size)
 
+    ## Binds numpy arrays to the infer request as input or output blobs, so the inference reads inputs from them
+    #  and writes outputs to them directly.
+    #
+    #  \note An array is used without a copy if it is C-contiguous and its data type and number of elements match
+    #  the blob. Otherwise an input array is copied to a new array of the blob type once, and an output array is
+    #  rejected. Bound arrays must not be modified while the request is running.
+    #
+    #  @param arrays: A dictionary that maps input or output layer names to `numpy.ndarray` objects
+    #  @return None
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=2)
+    #  res = np.empty((1, 10), dtype=np.float32)
+    #  exec_net.requests[0].bind_arrays({'data': img, 'prob': res})
+    #  exec_net.requests[0].infer()
+    #  ```
+    def bind_arrays(self, arrays):
+        for name, array in arrays.items():
+            is_input = name in self._inputs_list
+            if not is_input and name not in self._outputs_list:
+                raise ValueError("No input or output with name {} found in network".format(name))
+            request_blob = Blob()
+            deref(self.impl).getBlobPtr(name.encode(), request_blob._ptr)
+            tensor_desc = request_blob.tensor_desc
+            dtype = format_map[tensor_desc.precision]
+            shared = array.dtype == dtype and array.flags['C_CONTIGUOUS'] and array.size == np.prod(tensor_desc.dims)
+            if not shared:
+                if not is_input:
+                    raise ValueError("Output array for {} should be C-contiguous array of {} with {} elements".format(
+                                     name, dtype, np.prod(tensor_desc.dims)))
+                array = np.ascontiguousarray(array, dtype=dtype)
+            self.set_blob(name, Blob(tensor_desc, array))
+
     def _fill_inputs(self, inputs):
         for k, v in inputs.items():
             assert k in self._inputs_list, "No input with name {} found in network".format(k)
-            self.input_blobs[k].buffer[:] = v
-
+            if k in self._user_blobs:
+                self._user_blobs[k].buffer[:] = v
+            else:
+                self._get_blob_buffer(k.encode()).to_numpy()[:] = v
+
+
+## This class manages infer requests of an `ExecutableNetwork` for asyncio applications: it hands out idle requests
+#  and resolves futures of completed ones. Completions are collected by the native code and delivered to the event
+#  loop in batches by a single thread, so IE callback threads don't contend for the GIL.
+#
+#  \note Requests of the executable network must not be used directly or with completion callbacks while the queue
+#  is in use.
+#
+#  Usage example:\n
+#  ```python
+#  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=0)
+#  infer_queue = AsyncInferQueue(exec_net)
+#  results = await asyncio.gather(*[infer_queue.infer({'data': img}) for img in images])
+#  infer_queue.close()
+#  ```
+class AsyncInferQueue:
+    ## Class constructor
+    #  @param exec_net: `ExecutableNetwork` whose requests are used by the queue
+    #  @param poll_timeout: Time in milliseconds after which the completion thread checks whether the queue is closed
+    #  @return Instance of AsyncInferQueue class
+    def __init__(self, exec_net, poll_timeout=100):
+        self._exec_net = exec_net
+        self._requests = exec_net.requests
+        self._poll_timeout = poll_timeout
+        self._loop = None
+        self._idle_ids = None
+        self._futures = {}
+        self._closed = False
+        exec_net._start_collecting_completed()
+        self._thread = threading.Thread(target=self._poll_completed, daemon=True)
+        self._thread.start()
+
+    ## Runs inference on an idle request, waiting for one if all requests are busy
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects with input data
+    #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data
+    async def infer(self, inputs):
+        if self._closed:
+            raise RuntimeError("AsyncInferQueue is closed")
+        if self._loop is None:
+            self._loop = asyncio.get_event_loop()
+            self._idle_ids = asyncio.Queue()
+            for request_id in range(len(self._requests)):
+                self._idle_ids.put_nowait(request_id)
+
+        request_id = await self._idle_ids.get()
+        try:
+            request = self._requests[request_id]
+            future = self._loop.create_future()
+            self._futures[request_id] = future
+            request.async_infer(inputs)
+            status = await future
+            if status != StatusCode.OK:
+                raise RuntimeError("Async Infer Request failed with status code {}".format(status))
+            return {name: request._get_blob_buffer(name.encode()).to_numpy().copy()
+                    for name in request._outputs_list}
+        finally:
+            self._futures.pop(request_id, None)
+            self._idle_ids.put_nowait(request_id)
+
+    ## Stops the completion thread. Requests which are running are not waited for.
+    def close(self):
+        self._closed = True
+        self._thread.join()
+
+    def _poll_completed(self):
+        while not self._closed:
+            completed = self._exec_net._wait_completed(self._poll_timeout)
+            if completed and self._loop is not None:
+                self._loop.call_soon_threadsafe(self._set_completed, completed)
+
+    def _set_completed(self, completed):
+        for request_id, status in completed:
+            future = self._futures.get(request_id)
+            if future is not None and not future.done():
+                future.set_result(status)
 
 ## This class contains the information about the network model read from IR and allows you to manipulate with
 #  some model parameters such as layers affinity and output layers.
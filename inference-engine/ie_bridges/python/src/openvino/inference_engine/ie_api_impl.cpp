@@ -378,16 +378,18 @@ void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
 }
 
 void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
-    if (code != InferenceEngine::StatusCode::OK) {
-        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
-    }
     InferenceEnginePython::InferRequestWrap *requestWrap;
     InferenceEngine::ResponseDesc dsc;
     request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
+    if (code != InferenceEngine::StatusCode::OK) {
+        requestWrap->request_queue_ptr->setRequestCompleted(requestWrap->index, code);
+        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
+    }
     auto end_time = Time::now();
     auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
     requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
     requestWrap->request_queue_ptr->setRequestIdle(requestWrap->index);
+    requestWrap->request_queue_ptr->setRequestCompleted(requestWrap->index, code);
     if (requestWrap->user_callback) {
         requestWrap->user_callback(requestWrap->user_data, code);
     }
@@ -481,6 +483,14 @@ int InferenceEnginePython::IEExecNetwork::getIdleRequestId() {
     return request_queue_ptr->getIdleRequestId();
 }
 
+void InferenceEnginePython::IEExecNetwork::startCollectingCompleted() {
+    request_queue_ptr->startCollectingCompleted();
+}
+
+std::vector<std::pair<int, int>> InferenceEnginePython::IEExecNetwork::waitCompleted(int64_t timeout) {
+    return request_queue_ptr->waitCompleted(timeout);
+}
+
 int InferenceEnginePython::IdleInferRequestQueue::wait(int num_requests, int64_t timeout) {
     std::unique_lock<std::mutex> lock(mutex);
     if (timeout > 0) {
@@ -507,6 +517,32 @@ int InferenceEnginePython::IdleInferRequestQueue::getIdleRequestId() {
     return idle_ids.size() ? idle_ids.front() : -1;
 }
 
+void InferenceEnginePython::IdleInferRequestQueue::setRequestCompleted(int index, int status) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (collect_completed) {
+        completed.emplace_back(index, status);
+        completed_cv.notify_all();
+    }
+}
+
+void InferenceEnginePython::IdleInferRequestQueue::startCollectingCompleted() {
+    std::lock_guard<std::mutex> lock(mutex);
+    collect_completed = true;
+}
+
+std::vector<std::pair<int, int>> InferenceEnginePython::IdleInferRequestQueue::waitCompleted(int64_t timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto ready = [this]() { return !completed.empty(); };
+    if (timeout > 0)
+        completed_cv.wait_for(lock, std::chrono::milliseconds(timeout), ready);
+    else if (timeout < 0)
+        completed_cv.wait(lock, ready);
+    // all completions collected so far are returned at once
+    std::vector<std::pair<int, int>> result;
+    result.swap(completed);
+    return result;
+}
+
 void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests) {
     if (0 == num_requests) {
         num_requests = getOptimalNumberOfRequests(actual);
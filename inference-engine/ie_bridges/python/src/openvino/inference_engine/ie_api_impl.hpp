@@ -86,6 +86,16 @@ struct IdleInferRequestQueue {
 
     int getIdleRequestId();
 
+    // completed requests are collected only when they are consumed in batches by waitCompleted()
+    bool collect_completed = false;
+    std::vector<std::pair<int, int>> completed;  // request index and status code
+    std::condition_variable completed_cv;
+
+    void setRequestCompleted(int index, int status);
+    void startCollectingCompleted();
+
+    std::vector<std::pair<int, int>> waitCompleted(int64_t timeout);
+
     using Ptr = std::shared_ptr<IdleInferRequestQueue>;
 };
 
@@ -147,6 +157,9 @@ struct IEExecNetwork {
     int wait(int num_requests, int64_t timeout);
     int getIdleRequestId();
 
+    void startCollectingCompleted();
+    std::vector<std::pair<int, int>> waitCompleted(int64_t timeout);
+
     void createInferRequests(int num_requests);
 };
 
@@ -0,0 +1,58 @@
+import asyncio
+import numpy as np
+import os
+import pytest
+
+from openvino.inference_engine import ie_api as ie
+from conftest import model_path, image_path
+
+is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
+test_net_xml, test_net_bin = model_path(is_myriad)
+path_to_img = image_path()
+
+
+def read_image():
+    import cv2
+    n, c, h, w = (1, 3, 32, 32)
+    image = cv2.imread(path_to_img)
+    if image is None:
+        raise FileNotFoundError("Input image not found")
+
+    image = cv2.resize(image, (h, w)) / 255
+    image = image.transpose((2, 0, 1)).astype(np.float32)
+    image = image.reshape((n, c, h, w))
+    return image
+
+
+def test_infer(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=2)
+    img = read_image()
+    infer_queue = ie.AsyncInferQueue(exec_net)
+
+    async def run():
+        return await asyncio.gather(*[infer_queue.infer({'data': img}) for _ in range(5)])
+
+    results = asyncio.get_event_loop().run_until_complete(run())
+    infer_queue.close()
+    assert len(results) == 5
+    for res in results:
+        assert np.argmax(res['fc_out']) == 2
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_infer_after_close(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    infer_queue = ie.AsyncInferQueue(exec_net)
+    infer_queue.close()
+    with pytest.raises(RuntimeError) as e:
+        asyncio.get_event_loop().run_until_complete(infer_queue.infer({'data': read_image()}))
+    assert "AsyncInferQueue is closed" in str(e.value)
+    del exec_net
+    del ie_core
+    del net
@@ -454,6 +454,72 @@ def test_blob_setter(device):
     assert np.allclose(res_1, res_2, atol=1e-2, rtol=1e-2)
 
 
+def test_bind_arrays(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    res = np.zeros((1, 10), dtype=np.float32)
+    request = exec_net.requests[0]
+    request.bind_arrays({'data': img, 'fc_out': res})
+    request.infer()
+    assert np.argmax(res) == 2
+    assert np.array_equal(request.output_blobs['fc_out'].buffer, res)
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_bind_arrays_converts_input(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.bind_arrays({'data': img.astype(np.float64)})
+    request.infer()
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_bind_arrays_incorrect_output(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    with pytest.raises(ValueError) as e:
+        exec_net.requests[0].bind_arrays({'fc_out': np.zeros((1, 10), dtype=np.float64)})
+    assert "Output array for fc_out" in str(e.value)
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_infer_from_threads(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=2)
+    img = read_image()
+    results = [None] * 2
+
+    def run(request_id):
+        request = exec_net.requests[request_id]
+        for _ in range(10):
+            request.infer({'data': img})
+        results[request_id] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(2)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    assert results == [2, 2]
+    del exec_net
+    del ie_core
+    del net
+
+
 def test_blob_setter_with_preprocess(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(test_net_xml, test_net_bin)
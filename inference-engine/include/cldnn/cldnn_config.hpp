@@ -31,6 +31,8 @@ namespace CLDNNConfigParams {
 * as defined in https://www.khronos.org/registry/OpenCL/specs/opencl-2.1-extensions.pdf
 * this option should be used with an unsigned integer value (1 is lowest priority)
 * 0 means no priority hint is set and default queue is created.
+* The hint is applied to the queues of the executable network loaded with it, so networks sharing
+* the device may have different priorities.
 */
 DECLARE_CLDNN_CONFIG_KEY(PLUGIN_PRIORITY);
 
@@ -39,6 +41,7 @@ DECLARE_CLDNN_CONFIG_KEY(PLUGIN_PRIORITY);
 * as defined in https://www.khronos.org/registry/OpenCL/specs/opencl-2.1-extensions.pdf,
 * chapter 9.19. This option should be used with an unsigned integer value (1 is lowest energy consumption)
 * 0 means no throttle hint is set and default queue created.
+* Like PLUGIN_PRIORITY, the hint is applied to the queues of the executable network loaded with it.
 */
 DECLARE_CLDNN_CONFIG_KEY(PLUGIN_THROTTLE);
 
@@ -72,6 +75,38 @@ DECLARE_CLDNN_CONFIG_KEY(ENABLE_FP16_FOR_QUANTIZED_MODELS);
 */
 DECLARE_CLDNN_CONFIG_KEY(NV12_TWO_INPUTS);
 
+/**
+* @brief This key enables asynchronous upload of the input blobs set by user (SetBlob with host memory).
+* The upload is done through a separate OpenCL queue, so it overlaps the execution of the previous request.
+* Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(PIPELINED_UPLOAD);
+
+/**
+* @brief This key defines the number of inferences after which background tuning is started
+* when KEY_TUNING_MODE is set to TUNING_BACKGROUND. Non-negative integer, 10 by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(TUNING_WARMUP_INFERENCES);
+
+/**
+* @brief This key defines the size in megabytes of device memory released by destroyed networks which is kept
+* by the context for reuse by networks loaded afterwards. Non-negative integer, 0 (disabled) by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(MEM_POOL_CACHE_LIMIT);
+
+/**
+* @brief This key enables out-of-order command queues, where each kernel waits only for its own dependencies,
+* so independent branches of the network may run concurrently. YES (default) or NO.
+*/
+DECLARE_CLDNN_CONFIG_KEY(OUT_OF_ORDER_QUEUE);
+
+/**
+* @brief This key enables fusion of Gemm -> [Power] -> [Eltwise sum] -> SoftMax -> Gemm attention blocks into a single
+* attention primitive. The fused kernel is a reference one and can be slower than the optimized gemm kernels,
+* so it is worth enabling only when it is measured to be faster for the model. Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(ENABLE_FUSED_ATTENTION);
+
 
 }  // namespace CLDNNConfigParams
 }  // namespace InferenceEngine
@@ -9,9 +9,14 @@
  */
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "cpp/ie_memory_state.hpp"
 #include "ie_remote_context.hpp"
@@ -240,7 +245,7 @@ public:
         if (actual == nullptr) THROW_IE_EXCEPTION << "InferRequest was not initialized.";
         auto res = actual->Wait(millis_timeout, &resp);
         if (res != OK && res != RESULT_NOT_READY &&
-            res != INFER_NOT_STARTED && res != INFER_CANCELLED) {
+            res != INFER_NOT_STARTED && res != INFER_CANCELLED && res != INFER_DEADLINE_EXPIRED) {
             InferenceEngine::details::extract_exception(res, resp.msg);
         }
         return res;
@@ -332,4 +337,158 @@ public:
 };
 
 }  // namespace details
+
+/**
+ * @brief This class submits a group of infer requests in one call and notifies once the whole group is completed.
+ *
+ * It replaces a per-request StartAsync/Wait loop: the group callback and InferRequestGroup::Wait synchronize
+ * with the whole group at once.
+ * @note The group owns the completion callbacks of its requests, so they are overwritten by the group constructor
+ * and should not be set by a user while the group is used
+ */
+class InferRequestGroup {
+public:
+    /**
+     * @brief A group completion callback type: takes the group requests and the first failed request status
+     * (StatusCode::OK if all the requests succeeded)
+     */
+    using Callback = std::function<void(std::vector<InferRequest>&, StatusCode)>;
+
+    /**
+     * @brief Default constructor
+     */
+    InferRequestGroup() = default;
+
+    /**
+     * @brief Constructs a group of the infer requests
+     *
+     * @param requests Initialized infer requests, that are not used by another group
+     */
+    explicit InferRequestGroup(std::vector<InferRequest> requests): _state(std::make_shared<State>()) {
+        _state->requests = std::move(requests);
+        std::weak_ptr<State> weakState = _state;
+        for (auto&& request : _state->requests) {
+            if (!request) THROW_IE_EXCEPTION << "InferRequest was not initialized.";
+            // the state owns the requests, so the requests callbacks do not own the state
+            request.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [weakState] (InferRequest, StatusCode status) {
+                    auto state = weakState.lock();
+                    if (state != nullptr) {
+                        state->complete(1, status);
+                    }
+                });
+        }
+    }
+
+    /**
+     * @brief Sets a callback called once all the group requests are completed
+     *
+     * @param callback A group callback
+     */
+    void SetCompletionCallback(Callback callback) {
+        if (_state == nullptr) THROW_IE_EXCEPTION << "InferRequestGroup was not initialized.";
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        _state->callback = std::move(callback);
+    }
+
+    /**
+     * @brief Starts inference of all the group requests in asynchronous mode
+     *
+     * @note It returns immediately. The group can not be restarted until it is completed (including from the group
+     * callback). If some request fails to start, the rest of the group requests are not started and the exception
+     * is rethrown once the already started requests are completed
+     */
+    void StartAsync() {
+        if (_state == nullptr) THROW_IE_EXCEPTION << "InferRequestGroup was not initialized.";
+        {
+            std::lock_guard<std::mutex> lock(_state->mutex);
+            if (_state->started && !_state->done) THROW_IE_EXCEPTION << "InferRequestGroup is busy.";
+            _state->pending = _state->requests.size();
+            _state->status = StatusCode::OK;
+            _state->started = true;
+            _state->done = false;
+        }
+        if (_state->requests.empty()) {
+            _state->complete(0, StatusCode::OK);
+        }
+        for (std::size_t i = 0; i < _state->requests.size(); ++i) {
+            try {
+                _state->requests[i].StartAsync();
+            } catch (...) {
+                _state->complete(_state->requests.size() - i, StatusCode::GENERAL_ERROR);
+                Wait(IInferRequest::WaitMode::RESULT_READY);
+                throw;
+            }
+        }
+    }
+
+    /**
+     * @brief Waits for the completion of all the group requests
+     *
+     * @param millis_timeout Maximum duration in milliseconds to block for or a value of IInferRequest::WaitMode
+     * @return The first failed request status or StatusCode::OK if all the requests are completed successfully,
+     * StatusCode::RESULT_NOT_READY if the group is not completed yet, StatusCode::INFER_NOT_STARTED if the group
+     * was never started
+     */
+    StatusCode Wait(int64_t millis_timeout) {
+        if (_state == nullptr) THROW_IE_EXCEPTION << "InferRequestGroup was not initialized.";
+        std::unique_lock<std::mutex> lock(_state->mutex);
+        if (!_state->started) {
+            return StatusCode::INFER_NOT_STARTED;
+        }
+        auto isDone = [this] { return _state->done; };
+        if (IInferRequest::WaitMode::RESULT_READY == millis_timeout) {
+            _state->cv.wait(lock, isDone);
+        } else {
+            _state->cv.wait_for(lock, std::chrono::milliseconds{millis_timeout}, isDone);
+        }
+        return _state->done ? _state->status : StatusCode::RESULT_NOT_READY;
+    }
+
+    /**
+     * @brief Returns the group requests
+     * @return A vector of the group requests
+     */
+    std::vector<InferRequest>& Requests() {
+        if (_state == nullptr) THROW_IE_EXCEPTION << "InferRequestGroup was not initialized.";
+        return _state->requests;
+    }
+
+private:
+    struct State {
+        void complete(std::size_t count, StatusCode completedStatus) {
+            Callback groupCallback;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (StatusCode::OK == status) {
+                    status = completedStatus;
+                }
+                pending -= count;
+                if (pending != 0) {
+                    return;
+                }
+                groupCallback = callback;
+            }
+            if (groupCallback) {
+                groupCallback(requests, status);
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                done = true;
+            }
+            cv.notify_all();
+        }
+
+        std::vector<InferRequest>   requests;
+        Callback                    callback;
+        std::mutex                  mutex;
+        std::condition_variable     cv;
+        std::size_t                 pending = 0;
+        StatusCode                  status = StatusCode::OK;
+        bool                        started = false;
+        bool                        done = false;
+    };
+    std::shared_ptr<State> _state;
+};
+
 }  // namespace InferenceEngine
@@ -100,5 +100,22 @@ DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 * of issuing. Additionally, in this case, software modes do not implement any serializations.
 */
 DECLARE_GNA_CONFIG_KEY(LIB_N_THREADS);
+
+/**
+* @brief Number of single-frame infer requests gathered into one multi-frame GNA propagate call, 1-8.
+* Default value is 1, that means each request is propagated separately.
+*
+* Outputs are scattered back to the requests. Supported only for networks with batch 1 and without memory layers.
+*/
+DECLARE_GNA_CONFIG_KEY(COALESCE_N_REQUESTS);
+
+/**
+* @brief Number of GNA devices the executable network is loaded to, 1-16. Default value is 1.
+*
+* Each device gets its own copy of the compiled model and its own memory states. Requests of networks without
+* memory layers are dispatched to the least loaded device, requests of networks with memory layers are pinned
+* to one device in round-robin order so their state stays on that device.
+*/
+DECLARE_GNA_CONFIG_KEY(DEVICE_POOL_SIZE);
 }  // namespace GNAConfigParams
 }  // namespace InferenceEngine
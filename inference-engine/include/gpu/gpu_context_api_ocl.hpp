@@ -123,6 +123,35 @@ public:
     }
 };
 
+/**
+ * @brief This class represents an abstraction for GPU plugin remote blob
+ * which is allocated by plugin in unified shared memory (USM).
+ * The plugin object derived from this class can be obtained with CreateBlob() call
+ * with one of USM_HOST_BUFFER, USM_SHARED_BUFFER, USM_DEVICE_BUFFER shared memory types.
+ * @note User can obtain USM pointer from this class. Host and shared USM blobs can be written
+ * by host directly, without copies on integrated GPUs.
+ */
+class USMBlob : public ClBlob, public details::param_map_obj_getter {
+public:
+    /**
+     * @brief A smart pointer to the USMBlob object
+     */
+    using Ptr = std::shared_ptr<USMBlob>;
+
+    /**
+     * @brief Creates a USMBlob object with the specified dimensions and layout.
+     * @param tensorDesc Tensor description
+     */
+    explicit USMBlob(const TensorDesc& tensorDesc) : ClBlob(tensorDesc) {}
+
+    /**
+     * @brief Returns the underlying USM pointer.
+     */
+    void* get() {
+        return static_cast<void*>(_ObjFromParamSimple<gpu_handle_param>(getParams(), GPU_PARAM_KEY(MEM_HANDLE)));
+    }
+};
+
 /**
  * @brief This class represents an abstraction for GPU plugin remote blob
  * which can be shared with user-supplied OpenCL 2D Image.
@@ -225,6 +254,26 @@ static inline Blob::Ptr make_shared_blob(const TensorDesc& desc, ClContext::Ptr
     return std::dynamic_pointer_cast<Blob>(ctx->CreateBlob(desc));
 }
 
+/**
+ * @brief This function is used to create remote blob object in unified shared memory within GPU plugin OpenCL context
+ * @param desc A tensor descriptor object representing remote blob configuration
+ * @param ctx A remote context used to create remote blob
+ * @param usm_type A type of USM allocation: USM_HOST_BUFFER, USM_SHARED_BUFFER or USM_DEVICE_BUFFER
+ * @return A remote blob instance
+ */
+static inline Blob::Ptr make_shared_blob_usm(const TensorDesc& desc, RemoteContext::Ptr ctx,
+                                            const std::string& usm_type = GPU_PARAM_VALUE(USM_HOST_BUFFER)) {
+    auto casted = std::dynamic_pointer_cast<ClContext>(ctx);
+    if (nullptr == casted) {
+        THROW_IE_EXCEPTION << "Invalid remote context passed";
+    }
+
+    ParamMap params = {
+        { GPU_PARAM_KEY(SHARED_MEM_TYPE), usm_type }
+    };
+    return std::dynamic_pointer_cast<Blob>(casted->CreateBlob(desc, params));
+}
+
 /**
  * @brief This function is used to obtain remote blob object from user-supplied cl::Buffer wrapper object
  * @param desc A tensor descriptor object representing remote blob configuration
@@ -90,6 +90,18 @@ DECLARE_GPU_PARAM_VALUE(VA_SURFACE);
 * @brief Shared D3D buffer blob
 */
 DECLARE_GPU_PARAM_VALUE(DX_BUFFER);
+/**
+* @brief Unified shared memory blob allocated by plugin in host memory
+*/
+DECLARE_GPU_PARAM_VALUE(USM_HOST_BUFFER);
+/**
+* @brief Unified shared memory blob allocated by plugin in migratable memory shared by host and device
+*/
+DECLARE_GPU_PARAM_VALUE(USM_SHARED_BUFFER);
+/**
+* @brief Unified shared memory blob allocated by plugin in device memory, not accessible by host
+*/
+DECLARE_GPU_PARAM_VALUE(USM_DEVICE_BUFFER);
 
 /**
 * @brief This key identifies OpenCL memory handle
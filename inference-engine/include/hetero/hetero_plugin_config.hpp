@@ -35,5 +35,21 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the cost based assignment of the layers to the devices.
+ * By default (CONFIG_VALUE(NO)) a layer is executed on the first TARGET_FALLBACK device that supports it.
+ * With CONFIG_VALUE(YES) the layers supported by several devices are assigned to minimize the estimated cost
+ * of the layers execution (the later TARGET_FALLBACK devices are assumed to be slower) plus the cost of the tensors
+ * transferred between the subgraphs. Layers affinities set by the user are not changed.
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_BASED_AFFINITY);
+
+/**
+ * @brief The key for the upper limit of the number of the subgraphs for the cost based assignment of the layers.
+ * The smallest subgraphs are merged into their neighbours while the limit is exceeded and the neighbour device
+ * supports all their layers. This option should be used with unsigned integer values, "0" (default) means no limit
+ */
+DECLARE_HETERO_CONFIG_KEY(MAX_SUBGRAPHS);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -73,4 +73,28 @@ protected:
  */
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*) CreateDefaultAllocator() noexcept;
 
+/**
+ * @brief Creates an allocator which places memory on the given NUMA node
+ *
+ * Memory is local for threads running on the node, so pre-processing and inference threads of the node
+ * access it without remote socket traffic. Pages are allocated on the node on Windows and bound to the node
+ * with the preferred policy on Linux. On other OSes or if the node is not available the memory is placed
+ * by the OS as usual. Memory is allocated by pages, so the allocator is not intended for small objects.
+ * @param numaNode The NUMA node id
+ * @return The allocator or `nullptr` if it cannot be created
+ */
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*) CreateNumaAllocator(int numaNode) noexcept;
+
+/**
+ * @brief Creates an allocator which reuses freed memory for next allocations
+ *
+ * Blocks are aligned to the cache line, so vectorized code doesn't split loads. Freed blocks are kept to serve
+ * next allocations of the same size, e.g. blobs of new infer requests or blobs reallocated on reshape, until
+ * the allocator is released. If huge pages are enabled, blocks of 2 MB and larger are aligned to 2 MB and
+ * transparent huge pages are requested for them on Linux to reduce TLB misses. The allocator is thread-safe.
+ * @param hugePages Whether to request huge pages for large blocks
+ * @return The allocator or `nullptr` if it cannot be created
+ */
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*) CreatePooledAllocator(bool hugePages) noexcept;
+
 }  // namespace InferenceEngine
@@ -236,7 +236,8 @@ enum StatusCode : int {
     NOT_ALLOCATED = -10,
     INFER_NOT_STARTED = -11,
     NETWORK_NOT_READ = -12,
-    INFER_CANCELLED = -13
+    INFER_CANCELLED = -13,
+    INFER_DEADLINE_EXPIRED = -14
 };
 
 /**
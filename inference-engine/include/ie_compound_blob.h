@@ -311,4 +311,53 @@ class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
      */
     explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
 };
+
+/**
+ * @brief This class represents a batch of regions of interest of one image - a ROI blob per batch
+ * @details The ROI blobs share the memory of the image. They may have different sizes, which are resized
+ * to the network input by the input pre-processing: every ROI is written to its own batch element of the
+ * network input, so the regions are not copied out of the image before the inference.
+ */
+class INFERENCE_ENGINE_API_CLASS(ROIBatchedBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the ROIBatchedBlob object
+     */
+    using Ptr = std::shared_ptr<ROIBatchedBlob>;
+
+    /**
+     * @brief A smart pointer to the const ROIBatchedBlob object
+     */
+    using CPtr = std::shared_ptr<const ROIBatchedBlob>;
+
+    /**
+     * @brief Constructs a batch of regions of interest of an image
+     * @details The image is either a memory blob of NCHW or NHWC layout, or an NV12Blob or an I420Blob.
+     * Resulting blob's tensor descriptor is the tensor descriptor of the image with batch dimension set
+     * to rois.size()
+     *
+     * @param image A blob with the image
+     * @param rois A non-empty vector of regions of interest of the image
+     */
+    ROIBatchedBlob(const Blob::Ptr& image, const std::vector<ROI>& rois);
+
+    /**
+     * @brief Returns a constant reference to shared pointer to the image blob
+     */
+    const Blob::Ptr& image() const noexcept;
+
+    /**
+     * @brief Returns a constant reference to the regions of interest of the image
+     */
+    const std::vector<ROI>& rois() const noexcept;
+
+    /**
+     * @brief Not supported: regions of interest of a ROIBatchedBlob are not defined
+     */
+    Blob::Ptr createROI(const ROI& roi) const override;
+
+private:
+    Blob::Ptr _image;
+    std::vector<ROI> _rois;
+};
 }  // namespace InferenceEngine
@@ -105,6 +105,23 @@ public:
         const CNNNetwork& network, const std::string& deviceName,
         const std::map<std::string, std::string>& config = {});
 
+    /**
+     * @brief Reads a model and creates an executable network from it.
+     *
+     * If KEY_CACHE_DIR is set for the device and the device supports import and export, the compiled network is
+     * looked up in the cache first, so the model is read and compiled only on the cache miss.
+     * The model is loaded with the default input and output precisions and layouts.
+     *
+     * @param modelPath A path to the model (IR .xml with .bin next to it, or ONNX)
+     * @param deviceName Name of device to load network to
+     * @param config Optional map of pairs: (config parameter name, config parameter value) relevant only for this load
+     * operation
+     * @return An executable network reference
+     */
+    ExecutableNetwork LoadNetwork(
+        const std::string& modelPath, const std::string& deviceName,
+        const std::map<std::string, std::string>& config = {});
+
     /**
      * @brief Registers extension
      * @param extension Pointer to already loaded extension
@@ -217,11 +234,22 @@ public:
     /**
      * @brief Returns devices available for neural networks inference
      *
+     * Each plugin is created and queried once, the result is cached until ResetDevicesCache is called.
+     *
      * @return A vector of devices. The devices are returned as { CPU, FPGA.0, FPGA.1, MYRIAD }
        If there more than one device of specific type, they are enumerated with .# suffix.
      */
     std::vector<std::string> GetAvailableDevices() const;
 
+    /**
+     * @brief Drops the cached available devices and the device metrics that do not change at runtime
+     * (e.g. FULL_DEVICE_NAME, SUPPORTED_METRICS), so they are queried from the plugins again.
+     * Should be called when the devices are plugged in or out.
+     *
+     * @param deviceName A device name to drop the cache for. If empty, the cache is dropped for all the devices
+     */
+    void ResetDevicesCache(const std::string& deviceName = {});
+
     /**
      * @brief Register new device and plugin which implement this device inside Inference Engine.
      *
@@ -143,6 +143,39 @@ public:
                                ResponseDesc* resp) noexcept = 0;
 };
 
+/**
+ * @interface ILayerEltwiseImpl
+ * @brief This class provides interface for the implementation of an element-wise operation with one FP32 input and
+ * one FP32 output of the same shape.
+ *
+ * Besides the regular execution, the CPU plugin may fuse such an operation into a preceding Eltwise layer and apply
+ * the element-wise body to the results of this layer while they are in cache. In this case the plugin doesn't call
+ * the ILayerExecImpl methods of the implementation.
+ */
+class INFERENCE_ENGINE_API_CLASS(ILayerEltwiseImpl) : public ILayerExecImpl {
+public:
+    /**
+     * @brief A shared pointer to the ILayerEltwiseImpl interface
+     */
+    using Ptr = std::shared_ptr<ILayerEltwiseImpl>;
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~ILayerEltwiseImpl();
+
+    /**
+     * @brief Applies the operation to a contiguous part of a tensor
+     *
+     * The method is called concurrently from several threads for different parts of the same tensor.
+     *
+     * @param src Pointer to input values
+     * @param dst Pointer to output values, can be equal to src
+     * @param count Number of values to process
+     */
+    virtual void compute(const float* src, float* dst, size_t count) const noexcept = 0;
+};
+
 /**
  * @brief This class is the main extension interface
  */
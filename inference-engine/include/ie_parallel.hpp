@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 #define IE_THREAD_TBB 0
@@ -41,6 +43,9 @@
 #include "tbb/task_arena.h"
 #include "tbb/task_scheduler_observer.h"
 
+#include <atomic>
+#include <chrono>
+
 inline int parallel_get_max_threads() {
     return tbb::this_task_arena::max_concurrency();
 }
@@ -126,6 +131,111 @@ inline void parallel_set_num_threads(int) {
 
 namespace InferenceEngine {
 
+namespace details {
+/**
+ * @brief Minimal number of iterations per thread of parallel_for* calls made by the current thread,
+ * see parallel_grain_scope
+ */
+inline size_t& parallel_grain() {
+    static thread_local size_t grain = 1;
+    return grain;
+}
+
+/**
+ * @brief Number of threads parallel_for* uses for work_amount iterations
+ */
+inline int parallel_work_threads(size_t work_amount) {
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    const size_t grain = parallel_grain();
+    const size_t max_nthr = grain > 1 ? std::max<size_t>(work_amount / grain, 1) : work_amount;
+    return static_cast<int>(std::min(nthr, max_nthr));
+}
+
+/**
+ * @brief Statistics of parallel regions started by parallel_for* calls of a thread, see parallel_stats_scope
+ */
+struct parallel_stats {
+    uint64_t regions = 0;
+    // wall time of the regions not spent by their longest thread: scheduling, wake up and join
+    uint64_t overhead_ns = 0;
+};
+
+inline parallel_stats*& parallel_stats_sink() {
+    static thread_local parallel_stats* sink = nullptr;
+    return sink;
+}
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+template <typename F>
+void parallel_static(int nthr, const F& func) {
+    parallel_stats* stats = parallel_stats_sink();
+    if (stats == nullptr) {
+        tbb::parallel_for(0, nthr, func, tbb::static_partitioner());
+        return;
+    }
+
+    std::atomic<int64_t> max_busy {0};
+    const auto start = std::chrono::steady_clock::now();
+    tbb::parallel_for(
+        0, nthr,
+        [&](int ithr) {
+            const auto thr_start = std::chrono::steady_clock::now();
+            func(ithr);
+            const int64_t busy =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - thr_start).count();
+            int64_t prev = max_busy.load();
+            while (prev < busy && !max_busy.compare_exchange_weak(prev, busy)) {}
+        },
+        tbb::static_partitioner());
+    const int64_t wall =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    stats->regions++;
+    if (wall > max_busy.load())
+        stats->overhead_ns += static_cast<uint64_t>(wall - max_busy.load());
+}
+#endif
+}  // namespace details
+
+/**
+ * @brief Sets minimal number of iterations per thread for parallel_for* calls made by the current thread
+ * while the object exists. Loops with less than 2 * grain iterations are executed sequentially, so small
+ * loops don't pay scheduling overhead larger than the work. Use grain 1 to let all threads work (default).
+ */
+class parallel_grain_scope {
+public:
+    explicit parallel_grain_scope(size_t grain): _prev(details::parallel_grain()) {
+        details::parallel_grain() = std::max<size_t>(grain, 1);
+    }
+    ~parallel_grain_scope() {
+        details::parallel_grain() = _prev;
+    }
+    parallel_grain_scope(const parallel_grain_scope&) = delete;
+    parallel_grain_scope& operator=(const parallel_grain_scope&) = delete;
+
+private:
+    size_t _prev;
+};
+
+/**
+ * @brief Collects statistics of parallel regions started by parallel_for* calls of the current thread
+ * while the object exists. Only TBB based threading reports the statistics.
+ */
+class parallel_stats_scope {
+public:
+    explicit parallel_stats_scope(details::parallel_stats& stats): _prev(details::parallel_stats_sink()) {
+        details::parallel_stats_sink() = &stats;
+    }
+    ~parallel_stats_scope() {
+        details::parallel_stats_sink() = _prev;
+    }
+    parallel_stats_scope(const parallel_stats_scope&) = delete;
+    parallel_stats_scope& operator=(const parallel_stats_scope&) = delete;
+
+private:
+    details::parallel_stats* _prev;
+};
+
 template <typename F>
 void parallel_nt(int nthr, const F& func) {
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -382,18 +492,13 @@ void for_1d(const int& ithr, const int& nthr, const T0& D0, const F& func) {
 template <typename T0, typename F>
 void parallel_for(const T0& D0, const F& func) {
 #if IE_THREAD == IE_THREAD_TBB
-    auto work_amount = static_cast<size_t>(D0);
-    int nthr = parallel_get_max_threads();
-    if (static_cast<size_t>(nthr) > work_amount) nthr = static_cast<int>(work_amount);
+    const int nthr = details::parallel_work_threads(static_cast<size_t>(D0));
     if (nthr == 1) {
         for_1d(0, 1, D0, func);
     } else {
-        tbb::parallel_for(
-            0, nthr,
-            [&](int ithr) {
-                for_1d(ithr, nthr, D0, func);
-            },
-            tbb::static_partitioner());
+        details::parallel_static(nthr, [&](int ithr) {
+            for_1d(ithr, nthr, D0, func);
+        });
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
     const int nthr = parallel_get_max_threads();
@@ -401,6 +506,10 @@ void parallel_for(const T0& D0, const F& func) {
         for_1d(ithr, nthr, D0, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
+    if (details::parallel_grain() > 1 && details::parallel_work_threads(static_cast<size_t>(D0)) == 1) {
+        for_1d(0, 1, D0, func);
+        return;
+    }
 #pragma omp parallel
     for_1d(parallel_get_thread_num(), parallel_get_num_threads(), D0, func);
 #elif IE_THREAD == IE_THREAD_SEQ
@@ -427,18 +536,13 @@ void for_2d(const int& ithr, const int& nthr, const T0& D0, const T1& D1, const
 template <typename T0, typename T1, typename F>
 void parallel_for2d(const T0& D0, const T1& D1, const F& func) {
 #if IE_THREAD == IE_THREAD_TBB
-    auto work_amount = static_cast<size_t>(D0 * D1);
-    int nthr = parallel_get_max_threads();
-    if (static_cast<size_t>(nthr) > work_amount) nthr = static_cast<int>(work_amount);
+    const int nthr = details::parallel_work_threads(static_cast<size_t>(D0 * D1));
     if (nthr == 1) {
         for_2d(0, 1, D0, D1, func);
     } else {
-        tbb::parallel_for(
-            0, nthr,
-            [&](int ithr) {
-                for_2d(ithr, nthr, D0, D1, func);
-            },
-            tbb::static_partitioner());
+        details::parallel_static(nthr, [&](int ithr) {
+            for_2d(ithr, nthr, D0, D1, func);
+        });
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
     const int nthr = parallel_get_max_threads();
@@ -446,6 +550,10 @@ void parallel_for2d(const T0& D0, const T1& D1, const F& func) {
         for_2d(ithr, nthr, D0, D1, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
+    if (details::parallel_grain() > 1 && details::parallel_work_threads(static_cast<size_t>(D0 * D1)) == 1) {
+        for_2d(0, 1, D0, D1, func);
+        return;
+    }
 #pragma omp parallel
     for_2d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, func);
 #elif IE_THREAD == IE_THREAD_SEQ
@@ -473,18 +581,13 @@ void for_3d(const int& ithr, const int& nthr, const T0& D0, const T1& D1, const
 template <typename T0, typename T1, typename T2, typename F>
 void parallel_for3d(const T0& D0, const T1& D1, const T2& D2, const F& func) {
 #if IE_THREAD == IE_THREAD_TBB
-    auto work_amount = static_cast<size_t>(D0 * D1 * D2);
-    int nthr = parallel_get_max_threads();
-    if (static_cast<size_t>(nthr) > work_amount) nthr = static_cast<int>(work_amount);
+    const int nthr = details::parallel_work_threads(static_cast<size_t>(D0 * D1 * D2));
     if (nthr == 1) {
         for_3d(0, 1, D0, D1, D2, func);
     } else {
-        tbb::parallel_for(
-            0, nthr,
-            [&](int ithr) {
-                for_3d(ithr, nthr, D0, D1, D2, func);
-            },
-            tbb::static_partitioner());
+        details::parallel_static(nthr, [&](int ithr) {
+            for_3d(ithr, nthr, D0, D1, D2, func);
+        });
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
     const int nthr = parallel_get_max_threads();
@@ -492,6 +595,10 @@ void parallel_for3d(const T0& D0, const T1& D1, const T2& D2, const F& func) {
         for_3d(ithr, nthr, D0, D1, D2, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
+    if (details::parallel_grain() > 1 && details::parallel_work_threads(static_cast<size_t>(D0 * D1 * D2)) == 1) {
+        for_3d(0, 1, D0, D1, D2, func);
+        return;
+    }
 #pragma omp parallel
     for_3d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, func);
 #elif IE_THREAD == IE_THREAD_SEQ
@@ -520,18 +627,13 @@ void for_4d(const int& ithr, const int& nthr, const T0& D0, const T1& D1, const
 template <typename T0, typename T1, typename T2, typename T3, typename F>
 void parallel_for4d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, const F& func) {
 #if IE_THREAD == IE_THREAD_TBB
-    auto work_amount = static_cast<size_t>(D0 * D1 * D2 * D3);
-    int nthr = parallel_get_max_threads();
-    if (static_cast<size_t>(nthr) > work_amount) nthr = static_cast<int>(work_amount);
+    const int nthr = details::parallel_work_threads(static_cast<size_t>(D0 * D1 * D2 * D3));
     if (nthr == 1) {
         for_4d(0, 1, D0, D1, D2, D3, func);
     } else {
-        tbb::parallel_for(
-            0, nthr,
-            [&](int ithr) {
-                for_4d(ithr, nthr, D0, D1, D2, D3, func);
-            },
-            tbb::static_partitioner());
+        details::parallel_static(nthr, [&](int ithr) {
+            for_4d(ithr, nthr, D0, D1, D2, D3, func);
+        });
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
     const int nthr = parallel_get_max_threads();
@@ -539,6 +641,10 @@ void parallel_for4d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, cons
         for_4d(ithr, nthr, D0, D1, D2, D3, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
+    if (details::parallel_grain() > 1 && details::parallel_work_threads(static_cast<size_t>(D0 * D1 * D2 * D3)) == 1) {
+        for_4d(0, 1, D0, D1, D2, D3, func);
+        return;
+    }
 #pragma omp parallel
     for_4d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, D3, func);
 #elif IE_THREAD == IE_THREAD_SEQ
@@ -569,18 +675,13 @@ void for_5d(const int& ithr, const int& nthr, const T0& D0, const T1& D1, const
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename F>
 void parallel_for5d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, const T4& D4, const F& func) {
 #if IE_THREAD == IE_THREAD_TBB
-    auto work_amount = static_cast<size_t>(D0 * D1 * D2 * D3 * D4);
-    int nthr = parallel_get_max_threads();
-    if (static_cast<size_t>(nthr) > work_amount) nthr = static_cast<int>(work_amount);
+    const int nthr = details::parallel_work_threads(static_cast<size_t>(D0 * D1 * D2 * D3 * D4));
     if (nthr == 1) {
         for_5d(0, 1, D0, D1, D2, D3, D4, func);
     } else {
-        tbb::parallel_for(
-            0, nthr,
-            [&](int ithr) {
-                for_5d(ithr, nthr, D0, D1, D2, D3, D4, func);
-            },
-            tbb::static_partitioner());
+        details::parallel_static(nthr, [&](int ithr) {
+            for_5d(ithr, nthr, D0, D1, D2, D3, D4, func);
+        });
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
     const int nthr = parallel_get_max_threads();
@@ -588,6 +689,10 @@ void parallel_for5d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, cons
         for_5d(ithr, nthr, D0, D1, D2, D3, D4, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
+    if (details::parallel_grain() > 1 && details::parallel_work_threads(static_cast<size_t>(D0 * D1 * D2 * D3 * D4)) == 1) {
+        for_5d(0, 1, D0, D1, D2, D3, D4, func);
+        return;
+    }
 #pragma omp parallel
     for_5d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, D3, D4, func);
 #elif IE_THREAD == IE_THREAD_SEQ
@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -153,11 +155,140 @@ DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_NAME, std::string);
  */
 DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 
+/**
+ * @brief Metric which shows whether device imports networks exported by ExecutableNetwork::Export without
+ * compiling them again
+ *
+ * String value is "IMPORT_EXPORT_SUPPORT". If device reports `true`, Core uses the exported form of
+ * networks to cache compiled networks in the directory specified by KEY_CACHE_DIR. Devices which compile
+ * imported networks again report `false` even if they implement Export / Import, since the cache would only
+ * add the export cost to LoadNetwork
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
 /**
  * @brief Metric to get an unsigned integer value of optimal number of executable network infer requests.
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get number of inferences which found graph compiled for their input shapes in the cache.
+ *
+ * String value is "CPU_SHAPE_CACHE_HITS". Reported by CPU executable networks loaded with KEY_CPU_DYNAMIC_SHAPES
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPE_CACHE_HITS, unsigned int);
+
+/**
+ * @brief Metric to get number of inferences which compiled graph for their input shapes.
+ *
+ * String value is "CPU_SHAPE_CACHE_MISSES". Reported by CPU executable networks loaded with KEY_CPU_DYNAMIC_SHAPES
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPE_CACHE_MISSES, unsigned int);
+
+/**
+ * @brief Metric to get size in bytes of memory arena planned for intermediate tensors of one infer request.
+ *
+ * String value is "CPU_MEMORY_ARENA_SIZE"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_MEMORY_ARENA_SIZE, uint64_t);
+
+/**
+ * @brief Metric to get lower bound in bytes of CPU_MEMORY_ARENA_SIZE: maximal total size of intermediate
+ * tensors alive at the same time.
+ *
+ * String value is "CPU_MEMORY_ARENA_LOWER_BOUND"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_MEMORY_ARENA_LOWER_BOUND, uint64_t);
+
+/**
+ * @brief Metric to get fraction of the memory arena and weights of CPU graph which is backed by huge pages.
+ *
+ * It is estimated by AnonHugePages of /proc/self/smaps on Linux and is 0 on other OSes.
+ * String value is "CPU_HUGE_PAGES_FRACTION". Reported by CPU executable networks loaded with KEY_CPU_HUGE_PAGES
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_HUGE_PAGES_FRACTION, float);
+
+/**
+ * @brief Metric to get number of bytes of intermediate memory returned to the OS by the last
+ * KEY_CPU_TRIM_MEMORY request of CPU executable network.
+ *
+ * String value is "CPU_TRIMMED_MEMORY_SIZE"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_TRIMMED_MEMORY_SIZE, uint64_t);
+
+/**
+ * @brief Metric to get instruction set used by implementation of each CPU graph node, node name is a key.
+ *
+ * Values are "avx512_vnni", "avx512", "avx2", "avx", "sse42", "ref" (reference C++ code),
+ * "blas", "any" (instruction set is selected by the implementation in runtime) or "unknown".
+ * String value is "CPU_NODES_ISA"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_NODES_ISA, std::map<std::string, std::string>);
+
+/**
+ * @brief Metric to get number of reorders of layouts or precisions executed by CPU graph on each inference.
+ *
+ * Reorders of constant tensors, which are executed once when the network is loaded, are not counted.
+ * String value is "CPU_REORDERS_NUM"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_REORDERS_NUM, unsigned int);
+
+/**
+ * @brief Metric to get the parts of CPU graph which are executed slower than they could be, one message per node.
+ *
+ * For example, Int8 Convolution, Deconvolution and FullyConnected nodes executed without JIT kernels, which can be
+ * slower than FP32 ones, or Sums of Int8 Convolution outputs which are not fused into the convolution, with the
+ * reason. The value is collected when the network is loaded.
+ * String value is "CPU_PERFORMANCE_WARNINGS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_PERFORMANCE_WARNINGS, std::vector<std::string>);
+
+/**
+ * @brief Metric to get live counters of CPU executable network, they are always collected and cheap to read.
+ *
+ * Keys are "inferences" (finished inferences), "queued" (started requests waiting for a stream), "running"
+ * (requests executed by streams), "busy_us" (time spent by all streams on inferences, divided by "uptime_us" and
+ * number of streams it gives streams utilization), "uptime_us" (time since the network is loaded) and
+ * "latency_p50_us", "latency_p90_us", "latency_p99_us" (percentiles of time from start of requests including
+ * waiting in the queue to the end of inference since the network is loaded, estimated with up to 25% error).
+ * String value is "CPU_RUNTIME_STATISTICS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_RUNTIME_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get device memory statistics in bytes of the context GPU executable network is loaded to.
+ *
+ * Keys are "allocated" (currently allocated), "peak" (maximal allocated), "reused" (total size of requests
+ * served by already allocated buffers) and "cached" (kept for reuse after destroyed networks).
+ * String value is "GPU_MEMORY_STATISTICS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(GPU_MEMORY_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get logical processors used by each stream of CPU executable network, stream index is a vector index.
+ *
+ * Values look like "big:0,2,4,6" or "little:16,17" with a type of cores the stream is placed on.
+ * String value is "CPU_STREAMS_PROCESSORS". Reported by CPU executable networks loaded with KEY_CPU_BIND_THREAD
+ * equal to HYBRID_AWARE on hybrid CPUs
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_STREAMS_PROCESSORS, std::vector<std::string>);
+
+/**
+ * @brief Metric to get the number of logical processors CPU plugin sizes the default streams and threads for.
+ *
+ * These are the processors of the process affinity mask (cpuset) limited by the CPU quota of the container (cgroup),
+ * so in a container limited to 4 CPUs on a 64 cores host the value is 4.
+ * String value is "CPU_AVAILABLE_PROCESSORS"
+ */
+DECLARE_METRIC_KEY(CPU_AVAILABLE_PROCESSORS, unsigned int);
+
+/**
+ * @brief Metric to get the number of threads of each stream of CPU executable network, derived from the config and
+ * the available processors.
+ * String value is "CPU_STREAM_THREADS". Not reported for networks loaded with KEY_EXCLUSIVE_ASYNC_REQUESTS
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_STREAM_THREADS, unsigned int);
+
 }  // namespace Metrics
 
 /**
@@ -197,6 +328,8 @@ DECLARE_CONFIG_KEY(CPU_THREADS_NUM);
  * It is passed to Core::SetConfig(), this option should be used with values:
  * PluginConfigParams::YES (pinning threads to cores, best for static benchmarks),
  * PluginConfigParams::NUMA (pinning threads to NUMA nodes, best for real-life, contented cases)
+ * PluginConfigParams::HYBRID_AWARE (pinning threads to cores of hybrid CPUs, so a latency stream runs on big cores only
+ * and threads of each throughput stream run on cores of the same type, Linux only, same as YES on other CPUs)
  * this is TBB-specific knob, and the only pinning option (beyond 'NO', below) on the Windows*
  * PluginConfigParams::NO (no pinning for CPU inference threads)
  * All settings are ignored, if the OpenVINO compiled with OpenMP threading and any affinity-related OpenMP's
@@ -204,6 +337,7 @@ DECLARE_CONFIG_KEY(CPU_THREADS_NUM);
  */
 DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 DECLARE_CONFIG_VALUE(NUMA);
+DECLARE_CONFIG_VALUE(HYBRID_AWARE);
 
 /**
  * @brief Optimize CPU execution to maximize throughput.
@@ -290,8 +424,10 @@ DECLARE_CONFIG_KEY(DUMP_KERNELS);
  * PluginConfigParams::TUNING_CREATE - create tuning data for parameters not present in tuning file
  * PluginConfigParams::TUNING_UPDATE - perform non-tuning updates like removal of invalid/deprecated data
  * PluginConfigParams::TUNING_RETUNE - create tuning data for all parameters, even if already present
+ * PluginConfigParams::TUNING_BACKGROUND - use existing data from tuning file if present, and create tuning data
+ *                                         for missing parameters in background after the first inferences
  *
- * For values TUNING_CREATE and TUNING_RETUNE the file will be created if it does not exist.
+ * For values TUNING_CREATE, TUNING_RETUNE and TUNING_BACKGROUND the file will be created if it does not exist.
  */
 DECLARE_CONFIG_KEY(TUNING_MODE);
 
@@ -300,6 +436,7 @@ DECLARE_CONFIG_VALUE(TUNING_USE_EXISTING);
 DECLARE_CONFIG_VALUE(TUNING_DISABLED);
 DECLARE_CONFIG_VALUE(TUNING_UPDATE);
 DECLARE_CONFIG_VALUE(TUNING_RETUNE);
+DECLARE_CONFIG_VALUE(TUNING_BACKGROUND);
 
 /**
  * @brief This key defines the tuning data filename to be created/used
@@ -341,6 +478,19 @@ DECLARE_CONFIG_KEY(DEVICE_ID);
  */
 DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
 
+/**
+ * @brief The name for setting the deadline of infer requests, in milliseconds from InferRequest::StartAsync()
+ * or InferRequest::Infer().
+ *
+ * A request that has not started executing by its deadline is dropped: it completes immediately with
+ * StatusCode::INFER_DEADLINE_EXPIRED and its outputs are not changed. A request that has started runs to
+ * completion. It is passed to Core::LoadNetwork() or ExecutableNetwork::SetConfig() with a non-negative integer
+ * value, 0 (default) means no deadline. Infer requests keep the deadline set when they are created, so requests of
+ * one network get different deadlines if ExecutableNetwork::SetConfig() is called between creations.
+ * Supported by the CPU and MULTI plugins.
+ */
+DECLARE_CONFIG_KEY(REQUEST_DEADLINE);
+
 /**
  * @brief This key enables dumping of the internal primitive graph.
  *
@@ -362,6 +512,272 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The name for setting layers to keep in FP32 precision when KEY_ENFORCE_BF16 is enabled.
+ *
+ * It is passed to Core::LoadNetwork(), value is a comma separated list of layer names or layer types
+ * (e.g. "Softmax,conv_17/WithoutBiases"), default is empty list. It lets to keep accuracy sensitive layers
+ * in FP32 and execute the rest of network in bfloat16.
+ */
+DECLARE_CONFIG_KEY(CPU_BF16_FP32_LAYERS);
+
+/**
+ * @brief The name for setting CPU plugin to share reordered weights between processes.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ *
+ * If set to YES, reordered weights are kept in named shared memory (one region per NUMA node and weight),
+ * so processes of the same user loading the same model keep only one physical copy of them.
+ * The option is supported on POSIX systems only.
+ */
+DECLARE_CONFIG_KEY(CPU_CROSS_PROCESS_WEIGHTS);
+
+/**
+ * @brief The name for setting CPU plugin to accept input shapes different from the loaded network ones.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ *
+ * Dimensions of the loaded network are upper bounds: an input blob of the same rank with each dimension
+ * not greater than the network one can be set to an infer request without reshape and new LoadNetwork.
+ * Graph for each new combination of input shapes is compiled on its first inference and is cached,
+ * output blobs are reallocated to the output shapes of that graph.
+ * Can not be combined with KEY_DYN_BATCH_ENABLED.
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES);
+
+/**
+ * @brief The name for setting maximal number of input shapes combinations, which graphs are kept compiled
+ * by CPU plugin when KEY_CPU_DYNAMIC_SHAPES is enabled. Least recently used ones are dropped first.
+ *
+ * It is passed to Core::LoadNetwork(), value should be a positive integer, default is "16"
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES_CACHE_SIZE);
+
+/**
+ * @brief The name for setting strategy used by CPU plugin to place intermediate tensors in memory arena.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY (default) or PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT.
+ * BEST_FIT takes more time on LoadNetwork, but never gives bigger arena than GREEDY.
+ * Planned arena size can be checked with METRIC_KEY(CPU_MEMORY_ARENA_SIZE).
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_SOLVER);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_SOLVER_GREEDY);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_SOLVER_BEST_FIT);
+
+/**
+ * @brief The name for setting concurrent execution of independent graph nodes by CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+ * PluginConfigParams::NO (default). Takes effect only for TBB builds; it helps latency of networks with
+ * parallel branches of small layers, when a stream has more threads than a single layer can use.
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLEL);
+
+/**
+ * @brief The name for setting the time in microseconds a stream thread of the CPU plugin polls for the next
+ * inference request before it falls asleep.
+ *
+ * A request that comes within this time doesn't pay the thread wake-up latency, at the cost of CPU time burnt
+ * by idle streams. It is passed to Core::LoadNetwork() with a non-negative integer value, 0 (default) disables
+ * polling.
+ */
+DECLARE_CONFIG_KEY(CPU_SPIN_WAIT_TIME);
+
+/**
+ * @brief The name for setting execution of CPU networks by streams shared by all networks of the process.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+ * PluginConfigParams::NO (default). The streams are created by the first network loaded with the option (its
+ * KEY_CPU_THROUGHPUT_STREAMS, KEY_CPU_THREADS_NUM and KEY_CPU_BIND_THREAD define the process thread budget),
+ * networks loaded later reuse them while any network using them is alive. Free streams take inferences of
+ * the networks in turns, so each network gets a fair share of the streams without threads oversubscription.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS);
+
+/**
+ * @brief The name for setting execution of the infer request completion callbacks on the inference threads.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+ * PluginConfigParams::NO (default). By default the callback is passed to a separate callback thread when
+ * the streams are used. With YES the callback is called by the stream thread right after the inference,
+ * which removes a thread handoff per request, but the stream does not take the next request until the callback
+ * returns, so callbacks should be short and must not wait for other requests of the network.
+ */
+DECLARE_CONFIG_KEY(CPU_INLINE_CALLBACKS);
+
+/**
+ * @brief The name for setting revision of layouts selected for CPU graph nodes to reduce the number of reorders.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::YES (default) or
+ * PluginConfigParams::NO. Layout agnostic nodes, such as Eltwise and FakeQuantize, take the layout which needs the
+ * least data to be reordered between them and both their producers and consumers, instead of the layout of
+ * producers only. The number of reorders is reported by METRIC_KEY(CPU_REORDERS_NUM).
+ */
+DECLARE_CONFIG_KEY(CPU_LAYOUT_PROPAGATION);
+
+/**
+ * @brief The name for setting transparent huge pages backing of weights and intermediate tensors by CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+ * PluginConfigParams::NO (default). Weights and the memory arena of 2 MB and larger are aligned to 2 MB and
+ * advised for huge pages (Linux only), which reduces TLB misses of large models. Huge pages must be enabled
+ * in "always" or "madvise" mode, the fraction actually backed by them is reported by
+ * METRIC_KEY(CPU_HUGE_PAGES_FRACTION). Weights shared between processes by KEY_CPU_CROSS_PROCESS_WEIGHTS
+ * are not affected.
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+
+/**
+ * @brief The name for setting warm-up of CPU networks while they are loaded.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+ * PluginConfigParams::NO (default). The graph of every stream is executed once on zero inputs by the stream
+ * threads, so kernels are initialized and the memory of the streams is faulted in, and the blobs of infer
+ * requests are touched when the requests are created. The first inference then runs with steady-state latency
+ * at the cost of longer LoadNetwork(). Networks with memory layers are not executed to keep their state.
+ */
+DECLARE_CONFIG_KEY(CPU_WARMUP);
+
+/**
+ * @brief The name for releasing intermediate memory of a loaded CPU network.
+ *
+ * It is passed to ExecutableNetwork::SetConfig() of a loaded network with PluginConfigParams::YES; it is an
+ * action rather than an option and is not reported by GetConfig(). Pages of the memory arenas of all streams,
+ * except constant data, are returned to the OS (Linux only) and faulted in again by the next inference, so
+ * idle networks of multi-model applications don't keep their intermediate memory. Streams busy with an
+ * inference are trimmed after it. Input / output blobs of infer requests and networks with memory layers are
+ * not trimmed. The number of released bytes is reported by METRIC_KEY(CPU_TRIMMED_MEMORY_SIZE).
+ */
+DECLARE_CONFIG_KEY(CPU_TRIM_MEMORY);
+
+/**
+ * @brief The name for setting maximal instruction set of implementations selected by CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::CPU_ISA_SSE42,
+ * PluginConfigParams::CPU_ISA_AVX, PluginConfigParams::CPU_ISA_AVX2, PluginConfigParams::CPU_ISA_AVX512
+ * or empty string (default, no limit). It is useful to get the same implementations on machines with different CPUs.
+ * Nodes which have no implementation within the limit keep the best one, see METRIC_KEY(CPU_NODES_ISA).
+ */
+DECLARE_CONFIG_KEY(CPU_MAX_ISA);
+DECLARE_CONFIG_VALUE(CPU_ISA_SSE42);
+DECLARE_CONFIG_VALUE(CPU_ISA_AVX);
+DECLARE_CONFIG_VALUE(CPU_ISA_AVX2);
+DECLARE_CONFIG_VALUE(CPU_ISA_AVX512);
+
+/**
+ * @brief The name for setting minimal sparsity of FullyConnected weights to use sparse implementation by CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), value is a floating point number in [0, 1] range, fraction of zero
+ * weights from which layer weights are stored compressed and sparse matrix multiplication is used.
+ * Default is 1 (disabled). Applies to FP32 FullyConnected layers with constant weights and 2D input.
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_THRESHOLD);
+
+/**
+ * @brief The name for setting weight-only compression of FullyConnected layers by CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::CPU_WEIGHTS_U8,
+ * PluginConfigParams::CPU_WEIGHTS_I4 or empty string (default, no compression). Weights are quantized per output
+ * channel with scales and zero points at load time and decompressed inside the kernel, activations stay in FP32.
+ * Applies to FP32 FullyConnected layers with constant weights and 2D input, it reduces memory footprint and
+ * bandwidth at the cost of accuracy, no calibration is needed.
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_COMPRESSION);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_U8);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_I4);
+
+/**
+ * @brief The name for setting minimal work amount of CPU plugin nodes executed in parallel.
+ *
+ * It is passed to Core::LoadNetwork(), value is a non negative integer number of tensor elements, default is 0.
+ * Nodes whose largest input or output tensor has less elements run their own loops sequentially, because
+ * scheduling overhead of such small nodes is larger than the work. It doesn't affect oneDNN primitives.
+ * With KEY_PERF_COUNT the time of parallel regions not spent by their longest thread is excluded from cpu_uSec
+ * of the node, so realTime_uSec - cpu_uSec is the parallel overhead (TBB builds only).
+ */
+DECLARE_CONFIG_KEY(CPU_MIN_PARALLEL_WORK);
+
+/**
+ * @brief The name for setting load time autotuning of convolutions by CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), value is a non negative integer number of the best convolution
+ * implementations (e.g. direct JIT, Winograd, GEMM) which are benchmarked for each convolution shape while the
+ * network is loaded, the fastest one is used. Default is 0 (disabled, the first implementation by priority is used).
+ * Results are kept per shape for the lifetime of the plugin and stored with exported networks, so networks imported
+ * from KEY_CACHE_DIR on the same CPU model are not benchmarked again. Layers with PrimitivesPriority are not tuned.
+ */
+DECLARE_CONFIG_KEY(CPU_CONV_AUTOTUNE);
+
+/**
+ * @brief The name for setting NUMA sharding of large embedding tables by CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), value is a non negative integer size in megabytes, default is 0 (disabled).
+ * Constant tables of Gather (axis 0), EmbeddingBagOffsetsSum, EmbeddingBagPackedSum and EmbeddingSegmentsSum of this
+ * size and larger are stored once per network instead of once per NUMA node: their rows are split into contiguous
+ * shards placed on different NUMA nodes (Linux only), so a lookup of a row reads the node which owns it and the
+ * memory bandwidth of all sockets is used. Smaller weights are still replicated per NUMA node. It has no effect
+ * on machines with one NUMA node.
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_SHARDING_THRESHOLD);
+
+/**
+ * @brief The name for enabling detailed per node profiling by CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values: PluginConfigParams::YES or
+ * PluginConfigParams::NO (default). Together with KEY_PERF_COUNT nodes of the execution graph additionally report
+ * minimal and maximal execution time, bytes read and written by one execution, number of operations and achieved
+ * GOPS, so memory bound nodes can be told from compute bound ones by the ratio of operations to bytes.
+ */
+DECLARE_CONFIG_KEY(CPU_DETAILED_PERF_COUNT);
+
+/**
+ * @brief The name for setting sampling period of the performance counters of CPU networks.
+ *
+ * It is passed to Core::LoadNetwork() or ExecutableNetwork::SetConfig(), this option should be used with
+ * a positive integer value N, 1 by default. Together with KEY_PERF_COUNT nodes are timed on 1 of every N inferences
+ * of each stream only, so the counters can be kept enabled in production with little overhead. Execution times
+ * reported by InferRequest::GetPerformanceCounts() are averaged over the sampled inferences.
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_PERIOD);
+
+/**
+ * @brief The name for starting a time window of the performance counters collection of a loaded CPU network.
+ *
+ * It is passed to ExecutableNetwork::SetConfig() of a loaded network with a non-negative integer number of
+ * milliseconds; it is an action rather than an option and is not reported by GetConfig(). Nodes are timed on every
+ * inference started within the window, even if KEY_PERF_COUNT is disabled, and the counters collected before
+ * are reset, so InferRequest::GetPerformanceCounts() reports the inferences of the window. 0 ends the window.
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_WINDOW);
+
+/**
+ * @brief The name for setting a file where CPU plugin writes timeline of inference in Chrome trace format.
+ *
+ * It is passed to Core::LoadNetwork(), value is a path to the file, default is empty string (tracing disabled).
+ * Each infer request records waiting in the queue, pipeline stages, preprocessing, copying of inputs and outputs,
+ * execution of every node and the completion callback with ids of threads of the streams. The trace is written by
+ * the ngraph event tracer, it is shared by the process and enabled till the process end once any network enables it.
+ * The file can be opened in chrome://tracing or Perfetto UI.
+ */
+DECLARE_CONFIG_KEY(CPU_TRACE_FILE);
+
+/**
+ * @brief The name for setting priority of CPU infer requests in the streams executor.
+ *
+ * It is passed to Core::LoadNetwork() or ExecutableNetwork::SetConfig(), this option should be used with values:
+ * PluginConfigParams::CPU_REQUEST_PRIORITY_HIGH, PluginConfigParams::CPU_REQUEST_PRIORITY_NORMAL (default) or
+ * PluginConfigParams::CPU_REQUEST_PRIORITY_LOW. Infer requests keep the priority set when they are created, so
+ * requests of one network get different priorities if ExecutableNetwork::SetConfig() is called between creations.
+ * A free stream takes the task of the highest priority, each 100 ms of waiting raise a task priority by one level.
+ */
+DECLARE_CONFIG_KEY(CPU_REQUEST_PRIORITY);
+DECLARE_CONFIG_VALUE(CPU_REQUEST_PRIORITY_HIGH);
+DECLARE_CONFIG_VALUE(CPU_REQUEST_PRIORITY_NORMAL);
+DECLARE_CONFIG_VALUE(CPU_REQUEST_PRIORITY_LOW);
+
 /**
 * @brief This key defines the directory which will be used to store any data cached by plugins.
 *
@@ -372,6 +788,9 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
 * The key might enable caching for all plugin or some specific ones, e.g.:
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}) - enables cache for all plugins that might want to use it
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}, {"GPU"}) - enables cache only for GPU plugin
+* For devices which report METRIC_KEY(IMPORT_EXPORT_SUPPORT) Core::LoadNetwork stores exported networks in this
+* directory and imports them on subsequent loads of the same network with the same config, including the options
+* set via Core::SetConfig
 */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
@@ -16,10 +16,11 @@
 namespace InferenceEngine {
 
 /**
- * @brief The transformation finds all TensorIterator layers in the network, processes all back
- * edges that describe a connection between Result and Parameter of the TensorIterator body,
+ * @brief The transformation finds all TensorIterator and Loop layers in the network, processes all back
+ * edges that describe a connection between Result and Parameter of the body,
  * and inserts ReadValue layer between Parameter and the next layers after this Parameter,
  * and Assign layer after the layers before the Result layer.
+ * Loop is processed only if the number of its iterations is known.
  * Supported platforms: CPU, GNA.
  *
  *  The example below describes the changes to the inner part (body, back edges) of the TensorIterator layer.
@@ -35,7 +36,8 @@ namespace InferenceEngine {
  *                                                               -> Result ] -> back_edge_1
  *
  *  It is recommended to use this transformation in conjunction with the Reshape feature to set sequence
- *  dimension to 1 and with the UnrollTensorIterator transformation.
+ *  dimension to 1 (or to the number of steps processed by one inference) and with the UnrollTensorIterator
+ *  transformation.
  *  For convenience, we have already enabled the unconditional execution of the UnrollTensorIterator
  *  transformation when using the LowLatency transformation for CPU, GNA plugins, no action is required here.
  *  After applying both of these transformations, the resulting network can be inferred step by
@@ -43,7 +45,8 @@ namespace InferenceEngine {
  *
  *    An illustrative example, not real API:
  *
- *    network->reshape(...) // Set sequence dimension to 1, recalculating shapes. Optional, depends on the network.
+ *    network->reshape(...) // Set sequence dimension to 1 or to the chunk size, recalculating shapes. Optional,
+ *                          // depends on the network.
  *    LowLatency(network)   // Applying LowLatency and UnrollTensorIterator transformations.
  *    network->infer (...)  // Calculating new values for states.
  *    // All states are stored between inferences via Assign, ReadValue layers.
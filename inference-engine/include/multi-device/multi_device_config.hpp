@@ -34,5 +34,37 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
+/**
+ * @brief Scheduling policy used to distribute infer requests over the devices:
+ *  - MULTI_DEVICE_PRIORITY (default): the first device (in the DEVICE_PRIORITIES order) with an idle request is used
+ *  - MULTI_EXPECTED_COMPLETION_TIME: the device with the smallest expected completion time is used,
+ *    estimated from the measured (running average) latency of the completed requests and the current device load
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(DEVICE_PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(EXPECTED_COMPLETION_TIME);
+
+/**
+ * @brief Enables (YES) the runtime adjustment of the number of the worker requests per device (NO by default).
+ * Each device pool starts with the device OPTIMAL_NUMBER_OF_INFER_REQUESTS (or the number from the DEVICE_PRIORITIES)
+ * and grows (up to twice that) while the tasks wait for the requests and the throughput improves,
+ * or shrinks (down to one request) while some of the requests stay unused
+ */
+DECLARE_MULTI_CONFIG_KEY(ADAPTIVE_NUM_REQUESTS);
+
+/**
+ * @brief Enables (YES) returning the executable network as soon as the network is loaded to any of the devices
+ * (NO by default, so all the devices are loaded first). The rest of the devices start serving the requests
+ * as their loads complete, so e.g. the CPU serves while the GPU compiles the kernels.
+ * The devices that fail to load later are just not used
+ */
+DECLARE_MULTI_CONFIG_KEY(EARLY_START);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
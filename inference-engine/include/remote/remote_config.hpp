@@ -0,0 +1,44 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for REMOTE plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file remote_config.hpp
+ */
+
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief REMOTE plugin configuration
+ */
+namespace RemoteConfigParams {
+
+/**
+ * @def REMOTE_CONFIG_KEY(name)
+ * @brief A macro which provides a REMOTE-mangled name for configuration key with name `name`
+ */
+#define REMOTE_CONFIG_KEY(name) InferenceEngine::RemoteConfigParams::_CONFIG_KEY(REMOTE_##name)
+
+#define DECLARE_REMOTE_CONFIG_KEY(name) DECLARE_CONFIG_KEY(REMOTE_##name)
+
+/**
+ * @brief The device the workers load the network to, e.g. "CPU" or "GPU.1".
+ * Set automatically for the "REMOTE:<device>" device name
+ */
+DECLARE_REMOTE_CONFIG_KEY(DEVICE_CONFIG);
+
+/**
+ * @brief Comma-separated list of the worker processes (started with the remote_worker tool) in the "<host>:<port>" format,
+ * e.g. "localhost:9797,192.168.0.2:9797". The infer requests are sent to the worker with the fewest requests in flight
+ */
+DECLARE_REMOTE_CONFIG_KEY(WORKERS);
+
+}  // namespace RemoteConfigParams
+}  // namespace InferenceEngine
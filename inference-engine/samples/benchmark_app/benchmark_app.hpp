@@ -37,6 +37,20 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for open-loop request rate
+static const char qps_message[] = "Optional. Target rate of infer requests per second for async API. If specified, requests are "
+                                  "started at scheduled arrival times instead of right after completion of previous ones (open-loop "
+                                  "load) and latency is measured from the scheduled arrival time.";
+
+/// @brief message for arrival distribution
+static const char arrival_message[] = "Optional. Distribution of request arrivals for -qps: \"constant\" (default) or \"poisson\".";
+
+/// @brief message for concurrent models
+static const char concurrent_m_message[] = "Optional. Comma-separated list of models inferred asynchronously in background "
+                                           "during the measurement of the -m model, in format <path>[@<device>][:<nireq>[:<qps>]]. "
+                                           "Device defaults to -d, number of requests defaults to the optimal one for the device, "
+                                           "requests are started right after completion if <qps> is not set.";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -79,6 +93,10 @@ static const char report_type_message[] = "Optional. Enable collecting statistic
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
+// @brief message for startup_report option
+static const char startup_report_message[] = "Optional. Path to a JSON file where to store the time taken by every step "
+                                             "from reading of the model to the end of the first inference.";
+
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
@@ -142,6 +160,15 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Target rate of infer requests for open-loop load
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Distribution of request arrivals for open-loop load
+DEFINE_string(arrival, "constant", arrival_message);
+
+/// @brief Models inferred concurrently with the main one
+DEFINE_string(concurrent_m, "", concurrent_m_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 
@@ -167,6 +194,9 @@ DEFINE_string(report_type, "", report_type_message);
 /// @brief Path to a folder where statistics report is stored
 DEFINE_string(report_folder, "", report_folder_message);
 
+/// @brief Path to a file where startup time breakdown is stored
+DEFINE_string(startup_report, "", startup_report_message);
+
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
@@ -208,6 +238,9 @@ static void showUsage() {
     std::cout << "    -api \"<sync/async>\"       " << api_message << std::endl;
     std::cout << "    -niter \"<integer>\"        " << iterations_count_message << std::endl;
     std::cout << "    -nireq \"<integer>\"        " << infer_requests_count_message << std::endl;
+    std::cout << "    -qps \"<float>\"            " << qps_message << std::endl;
+    std::cout << "    -arrival \"<type>\"         " << arrival_message << std::endl;
+    std::cout << "    -concurrent_m \"<list>\"    " << concurrent_m_message << std::endl;
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
@@ -221,6 +254,7 @@ static void showUsage() {
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
+    std::cout << "    -startup_report \"<path>\"  " << startup_report_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
 #ifdef USE_OPENCV
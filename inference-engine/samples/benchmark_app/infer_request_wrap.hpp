@@ -14,6 +14,8 @@
 #include <mutex>
 #include <algorithm>
 #include <functional>
+#include <random>
+#include <thread>
 
 #include <inference_engine.hpp>
 #include "statistics_report.hpp"
@@ -42,7 +44,12 @@ public:
     }
 
     void startAsync() {
-        _startTime = Time::now();
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request which arrived at the given time, the waiting time is counted in the latency
+    void startAsync(Time::time_point arrivalTime) {
+        _startTime = arrivalTime;
         _request.StartAsync();
     }
 
@@ -78,6 +85,39 @@ private:
     QueueCallbackFunction _callbackQueue;
 };
 
+/// @brief Schedules arrivals of infer requests for open-loop load with the given rate
+class ArrivalScheduler final {
+public:
+    ArrivalScheduler(double requestsPerSecond, bool poisson) :
+        _requestsPerSecond(requestsPerSecond),
+        _poisson(poisson),
+        _interval(requestsPerSecond > 0 ? requestsPerSecond : 1.0),
+        _nextArrival(Time::now()) {}
+
+    bool enabled() const {
+        return _requestsPerSecond > 0;
+    }
+
+    /// @brief Waits for the arrival time of the next request
+    Time::time_point waitNextArrival() {
+        std::this_thread::sleep_until(_nextArrival);
+        return _nextArrival;
+    }
+
+    /// @brief Schedules arrival time of the next request
+    void scheduleNextArrival() {
+        auto interval = _poisson ? _interval(_generator) : 1.0 / _requestsPerSecond;
+        _nextArrival += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+    }
+
+private:
+    double _requestsPerSecond;
+    bool _poisson;
+    std::mt19937 _generator;
+    std::exponential_distribution<double> _interval;
+    Time::time_point _nextArrival;
+};
+
 class InferRequestsQueue final {
 public:
     InferRequestsQueue(InferenceEngine::ExecutableNetwork& net, size_t nireq) {
@@ -102,6 +142,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _completionTimes.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -111,9 +152,11 @@ public:
     void putIdleRequest(size_t id,
                         const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
+        auto now = Time::now();
         _latencies.push_back(latency);
+        _completionTimes.push_back(now);
         _idleIds.push(id);
-        _endTime = std::max(Time::now(), _endTime);
+        _endTime = std::max(now, _endTime);
         _cv.notify_one();
     }
 
@@ -135,6 +178,19 @@ public:
         return _latencies;
     }
 
+    /// @brief Returns latencies grouped by the second of execution in which the requests were completed
+    std::vector<std::vector<double>> getLatenciesPerSecond() {
+        std::vector<std::vector<double>> latencies;
+        for (size_t i = 0; i < _latencies.size(); i++) {
+            auto second = static_cast<size_t>(std::max<int64_t>(
+                std::chrono::duration_cast<std::chrono::seconds>(_completionTimes[i] - _startTime).count(), 0));
+            if (latencies.size() <= second)
+                latencies.resize(second + 1);
+            latencies[second].push_back(_latencies[i]);
+        }
+        return latencies;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -144,4 +200,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<Time::time_point> _completionTimes;
 };
@@ -3,10 +3,16 @@
 //
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iterator>
 #include <memory>
 #include <map>
+#include <numeric>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -56,6 +62,14 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_qps < 0 || (FLAGS_qps > 0 && FLAGS_api != "async")) {
+        throw std::logic_error("Incorrect -qps option value. Target rate must be positive and can be set for async API only.");
+    }
+
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `constant` or `poisson` value.");
+    }
+
     if (!FLAGS_report_type.empty() &&
         FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
@@ -103,6 +117,41 @@ T getMedianValue(const std::vector<T> &vec) {
            (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
 }
 
+/**
+* @brief Returns percentile of the sorted values using the nearest-rank method
+*/
+template <typename T>
+T getPercentileValue(const std::vector<T> &sortedVec, double percentile) {
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedVec.size()));
+    return sortedVec[std::min(std::max<size_t>(rank, 1ULL), sortedVec.size()) - 1ULL];
+}
+
+/**
+* @brief Returns minimum, average, maximum and tail percentiles of the sorted latencies
+*/
+static std::vector<std::pair<std::string, double>> getLatencyPercentiles(const std::vector<double> &sortedLatencies) {
+    return {
+        {"min", sortedLatencies.front()},
+        {"avg", std::accumulate(sortedLatencies.begin(), sortedLatencies.end(), 0.0) / sortedLatencies.size()},
+        {"p90", getPercentileValue(sortedLatencies, 90.0)},
+        {"p99", getPercentileValue(sortedLatencies, 99.0)},
+        {"p99.9", getPercentileValue(sortedLatencies, 99.9)},
+        {"max", sortedLatencies.back()},
+    };
+}
+
+/**
+* @brief Model inferred asynchronously in background during the measurement of the main model
+*/
+struct ConcurrentModel {
+    ConcurrentModelConfig config;
+    ExecutableNetwork exeNetwork;
+    size_t batchSize = 1;
+    std::unique_ptr<InferRequestsQueue> inferRequestsQueue;
+    size_t iterations = 0;
+    std::thread thread;
+};
+
 /**
 * @brief The entry point of the benchmark application
 */
@@ -315,6 +364,9 @@ int main(int argc, char *argv[]) {
             return std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
         };
 
+        // durations of the steps from reading of the model to the first inference
+        std::vector<std::pair<std::string, double>> startupPhases;
+
         size_t batchSize = FLAGS_b;
         Precision precision = Precision::UNSPECIFIED;
         std::string topology_name = "";
@@ -325,7 +377,21 @@ int main(int argc, char *argv[]) {
             slog::info << "Loading network files" << slog::endl;
 
             auto startTime = Time::now();
-            CNNNetwork cnnNetwork = ie.ReadNetwork(FLAGS_m);
+            CNNNetwork cnnNetwork;
+            std::string weightsPath = fileNameNoExt(FLAGS_m) + ".bin";
+            if (!FLAGS_startup_report.empty() && fileExt(FLAGS_m) == "xml" && std::ifstream(weightsPath).good()) {
+                // read weights and parse the network separately to report both phases
+                auto weights = readWeights(weightsPath);
+                startupPhases.emplace_back("read weights", get_total_ms_time(startTime));
+                auto parseStartTime = Time::now();
+                std::ifstream modelFile(FLAGS_m);
+                std::string model((std::istreambuf_iterator<char>(modelFile)), std::istreambuf_iterator<char>());
+                cnnNetwork = ie.ReadNetwork(model, weights);
+                startupPhases.emplace_back("parse network", get_total_ms_time(parseStartTime));
+            } else {
+                cnnNetwork = ie.ReadNetwork(FLAGS_m);
+                startupPhases.emplace_back("read network", get_total_ms_time(startTime));
+            }
             auto duration_ms = double_to_string(get_total_ms_time(startTime));
             slog::info << "Read network took " << duration_ms << " ms" << slog::endl;
             if (statistics)
@@ -355,6 +421,7 @@ int main(int argc, char *argv[]) {
                 slog::info << "Reshaping network: " << getShapesString(shapes) << slog::endl;
                 startTime = Time::now();
                 cnnNetwork.reshape(shapes);
+                startupPhases.emplace_back("reshape network", get_total_ms_time(startTime));
                 auto duration_ms = double_to_string(get_total_ms_time(startTime));
                 slog::info << "Reshape network took " << duration_ms << " ms" << slog::endl;
                 if (statistics)
@@ -380,6 +447,7 @@ int main(int argc, char *argv[]) {
             next_step();
             startTime = Time::now();
             exeNetwork = ie.LoadNetwork(cnnNetwork, device_name);
+            startupPhases.emplace_back("load network", get_total_ms_time(startTime));
             duration_ms = double_to_string(get_total_ms_time(startTime));
             slog::info << "Load network took " << duration_ms << " ms" << slog::endl;
             if (statistics)
@@ -398,6 +466,7 @@ int main(int argc, char *argv[]) {
             next_step();
             auto startTime = Time::now();
             exeNetwork = ie.ImportNetwork(FLAGS_m, device_name, {});
+            startupPhases.emplace_back("import network", get_total_ms_time(startTime));
             auto duration_ms = double_to_string(get_total_ms_time(startTime));
             slog::info << "Import network took " << duration_ms << " ms" << slog::endl;
             if (statistics)
@@ -469,6 +538,13 @@ int main(int argc, char *argv[]) {
                                               {"number of parallel infer requests", std::to_string(nireq)},
                                               {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
+            if (FLAGS_qps > 0) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                  {"target requests per second", double_to_string(FLAGS_qps)},
+                                                  {"arrival distribution", FLAGS_arrival},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -482,10 +558,36 @@ int main(int argc, char *argv[]) {
         // ----------------- 9. Creating infer requests and filling input blobs ----------------------------------------
         next_step();
 
+        auto createStartTime = Time::now();
         InferRequestsQueue inferRequestsQueue(exeNetwork, nireq);
+        startupPhases.emplace_back("create infer requests", get_total_ms_time(createStartTime));
         const InferenceEngine::ConstInputsDataMap info(exeNetwork.GetInputsInfo());
         fillBlobs(inputFiles, batchSize, info, inferRequestsQueue.requests);
 
+        std::vector<std::unique_ptr<ConcurrentModel>> concurrentModels;
+        for (const auto& modelConfig : parseConcurrentModels(FLAGS_concurrent_m, device_name)) {
+            std::unique_ptr<ConcurrentModel> model(new ConcurrentModel);
+            model->config = modelConfig;
+            if (fileExt(modelConfig.path) == "blob") {
+                model->exeNetwork = ie.ImportNetwork(modelConfig.path, modelConfig.device, {});
+            } else {
+                CNNNetwork cnnNetwork = ie.ReadNetwork(modelConfig.path);
+                for (auto& item : cnnNetwork.getInputsInfo()) {
+                    if (isImage(item.second))
+                        item.second->setPrecision(Precision::U8);
+                }
+                model->batchSize = cnnNetwork.getBatchSize();
+                model->exeNetwork = ie.LoadNetwork(cnnNetwork, modelConfig.device);
+            }
+            if (model->config.nireq == 0)
+                model->config.nireq = model->exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            model->inferRequestsQueue.reset(new InferRequestsQueue(model->exeNetwork, model->config.nireq));
+            fillBlobs({}, model->batchSize, model->exeNetwork.GetInputsInfo(), model->inferRequestsQueue->requests);
+            slog::info << "Concurrent model " << modelConfig.path << " is loaded to " << modelConfig.device << " with "
+                       << model->config.nireq << " inference requests" << slog::endl;
+            concurrentModels.push_back(std::move(model));
+        }
+
         // ----------------- 10. Measuring performance ------------------------------------------------------------------
         size_t progressCnt = 0;
         size_t progressBarTotalCount = progressBarDefaultTotalCount;
@@ -498,6 +600,9 @@ int main(int argc, char *argv[]) {
                 ss << ", ";
             }
             ss << nireq << " inference requests";
+            if (FLAGS_qps > 0) {
+                ss << " started at " << FLAGS_qps << " requests per second (" << FLAGS_arrival << " arrivals)";
+            }
             std::stringstream device_ss;
             for (auto& nstreams : device_nstreams) {
                 if (!device_ss.str().empty()) {
@@ -537,6 +642,11 @@ int main(int argc, char *argv[]) {
         inferRequestsQueue.waitAll();
         auto duration_ms = double_to_string(inferRequestsQueue.getLatencies()[0]);
         slog::info << "First inference took " << duration_ms << " ms" << slog::endl;
+        startupPhases.emplace_back("first inference", inferRequestsQueue.getLatencies()[0]);
+        if (!FLAGS_startup_report.empty()) {
+            dumpStartupReport(FLAGS_startup_report, FLAGS_m, device_name, startupPhases);
+            slog::info << "Startup report is stored to " << FLAGS_startup_report << slog::endl;
+        }
         if (statistics)
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                         {
@@ -544,6 +654,38 @@ int main(int argc, char *argv[]) {
                                         });
         inferRequestsQueue.resetTimes();
 
+        // concurrent models are inferred in background until the measurement of the main model is finished
+        std::atomic<bool> stopConcurrentModels{false};
+        for (auto& model : concurrentModels) {
+            auto request = model->inferRequestsQueue->getIdleRequest();
+            request->infer();
+            model->inferRequestsQueue->resetTimes();
+            auto modelPtr = model.get();
+            model->thread = std::thread([&stopConcurrentModels, modelPtr] {
+                try {
+                    ArrivalScheduler arrivals(modelPtr->config.qps, FLAGS_arrival == "poisson");
+                    Time::time_point arrivalTime;
+                    while (!stopConcurrentModels) {
+                        if (arrivals.enabled()) {
+                            arrivalTime = arrivals.waitNextArrival();
+                        }
+                        auto request = modelPtr->inferRequestsQueue->getIdleRequest();
+                        request->wait();
+                        if (arrivals.enabled()) {
+                            request->startAsync(arrivalTime);
+                            arrivals.scheduleNextArrival();
+                        } else {
+                            request->startAsync();
+                        }
+                        modelPtr->iterations++;
+                    }
+                    modelPtr->inferRequestsQueue->waitAll();
+                } catch (const std::exception& ex) {
+                    slog::err << "Concurrent model " << modelPtr->config.path << " failed: " << ex.what() << slog::endl;
+                }
+            });
+        }
+
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
@@ -551,9 +693,17 @@ int main(int argc, char *argv[]) {
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
+        // open-loop load: requests arrive at scheduled times regardless of completion of the previous ones,
+        // waiting for an idle infer request is a part of the latency
+        ArrivalScheduler arrivals(FLAGS_qps, FLAGS_arrival == "poisson");
+        Time::time_point arrivalTime;
+
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
                (FLAGS_api == "async" && iteration % nireq != 0)) {
+            if (arrivals.enabled()) {
+                arrivalTime = arrivals.waitNextArrival();
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -568,7 +718,12 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (arrivals.enabled()) {
+                    inferRequest->startAsync(arrivalTime);
+                    arrivals.scheduleNextArrival();
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -589,8 +744,15 @@ int main(int argc, char *argv[]) {
 
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
+        stopConcurrentModels = true;
+        for (auto& model : concurrentModels) {
+            model->thread.join();
+        }
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        auto latencies = inferRequestsQueue.getLatencies();
+        std::sort(latencies.begin(), latencies.end());
+        double latency = getMedianValue<double>(latencies);
+        auto latencyPercentiles = getLatencyPercentiles(latencies);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
@@ -606,6 +768,22 @@ int main(int argc, char *argv[]) {
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
                                           });
+                for (const auto& percentile : latencyPercentiles) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {percentile.first + " latency (ms)", double_to_string(percentile.second)},
+                                              });
+                }
+                auto latenciesPerSecond = inferRequestsQueue.getLatenciesPerSecond();
+                for (size_t second = 0; second < latenciesPerSecond.size(); second++) {
+                    if (latenciesPerSecond[second].empty())
+                        continue;
+                    statistics->addParameters(StatisticsReport::Category::LATENCY_PER_SECOND,
+                                              {
+                                                      {std::to_string(second),
+                                                       double_to_string(getMedianValue<double>(latenciesPerSecond[second]))},
+                                              });
+                }
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -613,6 +791,39 @@ int main(int argc, char *argv[]) {
                                       });
         }
 
+        double totalFps = fps;
+        std::vector<std::string> concurrentModelsResults;
+        for (const auto& model : concurrentModels) {
+            auto modelLatencies = model->inferRequestsQueue->getLatencies();
+            if (modelLatencies.empty())
+                continue;
+            std::sort(modelLatencies.begin(), modelLatencies.end());
+            double modelFps = model->batchSize * 1000.0 * model->iterations /
+                              model->inferRequestsQueue->getDurationInMilliseconds();
+            totalFps += modelFps;
+
+            std::stringstream ss;
+            ss << model->config.path << " (" << model->config.device << "): " << model->iterations << " iterations, latency "
+               << double_to_string(getMedianValue<double>(modelLatencies)) << " ms";
+            for (const auto& percentile : getLatencyPercentiles(modelLatencies)) {
+                ss << ", " << percentile.first << " " << double_to_string(percentile.second) << " ms";
+            }
+            ss << ", throughput " << double_to_string(modelFps) << " FPS";
+            concurrentModelsResults.push_back(ss.str());
+        }
+        if (statistics && !concurrentModels.empty()) {
+            for (const auto& result : concurrentModelsResults) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {"concurrent model", result},
+                                          });
+            }
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {"total throughput of all models", double_to_string(totalFps)},
+                                      });
+        }
+
         progressBar.finish();
 
         // ----------------- 11. Dumping statistics report -------------------------------------------------------------
@@ -655,9 +866,23 @@ int main(int argc, char *argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "            ";
+            for (const auto& percentile : latencyPercentiles) {
+                std::cout << percentile.first << " " << double_to_string(percentile.second) << " ms"
+                          << (&percentile == &latencyPercentiles.back() ? "" : ", ");
+            }
+            std::cout << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (!concurrentModels.empty()) {
+            std::cout << "Concurrent models:" << std::endl;
+            for (const auto& result : concurrentModelsResults) {
+                std::cout << "    " << result << std::endl;
+            }
+            std::cout << "Total throughput of all models: " << double_to_string(totalFps) << " FPS" << std::endl;
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
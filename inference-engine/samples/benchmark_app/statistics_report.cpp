@@ -50,6 +50,14 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (_parameters.count(Category::LATENCY_PER_SECOND)) {
+        dumper << "Median latency (ms) per second of execution";
+        dumper.endLine();
+
+        dump_parameters(_parameters.at(Category::LATENCY_PER_SECOND));
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
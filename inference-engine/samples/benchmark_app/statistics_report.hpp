@@ -34,6 +34,7 @@ public:
         COMMAND_LINE_PARAMETERS,
         RUNTIME_CONFIG,
         EXECUTION_RESULTS,
+        LATENCY_PER_SECOND,
     };
 
     explicit StatisticsReport(Config config) : _config(std::move(config)) {
@@ -3,6 +3,7 @@
 //
 
 #include <string>
+#include <fstream>
 #include <algorithm>
 #include <utility>
 #include <vector>
@@ -102,6 +103,42 @@ std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector
     return result;
 }
 
+std::vector<ConcurrentModelConfig> parseConcurrentModels(const std::string& models_string,
+                                                         const std::string& default_device) {
+    //  Format: <path1>[@<device1>][:<nireq1>[:<qps1>]],<path2>...
+    std::vector<ConcurrentModelConfig> result;
+    for (auto& model_string : split(models_string, ',')) {
+        if (model_string.empty())
+            continue;
+        // numeric fields are taken from the end, so a path may contain ':', e.g. a Windows drive letter
+        std::vector<std::string> numbers;
+        auto pos = model_string.rfind(':');
+        while (numbers.size() < 2 && pos != std::string::npos &&
+               model_string.find_first_not_of("0123456789.", pos + 1) == std::string::npos && pos + 1 < model_string.size()) {
+            numbers.insert(numbers.begin(), model_string.substr(pos + 1));
+            model_string = model_string.substr(0, pos);
+            pos = model_string.rfind(':');
+        }
+
+        ConcurrentModelConfig config;
+        config.path = model_string;
+        config.device = default_device;
+        auto device_pos = model_string.rfind('@');
+        if (device_pos != std::string::npos) {
+            config.path = model_string.substr(0, device_pos);
+            config.device = model_string.substr(device_pos + 1);
+        }
+        if (config.path.empty() || config.device.empty())
+            throw std::logic_error("Incorrect concurrent model specification: " + models_string);
+        if (numbers.size() > 0)
+            config.nireq = static_cast<uint32_t>(std::stoul(numbers[0]));
+        if (numbers.size() > 1)
+            config.qps = std::stod(numbers[1]);
+        result.push_back(config);
+    }
+    return result;
+}
+
 bool adjustShapesBatch(InferenceEngine::ICNNNetwork::InputShapes& shapes,
                        const size_t batch_size, const InferenceEngine::InputsDataMap& input_info) {
     bool updated = false;
@@ -173,6 +210,57 @@ std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& sha
     return ss.str();
 }
 
+InferenceEngine::Blob::Ptr readWeights(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open weights file " + path);
+    }
+    size_t size = static_cast<size_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
+
+    auto weights = InferenceEngine::make_shared_blob<uint8_t>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {size}, InferenceEngine::Layout::C));
+    weights->allocate();
+    if (!file.read(weights->buffer().as<char*>(), size)) {
+        throw std::logic_error("Can't read weights file " + path);
+    }
+    return weights;
+}
+
+namespace {
+std::string escapeJson(const std::string& str) {
+    std::string result;
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+}  // namespace
+
+void dumpStartupReport(const std::string& filename, const std::string& model, const std::string& device,
+                       const std::vector<std::pair<std::string, double>>& phases) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open file " + filename + " to store startup report");
+    }
+    double total = 0.0;
+    file << "{\n";
+    file << "    \"model\": \"" << escapeJson(model) << "\",\n";
+    file << "    \"device\": \"" << escapeJson(device) << "\",\n";
+    file << "    \"phases_ms\": [\n";
+    for (size_t i = 0; i < phases.size(); i++) {
+        file << "        {\"name\": \"" << escapeJson(phases[i].first) << "\", \"time\": " << phases[i].second << "}"
+             << (i + 1 < phases.size() ? "," : "") << "\n";
+        total += phases[i].second;
+    }
+    file << "    ],\n";
+    file << "    \"total_ms\": " << total << "\n";
+    file << "}\n";
+}
+
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename,
                  const std::map<std::string, std::map<std::string, std::string>>& config) {
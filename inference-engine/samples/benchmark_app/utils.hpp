@@ -7,16 +7,30 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <utility>
+
+/// @brief Model inferred concurrently with the main model
+struct ConcurrentModelConfig {
+    std::string path;
+    std::string device;
+    uint32_t nireq = 0;
+    double qps = 0.0;
+};
 
 std::vector<std::string> parseDevices(const std::string& device_string);
 uint32_t deviceDefaultDeviceDurationInSeconds(const std::string& device);
 std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector<std::string>& devices,
                                                                const std::string& values_string);
+std::vector<ConcurrentModelConfig> parseConcurrentModels(const std::string& models_string,
+                                                         const std::string& default_device);
 bool updateShapes(InferenceEngine::ICNNNetwork::InputShapes& shapes,
                   const std::string shapes_string, const InferenceEngine::InputsDataMap& input_info);
 bool adjustShapesBatch(InferenceEngine::ICNNNetwork::InputShapes& shapes,
                        const size_t batch_size, const InferenceEngine::InputsDataMap& input_info);
 std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
+InferenceEngine::Blob::Ptr readWeights(const std::string& path);
+void dumpStartupReport(const std::string& filename, const std::string& model, const std::string& device,
+                       const std::vector<std::pair<std::string, double>>& phases);
 
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename,
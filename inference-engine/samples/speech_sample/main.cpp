@@ -54,6 +54,45 @@ struct InferRequestStruct {
     uint32_t numFramesThisBatch;
 };
 
+/**
+ * @brief Fixed capacity FIFO of feature frames used by the streaming mode
+ */
+class FrameRingBuffer {
+public:
+    FrameRingBuffer(size_t frameSize, size_t capacity)
+        : _frameSize(frameSize), _capacity(capacity), _frames(frameSize * capacity) {}
+
+    size_t size() const { return _size; }
+
+    bool push(const float *frame) {
+        if (_size == _capacity) {
+            return false;
+        }
+        std::memcpy(&_frames[((_head + _size) % _capacity) * _frameSize], frame, _frameSize * sizeof(float));
+        _size++;
+        return true;
+    }
+
+    /** Moves numFrames oldest frames to dst */
+    void pop(float *dst, size_t numFrames) {
+        if (numFrames > _size) {
+            throw std::logic_error("Not enough frames in the ring buffer");
+        }
+        for (size_t i = 0; i < numFrames; i++) {
+            std::memcpy(dst + i * _frameSize, &_frames[_head * _frameSize], _frameSize * sizeof(float));
+            _head = (_head + 1) % _capacity;
+        }
+        _size -= numFrames;
+    }
+
+private:
+    size_t _frameSize;
+    size_t _capacity;
+    std::vector<float> _frames;
+    size_t _head = 0;
+    size_t _size = 0;
+};
+
 void CheckNumberOfInputs(size_t numInputs, size_t numInputArkFiles) {
     if (numInputs != numInputArkFiles) {
         throw std::logic_error("Number of network inputs (" + std::to_string(numInputs) + ")"
@@ -519,6 +558,10 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Invalid value for 'cw_l' argument. It must be greater than or equal to 0");
     }
 
+    if (FLAGS_stream && (FLAGS_nthreads != 1 || FLAGS_cw_l > 0 || FLAGS_cw_r > 0)) {
+        throw std::logic_error("Streaming mode cannot be used with 'nthreads', 'cw_l' and 'cw_r' arguments");
+    }
+
     return true;
 }
 
@@ -934,7 +977,87 @@ int main(int argc, char *argv[]) {
                 auto t0 = Time::now();
                 auto t1 = t0;
 
-                while (frameIndex <= numFrames) {
+                if (FLAGS_stream) {
+                    auto &inferRequest = inferRequests.front().inferRequest;
+                    std::vector<FrameRingBuffer> ringBuffers;
+                    for (auto &&numFrameElements : numFrameElementsInput) {
+                        ringBuffers.emplace_back(numFrameElements, batchSize);
+                    }
+                    Blob::Ptr outputBlob = inferRequest.GetBlob(outputs.empty() ? cOutputInfo.rbegin()->first
+                                                                                : outputs[next_output]);
+                    double minLatency = std::numeric_limits<double>::max(), maxLatency = 0.0, sumLatency = 0.0;
+                    uint32_t numChunks = 0;
+
+                    for (uint32_t frame = 0; frame < numFramesArkFile; ++frame) {
+                        // the application pushes frames as they arrive
+                        for (size_t j = 0; j < ringBuffers.size(); j++) {
+                            auto ptrFrame = reinterpret_cast<const float *>(inputFrame[j]) +
+                                            static_cast<size_t>(frame) * numFrameElementsInput[j];
+                            ringBuffers[j].push(ptrFrame);
+                        }
+                        if (ringBuffers.front().size() < batchSize && frame + 1 < numFramesArkFile) {
+                            continue;
+                        }
+
+                        auto numFramesThisChunk = static_cast<uint32_t>(ringBuffers.front().size());
+                        auto tChunk = Time::now();
+                        for (size_t j = 0; j < ringBuffers.size(); j++) {
+                            MemoryBlob::Ptr minput = as<MemoryBlob>(ptrInputBlobs[j]);
+                            if (!minput) {
+                                throw std::logic_error("We expect input to be inherited from MemoryBlob, "
+                                                       "but in fact we were not able to cast input to MemoryBlob");
+                            }
+                            // locked memory holder should be alive all time while access to its buffer happens
+                            auto minputHolder = minput->wmap();
+                            auto ptrInput = minputHolder.as<float *>();
+                            ringBuffers[j].pop(ptrInput, numFramesThisChunk);
+                            // the last chunk of the utterance is padded with zeros
+                            std::fill(ptrInput + numFramesThisChunk * numFrameElementsInput[j],
+                                      ptrInput + batchSize * numFrameElementsInput[j], 0.0f);
+                        }
+                        inferRequest.Infer();
+                        double latency = std::chrono::duration_cast<ms>(Time::now() - tChunk).count();
+                        minLatency = std::min(minLatency, latency);
+                        maxLatency = std::max(maxLatency, latency);
+                        sumLatency += latency;
+                        numChunks++;
+
+                        MemoryBlob::CPtr moutput = as<MemoryBlob>(outputBlob);
+                        if (!moutput) {
+                            throw std::logic_error("We expect output to be inherited from MemoryBlob, "
+                                                   "but in fact we were not able to cast output to MemoryBlob");
+                        }
+                        // locked memory holder should be alive all time while access to its buffer happens
+                        auto moutputHolder = moutput->rmap();
+                        if (!FLAGS_o.empty()) {
+                            std::memcpy(&ptrScores.front() + numScoresPerFrame * sizeof(float) * frameIndex,
+                                        moutputHolder.as<const void *>(),
+                                        numFramesThisChunk * numScoresPerFrame * sizeof(float));
+                        }
+                        if (!FLAGS_r.empty()) {
+                            CompareScores(moutputHolder.as<float *>(),
+                                          &ptrReferenceScores[frameIndex * numFrameElementsReference *
+                                                              numBytesPerElementReference],
+                                          &frameError,
+                                          numFramesThisChunk,
+                                          numFrameElementsReference);
+                            UpdateScoreError(&frameError, &totalError);
+                        }
+                        if (FLAGS_pc) {
+                            getPerformanceCounters(inferRequest, callPerfMap);
+                            sumPerformanceCounters(callPerfMap, utterancePerfMap);
+                        }
+                        frameIndex += numFramesThisChunk;
+                    }
+                    std::cout << "Chunks in utterance:\t\t\t" << numChunks << " chunks of " << batchSize << " frames"
+                              << std::endl;
+                    if (numChunks > 0) {
+                        std::cout << "Chunk latency min/avg/max:\t\t" << minLatency << " / "
+                                  << sumLatency / numChunks << " / " << maxLatency << " ms" << std::endl;
+                    }
+                }
+
+                while (!FLAGS_stream && frameIndex <= numFrames) {
                     if (frameIndex == numFrames) {
                         if (std::find_if(inferRequests.begin(),
                                          inferRequests.end(),
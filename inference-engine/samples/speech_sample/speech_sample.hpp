@@ -91,6 +91,11 @@ static const char input_layer_names_message[] = "Optional. Layer names for input
                                           "The names are separated with \",\" " \
                                           "Example: Input1,Input2 ";
 
+/// @brief message for streaming mode
+static const char stream_message[] = "Optional. Push input frames one by one into a ring buffer and infer every full chunk of bs frames " \
+                                     "synchronously on a single request, keeping the memory states between chunks. " \
+                                     "Reports latency of every chunk. Cannot be used with nthreads, cw_l and cw_r.";
+
 /// \brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -161,6 +166,9 @@ DEFINE_string(oname, "", output_layer_names_message);
 /// @brief Input layer name
 DEFINE_string(iname, "", input_layer_names_message);
 
+/// @brief Streaming mode (default false)
+DEFINE_bool(stream, false, stream_message);
+
 /**
  * \brief This function show a help message
  */
@@ -191,5 +199,6 @@ static void showUsage() {
     std::cout << "    -cw_r \"<integer>\"       " << context_window_message_r << std::endl;
     std::cout << "    -oname \"<string>\"       " << output_layer_names_message << std::endl;
     std::cout << "    -iname \"<string>\"       " << input_layer_names_message << std::endl;
+    std::cout << "    -stream                 " << stream_message << std::endl;
 }
 
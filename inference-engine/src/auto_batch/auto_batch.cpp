@@ -0,0 +1,525 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_plugin_config.hpp>
+#include <blob_factory.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <auto_batch/auto_batch_config.hpp>
+#include <ngraph/graph_util.hpp>
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+namespace {
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    // the memory of the batch item `slot` of the batched blob
+    std::uint8_t* GetSlotMemory(const Blob::Ptr& batchedBlob, std::size_t slot, std::size_t batchSize) {
+        if (batchedBlob->is<RemoteBlob>()) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device does not support remote blobs of the underlying device";
+        }
+        return batchedBlob->buffer().as<std::uint8_t*>() + slot * (batchedBlob->byteSize() / batchSize);
+    }
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&   networkInputs,
+                                             const OutputsDataMap&  networkOutputs,
+                                             const InferRequest&    inferRequestWithoutBatch)
+    : InferRequestInternal(networkInputs, networkOutputs),
+    _inferRequestWithoutBatch{inferRequestWithoutBatch} {
+    for (const auto &it : _networkInputs) {
+        _inputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _inputs[it.first]->allocate();
+    }
+    for (const auto &it : _networkOutputs) {
+        _outputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _outputs[it.first]->allocate();
+    }
+    _inferRequestWithoutBatch.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+        [this] (InferRequest, StatusCode status) {
+            Completed(status);
+        });
+}
+
+void AutoBatchInferRequest::PreprocessInputs() {
+    execDataPreprocessing(_inputs);
+}
+
+void AutoBatchInferRequest::CopyInputsToSlot(InferRequest& workerRequest, std::size_t slot, std::size_t batchSize) {
+    for (const auto &it : _networkInputs) {
+        const auto& blob = _inputs[it.first];
+        std::memcpy(GetSlotMemory(workerRequest.GetBlob(it.first), slot, batchSize),
+                    blob->cbuffer().as<const std::uint8_t*>(), blob->byteSize());
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromSlot(InferRequest& workerRequest, std::size_t slot, std::size_t batchSize) {
+    for (const auto &it : _networkOutputs) {
+        auto& blob = _outputs[it.first];
+        std::memcpy(blob->buffer().as<std::uint8_t*>(),
+                    GetSlotMemory(workerRequest.GetBlob(it.first), slot, batchSize), blob->byteSize());
+    }
+}
+
+void AutoBatchInferRequest::StartWithoutBatch() {
+    try {
+        // the blobs may be replaced by the user between the inferences
+        for (const auto &it : _networkInputs) {
+            _inferRequestWithoutBatch.SetBlob(it.first, _inputs[it.first]);
+        }
+        for (const auto &it : _networkOutputs) {
+            _inferRequestWithoutBatch.SetBlob(it.first, _outputs[it.first]);
+        }
+        _inferRequestWithoutBatch.StartAsync();
+    } catch (...) {
+        Completed(StatusCode::GENERAL_ERROR);
+    }
+}
+
+void AutoBatchInferRequest::Completed(StatusCode status) {
+    _status = status;
+    Task task = std::move(_task);
+    task();
+}
+
+// ------------------------------AutoBatchAsyncInferRequest----------------------------
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&       inferRequest,
+    const AutoBatchExecutableNetwork::Ptr&  autoBatchExecutableNetwork,
+    const ITaskExecutor::Ptr&               callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _autoBatchExecutableNetwork{autoBatchExecutableNetwork},
+    _inferRequest{inferRequest} {
+    // this executor queues the request for a batch while the task (checking the result) is called on the completion
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_autoBatchExecutableNetwork->Submit(_this->_inferRequest.get(), std::move(task));
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
+            _inferRequest->PreprocessInputs();
+        }},
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+            if (StatusCode::OK != _inferRequest->_status) {
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << _inferRequest->_status;
+            }
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const ExecutableNetwork&                               networkForDevice,
+                                                       const ExecutableNetwork&                               networkWithoutBatch,
+                                                       const DeviceInformation&                               networkDevice,
+                                                       const std::unordered_map<std::string, Parameter>&      config,
+                                                       const std::chrono::milliseconds                        timeout) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _network{networkForDevice},
+    _networkWithoutBatch{networkWithoutBatch},
+    _device{networkDevice},
+    _config{config},
+    _timeout{timeout} {
+    _timerThread = std::thread(&AutoBatchExecutableNetwork::TimerThread, this);
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+    }
+    _timerCondition.notify_all();
+    _timerThread.join();
+    /* NOTE: The user requests (that hold the network) wait for their tasks in the destructor,
+     *       so the worker requests are idle here, the wait is just a safety net
+     */
+    for (auto&& workerRequest : _workerRequests) {
+        try {
+            workerRequest->_inferRequest.Wait(IInferRequest::WaitMode::RESULT_READY);
+        } catch (...) {}
+    }
+    _workerRequests.clear();
+}
+
+void AutoBatchExecutableNetwork::Submit(AutoBatchInferRequest* request, Task task) {
+    request->_task = std::move(task);
+    std::unique_lock<std::mutex> lock(_mutex);
+    _queue.emplace_back(request, std::chrono::steady_clock::now());
+    StartBatches(lock);
+}
+
+void AutoBatchExecutableNetwork::StartBatches(std::unique_lock<std::mutex>& lock) {
+    const auto batchSize = static_cast<std::size_t>(_device.batchForDevice);
+    std::vector<WorkerInferRequest*> batches;
+    while (_queue.size() >= batchSize && !_idleWorkerRequests.empty()) {
+        auto workerRequest = _idleWorkerRequests.front();
+        _idleWorkerRequests.pop_front();
+        workerRequest->_batch.clear();
+        for (std::size_t slot = 0; slot < batchSize; ++slot) {
+            workerRequest->_batch.push_back(_queue.front().first);
+            _queue.pop_front();
+        }
+        batches.push_back(workerRequest);
+    }
+    lock.unlock();
+    for (auto&& workerRequest : batches) {
+        try {
+            for (std::size_t slot = 0; slot < batchSize; ++slot) {
+                workerRequest->_batch[slot]->CopyInputsToSlot(workerRequest->_inferRequest, slot, batchSize);
+            }
+            workerRequest->_inferRequest.StartAsync();
+        } catch (...) {
+            BatchCompleted(*workerRequest, StatusCode::GENERAL_ERROR);
+        }
+    }
+}
+
+void AutoBatchExecutableNetwork::BatchCompleted(WorkerInferRequest& workerRequest, StatusCode status) {
+    const auto batchSize = static_cast<std::size_t>(_device.batchForDevice);
+    std::vector<AutoBatchInferRequest*> batch;
+    batch.swap(workerRequest._batch);
+    for (std::size_t slot = 0; slot < batch.size(); ++slot) {
+        if (StatusCode::OK == status) {
+            try {
+                batch[slot]->CopyOutputsFromSlot(workerRequest._inferRequest, slot, batchSize);
+            } catch (...) {
+                status = StatusCode::GENERAL_ERROR;
+            }
+        }
+    }
+    // the outputs are copied, so the worker request takes the next batch before the user callbacks run
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _idleWorkerRequests.push_back(&workerRequest);
+        StartBatches(lock);
+    }
+    for (auto&& request : batch) {
+        request->Completed(status);
+    }
+}
+
+void AutoBatchExecutableNetwork::TimerThread() {
+    const auto period = std::max(_timeout / 2, std::chrono::milliseconds{1});
+    while (true) {
+        std::vector<AutoBatchInferRequest*> timedOut;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _timerCondition.wait_for(lock, period, [this] { return _terminate; });
+            if (_terminate) {
+                break;
+            }
+            const auto now = std::chrono::steady_clock::now();
+            while (!_queue.empty() && (now - _queue.front().second) >= _timeout) {
+                timedOut.push_back(_queue.front().first);
+                _queue.pop_front();
+            }
+        }
+        for (auto&& request : timedOut) {
+            request->StartWithoutBatch();
+        }
+    }
+}
+
+InferenceEngine::InferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                                             OutputsDataMap networkOutputs) {
+    const auto batchSize = static_cast<std::size_t>(_device.batchForDevice);
+    {
+        // a worker request per batch size of the user requests, so all of them can run at once
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (0 == (_numRequestsCreated++) % batchSize) {
+            std::unique_ptr<WorkerInferRequest> workerRequest{new WorkerInferRequest};
+            workerRequest->_inferRequest = _network.CreateInferRequest();
+            auto workerRequestPtr = workerRequest.get();
+            workerRequest->_inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [workerRequestPtr, this] (InferRequest, StatusCode status) {
+                    BatchCompleted(*workerRequestPtr, status);
+                });
+            _idleWorkerRequests.push_back(workerRequestPtr);
+            _workerRequests.push_back(std::move(workerRequest));
+        }
+    }
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs, _networkWithoutBatch.CreateInferRequest());
+}
+
+IInferRequest::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    IInferRequest::Ptr asyncRequest;
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                                           std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                                           _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<AutoBatchAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+    return asyncRequest;
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        THROW_IE_EXCEPTION << NOT_FOUND_str << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int res = 0u;
+        try {
+            res = _network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::details::InferenceEngineException &iie) {
+            THROW_IE_EXCEPTION
+                << "The device used with the BATCH device should "
+                << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        // every batched request of the device is fed by the batch size of the user requests
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res * static_cast<unsigned int>(_device.batchForDevice));
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _network.GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+                                                AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& deviceWithBatch,
+                                                            const std::map<std::string, std::string> & config) const {
+    auto openingBracket = deviceWithBatch.find_first_of('(');
+    auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+    auto deviceNameWithID = deviceWithBatch.substr(0, openingBracket);
+    if (openingBracket == std::string::npos || closingBracket == std::string::npos) {
+        THROW_IE_EXCEPTION << "The batch size for the '" << deviceNameWithID << "' is not set, "
+                           << "please use the <device>(<batch>) format, e.g. BATCH:CPU(8)";
+    }
+    int batch = 0;
+    try {
+        batch = std::stoi(deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+    } catch (const std::exception&) {
+        batch = 0;
+    }
+    if (batch <= 0) {
+        THROW_IE_EXCEPTION << "Batch value for '" << deviceNameWithID << "' must be a positive integer, while "
+                           << deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1) << " is passed";
+    }
+
+    DeviceIDParser deviceParser(deviceNameWithID);
+    std::string deviceName = deviceParser.getDeviceName();
+    std::map<std::string, std::string> tconfig = mergeConfigs(_config, config);
+
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    return { deviceName, GetSupportedConfig(tconfig, deviceName), batch };
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG)) {
+        auto it = _config.find(AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG));
+        if (it == _config.end()) {
+            THROW_IE_EXCEPTION << "Value for KEY_AUTO_BATCH_DEVICE_CONFIG is not set";
+        } else {
+            return { it->second };
+        }
+    } else if (name == AUTO_BATCH_CONFIG_KEY(TIMEOUT)) {
+        auto it = _config.find(AUTO_BATCH_CONFIG_KEY(TIMEOUT));
+        return { it == _config.end() ? std::string{"100"} : it->second };
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT};
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+}
+
+ExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork &network,
+                                                                            const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    if (network.getFunction() == nullptr) {
+        THROW_IE_EXCEPTION << "BATCH device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for BATCH device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+
+    auto timeout = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    const std::string timeoutValue = (timeout == fullConfig.end()) ? std::string{"100"} : timeout->second;
+    int timeoutMs = 0;
+    try {
+        timeoutMs = std::stoi(timeoutValue);
+    } catch (const std::exception&) {
+        timeoutMs = 0;
+    }
+    if (timeoutMs <= 0) {
+        THROW_IE_EXCEPTION << "Unsupported value " << timeoutValue << " for the "
+                           << AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT << " key of the BATCH device";
+    }
+
+    // the batched network: a copy of the original one that keeps the user precisions and layouts
+    CNNNetwork batchedNetwork{ngraph::clone_function(*network.getFunction())};
+    auto batchedInputs = batchedNetwork.getInputsInfo();
+    for (auto&& input : network.getInputsInfo()) {
+        const auto& desc = input.second->getTensorDesc();
+        static const std::vector<Layout> batchedLayouts = {Layout::NC, Layout::NCHW, Layout::NHWC, Layout::NCDHW, Layout::NDHWC};
+        if (std::find(batchedLayouts.begin(), batchedLayouts.end(), desc.getLayout()) == batchedLayouts.end() ||
+            desc.getDims().empty() || desc.getDims()[0] != 1) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device supports just the inputs with the batch dimension of 1, "
+                               << "while the input " << input.first << " is not";
+        }
+        auto& batchedInput = batchedInputs.at(input.first);
+        batchedInput->setPrecision(input.second->getPrecision());
+        batchedInput->setLayout(input.second->getLayout());
+    }
+    auto batchedOutputs = batchedNetwork.getOutputsInfo();
+    for (auto&& output : network.getOutputsInfo()) {
+        auto& batchedOutput = batchedOutputs.at(output.first);
+        batchedOutput->setPrecision(output.second->getPrecision());
+        batchedOutput->setLayout(output.second->getLayout());
+    }
+    auto shapes = batchedNetwork.getInputShapes();
+    for (auto&& shape : shapes) {
+        shape.second[0] = metaDevice.batchForDevice;
+    }
+    batchedNetwork.reshape(shapes);
+    for (auto&& output : batchedNetwork.getOutputsInfo()) {
+        const auto& dims = output.second->getTensorDesc().getDims();
+        if (dims.empty() || dims[0] != static_cast<std::size_t>(metaDevice.batchForDevice)) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device supports just the outputs with the batch dimension, "
+                               << "while the output " << output.first << " is not batched";
+        }
+    }
+
+    auto executableNetworkForDevice = GetCore()->LoadNetwork(batchedNetwork, metaDevice.deviceName, metaDevice.config);
+    // the requests that are not batched within the timeout run with the original network
+    auto executableNetworkWithoutBatch = GetCore()->LoadNetwork(network, metaDevice.deviceName, metaDevice.config);
+
+    // collect the settings that are applicable to the device we are loading the network to
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
+    networkConfig.insert(*deviceConfig);
+    networkConfig[AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT] = timeoutValue;
+    networkConfig.insert(metaDevice.config.begin(), metaDevice.config.end());
+
+    return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkForDevice,
+                                                        executableNetworkWithoutBatch,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        std::chrono::milliseconds{timeoutMs});
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                          const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for BATCH device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+    auto queryResult = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+    for (auto&& layerQr : queryResult.supportedLayersMap) {
+        layerQr.second = GetName();
+    }
+    return queryResult;
+}
+
+}  // namespace AutoBatchPlugin
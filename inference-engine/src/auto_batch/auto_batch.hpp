@@ -0,0 +1,155 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
+
+namespace AutoBatchPlugin {
+
+using DeviceName = std::string;
+
+struct DeviceInformation {
+    DeviceName                          deviceName;
+    std::map<std::string, std::string>  config;
+    int                                 batchForDevice;
+};
+
+class AutoBatchInferRequest;
+
+/**
+ * @brief The executable network runs the network reshaped to the batch size on the device.
+ * The submitted user requests are queued, and any batch size of them is gathered into an idle worker (batched) request:
+ * the inputs are copied to the slots (batch items) of the worker request and the outputs are copied back on completion.
+ * The requests that wait for a batch longer than the timeout are executed one by one with the original network,
+ * so a request never waits for other requests to be submitted.
+ */
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    using Time = std::chrono::steady_clock::time_point;
+
+    struct WorkerInferRequest {
+        InferenceEngine::InferRequest           _inferRequest;
+        // the user requests of the running batch in the order of the slots
+        std::vector<AutoBatchInferRequest*>     _batch;
+    };
+
+    AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                       networkForDevice,
+                               const InferenceEngine::ExecutableNetwork&                       networkWithoutBatch,
+                               const DeviceInformation&                                        networkDevice,
+                               const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                               const std::chrono::milliseconds                                 timeout);
+    ~AutoBatchExecutableNetwork() override;
+
+    InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name) const override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+    InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
+
+    void Submit(AutoBatchInferRequest* request, InferenceEngine::Task task);
+
+protected:
+    // starts the batches of the queued requests on the idle worker requests, the (locked) mutex lock is released on return
+    void StartBatches(std::unique_lock<std::mutex>& lock);
+    void BatchCompleted(WorkerInferRequest& workerRequest, InferenceEngine::StatusCode status);
+    void TimerThread();
+
+    InferenceEngine::ExecutableNetwork                                  _network;
+    InferenceEngine::ExecutableNetwork                                  _networkWithoutBatch;
+    DeviceInformation                                                   _device;
+    std::unordered_map<std::string, InferenceEngine::Parameter>         _config;
+    std::chrono::milliseconds                                           _timeout;
+    std::mutex                                                          _mutex;
+    std::vector<std::unique_ptr<WorkerInferRequest>>                    _workerRequests;
+    std::deque<WorkerInferRequest*>                                     _idleWorkerRequests;
+    std::deque<std::pair<AutoBatchInferRequest*, Time>>                 _queue;
+    std::size_t                                                         _numRequestsCreated = 0;
+    std::condition_variable                                             _timerCondition;
+    bool                                                                _terminate = false;
+    std::thread                                                         _timerThread;
+};
+
+class AutoBatchInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    AutoBatchInferRequest(const InferenceEngine::InputsDataMap&   networkInputs,
+                          const InferenceEngine::OutputsDataMap&  networkOutputs,
+                          const InferenceEngine::InferRequest&    inferRequestWithoutBatch);
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>&) const override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    void InferImpl() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    // the pre-processing (if any) writes to the input blobs of the request
+    void PreprocessInputs();
+    void CopyInputsToSlot(InferenceEngine::InferRequest& workerRequest, std::size_t slot, std::size_t batchSize);
+    void CopyOutputsFromSlot(InferenceEngine::InferRequest& workerRequest, std::size_t slot, std::size_t batchSize);
+    // runs the request with the original network, the task is called on completion
+    void StartWithoutBatch();
+    void Completed(InferenceEngine::StatusCode status);
+
+    InferenceEngine::InferRequest   _inferRequestWithoutBatch;
+    InferenceEngine::Task           _task;
+    InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&          inferRequest,
+                               const AutoBatchExecutableNetwork::Ptr&     autoBatchExecutableNetwork,
+                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    ~AutoBatchAsyncInferRequest() override;
+
+protected:
+    AutoBatchExecutableNetwork::Ptr _autoBatchExecutableNetwork;
+    AutoBatchInferRequest::Ptr      _inferRequest;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::InferencePluginInternal {
+public:
+    AutoBatchInferencePlugin();
+    ~AutoBatchInferencePlugin() override = default;
+
+    InferenceEngine::ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::CNNNetwork&        network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+    InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork&        network,
+                                                     const std::map<std::string, std::string>& config) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    DeviceInformation ParseMetaDevice(const std::string& deviceWithBatch, const std::map<std::string, std::string>& config) const;
+
+protected:
+    std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
+                                                          const DeviceName& deviceName) const;
+};
+
+}  // namespace AutoBatchPlugin
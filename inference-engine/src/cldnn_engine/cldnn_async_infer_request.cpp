@@ -9,7 +9,28 @@ CLDNNPlugin::CLDNNAsyncInferRequest::CLDNNAsyncInferRequest(const InferenceEngin
                                                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                                                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor)
         : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor)
-        { }
+        , _inferRequest(std::static_pointer_cast<CLDNNInferRequest>(inferRequest)) {
+    auto uploadExecutor = _inferRequest->GetUploadExecutor();
+    auto waitExecutor = _inferRequest->GetWaitExecutor();
+    if (uploadExecutor || waitExecutor) {
+        _pipeline.clear();
+        // the inputs are uploaded while the stream executor runs the previous request
+        if (uploadExecutor) {
+            _pipeline.push_back({uploadExecutor, [this] { _inferRequest->UploadInputs(); }});
+        }
+        if (waitExecutor) {
+            // the stream executor only enqueues the execution and the output downloads,
+            // the request is completed when they are finished on the device
+            _pipeline.push_back({taskExecutor, [this] {
+                _inferRequest->checkBlobs();
+                _inferRequest->EnqueueInference();
+            }});
+            _pipeline.push_back({waitExecutor, [this] { _inferRequest->WaitInference(); }});
+        } else {
+            _pipeline.push_back({taskExecutor, [this] { _inferRequest->Infer(); }});
+        }
+    }
+}
 
 void CLDNNPlugin::CLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
@@ -20,6 +20,9 @@ public:
     void Infer_ThreadUnsafe() override;
 
     ~CLDNNAsyncInferRequest() override;
+
+private:
+    CLDNNInferRequest::Ptr _inferRequest;
 };
 
 }  // namespace CLDNNPlugin
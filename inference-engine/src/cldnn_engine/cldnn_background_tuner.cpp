@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <api/engine.hpp>
+#include <api/device.hpp>
+#include <legacy/ie_util_internal.hpp>
+#include "cldnn_background_tuner.h"
+#include "cldnn_program.h"
+
+using namespace InferenceEngine;
+
+namespace CLDNNPlugin {
+
+CLDNNBackgroundTuner::CLDNNBackgroundTuner(const CNNNetwork& network, void* clContext, const Config& config)
+    // Program may modify the network, so tuning works with its own copy
+    : m_network(cloneNet(static_cast<const ICNNNetwork&>(network)))
+    , m_clContext(clContext)
+    , m_config(config)
+    , m_inferences(0) {
+    m_started.clear();
+    m_config.tuningConfig.mode = cldnn::tuning_mode::tuning_tune_and_cache;
+}
+
+CLDNNBackgroundTuner::~CLDNNBackgroundTuner() {
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void CLDNNBackgroundTuner::OnInferenceDone() {
+    if (++m_inferences < m_config.tuning_warmup_inferences)
+        return;
+    if (!m_started.test_and_set()) {
+        m_thread = std::thread([this] { Tune(); });
+    }
+}
+
+void CLDNNBackgroundTuner::Tune() {
+    try {
+        // Tuning measures kernels execution time, so it needs separate engine with profiling enabled
+        cldnn::device_query query(m_clContext);
+        auto devices = query.get_available_devices();
+        if (devices.empty())
+            return;
+
+        auto engine = std::make_shared<cldnn::engine>(devices.begin()->second,
+            cldnn::engine_configuration(true,
+                false,
+                false,
+                std::string(),
+                std::string(),
+                true,
+                std::string(),
+                std::string(),
+                m_config.queuePriority,
+                m_config.queueThrottle,
+                m_config.memory_pool_on,
+                1,
+                m_config.kernels_cache_dir));
+
+        // Building the program runs the tuning and stores results to the tuning file
+        Program program(m_network, engine, m_config);
+    } catch (...) {
+        // Background tuning is best effort - the network keeps using kernels selected at load time
+    }
+}
+
+};  // namespace CLDNNPlugin
@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "cpp/ie_cnn_network.h"
+#include "cldnn_config.h"
+
+namespace CLDNNPlugin {
+
+/**
+ * @brief Tunes kernels of the network in background and stores the results to the tuning file.
+ * The network which owns the tuner keeps working with the kernels selected at load time,
+ * the tuned kernels are picked up by the next LoadNetwork calls on devices with the same EU count.
+ */
+class CLDNNBackgroundTuner {
+public:
+    typedef std::shared_ptr<CLDNNBackgroundTuner> Ptr;
+
+    CLDNNBackgroundTuner(const InferenceEngine::CNNNetwork& network, void* clContext, const Config& config);
+    ~CLDNNBackgroundTuner();
+
+    // Counts finished inferences and starts tuning once the warm-up inferences are done
+    void OnInferenceDone();
+
+private:
+    void Tune();
+
+    InferenceEngine::CNNNetwork m_network;
+    void* m_clContext;
+    Config m_config;
+    std::atomic<int> m_inferences;
+    std::atomic_flag m_started;
+    std::thread m_thread;
+};
+
+};  // namespace CLDNNPlugin
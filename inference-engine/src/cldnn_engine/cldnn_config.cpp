@@ -133,6 +133,8 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
                 tuningConfig.mode = cldnn::tuning_mode::tuning_use_and_update;
             } else if (val.compare(PluginConfigParams::TUNING_RETUNE) == 0) {
                 tuningConfig.mode = cldnn::tuning_mode::tuning_retune_and_cache;
+            } else if (val.compare(PluginConfigParams::TUNING_BACKGROUND) == 0) {
+                tuningConfig.mode = cldnn::tuning_mode::tuning_use_cache_or_offline;
             } else {
                 THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported tuning mode value by plugin: " << val;
             }
@@ -218,6 +220,52 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
             } else {
                 THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported KEY_CLDNN_ENABLE_FP16_FOR_QUANTIZED_MODELS flag value: " << val;
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_PIPELINED_UPLOAD) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                pipelined_upload = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                pipelined_upload = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported KEY_CLDNN_PIPELINED_UPLOAD flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_TUNING_WARMUP_INFERENCES) == 0) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CLDNNConfigParams::KEY_CLDNN_TUNING_WARMUP_INFERENCES
+                                   << ". Expected only non-negative numbers";
+            }
+            tuning_warmup_inferences = val_i;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_QUEUE) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                out_of_order_queue = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                out_of_order_queue = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported KEY_CLDNN_OUT_OF_ORDER_QUEUE flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_ENABLE_FUSED_ATTENTION) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                enable_fused_attention = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                enable_fused_attention = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported KEY_CLDNN_ENABLE_FUSED_ATTENTION flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_MEM_POOL_CACHE_LIMIT) == 0) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CLDNNConfigParams::KEY_CLDNN_MEM_POOL_CACHE_LIMIT
+                                   << ". Expected only non-negative numbers";
+            }
+            mem_pool_cache_limit = static_cast<uint64_t>(val_i) << 20;
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property key by plugin: " << key;
         }
@@ -262,6 +310,11 @@ void Config::adjustKeyMapValues() {
     else
         key_config_map[CLDNNConfigParams::KEY_CLDNN_ENABLE_FP16_FOR_QUANTIZED_MODELS] = PluginConfigParams::NO;
 
+    if (pipelined_upload)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_PIPELINED_UPLOAD] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_PIPELINED_UPLOAD] = PluginConfigParams::NO;
+
     {
         std::string qp = "0";
         switch (queuePriority) {
@@ -289,12 +342,23 @@ void Config::adjustKeyMapValues() {
         case cldnn::tuning_mode::tuning_use_cache: tm = PluginConfigParams::TUNING_USE_EXISTING; break;
         case cldnn::tuning_mode::tuning_use_and_update: tm = PluginConfigParams::TUNING_UPDATE; break;
         case cldnn::tuning_mode::tuning_retune_and_cache: tm = PluginConfigParams::TUNING_RETUNE; break;
+        case cldnn::tuning_mode::tuning_use_cache_or_offline: tm = PluginConfigParams::TUNING_BACKGROUND; break;
         default: break;
         }
         key_config_map[PluginConfigParams::KEY_TUNING_MODE] = tm;
         key_config_map[PluginConfigParams::KEY_TUNING_FILE] = tuningConfig.cache_file_path;
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_TUNING_WARMUP_INFERENCES] = std::to_string(tuning_warmup_inferences);
     }
 
+    if (out_of_order_queue)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_QUEUE] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_QUEUE] = PluginConfigParams::NO;
+    if (enable_fused_attention)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_ENABLE_FUSED_ATTENTION] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_ENABLE_FUSED_ATTENTION] = PluginConfigParams::NO;
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_MEM_POOL_CACHE_LIMIT] = std::to_string(mem_pool_cache_limit >> 20);
     key_config_map[CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR] = graph_dumps_dir;
     key_config_map[CLDNNConfigParams::KEY_CLDNN_SOURCES_DUMPS_DIR] = sources_dumps_dir;
     key_config_map[PluginConfigParams::KEY_CACHE_DIR] = kernels_cache_dir;
@@ -28,6 +28,11 @@ struct Config {
                enableInt8(true),
                nv12_two_inputs(false),
                enable_fp16_for_quantized_models(true),
+               pipelined_upload(false),
+               tuning_warmup_inferences(10),
+               mem_pool_cache_limit(0),
+               out_of_order_queue(true),
+               enable_fused_attention(false),
                queuePriority(cldnn::priority_mode_types::disabled),
                queueThrottle(cldnn::throttle_mode_types::disabled),
                max_dynamic_batch(1),
@@ -52,6 +57,11 @@ struct Config {
     bool enableInt8;
     bool nv12_two_inputs;
     bool enable_fp16_for_quantized_models;
+    bool pipelined_upload;
+    int tuning_warmup_inferences;
+    uint64_t mem_pool_cache_limit;
+    bool out_of_order_queue;
+    bool enable_fused_attention;
     cldnn::priority_mode_types queuePriority;
     cldnn::throttle_mode_types queueThrottle;
     int max_dynamic_batch;
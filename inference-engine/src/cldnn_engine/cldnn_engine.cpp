@@ -27,6 +27,8 @@
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <generic_ie.hpp>
+#include <ngraph_ops/convolution_ie.hpp>
+#include <ngraph/variant.hpp>
 #include <transformations/control_flow/unroll_tensor_iterator.hpp>
 #include <transformations/common_optimizations/common_optimizations.hpp>
 #include <transformations/opset_conversions/convert_opset2_to_opset1.hpp>
@@ -52,7 +54,6 @@
 #include "cldnn_custom_layer.h"
 
 #include <low_precision/transformer.hpp>
-#include <low_precision/mat_mul.hpp>
 
 #ifdef __linux__
 # include <dlfcn.h>
@@ -220,11 +221,32 @@ InferenceEngine::ICNNNetwork::Ptr clDNNEngine::CloneAndTransformNetwork(const In
                     return true;
                 };
 
+                // Weights of convolutions which are not quantized are kept in FP16, so they are neither
+                // converted to FP32 here nor back to FP16 by the program
+                std::vector<std::shared_ptr<ngraph::Node>> fp16Weights;
+                for (auto& node : nGraphFunc->get_ordered_ops()) {
+                    if (!ngraph::op::is_constant(node) || node->get_output_element_type(0) != ngraph::element::f16)
+                        continue;
+                    auto consumers = node->output(0).get_target_inputs();
+                    bool isWeights = !consumers.empty() &&
+                        std::all_of(consumers.begin(), consumers.end(), [](const ngraph::Input<ngraph::Node>& input) {
+                            return input.get_index() == 1 && ngraph::is_type<ngraph::opset1::Convolution>(input.get_node());
+                        });
+                    if (isWeights) {
+                        node->get_rt_info()["KEEP_CONST_PRECISION"] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+                        fp16Weights.push_back(node);
+                    }
+                }
+
                 ngraph::pass::Manager conversion_manager;
                 // [WA part1] Convert quantized FP16 model to FP32 to avoid possible overflow and mixed precision errors
                 conversion_manager.register_pass<ngraph::pass::ConvertPrecision>(ngraph::element::f16, ngraph::element::f32);
                 conversion_manager.set_callback(fp16_callback);
                 conversion_manager.run_passes(nGraphFunc);
+
+                // the constants may be shared with the original function
+                for (auto& node : fp16Weights)
+                    node->get_rt_info().erase("KEEP_CONST_PRECISION");
             }
         }
 
@@ -235,8 +257,8 @@ InferenceEngine::ICNNNetwork::Ptr clDNNEngine::CloneAndTransformNetwork(const In
                 LayerTransformation::QuantizedTensorAlignment::UpdateLevel,  // quantizedTensorAlignmentOnActivations
                 LayerTransformation::QuantizedTensorAlignment::None,  // quantizedTensorAlignmentOnWeights
                 true);  // supportAsymmetricQuantization
-            LowPrecisionTransformer transformer(LowPrecisionTransformer::getAllTransformations(params)
-                .add<MatMulTransformation, ngraph::opset1::MatMul>(LayerTransformation::Params(params).setSupportAsymmetricQuantization(false)));
+            // zero points of MatMul inputs are applied by the int8 gemm kernel
+            LowPrecisionTransformer transformer(LowPrecisionTransformer::getAllTransformations(params));
 
             transformer.transform(nGraphFunc);
         }
@@ -249,6 +271,35 @@ InferenceEngine::ICNNNetwork::Ptr clDNNEngine::CloneAndTransformNetwork(const In
             manager.run_passes(nGraphFunc);
         }
 
+        if (enableInt8) {
+            // FP16 weights kept by ConvertPrecision are passed to the convolutions as is,
+            // kernels which need another precision get the weights reordered on the device
+            for (auto& node : nGraphFunc->get_ordered_ops()) {
+                auto conv = std::dynamic_pointer_cast<ngraph::op::ConvolutionIE>(node);
+                if (!conv)
+                    continue;
+                auto weights = conv->input_value(1).get_node_shared_ptr();
+                auto reshape = std::dynamic_pointer_cast<ngraph::opset1::Reshape>(weights);
+                auto convert = std::dynamic_pointer_cast<ngraph::opset1::Convert>(
+                    reshape ? reshape->input_value(0).get_node_shared_ptr() : weights);
+                if (!convert || !convert->get_rt_info().count("DISABLED_CONSTANT_FOLDING"))
+                    continue;
+                auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(convert->input_value(0).get_node_shared_ptr());
+                if (!constant || constant->get_element_type() != ngraph::element::f16)
+                    continue;
+                if (reshape) {
+                    // e.g. weights of 1D convolution
+                    if (reshape->get_output_partial_shape(0).is_dynamic())
+                        continue;
+                    constant = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f16, reshape->get_output_shape(0),
+                                                                          constant->get_data_ptr());
+                    constant->set_friendly_name(reshape->get_friendly_name());
+                }
+                conv->input(1).replace_source_output(constant);
+            }
+            nGraphFunc->validate_nodes_and_infer_types();
+        }
+
         clonedNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, *clonedNetwork);
     }
 
@@ -354,8 +405,8 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEn
                context_config.useProfiling == current_config.useProfiling &&
                context_config.dumpCustomKernels == current_config.dumpCustomKernels &&
                context_config.memory_pool_on == current_config.memory_pool_on &&
-               context_config.queueThrottle == current_config.queueThrottle &&
-               context_config.queuePriority == current_config.queuePriority &&
+               context_config.mem_pool_cache_limit == current_config.mem_pool_cache_limit &&
+               context_config.out_of_order_queue == current_config.out_of_order_queue &&
                context_config.sources_dumps_dir == current_config.sources_dumps_dir &&
                context_config.tuningConfig.mode == current_config.tuningConfig.mode &&
                context_config.tuningConfig.cache_file_path == current_config.tuningConfig.cache_file_path &&
@@ -366,7 +417,11 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEn
     {
         std::lock_guard<std::mutex> lock(engine_mutex);
         if (!canReuseDefaultContext()) {
-            m_defaultContext.reset(new CLDNNRemoteCLContext(shared_from_this(), ParamMap(), conf));
+            // Queue hints are applied to the queues of each network, so networks with different hints share the context
+            Config context_config = conf;
+            context_config.queuePriority = cldnn::priority_mode_types::disabled;
+            context_config.queueThrottle = cldnn::throttle_mode_types::disabled;
+            m_defaultContext.reset(new CLDNNRemoteCLContext(shared_from_this(), ParamMap(), context_config));
         }
     }
 
@@ -730,6 +785,7 @@ Parameter clDNNEngine::GetMetric(const std::string& name, const std::map<std::st
             capabilities.push_back(METRIC_VALUE(FP16));
         if (device_info.supports_imad || device_info.supports_immad)
             capabilities.push_back(METRIC_VALUE(INT8));
+        capabilities.push_back(METRIC_VALUE(BATCHED_BLOB));
 
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
     } else if (name == METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS)) {
@@ -56,6 +56,25 @@ CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::CNNNetwork &network, RemoteC
 
     m_context = casted_context;
 
+    if (m_config.pipelined_upload) {
+        m_uploadExecutor = ExecutorManager::getInstance()->getExecutor("GPUUpload");
+    }
+
+    // with several streams the outputs of the requests are downloaded by the device queues,
+    // the host waits for them outside of the streams
+    if (m_config.throughput_streams > 1) {
+        m_waitExecutor = ExecutorManager::getInstance()->getExecutor("GPUWait");
+    }
+
+    if (m_config.tuningConfig.mode == cldnn::tuning_mode::tuning_use_cache_or_offline) {
+        if (m_config.tuningConfig.cache_file_path.empty()) {
+            THROW_IE_EXCEPTION << "Tuning file must be set with " << PluginConfigParams::KEY_TUNING_FILE
+                               << " key in " << PluginConfigParams::TUNING_BACKGROUND << " tuning mode";
+        }
+        m_backgroundTuner = std::make_shared<CLDNNBackgroundTuner>(network,
+            getContextImpl(m_context)->GetEngine()->get_context(), m_config);
+    }
+
     auto graph_base = std::make_shared<CLDNNGraph>(network, m_context, m_config, 0);
     for (uint16_t n = 0; n < m_config.throughput_streams; n++) {
         auto graph = n == 0 ? graph_base : std::make_shared<CLDNNGraph>(graph_base, n);
@@ -121,6 +140,7 @@ InferenceEngine::Parameter CLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(GPU_MEMORY_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -130,6 +150,14 @@ InferenceEngine::Parameter CLDNNExecNetwork::GetMetric(const std::string &name)
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
         unsigned int nr = m_config.throughput_streams * 2u;
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, nr);
+    } else if (name == METRIC_KEY(GPU_MEMORY_STATISTICS)) {
+        auto engine = getContextImpl(m_context)->GetEngine();
+        std::map<std::string, uint64_t> statistics;
+        statistics["allocated"] = engine->get_temp_used_device_memory_size();
+        statistics["peak"] = engine->get_max_used_device_memory_size();
+        statistics["reused"] = engine->get_reused_device_memory_size();
+        statistics["cached"] = engine->get_cached_device_memory_size();
+        IE_SET_METRIC_RETURN(GPU_MEMORY_STATISTICS, statistics);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -17,6 +17,7 @@
 #include "cldnn_graph.h"
 #include "cldnn_config.h"
 #include "cldnn_remote_context.h"
+#include "cldnn_background_tuner.h"
 
 namespace CLDNNPlugin {
 
@@ -40,6 +41,9 @@ public:
     gpu::ClContext::Ptr m_context;
     Config m_config;
     InferenceEngine::ITaskExecutor::Ptr m_taskExecutor;
+    InferenceEngine::ITaskExecutor::Ptr m_uploadExecutor;
+    InferenceEngine::ITaskExecutor::Ptr m_waitExecutor;
+    CLDNNBackgroundTuner::Ptr m_backgroundTuner;
 };
 
 };  // namespace CLDNNPlugin
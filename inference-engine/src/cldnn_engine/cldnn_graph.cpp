@@ -61,17 +61,21 @@ void CLDNNGraph::UpdateLayersMaps() {
     profilingIDs = m_program->profilingIDs;
     perfMap = m_program->perfMap;
     outputDims = m_program->outputDims;
+    inputLayouts = m_program->inputLayouts;
 }
 
 void CLDNNGraph::Build() {
     UpdateLayersMaps();
 
     if (GetMaxDynamicBatchSize() > 1) {
+        // Networks for batch sizes not used by the max batch are built on demand, see GetNetwork()
         int m_bv_sz = m_program->GetMaxBatchSizeForSingleProgram();
+        m_networks.resize(m_bv_sz);
         for (int b = m_bv_sz - 1; b >= 0; b--) {
-            auto network = BuildNetwork(m_program->getCompiledProgram(b));
-            m_networks.insert(m_networks.begin(), network);
-            GetEngine()->release_pending_memory(network->get_id());
+            if (GetMaxDynamicBatchSize() & (1 << b)) {
+                m_networks[b] = BuildNetwork(m_program->getCompiledProgram(b));
+                GetEngine()->release_pending_memory(m_networks[b]->get_id());
+            }
         }
     } else {
         auto network = BuildNetwork(m_program->getCompiledProgram());
@@ -469,7 +473,7 @@ InferenceEngine::CNNNetwork CLDNNGraph::GetExecGraphInfoByPrimitivesInfo(std::ve
 }
 
 InferenceEngine::CNNNetwork CLDNNGraph::GetExecGraphInfo() {
-    auto primitives_info = GetNetwork()->get_primitives_info();
+    auto primitives_info = GetBuiltNetwork()->get_primitives_info();
     return GetExecGraphInfoByPrimitivesInfo(primitives_info, true);
 }
 
@@ -498,8 +502,8 @@ void CLDNNGraph::UpdatePerfStatistics() {
         }
     };
 
-    std::map<cldnn::primitive_id, cldnn::event> executedPrimitives = GetNetwork()->get_executed_primitives();
-    auto allPrimitives = GetNetwork()->get_all_primitives();
+    std::map<cldnn::primitive_id, cldnn::event> executedPrimitives = GetBuiltNetwork()->get_executed_primitives();
+    auto allPrimitives = GetBuiltNetwork()->get_all_primitives();
 
     // Get profiling info for all layers
     for (auto &profiledID : profilingIDs) {
@@ -542,7 +546,7 @@ void CLDNNGraph::UpdatePerfStatistics() {
 }
 
 bool CLDNNGraph::IsLoaded() const {
-    return GetNetwork() != nullptr;
+    return GetBuiltNetwork() != nullptr;
 }
 
 void CLDNNGraph::UpdateImplementationsMap() {
@@ -579,7 +583,7 @@ void CLDNNGraph::UpdateImplementationsMap() {
         for (auto& id : profilingIDs) {
             std::string prim_info = "";
             try {
-                prim_info = GetNetwork()->get_primitive_info(id);
+                prim_info = GetBuiltNetwork()->get_primitive_info(id);
             } catch (std::exception& /*e*/) { }
 
             implementationsMap.insert({id, extractImplementationFromInfo(prim_info)});
@@ -590,9 +594,9 @@ void CLDNNGraph::UpdateImplementationsMap() {
 void CLDNNGraph::GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &result) const {
     bool combinePrimByIRLayers = false;
     unsigned i = 0;
-    auto allIds = GetNetwork()->get_all_primitive_org_ids();
-    auto executedPrimitives = GetNetwork()->get_executed_primitives();
-    auto primitivesInfo = GetNetwork()->get_primitives_info();
+    auto allIds = GetBuiltNetwork()->get_all_primitive_org_ids();
+    auto executedPrimitives = GetBuiltNetwork()->get_executed_primitives();
+    auto primitivesInfo = GetBuiltNetwork()->get_primitives_info();
 
     auto getUpperCaseName = [&](std::string name) {
         if (name.length() > 0)
@@ -735,17 +739,32 @@ void CLDNNGraph::GetPerformanceCounts(std::map<std::string, InferenceEngine::Inf
         }
 }
 
-std::shared_ptr<cldnn::network> CLDNNGraph::GetNetwork(size_t idx) const {
+std::shared_ptr<cldnn::network> CLDNNGraph::GetNetwork(size_t idx) {
     if (idx >= GetNetworksCount())
         THROW_IE_EXCEPTION << "Unable to find network with id=" << idx << ". Stored networks count: " << GetNetworksCount();
 
+    std::lock_guard<std::recursive_mutex> lock(m_networksMutex);
+    if (m_networks[idx] == nullptr) {
+        m_networks[idx] = BuildNetwork(m_program->getCompiledProgram(static_cast<int>(idx)));
+        GetEngine()->release_pending_memory(m_networks[idx]->get_id());
+    }
+
     return m_networks[idx];
 }
 
+std::shared_ptr<cldnn::network> CLDNNGraph::GetBuiltNetwork() const {
+    std::lock_guard<std::recursive_mutex> lock(m_networksMutex);
+    for (auto& network : m_networks) {
+        if (network != nullptr)
+            return network;
+    }
+    return nullptr;
+}
+
 
 std::string CLDNNGraph::MapOutputName(std::string outName) const {
-    auto networkOutputsIDs = GetNetwork()->get_output_ids();
-    auto allPrimitiveIds = GetNetwork()->get_all_primitives();
+    auto networkOutputsIDs = GetBuiltNetwork()->get_output_ids();
+    auto allPrimitiveIds = GetBuiltNetwork()->get_all_primitives();
 
     // Find correct output ID. Start with name stored in IR.
     std::string outputID = primitiveIDs.at(outName);
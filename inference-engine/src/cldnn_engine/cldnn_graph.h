@@ -14,6 +14,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <mutex>
 #include "ie_blob.h"
 #include "cpp/ie_cnn_network.h"
 #include "debug_options.h"
@@ -56,9 +57,10 @@ public:
     gpu::ClContext::Ptr GetContext() { return m_context; }
     std::shared_ptr<const cldnn::engine> GetEngine() const { return getContextImpl(m_context)->GetEngine(); }
     int GetMaxDynamicBatchSize() const { return getConfig().max_dynamic_batch; }
-    const std::map<std::string, cldnn::layout>& GetInputLayouts() const { return m_program->getInputLayouts(); }
+    const std::map<std::string, cldnn::layout>& GetInputLayouts() const { return inputLayouts; }
     size_t GetNetworksCount() const { return m_networks.size(); }
-    std::shared_ptr<cldnn::network> GetNetwork(size_t idx = 0) const;
+    // For dynamic batch returns network for batch 2^idx, building it on first request
+    std::shared_ptr<cldnn::network> GetNetwork(size_t idx = 0);
     InferenceEngine::SizeVector GetOutputSize(std::string outName) const;
     std::string MapOutputName(std::string outName) const;
     std::string getName() const { return m_networkName; }
@@ -69,6 +71,7 @@ protected:
 
     gpu::ClContext::Ptr m_context;
     std::vector<std::shared_ptr<cldnn::network>> m_networks;
+    mutable std::recursive_mutex m_networksMutex;
     std::map<std::string, cldnn::primitive_id> primitiveIDs;
     std::map<cldnn::primitive_id, std::vector<std::string>> primitivesToIRLayersMap;
     std::map<cldnn::primitive_id, std::string> IRToNgraphLayersMap;
@@ -79,11 +82,14 @@ protected:
     std::vector<cldnn::primitive_id> profilingIDs;
 
     std::map<std::string, InferenceEngine::SizeVector> outputDims;
+    std::map<std::string, cldnn::layout> inputLayouts;
 
     std::shared_ptr<Program> m_program;
     uint16_t m_stream_id;
 
     std::shared_ptr<cldnn::network> BuildNetwork(std::shared_ptr<cldnn::program> program);
+    // Returns the first already built network, used to query information common for all networks
+    std::shared_ptr<cldnn::network> GetBuiltNetwork() const;
     void Build();
     void UpdateLayersMaps();
     void UpdateImplementationsMap();
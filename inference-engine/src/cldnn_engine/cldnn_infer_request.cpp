@@ -7,6 +7,7 @@
 #include <map>
 #include <functional>
 #include <utility>
+#include <vector>
 #include <description_buffer.hpp>
 #include "cldnn_infer_request.h"
 #include "cldnn_remote_context.h"
@@ -22,6 +23,91 @@ const char str_not_allocated[] = "Input data was not allocated.";
 const char cannot_set_compound[] = "cannot set compound blob: supported only for input pre-processing";
 const char wrong_nv12_blob[] = "NV12 input blob is expected for input with NV12 color format";
 
+// Images of a blob passed for an input with NV12 color format: the NV12 blob itself
+// or the NV12 blobs of a batched blob, one per batch
+static std::vector<NV12Blob::Ptr> getNV12Images(const Blob::Ptr& blob) {
+    std::vector<NV12Blob::Ptr> images;
+    if (auto nv12_ptr = std::dynamic_pointer_cast<NV12Blob>(blob)) {
+        images.push_back(nv12_ptr);
+    } else if (auto batched_ptr = std::dynamic_pointer_cast<BatchedBlob>(blob)) {
+        for (size_t b = 0; b < batched_ptr->size(); b++) {
+            auto image = std::dynamic_pointer_cast<NV12Blob>(batched_ptr->getBlob(b));
+            if (image == nullptr) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << wrong_nv12_blob;
+            }
+            images.push_back(image);
+        }
+    } else {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << wrong_nv12_blob;
+    }
+    return images;
+}
+
+// Suffix of the Y and UV network inputs of the image, see Program::AddInputPrimitive
+static std::string nv12InputSuffix(size_t image, size_t batch) {
+    return batch > 1 ? std::to_string(image) : "";
+}
+
+// Batched blob of regular images: each of them is read from its own buffer
+static bool isBatchedImages(const Blob::Ptr& blob) {
+    auto batched_ptr = blob->as<BatchedBlob>();
+    return batched_ptr != nullptr && batched_ptr->getBlob(0)->is<MemoryBlob>();
+}
+
+static void checkBatchedImages(const BatchedBlob& blob) {
+    if (blob.getTensorDesc().getLayout() == CN) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Batched blob with CN layout is not supported";
+    }
+    for (size_t b = 0; b < blob.size(); b++) {
+        auto image = blob.getBlob(b);
+        const auto& desc = image->getTensorDesc();
+        if (!image->is<MemoryBlob>() ||
+            desc.getBlockingDesc() != TensorDesc(desc.getPrecision(), desc.getDims(), desc.getLayout()).getBlockingDesc()) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Items of batched blob must be dense memory blobs";
+        }
+        if (image->buffer() == nullptr) {
+            THROW_IE_EXCEPTION << str_not_allocated;
+        }
+    }
+}
+
+// ROI or padded view of a larger buffer, it is gathered into the input memory by strides
+static bool isStridedView(const Blob& blob) {
+    const auto& desc = blob.getTensorDesc();
+    if (!blob.is<MemoryBlob>() || desc.getLayout() == ANY || desc.getLayout() == SCALAR)
+        return false;
+    const auto& blk = desc.getBlockingDesc();
+    return blk != BlockingDesc(blk.getBlockDims(), blk.getOrder());
+}
+
+static void copyStridedView(const Blob& blob, uint8_t* dst, size_t dstSize) {
+    if (blob.byteSize() != dstSize) {
+        THROW_IE_EXCEPTION << "The input blob size is not equal to the network input size";
+    }
+    const auto& blk = blob.getTensorDesc().getBlockingDesc();
+    const auto& dims = blk.getBlockDims();
+    const auto& strides = blk.getStrides();
+    const size_t elemSize = blob.element_size();
+    const uint8_t* src = blob.cbuffer().as<const uint8_t*>() + blk.getOffsetPadding() * elemSize;
+
+    // rows of the innermost dimension are copied at once when its elements are adjacent
+    const bool denseRows = strides.back() == 1;
+    const size_t outerDims = denseRows ? dims.size() - 1 : dims.size();
+    const size_t rowSize = denseRows ? dims.back() * elemSize : elemSize;
+    std::vector<size_t> idx(outerDims, 0);
+    for (size_t dstOffset = 0; dstOffset < dstSize; dstOffset += rowSize) {
+        size_t srcOffset = 0;
+        for (size_t d = 0; d < outerDims; d++)
+            srcOffset += idx[d] * strides[d];
+        ie_memcpy(dst + dstOffset, dstSize - dstOffset, src + srcOffset * elemSize, rowSize);
+        for (size_t d = outerDims; d-- > 0;) {
+            if (++idx[d] < dims[d])
+                break;
+            idx[d] = 0;
+        }
+    }
+}
+
 Blob::Ptr CLDNNInferRequest::createInputBlob(const TensorDesc& desc, uint8_t* mem_ptr) {
     const Precision p = desc.getPrecision();
 
@@ -328,23 +414,30 @@ void checkInputBlob(const Blob::Ptr &blob,
 
     if (ColorFormat::NV12 == foundInput->getPreProcess().getColorFormat() &&
         nv12_two_inputs) {
-        auto nv12_ptr = blob->as<NV12Blob>();
-
-        if (nv12_ptr == nullptr) {
-            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << wrong_nv12_blob;
+        auto images = getNV12Images(blob);
+        if (images.size() != foundInput->getTensorDesc().getDims()[0]) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The number of NV12 images is not equal to the network batch: got "
+                               << images.size() << " expecting " << foundInput->getTensorDesc().getDims()[0];
         }
 
-        auto y_ptr = nv12_ptr->y()->as<gpu::ClBlob>();
+        for (auto& nv12_ptr : images) {
+            auto y_ptr = nv12_ptr->y()->as<gpu::ClBlob>();
 
-        // if the blobs are not remote, check their size
-        if (!y_ptr) {
-            if (nv12_ptr->y()->buffer() == nullptr) THROW_IE_EXCEPTION << str_not_allocated;
-        }
+            // if the blobs are not remote, check their size
+            if (!y_ptr) {
+                if (nv12_ptr->y()->buffer() == nullptr) THROW_IE_EXCEPTION << str_not_allocated;
+            }
 
-        auto uv_ptr = nv12_ptr->uv()->as<gpu::ClBlob>();
-        if (!uv_ptr) {
-            if (nv12_ptr->uv()->buffer() == nullptr) THROW_IE_EXCEPTION << str_not_allocated;
+            auto uv_ptr = nv12_ptr->uv()->as<gpu::ClBlob>();
+            if (!uv_ptr) {
+                if (nv12_ptr->uv()->buffer() == nullptr) THROW_IE_EXCEPTION << str_not_allocated;
+            }
         }
+    } else if (isBatchedImages(blob)) {
+        if (details::product(blob->getTensorDesc().getDims()) != details::product(foundInput->getTensorDesc().getDims())) {
+            THROW_IE_EXCEPTION << strNotMatched;
+        }
+        checkBatchedImages(*blob->as<BatchedBlob>());
     } else {
         SizeVector dims = foundInput->getTensorDesc().getDims();
 
@@ -483,29 +576,35 @@ void CLDNNInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
         } else if (compoundBlobPassed) {
             if (ColorFormat::NV12 == foundInput->getPreProcess().getColorFormat() &&
                 m_graph->getConfig().nv12_two_inputs) {
-                // try extracting Y and UV remote blobs from it
+                // try extracting Y and UV remote blobs from it (from each image of a batched blob)
                 // and put them into appropriate network inputs
                 // that should then go into biplanar NV12 reorder
-                auto nv12_ptr = data->as<NV12Blob>();
-
-                if (nv12_ptr == nullptr) {
-                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << wrong_nv12_blob;
+                auto images = getNV12Images(data);
+                const size_t batch = desc.getDims()[0];
+                if (images.size() != batch) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The number of NV12 images is not equal to the network batch ("
+                                       << images.size() << "!=" << batch << ").";
                 }
 
-                auto y_ptr = nv12_ptr->y()->as<gpu::ClBlob>();
-                if (y_ptr) {
-                    auto y_impl = getBlobImpl(y_ptr);
-                    y_impl->allocate_if_needed();
-                    input_attach(internalName + "_Y", y_impl->getMemory());
-                    is_remote = true;
-                }
+                for (size_t b = 0; b < images.size(); b++) {
+                    auto& nv12_ptr = images[b];
+                    auto suffix = nv12InputSuffix(b, batch);
+
+                    auto y_ptr = nv12_ptr->y()->as<gpu::ClBlob>();
+                    if (y_ptr) {
+                        auto y_impl = getBlobImpl(y_ptr);
+                        y_impl->allocate_if_needed();
+                        input_attach(internalName + "_Y" + suffix, y_impl->getMemory());
+                        is_remote = true;
+                    }
 
-                auto uv_ptr = nv12_ptr->uv()->as<gpu::ClBlob>();
-                if (uv_ptr) {
-                    auto uv_impl = getBlobImpl(uv_ptr);
-                    uv_impl->allocate_if_needed();
-                    input_attach(internalName + "_UV", uv_impl->getMemory());
-                    is_remote = true;
+                    auto uv_ptr = nv12_ptr->uv()->as<gpu::ClBlob>();
+                    if (uv_ptr) {
+                        auto uv_impl = getBlobImpl(uv_ptr);
+                        uv_impl->allocate_if_needed();
+                        input_attach(internalName + "_UV" + suffix, uv_impl->getMemory());
+                        is_remote = true;
+                    }
                 }
 
                 if (is_remote) _inputs[name] = data;
@@ -520,9 +619,18 @@ void CLDNNInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
                 _preProcData[name]->isApplicable(data, _inputs[name]);
                 _preProcData[name]->setRoiBlob(data);
             } else {
-                if (compoundBlobPassed) {
+                const bool batchedImagesPassed = isBatchedImages(data);
+                if (compoundBlobPassed && !batchedImagesPassed) {
                     THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << cannot_set_compound;
                 }
+                if (batchedImagesPassed) {
+                    if (m_graph->GetMaxDynamicBatchSize() > 1) {
+                        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Batched blob is not supported with dynamic batch";
+                    }
+                    // images are gathered into the input memory on inference
+                    checkBatchedImages(*data->as<BatchedBlob>());
+                    dataSize = details::product(blobDesc.getDims());
+                }
 
                 size_t blobSize = desc.getLayout() != SCALAR
                     ? details::product(desc.getDims())
@@ -532,7 +640,20 @@ void CLDNNInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
                         << dataSize << "!=" << blobSize << ").";
                 }
 
-                if (data->buffer() == nullptr)
+                if (isStridedView(*data)) {
+                    const auto prec = blobDesc.getPrecision();
+                    if (m_graph->GetMaxDynamicBatchSize() > 1 || prec == Precision::I16 || prec == Precision::U16) {
+                        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
+                                           << "Strided input blob is not supported with dynamic batch and for I16/U16 precisions";
+                    }
+                    const auto& blk = blobDesc.getBlockingDesc();
+                    const auto& inBlk = desc.getBlockingDesc();
+                    if (blk.getBlockDims() != inBlk.getBlockDims() || blk.getOrder() != inBlk.getOrder()) {
+                        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
+                    }
+                }
+
+                if (!batchedImagesPassed && data->buffer() == nullptr)
                     THROW_IE_EXCEPTION << str_not_allocated << " Input name: \'" << name << "\'";
                 _inputs[name] = data;
             }
@@ -569,27 +690,35 @@ void CLDNNInferRequest::AllocateInputs() {
 
         if (ColorFormat::NV12 == ni.second->getPreProcess().getColorFormat() &&
             m_graph->getConfig().nv12_two_inputs) {
-            cldnn::primitive_id YName(name + "_Y");
-            cldnn::primitive_id UVName(name + "_UV");
-
-            input_alloc(YName, m_graph->GetInputLayouts().at(YName));
-            input_alloc(UVName, m_graph->GetInputLayouts().at(UVName));
-
-            size_t height = desc.getDims()[2], width = desc.getDims()[3];
-            cldnn::pointer<uint8_t> input_mem_ptr_Y = inputsMemory.at(YName).pointer<uint8_t>();
-            TensorDesc ydesc(Precision::U8, { 1, 1, height, width }, Layout::NHWC);
-            auto blobY = createInputBlob(ydesc, input_mem_ptr_Y.data());
-
-            cldnn::pointer<uint8_t> input_mem_ptr_UV = inputsMemory.at(UVName).pointer<uint8_t>();
-            TensorDesc uvdesc(Precision::U8, { 1, 2, height / 2, width / 2 }, Layout::NHWC);
-            auto blobUV = createInputBlob(uvdesc, input_mem_ptr_UV.data());
+            const size_t batch = desc.getDims()[0];
+            std::vector<Blob::Ptr> images;
+            for (size_t b = 0; b < batch; b++) {
+                auto suffix = nv12InputSuffix(b, batch);
+                cldnn::primitive_id YName(name + "_Y" + suffix);
+                cldnn::primitive_id UVName(name + "_UV" + suffix);
+
+                input_alloc(YName, m_graph->GetInputLayouts().at(YName));
+                input_alloc(UVName, m_graph->GetInputLayouts().at(UVName));
+
+                size_t height = desc.getDims()[2], width = desc.getDims()[3];
+                cldnn::pointer<uint8_t> input_mem_ptr_Y = inputsMemory.at(YName).pointer<uint8_t>();
+                TensorDesc ydesc(Precision::U8, { 1, 1, height, width }, Layout::NHWC);
+                auto blobY = createInputBlob(ydesc, input_mem_ptr_Y.data());
+
+                cldnn::pointer<uint8_t> input_mem_ptr_UV = inputsMemory.at(UVName).pointer<uint8_t>();
+                TensorDesc uvdesc(Precision::U8, { 1, 2, height / 2, width / 2 }, Layout::NHWC);
+                auto blobUV = createInputBlob(uvdesc, input_mem_ptr_UV.data());
+
+                images.push_back(make_shared_blob<NV12Blob>(blobY, blobUV));
+            }
 
-            _inputs[name] = make_shared_blob<NV12Blob>(blobY, blobUV);
+            _inputs[name] = batch > 1 ? make_shared_blob<BatchedBlob>(images) : images[0];
         } else {
             cldnn::layout layout = m_graph->GetInputLayouts().at(name);
             input_alloc(name, layout);
             cldnn::pointer<uint8_t> mem_ptr = inputsMemory.at(name).pointer<uint8_t>();
             _inputs[name] = createInputBlob(desc, mem_ptr.data());
+            allocatedInputs[name] = mem_ptr.data();
 
             if (desc.getPrecision() == Precision::I16 || desc.getPrecision() == Precision::U16) {
                 cldnn::layout layout_fp32 = layout;
@@ -761,10 +890,12 @@ CLDNNInferRequest::CLDNNInferRequest(InputsDataMap networkInputs, OutputsDataMap
         , m_useStreams(false) {
     IE_ASSERT(nullptr != execNetwork);
     streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(execNetwork->m_taskExecutor.get());
+    uploadExecutor = execNetwork->m_uploadExecutor;
+    waitExecutor = execNetwork->m_waitExecutor;
 }
 
 void CLDNNInferRequest::execAndParse() {
-    auto networkOutputs = m_graph->GetNetwork()->execute();
+    auto networkOutputs = m_graph->GetNetwork()->execute(uploadEvents);
 
     // Collect outputs as requested by the model
     for (auto& no : _networkOutputs) {
@@ -776,9 +907,16 @@ void CLDNNInferRequest::execAndParse() {
         // mapping remote blobs not needed -
         // let the user take care of them explicitly
         if (!bptr->is<gpu::ClBlob>()) {
-            auto out_ptr = outputMemory.pointer<uint8_t>();
             auto blob_ptr = bptr->buffer().as<uint8_t*>();
+            // Dense outputs of the same size are read by the device queue, WaitInference() waits for them,
+            // so the host doesn't block here for the end of the execution
+            if (waitExecutor && !m_useProfiling && !outputMemory.get_layout().data_padding &&
+                bptr->byteSize() == outputMemory.size()) {
+                downloadEvents.push_back(m_graph->GetNetwork()->copy_output_async(outputID, blob_ptr));
+                continue;
+            }
 
+            auto out_ptr = outputMemory.pointer<uint8_t>();
             // If Async API is used, copy of output blobs is not needed, unless SetBlob function was called.
             // But in the case when old API is used we have to copy data to memory provided by user.
             if (blob_ptr != &out_ptr[0]) {
@@ -823,6 +961,12 @@ void CLDNNInferRequest::execAndParseDyn() {
 
 void CLDNNInferRequest::InferImpl() {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNN_INFER");
+    EnqueueInference();
+    WaitInference();
+}
+
+void CLDNNInferRequest::EnqueueInference() {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNN_ENQUEUE");
     int streamID = 0;
     if (nullptr != streamExecutor) {
         streamID = streamExecutor->GetStreamId();
@@ -838,15 +982,19 @@ void CLDNNInferRequest::InferImpl() {
         if (m_graph->GetMaxDynamicBatchSize() > 1) {
             PrepareInputDyn(name, *inputBlob);
         } else {
-            auto nv12_ptr = inputBlob->as<NV12Blob>();
-
-            if (nv12_ptr == nullptr) {
+            if (isBatchedImages(inputBlob)) {
+                PrepareBatchedInput(name, *inputBlob->as<BatchedBlob>());
+            } else if (!inputBlob->is<NV12Blob>() && !inputBlob->is<BatchedBlob>()) {
                 // regular blob
                 PrepareInput(name, *inputBlob);
             } else {
-                // special case for NV12 input blob
-                PrepareInput(name + "_Y", *nv12_ptr->y());
-                PrepareInput(name + "_UV", *nv12_ptr->uv());
+                // special case for NV12 input blob or a batch of them
+                auto images = getNV12Images(inputBlob);
+                for (size_t b = 0; b < images.size(); b++) {
+                    auto suffix = nv12InputSuffix(b, images.size());
+                    PrepareInput(name + "_Y" + suffix, *images[b]->y());
+                    PrepareInput(name + "_UV" + suffix, *images[b]->uv());
+                }
             }
         }
     }
@@ -857,6 +1005,60 @@ void CLDNNInferRequest::InferImpl() {
     } else {
         execAndParse();
     }
+    uploadEvents.clear();
+    uploadedInputs.clear();
+}
+
+void CLDNNInferRequest::WaitInference() {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNN_WAIT");
+    for (auto& event : downloadEvents) {
+        event.wait();
+    }
+    downloadEvents.clear();
+
+    auto& tuner = static_cast<CLDNNExecNetwork*>(_exeNetwork.get())->m_backgroundTuner;
+    if (tuner) {
+        tuner->OnInferenceDone();
+    }
+}
+
+void CLDNNInferRequest::UploadInputs() {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNN_UPLOAD");
+    uploadEvents.clear();
+    uploadedInputs.clear();
+    if (m_graph->GetMaxDynamicBatchSize() > 1) {
+        return;
+    }
+
+    for (auto &item : _inputs) {
+        const std::string& name = item.first;
+        const Blob::Ptr& inputBlob = item.second;
+        auto prec = inputBlob->getTensorDesc().getPrecision();
+        // pre-processed, remote, NV12, strided and converted inputs go the usual way
+        if (_preProcData.find(name) != _preProcData.end() || inputBlob->is<gpu::ClBlob>() ||
+            inputBlob->is<CompoundBlob>() || isStridedView(*inputBlob) || prec == Precision::I16 || prec == Precision::U16) {
+            continue;
+        }
+
+        auto inputLayout = m_graph->GetInputLayouts().at(name);
+        auto blob_ptr = inputBlob->cbuffer().as<const uint8_t*>();
+        if (blob_ptr == nullptr || inputBlob->byteSize() != inputLayout.bytes_count()) {
+            continue;
+        }
+        // blobs allocated by the plugin are already in the device memory
+        auto alloc_itr = allocatedInputs.find(name);
+        if (alloc_itr != allocatedInputs.end() && alloc_itr->second == blob_ptr) {
+            continue;
+        }
+
+        // the memory isn't shared with the blobs, so the upload doesn't overwrite the data user may refill
+        auto mem_itr = uploadMemory.find(name);
+        if (mem_itr == uploadMemory.end()) {
+            mem_itr = uploadMemory.insert({name, cldnn::memory::allocate(*(m_graph->GetEngine()), inputLayout)}).first;
+        }
+        uploadEvents.push_back(mem_itr->second.copy_from_async(blob_ptr));
+        uploadedInputs.insert(name);
+    }
 }
 
 void CLDNNInferRequest::GetPerformanceCounts(
@@ -912,7 +1114,10 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
     auto _nw_ptr = m_graph->GetNetwork();
     auto prec = inputBlob.getTensorDesc().getPrecision();
 
-    if (inputBlob.is<gpu::ClBlob>()) {
+    if (uploadedInputs.find(inputName) != uploadedInputs.end()) {
+        // the data is being copied by UploadInputs(), the network waits for the upload events
+        _nw_ptr->set_input_data(internalName, uploadMemory.at(inputName));
+    } else if (inputBlob.is<gpu::ClBlob>()) {
         // no need to check for reuse
         _nw_ptr->set_input_data(internalName, memory);
     } else if (prec == Precision::I16 || prec == Precision::U16) {
@@ -926,6 +1131,13 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
         }
 
         _nw_ptr->set_input_data(internalName, fp32_mem);
+    } else if (isStridedView(inputBlob)) {
+        // the view is gathered right into the input memory, so it is not compacted in a host buffer first
+        {
+            cldnn::pointer<uint8_t> ptr = memory.pointer<uint8_t>();
+            copyStridedView(inputBlob, ptr.data(), memory.size());
+        }
+        _nw_ptr->set_input_data(internalName, memory);
     } else if (is_same_buffer(inputBlob, memory)) {
         // If input memory was allocated by cldnn engine and wasn't overwritten by user set_input_data method won't copy input data.
         switch (prec) {
@@ -948,6 +1160,30 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
     }
 }
 
+void CLDNNInferRequest::PrepareBatchedInput(const cldnn::primitive_id &inputName, const BatchedBlob &inputBlob) {
+    // images are copied right into the input memory of the request, so the batch is not assembled in a host buffer
+    auto prec = inputBlob.getTensorDesc().getPrecision();
+    const bool toFloat = prec == Precision::I16 || prec == Precision::U16;
+    const cldnn::memory& memory = inputsMemory.at(toFloat ? inputName + fp32_suffix : inputName);
+    cldnn::pointer<uint8_t> ptr = memory.pointer<uint8_t>();
+    const size_t imageSize = memory.size() / inputBlob.size();
+    for (size_t b = 0; b < inputBlob.size(); b++) {
+        auto image = inputBlob.getBlob(b);
+        uint8_t* dst = ptr.data() + b * imageSize;
+        if (prec == Precision::I16) {
+            copyToFloat<int16_t>(reinterpret_cast<float*>(dst), image.get());
+        } else if (prec == Precision::U16) {
+            copyToFloat<uint16_t>(reinterpret_cast<float*>(dst), image.get());
+        } else {
+            if (image->byteSize() != imageSize) {
+                THROW_IE_EXCEPTION << "Size of batched blob item is not equal to the network input item size";
+            }
+            ie_memcpy(dst, imageSize, image->cbuffer().as<const uint8_t*>(), imageSize);
+        }
+    }
+    m_graph->GetNetwork()->set_input_data("input:" + inputName, memory);
+}
+
 void CLDNNInferRequest::PrepareInputDyn(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
     // now try to get execution results
     for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
@@ -9,6 +9,7 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <set>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include "cldnn_graph.h"
 #include <threading/ie_istreams_executor.hpp>
@@ -24,6 +25,8 @@ class CLDNNExecNetwork;
 
 class CLDNNInferRequest : public InferenceEngine::InferRequestInternal {
 public:
+    typedef std::shared_ptr<CLDNNInferRequest> Ptr;
+
     // make sure all blobs and cldnn::memory objects
     // are in place and valid
     void checkBlobs() override;
@@ -46,10 +49,31 @@ public:
     void EnableProfiling() { m_useProfiling = true; }
     void EnableStreams() { m_useStreams = true; }
 
+    // enqueues copies of the inputs set by user to the device, InferImpl executes the network after them
+    void UploadInputs();
+    InferenceEngine::ITaskExecutor::Ptr GetUploadExecutor() const { return uploadExecutor; }
+
+    // InferImpl is split into the stages of the asynchronous pipeline, so the stream executor is free
+    // to enqueue the next request while the outputs of the previous one are downloaded
+    void EnqueueInference();
+    void WaitInference();
+    InferenceEngine::ITaskExecutor::Ptr GetWaitExecutor() const { return waitExecutor; }
+
 protected:
     std::map<std::string, cldnn::memory> inputsMemory;
     std::map<std::string, cldnn::primitive_id> outputsMap;
 
+    // pipelined upload stuff
+    std::map<std::string, cldnn::memory> uploadMemory;
+    std::map<std::string, const uint8_t*> allocatedInputs;
+    std::vector<cldnn::event> uploadEvents;
+    std::set<std::string> uploadedInputs;
+    InferenceEngine::ITaskExecutor::Ptr uploadExecutor;
+
+    // asynchronous download stuff
+    std::vector<cldnn::event> downloadEvents;
+    InferenceEngine::ITaskExecutor::Ptr waitExecutor;
+
     bool m_useProfiling;
     bool m_useStreams;
     std::shared_ptr<CLDNNGraph> m_graph;
@@ -77,6 +101,7 @@ protected:
 
     void PrepareInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
     void PrepareInputDyn(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    void PrepareBatchedInput(const cldnn::primitive_id &inputName, const InferenceEngine::BatchedBlob &inputBlob);
 
 private:
     static const char fp32_suffix[];
@@ -64,6 +64,7 @@
 #include <api/grn.hpp>
 #include <api/ctc_greedy_decoder.hpp>
 #include <api/cum_sum.hpp>
+#include <api/attention.hpp>
 #include <api/embedding_bag.hpp>
 #include <api/extract_image_patches.hpp>
 
@@ -518,16 +519,15 @@ Program::Program(InferenceEngine::CNNNetwork& network, std::shared_ptr<const cld
     m_max_batch = config.max_dynamic_batch;
 
     if (config.max_dynamic_batch > 1) {
+        // Only programs required for the max batch are built here,
+        // programs for other batch sizes are built on the first request of them
+        m_network = network;
+        m_programs.resize(m_bv_sz);
         for (int b = m_bv_sz - 1; b >= 0; b--) {
-            inputLayouts.clear();
-            outputDims.clear();
-            primitiveIDs.clear();
-            blobMemCache.clear();
-
-            changeInputBatch(1U << static_cast<unsigned>(b));
-            m_programs.insert(m_programs.begin(), BuildProgram(network));
-            m_engine->release_pending_memory(0);
+            if (config.max_dynamic_batch & (1 << b))
+                m_programs[b] = BuildBatchProgram(b);
         }
+        ReleaseNetworkIfBuilt();
     } else {
         m_programs.emplace_back(BuildProgram(network));
         m_engine->release_pending_memory(0);
@@ -556,9 +556,38 @@ std::shared_ptr<cldnn::program> Program::getCompiledProgram(int program_id) {
     if (program_id >= m_programs.size())
         THROW_CLDNN_EXCEPTION("Invalid program ID");
 
+    std::lock_guard<std::mutex> lock(m_buildMutex);
+    if (m_programs[program_id] == nullptr) {
+        m_programs[program_id] = BuildBatchProgram(program_id);
+        ReleaseNetworkIfBuilt();
+    }
+
     return m_programs[program_id];
 }
 
+void Program::ReleaseNetworkIfBuilt() {
+    // The network keeps host copies of all the weights, which are already uploaded to the device
+    // by the built programs, so it is dropped as soon as no more programs can be requested
+    for (const auto& program : m_programs) {
+        if (program == nullptr)
+            return;
+    }
+    m_network = {};
+    blobMemCache.clear();
+}
+
+std::shared_ptr<cldnn::program> Program::BuildBatchProgram(int program_id) {
+    inputLayouts.clear();
+    outputDims.clear();
+    primitiveIDs.clear();
+    blobMemCache.clear();
+
+    changeInputBatch(1U << static_cast<unsigned>(program_id));
+    auto program = BuildProgram(m_network);
+    m_engine->release_pending_memory(0);
+    return program;
+}
+
 std::vector<InferenceEngine::CNNLayerPtr> Program::GetNextLayers(const InferenceEngine::DataPtr data) {
     std::vector<InferenceEngine::CNNLayerPtr> nextLayers;
     if (data == nullptr) {
@@ -613,6 +642,7 @@ std::shared_ptr<cldnn::program> Program::BuildProgram(InferenceEngine::CNNNetwor
     }
     options.set_option(cldnn::build_option::optimize_data(true));
     options.set_option(cldnn::build_option::tuning_config(m_config.tuningConfig));
+    options.set_option(cldnn::build_option::queue_hints(m_config.queuePriority, m_config.queueThrottle));
 
     cldnn::topology topology;
 
@@ -4678,6 +4708,9 @@ void Program::CreateGemmPrimitive(cldnn::topology& topology, InferenceEngine::CN
         ValidateLayer(layer, 2);
     }
 
+    if (!threeInputs && TryCreateFusedAttentionPrimitive(topology, layer))
+        return;
+
     auto inputPrimitives = GetPrevLayersPrimitives(layer);
     auto gemmLayer = as<InferenceEngine::GemmLayer*>(layer);
     auto gemmLayerName = layer_type_name_ID(layer);
@@ -4706,7 +4739,10 @@ void Program::CreateGemmPrimitive(cldnn::topology& topology, InferenceEngine::CN
 
         if (targetFormat.value != defaultFormatForDims(inputDimsN).value) {
             auto reorderName = gemmLayerName + "_cldnn_in" + std::to_string(i) + "_reorder";
-            auto targetDatatype = DataTypeFromPrecision(layer->precision);
+            auto inputPrecision = layer->insData[i].lock()->getPrecision();
+            // quantized inputs keep their precision to be consumed by int8 kernels
+            auto targetDatatype = (inputPrecision == InferenceEngine::Precision::U8 || inputPrecision == InferenceEngine::Precision::I8) ?
+                                  DataTypeFromPrecision(inputPrecision) : DataTypeFromPrecision(layer->precision);
             auto reorderPrim = cldnn::reorder(reorderName, inputPrimitives[i], targetFormat, targetDatatype);
 
             topology.add(reorderPrim);
@@ -4768,6 +4804,117 @@ void Program::CreateGemmPrimitive(cldnn::topology& topology, InferenceEngine::CN
 }
 
 
+bool Program::TryCreateFusedAttentionPrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer) {
+    // Matches Gemm(Q, K) -> [Power] -> [Eltwise sum with mask] -> SoftMax -> Gemm(V) ending with the given layer.
+    // The layers of the chain have been already added to the topology, they are trimmed by clDNN as unused.
+    // The fused kernel is a reference one, so the optimized gemm kernels are used unless the fusion is enabled.
+    if (!m_config.enable_fused_attention)
+        return false;
+
+    auto prevLayer = [](const InferenceEngine::CNNLayerPtr& l, size_t idx) {
+        return getCreatorLayer(l->insData[idx].lock()).lock();
+    };
+    auto isIntermediate = [&](const InferenceEngine::CNNLayerPtr& l) {
+        return l && l->outData.size() == 1 && getInputTo(l->outData[0]).size() == 1 &&
+               p_currentOutputs.find(l->name) == p_currentOutputs.end();
+    };
+    auto is4D = [](const InferenceEngine::DataPtr& data) {
+        return data->getTensorDesc().getDims().size() == 4;
+    };
+
+    auto valueGemm = as<InferenceEngine::GemmLayer*>(layer);
+    if (valueGemm->transpose_a || valueGemm->transpose_b || valueGemm->alpha != 1.f ||
+        !is4D(layer->insData[0].lock()) || !is4D(layer->insData[1].lock()) || !is4D(layer->outData[0]))
+        return false;
+
+    auto softmax = tryAs<InferenceEngine::SoftMaxLayer*>(prevLayer(layer, 0));
+    if (!softmax || !isIntermediate(prevLayer(layer, 0)) || (softmax->axis != 3 && softmax->axis != -1))
+        return false;
+
+    std::vector<InferenceEngine::CNNLayerPtr> chain = { prevLayer(layer, 0) };
+    auto current = prevLayer(chain.back(), 0);
+
+    InferenceEngine::CNNLayerPtr maskSum;
+    int maskInput = -1;
+    auto sum = tryAs<InferenceEngine::EltwiseLayer*>(current);
+    if (sum && isIntermediate(current)) {
+        if (sum->_operation != InferenceEngine::EltwiseLayer::Sum || sum->insData.size() != 2 || !sum->coeff.empty())
+            return false;
+        for (int i = 0; i < 2; i++) {
+            auto scoresIn = prevLayer(current, 1 - i);
+            if ((tryAs<InferenceEngine::PowerLayer*>(scoresIn) || tryAs<InferenceEngine::GemmLayer*>(scoresIn)) &&
+                isIntermediate(scoresIn))
+                maskInput = i;
+        }
+        if (maskInput < 0)
+            return false;
+
+        auto maskDims = current->insData[maskInput].lock()->getTensorDesc().getDims();
+        auto scoresDims = current->outData[0]->getTensorDesc().getDims();
+        if (maskDims.size() != 4 || maskDims[3] != scoresDims[3])
+            return false;
+        for (size_t i = 0; i < 3; i++) {
+            if (maskDims[i] != 1 && maskDims[i] != scoresDims[i])
+                return false;
+        }
+
+        maskSum = current;
+        chain.push_back(current);
+        current = prevLayer(current, 1 - maskInput);
+    }
+
+    float scale = 1.f;
+    auto power = tryAs<InferenceEngine::PowerLayer*>(current);
+    if (power && isIntermediate(current)) {
+        if (power->power != 1.f || power->offset != 0.f)
+            return false;
+        scale = power->scale;
+        chain.push_back(current);
+        current = prevLayer(current, 0);
+    }
+
+    auto scoresGemm = tryAs<InferenceEngine::GemmLayer*>(current);
+    if (!scoresGemm || !isIntermediate(current) || current->insData.size() != 2 || scoresGemm->transpose_a ||
+        !is4D(current->insData[0].lock()) || !is4D(current->insData[1].lock()))
+        return false;
+    scale *= scoresGemm->alpha;
+    chain.push_back(current);
+
+    // output of the fused primitive has precision of the query
+    if (current->insData[0].lock()->getPrecision() != layer->outData[0]->getPrecision())
+        return false;
+
+    // the kernel reads key and value with the batch and head of the query, Gemm broadcasting is not supported
+    auto queryDims = current->insData[0].lock()->getTensorDesc().getDims();
+    auto keyDims = current->insData[1].lock()->getTensorDesc().getDims();
+    auto valueDims = layer->insData[1].lock()->getTensorDesc().getDims();
+    for (size_t i = 0; i < 2; i++) {
+        if (keyDims[i] != queryDims[i] || valueDims[i] != queryDims[i])
+            return false;
+    }
+
+    auto scoresInputs = GetPrevLayersPrimitives(current);
+    auto valueInputs = GetPrevLayersPrimitives(layer);
+    std::string attentionLayerName = layer_type_name_ID(layer);
+
+    if (maskSum) {
+        auto maskInputs = GetPrevLayersPrimitives(maskSum);
+        topology.add(cldnn::attention(attentionLayerName, scoresInputs[0], scoresInputs[1], valueInputs[1],
+                                      maskInputs[maskInput], scale, scoresGemm->transpose_b));
+    } else {
+        topology.add(cldnn::attention(attentionLayerName, scoresInputs[0], scoresInputs[1], valueInputs[1],
+                                      scale, scoresGemm->transpose_b));
+    }
+
+    AddPrimitiveToProfiler(attentionLayerName, layer);
+    for (auto& fused : chain) {
+        InitProfileInfo(fused->name, fused->type, false, InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT);
+        primitivesToIRLayersMap[attentionLayerName].push_back(fused->name);
+    }
+
+    return true;
+}
+
 void Program::CreateReducePrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer) {
     ValidateLayer(layer, 2);
 
@@ -5676,8 +5823,6 @@ void Program::AddInputPrimitive(cldnn::topology& topology, InputInfo::Ptr inputI
     case MEAN_VALUE: {
         if (meanChannels > 0) {
             for (size_t c = 0; c < meanChannels; c++) {
-                if (fabs(preProcess[c]->stdScale - 1.0f) > 1e-10)
-                    THROW_CLDNN_EXCEPTION("not supporting stdScale yet in input " + inputName);
                 meanValues.push_back(preProcess[c]->meanValue);
             }
         }
@@ -5700,8 +5845,6 @@ void Program::AddInputPrimitive(cldnn::topology& topology, InputInfo::Ptr inputI
         meanBlob.allocate();
         auto meanBlobData = meanBlob.data();
         for (size_t c = 0; c < meanChannels; c++) {
-            if (fabs(preProcess[c]->stdScale - 1.0f) > 1e-10)
-                THROW_CLDNN_EXCEPTION("not supporting stdScale yet in input " + inputName);
             auto channelMeanBlob = std::dynamic_pointer_cast<TBlob<float>>(preProcess[c]->meanData);
             auto channelSize = channelMeanBlob->size();
             auto channelBlobData = channelMeanBlob->data();
@@ -5726,6 +5869,14 @@ void Program::AddInputPrimitive(cldnn::topology& topology, InputInfo::Ptr inputI
         break;
     }
 
+    // stdScale is applied by a scale primitive after the mean values are subtracted by the reorder
+    bool needScale = false;
+    for (size_t c = 0; c < meanChannels; c++) {
+        if (fabs(preProcess[c]->stdScale - 1.0f) > 1e-10)
+            needScale = true;
+    }
+    cldnn::primitive_id reorderPrimID = needScale ? preprocessPrimID + "_mean" : preprocessPrimID;
+
     if (ColorFormat::NV12 == preProcess.getColorFormat() && m_config.nv12_two_inputs) {
         // for NV12, create two input layouts with reorder instead of one,
         // and then would expect compound blob in inferRequest
@@ -5734,42 +5885,60 @@ void Program::AddInputPrimitive(cldnn::topology& topology, InputInfo::Ptr inputI
             THROW_CLDNN_EXCEPTION("Unsupported layout (" << l << ") or precision ("
                 << ip.name() << ") for NV12 input " + inputInfo->name());
         }
+        int batch = inputDims[0];
         int height = inputDims[2];
         int width = inputDims[3];
 
-        std::string y_name = inputName + "_Y";
-        std::string uv_name = inputName + "_UV";
-
-        cldnn::layout y_layout(DataTypeFromPrecision(ip),
-                                cldnn::format::nv12, { 1, 1, width, height });
-        cldnn::layout uv_layout(DataTypeFromPrecision(ip),
-                                cldnn::format::nv12, { 1, 2, width / 2, height / 2 });
-        auto inputY = cldnn::input_layout(y_name, y_layout);
-        auto inputUV = cldnn::input_layout(uv_name, uv_layout);
+        // each image of the batch is a separate surface (pair of Y and UV inputs), they are converted
+        // one by one and then concatenated, so a batch of surfaces is never copied to the host
+        cldnn::layout reorderLayout(networkInputLayout);
+        reorderLayout.size.batch[0] = 1;
+        std::vector<cldnn::primitive_id> batchPrimIDs;
+        for (int b = 0; b < batch; b++) {
+            std::string suffix = batch > 1 ? std::to_string(b) : "";
+            std::string y_name = inputName + "_Y" + suffix;
+            std::string uv_name = inputName + "_UV" + suffix;
+            cldnn::primitive_id batchPrimID = batch > 1 ? reorderPrimID + "_" + std::to_string(b) : reorderPrimID;
+
+            cldnn::layout y_layout(DataTypeFromPrecision(ip),
+                                    cldnn::format::nv12, { 1, 1, width, height });
+            cldnn::layout uv_layout(DataTypeFromPrecision(ip),
+                                    cldnn::format::nv12, { 1, 2, width / 2, height / 2 });
+            auto inputY = cldnn::input_layout(y_name, y_layout);
+            auto inputUV = cldnn::input_layout(uv_name, uv_layout);
+
+            topology.add(inputY);
+            inputLayouts.insert({ inputInfo->name() + "_Y" + suffix, y_layout });
+            topology.add(inputUV);
+            inputLayouts.insert({ inputInfo->name() + "_UV" + suffix, uv_layout });
+            switch (preProcess.getMeanVariant()) {
+            case NONE:
+            case MEAN_VALUE: {
+                topology.add(cldnn::reorder(batchPrimID, y_name, uv_name, reorderLayout, meanValues));
+                break;
+            }
+            case MEAN_IMAGE: {
+                topology.add(cldnn::reorder(batchPrimID, y_name, uv_name, reorderLayout, meanBlobID));
+                break;
+            }
+            default: THROW_CLDNN_EXCEPTION("Invalid mean variant in input " + inputName);
+                break;
+            }
 
-        topology.add(inputY);
-        inputLayouts.insert({ inputInfo->name() + "_Y", y_layout });
-        topology.add(inputUV);
-        inputLayouts.insert({ inputInfo->name() + "_UV", uv_layout });
-        switch (preProcess.getMeanVariant()) {
-        case NONE:
-        case MEAN_VALUE: {
-            topology.add(cldnn::reorder(preprocessPrimID, y_name, uv_name, networkInputLayout, meanValues));
-            break;
-        }
-        case MEAN_IMAGE: {
-            topology.add(cldnn::reorder(preprocessPrimID, y_name, uv_name, networkInputLayout, meanBlobID));
-            break;
-        }
-        default: THROW_CLDNN_EXCEPTION("Invalid mean variant in input " + inputName);
-            break;
+            primitivesToIRLayersMap[batchPrimID] = { inputInfo->name() };
+            primitivesToIRLayersMap[y_name] = { inputInfo->name() };
+            primitivesToIRLayersMap[uv_name] = { inputInfo->name() };
+            profilingIDs.push_back(batchPrimID);
+            InitProfileInfo(batchPrimID, "Reorder");
+            batchPrimIDs.push_back(batchPrimID);
         }
 
-        primitivesToIRLayersMap[preprocessPrimID] = { inputInfo->name() };
-        primitivesToIRLayersMap[y_name] = { inputInfo->name() };
-        primitivesToIRLayersMap[uv_name] = { inputInfo->name() };
-        profilingIDs.push_back(preprocessPrimID);
-        InitProfileInfo(preprocessPrimID, "Reorder");
+        if (batch > 1) {
+            topology.add(cldnn::concatenation(reorderPrimID, batchPrimIDs, cldnn::concatenation::along_b));
+            primitivesToIRLayersMap[reorderPrimID] = { inputInfo->name() };
+            profilingIDs.push_back(reorderPrimID);
+            InitProfileInfo(reorderPrimID, "Concat");
+        }
     } else {
         cldnn::layout inputLayout(networkInputLayout);
         inputLayout.data_type = DataTypeFromPrecision(ip);
@@ -5781,11 +5950,11 @@ void Program::AddInputPrimitive(cldnn::topology& topology, InputInfo::Ptr inputI
         switch (preProcess.getMeanVariant()) {
         case NONE:
         case MEAN_VALUE: {
-            topology.add(cldnn::reorder(preprocessPrimID, inputName, networkInputLayout, meanValues));
+            topology.add(cldnn::reorder(reorderPrimID, inputName, networkInputLayout, meanValues));
             break;
         }
         case MEAN_IMAGE: {
-            topology.add(cldnn::reorder(preprocessPrimID,
+            topology.add(cldnn::reorder(reorderPrimID,
                 inputName,
                 networkInputLayout,
                 meanBlobID));
@@ -5794,9 +5963,26 @@ void Program::AddInputPrimitive(cldnn::topology& topology, InputInfo::Ptr inputI
         default: THROW_CLDNN_EXCEPTION("Invalid mean variant in input " + inputName);
             break;
         }
-        InitProfileInfo(preprocessPrimID, "reorder");
-        primitiveIDs[preprocessPrimID] = preprocessPrimID;
+        InitProfileInfo(reorderPrimID, "reorder");
+        primitiveIDs[reorderPrimID] = reorderPrimID;
+        profilingIDs.push_back(reorderPrimID);
+    }
+
+    if (needScale) {
+        auto scaleBlob = make_shared_blob<float>(TensorDesc(Precision::FP32, { 1, meanChannels, 1, 1 }, Layout::NCHW));
+        scaleBlob->allocate();
+        auto scaleData = scaleBlob->buffer().as<float*>();
+        for (size_t c = 0; c < meanChannels; c++)
+            scaleData[c] = 1.0f / preProcess[c]->stdScale;
+
+        cldnn::layout scaleLayout(cldnn::data_types::f32, m_defaultFormat,
+                                  cldnn::tensor(1, TensorValue(meanChannels), 1, 1));
+        auto scalePrimID = CreatePrimitiveFromBlob(topology, inputName + m_scalesTag, scaleBlob, scaleLayout);
+        topology.add(cldnn::scale(preprocessPrimID, reorderPrimID, scalePrimID,
+                                  cldnn::optional_data_type{networkInputLayout.data_type}));
+        primitivesToIRLayersMap[preprocessPrimID] = { inputInfo->name() };
         profilingIDs.push_back(preprocessPrimID);
+        InitProfileInfo(preprocessPrimID, "ScaleShift");
     }
 
     primitiveIDs[inputName] = preprocessPrimID;
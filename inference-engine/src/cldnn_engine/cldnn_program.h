@@ -11,6 +11,7 @@
 #include <string>
 #include <utility>
 #include <algorithm>
+#include <mutex>
 
 #include <cpp/ie_cnn_network.h>
 #include <legacy/ie_layers.h>
@@ -86,6 +87,7 @@ public:
 class Program {
 public:
     Program(InferenceEngine::CNNNetwork &network, std::shared_ptr<const cldnn::engine> engine, const Config& config);
+    // For dynamic batch returns program for batch 2^program_id, building it on first request
     std::shared_ptr<cldnn::program> getCompiledProgram(int program_id = 0);
 
     std::map<std::string, cldnn::primitive_id> primitiveIDs;
@@ -240,8 +242,13 @@ private:
     std::vector<std::shared_ptr<cldnn::program>> m_programs;
     std::shared_ptr<const cldnn::engine> m_engine;
     Config m_config;
+    // Network is kept for dynamic batch only, to build programs for other batch sizes on demand
+    InferenceEngine::CNNNetwork m_network;
+    std::mutex m_buildMutex;
 
     std::shared_ptr<cldnn::program> BuildProgram(InferenceEngine::CNNNetwork &network);
+    std::shared_ptr<cldnn::program> BuildBatchProgram(int program_id);
+    void ReleaseNetworkIfBuilt();
 
     void InitProfileInfo(const std::string& layerName,
                          const std::string& layerType,
@@ -378,6 +385,7 @@ private:
     void CreateBinaryConvolutionPrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer);
     void CreateQuantizePrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer);
     void CreateGemmPrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer);
+    bool TryCreateFusedAttentionPrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer);
     void CreateReducePrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer);
     void CreateOneHotPrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer);
     void CreateGatherTreePrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer);
@@ -35,6 +35,24 @@ ParamMap CLDNNRemoteBlobImpl::getParams() const {
             { GPU_PARAM_KEY(OCL_CONTEXT), params.context },
             { GPU_PARAM_KEY(MEM_HANDLE),  params.mem }
         };
+    case BT_USM_HOST_INTERNAL:
+        return{
+            { GPU_PARAM_KEY(SHARED_MEM_TYPE), GPU_PARAM_VALUE(USM_HOST_BUFFER) },
+            { GPU_PARAM_KEY(OCL_CONTEXT), params.context },
+            { GPU_PARAM_KEY(MEM_HANDLE),  params.mem }
+        };
+    case BT_USM_SHARED_INTERNAL:
+        return{
+            { GPU_PARAM_KEY(SHARED_MEM_TYPE), GPU_PARAM_VALUE(USM_SHARED_BUFFER) },
+            { GPU_PARAM_KEY(OCL_CONTEXT), params.context },
+            { GPU_PARAM_KEY(MEM_HANDLE),  params.mem }
+        };
+    case BT_USM_DEVICE_INTERNAL:
+        return{
+            { GPU_PARAM_KEY(SHARED_MEM_TYPE), GPU_PARAM_VALUE(USM_DEVICE_BUFFER) },
+            { GPU_PARAM_KEY(OCL_CONTEXT), params.context },
+            { GPU_PARAM_KEY(MEM_HANDLE),  params.mem }
+        };
 #ifdef WIN32
     case BT_DX_BUF_SHARED:
         return{
@@ -65,6 +83,19 @@ ParamMap CLDNNRemoteBlobImpl::getParams() const {
     }
 }
 
+cldnn::allocation_type CLDNNRemoteBlobImpl::to_allocation_type(BlobType mem_type) {
+    switch (mem_type) {
+    case BT_USM_HOST_INTERNAL:
+        return cldnn::allocation_type::usm_host;
+    case BT_USM_SHARED_INTERNAL:
+        return cldnn::allocation_type::usm_shared;
+    case BT_USM_DEVICE_INTERNAL:
+        return cldnn::allocation_type::usm_device;
+    default:
+        return cldnn::allocation_type::cl_mem;
+    }
+}
+
 bool CLDNNRemoteBlobImpl::deallocate() noexcept {
     if (m_memObject != nullptr)
         m_memObject.reset();
@@ -87,7 +118,11 @@ void CLDNNRemoteBlobImpl::allocate_if_needed() {
         auto eng = _impl->GetEngine();
         switch (m_mem_type) {
         case BlobType::BT_BUF_INTERNAL:
-            m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::allocate(*eng, m_layout)));
+        case BlobType::BT_USM_HOST_INTERNAL:
+        case BlobType::BT_USM_SHARED_INTERNAL:
+        case BlobType::BT_USM_DEVICE_INTERNAL:
+            m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(
+                cldnn::memory::allocate(*eng, m_layout, to_allocation_type(m_mem_type))));
             break;
         case BlobType::BT_BUF_SHARED:
             m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_buffer(*eng, m_layout, m_mem)));
@@ -122,7 +157,11 @@ void CLDNNRemoteBlobImpl::allocate() noexcept {
 
     switch (m_mem_type) {
     case BlobType::BT_BUF_INTERNAL:
-        m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::allocate(*eng, m_layout)));
+    case BlobType::BT_USM_HOST_INTERNAL:
+    case BlobType::BT_USM_SHARED_INTERNAL:
+    case BlobType::BT_USM_DEVICE_INTERNAL:
+        m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(
+            cldnn::memory::allocate(*eng, m_layout, to_allocation_type(m_mem_type))));
         break;
     case BlobType::BT_BUF_SHARED:
         m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_buffer(*eng, m_layout, m_mem)));
@@ -163,6 +202,11 @@ std::shared_ptr<RemoteContext> CLDNNRemoteBlobImpl::getContext() const noexcept
 }
 
 void CLDNNRemoteBlobImpl::lock() const {
+    // device USM is not accessible by host, so there is nothing to map
+    if (m_mem_type == BT_USM_DEVICE_INTERNAL) {
+        _handle = nullptr;
+        return;
+    }
     lockedHolder = std::unique_ptr<cldnn::pointer<uint8_t>>(new cldnn::pointer<uint8_t>(m_memObject->pointer<uint8_t>()));
     auto ptr = lockedHolder->data();
     _handle = reinterpret_cast<void*>(ptr);
@@ -263,7 +307,10 @@ CLDNNExecutionContextImpl::CLDNNExecutionContextImpl(const std::shared_ptr<IInfe
             m_config.queueThrottle,
             m_config.memory_pool_on,
             m_config.throughput_streams,
-            m_config.kernels_cache_dir));
+            m_config.kernels_cache_dir,
+            "cache.json",
+            m_config.mem_pool_cache_limit,
+            m_config.out_of_order_queue));
 }
 
 ParamMap CLDNNExecutionContextImpl::getParams() const {
@@ -38,6 +38,9 @@ public:
         BT_IMG_SHARED,
         BT_SURF_SHARED,
         BT_DX_BUF_SHARED,
+        BT_USM_HOST_INTERNAL,
+        BT_USM_SHARED_INTERNAL,
+        BT_USM_DEVICE_INTERNAL,
     };
 
     explicit CLDNNRemoteBlobImpl(gpu::ClContext::Ptr context,
@@ -65,6 +68,8 @@ public:
     void allocate_if_needed();
     cldnn::memory& getMemory() { return *m_memObject; }
 
+    static cldnn::allocation_type to_allocation_type(BlobType mem_type);
+
 protected:
     static CLDNNRemoteAllocator m_allocator;
     std::weak_ptr<gpu::ClContext> m_context;
@@ -123,6 +128,7 @@ protected:
 
 using CLDNNRemoteCLbuffer = typedCLDNNRemoteBlob<gpu::ClBufferBlob>;
 using CLDNNRemoteCLImage2D = typedCLDNNRemoteBlob<gpu::ClImage2DBlob>;
+using CLDNNRemoteUSMbuffer = typedCLDNNRemoteBlob<gpu::USMBlob>;
 #ifdef WIN32
 using CLDNNRemoteD3DBuffer = typedCLDNNRemoteBlob<gpu::D3DBufferBlob>;
 using CLDNNRemoteD3DSurface = typedCLDNNRemoteBlob<gpu::D3DSurface2DBlob>;
@@ -154,6 +160,10 @@ inline CLDNNRemoteBlobImpl* getBlobImpl(gpu::ClBlob* blobPtr) {
         auto ptr = blobPtr->as<CLDNNRemoteCLImage2D>();
         if (ptr) return ptr->getImpl();
     }
+    {
+        auto ptr = blobPtr->as<CLDNNRemoteUSMbuffer>();
+        if (ptr) return ptr->getImpl();
+    }
     return nullptr;
 }
 
@@ -366,6 +376,23 @@ class typedCLDNNExecutionContext : public TpublicContextAPI,
             CLDNNRemoteBlobImpl::BlobType::BT_BUF_INTERNAL);
     }
 
+    RemoteBlob::Ptr create_usm(const TensorDesc& tensorDesc, CLDNNRemoteBlobImpl::BlobType blob_type) {
+        cldnn::allocation_type alloc_type = CLDNNRemoteBlobImpl::to_allocation_type(blob_type);
+        if (!_impl.GetEngine()->supports_allocation(alloc_type))
+            THROW_IE_EXCEPTION << "Requested USM allocation type is not supported by the device";
+
+        cldnn::layout layout(DataTypeFromPrecision(tensorDesc.getPrecision()),
+            FormatFromLayout(tensorDesc.getLayout()),
+            CldnnTensorFromIEDims(tensorDesc.getDims()));
+        auto smart_this = std::dynamic_pointer_cast<gpu::ClContext>
+            (std::enable_shared_from_this<typedCLDNNExecutionContext<TpublicContextAPI>>::shared_from_this());
+        return std::make_shared<CLDNNRemoteUSMbuffer>(smart_this,
+            tensorDesc,
+            layout,
+            nullptr, 0, 0,
+            blob_type);
+    }
+
     void check_if_shared() {
         if (GetType() != CLDNNExecutionContextImpl::ContextType::DEV_SHARED)
             THROW_IE_EXCEPTION << "Shared context is required to to share this type of memory";
@@ -393,6 +420,12 @@ public:
             if (GPU_PARAM_VALUE(VA_SURFACE) == memTypeStr) {
                 check_if_shared();
                 return reuse_surf(tensorDesc, params);
+            } else if (GPU_PARAM_VALUE(USM_HOST_BUFFER) == memTypeStr) {
+                return create_usm(tensorDesc, CLDNNRemoteBlobImpl::BlobType::BT_USM_HOST_INTERNAL);
+            } else if (GPU_PARAM_VALUE(USM_SHARED_BUFFER) == memTypeStr) {
+                return create_usm(tensorDesc, CLDNNRemoteBlobImpl::BlobType::BT_USM_SHARED_INTERNAL);
+            } else if (GPU_PARAM_VALUE(USM_DEVICE_BUFFER) == memTypeStr) {
+                return create_usm(tensorDesc, CLDNNRemoteBlobImpl::BlobType::BT_USM_DEVICE_INTERNAL);
             } else {
                 CLDNNRemoteBlobImpl::BlobType blob_type;
                 cldnn::shared_handle mem = nullptr;
@@ -9,6 +9,8 @@
 namespace GNAPluginNS {
 struct GNAFlags {
     uint8_t gna_lib_async_threads_num = 1;
+    uint8_t coalesced_requests_num = 1;
+    uint8_t device_pool_size = 1;
 
     bool compact_mode = false;
     bool exclusive_async_requests = false;
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <details/ie_exception.hpp>
@@ -16,6 +17,26 @@
 #define QUANTWARNING(...)
 #endif
 
+namespace {
+/**
+ * @brief rounds scaled values half away from zero and saturates them to the range of T,
+ * the loop has no branches so the compiler vectorizes it
+ * @return number of saturated values
+ */
+template <typename T>
+uint32_t QuantizeRow(const float *ptr_float, T *ptr_int, uint32_t num_elements, float scale_factor) {
+    const float max_value = std::numeric_limits<T>::max();
+    const float min_value = std::numeric_limits<T>::min();
+    uint32_t num_saturate = 0;
+    for (uint32_t i = 0; i < num_elements; i++) {
+        const float rounding_value = (ptr_float[i] > 0) ? 0.5f : -0.5f;
+        const float value = ptr_float[i] * scale_factor + rounding_value;
+        num_saturate += (value > max_value) | (value < min_value);
+        ptr_int[i] = static_cast<T>(std::min(std::max(value, min_value), max_value));
+    }
+    return num_saturate;
+}
+}  // namespace
 
 template<>
 void QuantizationCallback<int16_t, int32_t>::runFakeQuantize() const {
@@ -122,21 +143,10 @@ void QuantizationCallback<int16_t, int32_t>::runQuantize() const {
         *ptr_output_scale_factor = input_scale_factor * *ptr_weight_scale_factor;
     }
 
+    const float weight_scale_factor = *ptr_weight_scale_factor;
     for (uint32_t row = 0; row < num_rows; row++) {
-        for (uint32_t col = 0; col < num_columns; col++) {
-            float rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
-            float value = ptr_float_weights[row * num_columns + col] * *ptr_weight_scale_factor + rounding_value;
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            if (value > 32767.0) {
-                *ptr_weight_16 = 32767;
-                num_saturate++;
-            } else if (value < -32768.0) {
-                *ptr_weight_16 = -32768;
-                num_saturate++;
-            } else {
-                *ptr_weight_16 = (int16_t) value;
-            }
-        }
+        num_saturate += QuantizeRow(ptr_float_weights + row * num_columns, ptr_int_weights + row * num_columns_padded,
+                                    num_columns, weight_scale_factor);
         for (uint32_t col = num_columns; col < num_columns_padded; col++) {
             int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
             *ptr_weight_16 = 0;
@@ -201,19 +211,7 @@ void QuantizeVector16(float *ptr_float_memory, int16_t *ptr_int_memory, uint32_t
     uint32_t num_saturate = 0;
 
     int16_t *ptr_int_feat = reinterpret_cast<int16_t *>(ptr_int_memory);
-    for (uint32_t i = 0; i < num_elements; i++) {
-        float rounding_value = (ptr_float_feat[i] > 0) ? 0.5f : -0.5f;
-        float value = ptr_float_feat[i] * scale_factor + rounding_value;
-        if (value > 32767.0) {
-            ptr_int_feat[i] = 32767;
-            num_saturate++;
-        } else if (value < -32768.0) {
-            ptr_int_feat[i] = -32768;
-            num_saturate++;
-        } else {
-            ptr_int_feat[i] = (int16_t) value;
-        }
-    }
+    num_saturate += QuantizeRow(ptr_float_feat, ptr_int_feat, num_elements, scale_factor);
 
     if (num_saturate > 0) {
         QUANTWARNING("Warning:  %d / %d saturations during QuantizeVector16()\n", num_saturate, num_elements);
@@ -343,36 +341,19 @@ void QuantizationCallback<int8_t, gna_compound_bias_t>::runQuantize() const {
         *ptr_weight_scale_factor = MAX_OUT_MULTIPLIER * *ptr_weight_scale_factor;  //  increase dynamic range by max multiplier
         *ptr_output_scale_factor = input_scale_factor * *ptr_weight_scale_factor;
     }
-    float valueAcc = 0.0;
+    // int8_t stores may alias the scale factor, so it is read once
+    const float weight_scale_factor = *ptr_weight_scale_factor;
     for (uint32_t row = 0; row < num_rows; row++) {
+        const float *ptr_row = ptr_float_weights + row * num_columns;
         float scaled_row_max = 0;
-        float rounding_value, value;
         for (uint32_t col = 0; col < num_columns; col++) {
-            value = ptr_float_weights[row*num_columns + col] * *ptr_weight_scale_factor;
-            valueAcc += value;
-            if (fabs(value) > scaled_row_max) {
-                scaled_row_max = fabs(value);
-            }
+            scaled_row_max = std::max(scaled_row_max, std::fabs(ptr_row[col] * weight_scale_factor));
         }
 
-        value = scaled_row_max / static_cast<float>(MAX_VAL_1B_WEIGHT);
+        float value = scaled_row_max / static_cast<float>(MAX_VAL_1B_WEIGHT);
         ptr_int_biases[row].multiplier = (uint8_t) (value + 0.5);
-        for (uint32_t col = 0; col < num_columns; col++) {
-            int8_t *ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
-            rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
-
-
-            value = ptr_float_weights[row * num_columns + col] * (*ptr_weight_scale_factor / ptr_int_biases[row].multiplier) + rounding_value;
-            if (value > 127.0) {
-                *ptr_weight_8 = 127;
-                num_saturate++;
-            } else if (value < -128.0) {
-                *ptr_weight_8 = -128;
-                num_saturate++;
-            } else {
-                *ptr_weight_8 = (int8_t) value;
-            }
-        }
+        num_saturate += QuantizeRow(ptr_row, ptr_int_weights + row * num_columns_padded, num_columns,
+                                    weight_scale_factor / ptr_int_biases[row].multiplier);
         for (uint32_t col = num_columns; col < num_columns_padded; col++) {
             int8_t *ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
             *ptr_weight_8 = 0;
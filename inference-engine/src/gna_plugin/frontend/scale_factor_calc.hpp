@@ -10,6 +10,7 @@
 #include <limits>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include <legacy/ie_layers.h>
 #include "gna_upstream_iterator.hpp"
@@ -709,11 +710,16 @@ class ScaleFactorCalculator {
     mutable Cnt::const_iterator idx;
     mutable bool needRestart = false;
     int weightsBytesSize;
+    // positions of the layers in the sorted net, restarts don't search for the layer
+    std::unordered_map<const InferenceEngine::CNNLayer*, size_t> positions;
 
  public:
     ScaleFactorCalculator(Cnt &net, int weightsBytesSize)
             : net(net), weightsBytesSize(weightsBytesSize) {
         idx = std::begin(this->net);
+        for (size_t i = 0; i < this->net.size(); i++) {
+            positions.emplace(this->net[i].get(), i);
+        }
     }
     bool needToRestart() const {
         return needRestart;
@@ -736,14 +742,11 @@ class ScaleFactorCalculator {
             return true;
         }
 
-        idx = std::find_if(net.begin(), net.end(), [&](InferenceEngine::CNNLayerPtr cnnLayer) {
-            if (!result) {
-                return result.restartLayer == cnnLayer.get();
-            }
-            return ptr == cnnLayer.get();
-        });
-        if (idx != net.end()) {
-            idx++;
+        auto position = positions.find(result.restartLayer);
+        if (position != positions.end()) {
+            idx = net.begin() + position->second + 1;
+        } else {
+            idx = net.end();
         }
         needRestart = true;
         return true;
@@ -154,8 +154,15 @@ uint32_t GNADeviceHelper::getNumberOfGnaDevices() {
     return numberOfGnaDevices;
 }
 
-uint32_t GNADeviceHelper::selectGnaDevice() {
+uint32_t GNADeviceHelper::selectGnaDevice(int32_t requestedIndex) {
     const auto deviceCount = getNumberOfGnaDevices();
+    if (requestedIndex >= 0) {
+        if (static_cast<uint32_t>(requestedIndex) >= deviceCount) {
+            THROW_GNA_EXCEPTION << "GNA device " << requestedIndex << " is not available, number of GNA devices detected = "
+                                << deviceCount;
+        }
+        return static_cast<uint32_t>(requestedIndex);
+    }
     if (deviceCount != 1) {
         THROW_GNA_EXCEPTION << "Unsupported number of GNA devices detected = " << deviceCount;
     }
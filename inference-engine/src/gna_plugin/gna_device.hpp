@@ -77,10 +77,11 @@ public:
     explicit GNADeviceHelper(Gna2DeviceVersion gna2HwConsistency = Gna2DeviceVersionSoftwareEmulation,
          uint8_t lib_async_n_threads = 1,
          bool use_openmp = false,
-         bool isPerformanceMeasuring = false) :
+         bool isPerformanceMeasuring = false,
+         int32_t deviceIndex = -1) :
          gna2HwConsistency(gna2HwConsistency),
          isPerformanceMeasuring(isPerformanceMeasuring),
-         nGnaDeviceIndex{selectGnaDevice()} {
+         nGnaDeviceIndex{selectGnaDevice(deviceIndex)} {
 #endif
         open(lib_async_n_threads);
         initGnaPerfCounters();
@@ -123,7 +124,10 @@ public:
     void releaseModel(const uint32_t model_id);
     uint32_t createRequestConfig(const uint32_t model_id);
     static uint32_t getNumberOfGnaDevices();
-    static uint32_t selectGnaDevice();
+    /**
+     * @brief returns requested device index if it is available, negative index means the only device of the host
+     */
+    static uint32_t selectGnaDevice(int32_t requestedIndex);
     bool hasGnaHw() const {
         return Gna2DeviceVersionSoftwareEmulation != detectedGnaDevVersion;
     }
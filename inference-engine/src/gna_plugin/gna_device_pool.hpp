@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "gna_plugin.hpp"
+
+namespace GNAPluginNS {
+
+/**
+ * @brief Set of plugin instances holding the same network, each loaded to its own GNA device.
+ * Keeps number of inferences in flight per device to dispatch new inferences to the least loaded one.
+ */
+class GNADevicePool {
+ public:
+    static constexpr size_t ANY_DEVICE = static_cast<size_t>(-1);
+
+    GNADevicePool(std::vector<std::shared_ptr<GNAPlugin>> plugins, bool pinRequests)
+        : plugins(std::move(plugins)), pinRequests(pinRequests), inFlight(this->plugins.size(), 0) {}
+
+    size_t Size() const {
+        return plugins.size();
+    }
+
+    const std::shared_ptr<GNAPlugin>& Get(size_t idx) const {
+        return plugins.at(idx);
+    }
+
+    /**
+     * @brief networks with memory states need every request to stay on one device
+     */
+    bool PinsRequests() const {
+        return pinRequests;
+    }
+
+    /**
+     * @brief device for a new request, distributed in round-robin order
+     */
+    size_t Pin() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return nextPinned++ % plugins.size();
+    }
+
+    /**
+     * @brief reserves device for one inference, ANY_DEVICE selects the device with fewest inferences in flight
+     */
+    size_t Acquire(size_t idx = ANY_DEVICE) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (idx == ANY_DEVICE) {
+            idx = std::distance(inFlight.begin(), std::min_element(inFlight.begin(), inFlight.end()));
+        }
+        inFlight.at(idx)++;
+        return idx;
+    }
+
+    void Release(size_t idx) {
+        std::lock_guard<std::mutex> lock(mutex);
+        inFlight.at(idx)--;
+    }
+
+ private:
+    std::vector<std::shared_ptr<GNAPlugin>> plugins;
+    bool pinRequests;
+    std::mutex mutex;
+    std::vector<uint32_t> inFlight;
+    size_t nextPinned = 0;
+};
+
+}  // namespace GNAPluginNS
@@ -11,6 +11,7 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 #include "gna_infer_request.hpp"
 #include "gna_plugin.hpp"
+#include "gna_mapped_file.hpp"
 #include <gna/gna_config.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_async_only.hpp>
@@ -19,15 +20,55 @@ namespace GNAPluginNS {
 
 class GNAExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeAsyncOnly {
     std::shared_ptr<GNAPlugin> plg;
+    std::shared_ptr<GNARequestCoalescer> coalescer;
+    std::shared_ptr<GNADevicePool> pool;
+
+    void LoadDevicePool(InferenceEngine::CNNNetwork &network, uint32_t poolSize) {
+        std::vector<std::shared_ptr<GNAPlugin>> plugins{plg};
+        for (uint32_t i = 1; i < poolSize; i++) {
+            plugins.push_back(std::make_shared<GNAPlugin>(plg->GetConfigMap()));
+        }
+        for (uint32_t i = 0; i < poolSize; i++) {
+            // every device compiles its own copy, LoadNetwork modifies the network it is given
+            InferenceEngine::CNNNetwork deviceNetwork(InferenceEngine::cloneNetwork(network));
+            plugins[i]->SetDeviceIndex(i);
+            plugins[i]->LoadNetwork(deviceNetwork);
+        }
+
+        IE_SUPPRESS_DEPRECATED_START
+        bool hasStates = !plg->QueryState().empty();
+        IE_SUPPRESS_DEPRECATED_END
+        pool = std::make_shared<GNADevicePool>(plugins, hasStates);
+    }
+
+    void LoadCoalescedNetwork(InferenceEngine::CNNNetwork &network, uint32_t framesNum) {
+        if (network.getBatchSize() != 1) {
+            THROW_GNA_EXCEPTION << GNA_CONFIG_KEY(COALESCE_N_REQUESTS) << " requires network with batch 1, but batch is "
+                                << network.getBatchSize();
+        }
+
+        // requests keep single frame, the plugin propagates all coalesced frames at once
+        InferenceEngine::CNNNetwork batchedNetwork(InferenceEngine::cloneNetwork(network));
+        batchedNetwork.setBatchSize(framesNum);
+        plg->LoadNetwork(batchedNetwork);
+
+        IE_SUPPRESS_DEPRECATED_START
+        if (!plg->QueryState().empty()) {
+            THROW_GNA_EXCEPTION << GNA_CONFIG_KEY(COALESCE_N_REQUESTS) << " is not supported for networks with memory layers";
+        }
+        IE_SUPPRESS_DEPRECATED_END
+
+        auto requestConfigsNum = std::stoul(plg->GetConfig(GNA_CONFIG_KEY(LIB_N_THREADS), {}).as<std::string>());
+        coalescer = std::make_shared<GNARequestCoalescer>(plg, framesNum, requestConfigsNum,
+                                                          network.getInputsInfo(), network.getOutputsInfo());
+    }
 
  public:
      GNAExecutableNetwork(const std::string& aotFileName, std::shared_ptr<GNAPlugin> plg)
          : plg(plg) {
-         std::fstream inputStream(aotFileName, std::ios_base::in | std::ios_base::binary);
-         if (inputStream.fail()) {
-             THROW_GNA_EXCEPTION << "Cannot open file to import model: " << aotFileName;
-         }
-
+         // mapped file is copied straight into GNA memory without buffering whole model in the stream
+         MappedFile modelFile(aotFileName);
+         std::istream inputStream(&modelFile);
          plg->ImportNetwork(inputStream);
          _networkInputs = plg->GetInputs();
          _networkOutputs = plg->GetOutputs();
@@ -42,7 +83,19 @@ class GNAExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafe
 
     GNAExecutableNetwork(InferenceEngine::CNNNetwork &network, std::shared_ptr<GNAPlugin> plg)
         : plg(plg) {
-        plg->LoadNetwork(network);
+        auto framesNum = std::stoul(plg->GetConfig(GNA_CONFIG_KEY(COALESCE_N_REQUESTS), {}).as<std::string>());
+        auto poolSize = std::stoul(plg->GetConfig(GNA_CONFIG_KEY(DEVICE_POOL_SIZE), {}).as<std::string>());
+        if (framesNum > 1 && poolSize > 1) {
+            THROW_GNA_EXCEPTION << GNA_CONFIG_KEY(COALESCE_N_REQUESTS) << " and " << GNA_CONFIG_KEY(DEVICE_POOL_SIZE)
+                                << " cannot be used together";
+        }
+        if (framesNum > 1) {
+            LoadCoalescedNetwork(network, framesNum);
+        } else if (poolSize > 1) {
+            LoadDevicePool(network, poolSize);
+        } else {
+            plg->LoadNetwork(network);
+        }
     }
 
     GNAExecutableNetwork(const std::string& aotFileName, const std::map<std::string, std::string>& config)
@@ -56,7 +109,7 @@ class GNAExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafe
     InferenceEngine::AsyncInferRequestInternal::Ptr
         CreateAsyncInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                     InferenceEngine::OutputsDataMap networkOutputs) override {
-        return std::make_shared<GNAInferRequest>(plg, networkInputs, networkOutputs);
+        return std::make_shared<GNAInferRequest>(plg, networkInputs, networkOutputs, coalescer, pool);
     }
 
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
@@ -103,7 +156,13 @@ class GNAExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafe
 
         std::map<std::string, std::string> configForPlugin;
         configForPlugin[KEY_GNA_DEVICE_MODE] = new_mode;
-        plg->SetConfig(configForPlugin);
+        if (pool) {
+            for (size_t i = 0; i < pool->Size(); i++) {
+                pool->Get(i)->SetConfig(configForPlugin);
+            }
+        } else {
+            plg->SetConfig(configForPlugin);
+        }
     }
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override {
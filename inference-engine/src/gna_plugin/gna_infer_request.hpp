@@ -11,19 +11,48 @@
 #include "cpp_interfaces/impl/ie_infer_async_request_internal.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
 #include "gna_plugin.hpp"
+#include "gna_request_coalescer.hpp"
+#include "gna_device_pool.hpp"
 
 namespace GNAPluginNS {
 
 class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
  protected:
     std::shared_ptr<GNAPlugin> plg;
+    std::shared_ptr<GNARequestCoalescer> coalescer;
+    std::shared_ptr<GNADevicePool> pool;
+    // device of the pool the request is pinned to, or the device of the last inference
+    size_t poolIdx = GNADevicePool::ANY_DEVICE;
+    bool poolAcquired = false;
     uint32_t inferRequestIdx = -1;
 
+    void AcquireDevice() {
+        if (pool) {
+            poolIdx = pool->Acquire(pool->PinsRequests() ? poolIdx : GNADevicePool::ANY_DEVICE);
+            poolAcquired = true;
+            plg = pool->Get(poolIdx);
+        }
+    }
+
+    void ReleaseDevice() {
+        if (poolAcquired) {
+            pool->Release(poolIdx);
+            poolAcquired = false;
+        }
+    }
+
  public:
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
                     InferenceEngine::InputsDataMap networkInputs,
-                    InferenceEngine::OutputsDataMap networkOutputs)
-        : InferenceEngine::AsyncInferRequestInternal(networkInputs, networkOutputs), plg(plg) {
+                    InferenceEngine::OutputsDataMap networkOutputs,
+                    const std::shared_ptr<GNARequestCoalescer>& coalescer = nullptr,
+                    const std::shared_ptr<GNADevicePool>& pool = nullptr)
+        : InferenceEngine::AsyncInferRequestInternal(networkInputs, networkOutputs), plg(plg), coalescer(coalescer),
+          pool(pool) {
+        if (pool && pool->PinsRequests()) {
+            poolIdx = pool->Pin();
+            this->plg = pool->Get(poolIdx);
+        }
         // TODO: internal connection API - better to generalize
         if (networkOutputs.empty()) {
             THROW_GNA_EXCEPTION << "GNAInferRequest :: network has zero outputs";
@@ -32,6 +61,19 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
             THROW_GNA_EXCEPTION << "GNAInferRequest :: network has zero inputs";
         }
 
+        if (coalescer) {
+            // plugin blobs have all coalesced frames, request keeps only its own frame
+            for (auto output : _networkOutputs) {
+                _outputs[output.first] = make_blob_with_precision(output.second->getTensorDesc());
+                _outputs[output.first]->allocate();
+            }
+            for (auto input : _networkInputs) {
+                _inputs[input.first] = make_blob_with_precision(input.second->getTensorDesc());
+                _inputs[input.first]->allocate();
+            }
+            return;
+        }
+
         // copy inputs blobs since we need to have them in separate address space to allow simultaneous infer requests
         for (auto output : _networkOutputs) {
             _outputs[output.first] =
@@ -51,7 +93,16 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
         // result returned from sync infer wait method
-        auto result = plg->Infer(_inputs, _outputs);
+        AcquireDevice();
+        bool result;
+        try {
+            result = coalescer ? coalescer->WaitFor(coalescer->Submit(_inputs, _outputs), MAX_TIMEOUT) == GNA_REQUEST_COMPLETED
+                               : plg->Infer(_inputs, _outputs);
+        } catch (...) {
+            ReleaseDevice();
+            throw;
+        }
+        ReleaseDevice();
 
         // if result is false we are dealing with QoS feature
         // if result is ok, next call to wait() will return Ok, if request not in gna_queue
@@ -79,7 +130,13 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
     void StartAsyncImpl() override {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
-        inferRequestIdx = plg->QueueInference(_inputs, _outputs);
+        AcquireDevice();
+        try {
+            inferRequestIdx = coalescer ? coalescer->Submit(_inputs, _outputs) : plg->QueueInference(_inputs, _outputs);
+        } catch (...) {
+            ReleaseDevice();
+            throw;
+        }
         // workaround to unblock callback-based flows
         if (_callback) {
             auto infer_request = _publicInterface.lock();
@@ -100,12 +157,14 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
         if (millis_timeout == InferenceEngine::IInferRequest::WaitMode::RESULT_READY) {
             millis_timeout = MAX_TIMEOUT;
         }
-        const auto waitStatus = plg->WaitFor(inferRequestIdx, millis_timeout);
+        const auto waitStatus = coalescer ? coalescer->WaitFor(inferRequestIdx, millis_timeout)
+                                          : plg->WaitFor(inferRequestIdx, millis_timeout);
 
         if (waitStatus == GNA_REQUEST_PENDING) {
             // request is still pending so Wait() is needed once again
             return InferenceEngine::RESULT_NOT_READY;
         }
+        ReleaseDevice();
         if (waitStatus == GNA_REQUEST_ABORTED) {
             // need to preserve invalid state here to avoid next Wait() from clearing it
             inferRequestIdx = -1;
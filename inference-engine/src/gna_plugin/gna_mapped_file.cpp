@@ -0,0 +1,69 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gna_mapped_file.hpp"
+
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "gna_plugin_log.hpp"
+
+using namespace GNAPluginNS;
+
+MappedFile::MappedFile(const std::string& fileName) {
+#ifndef _WIN32
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st = {};
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* addr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                // model is consumed front to back, let the kernel read ahead
+                madvise(addr, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+                _data = static_cast<char*>(addr);
+                _size = static_cast<size_t>(st.st_size);
+                _mapped = true;
+            }
+        }
+        close(fd);
+    }
+#endif
+    if (!_mapped) {
+        std::ifstream inputStream(fileName, std::ios_base::in | std::ios_base::binary);
+        if (inputStream.fail()) {
+            THROW_GNA_EXCEPTION << "Cannot open file to import model: " << fileName;
+        }
+        _buffer.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+        _data = _buffer.data();
+        _size = _buffer.size();
+    }
+    setg(_data, _data, _data + _size);
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+    if (_mapped) {
+        munmap(_data, _size);
+    }
+#endif
+}
+
+MappedFile::pos_type MappedFile::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) {
+    off_type base = dir == std::ios_base::beg ? 0 : dir == std::ios_base::cur ? gptr() - eback() : static_cast<off_type>(_size);
+    return seekpos(pos_type(base + off), which);
+}
+
+MappedFile::pos_type MappedFile::seekpos(pos_type pos, std::ios_base::openmode which) {
+    if (!(which & std::ios_base::in) || pos < 0 || static_cast<size_t>(pos) > _size) {
+        return pos_type(off_type(-1));
+    }
+    setg(_data, _data + static_cast<off_type>(pos), _data + _size);
+    return pos;
+}
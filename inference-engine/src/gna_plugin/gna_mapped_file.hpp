@@ -0,0 +1,41 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace GNAPluginNS {
+
+/**
+ * @brief Read-only view of the exported model file, mapped into memory where the OS supports it. Pages are
+ * read lazily while the importer copies sections into GNA memory, so there is no intermediate stream buffer copy.
+ * Falls back to reading the whole file if mapping is not available.
+ */
+class MappedFile : public std::streambuf {
+ public:
+    explicit MappedFile(const std::string& fileName);
+    ~MappedFile() override;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return _data; }
+    size_t size() const { return _size; }
+
+ protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+ private:
+    char* _data = nullptr;
+    size_t _size = 0;
+    bool _mapped = false;
+    std::vector<char> _buffer;
+};
+
+}  // namespace GNAPluginNS
@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <array>
+#include <chrono>
 #include <details/ie_exception.hpp>
 #include <ios>
 #include <iomanip>
@@ -20,10 +21,46 @@
 
 #include "gna_plugin.hpp"
 #include "gna_model_serial.hpp"
+#include "gna_itt.hpp"
 #include "serial/headers/latest/gna_model_header.hpp"
 
 using namespace GNAPluginNS;
 
+namespace {
+/**
+ * @brief logs duration of every section of model import, sections are also reported to ITT by IMPORT_SECTION macros
+ */
+class ImportProgress {
+ public:
+    explicit ImportProgress(const char* section) : section(section), start(std::chrono::steady_clock::now()) {}
+    ~ImportProgress() {
+        report();
+    }
+    void next(const char* nextSection) {
+        report();
+        section = nextSection;
+        start = std::chrono::steady_clock::now();
+    }
+
+ private:
+    void report() const {
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        gnalog() << "[Import Network] " << section << ": " << elapsed.count() / 1000.0 << " ms\n";
+    }
+
+    const char* section;
+    std::chrono::steady_clock::time_point start;
+};
+}  // namespace
+
+#define IMPORT_SECTION_BEGIN(name) \
+    OV_ITT_TASK_CHAIN(importChain, GNAPluginNS::itt::domains::GNAPlugin, "GNAModelSerial::Import", name); \
+    ImportProgress importProgress(name)
+
+#define IMPORT_SECTION_NEXT(name) \
+    OV_ITT_TASK_NEXT(importChain, name); \
+    importProgress.next(name)
+
 inline void writeNBytes(const void *ptr, uint32_t size, std::ostream & os) {
     os.write(static_cast<const char*>(ptr), size);
 }
@@ -170,6 +207,7 @@ void GNAModelSerial::Import(void *basePointer,
         InferenceEngine::OutputsDataMap& outputsDataMap) {
     is.exceptions(std::istream::failbit);
 
+    IMPORT_SECTION_BEGIN("Inputs");
     if (modelHeader.version.major == 2) {
         if (modelHeader.version.minor >= 3) {
             for (auto inputIndex = 0; inputIndex < modelHeader.nInputs; inputIndex++) {
@@ -183,6 +221,7 @@ void GNAModelSerial::Import(void *basePointer,
     }
     ImportInputs(is, basePointer, inputsDesc, inputsDataMap);
 
+    IMPORT_SECTION_NEXT("Outputs");
     if (modelHeader.version.major == 2) {
         if (modelHeader.version.minor >= 3) {
             for (auto inputIndex = 0; inputIndex < modelHeader.nOutputs; inputIndex++) {
@@ -196,6 +235,7 @@ void GNAModelSerial::Import(void *basePointer,
     }
     ImportOutputs(is, basePointer, desc, outputsDataMap);
 
+    IMPORT_SECTION_NEXT("Operations");
     for (auto operation = gna2Model->Operations; operation != gna2Model->Operations + gna2Model->NumberOfOperations; ++operation) {
         readNBits<32>(operation->Type, is);
         readBits(operation->NumberOfOperands, is);
@@ -251,6 +291,7 @@ void GNAModelSerial::Import(void *basePointer,
     }
 
     // writing memory information
+    IMPORT_SECTION_NEXT("States");
     uint32_t nStates = 0;
     readBits(nStates, is);
     if (pstates != nullptr) {
@@ -269,6 +310,7 @@ void GNAModelSerial::Import(void *basePointer,
 
 
     // once structure has been read lets read whole gna graph
+    IMPORT_SECTION_NEXT("GnaMemory");
     is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
 }
 
@@ -414,9 +456,13 @@ void GNAModelSerial::Import(void *basePointer,
         InferenceEngine::OutputsDataMap& outputsDataMap) {
     is.exceptions(std::istream::failbit);
 
+    IMPORT_SECTION_BEGIN("Inputs");
     ImportInputs(is, basePointer, inputsDesc, inputsDataMap);
+    IMPORT_SECTION_NEXT("Outputs");
     ImportOutputs(is, basePointer, desc, outputsDataMap);
 
+    IMPORT_SECTION_NEXT("Layers");
+
     auto readPwl = [&is, basePointer](intel_pwl_func_t & value) {
         readBits(value.nSegments, is);
         if (value.nSegments != 0) {
@@ -510,6 +556,7 @@ void GNAModelSerial::Import(void *basePointer,
     }
 
     // writing memory information
+    IMPORT_SECTION_NEXT("States");
     uint32_t nStates = 0;
     readBits(nStates, is);
     if (pstates != nullptr) {
@@ -528,6 +575,7 @@ void GNAModelSerial::Import(void *basePointer,
 
 
     // once structure has been read lets read whole gna graph
+    IMPORT_SECTION_NEXT("GnaMemory");
     is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
 }
 
@@ -26,6 +26,7 @@
 #include "gna_plugin_config.hpp"
 #include <legacy/ie_util_internal.hpp>
 #include "gna_plugin.hpp"
+#include "gna_itt.hpp"
 #include "optimizer/gna_pass_manager.hpp"
 #include "layers/gna_layer_type.hpp"
 #include "preprocessing.hpp"
@@ -345,7 +346,8 @@ void GNAPlugin::InitGNADevice() {
     gnadevice = std::make_shared<GNADeviceHelper>(config.pluginGna2DeviceConsistent,
                 gnaFlags->gna_lib_async_threads_num,
                 gnaFlags->gna_openmp_multithreading,
-                gnaFlags->performance_counting);
+                gnaFlags->performance_counting,
+                gnaDeviceIndex);
 #endif
     size_t page_size_bytes = 4096;
     gnamem = std::make_shared<gna_memory_type>(memory::make_polymorph<memory::GNAAllocator>(gnadevice), page_size_bytes);
@@ -1319,6 +1321,7 @@ void GNAPlugin::SetName(const std::string & pluginName) noexcept {
 }
 
 InferenceEngine::ExecutableNetwork GNAPlugin::ImportNetwork(std::istream& networkModel) {
+    OV_ITT_SCOPED_TASK(GNAPluginNS::itt::domains::GNAPlugin, "ImportNetwork");
     auto header = GNAModelSerial::ReadHeader(networkModel);
 
     InitGNADevice();
@@ -1482,9 +1485,15 @@ InferenceEngine::QueryNetworkResult GNAPlugin::QueryNetwork(const InferenceEngin
     InferenceEngine::details::UnorderedDFS(allLayers,
                                            secondLayers.begin()->second,
                                            [&](CNNLayerPtr const& layer) {
-                                                if (LayerTypeFromStr(layer->type) != LayerType::NO_TYPE) {
-                                                    res.supportedLayersMap.insert({ layer->name, GetName() });
+                                                if (LayerTypeFromStr(layer->type) == LayerType::NO_TYPE) {
+                                                    return;
                                                 }
+                                                std::string reason;
+                                                if (LayerInfo(layer).isConvolution() && !IsConvolutionSupported(layer, reason)) {
+                                                    gnalog() << reason;
+                                                    return;
+                                                }
+                                                res.supportedLayersMap.insert({ layer->name, GetName() });
                                             }, false);
 
     return res;
@@ -80,6 +80,10 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
     static int GetDeviceVersionFromString(const std::string deviceString);
 
     std::shared_ptr<GNADeviceHelper> gnadevice;
+    /**
+     * @brief index of GNA device to open, negative value selects the only device of the host
+     */
+    int32_t gnaDeviceIndex = -1;
     /**
      * @brief size of RW segment without extra memory for parallel execution
      */
@@ -100,6 +104,15 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
     void SetName(const std::string & pluginName) noexcept override;
 
     void LoadNetwork(InferenceEngine::CNNNetwork &network);
+    /**
+     * @brief selects GNA device for the next LoadNetwork, used by device pool of executable network
+     */
+    void SetDeviceIndex(int32_t index) {
+        gnaDeviceIndex = index;
+    }
+    const std::map<std::string, std::string>& GetConfigMap() const {
+        return config.key_config_map;
+    }
 
     bool Infer(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result);
     void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap);
@@ -183,6 +183,38 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                                     << ", should be greater than 0 and less than 127";
             }
             gnaFlags.gna_lib_async_threads_num = lib_threads;
+        } else if (key == GNA_CONFIG_KEY(COALESCE_N_REQUESTS)) {
+            uint64_t requests_num;
+            try {
+                requests_num = std::stoul(value);
+                if (requests_num == 0 || requests_num > 8) {
+                    throw std::out_of_range("");
+                }
+            } catch (std::invalid_argument&) {
+                THROW_GNA_EXCEPTION << "Invalid value of number of coalesced requests";
+            } catch (std::out_of_range&) {
+                log << "Unsupported number of coalesced requests: " << value
+                    << ", should be greater than 0 and not greater than 8";
+                THROW_GNA_EXCEPTION << "Unsupported number of coalesced requests: " << value
+                                    << ", should be greater than 0 and not greater than 8";
+            }
+            gnaFlags.coalesced_requests_num = requests_num;
+        } else if (key == GNA_CONFIG_KEY(DEVICE_POOL_SIZE)) {
+            uint64_t pool_size;
+            try {
+                pool_size = std::stoul(value);
+                if (pool_size == 0 || pool_size > 16) {
+                    throw std::out_of_range("");
+                }
+            } catch (std::invalid_argument&) {
+                THROW_GNA_EXCEPTION << "Invalid value of GNA device pool size";
+            } catch (std::out_of_range&) {
+                log << "Unsupported GNA device pool size: " << value
+                    << ", should be greater than 0 and not greater than 16";
+                THROW_GNA_EXCEPTION << "Unsupported GNA device pool size: " << value
+                                    << ", should be greater than 0 and not greater than 16";
+            }
+            gnaFlags.device_pool_size = pool_size;
         } else if (key == CONFIG_KEY(SINGLE_THREAD)) {
             if (value == PluginConfigParams::YES) {
                 gnaFlags.gna_openmp_multithreading = false;
@@ -254,6 +286,8 @@ void Config::AdjustKeyMapValues() {
     key_config_map[CONFIG_KEY(PERF_COUNT)] =
             gnaFlags.performance_counting ? PluginConfigParams::YES: PluginConfigParams::NO;
     key_config_map[GNA_CONFIG_KEY(LIB_N_THREADS)] = std::to_string(gnaFlags.gna_lib_async_threads_num);
+    key_config_map[GNA_CONFIG_KEY(COALESCE_N_REQUESTS)] = std::to_string(gnaFlags.coalesced_requests_num);
+    key_config_map[GNA_CONFIG_KEY(DEVICE_POOL_SIZE)] = std::to_string(gnaFlags.device_pool_size);
     key_config_map[CONFIG_KEY(SINGLE_THREAD)] =
             gnaFlags.gna_openmp_multithreading ? PluginConfigParams::NO: PluginConfigParams::YES;
 }
@@ -0,0 +1,140 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gna_request_coalescer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <ie_memcpy.h>
+#include "gna_plugin_log.hpp"
+
+using namespace InferenceEngine;
+
+namespace GNAPluginNS {
+
+namespace {
+void checkSingleFrame(const std::string& name, const TensorDesc& desc) {
+    auto layout = desc.getLayout();
+    if ((layout != Layout::NC && layout != Layout::NCHW) || desc.getDims()[0] != 1) {
+        THROW_GNA_EXCEPTION << "Requests coalescing supports only NC or NCHW blobs with batch 1, but " << name
+                            << " has layout " << layout << " and dims " << desc.getDims();
+    }
+}
+
+void copyFrame(const Blob::Ptr& dst, size_t dstFrame, const Blob::Ptr& src, size_t srcFrame, size_t frameBytes) {
+    ie_memcpy(dst->buffer().as<uint8_t*>() + dstFrame * frameBytes, frameBytes,
+              src->cbuffer().as<const uint8_t*>() + srcFrame * frameBytes, frameBytes);
+}
+}  // namespace
+
+GNARequestCoalescer::GNARequestCoalescer(const std::shared_ptr<GNAPlugin>& plg,
+                                         uint32_t framesNum,
+                                         uint32_t maxBatchesInFlight,
+                                         const InputsDataMap& networkInputs,
+                                         const OutputsDataMap& networkOutputs)
+    : plg(plg), framesNum(framesNum), maxBatchesInFlight(std::max(maxBatchesInFlight, 1u)),
+      networkInputs(networkInputs), networkOutputs(networkOutputs) {
+    for (auto&& input : networkInputs) {
+        checkSingleFrame(input.first, input.second->getTensorDesc());
+    }
+    for (auto&& output : networkOutputs) {
+        checkSingleFrame(output.first, output.second->getTensorDesc());
+    }
+}
+
+GNARequestCoalescer::BatchPtr GNARequestCoalescer::AcquireBatch() {
+    if (!freeBatches.empty()) {
+        auto batch = freeBatches.back();
+        freeBatches.pop_back();
+        return batch;
+    }
+
+    auto batch = std::make_shared<Batch>();
+    for (auto&& input : networkInputs) {
+        batch->inputs[input.first] = plg->GetInputBlob(input.first, input.second->getTensorDesc().getPrecision());
+    }
+    for (auto&& output : networkOutputs) {
+        batch->outputs[output.first] = plg->GetOutputBlob(output.first, output.second->getTensorDesc().getPrecision());
+    }
+    return batch;
+}
+
+uint32_t GNARequestCoalescer::Submit(const BlobMap& inputs, const BlobMap& outputs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!current) {
+        current = AcquireBatch();
+        current->ticket = nextTicket++;
+        current->submitted = false;
+        current->requestsOutputs.clear();
+    }
+
+    auto frame = current->requestsOutputs.size();
+    for (auto&& input : inputs) {
+        copyFrame(current->inputs.at(input.first), frame, input.second, 0, input.second->byteSize());
+    }
+    current->requestsOutputs.push_back(outputs);
+
+    auto ticket = current->ticket;
+    if (current->requestsOutputs.size() == framesNum) {
+        Propagate(current);
+        current.reset();
+    }
+    return ticket;
+}
+
+void GNARequestCoalescer::Propagate(const BatchPtr& batch) {
+    // plugin has limited number of request configurations, the oldest batch is completed to free one
+    if (inFlight.size() >= maxBatchesInFlight) {
+        Complete(inFlight.front(), MAX_TIMEOUT);
+    }
+
+    // frames of missing requests are zeroed to keep outputs of partial batch deterministic
+    auto frames = batch->requestsOutputs.size();
+    for (auto&& input : batch->inputs) {
+        auto frameBytes = input.second->byteSize() / framesNum;
+        std::memset(input.second->buffer().as<uint8_t*>() + frames * frameBytes, 0, (framesNum - frames) * frameBytes);
+    }
+
+    batch->requestIdx = plg->QueueInference(batch->inputs, batch->outputs);
+    batch->submitted = true;
+    inFlight.push_back(batch);
+}
+
+GnaWaitStatus GNARequestCoalescer::Complete(BatchPtr batch, int64_t millisTimeout) {
+    auto status = plg->WaitFor(batch->requestIdx, millisTimeout);
+    if (status == GNA_REQUEST_PENDING) {
+        return status;
+    }
+
+    if (status == GNA_REQUEST_COMPLETED) {
+        for (size_t frame = 0; frame < batch->requestsOutputs.size(); frame++) {
+            for (auto&& output : batch->requestsOutputs[frame]) {
+                copyFrame(output.second, 0, batch->outputs.at(output.first), frame, output.second->byteSize());
+            }
+        }
+    }
+
+    batch->requestsOutputs.clear();
+    inFlight.erase(std::find(inFlight.begin(), inFlight.end(), batch));
+    freeBatches.push_back(batch);
+    return status;
+}
+
+GnaWaitStatus GNARequestCoalescer::WaitFor(uint32_t ticket, int64_t millisTimeout) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (current && current->ticket == ticket) {
+        Propagate(current);
+        current.reset();
+    }
+
+    auto batch = std::find_if(inFlight.begin(), inFlight.end(), [&](const BatchPtr& b) { return b->ticket == ticket; });
+    if (batch == inFlight.end()) {
+        // already completed by another request of the batch
+        return GNA_REQUEST_COMPLETED;
+    }
+    return Complete(*batch, millisTimeout);
+}
+
+}  // namespace GNAPluginNS
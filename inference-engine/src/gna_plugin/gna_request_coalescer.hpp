@@ -0,0 +1,73 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <deque>
+#include <vector>
+
+#include <ie_input_info.hpp>
+#include "gna_plugin.hpp"
+
+namespace GNAPluginNS {
+
+/**
+ * @brief Gathers frames of single-frame infer requests into one multi-frame propagate call
+ * of the plugin whose network is compiled for batch of coalesced_requests_num frames,
+ * and scatters output frames back to the requests.
+ * Calls to the plugin are serialized, so the coalescer can be shared by all requests of an executable network.
+ */
+class GNARequestCoalescer {
+ public:
+    GNARequestCoalescer(const std::shared_ptr<GNAPlugin>& plg,
+                        uint32_t framesNum,
+                        uint32_t maxBatchesInFlight,
+                        const InferenceEngine::InputsDataMap& networkInputs,
+                        const InferenceEngine::OutputsDataMap& networkOutputs);
+
+    /**
+     * @brief Copies request inputs into the current batch, the batch is propagated once it is full
+     * @return ticket to wait for
+     */
+    uint32_t Submit(const InferenceEngine::BlobMap& inputs, const InferenceEngine::BlobMap& outputs);
+
+    /**
+     * @brief Waits for the batch with given ticket, propagates it first if it is not full yet.
+     * When the batch is completed output frames are copied to all requests of the batch.
+     */
+    GnaWaitStatus WaitFor(uint32_t ticket, int64_t millisTimeout);
+
+ private:
+    struct Batch {
+        uint32_t ticket = 0;
+        uint32_t requestIdx = 0;
+        bool submitted = false;
+        InferenceEngine::BlobMap inputs;
+        InferenceEngine::BlobMap outputs;
+        std::vector<InferenceEngine::BlobMap> requestsOutputs;
+    };
+    using BatchPtr = std::shared_ptr<Batch>;
+
+    BatchPtr AcquireBatch();
+    void Propagate(const BatchPtr& batch);
+    GnaWaitStatus Complete(BatchPtr batch, int64_t millisTimeout);
+
+    std::shared_ptr<GNAPlugin> plg;
+    uint32_t framesNum;
+    uint32_t maxBatchesInFlight;
+    InferenceEngine::InputsDataMap networkInputs;
+    InferenceEngine::OutputsDataMap networkOutputs;
+
+    std::mutex mutex;
+    uint32_t nextTicket = 0;
+    BatchPtr current;
+    std::deque<BatchPtr> inFlight;
+    std::vector<BatchPtr> freeBatches;
+};
+
+}  // namespace GNAPluginNS
@@ -63,3 +63,50 @@ bool GNAPluginNS::AreLayersSupported(InferenceEngine::ICNNNetwork& network, std:
     IE_SUPPRESS_DEPRECATED_END
     return check_result;
 }
+
+bool GNAPluginNS::IsConvolutionSupported(const InferenceEngine::CNNLayerPtr& layer, std::string& errMessage) {
+    auto convolution = dynamic_cast<InferenceEngine::ConvolutionLayer*>(layer.get());
+    if (convolution == nullptr || layer->insData.empty()) {
+        errMessage = "Layer " + layer->name + " is not a convolution\n";
+        return false;
+    }
+    auto inputs = layer->insData.front().lock();
+    auto dims = inputs->getDims();
+    if (dims.size() != 4) {
+        return true;
+    }
+    auto in_batch = dims[0];
+    auto in_channels = dims[1];
+    auto in_height = dims[2];
+    auto in_width = dims[3];
+
+    if (in_batch != 1) {
+        errMessage = "Convolution " + layer->name + " with batch size not equals 1 is not supported on GNA\n";
+        return false;
+    }
+    if (convolution->_kernel_x != 1 && convolution->_kernel_y != 1 && convolution->_kernel_y != in_channels) {
+        errMessage = "Convolution " + layer->name + " with 2D kernel is not supported on GNA\n";
+        return false;
+    }
+    if (convolution->_dilation_x != 1 || convolution->_dilation_y != 1) {
+        errMessage = "Convolution " + layer->name + " with dilation is not supported on GNA\n";
+        return false;
+    }
+
+    // NHWC to NCHW permutation in front of the convolution is removed by the plugin, the convolution then reads
+    // the original NHWC data directly. Otherwise only the inputs with a single row are mapped without reordering.
+    auto prev = getCreatorLayer(inputs).lock();
+    if (prev && LayerInfo(prev).isPermute()) {
+        return true;
+    }
+    if (in_height != 1) {
+        errMessage = "Convolution " + layer->name + " with input height " + std::to_string(in_height) +
+                     " requires reordering of NCHW input which is not supported on GNA\n";
+        return false;
+    }
+    if (convolution->_kernel_x > in_width) {
+        errMessage = "Convolution " + layer->name + " kernel is bigger than its input\n";
+        return false;
+    }
+    return true;
+}
@@ -8,6 +8,7 @@
 #include <string>
 
 #include <ie_icnn_network.hpp>
+#include <legacy/ie_layers.h>
 #include <caseless.hpp>
 
 #include "backend/dnn_types.h"
@@ -91,4 +92,9 @@ static const InferenceEngine::details::caseless_map<std::string, GNAPluginNS::La
 
 GNAPluginNS::LayerType LayerTypeFromStr(const std::string &str);
 bool AreLayersSupported(InferenceEngine::ICNNNetwork& network, std::string& errMessage);
+/**
+ * @brief checks that the convolution can be lowered to GNA 1D convolution without host side reordering,
+ * otherwise the query reports it as unsupported so HETERO executes it on the fallback device
+ */
+bool IsConvolutionSupported(const InferenceEngine::CNNLayerPtr& layer, std::string& errMessage);
 }  // namespace GNAPluginNS
@@ -8,6 +8,7 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "float_kernels.hpp"
 #include "backend/dnn_types.h"
 
 
@@ -34,11 +35,8 @@ void CNNFilter32(intel_dnn_component_t *component) {
         float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
         for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
             float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+            ptr_outputs[j * component->op.conv1D.num_filters + i] =
+                ptr_biases[i] + GNAPluginNS::runtime::dot(ptr_in, ptr_coef, num_filter_coefficients);
         }
     }
 }
@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <immintrin.h>
+
+#include "float_kernels_avx2.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+float dot(const float *a, const float *b, uint32_t n) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+    }
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+    __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+    sum4 = _mm_hadd_ps(sum4, sum4);
+    sum4 = _mm_hadd_ps(sum4, sum4);
+    float sum = _mm_cvtss_f32(sum4);
+    for (; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+void axpy(float alpha, const float *x, float *y, uint32_t n) {
+    const __m256 valpha = _mm256_set1_ps(alpha);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(valpha, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+    for (; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+void madd(const float *a, const float *x, float *y, uint32_t n) {
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+    for (; i < n; i++) {
+        y[i] += a[i] * x[i];
+    }
+}
+
+void leaky_relu(const float *x, float *y, uint32_t n, float negative_slope) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 slope = _mm256_set1_ps(negative_slope);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(x + i);
+        __m256 negative = _mm256_cmp_ps(v, zero, _CMP_LT_OQ);
+        _mm256_storeu_ps(y + i, _mm256_blendv_ps(v, _mm256_mul_ps(v, slope), negative));
+    }
+    for (; i < n; i++) {
+        y[i] = x[i] < 0.0f ? x[i] * negative_slope : x[i];
+    }
+}
+
+void clamp(const float *x, float *y, uint32_t n, float lower, float upper) {
+    const __m256 vlower = _mm256_set1_ps(lower);
+    const __m256 vupper = _mm256_set1_ps(upper);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(x + i), vlower), vupper));
+    }
+    for (; i < n; i++) {
+        y[i] = x[i] > upper ? upper : (x[i] < lower ? lower : x[i]);
+    }
+}
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,21 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx512 {
+
+float dot(const float *a, const float *b, uint32_t n);
+void axpy(float alpha, const float *x, float *y, uint32_t n);
+void madd(const float *a, const float *x, float *y, uint32_t n);
+void leaky_relu(const float *x, float *y, uint32_t n, float negative_slope);
+void clamp(const float *x, float *y, uint32_t n, float lower, float upper);
+
+}  // namespace avx512
+}  // namespace runtime
+}  // namespace GNAPluginNS
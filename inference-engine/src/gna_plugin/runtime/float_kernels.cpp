@@ -0,0 +1,117 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "float_kernels.hpp"
+
+#include <ie_system_conf.h>
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/float_kernels_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/float_kernels_avx512.hpp"
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+
+namespace {
+#ifdef HAVE_AVX2
+bool use_avx2() {
+    static const bool avx2 = InferenceEngine::with_cpu_x86_avx2();
+    return avx2;
+}
+#endif
+#ifdef HAVE_AVX512
+bool use_avx512() {
+    static const bool avx512 = InferenceEngine::with_cpu_x86_avx512f();
+    return avx512;
+}
+#endif
+}  // namespace
+
+float dot(const float *a, const float *b, uint32_t n) {
+#ifdef HAVE_AVX512
+    if (use_avx512()) {
+        return avx512::dot(a, b, n);
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (use_avx2()) {
+        return avx2::dot(a, b, n);
+    }
+#endif
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+void axpy(float alpha, const float *x, float *y, uint32_t n) {
+#ifdef HAVE_AVX512
+    if (use_avx512()) {
+        return avx512::axpy(alpha, x, y, n);
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (use_avx2()) {
+        return avx2::axpy(alpha, x, y, n);
+    }
+#endif
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+void madd(const float *a, const float *x, float *y, uint32_t n) {
+#ifdef HAVE_AVX512
+    if (use_avx512()) {
+        return avx512::madd(a, x, y, n);
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (use_avx2()) {
+        return avx2::madd(a, x, y, n);
+    }
+#endif
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] += a[i] * x[i];
+    }
+}
+
+void leaky_relu(const float *x, float *y, uint32_t n, float negative_slope) {
+#ifdef HAVE_AVX512
+    if (use_avx512()) {
+        return avx512::leaky_relu(x, y, n, negative_slope);
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (use_avx2()) {
+        return avx2::leaky_relu(x, y, n, negative_slope);
+    }
+#endif
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] = x[i] < 0.0f ? x[i] * negative_slope : x[i];
+    }
+}
+
+void clamp(const float *x, float *y, uint32_t n, float lower, float upper) {
+#ifdef HAVE_AVX512
+    if (use_avx512()) {
+        return avx512::clamp(x, y, n, lower, upper);
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (use_avx2()) {
+        return avx2::clamp(x, y, n, lower, upper);
+    }
+#endif
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] = x[i] > upper ? upper : (x[i] < lower ? lower : x[i]);
+    }
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
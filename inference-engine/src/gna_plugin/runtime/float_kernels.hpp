@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+/**
+ * @brief vector kernels of floating point runtime, dispatched to AVX512 or AVX2 implementation
+ * when plugin is built with them and host CPU supports them, otherwise scalar loops are used
+ */
+
+/**
+ * @brief returns sum of a[i] * b[i]
+ */
+float dot(const float *a, const float *b, uint32_t n);
+
+/**
+ * @brief y[i] += alpha * x[i]
+ */
+void axpy(float alpha, const float *x, float *y, uint32_t n);
+
+/**
+ * @brief y[i] += a[i] * x[i]
+ */
+void madd(const float *a, const float *x, float *y, uint32_t n);
+
+/**
+ * @brief y[i] = x[i] < 0 ? x[i] * negative_slope : x[i]
+ */
+void leaky_relu(const float *x, float *y, uint32_t n, float negative_slope);
+
+/**
+ * @brief y[i] = min(max(x[i], lower), upper)
+ */
+void clamp(const float *x, float *y, uint32_t n, float lower, float upper);
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -1,13 +1,16 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines, inner loops use vector kernels from float_kernels.hpp
 //
 
 #include <cstdint>
 #include <cstdio>
 
 #include "floatmath.h"
+#include "float_kernels.hpp"
+
+using namespace GNAPluginNS::runtime;
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -28,33 +31,33 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
         for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+            float *C_row = C + i * ldc;
+            if (beta != 1.0) {
+                for (j = 0; j < N; j++) {
+                    C_row[j] = 0;
                 }
-                C[i * ldc + j] = sum;
+            }
+            // rows of B are accumulated into row of C to keep memory access contiguous
+            for (k = 0; k < K; k++) {
+                axpy(A[i * lda + k], B + k * ldb, C_row, N);
             }
         }
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
+                C[i * ldc + j] = beta * C[i * ldc + j] + alpha * dot(A + i * lda, B + j * ldb, K);
             }
         }
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
+            float *C_row = C + i * ldc;
+            if (beta != 1.0) {
+                for (j = 0; j < N; j++) {
+                    C_row[j] = 0;
                 }
-                C[i * ldc + j] = sum;
+            }
+            for (k = 0; k < K; k++) {
+                axpy(A[k * lda + i], B + k * ldb, C_row, N);
             }
         }
     } else {
@@ -81,9 +84,7 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
         throw -1;
     }
     if ((alpha == 1.0) && (beta == 1.0) && (incX == 1) && (incY == 1)) {
-        for (i = 0; i < N; i++) {
-            Y[i] += A[i] * X[i];
-        }
+        madd(A, X, Y, N);
     } else {
         fprintf(stderr, "Only alpha=1, beta=1, incX=1, incY=1, LDA=1 supported in cblas_ssbmv at this time!\n");
         throw -1;
@@ -107,35 +108,34 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
         for (l = 0; l < L; l++) {
             i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+            float *C_row = C + l * ldc;
+            if (beta != 1.0) {
+                for (j = 0; j < N; j++) {
+                    C_row[j] = 0;
                 }
-                C[l * ldc + j] = sum;
+            }
+            for (k = 0; k < K; k++) {
+                axpy(A[i * lda + k], B + k * ldb, C_row, N);
             }
         }
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
-                float sum;
                 j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + l] = sum;
+                C[i * ldc + l] = beta * C[i * ldc + l] + alpha * dot(A + i * lda, B + j * ldb, K);
             }
         }
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (l = 0; l < L; l++) {
             i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
+            float *C_row = C + l * ldc;
+            if (beta != 1.0) {
+                for (j = 0; j < N; j++) {
+                    C_row[j] = 0;
                 }
-                C[l * ldc + j] = sum;
+            }
+            for (k = 0; k < K; k++) {
+                axpy(A[k * lda + i], B + k * ldb, C_row, N);
             }
         }
     } else {
@@ -155,17 +155,10 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
+    uint32_t i;
 
     for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
+        C[i] = B[i] + dot(A1, X + i * num_columns, K1) + dot(A2, X + i * num_columns + K1, K2);
     }
 }
 
@@ -15,6 +15,8 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const InferRequestInternal::Ptr
     AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
     _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)),
     _statusCodes{_heteroInferRequest->_inferRequests.size(), StatusCode::OK} {
+    // one stage per subgraph: a stage is completed by the subgraph request callback, so the executing thread is
+    // released right after the subgraph request is started and the stages of different HETERO requests overlap
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
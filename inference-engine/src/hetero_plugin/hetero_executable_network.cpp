@@ -12,6 +12,8 @@
 #include <vector>
 #include <deque>
 #include <map>
+#include <set>
+#include <functional>
 #include <utility>
 #include <fstream>
 #include <algorithm>
@@ -20,12 +22,16 @@
 #include <unordered_set>
 #include <array>
 #include <cstdint>
+#include <exception>
+#include <sstream>
 
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
+#include "exec_graph_info.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "hetero_plugin.hpp"
+#include <threading/ie_executor_manager.hpp>
 
 #include <ngraph/function.hpp>
 #include <ngraph/variant.hpp>
@@ -33,6 +39,7 @@
 #include <ngraph/op/result.hpp>
 #include <ngraph/op/parameter.hpp>
 #include <ngraph/op/util/op_types.hpp>
+#include <ngraph/shape.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pass/visualize_tree.hpp>
 
@@ -45,6 +52,201 @@ using namespace InferenceEngine::HeteroConfigParams;
 template<typename T>
 using NodeMap = std::unordered_map<ngraph::Node*, T>;
 
+namespace {
+
+template<typename NodeType>
+double TensorBytes(const ngraph::Output<NodeType>& output) {
+    const auto& shape = output.get_partial_shape();
+    const auto elementSize = static_cast<double>(output.get_element_type().size());
+    return shape.is_static() ? elementSize * ngraph::shape_size(shape.to_shape()) : elementSize;
+}
+
+// Most of the layers are memory bound, so the execution cost is estimated by the amount of memory the layer touches
+double EstimateComputeCost(const ngraph::Node& node) {
+    double cost = 0.0;
+    for (auto&& input : node.inputs()) {
+        cost += TensorBytes(input.get_source_output());
+    }
+    for (auto&& output : node.outputs()) {
+        cost += TensorBytes(output);
+    }
+    return cost;
+}
+
+/**
+ * @brief Assigns the layers to the devices minimizing the estimated cost of the network execution:
+ *        sum of the layers compute costs, the later TARGET_FALLBACK devices are assumed to be slower,
+ *        plus the tensors transfer and the subgraph switch costs for each edge between the different devices.
+ *        Starts from the first supported device assignment, then applies the layers moves and the moves
+ *        of the whole same device regions to the neighbour device while they decrease the cost,
+ *        or while there are more than maxSubgraphs regions.
+ * @return The map of the layers names to the devices, layers that are not supported by any device are not assigned
+ */
+std::map<std::string, std::string> CostBasedAffinities(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+                                                       const Engine::DeviceQueryResults&                 deviceQueryResults,
+                                                       const std::size_t                                 maxSubgraphs) {
+    // the device switch has fixed launch and synchronization overheads, so it is not free even for the tiny tensors
+    constexpr double subgraphSwitchCost = 64.0 * 1024.0;
+    constexpr std::size_t maxNodeSweeps = 16;
+    constexpr int noDevice = -1;
+
+    // constants, parameters and results take the affinity of the neighbour layers
+    std::vector<ngraph::Node*> nodes;
+    NodeMap<std::size_t> nodeIds;
+    for (auto&& node : orderedOps) {
+        if (!ngraph::op::is_constant(node) && !ngraph::op::is_output(node) && !ngraph::op::is_parameter(node)) {
+            nodeIds.emplace(node.get(), nodes.size());
+            nodes.push_back(node.get());
+        }
+    }
+
+    std::vector<std::vector<int>> candidates(nodes.size());
+    std::vector<double> computeCosts(nodes.size()), transferCosts(nodes.size());
+    std::vector<std::vector<std::size_t>> producers(nodes.size()), consumers(nodes.size());
+    std::vector<int> devices(nodes.size(), noDevice);
+    for (std::size_t id = 0; id < nodes.size(); ++id) {
+        for (std::size_t device = 0; device < deviceQueryResults.size(); ++device) {
+            if (contains(deviceQueryResults[device].second.supportedLayersMap, nodes[id]->get_friendly_name())) {
+                candidates[id].push_back(static_cast<int>(device));
+            }
+        }
+        if (!candidates[id].empty()) {
+            devices[id] = candidates[id].front();
+        }
+        computeCosts[id] = EstimateComputeCost(*nodes[id]);
+        for (auto&& output : nodes[id]->outputs()) {
+            // copied out of the producer device and into the consumer device
+            transferCosts[id] += 2.0 * TensorBytes(output) + subgraphSwitchCost;
+        }
+        for (auto&& input : nodes[id]->inputs()) {
+            auto itProducer = nodeIds.find(input.get_source_output().get_node());
+            if (itProducer != nodeIds.end()) {
+                producers[id].push_back(itProducer->second);
+                consumers[itProducer->second].push_back(id);
+            }
+        }
+    }
+
+    auto isSupported = [&] (std::size_t id, int device) {
+        return std::find(candidates[id].begin(), candidates[id].end(), device) != candidates[id].end();
+    };
+    auto computeCost = [&] (std::size_t id, int device) {
+        return computeCosts[id] * (1.0 + device);
+    };
+
+    // single layer moves
+    bool changed = true;
+    for (std::size_t sweep = 0; changed && sweep < maxNodeSweeps; ++sweep) {
+        changed = false;
+        for (std::size_t id = 0; id < nodes.size(); ++id) {
+            auto nodeCost = [&] (int device) {
+                double cost = computeCost(id, device);
+                for (auto producer : producers[id]) {
+                    cost += (devices[producer] != device) ? transferCosts[producer] : 0.0;
+                }
+                for (auto consumer : consumers[id]) {
+                    cost += (devices[consumer] != device) ? transferCosts[id] : 0.0;
+                }
+                return cost;
+            };
+            auto bestCost = nodeCost(devices[id]);
+            for (auto device : candidates[id]) {
+                auto cost = nodeCost(device);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    devices[id] = device;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // same device regions moves, each move merges the region with the neighbour one
+    while (true) {
+        std::vector<std::size_t> regionIds(nodes.size());
+        for (std::size_t id = 0; id < nodes.size(); ++id) {
+            regionIds[id] = id;
+        }
+        std::function<std::size_t(std::size_t)> findRegion = [&] (std::size_t id) {
+            return regionIds[id] == id ? id : (regionIds[id] = findRegion(regionIds[id]));
+        };
+        for (std::size_t id = 0; id < nodes.size(); ++id) {
+            for (auto consumer : consumers[id]) {
+                if (devices[id] == devices[consumer] && devices[id] != noDevice) {
+                    regionIds[findRegion(consumer)] = findRegion(id);
+                }
+            }
+        }
+        std::map<std::size_t, std::vector<std::size_t>> regions;
+        for (std::size_t id = 0; id < nodes.size(); ++id) {
+            regions[findRegion(id)].push_back(id);
+        }
+
+        bool found = false;
+        double bestDelta = 0.0;
+        std::size_t bestRegion = 0;
+        int bestDevice = noDevice;
+        for (auto&& region : regions) {
+            auto& regionNodes = region.second;
+            const auto device = devices[regionNodes.front()];
+            if (device == noDevice) {
+                continue;
+            }
+            std::set<int> neighbourDevices;
+            for (auto id : regionNodes) {
+                for (auto producer : producers[id]) {
+                    if (devices[producer] != device) neighbourDevices.insert(devices[producer]);
+                }
+                for (auto consumer : consumers[id]) {
+                    if (devices[consumer] != device) neighbourDevices.insert(devices[consumer]);
+                }
+            }
+            for (auto neighbourDevice : neighbourDevices) {
+                if (neighbourDevice == noDevice ||
+                    !std::all_of(regionNodes.begin(), regionNodes.end(),
+                                 [&] (std::size_t id) { return isSupported(id, neighbourDevice); })) {
+                    continue;
+                }
+                // all the region edges are between the different devices now, so the move just removes some of them
+                double delta = 0.0;
+                for (auto id : regionNodes) {
+                    delta += computeCost(id, neighbourDevice) - computeCost(id, device);
+                    for (auto producer : producers[id]) {
+                        delta -= (devices[producer] == neighbourDevice) ? transferCosts[producer] : 0.0;
+                    }
+                    for (auto consumer : consumers[id]) {
+                        delta -= (devices[consumer] == neighbourDevice) ? transferCosts[id] : 0.0;
+                    }
+                }
+                if (!found || delta < bestDelta) {
+                    found = true;
+                    bestDelta = delta;
+                    bestRegion = region.first;
+                    bestDevice = neighbourDevice;
+                }
+            }
+        }
+
+        const bool tooManyRegions = maxSubgraphs != 0 && regions.size() > maxSubgraphs;
+        if (!found || (!tooManyRegions && bestDelta >= 0.0)) {
+            break;
+        }
+        for (auto id : regions[bestRegion]) {
+            devices[id] = bestDevice;
+        }
+    }
+
+    std::map<std::string, std::string> affinities;
+    for (std::size_t id = 0; id < nodes.size(); ++id) {
+        if (devices[id] != noDevice) {
+            affinities.emplace(nodes[id]->get_friendly_name(), deviceQueryResults[devices[id]].first);
+        }
+    }
+    return affinities;
+}
+
+}  // namespace
+
 HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwork&     network,
                                                  const Engine::Configs&                 config,
                                                  Engine*                                plugin):
@@ -79,7 +281,13 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
 
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
-        if (it != _config.end()) {
+        auto itCostBased = _config.find(HETERO_CONFIG_KEY(COST_BASED_AFFINITY));
+        if (it != _config.end() && itCostBased != _config.end() && itCostBased->second == YES) {
+            auto itMaxSubgraphs = _config.find(HETERO_CONFIG_KEY(MAX_SUBGRAPHS));
+            const std::size_t maxSubgraphs = (itMaxSubgraphs != _config.end()) ? std::stoul(itMaxSubgraphs->second) : 0;
+            queryNetworkResult.supportedLayersMap =
+                CostBasedAffinities(orderedOps, _heteroPlugin->QueryDevices(network, _config), maxSubgraphs);
+        } else if (it != _config.end()) {
             queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
         } else {
             THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
@@ -412,14 +620,94 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                 }
             }}.run_on_function(ngraph::clone_function(*function));
     }
-    for (auto&& network : networks) {
+
+    // The execution graph is the original network where each layer keeps the device and the index of the subgraph
+    // (subgraphs are executed in the order of the indices) it was assigned to
+    _execGraph = ngraph::clone_function(*function);
+    std::unordered_map<std::string, std::size_t> nodeSubgraphIds;
+    for (std::size_t i = 0; i < subFunctions.size(); ++i) {
+        for (auto&& node : subFunctions[i]->get_ops()) {
+            nodeSubgraphIds.emplace(node->get_friendly_name(), i);
+        }
+    }
+    for (auto&& node : _execGraph->get_ops()) {
+        auto& rtInfo = node->get_rt_info();
+        auto setInfo = [&] (const std::string& key, const std::string& value) {
+            rtInfo[key] = std::make_shared<ngraph::VariantWrapper<std::string>>(value);
+        };
+        auto itAffinity = queryNetworkResult.supportedLayersMap.find(node->get_friendly_name());
+        if (itAffinity != queryNetworkResult.supportedLayersMap.end()) {
+            setInfo("affinity", itAffinity->second);
+        }
+        auto itSubgraphId = nodeSubgraphIds.find(node->get_friendly_name());
+        if (itSubgraphId != nodeSubgraphIds.end()) {
+            setInfo(ExecGraphInfoSerialization::EXECUTION_ORDER, std::to_string(itSubgraphId->second));
+        }
+        setInfo(ExecGraphInfoSerialization::ORIGINAL_NAMES, node->get_friendly_name());
+        setInfo(ExecGraphInfoSerialization::LAYER_TYPE, node->get_type_name());
+    }
+
+    // devices compile subnetworks independently, so devices load in parallel, while subnetworks
+    // of the same device are loaded one after another to not oversubscribe the device
+    std::vector<std::map<std::string, std::string>> loadConfigs;
+    std::map<std::string, std::vector<std::size_t>> deviceSubnetworks;
+    for (std::size_t i = 0; i < networks.size(); ++i) {
         auto cfg = _config;
-        cfg[CONFIG_KEY_INTERNAL(SUBNETWORK_WITH_NETWORK_INPUTS)]
-            = isInputSubnetwork[std::distance(networks.data(), &network)] ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
-        auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, cfg);
-        network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
-                                                                 network._device, metaDevices[network._device]);
+        cfg[CONFIG_KEY_INTERNAL(SUBNETWORK_WITH_NETWORK_INPUTS)] = isInputSubnetwork[i] ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
+        auto metaDevices = _heteroPlugin->GetDevicePlugins(networks[i]._device, cfg);
+        loadConfigs.push_back(metaDevices[networks[i]._device]);
+        deviceSubnetworks[networks[i]._device].push_back(i);
+    }
+    std::vector<std::exception_ptr> loadErrors(networks.size());
+    std::vector<Task> loads;
+    for (auto&& subnetworks : deviceSubnetworks) {
+        loads.push_back([&, subnetworks] {
+            for (auto i : subnetworks.second) {
+                try {
+                    networks[i]._network = _heteroPlugin->GetCore()->LoadNetwork(networks[i]._clonedNetwork,
+                                                                                 networks[i]._device, loadConfigs[i]);
+                } catch (...) {
+                    loadErrors[i] = std::current_exception();
+                    break;
+                }
+            }
+        });
+    }
+    if (loads.size() > 1) {
+        auto executor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"HeteroAsyncLoad",
+                                     static_cast<int>(loads.size()),
+                                     1 /*single thread per stream*/,
+                                     IStreamsExecutor::ThreadBindingType::NONE});
+        executor->runAndWait(loads);
+    } else {
+        for (auto&& load : loads)
+            load();
+    }
+
+    // a single failure is rethrown as is, so its status is kept, otherwise errors of all devices are reported
+    std::vector<std::size_t> failed;
+    for (std::size_t i = 0; i < networks.size(); ++i) {
+        if (loadErrors[i])
+            failed.push_back(i);
     }
+    if (failed.size() == 1) {
+        std::rethrow_exception(loadErrors[failed.front()]);
+    } else if (!failed.empty()) {
+        std::ostringstream errors;
+        for (auto i : failed) {
+            errors << "\n" << networks[i]._device << " (subnetwork " << i << "): ";
+            try {
+                std::rethrow_exception(loadErrors[i]);
+            } catch (const std::exception& e) {
+                errors << e.what();
+            } catch (...) {
+                errors << "unknown exception";
+            }
+        }
+        THROW_IE_EXCEPTION << "Failed to load subnetworks of the HETERO device:" << errors.str();
+    }
+    InitSharedBlobContexts();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -538,6 +826,47 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     }
 
     networks = std::move(descs);
+    InitSharedBlobContexts();
+}
+
+void HeteroExecutableNetwork::InitSharedBlobContexts() {
+    auto getContext = [] (const InferenceEngine::ExecutableNetwork& network) -> RemoteContext::Ptr {
+        try {
+            return network.GetContext();
+        } catch (const InferenceEngine::details::InferenceEngineException&) {
+            return nullptr;
+        }
+    };
+    std::vector<RemoteContext::Ptr> contexts;
+    for (auto&& desc : networks) {
+        contexts.push_back(getContext(desc._network));
+    }
+    // The intermediate blob is allocated as a remote one only if all its consumers run in the producer remote context,
+    // as the host plugins keep the raw pointers to the blobs memory that are valid only while the remote blob is mapped
+    for (std::size_t producer = 0; producer < networks.size(); ++producer) {
+        if (nullptr == contexts[producer]) {
+            continue;
+        }
+        for (auto&& output : networks[producer]._network.GetOutputsInfo()) {
+            bool hasConsumers = false, sameContext = true;
+            for (std::size_t consumer = 0; consumer < networks.size(); ++consumer) {
+                if (consumer == producer) {
+                    continue;
+                }
+                for (auto&& input : networks[consumer]._network.GetInputsInfo()) {
+                    auto itName = _blobNameMap.find(input.first);
+                    const auto& intermediateBlobName = (itName != _blobNameMap.end()) ? itName->second : input.first;
+                    if (intermediateBlobName == output.first) {
+                        hasConsumers = true;
+                        sameContext = sameContext && (contexts[consumer] == contexts[producer]);
+                    }
+                }
+            }
+            if (hasConsumers && sameContext) {
+                _sharedBlobContexts.emplace(output.first, contexts[producer]);
+            }
+        }
+    }
 }
 
 void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
@@ -625,13 +954,21 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     return std::make_shared<HeteroInferRequest>(networkInputs,
                                                 networkOutputs,
                                                 inferRequests,
-                                                _blobNameMap);
+                                                _blobNameMap,
+                                                _sharedBlobContexts);
 }
 
 IInferRequest::Ptr HeteroExecutableNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<HeteroAsyncInferRequest>();
 }
 
+CNNNetwork HeteroExecutableNetwork::GetExecGraphInfo() {
+    if (nullptr == _execGraph) {
+        THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED);
+    }
+    return CNNNetwork{ngraph::clone_function(*_execGraph)};
+}
+
 InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string &name) const {
     InferenceEngine::Parameter result;
     if (name == "TARGET_FALLBACK") {
@@ -646,6 +983,12 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(COST_BASED_AFFINITY)) {
+        auto it = _config.find(name);
+        result = (it != _config.end()) && (it->second == YES);
+    } else if (name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        auto it = _config.find(name);
+        result = static_cast<unsigned int>((it != _config.end()) ? std::stoul(it->second) : 0);
     } else {
         // find config key among plugin config keys
         for (auto&& desc : networks) {
@@ -730,6 +1073,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(COST_BASED_AFFINITY),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -752,9 +1097,12 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
     } else if (METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
     } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // each HETERO request occupies one subgraph at a time, so to keep all the subgraphs busy simultaneously
+        // (request N runs subgraph k while request N-1 runs subgraph k+1) every subgraph needs its own optimal
+        // number of requests in flight
         unsigned int value = 0u;
         for (auto&& desc : networks) {
-            value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
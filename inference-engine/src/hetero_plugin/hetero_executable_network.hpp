@@ -16,6 +16,7 @@
 #include <unordered_set>
 
 #include <ie_common.h>
+#include <ngraph/function.hpp>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 
 #include "hetero_infer_request.hpp"
@@ -54,6 +55,8 @@ public:
 
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
+    InferenceEngine::CNNNetwork GetExecGraphInfo() override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -63,6 +66,7 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork&    network);
     void InitNgraph(const InferenceEngine::CNNNetwork&     network);
+    void InitSharedBlobContexts();
 
     struct NetworkDesc {
         std::string                                 _device;
@@ -75,6 +79,8 @@ private:
     std::string                         _name;
     std::map<std::string, std::string>  _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    HeteroInferRequest::SharedBlobContexts       _sharedBlobContexts;
+    std::shared_ptr<ngraph::Function>            _execGraph;
 };
 
 }  // namespace HeteroPlugin
@@ -19,7 +19,8 @@ using namespace InferenceEngine::details;
 HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
                                        const SubRequestsList& inferRequests,
-                                       const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) :
+                                       const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames,
+                                       const SharedBlobContexts& sharedBlobContexts) :
     InferRequestInternal(networkInputs, networkOutputs),
     _inferRequests(inferRequests) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
@@ -36,7 +37,14 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
         bool emplaced = false;
         std::tie(itBlob, emplaced) = _blobs.emplace(intermediateBlobName, Blob::Ptr{});
         if (emplaced) {
-            itBlob->second = r->GetBlob(blobName);
+            auto itContext = sharedBlobContexts.find(intermediateBlobName);
+            if (itContext != sharedBlobContexts.end() && !InferenceEngine::details::contains(networkOutputs, blobName)) {
+                // all the consumers run in the producer remote context, so the blob stays on the device
+                itBlob->second = itContext->second->CreateBlob(r->GetBlob(blobName)->getTensorDesc());
+                r->SetBlob(blobName, itBlob->second);
+            } else {
+                itBlob->second = r->GetBlob(blobName);
+            }
             if (InferenceEngine::details::contains(networkInputs, blobName)) {
                 _inputs[blobName] = itBlob->second;
             } else if (InferenceEngine::details::contains(networkOutputs, blobName)) {
@@ -32,11 +32,14 @@ public:
         openvino::itt::handle_t             _profilingTask;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
+    // remote contexts used to allocate the intermediate blobs shared by the adjacent subgraphs requests
+    using SharedBlobContexts = std::unordered_map<std::string, InferenceEngine::RemoteContext::Ptr>;
 
     explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 const SubRequestsList &inferRequests,
-                                const std::unordered_map<std::string, std::string>& blobNameMap);
+                                const std::unordered_map<std::string, std::string>& blobNameMap,
+                                const SharedBlobContexts& sharedBlobContexts = {});
 
     void InferImpl() override;
 
@@ -32,6 +32,8 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(COST_BASED_AFFINITY)] = NO;
+    _config[HETERO_CONFIG_KEY(MAX_SUBGRAPHS)] = "0";
 }
 
 namespace {
@@ -62,6 +64,17 @@ InferenceEngine::ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const
         THROW_IE_EXCEPTION << "HETERO plugin supports just ngraph network representation";
     }
 
+    auto costBased = tconfig.at(HETERO_CONFIG_KEY(COST_BASED_AFFINITY));
+    if (costBased != YES && costBased != NO) {
+        THROW_IE_EXCEPTION << "Unsupported value " << costBased << " for the "
+                           << HETERO_CONFIG_KEY(COST_BASED_AFFINITY) << " key of the HETERO device";
+    }
+    auto maxSubgraphs = tconfig.at(HETERO_CONFIG_KEY(MAX_SUBGRAPHS));
+    if (maxSubgraphs.empty() || maxSubgraphs.find_first_not_of("0123456789") != std::string::npos) {
+        THROW_IE_EXCEPTION << "Unsupported value " << maxSubgraphs << " for the "
+                           << HETERO_CONFIG_KEY(MAX_SUBGRAPHS) << " key of the HETERO device";
+    }
+
     return std::make_shared<HeteroExecutableNetwork>(network, mergeConfigs(_config, config), this);
 }
 
@@ -124,9 +137,7 @@ void Engine::SetConfig(const Configs &configs) {
     }
 }
 
-QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs& config) const {
-    QueryNetworkResult qr;
-
+Engine::DeviceQueryResults Engine::QueryDevices(const CNNNetwork &network, const Configs& config) const {
     if (GetCore() == nullptr) {
         THROW_IE_EXCEPTION << "Please, work with HETERO device via InferencEngine::Core object";
     }
@@ -154,8 +165,18 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
+    DeviceQueryResults deviceQueryResults;
     for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+        deviceQueryResults.emplace_back(deviceName, queryResults[deviceName]);
+    }
+    return deviceQueryResults;
+}
+
+QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs& config) const {
+    QueryNetworkResult qr;
+
+    for (auto&& deviceQueryResult : QueryDevices(network, config)) {
+        for (auto&& layerQueryResult : deviceQueryResult.second.supportedLayersMap) {
             qr.supportedLayersMap.emplace(layerQueryResult);
         }
     }
@@ -175,6 +196,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(COST_BASED_AFFINITY),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)});
@@ -191,6 +214,14 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(COST_BASED_AFFINITY)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(COST_BASED_AFFINITY));
+        IE_ASSERT(it != _config.end());
+        return { it->second == YES };
+    } else if (name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(MAX_SUBGRAPHS));
+        IE_ASSERT(it != _config.end());
+        return { static_cast<unsigned int>(std::stoul(it->second)) };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
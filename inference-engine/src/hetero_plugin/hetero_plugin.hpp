@@ -42,6 +42,9 @@ public:
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback,
         const Configs & localConfig) const;
 
+    using DeviceQueryResults = std::vector<std::pair<std::string, InferenceEngine::QueryNetworkResult>>;
+    DeviceQueryResults QueryDevices(const InferenceEngine::CNNNetwork &network, const Configs& config) const;
+
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string & deviceName) const;
 };
@@ -14,6 +14,8 @@
 #include <vector>
 #include <unordered_set>
 #include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset5.hpp>
 #include <ngraph/graph_util.hpp>
 #include <ngraph/pass/constant_folding.hpp>
 #include <ngraph/pass/manager.hpp>
@@ -41,6 +43,16 @@ using details::CNNNetworkNGraphImpl;
 using InferenceEngine::details::CNNNetworkNGraphImpl;
 using ngraph::Function;
 
+static bool needsLegacySpecialization(const std::shared_ptr<const ngraph::Function>& func) {
+    for (const auto& op : func->get_ops()) {
+        if (op->is_dynamic() ||
+            ngraph::is_type<ngraph::opset5::NonMaxSuppression>(op) ||
+            ngraph::is_type<ngraph::opset1::OneHot>(op))
+            return true;
+    }
+    return false;
+}
+
 static std::shared_ptr<ngraph::Function> copyFunction(const std::shared_ptr<const ngraph::Function>& func,
                                                       bool constFolding) {
     OV_ITT_SCOPED_TASK(itt::domains::IE, "copyFunction");
@@ -304,9 +316,13 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
             }
         }
         if (needReshape) {
-            ngraph::pass::Manager ssr_manager;
-            ssr_manager.register_pass<ngraph::pass::SmartReshape>();
-            ssr_manager.run_passes(_ngraph_function);
+            // SmartReshape only rewrites the topology, so it's enough to apply it once
+            if (!_smartReshapeApplied) {
+                ngraph::pass::Manager ssr_manager;
+                ssr_manager.register_pass<ngraph::pass::SmartReshape>();
+                ssr_manager.run_passes(_ngraph_function);
+                _smartReshapeApplied = true;
+            }
 
             reshape(inputShapes);
         }
@@ -323,20 +339,25 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
 
     auto params = _ngraph_function->get_parameters();
 
-    for (size_t i = 0; i < params.size(); i++) {
-        const auto& param = params[i];
-        if (inputShapes.find(param->get_friendly_name()) == inputShapes.end())
+    // Parameters are changed in place: the topology stays the same, so the cached topological
+    // order of the function is reused and only nodes depending on the changed inputs are re-inferred
+    for (const auto& param : params) {
+        auto it = inputShapes.find(param->get_friendly_name());
+        if (it == inputShapes.end())
+            continue;
+        ::ngraph::PartialShape shape(it->second);
+        if (param->get_partial_shape().same_scheme(shape))
             continue;
-        ::ngraph::PartialShape shape(inputShapes.at(param->get_friendly_name()));
-        auto newParam = std::make_shared<::ngraph::op::Parameter>(param->get_element_type(), shape);
-        newParam->set_friendly_name(param->get_friendly_name());
-        _ngraph_function->replace_parameter(i, newParam);
+        param->set_partial_shape(shape);
     }
-    _ngraph_function->validate_nodes_and_infer_types();
+    _ngraph_function->validate_changed_nodes_and_infer_types();
 
     {
-        auto specialized_ngraph_function = cloneFunction(false);
-        {
+        // Legacy conversion below only resolves dynamism and changes output precision of some
+        // operations, so a static function without such operations is used as is
+        const bool needsSpecialization = needsLegacySpecialization(_ngraph_function);
+        auto specialized_ngraph_function = needsSpecialization ? cloneFunction(false) : _ngraph_function;
+        if (needsSpecialization) {
             OV_ITT_SCOPED_TASK(itt::domains::IE, "CNNNetworkNGraphImpl::ConvertToLegacy");
             ::ngraph::pass::Manager manager;
             // resolves dynamism by replacing dynamic operation with static version
@@ -347,7 +368,7 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
                     specialized_ngraph_function);
             manager.run_passes(specialized_ngraph_function);
         }
-        specialized_ngraph_function->validate_nodes_and_infer_types();
+        specialized_ngraph_function->validate_changed_nodes_and_infer_types();
 
 #if 0
         for (const auto &op : specialized_ngraph_function->get_ordered_ops()) {
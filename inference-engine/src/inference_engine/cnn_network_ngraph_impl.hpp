@@ -91,6 +91,7 @@ private:
     InferenceEngine::InputsDataMap _inputData;
     std::map<std::string, DataPtr> _outputData;
     const std::vector<IExtensionPtr> _ie_extensions;
+    bool _smartReshapeApplied = false;
 
     /**
      * @brief Create DataPtr for nGraph operation
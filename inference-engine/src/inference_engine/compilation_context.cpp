@@ -0,0 +1,297 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_context.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <ie_version.hpp>
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/variant.hpp>
+
+#include "ie_itt.hpp"
+#include "file_utils.h"
+
+namespace InferenceEngine {
+
+namespace {
+
+// FNV-1a is used since the value is persisted on disk and must not depend on std::hash implementation
+struct Fnv1a64 {
+    std::uint64_t value = 0xcbf29ce484222325ull;
+
+    Fnv1a64& update(const char* data, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+            value ^= static_cast<std::uint8_t>(data[i]);
+            value *= 0x100000001b3ull;
+        }
+        return *this;
+    }
+
+    // weights are hashed by 8-byte words, it is several times faster on gigabytes of data
+    Fnv1a64& updateData(const char* data, std::size_t size) {
+        update(std::to_string(size));
+        std::size_t i = 0;
+        for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            value = (value ^ word) * 0x100000001b3ull;
+        }
+        return update(data + i, size - i);
+    }
+
+    Fnv1a64& update(const std::string& str) {
+        // size is added to avoid collisions of concatenated strings
+        auto size = static_cast<std::uint64_t>(str.size());
+        update(reinterpret_cast<const char*>(&size), sizeof(size));
+        return update(str.data(), str.size());
+    }
+};
+
+template <typename T>
+std::string toString(const T& value) {
+    std::stringstream str;
+    str << std::setprecision(17) << value;
+    return str.str();
+}
+
+/**
+ * @brief Hashes the attributes of an operation including the data of Constants, so the network is identified
+ * without serializing it to IR
+ */
+class HashVisitor : public ngraph::AttributeVisitor {
+public:
+    explicit HashVisitor(Fnv1a64& hash) : _hash(hash) {}
+
+    // unknown attributes cannot be hashed, so the network is not cached
+    bool _hashable = true;
+
+    void on_adapter(const std::string&, ngraph::ValueAccessor<void>&) override {
+        _hashable = false;
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        _hash.update(name).updateData(static_cast<const char*>(adapter.get_ptr()), adapter.size());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        _hash.update(name).update(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        _hash.update(name).update(toString(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        updateVector(name, adapter.get());
+    }
+
+private:
+    template <typename T>
+    void updateVector(const std::string& name, const std::vector<T>& values) {
+        _hash.update(name).update(std::to_string(values.size()));
+        for (auto&& value : values) {
+            _hash.update(toString(value));
+        }
+    }
+
+    Fnv1a64& _hash;
+};
+
+// the operations, their attributes and connections define the network, the order of get_ordered_ops() is stable
+bool updateWithFunction(Fnv1a64& hash, const ngraph::Function& function) {
+    std::unordered_map<const ngraph::Node*, std::size_t> indices;
+    for (auto&& node : function.get_ordered_ops()) {
+        // port descriptions of TensorIterator and Loop are not visible to the visitor
+        if (std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node)) {
+            return false;
+        }
+        indices.emplace(node.get(), indices.size());
+        const auto& typeInfo = node->get_type_info();
+        hash.update(typeInfo.name).update(std::to_string(typeInfo.version)).update(node->get_friendly_name());
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            hash.update(std::to_string(indices.at(source.get_node())))
+                .update(std::to_string(source.get_index()));
+        }
+        for (auto&& output : node->outputs()) {
+            hash.update(output.get_element_type().get_type_name())
+                .update(toString(output.get_partial_shape()));
+        }
+        // e.g. PrimitivesPriority affects the compilation
+        for (auto&& rtInfo : node->get_rt_info()) {
+            if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(rtInfo.second)) {
+                hash.update(rtInfo.first).update(value->get());
+            }
+        }
+        HashVisitor visitor{hash};
+        if (!node->visit_attributes(visitor) || !visitor._hashable) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// the options, the device and the Inference Engine build define the compiled network as well as the network itself
+void updateWithCompileOptions(Fnv1a64& hash, const std::string& deviceName,
+                              const std::map<std::string, std::string>& compileOptions) {
+    for (auto&& option : compileOptions) {
+        if (option.first == PluginConfigParams::KEY_CACHE_DIR)
+            continue;
+        hash.update(option.first).update(option.second);
+    }
+
+    hash.update(deviceName).update(GetInferenceEngineVersion()->buildNumber);
+}
+
+// the file content is hashed in chunks, so the weights are not loaded to the memory at once
+bool updateWithFile(Fnv1a64& hash, const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::vector<char> chunk(1 << 20);
+    while (file) {
+        file.read(chunk.data(), chunk.size());
+        hash.updateData(chunk.data(), static_cast<std::size_t>(file.gcount()));
+    }
+    return file.eof();
+}
+
+std::string toHex(const Fnv1a64& hash) {
+    std::stringstream result;
+    result << std::hex << std::setw(16) << std::setfill('0') << hash.value;
+    return result.str();
+}
+
+}  // namespace
+
+std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
+                                                   const std::string& deviceName,
+                                                   const std::map<std::string, std::string>& compileOptions) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeHash");
+
+    auto function = network.getFunction();
+    if (function == nullptr) {
+        return {};
+    }
+
+    Fnv1a64 hash;
+    if (!updateWithFunction(hash, *function)) {
+        return {};
+    }
+
+    // user-defined precisions, layouts and preprocessing are not a part of the ngraph function
+    for (auto&& input : network.getInputsInfo()) {
+        const auto& preProcess = input.second->getPreProcess();
+        if (preProcess.getMeanVariant() != MeanVariant::NONE) {
+            // mean values and images are not hashed
+            return {};
+        }
+        hash.update(input.first)
+            .update(input.second->getPrecision().name())
+            .update(std::to_string(input.second->getLayout()))
+            .update(std::to_string(preProcess.getResizeAlgorithm()))
+            .update(std::to_string(preProcess.getColorFormat()));
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        hash.update(output.first)
+            .update(output.second->getPrecision().name())
+            .update(std::to_string(output.second->getLayout()));
+    }
+
+    updateWithCompileOptions(hash, deviceName, compileOptions);
+    return toHex(hash);
+}
+
+std::string NetworkCompilationContext::computeHash(const std::string& modelPath,
+                                                   const std::string& deviceName,
+                                                   const std::map<std::string, std::string>& compileOptions) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeHash::File");
+
+    // reading the files is cheaper than parsing the model, so the weights content is hashed as well
+    Fnv1a64 hash;
+    if (!updateWithFile(hash, modelPath)) {
+        return {};
+    }
+
+    const auto ext = FileUtils::fileExt(modelPath);
+    if (ext == "xml") {
+        auto binPath = modelPath.substr(0, modelPath.size() - ext.size()) + "bin";
+        if (!updateWithFile(hash, binPath)) {
+            return {};
+        }
+    }
+
+    updateWithCompileOptions(hash, deviceName, compileOptions);
+    return toHex(hash);
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Helpers to identify compiled networks in the networks cache
+ * @file compilation_context.hpp
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include <ie_api.h>
+#include <cpp/ie_cnn_network.h>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Computes identifiers of compiled networks stored in KEY_CACHE_DIR
+ */
+struct INFERENCE_ENGINE_API_CLASS(NetworkCompilationContext) final {
+    /**
+     * @brief Computes a hash of a network which is going to be compiled for a device. The operations, their
+     * attributes, connections and Constants data are hashed in place, the network is not serialized
+     * @param network A network in ngraph representation
+     * @param deviceName A device name the network is compiled for
+     * @param compileOptions An effective config the network is compiled with: the LoadNetwork config merged
+     *        with the options set via Core::SetConfig
+     * @return A hex string with the hash value or empty string if the network cannot be hashed
+     *         (e.g. legacy representation, TensorIterator or Loop operations)
+     */
+    static std::string computeHash(const CNNNetwork& network,
+                                   const std::string& deviceName,
+                                   const std::map<std::string, std::string>& compileOptions);
+
+    /**
+     * @brief Computes a hash of a model file which is going to be compiled for a device without reading the model
+     * @param modelPath A path to the model file (IR .xml or ONNX); the IR .bin is expected next to the .xml
+     *        and its content is hashed as well
+     * @param deviceName A device name the network is compiled for
+     * @param compileOptions An effective config the network is compiled with
+     * @return A hex string with the hash value or empty string if the model file cannot be accessed
+     */
+    static std::string computeHash(const std::string& modelPath,
+                                   const std::string& deviceName,
+                                   const std::map<std::string, std::string>& compileOptions);
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,101 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_sse42/precision_utils_sse42.hpp"
+
+#include <nmmintrin.h>  // SSE 4.2
+
+#include "precision_utils.h"
+
+namespace InferenceEngine {
+
+// 4 x F16 (zero extended to 32 bit) -> 4 x F32
+static inline __m128 mm_cvtph_ps(__m128i u) {
+    const __m128i exp_mask_f16 = _mm_set1_epi32(0x7C00);
+    const __m128i sig_mask_f16 = _mm_set1_epi32(0x03FF);
+
+    __m128i s = _mm_slli_epi32(_mm_and_si128(u, _mm_set1_epi32(0x8000)), 16);
+    __m128i e = _mm_and_si128(u, exp_mask_f16);
+    __m128i m = _mm_and_si128(u, sig_mask_f16);
+
+    // normals: shift exp and mantissa to f32 position and change exp bias from 15 to 127
+    __m128i normal = _mm_add_epi32(_mm_slli_epi32(_mm_and_si128(u, _mm_set1_epi32(0x7FFF)), 23 - 10),
+                                   _mm_set1_epi32((127 - 15) << 23));
+
+    // NAN and INF: keep mantissa, NAN gets raised 10 bit to be align with intrin
+    __m128i is_nan = _mm_andnot_si128(_mm_cmpeq_epi32(m, _mm_setzero_si128()), _mm_set1_epi32(0x0200));
+    __m128i nan_inf = _mm_or_si128(_mm_slli_epi32(_mm_or_si128(m, is_nan), 23 - 10), _mm_set1_epi32(0x7F800000));
+
+    // zeros and denormals: mantissa * 2^-24 is exact in f32
+    __m128i denormal = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(m), _mm_set1_ps(1.0f / (1 << 24))));
+
+    __m128i r = _mm_blendv_epi8(normal, nan_inf, _mm_cmpeq_epi32(e, exp_mask_f16));
+    r = _mm_blendv_epi8(r, denormal, _mm_cmpeq_epi32(e, _mm_setzero_si128()));
+    return _mm_castsi128_ps(_mm_or_si128(r, s));
+}
+
+// 4 x F32 -> 4 x F16 (in low 16 bit), rounding to nearest, denormals are converted to 0
+static inline __m128i mm_cvtps_ph(__m128 x) {
+    const __m128i exp_mask_f32 = _mm_set1_epi32(0x7F800000);
+    // minimal positive normal f16 value and maximal f16 value in f32 format
+    const __m128 min16 = _mm_castsi128_ps(_mm_set1_epi32((127 - 14) << 23));
+    const __m128 max16 = _mm_castsi128_ps(_mm_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    __m128i u = _mm_castps_si128(x);
+    __m128i s = _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(0x8000));
+    __m128i a = _mm_and_si128(u, _mm_set1_epi32(0x7FFFFFFF));
+    __m128i e = _mm_and_si128(a, exp_mask_f32);
+
+    // NAN and INF
+    __m128i m = _mm_and_si128(a, _mm_set1_epi32(0x007FFFFF));
+    __m128i is_nan = _mm_andnot_si128(_mm_cmpeq_epi32(m, _mm_setzero_si128()), _mm_set1_epi32(0x0200));
+    __m128i nan_inf = _mm_or_si128(_mm_srli_epi32(a, 23 - 10), is_nan);
+
+    // add half ULP of f16 to round to nearest
+    __m128 half_ulp = _mm_mul_ps(_mm_castsi128_ps(e), _mm_castsi128_ps(_mm_set1_epi32((127 - 11) << 23)));
+    __m128 f = _mm_add_ps(_mm_castsi128_ps(a), half_ulp);
+
+    // change exp bias from 127 to 15 and round to f16
+    __m128i r = _mm_srli_epi32(_mm_sub_epi32(_mm_castps_si128(f), _mm_set1_epi32((127 - 15) << 23)), 23 - 10);
+    r = _mm_blendv_epi8(r, _mm_set1_epi32(((15 + 15) << 10) | 0x3FF), _mm_castps_si128(_mm_cmpge_ps(f, max16)));
+    r = _mm_blendv_epi8(r, _mm_set1_epi32(1 << 10), _mm_castps_si128(_mm_cmplt_ps(f, min16)));
+    r = _mm_blendv_epi8(r, _mm_setzero_si128(), _mm_castps_si128(_mm_cmplt_ps(f, _mm_mul_ps(min16, _mm_set1_ps(0.5f)))));
+    r = _mm_blendv_epi8(r, nan_inf, _mm_cmpeq_epi32(e, exp_mask_f32));
+    // NAN keeps the low 16 bit of the shifted f32 value like the scalar conversion
+    return _mm_and_si128(_mm_or_si128(r, s), _mm_set1_epi32(0xFFFF));
+}
+
+void f16tof32Arrays_sse42(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128 lo = mm_cvtph_ps(_mm_cvtepu16_epi32(h));
+        __m128 hi = mm_cvtph_ps(_mm_cvtepu16_epi32(_mm_srli_si128(h, 8)));
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(lo, vscale), vbias));
+        _mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_mul_ps(hi, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_sse42(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i lo = mm_cvtps_ph(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), vscale), vbias));
+        __m128i hi = mm_cvtps_ph(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), vscale), vbias));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi32(lo, hi));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace InferenceEngine
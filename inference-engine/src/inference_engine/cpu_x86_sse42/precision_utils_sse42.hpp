@@ -0,0 +1,23 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// FP16 <-> FP32 array conversions manually vectored for SSE 4.2,
+// results are bit exact with PrecisionUtils::f16tof32 / f32tof16
+//
+//------------------------------------------------------------------------
+
+void f16tof32Arrays_sse42(float* dst, const short* src, size_t nelem, float scale, float bias);
+
+void f32tof16Arrays_sse42(short* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace InferenceEngine
@@ -266,6 +266,31 @@ TensorDesc verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
     return TensorDesc{subBlobDesc.getPrecision(), blobDims, blobLayout};
 }
 
+TensorDesc verifyROIBatchedBlobInput(const Blob::Ptr& image, const std::vector<ROI>& rois) {
+    if (image == nullptr) {
+        THROW_IE_EXCEPTION << "Image must be a valid Blob object";
+    }
+
+    if (!image->is<MemoryBlob>() && !image->is<NV12Blob>() && !image->is<I420Blob>()) {
+        THROW_IE_EXCEPTION << "Image must be a MemoryBlob, an NV12Blob or an I420Blob object";
+    }
+
+    if (rois.empty()) {
+        THROW_IE_EXCEPTION << "ROIBatchedBlob cannot be created from empty vector of ROI";
+    }
+
+    const auto& imageDesc = image->getTensorDesc();
+    const auto imageLayout = imageDesc.getLayout();
+    if (imageLayout != NCHW && imageLayout != NHWC) {
+        THROW_IE_EXCEPTION << "Unsupported image layout - to be one of: [NCHW, NHWC]";
+    }
+
+    SizeVector blobDims = imageDesc.getDims();
+    blobDims[0] = rois.size();
+
+    return TensorDesc{imageDesc.getPrecision(), blobDims, imageLayout};
+}
+
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(const TensorDesc& tensorDesc): Blob(tensorDesc) {}
@@ -468,4 +493,25 @@ BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs)
     this->_blobs = std::move(blobs);
 }
 
+ROIBatchedBlob::ROIBatchedBlob(const Blob::Ptr& image, const std::vector<ROI>& rois)
+    : CompoundBlob(verifyROIBatchedBlobInput(image, rois)), _image(image), _rois(rois) {
+    // ROI blobs check that every region is inside of the image
+    this->_blobs.reserve(rois.size());
+    for (const auto& roi : rois) {
+        this->_blobs.push_back(image->createROI(roi));
+    }
+}
+
+const Blob::Ptr& ROIBatchedBlob::image() const noexcept {
+    return _image;
+}
+
+const std::vector<ROI>& ROIBatchedBlob::rois() const noexcept {
+    return _rois;
+}
+
+Blob::Ptr ROIBatchedBlob::createROI(const ROI&) const {
+    THROW_IE_EXCEPTION << "ROIBatchedBlob does not support creation of ROI blobs";
+}
+
 }  // namespace InferenceEngine
@@ -2,15 +2,23 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstdio>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 #include <istream>
+#include <fstream>
+#include <functional>
 #include <mutex>
+#include <unordered_set>
+#include <utility>
 
 #include <ie_core.hpp>
 #include <multi-device/multi_device_config.hpp>
+#include <auto_batch/auto_batch_config.hpp>
+#include <remote/remote_config.hpp>
 #include <ngraph/opsets/opset.hpp>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/graph_util.hpp>
@@ -22,6 +30,7 @@
 #include "ie_itt.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "compilation_context.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -46,6 +55,12 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG] = deviceName.substr(6);
+    } else if (deviceName_.find("REMOTE:") == 0) {
+        deviceName_ = "REMOTE";
+        config_[InferenceEngine::RemoteConfigParams::KEY_REMOTE_DEVICE_CONFIG] = deviceName.substr(7);
     } else {
         DeviceIDParser parser(deviceName_);
         deviceName_ = parser.getDeviceName();
@@ -175,6 +190,25 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    // device enumeration loads the plugins and probes the hardware, so its results are kept until reset
+    mutable std::map<std::string, std::vector<std::string>> availableDevices;
+    mutable std::map<std::pair<std::string, std::string>, Parameter> metricsCache;
+    mutable std::mutex devicesCacheMutex;  // to lock parallel access to availableDevices and metricsCache
+
+    static bool IsConstantMetric(const std::string& name) {
+        static const std::unordered_set<std::string> constantMetrics = {
+            METRIC_KEY(AVAILABLE_DEVICES),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(FULL_DEVICE_NAME),
+            METRIC_KEY(OPTIMIZATION_CAPABILITIES),
+            METRIC_KEY(RANGE_FOR_STREAMS),
+            METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
+            METRIC_KEY(IMPORT_EXPORT_SUPPORT)
+        };
+        return constantMetrics.count(name) != 0;
+    }
+
 public:
     Impl();
     ~Impl() override;
@@ -271,7 +305,79 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+
+        auto cacheDir = GetCacheDir(parsed._deviceName, parsed._config);
+        if (cacheDir.empty() || !DeviceSupportsImportExport(plugin)) {
+            return plugin.LoadNetwork(network, parsed._config);
+        }
+
+        auto blobId = NetworkCompilationContext::computeHash(network, parsed._deviceName,
+                                                             GetCompileConfig(parsed._deviceName, parsed._config));
+        if (blobId.empty()) {
+            return plugin.LoadNetwork(network, parsed._config);
+        }
+
+        return LoadNetworkWithCache(plugin, FileUtils::makePath(cacheDir, blobId + ".blob"), parsed._config,
+                                    [&] { return network; });
+    }
+
+    ExecutableNetwork LoadNetwork(const std::string& modelPath, const std::string& deviceName,
+                                  const std::map<std::string, std::string>& config) {
+        OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork::File");
+        auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+
+        auto cacheDir = GetCacheDir(parsed._deviceName, parsed._config);
+        auto blobId = (cacheDir.empty() || !DeviceSupportsImportExport(plugin)) ? std::string{} :
+            NetworkCompilationContext::computeHash(modelPath, parsed._deviceName,
+                                                   GetCompileConfig(parsed._deviceName, parsed._config));
+        if (blobId.empty()) {
+            return LoadNetwork(ReadNetwork(modelPath, std::string{}), deviceName, config);
+        }
+
+        // the model is read only if the compiled network is not found in the cache
+        return LoadNetworkWithCache(plugin, FileUtils::makePath(cacheDir, blobId + ".blob"), parsed._config,
+                                    [&] { return ReadNetwork(modelPath, std::string{}); });
+    }
+
+    /**
+     * @brief Imports a network from the cache entry or compiles it and stores to the entry
+     * @param plugin A plugin to compile the network with
+     * @param blobPath A path to the cache entry
+     * @param config A config to compile the network with
+     * @param getNetwork A function that returns the network to compile on the cache miss
+     * @return An executable network
+     */
+    ExecutableNetwork LoadNetworkWithCache(InferencePlugin& plugin, const std::string& blobPath,
+                                           const std::map<std::string, std::string>& config,
+                                           const std::function<CNNNetwork()>& getNetwork) {
+        if (FileUtils::fileExist(blobPath)) {
+            OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::Impl::LoadNetwork::ImportFromCache");
+            std::ifstream networkStream(blobPath, std::ios::binary);
+            try {
+                return plugin.ImportNetwork(networkStream, config);
+            } catch (const details::InferenceEngineException&) {
+                // cache entry is broken or was created by an incompatible plugin
+                // so network is compiled from scratch and the entry is overwritten below
+            }
+        }
+
+        auto executableNetwork = plugin.LoadNetwork(getNetwork(), config);
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::Impl::LoadNetwork::ExportToCache");
+            std::ofstream networkStream(blobPath, std::ios::binary);
+            try {
+                if (networkStream.is_open()) {
+                    executableNetwork.Export(networkStream);
+                }
+            } catch (const details::InferenceEngineException&) {
+                // caching is an optimization, so failures are not propagated to the user
+                networkStream.close();
+                std::remove(blobPath.c_str());
+            }
+        }
+        return executableNetwork;
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -319,10 +425,140 @@ public:
 
         auto parsed = parseDeviceNameIntoConfig(deviceName);
 
+        const bool cacheable = IsConstantMetric(name);
+        const auto key = std::make_pair(deviceName, name);
+        if (cacheable) {
+            std::lock_guard<std::mutex> lock(devicesCacheMutex);
+            auto it = metricsCache.find(key);
+            if (it != metricsCache.end()) {
+                return it->second;
+            }
+        }
+
         // we need to return a copy of Parameter object which is created on Core side,
         // not in InferenceEngine plugin side, which can be unloaded from Core in a parallel thread
         // TODO: remove this WA after *-31417 is resolved
-        return copyParameterValue(GetCPPPluginByName(parsed._deviceName).GetMetric(name, parsed._config));
+        auto value = copyParameterValue(GetCPPPluginByName(parsed._deviceName).GetMetric(name, parsed._config));
+        if (cacheable) {
+            std::lock_guard<std::mutex> lock(devicesCacheMutex);
+            metricsCache.emplace(key, value);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Returns devices IDs reported by a plugin as METRIC_KEY(AVAILABLE_DEVICES), the plugin is created and
+     * queried only if the devices are not cached yet
+     * @param deviceName A name of device
+     * @return A list of devices IDs, empty if the plugin can not be created e.g. in invalid environment
+     */
+    std::vector<std::string> GetAvailableDeviceIDs(const std::string& deviceName) const {
+        {
+            std::lock_guard<std::mutex> lock(devicesCacheMutex);
+            auto it = availableDevices.find(deviceName);
+            if (it != availableDevices.end()) {
+                return it->second;
+            }
+        }
+
+        std::vector<std::string> devicesIDs;
+        try {
+            devicesIDs = GetMetric(deviceName, METRIC_KEY(AVAILABLE_DEVICES)).as<std::vector<std::string>>();
+        } catch (details::InferenceEngineException&) {
+            // plugin is not created by e.g. invalid env
+        } catch (const std::exception& ex) {
+            THROW_IE_EXCEPTION << "An exception is thrown while trying to create the " << deviceName
+                               << " device and call GetMetric: " << ex.what();
+        } catch (...) {
+            THROW_IE_EXCEPTION << "Unknown exception is thrown while trying to create the " << deviceName
+                               << " device and call GetMetric";
+        }
+
+        std::lock_guard<std::mutex> lock(devicesCacheMutex);
+        availableDevices.emplace(deviceName, devicesIDs);
+        return devicesIDs;
+    }
+
+    /**
+     * @brief Drops the cached available devices and constant metrics
+     * @param deviceName A name of device (without ID) to drop the cache for, or empty to drop it for all the devices
+     */
+    void ResetDevicesCache(const std::string& deviceName) {
+        std::lock_guard<std::mutex> lock(devicesCacheMutex);
+        if (deviceName.empty()) {
+            availableDevices.clear();
+            metricsCache.clear();
+            return;
+        }
+        availableDevices.erase(deviceName);
+        for (auto it = metricsCache.begin(); it != metricsCache.end();) {
+            if (DeviceIDParser(it->first.first).getDeviceName() == deviceName) {
+                it = metricsCache.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns KEY_CACHE_DIR value passed to LoadNetwork or set via Core::SetConfig for a device
+     * @param deviceName A name of device
+     * @param config A config passed to LoadNetwork
+     * @return Cache directory or empty string if caching is disabled
+     */
+    std::string GetCacheDir(const std::string& deviceName, const std::map<std::string, std::string>& config) const {
+        auto it = config.find(KEY_CACHE_DIR);
+        if (it != config.end()) {
+            return it->second;
+        }
+
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        auto desc = pluginRegistry.find(deviceName);
+        if (desc != pluginRegistry.end()) {
+            auto cacheDir = desc->second.defaultConfig.find(KEY_CACHE_DIR);
+            if (cacheDir != desc->second.defaultConfig.end()) {
+                return cacheDir->second;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Returns the config a network is compiled with: the options set via Core::SetConfig for a device
+     * overridden by the config passed to LoadNetwork
+     * @param deviceName A name of device
+     * @param config A config passed to LoadNetwork
+     * @return The effective config
+     */
+    std::map<std::string, std::string> GetCompileConfig(const std::string& deviceName,
+                                                        const std::map<std::string, std::string>& config) const {
+        std::map<std::string, std::string> compileConfig;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto desc = pluginRegistry.find(deviceName);
+            if (desc != pluginRegistry.end()) {
+                compileConfig = desc->second.defaultConfig;
+            }
+        }
+        for (auto&& option : config) {
+            compileConfig[option.first] = option.second;
+        }
+        return compileConfig;
+    }
+
+    /**
+     * @brief Checks whether a plugin reports METRIC_KEY(IMPORT_EXPORT_SUPPORT)
+     * @param plugin A plugin to check
+     * @return `true` if networks imported by the plugin are not compiled again, so they can be stored in the cache
+     */
+    static bool DeviceSupportsImportExport(const InferencePlugin& plugin) {
+        try {
+            std::vector<std::string> supportedMetrics = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
+            auto it = std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+            return it != supportedMetrics.end() && plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+        } catch (const details::InferenceEngineException&) {
+            return false;
+        }
     }
 
     /**
@@ -394,13 +630,17 @@ public:
      * @param deviceName A name of device
      */
     void UnloadPluginByName(const std::string& deviceName) {
-        std::lock_guard<std::mutex> lock(pluginsMutex);
-        auto it = plugins.find(deviceName);
-        if (it == plugins.end()) {
-            THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
-        }
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto it = plugins.find(deviceName);
+            if (it == plugins.end()) {
+                THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            }
 
-        plugins.erase(deviceName);
+            plugins.erase(deviceName);
+        }
+        // the next plugin instance may see another set of devices
+        ResetDevicesCache(deviceName);
     }
 
     /**
@@ -552,6 +792,15 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
                 deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
             }
             deviceNames.push_back("MULTI");
+        } else if (deviceName.find("BATCH") == 0) {
+            auto pos = deviceName.find_first_of(":");
+            if (pos != std::string::npos) {
+                deviceNames.push_back(DeviceIDParser(deviceName.substr(pos + 1, deviceName.find_first_of("(") - pos - 1)).getDeviceName());
+            }
+            deviceNames.push_back("BATCH");
+        } else if (deviceName.find("REMOTE") == 0) {
+            // the device of the workers is not available locally
+            deviceNames.push_back("REMOTE");
         } else {
             deviceNames.push_back(deviceName);
         }
@@ -591,6 +840,11 @@ ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, const std::string
     return _impl->LoadNetwork(network, deviceName, config);
 }
 
+ExecutableNetwork Core::LoadNetwork(const std::string& modelPath, const std::string& deviceName,
+                                    const std::map<std::string, std::string>& config) {
+    return _impl->LoadNetwork(modelPath, deviceName, config);
+}
+
 void Core::AddExtension(const IExtensionPtr& extension) {
     _impl->AddExtension(extension);
 }
@@ -742,23 +996,8 @@ Parameter Core::GetMetric(const std::string& deviceName, const std::string& name
 std::vector<std::string> Core::GetAvailableDevices() const {
     std::vector<std::string> devices;
 
-    std::string propertyName = METRIC_KEY(AVAILABLE_DEVICES);
-
     for (auto&& deviceName : _impl->GetListOfDevicesInRegistry()) {
-        std::vector<std::string> devicesIDs;
-
-        try {
-            Parameter p = GetMetric(deviceName, propertyName);
-            devicesIDs = p.as<std::vector<std::string>>();
-        } catch (details::InferenceEngineException&) {
-            // plugin is not created by e.g. invalid env
-        } catch (const std::exception& ex) {
-            THROW_IE_EXCEPTION << "An exception is thrown while trying to create the " << deviceName
-                               << " device and call GetMetric: " << ex.what();
-        } catch (...) {
-            THROW_IE_EXCEPTION << "Unknown exception is thrown while trying to create the " << deviceName
-                               << " device and call GetMetric";
-        }
+        std::vector<std::string> devicesIDs = _impl->GetAvailableDeviceIDs(deviceName);
 
         if (devicesIDs.size() > 1) {
             for (auto&& deviceID : devicesIDs) {
@@ -772,6 +1011,10 @@ std::vector<std::string> Core::GetAvailableDevices() const {
     return devices;
 }
 
+void Core::ResetDevicesCache(const std::string& deviceName) {
+    _impl->ResetDevicesCache(DeviceIDParser(deviceName).getDeviceName());
+}
+
 void Core::RegisterPlugin(const std::string& pluginName, const std::string& deviceName) {
     _impl->RegisterPluginByName(pluginName, deviceName);
 }
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "system_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -131,6 +132,11 @@ void registerReaders() {
     if (irReaderv7)
         readers.emplace("xml", irReaderv7);
 
+    // try to load nGraph binary reader if library exists
+    auto binaryReader = create_if_exists("nGraphBinary", std::string("inference_engine_binary_reader") + std::string(IE_BUILD_POSTFIX));
+    if (binaryReader)
+        readers.emplace("ngbin", binaryReader);
+
     initialized = true;
 }
 
@@ -214,13 +220,24 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 size_t fileSize = binStream.tellg();
                 binStream.seekg(0, std::ios::beg);
 
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+                // map weights file into memory to avoid a copy on the heap and to share pages
+                // between processes which read the same model
+                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C },
+                                                              details::shared_from_irelease(new MmapAllocator(weights_path)));
                 weights->allocate();
 
-                binStream.read(weights->buffer(), fileSize);
+                if (weights->buffer() == nullptr) {
+                    // file cannot be mapped (e.g. empty file or unsupported file system), so read it into the heap
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+                    weights->allocate();
+                    binStream.read(weights->buffer(), fileSize);
+                }
 
                 binStream.close();
 
+                // weights blob lifetime is controlled by the network, so readers may refer to its memory
+                details::markWeightsAsShareable(modelStream);
+
                 // read model with weights
                 auto network = reader->read(modelStream, weights, exts);
                 modelStream.close();
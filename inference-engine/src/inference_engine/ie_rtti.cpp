@@ -41,6 +41,7 @@ MemoryBlob::~MemoryBlob() {}
 //
 ILayerImpl::~ILayerImpl() {}
 ILayerExecImpl::~ILayerExecImpl() {}
+ILayerEltwiseImpl::~ILayerEltwiseImpl() {}
 std::map<std::string, ngraph::OpSet> IExtension::getOpSets() {
     return {};
 }
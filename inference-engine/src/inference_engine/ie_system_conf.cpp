@@ -94,6 +94,14 @@ bool with_cpu_x86_bfloat16() {
 #endif
 }
 
+bool with_cpu_x86_avx512_core_vnni() {
+#ifdef ENABLE_MKL_DNN
+    return with_cpu_x86_avx512_core() && get_cpu_info().has(Xbyak::util::Cpu::tAVX512_VNNI);
+#else
+    return false;
+#endif
+}
+
 bool checkOpenMpEnvVars(bool includeOMPNumThreads) {
     for (auto&& var : {
         "GOMP_CPU_AFFINITY",
@@ -139,6 +147,8 @@ bool checkOpenMpEnvVars(bool includeOMPNumThreads) {
 // for Linux and Windows the getNumberOfCPUCores (that accounts only for physical cores) implementation is OS-specific
 // (see cpp files in corresponding folders), for __APPLE__ it is default :
 int getNumberOfCPUCores() { return parallel_get_max_threads();}
+int getNumberOfLogicalCPUCores() { return parallel_get_max_threads();}
+std::vector<int> getBigCoreProcessors() { return {}; }
 #if !((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() { return {0}; }
 #endif
@@ -147,7 +157,9 @@ std::vector<int> getAvailableNUMANodes() { return {0}; }
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() {
 #if TBB_INTERFACE_VERSION >= 11100
-    return tbb::info::numa_nodes();
+    // TBB parses the topology on every call
+    static const std::vector<int> nodes = tbb::info::numa_nodes();
+    return nodes;
 #else
     return {0};
 #endif
@@ -7,7 +7,10 @@
 #include <string>
 #include <vector>
 #include <iostream>
+#include <sstream>
 #include <sched.h>
+#include <unistd.h>
+#include <algorithm>
 #include "ie_system_conf.h"
 #include "ie_parallel.hpp"
 #include "details/ie_exception.hpp"
@@ -16,10 +19,58 @@
 
 namespace InferenceEngine {
 
+/* Returns the CPU limit of the cgroup (CFS quota over period rounded up), 0 if the process is not limited */
+static int getCgroupCpuLimit() {
+    auto limit = [] (long quota, long period) {
+        return (quota > 0 && period > 0) ? static_cast<int>((quota + period - 1) / period) : 0;
+    };
+    // the cgroup of the process, "0::<path>" line for the cgroup v2 and "<id>:<controllers>:<path>" for v1
+    std::string v2Path, v1Path;
+    std::ifstream cgroup("/proc/self/cgroup");
+    std::string line;
+    while (std::getline(cgroup, line)) {
+        auto first = line.find(':');
+        auto second = line.find(':', first + 1);
+        if (first == std::string::npos || second == std::string::npos) continue;
+        auto controllers = "," + line.substr(first + 1, second - first - 1) + ",";
+        if (0 == line.find("0::")) {
+            v2Path = line.substr(second + 1);
+        } else if (std::string::npos != controllers.find(",cpu,")) {
+            v1Path = line.substr(second + 1);
+        }
+    }
+    // inside of a container the own cgroup is usually mounted as the root
+    for (auto&& dir : {"/sys/fs/cgroup" + v2Path, std::string{"/sys/fs/cgroup"}}) {
+        std::ifstream file(dir + "/cpu.max");
+        std::string quota;
+        long period = 0;
+        if (file >> quota >> period) {
+            try {
+                return quota == "max" ? 0 : limit(std::stol(quota), period);
+            } catch (const std::exception&) {
+                return 0;
+            }
+        }
+    }
+    for (auto&& dir : {"/sys/fs/cgroup/cpu" + v1Path, std::string{"/sys/fs/cgroup/cpu"}}) {
+        std::ifstream quotaFile(dir + "/cpu.cfs_quota_us");
+        std::ifstream periodFile(dir + "/cpu.cfs_period_us");
+        long quota = 0, period = 0;
+        if (quotaFile >> quota && periodFile >> period) {
+            return limit(quota, period);
+        }
+    }
+    return 0;
+}
+
+/* The topology is detected once per process, so all the plugins and networks get the same answers */
 struct CPU {
     int _processors = 0;
     int _sockets    = 0;
     int _cores      = 0;
+    // logical processors and physical cores of the process affinity mask (cpuset), limited by the cgroup CPU quota
+    int _availableProcessors = 0;
+    int _availableCores      = 0;
 
     CPU() {
         std::ifstream cpuinfo("/proc/cpuinfo");
@@ -51,6 +102,34 @@ struct CPU {
         if (_cores == 0) {
             _cores = _processors;
         }
+
+        // the mask of the process rather than of the thread which happens to query the topology first
+        cpu_set_t usedCoreSet, currentCoreSet, currentCpuSet;
+        CPU_ZERO(&currentCpuSet);
+        CPU_ZERO(&usedCoreSet);
+        CPU_ZERO(&currentCoreSet);
+        if (0 != sched_getaffinity(getpid(), sizeof(currentCpuSet), &currentCpuSet)) {
+            for (int processorId = 0; processorId < _processors && processorId < CPU_SETSIZE; processorId++) {
+                CPU_SET(processorId, &currentCpuSet);
+            }
+        }
+        for (int processorId = 0; processorId < _processors && processorId < CPU_SETSIZE; processorId++) {
+            if (CPU_ISSET(processorId, &currentCpuSet)) {
+                unsigned coreId = processorId % _cores;
+                if (!CPU_ISSET(coreId, &usedCoreSet)) {
+                    CPU_SET(coreId, &usedCoreSet);
+                    CPU_SET(processorId, &currentCoreSet);
+                }
+            }
+        }
+        _availableProcessors = CPU_COUNT(&currentCpuSet);
+        _availableCores = CPU_COUNT(&currentCoreSet);
+
+        const int cpuLimit = getCgroupCpuLimit();
+        if (cpuLimit > 0) {
+            _availableProcessors = std::min(_availableProcessors, cpuLimit);
+            _availableCores = std::min(_availableCores, cpuLimit);
+        }
     }
 };
 static CPU cpu;
@@ -62,26 +141,43 @@ std::vector<int> getAvailableNUMANodes() {
 }
 #endif
 int getNumberOfCPUCores() {
-    unsigned numberOfProcessors = cpu._processors;
-    unsigned totalNumberOfCpuCores = cpu._cores;
-    IE_ASSERT(totalNumberOfCpuCores != 0);
-    cpu_set_t usedCoreSet, currentCoreSet, currentCpuSet;
-    CPU_ZERO(&currentCpuSet);
-    CPU_ZERO(&usedCoreSet);
-    CPU_ZERO(&currentCoreSet);
+    IE_ASSERT(cpu._cores != 0);
+    return cpu._availableCores;
+}
 
-    sched_getaffinity(0, sizeof(currentCpuSet), &currentCpuSet);
+int getNumberOfLogicalCPUCores() {
+    return cpu._availableProcessors;
+}
 
-    for (int processorId = 0; processorId < numberOfProcessors; processorId++) {
-        if (CPU_ISSET(processorId, &currentCpuSet)) {
-            unsigned coreId = processorId % totalNumberOfCpuCores;
-            if (!CPU_ISSET(coreId, &usedCoreSet)) {
-                CPU_SET(coreId, &usedCoreSet);
-                CPU_SET(processorId, &currentCoreSet);
+/* Parses kernel cpulist format, e.g. "0-15,20,22" */
+static std::vector<int> readCpuList(const std::string& path) {
+    std::vector<int> processors;
+    std::ifstream file(path);
+    std::string list;
+    if (!std::getline(file, list)) return processors;
+    std::stringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        if (range.empty()) continue;
+        try {
+            auto dash = range.find('-');
+            int first = std::stoi(range.substr(0, dash));
+            int last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+            for (int processor = first; processor <= last; processor++) {
+                processors.push_back(processor);
             }
+        } catch (const std::exception&) {
+            return {};
         }
     }
-    return CPU_COUNT(&currentCoreSet);
+    return processors;
+}
+
+std::vector<int> getBigCoreProcessors() {
+    // hybrid CPUs register a PMU device per core type, big cores are listed only if small cores are present as well
+    static const std::vector<int> bigCores = readCpuList("/sys/devices/cpu_atom/cpus").empty()
+        ? std::vector<int>{} : readCpuList("/sys/devices/cpu_core/cpus");
+    return bigCores;
 }
 
 }  // namespace InferenceEngine
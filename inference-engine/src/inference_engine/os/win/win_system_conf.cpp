@@ -9,7 +9,7 @@
 #include "ie_parallel.hpp"
 
 namespace InferenceEngine {
-int getNumberOfCPUCores() {
+static int getNumberOfPhysicalCores() {
     const int fallback_val = parallel_get_max_threads();
     DWORD sz = 0;
     // querying the size of the resulting structure, passing the nullptr for the buffer
@@ -31,9 +31,31 @@ int getNumberOfCPUCores() {
     return phys_cores;
 }
 
+// the topology is detected once per process
+int getNumberOfCPUCores() {
+    static const int cores = getNumberOfPhysicalCores();
+    return cores;
+}
+
+int getNumberOfLogicalCPUCores() {
+    static const int processors = [] {
+        DWORD_PTR processMask = 0, systemMask = 0;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask) || 0 == processMask)
+            return parallel_get_max_threads();
+        int count = 0;
+        for (; processMask != 0; processMask &= processMask - 1)
+            count++;
+        return count;
+    }();
+    return processors;
+}
+
 #if !(IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 // OMP/SEQ threading on the Windows doesn't support NUMA
 std::vector<int> getAvailableNUMANodes() { return std::vector<int>(1, 0); }
 #endif
 
+// core types of hybrid CPUs are not detected on Windows
+std::vector<int> getBigCoreProcessors() { return {}; }
+
 }  // namespace InferenceEngine
@@ -5,12 +5,23 @@
 #include "precision_utils.h"
 #include <details/ie_exception.hpp>
 
+#include "ie_system_conf.h"
+#ifdef HAVE_SSE
+#include "cpu_x86_sse42/precision_utils_sse42.hpp"
+#endif
+
 #include <stdint.h>
 
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
 void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        f16tof32Arrays_sse42(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
     const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
 
     for (size_t i = 0; i < nelem; i++) {
@@ -19,6 +30,12 @@ void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, flo
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        f32tof16Arrays_sse42(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
     for (size_t i = 0; i < nelem; i++) {
         dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
     }
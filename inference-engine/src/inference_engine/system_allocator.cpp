@@ -4,6 +4,27 @@
 
 #include "system_allocator.hpp"
 
+#include <cstdlib>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+# include <malloc.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#ifdef __linux__
+# include <sys/syscall.h>
+# include <climits>
+# include <vector>
+#endif
+
 namespace InferenceEngine {
 
 IAllocator* CreateDefaultAllocator() noexcept {
@@ -14,4 +35,267 @@ IAllocator* CreateDefaultAllocator() noexcept {
     }
 }
 
+IAllocator* CreateNumaAllocator(int numaNode) noexcept {
+    try {
+        return new NumaMemoryAllocator(numaNode);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+IAllocator* CreatePooledAllocator(bool hugePages) noexcept {
+    try {
+        return new PooledMemoryAllocator(hugePages);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 }  // namespace InferenceEngine
+
+namespace {
+
+constexpr size_t cacheLineSize = 64;
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+void* alignedAlloc(size_t size, size_t alignment) noexcept {
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    void* data = nullptr;
+    return posix_memalign(&data, alignment, size) == 0 ? data : nullptr;
+#endif
+}
+
+void alignedFree(void* data) noexcept {
+#ifdef _WIN32
+    _aligned_free(data);
+#else
+    std::free(data);
+#endif
+}
+
+}  // namespace
+
+PooledMemoryAllocator::~PooledMemoryAllocator() {
+    for (auto&& block : _cached)
+        alignedFree(block.second);
+}
+
+size_t PooledMemoryAllocator::blockSize(size_t size) const noexcept {
+    const size_t alignment = _hugePages && size >= hugePageSize ? hugePageSize : cacheLineSize;
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+size_t PooledMemoryAllocator::blockAlignment(size_t blockSize) const noexcept {
+    return _hugePages && blockSize >= hugePageSize ? hugePageSize : cacheLineSize;
+}
+
+void* PooledMemoryAllocator::alloc(size_t size) noexcept {
+    if (size == 0)
+        return nullptr;
+    const size_t bytes = blockSize(size);
+
+    try {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto found = _cached.find(bytes);
+        if (found != _cached.end()) {
+            void* data = found->second;
+            _sizes[data] = bytes;
+            _cached.erase(found);
+            _cachedBytes -= bytes;
+            return data;
+        }
+    } catch (...) {
+        return nullptr;
+    }
+
+    const size_t alignment = blockAlignment(bytes);
+    void* data = alignedAlloc(bytes, alignment);
+    if (data == nullptr)
+        return nullptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // pages are not touched yet, so they are backed by huge pages on the first write if THP is not disabled
+    if (alignment == hugePageSize)
+        madvise(data, bytes, MADV_HUGEPAGE);
+#endif
+
+    try {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _sizes[data] = bytes;
+    } catch (...) {
+        alignedFree(data);
+        return nullptr;
+    }
+    return data;
+}
+
+bool PooledMemoryAllocator::free(void* handle) noexcept {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto found = _sizes.find(handle);
+    if (found == _sizes.end())
+        return false;
+    const size_t bytes = found->second;
+    _sizes.erase(found);
+
+    if (_cachedBytes + bytes <= _maxCachedBytes) {
+        try {
+            _cached.emplace(bytes, handle);
+            _cachedBytes += bytes;
+            return true;
+        } catch (...) {
+        }
+    }
+    alignedFree(handle);
+    return true;
+}
+
+size_t PooledMemoryAllocator::cachedBytes() noexcept {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _cachedBytes;
+}
+
+#ifdef _WIN32
+
+void* MmapAllocator::alloc(size_t size) noexcept {
+    if (_mapping != nullptr || size == 0)
+        return nullptr;
+
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+    HANDLE file = CreateFileW(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    HANDLE file = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || static_cast<unsigned long long>(fileSize.QuadPart) < size) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    // PAGE_WRITECOPY + FILE_MAP_COPY give copy-on-write semantic
+    HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return nullptr;
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+    CloseHandle(mapping);
+    if (data == nullptr)
+        return nullptr;
+
+    _mapping = data;
+    _size = size;
+    return data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || handle != _mapping)
+        return false;
+    UnmapViewOfFile(_mapping);
+    _mapping = nullptr;
+    _size = 0;
+    return true;
+}
+
+void* NumaMemoryAllocator::alloc(size_t size) noexcept {
+    if (size == 0)
+        return nullptr;
+    void* data = nullptr;
+    if (_numaNode >= 0)
+        data = VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE,
+                                  static_cast<DWORD>(_numaNode));
+    if (data == nullptr)
+        data = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    return data;
+}
+
+bool NumaMemoryAllocator::free(void* handle) noexcept {
+    return handle != nullptr && VirtualFree(handle, 0, MEM_RELEASE);
+}
+
+#else
+
+void* MmapAllocator::alloc(size_t size) noexcept {
+    if (_mapping != nullptr || size == 0)
+        return nullptr;
+
+    int fd = open(_path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat sb = {};
+    if (fstat(fd, &sb) == -1 || static_cast<size_t>(sb.st_size) < size) {
+        close(fd);
+        return nullptr;
+    }
+
+    // private writable mapping gives copy-on-write semantic, so the file is never modified
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    _mapping = data;
+    _size = size;
+    return data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || handle != _mapping)
+        return false;
+    munmap(_mapping, _size);
+    _mapping = nullptr;
+    _size = 0;
+    return true;
+}
+
+void* NumaMemoryAllocator::alloc(size_t size) noexcept {
+    if (size == 0)
+        return nullptr;
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+#ifdef __linux__
+    // pages are not touched yet, so the policy defines where they are placed on the first write.
+    // On failure (e.g. a kernel without NUMA support) pages are placed by the default first-touch policy
+    if (_numaNode >= 0) {
+        try {
+            constexpr int mpolPreferred = 1;  // MPOL_PREFERRED from linux/mempolicy.h
+            const size_t bitsPerWord = sizeof(unsigned long) * CHAR_BIT;
+            const size_t node = static_cast<size_t>(_numaNode);
+            std::vector<unsigned long> nodeMask(node / bitsPerWord + 1, 0);
+            nodeMask[node / bitsPerWord] = 1ul << (node % bitsPerWord);
+            syscall(SYS_mbind, data, size, mpolPreferred, nodeMask.data(), nodeMask.size() * bitsPerWord + 1, 0);
+        } catch (...) {
+        }
+    }
+#endif
+
+    try {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _sizes[data] = size;
+    } catch (...) {
+        munmap(data, size);
+        return nullptr;
+    }
+    return data;
+}
+
+bool NumaMemoryAllocator::free(void* handle) noexcept {
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto found = _sizes.find(handle);
+        if (found == _sizes.end())
+            return false;
+        size = found->second;
+        _sizes.erase(found);
+    }
+    return 0 == munmap(handle, size);
+}
+
+#endif
@@ -5,6 +5,10 @@
 #pragma once
 
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include "ie_allocator.hpp"
 
@@ -36,4 +40,115 @@ public:
         }
         return true;
     }
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Allocator which places memory pages on a NUMA node
+ * @details Memory is mapped per allocation, so sizes of allocations are kept to release them
+ */
+class NumaMemoryAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit NumaMemoryAllocator(int numaNode) : _numaNode(numaNode) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void* a) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    int _numaNode = 0;
+    std::mutex _mutex;
+    std::unordered_map<void*, size_t> _sizes;
+};
+
+/**
+ * @brief Allocator which keeps freed blocks to reuse them for next allocations of the same size
+ * @details Blocks are aligned to the cache line. With huge pages, large blocks are aligned to the huge page size
+ * and transparent huge pages are requested for them. Cached blocks are limited in total size and released
+ * with the allocator.
+ */
+class PooledMemoryAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit PooledMemoryAllocator(bool hugePages, size_t maxCachedBytes = 256 * 1024 * 1024)
+        : _hugePages(hugePages), _maxCachedBytes(maxCachedBytes) {}
+
+    ~PooledMemoryAllocator() override;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void* a) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief Total size of freed blocks kept for reuse
+     */
+    size_t cachedBytes() noexcept;
+
+private:
+    size_t blockSize(size_t size) const noexcept;
+    size_t blockAlignment(size_t blockSize) const noexcept;
+
+    bool _hugePages = false;
+    size_t _maxCachedBytes = 0;
+    size_t _cachedBytes = 0;
+    std::mutex _mutex;
+    std::unordered_map<void*, size_t> _sizes;  // sizes of blocks in use
+    std::multimap<size_t, void*> _cached;      // freed blocks by size
+};
+
+/**
+ * @brief Allocator which maps a file into memory instead of allocating heap memory
+ * @details Pages are mapped copy-on-write, so they are shared between all the processes
+ * which map the same file until somebody writes to them. Only one mapping per allocator is supported.
+ */
+class MmapAllocator : public InferenceEngine::IAllocator {
+public:
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    using Path = std::wstring;
+#else
+    using Path = std::string;
+#endif
+
+    explicit MmapAllocator(const Path& path) : _path(path) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void* a) noexcept override {}
+
+    /**
+     * @brief Maps first `size` bytes of the file
+     * @return Pointer to the mapped memory or `nullptr` if the file cannot be mapped
+     */
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    Path _path;
+    size_t _size = 0;
+    void* _mapping = nullptr;
+};
@@ -10,6 +10,9 @@
 #include <thread>
 #include <queue>
 #include <atomic>
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <climits>
 #include <cassert>
 #include <utility>
@@ -33,6 +36,7 @@ struct CPUStreamsExecutor::Impl {
             int     _ncpus                  = 0;
             int     _threadBindingStep      = 0;
             int     _offset                 = 0;
+            std::vector<int> _processors;
             Observer(tbb::task_arena&    arena,
                      CpuSet              mask,
                      int                 ncpus,
@@ -46,8 +50,21 @@ struct CPUStreamsExecutor::Impl {
                 _threadBindingStep(threadBindingStep),
                 _offset{streamId * threadsPerStream  + threadBindingOffset} {
             }
+            Observer(tbb::task_arena&    arena,
+                     CpuSet              mask,
+                     int                 ncpus,
+                     std::vector<int>    processors) :
+                tbb::task_scheduler_observer(arena),
+                _mask{std::move(mask)},
+                _ncpus(ncpus),
+                _processors{std::move(processors)} {
+            }
             void on_scheduler_entry(bool) override {
-                PinThreadToVacantCore(_offset + tbb::task_arena::current_thread_index(), _threadBindingStep, _ncpus, _mask);
+                if (!_processors.empty()) {
+                    PinCurrentThreadToProcessor(tbb::task_arena::current_thread_index(), _processors);
+                } else {
+                    PinThreadToVacantCore(_offset + tbb::task_arena::current_thread_index(), _threadBindingStep, _ncpus, _mask);
+                }
             }
             void on_scheduler_exit(bool) override {
                 PinCurrentThreadByMask(_ncpus, _mask);
@@ -71,6 +88,9 @@ struct CPUStreamsExecutor::Impl {
                     (_streamId % _impl->_config._streams)/
                     ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()))
                 : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            if (ThreadBindingType::HYBRID_AWARE == _impl->_config._threadBindingType) {
+                _processors = _impl->_streamsProcessors.at(_streamId % _impl->_streamsProcessors.size());
+            }
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
@@ -79,6 +99,15 @@ struct CPUStreamsExecutor::Impl {
 #else
                 _taskArena.reset(new tbb::task_arena{concurrency});
 #endif
+            } else if (ThreadBindingType::HYBRID_AWARE == _impl->_config._threadBindingType) {
+                _taskArena.reset(new tbb::task_arena{concurrency});
+                CpuSet processMask;
+                int    ncpus = 0;
+                std::tie(processMask, ncpus) = GetProcessMask();
+                if (nullptr != processMask) {
+                    _observer.reset(new Observer{*_taskArena, std::move(processMask), ncpus, _processors});
+                    _observer->observe(true);
+                }
             } else if ((0 != _impl->_config._threadsPerStream) || (ThreadBindingType::CORES == _impl->_config._threadBindingType)) {
                 _taskArena.reset(new tbb::task_arena{concurrency});
                 if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
@@ -99,7 +128,11 @@ struct CPUStreamsExecutor::Impl {
             }
 #elif IE_THREAD == IE_THREAD_OMP
             omp_set_num_threads(_impl->_config._threadsPerStream);
-            if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
+            if (!checkOpenMpEnvVars(false) && (ThreadBindingType::HYBRID_AWARE == _impl->_config._threadBindingType)) {
+                parallel_nt(_impl->_config._threadsPerStream, [&] (int threadIndex, int threadsPerStream) {
+                    PinCurrentThreadToProcessor(threadIndex, _processors);
+                });
+            } else if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
                 CpuSet processMask;
                 int    ncpus = 0;
                 std::tie(processMask, ncpus) = GetProcessMask();
@@ -111,7 +144,9 @@ struct CPUStreamsExecutor::Impl {
                 }
             }
 #elif IE_THREAD == IE_THREAD_SEQ
-            if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
+            if (ThreadBindingType::HYBRID_AWARE == _impl->_config._threadBindingType) {
+                PinCurrentThreadToProcessor(0, _processors);
+            } else if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 PinCurrentThreadToSocket(_numaNodeId);
             } else if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
                 CpuSet processMask;
@@ -138,6 +173,7 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl     = nullptr;
         int _streamId   = 0;
         int _numaNodeId = 0;
+        std::vector<int> _processors;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -159,17 +195,26 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        if (ThreadBindingType::HYBRID_AWARE == _config._threadBindingType) {
+            _streamsProcessors = _config.GetStreamsProcessors();
+            // the CPU has a single type of cores, so the plain cores binding is used
+            if (_streamsProcessors.empty()) {
+                _config._threadBindingType = ThreadBindingType::CORES;
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
                     Task task;
+                    if (_config._spinWaitTime > 0) {
+                        SpinWait();
+                    }
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        _queueCondVar.wait(lock, [&] { return !IsQueueEmpty() || (stopped = _isStopped); });
+                        if (!IsQueueEmpty()) {
+                            task = PopTask();
                         }
                     }
                     if (task) {
@@ -180,14 +225,55 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, Priority priority) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueues.at(priority).push({std::move(task), std::chrono::steady_clock::now()});
+            ++_queuedTasks;
         }
         _queueCondVar.notify_one();
     }
 
+    bool IsQueueEmpty() const {
+        return std::all_of(_taskQueues.begin(), _taskQueues.end(), [] (const std::queue<QueuedTask>& queue) {
+            return queue.empty();
+        });
+    }
+
+    // takes the oldest task of the highest priority, each aging period of waiting raises the priority by one level
+    // so low priority tasks are not starved by a constant flow of high priority ones. Must be called under _mutex
+    Task PopTask() {
+        const auto now = std::chrono::steady_clock::now();
+        std::queue<QueuedTask>* selected = nullptr;
+        int64_t selectedPriority = -1;
+        for (int priority = HIGH; priority >= LOW; --priority) {
+            auto& queue = _taskQueues[priority];
+            if (queue.empty()) continue;
+            int64_t effectivePriority = priority;
+            if (_config._priorityAgingTime > 0) {
+                effectivePriority += std::chrono::duration_cast<std::chrono::milliseconds>(
+                    now - queue.front()._enqueueTime).count() / _config._priorityAgingTime;
+            }
+            if (effectivePriority > selectedPriority) {
+                selectedPriority = effectivePriority;
+                selected = &queue;
+            }
+        }
+        Task task = std::move(selected->front()._task);
+        selected->pop();
+        --_queuedTasks;
+        return task;
+    }
+
+    // polls the queues for the spin wait time, so a task that comes soon is taken without the thread wake-up latency
+    void SpinWait() {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(_config._spinWaitTime);
+        while (0 == _queuedTasks.load(std::memory_order_relaxed) && !_spinStopped.load(std::memory_order_relaxed) &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -223,9 +309,16 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    struct QueuedTask {
+        Task                                  _task;
+        std::chrono::steady_clock::time_point _enqueueTime;
+    };
+    std::array<std::queue<QueuedTask>, HIGH + 1> _taskQueues;
     bool                                    _isStopped = false;
+    std::atomic<int>                        _queuedTasks{0};
+    std::atomic<bool>                       _spinStopped{false};
     std::vector<int>                        _usedNumaNodes;
+    std::vector<std::vector<int>>           _streamsProcessors;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
 };
 
@@ -249,6 +342,7 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
         std::lock_guard<std::mutex> lock(_impl->_mutex);
         _impl->_isStopped = true;
     }
+    _impl->_spinStopped = true;
     _impl->_queueCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
@@ -262,10 +356,14 @@ void CPUStreamsExecutor::Execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run(std::move(task), NORMAL);
+}
+
+void CPUStreamsExecutor::run(Task task, Priority priority) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
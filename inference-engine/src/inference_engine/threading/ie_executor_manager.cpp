@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <string>
 #include <utility>
 
@@ -10,6 +13,75 @@
 #include "threading/ie_cpu_streams_executor.hpp"
 
 namespace InferenceEngine {
+namespace {
+// queues of users which have pending tasks in round-robin order
+struct FairShareScheduler {
+    using Queue = std::queue<Task>;
+
+    void Push(const std::shared_ptr<Queue>& queue, Task task) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        queue->push(std::move(task));
+        if (queue->size() == 1) {
+            _ready.push_back(queue);
+        }
+    }
+
+    // every pushed task is followed by one Pop call, so there is always a task to take
+    Task Pop() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto queue = std::move(_ready.front());
+        _ready.pop_front();
+        auto task = std::move(queue->front());
+        queue->pop();
+        if (!queue->empty()) {
+            _ready.push_back(std::move(queue));
+        }
+        return task;
+    }
+
+    std::mutex                          _mutex;
+    std::deque<std::shared_ptr<Queue>>  _ready;
+};
+
+// executor of a single user of the shared streams, any free stream runs the task of the next user in turn
+class SharedStreamsExecutor : public IStreamsExecutor {
+public:
+    SharedStreamsExecutor(const IStreamsExecutor::Ptr& executor, const std::shared_ptr<FairShareScheduler>& scheduler) :
+        _executor{executor},
+        _scheduler{scheduler},
+        _queue{std::make_shared<FairShareScheduler::Queue>()} {
+    }
+
+    void run(Task task) override {
+        run(std::move(task), NORMAL);
+    }
+
+    void run(Task task, Priority priority) override {
+        _scheduler->Push(_queue, std::move(task));
+        auto scheduler = _scheduler;
+        _executor->run([scheduler] {
+            scheduler->Pop()();
+        }, priority);
+    }
+
+    void Execute(Task task) override {
+        _executor->Execute(std::move(task));
+    }
+
+    int GetStreamId() override {
+        return _executor->GetStreamId();
+    }
+
+    int GetNumaNodeId() override {
+        return _executor->GetNumaNodeId();
+    }
+
+private:
+    IStreamsExecutor::Ptr                       _executor;
+    std::shared_ptr<FairShareScheduler>         _scheduler;
+    std::shared_ptr<FairShareScheduler::Queue>  _queue;
+};
+}  // namespace
 
 ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     std::lock_guard<std::mutex> guard(taskExecutorMutex);
@@ -35,7 +107,8 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
             executorConfig._threadsPerStream == config._threadsPerStream &&
             executorConfig._threadBindingType == config._threadBindingType &&
             executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+            executorConfig._threadBindingOffset == config._threadBindingOffset &&
+            executorConfig._spinWaitTime == config._spinWaitTime)
             return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
@@ -43,6 +116,19 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    auto executor = sharedStreamsExecutor.lock();
+    auto scheduler = std::static_pointer_cast<FairShareScheduler>(fairShareScheduler.lock());
+    if (nullptr == executor || nullptr == scheduler) {
+        executor = std::make_shared<CPUStreamsExecutor>(config);
+        scheduler = std::make_shared<FairShareScheduler>();
+        sharedStreamsExecutor = executor;
+        fairShareScheduler = scheduler;
+    }
+    return std::make_shared<SharedStreamsExecutor>(executor, scheduler);
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -131,4 +217,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedCPUStreamsExecutor(config);
+}
+
 }  // namespace InferenceEngine
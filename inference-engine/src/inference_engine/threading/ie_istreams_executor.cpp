@@ -9,27 +9,52 @@
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #include "ie_parameter.hpp"
+#include "threading/ie_thread_affinity.hpp"
 #include <string>
 #include <algorithm>
 #include <vector>
-#include <thread>
 
 
 namespace InferenceEngine {
+namespace {
+// splits processors of the process mask by core type, returns false if the CPU is not hybrid
+bool GetHybridProcessors(std::vector<int>& big, std::vector<int>& little) {
+    const auto bigCores = getBigCoreProcessors();
+    if (bigCores.empty())
+        return false;
+    CpuSet processMask;
+    int    ncpus = 0;
+    std::tie(processMask, ncpus) = GetProcessMask();
+    for (auto&& processor : GetMaskProcessors(ncpus, processMask)) {
+        if (std::binary_search(bigCores.begin(), bigCores.end(), processor)) {
+            big.push_back(processor);
+        } else {
+            little.push_back(processor);
+        }
+    }
+    return !big.empty();
+}
+}  // namespace
+
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::run(Task task, Priority) {
+    run(std::move(task));
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY(CPU_SPIN_WAIT_TIME),
     };
 }
 
 void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::string& value) {
         if (key == CONFIG_KEY(CPU_BIND_THREAD)) {
-            if (value == CONFIG_VALUE(YES) || value == CONFIG_VALUE(NUMA)) {
+            if (value == CONFIG_VALUE(YES) || value == CONFIG_VALUE(NUMA) || value == CONFIG_VALUE(HYBRID_AWARE)) {
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO) && (TBB_INTERFACE_VERSION < 11100)
                 if (value == CONFIG_VALUE(NUMA))
                     THROW_IE_EXCEPTION << CONFIG_KEY(CPU_BIND_THREAD) << " property value was set to NUMA. But IE was built with "
@@ -41,14 +66,19 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                 // on the Windows and Apple the CORES and NUMA pinning options are the same
                 _threadBindingType = IStreamsExecutor::ThreadBindingType::NUMA;
 #else
-                _threadBindingType = (value == CONFIG_VALUE(YES))
-                        ? IStreamsExecutor::ThreadBindingType::CORES : IStreamsExecutor::ThreadBindingType::NUMA;
+                if (value == CONFIG_VALUE(HYBRID_AWARE)) {
+                    _threadBindingType = IStreamsExecutor::ThreadBindingType::HYBRID_AWARE;
+                } else {
+                    _threadBindingType = (value == CONFIG_VALUE(YES))
+                            ? IStreamsExecutor::ThreadBindingType::CORES : IStreamsExecutor::ThreadBindingType::NUMA;
+                }
 #endif
             } else if (value == CONFIG_VALUE(NO)) {
                 _threadBindingType = IStreamsExecutor::ThreadBindingType::NONE;
             } else {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(CPU_BIND_THREAD)
-                                   << ". Expected only YES(binds to cores) / NO(no binding) / NUMA(binds to NUMA nodes)";
+                                   << ". Expected only YES(binds to cores) / NO(no binding) / NUMA(binds to NUMA nodes) / "
+                                   << "HYBRID_AWARE(binds to cores taking core types into account)";
             }
         } else if (key == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
             if (value == CONFIG_VALUE(CPU_THROUGHPUT_NUMA)) {
@@ -56,7 +86,7 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
             } else if (value == CONFIG_VALUE(CPU_THROUGHPUT_AUTO)) {
                 const int sockets = static_cast<int>(getAvailableNUMANodes().size());
                 // bare minimum of streams (that evenly divides available number of core)
-                const int num_cores = sockets == 1 ? std::thread::hardware_concurrency() : getNumberOfCPUCores();
+                const int num_cores = sockets == 1 ? getNumberOfLogicalCPUCores() : getNumberOfCPUCores();
                 if (0 == num_cores % 4)
                     _streams = std::max(4, num_cores / 4);
                 else if (0 == num_cores % 5)
@@ -106,6 +136,19 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                                    << ". Expected only non negative numbers (#threads)";
             }
             _threadsPerStream = val_i;
+        } else if (key == CONFIG_KEY(CPU_SPIN_WAIT_TIME)) {
+            int val_i;
+            try {
+                val_i = std::stoi(value);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(CPU_SPIN_WAIT_TIME)
+                                   << ". Expected only non negative numbers (microseconds)";
+            }
+            if (val_i < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(CPU_SPIN_WAIT_TIME)
+                                   << ". Expected only non negative numbers (microseconds)";
+            }
+            _spinWaitTime = val_i;
         } else {
             THROW_IE_EXCEPTION << "Wrong value for property key " << key;
         }
@@ -123,6 +166,9 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
             case IStreamsExecutor::ThreadBindingType::NUMA:
                 return {CONFIG_VALUE(NUMA)};
             break;
+            case IStreamsExecutor::ThreadBindingType::HYBRID_AWARE:
+                return {CONFIG_VALUE(HYBRID_AWARE)};
+            break;
         }
     } else if (key == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
         return {_streams};
@@ -130,6 +176,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {_threadsPerStream};
+    } else if (key == CONFIG_KEY(CPU_SPIN_WAIT_TIME)) {
+        return {_spinWaitTime};
     } else {
         THROW_IE_EXCEPTION << "Wrong value for property key " << key;
     }
@@ -141,12 +189,54 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
     const auto& numaNodes = getAvailableNUMANodes();
     const auto numaNodesNum = numaNodes.size();
     auto streamExecutorConfig = initial;
-    const auto hwCores = streamExecutorConfig._streams > 1 && numaNodesNum == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
+    // the parallel runtime may see more processors than the container CPU quota allows
+    const auto hwCores = streamExecutorConfig._streams > 1 && numaNodesNum == 1
+                         ? std::min(parallel_get_max_threads(), getNumberOfLogicalCPUCores()) : getNumberOfCPUCores();
     const auto threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : hwCores);
     streamExecutorConfig._threadsPerStream = streamExecutorConfig._streams
                                             ? std::max(1, threads/streamExecutorConfig._streams)
                                             : threads;
+    std::vector<int> big, little;
+    if (ThreadBindingType::HYBRID_AWARE == streamExecutorConfig._threadBindingType && streamExecutorConfig._streams <= 1 &&
+        0 == streamExecutorConfig._threads && 0 == envThreads && GetHybridProcessors(big, little)) {
+        // latency stream runs on big cores only, threads on small cores would delay every parallel region
+        streamExecutorConfig._threadsPerStream = std::min(streamExecutorConfig._threadsPerStream, static_cast<int>(big.size()));
+    }
     return streamExecutorConfig;
 }
 
+std::vector<std::vector<int>> IStreamsExecutor::Config::GetStreamsProcessors() const {
+    std::vector<std::vector<int>> streamsProcessors;
+    std::vector<int> big, little;
+    if (ThreadBindingType::HYBRID_AWARE != _threadBindingType || !GetHybridProcessors(big, little))
+        return streamsProcessors;
+
+    if (_streams <= 1) {
+        streamsProcessors.push_back(big);
+        return streamsProcessors;
+    }
+
+    const size_t threadsPerStream = static_cast<size_t>(std::max(1, _threadsPerStream));
+    std::vector<int> all = big;
+    all.insert(all.end(), little.begin(), little.end());
+    size_t bigOffset = 0, littleOffset = 0;
+    for (int streamId = 0; streamId < _streams; ++streamId) {
+        std::vector<int> processors;
+        if (bigOffset + threadsPerStream <= big.size()) {
+            processors.assign(big.begin() + bigOffset, big.begin() + bigOffset + threadsPerStream);
+            bigOffset += threadsPerStream;
+        } else if (littleOffset + threadsPerStream <= little.size()) {
+            processors.assign(little.begin() + littleOffset, little.begin() + littleOffset + threadsPerStream);
+            littleOffset += threadsPerStream;
+        } else {
+            // oversubscription: the streams share all processors in the round-robin scheme as in the cores binding
+            for (size_t thread = 0; thread < threadsPerStream; ++thread) {
+                processors.push_back(all[(streamId * threadsPerStream + thread) % all.size()]);
+            }
+        }
+        streamsProcessors.push_back(processors);
+    }
+    return streamsProcessors;
+}
+
 }  //  namespace InferenceEngine
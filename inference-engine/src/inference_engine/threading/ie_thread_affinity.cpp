@@ -94,6 +94,30 @@ bool PinCurrentThreadToSocket(int socket) {
     }
     return res;
 }
+
+std::vector<int> GetMaskProcessors(int ncores, const CpuSet& procMask) {
+    std::vector<int> processors;
+    if (procMask == nullptr)
+        return processors;
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    for (int processor = 0; processor < ncores; processor++) {
+        if (CPU_ISSET_S(processor, size, procMask.get()))
+            processors.push_back(processor);
+    }
+    return processors;
+}
+
+bool PinCurrentThreadToProcessor(int thrIdx, const std::vector<int>& processors) {
+    if (processors.empty())
+        return false;
+    const int processor = processors[thrIdx % processors.size()];
+    const int ncpus = processor + 1;
+    CpuSet targetMask{CPU_ALLOC(ncpus)};
+    const size_t size = CPU_ALLOC_SIZE(ncpus);
+    CPU_ZERO_S(size, targetMask.get());
+    CPU_SET_S(processor, size, targetMask.get());
+    return PinCurrentThreadByMask(ncpus, targetMask);
+}
 #else   // no threads pinning/binding on Win/MacOS
 std::tuple<CpuSet, int> GetProcessMask() {
     return std::make_tuple(nullptr, 0);
@@ -109,5 +133,11 @@ bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
 bool PinCurrentThreadToSocket(int socket) {
     return false;
 }
+std::vector<int> GetMaskProcessors(int ncores, const CpuSet& procMask) {
+    return {};
+}
+bool PinCurrentThreadToProcessor(int thrIdx, const std::vector<int>& processors) {
+    return false;
+}
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 }  //  namespace InferenceEngine
@@ -0,0 +1,17 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_thread_local.hpp"
+
+#include <atomic>
+
+namespace InferenceEngine {
+
+std::uint64_t NewThreadLocalId() {
+    // zero is never returned, so it may mark an empty entry of the caches of ThreadLocal
+    static std::atomic<std::uint64_t> lastId{0};
+    return ++lastId;
+}
+
+}  // namespace InferenceEngine
@@ -12,6 +12,7 @@
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 
 #include "iparams_manager.hpp"
 #include "ilayer_transformations_manager.hpp"
@@ -330,14 +331,7 @@ protected:
 
     template <typename Operation>
     void addSingleNodePattern(ngraph::pass::GraphRewrite& pass, TransformationContext& context) const {
-        using namespace ngraph;
-
-        auto is_op_type = [](std::shared_ptr<Node> n) {
-            return !!as_type_ptr<Operation>(n);
-        };
-        auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
-
-        addPattern(pass, context, p_node);
+        addPattern(pass, context, ngraph::pattern::wrap_type<Operation>());
     }
 };
 
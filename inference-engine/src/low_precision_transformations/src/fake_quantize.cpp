@@ -199,12 +199,9 @@ std::shared_ptr<opset1::FakeQuantize> FakeQuantizeTransformation::fuseElementwis
             constant :
             fold<opset1::Convert>(constant, eltwise->get_output_element_type(0));
 
-        const auto valueVec = as_type_ptr<opset1::Constant>(value)->cast_vector<float>();
         // TODO: temporary fix for GPU Plugin (inverted intervals)
-        for (const float& val : valueVec) {
-            if (val < 0) {
-                return nullptr;
-            }
+        if (!as_type_ptr<opset1::Constant>(value)->cast_all_of<float>([](const float val) { return val >= 0; })) {
+            return nullptr;
         }
 
         inputLowConst = fq::updateShape(fold<opset1::Divide>(inputLowConst, value), fakeQuantize->get_output_shape(0));
@@ -214,12 +211,9 @@ std::shared_ptr<opset1::FakeQuantize> FakeQuantizeTransformation::fuseElementwis
             constant :
             fold<opset1::Convert>(constant, eltwise->get_output_element_type(0));
 
-        const auto valueVec = as_type_ptr<opset1::Constant>(value)->cast_vector<float>();
         // TODO: temporary fix for GPU Plugin (inverted intervals)
-        for (const float& val : valueVec) {
-            if (val < 0) {
-                return nullptr;
-            }
+        if (!as_type_ptr<opset1::Constant>(value)->cast_all_of<float>([](const float val) { return val >= 0; })) {
+            return nullptr;
         }
 
         inputLowConst = fq::updateShape(fold<opset1::Multiply>(inputLowConst, value), fakeQuantize->get_output_shape(0));
@@ -264,14 +264,7 @@ bool NetworkHelper::isScalarLike(std::shared_ptr<opset1::Constant> constant) {
 bool NetworkHelper::isZero(std::shared_ptr<opset1::Constant> constant) {
     static const float minQuantizationShift = 1e-32f;
 
-    auto values = constant->cast_vector<float>();
-    for (size_t i = 0; i < values.size(); ++i) {
-        if (fabs(values[i]) > minQuantizationShift) {
-            return false;
-        }
-    }
-
-    return true;
+    return constant->cast_all_of<float>([](const float value) { return fabs(value) <= minQuantizationShift; });
 }
 
 std::shared_ptr<opset1::Constant> NetworkHelper::toScalar(std::shared_ptr<opset1::Constant> constant) {
@@ -476,8 +469,21 @@ std::shared_ptr<Node> NetworkHelper::foldFakeQuantize(
         //const size_t DHW = D * H * W;
         const size_t IDHW = IC * D * H * W;
 
-        const auto values = constant->cast_vector<float>();
-        std::vector<float> quantizedValues(OC * IC * D * H * W);
+        // f32 weights are read and written in place to keep only the source and the result in memory
+        const bool isF32Source = constant->get_element_type() == element::f32;
+        const std::vector<float> castedValues = isF32Source ? std::vector<float>() : constant->cast_vector<float>();
+        const float* values = isF32Source ? constant->get_data_ptr<float>() : castedValues.data();
+
+        std::shared_ptr<opset1::Constant> result;
+        std::vector<float> quantizedBuffer;
+        float* quantizedValues;
+        if (fq->get_output_element_type(0) == element::f32) {
+            result = std::make_shared<opset1::Constant>(element::f32, constShape);
+            quantizedValues = const_cast<float*>(result->get_data_ptr<float>());
+        } else {
+            quantizedBuffer.resize(OC * IC * D * H * W);
+            quantizedValues = quantizedBuffer.data();
+        }
 
         for (int oc = 0; oc < OC; ++oc) {
             for (int iidx = 0; iidx < IDHW; ++iidx) {
@@ -500,7 +506,10 @@ std::shared_ptr<Node> NetworkHelper::foldFakeQuantize(
             }
         }
 
-        return std::make_shared<opset1::Constant>(fq->get_output_element_type(0), constShape, quantizedValues);
+        if (result == nullptr) {
+            result = std::make_shared<opset1::Constant>(fq->get_output_element_type(0), constShape, quantizedBuffer);
+        }
+        return result;
     }
 
     return fq;
@@ -982,9 +991,7 @@ bool NetworkHelper::checkConstantValuePrecision(const element::Type expectedPrec
         return false;
     }
 
-    const auto values = constantOp->cast_vector<float>();
-    const bool convertCanBeRemoved =
-        (expectedPrecision.is_signed() || (std::all_of(values.begin(), values.end(), [](const float value) { return value >= 0.f; })));
+    const bool convertCanBeRemoved = constantOp->cast_all_of<float>([](const float value) { return value >= 0.f; });
     return convertCanBeRemoved;
 }
 
@@ -291,11 +291,7 @@ template <typename BaseOp>
 void make_matcher_type_relaxed(ngraph::pass::GraphRewrite* transformation) {
     using namespace ngraph;
 
-    auto is_op_type = [](std::shared_ptr<Node> n) {
-        return !!as_type_ptr<BaseOp>(n);
-    };
-
-    auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
+    auto p_node = pattern::wrap_type<BaseOp>();
 
     ngraph::graph_rewrite_callback callback = [](ngraph::pattern::Matcher &m) {
         auto l_node = std::dynamic_pointer_cast<BaseOp>(m.get_match_root());
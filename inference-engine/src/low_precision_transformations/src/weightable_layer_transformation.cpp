@@ -65,15 +65,18 @@ bool WeightableLayerTransformation::canBeTransformed(const TransformationContext
             return false;
         }
 
-        // exactly cast vector as original code has a conversion;
-        // optimize cast:
-        // two branches depending on real type of the constant?
-        const auto scalesBuffer = multiplyConst->cast_vector<float>();
-        size_t scalesBufferSize = shape_size(multiplyConst->get_output_shape(0));
-        for (size_t i = 1lu; i < scalesBufferSize; ++i) {
-            if (scalesBuffer[i - 1] != scalesBuffer[i]) {
-                return false;
+        // exactly cast values as original code has a conversion
+        bool isFirstScale = true;
+        float firstScale = 0.f;
+        const bool perTensorScale = multiplyConst->cast_all_of<float>([&](const float scale) {
+            if (isFirstScale) {
+                isFirstScale = false;
+                firstScale = scale;
             }
+            return scale == firstScale;
+        });
+        if (!perTensorScale) {
+            return false;
         }
     }
 
@@ -34,6 +34,25 @@ void precisionColoringBF16(const CNNLayerPtr layer,
     }
 }
 
+BF16Transformer::BF16Transformer(const std::vector<std::string> &fp32Layers)
+    : _fp32layers(fp32Layers.begin(), fp32Layers.end()) {}
+
+bool BF16Transformer::isFP32Layer(const CNNLayerPtr &layer) const {
+    return _fp32layers.find(layer->name) != _fp32layers.end() || _fp32layers.find(layer->type) != _fp32layers.end();
+}
+
+bool BF16Transformer::isInitBF16(const CNNLayerPtr &layer) const {
+    return _initbf16.find(layer->type) != _initbf16.end() && !isFP32Layer(layer);
+}
+
+bool BF16Transformer::isComplementBF16(const CNNLayerPtr &layer) const {
+    return _complementbf16.find(layer->type) != _complementbf16.end() && !isFP32Layer(layer);
+}
+
+bool BF16Transformer::isMultiInput(const CNNLayerPtr &layer) const {
+    return _multiinput.find(layer->type) != _multiinput.end() && !isFP32Layer(layer);
+}
+
 void BF16Transformer::convertToFloat(InferenceEngine::CNNNetwork &network) {
     // go over all edges and all edges having FP32 mark as BF16
     std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(network);
@@ -125,9 +144,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
     // 2b. go over all unknown layers for this algo and mark them as fp32 and add to the toAnalyzeTensors
     // 2c. go over all inputs to _initbf16 and if they are fp32 - add them to the toAnalyzeTensors
     for (auto iter : sortedLayers) {
-        if (_initbf16.find(iter->type) == _initbf16.end()
-            && _complementbf16.find(iter->type) == _complementbf16.end()
-            && _multiinput.find(iter->type) == _multiinput.end()) {
+        if (!isInitBF16(iter) && !isComplementBF16(iter) && !isMultiInput(iter)) {
             // try to mark inputs of the unknown layer
             for (size_t i = 0; i < iter->insData.size(); i++) {
                 if (iter->insData[i].lock()->getPrecision() == Precision::BF16) {
@@ -147,7 +164,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
                 }
             }
         }
-        if (_initbf16.find(iter->type) != _initbf16.end()) {
+        if (isInitBF16(iter)) {
             // verify if input activation tensor is not bf16 - add to toAnalyzeTensors as well
             // we are assuming here that _initbf16 contain only layers having one dynamic input
             // in other case algorithm should be changed to care about two dynamic input tensors
@@ -173,7 +190,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
         // look into producer of the tensor
         auto layer = getCreatorLayer(tensor).lock();
         // if this layer is not from _initbf16 - analyze inputs
-        if (_initbf16.find(layer->type) == _initbf16.end()) {
+        if (!isInitBF16(layer)) {
             // for all inputs investigate and modify tensor precision if required
             for (size_t i = 0; i < layer->insData.size(); i++) {
                 auto creator = getCreatorLayer(layer->insData[i].lock());
@@ -233,16 +250,14 @@ bool BF16Transformer::tryToMarkFP32(InferenceEngine::DataPtr data, const std::se
         // in other cases we need to mark tensor which is passed to several l ayers as FP32 only if there is at least one conusmer
         // produces data in FP32. I.e. there should be a way fo getting FP32 from output data to this point
         if (getInputTo(data).size() == 1) {
-            if (_initbf16.find(getInputTo(data).begin()->second->type) == _initbf16.end()) {
+            if (!isInitBF16(getInputTo(data).begin()->second)) {
                 marked = true;
             }
         } else {
             // get all consumers
             for (auto o : getInputTo(data)) {
                 // if tensor goes to several layers, we will mark it by FP32 only if one of the layer is unknown
-                if (_initbf16.find(o.second->type) == _initbf16.end() &&
-                    _complementbf16.find(o.second->type) == _complementbf16.end() &&
-                    _multiinput.find(o.second->type) == _multiinput.end()) {
+                if (!isInitBF16(o.second) && !isComplementBF16(o.second) && !isMultiInput(o.second)) {
                     marked = true;
                 }
             }
@@ -354,7 +369,7 @@ void BF16Transformer::insertConvertAfterInput(InferenceEngine::CNNNetwork &netwo
                     break;
                 }
                 auto bfInitLayer = bfInitIter.second;
-                if (_initbf16.find(bfInitLayer->type) != _initbf16.end()) {
+                if (isInitBF16(bfInitLayer)) {
                     if (CaselessEq<std::string>()(bfInitLayer->type, "convolution")) {
                         // TODO: have to be removed after adding suitable implementation for convolution
                         break;
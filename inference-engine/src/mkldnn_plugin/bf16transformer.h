@@ -8,6 +8,7 @@
 #include <caseless.hpp>
 #include <string>
 #include <set>
+#include <vector>
 #include <legacy/details/ie_cnn_network_tools.h>
 
 namespace MKLDNNPlugin {
@@ -30,6 +31,14 @@ class BF16Transformer {
     const InferenceEngine::details::caseless_set<std::string> _skipmarking =
         { "memory", "Split" };
 
+    // names or types of layers to be executed in FP32, they are handled as layers not supporting BF16
+    const InferenceEngine::details::caseless_set<std::string> _fp32layers;
+
+    bool isFP32Layer(const InferenceEngine::CNNLayerPtr &layer) const;
+    bool isInitBF16(const InferenceEngine::CNNLayerPtr &layer) const;
+    bool isComplementBF16(const InferenceEngine::CNNLayerPtr &layer) const;
+    bool isMultiInput(const InferenceEngine::CNNLayerPtr &layer) const;
+
     /**
     * Tries to mark tensor as FP32 by analyzing of local consumers of the tensor. Do not mark if
     *
@@ -48,6 +57,13 @@ class BF16Transformer {
     void insertConvertAfterInput(InferenceEngine::CNNNetwork &network);
 
 public:
+    BF16Transformer() = default;
+
+    /**
+     * @param fp32Layers names or types of layers which must not be executed in BF16
+     */
+    explicit BF16Transformer(const std::vector<std::string> &fp32Layers);
+
     /**
      * Restores Float point data types on edges which goes to non supported layers
      *
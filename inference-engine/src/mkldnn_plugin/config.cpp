@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
@@ -66,6 +67,24 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_PERF_COUNT
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_DETAILED_PERF_COUNT) {
+            if (val == PluginConfigParams::YES) collectDetailedPerfCounters = true;
+            else if (val == PluginConfigParams::NO) collectDetailedPerfCounters = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DETAILED_PERF_COUNT
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i <= 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD
+                                   << ". Expected only positive integer numbers";
+            perfCountPeriod = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigParams::KEY_CPU_TRACE_FILE) {
+            traceFile = val;
         } else if (key == PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) {
             if (val == PluginConfigParams::YES) exclusiveAsyncRequests = true;
             else if (val == PluginConfigParams::NO) exclusiveAsyncRequests = false;
@@ -94,6 +113,191 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
             dumpQuantizedGraphToIr = val;
+        } else if (key == PluginConfigParams::KEY_CACHE_DIR) {
+            // networks are cached by Core using Export / Import
+            cacheDir = val;
+        } else if (key == PluginConfigParams::KEY_CPU_CROSS_PROCESS_WEIGHTS) {
+            if (val == PluginConfigParams::YES) {
+#ifdef _WIN32
+                THROW_IE_EXCEPTION << "Property key " << PluginConfigParams::KEY_CPU_CROSS_PROCESS_WEIGHTS
+                    << " is not supported on this platform";
+#else
+                crossProcessWeights = true;
+#endif
+            } else if (val == PluginConfigParams::NO) {
+                crossProcessWeights = false;
+            } else {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CROSS_PROCESS_WEIGHTS
+                    << ". Expected only YES/NO";
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES) {
+            if (val == PluginConfigParams::YES) dynamicShapes = true;
+            else if (val == PluginConfigParams::NO) dynamicShapes = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE
+                                    << ". Expected only positive integer numbers";
+            }
+            if (val_i <= 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE
+                                    << ". Expected only positive integer numbers";
+            dynamicShapesCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_MIN_PARALLEL_WORK) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MIN_PARALLEL_WORK
+                                    << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MIN_PARALLEL_WORK
+                                    << ". Expected only non negative integer numbers";
+            minParallelWork = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigParams::KEY_CPU_CONV_AUTOTUNE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CONV_AUTOTUNE
+                                    << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CONV_AUTOTUNE
+                                    << ". Expected only non negative integer numbers";
+            convAutotuneCandidates = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigParams::KEY_CPU_NUMA_SHARDING_THRESHOLD) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_NUMA_SHARDING_THRESHOLD
+                                    << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_NUMA_SHARDING_THRESHOLD
+                                    << ". Expected only non negative integer numbers";
+            numaShardingThreshold = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigParams::KEY_CPU_REQUEST_PRIORITY) {
+            if (val == PluginConfigParams::CPU_REQUEST_PRIORITY_HIGH)
+                requestPriority = IStreamsExecutor::HIGH;
+            else if (val == PluginConfigParams::CPU_REQUEST_PRIORITY_NORMAL)
+                requestPriority = IStreamsExecutor::NORMAL;
+            else if (val == PluginConfigParams::CPU_REQUEST_PRIORITY_LOW)
+                requestPriority = IStreamsExecutor::LOW;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REQUEST_PRIORITY
+                    << ". Expected only " << PluginConfigParams::CPU_REQUEST_PRIORITY_HIGH << "/"
+                    << PluginConfigParams::CPU_REQUEST_PRIORITY_NORMAL << "/" << PluginConfigParams::CPU_REQUEST_PRIORITY_LOW;
+        } else if (key == PluginConfigParams::KEY_REQUEST_DEADLINE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_REQUEST_DEADLINE
+                                    << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_REQUEST_DEADLINE
+                                    << ". Expected only non negative integer numbers";
+            requestDeadline = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_SOLVER) {
+            if (val == PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY)
+                memorySolverStrategy = MemorySolver::Strategy::Greedy;
+            else if (val == PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT)
+                memorySolverStrategy = MemorySolver::Strategy::BestFit;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_SOLVER
+                    << ". Expected only " << PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY << "/"
+                    << PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT;
+        } else if (key == PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL) {
+            if (val == PluginConfigParams::YES) interOpParallel = true;
+            else if (val == PluginConfigParams::NO) interOpParallel = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS) {
+            if (val == PluginConfigParams::YES) sharedStreams = true;
+            else if (val == PluginConfigParams::NO) sharedStreams = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_INLINE_CALLBACKS) {
+            if (val == PluginConfigParams::YES) inlineCallbacks = true;
+            else if (val == PluginConfigParams::NO) inlineCallbacks = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INLINE_CALLBACKS
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_LAYOUT_PROPAGATION) {
+            if (val == PluginConfigParams::YES) layoutPropagation = true;
+            else if (val == PluginConfigParams::NO) layoutPropagation = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LAYOUT_PROPAGATION
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::YES) hugePages = true;
+            else if (val == PluginConfigParams::NO) hugePages = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HUGE_PAGES
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_WARMUP) {
+            if (val == PluginConfigParams::YES) warmup = true;
+            else if (val == PluginConfigParams::NO) warmup = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WARMUP
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_MAX_ISA) {
+            if (val.empty())
+                maxIsa = impl_desc_type::unknown;
+            else if (val == PluginConfigParams::CPU_ISA_SSE42)
+                maxIsa = impl_desc_type::sse42;
+            else if (val == PluginConfigParams::CPU_ISA_AVX)
+                maxIsa = impl_desc_type::avx;
+            else if (val == PluginConfigParams::CPU_ISA_AVX2)
+                maxIsa = impl_desc_type::avx2;
+            else if (val == PluginConfigParams::CPU_ISA_AVX512)
+                maxIsa = impl_desc_type::avx512;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MAX_ISA
+                    << ". Expected only " << PluginConfigParams::CPU_ISA_SSE42 << "/" << PluginConfigParams::CPU_ISA_AVX << "/"
+                    << PluginConfigParams::CPU_ISA_AVX2 << "/" << PluginConfigParams::CPU_ISA_AVX512 << " or empty string";
+        } else if (key == PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD) {
+            float val_f = -1.0f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                    << ". Expected only float numbers in [0, 1] range";
+            }
+            if (val_f < 0.0f || val_f > 1.0f)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                    << ". Expected only float numbers in [0, 1] range";
+            sparseWeightsThreshold = val_f;
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION) {
+            if (val.empty())
+                weightsCompressionBits = 0;
+            else if (val == PluginConfigParams::CPU_WEIGHTS_U8)
+                weightsCompressionBits = 8;
+            else if (val == PluginConfigParams::CPU_WEIGHTS_I4)
+                weightsCompressionBits = 4;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION
+                    << ". Expected only " << PluginConfigParams::CPU_WEIGHTS_U8 << "/" << PluginConfigParams::CPU_WEIGHTS_I4
+                    << " or empty string";
+        } else if (key == PluginConfigParams::KEY_CPU_BF16_FP32_LAYERS) {
+            bf16FP32Layers.clear();
+            std::istringstream stream(val);
+            std::string layer;
+            while (std::getline(stream, layer, ',')) {
+                if (!layer.empty())
+                    bf16FP32Layers.push_back(layer);
+            }
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_avx512_core())
@@ -128,11 +332,20 @@ void Config::updateProperties() {
             case IStreamsExecutor::ThreadBindingType::NUMA:
                 _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::NUMA });
             break;
+            case IStreamsExecutor::ThreadBindingType::HYBRID_AWARE:
+                _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::HYBRID_AWARE });
+            break;
         }
         if (collectPerfCounters == true)
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::NO });
+        if (collectDetailedPerfCounters == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_DETAILED_PERF_COUNT, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_DETAILED_PERF_COUNT, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD, std::to_string(perfCountPeriod) });
+        _config.insert({ PluginConfigParams::KEY_CPU_TRACE_FILE, traceFile });
         if (exclusiveAsyncRequests == true)
             _config.insert({ PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::YES });
         else
@@ -146,6 +359,86 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        _config.insert({ PluginConfigParams::KEY_CACHE_DIR, cacheDir });
+        if (dynamicShapes)
+            _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, std::to_string(dynamicShapesCacheSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_MIN_PARALLEL_WORK, std::to_string(minParallelWork) });
+        _config.insert({ PluginConfigParams::KEY_CPU_CONV_AUTOTUNE, std::to_string(convAutotuneCandidates) });
+        _config.insert({ PluginConfigParams::KEY_CPU_NUMA_SHARDING_THRESHOLD, std::to_string(numaShardingThreshold) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SPIN_WAIT_TIME, std::to_string(streamExecutorConfig._spinWaitTime) });
+        switch (requestPriority) {
+            case IStreamsExecutor::HIGH:
+                _config.insert({ PluginConfigParams::KEY_CPU_REQUEST_PRIORITY, PluginConfigParams::CPU_REQUEST_PRIORITY_HIGH });
+                break;
+            case IStreamsExecutor::LOW:
+                _config.insert({ PluginConfigParams::KEY_CPU_REQUEST_PRIORITY, PluginConfigParams::CPU_REQUEST_PRIORITY_LOW });
+                break;
+            default:
+                _config.insert({ PluginConfigParams::KEY_CPU_REQUEST_PRIORITY, PluginConfigParams::CPU_REQUEST_PRIORITY_NORMAL });
+        }
+        _config.insert({ PluginConfigParams::KEY_REQUEST_DEADLINE, std::to_string(requestDeadline) });
+        if (memorySolverStrategy == MemorySolver::Strategy::BestFit)
+            _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_SOLVER, PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_SOLVER, PluginConfigParams::CPU_MEMORY_SOLVER_GREEDY });
+        switch (maxIsa) {
+            case impl_desc_type::sse42:
+                _config.insert({ PluginConfigParams::KEY_CPU_MAX_ISA, PluginConfigParams::CPU_ISA_SSE42 });
+                break;
+            case impl_desc_type::avx:
+                _config.insert({ PluginConfigParams::KEY_CPU_MAX_ISA, PluginConfigParams::CPU_ISA_AVX });
+                break;
+            case impl_desc_type::avx2:
+                _config.insert({ PluginConfigParams::KEY_CPU_MAX_ISA, PluginConfigParams::CPU_ISA_AVX2 });
+                break;
+            case impl_desc_type::avx512:
+                _config.insert({ PluginConfigParams::KEY_CPU_MAX_ISA, PluginConfigParams::CPU_ISA_AVX512 });
+                break;
+            default:
+                _config.insert({ PluginConfigParams::KEY_CPU_MAX_ISA, "" });
+        }
+        _config.insert({ PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, std::to_string(sparseWeightsThreshold) });
+        if (weightsCompressionBits == 8)
+            _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::CPU_WEIGHTS_U8 });
+        else if (weightsCompressionBits == 4)
+            _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::CPU_WEIGHTS_I4 });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, "" });
+        if (interOpParallel)
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::NO });
+        if (sharedStreams)
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS, PluginConfigParams::NO });
+        if (inlineCallbacks)
+            _config.insert({ PluginConfigParams::KEY_CPU_INLINE_CALLBACKS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_INLINE_CALLBACKS, PluginConfigParams::NO });
+        if (layoutPropagation)
+            _config.insert({ PluginConfigParams::KEY_CPU_LAYOUT_PROPAGATION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_LAYOUT_PROPAGATION, PluginConfigParams::NO });
+        if (hugePages)
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::NO });
+        if (warmup)
+            _config.insert({ PluginConfigParams::KEY_CPU_WARMUP, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_WARMUP, PluginConfigParams::NO });
+        if (crossProcessWeights)
+            _config.insert({ PluginConfigParams::KEY_CPU_CROSS_PROCESS_WEIGHTS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_CROSS_PROCESS_WEIGHTS, PluginConfigParams::NO });
+        std::string fp32Layers;
+        for (auto&& layer : bf16FP32Layers)
+            fp32Layers += (fp32Layers.empty() ? "" : ",") + layer;
+        _config.insert({ PluginConfigParams::KEY_CPU_BF16_FP32_LAYERS, fp32Layers });
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
@@ -6,7 +6,10 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <threading/ie_istreams_executor.hpp>
+#include "mkldnn_memory_solver.hpp"
+#include "mkldnn/iml_type_mapper.h"
 
 namespace MKLDNNPlugin {
 
@@ -19,12 +22,47 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    bool collectDetailedPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool crossProcessWeights = false;
+    bool dynamicShapes = false;
+    bool interOpParallel = false;
+    bool sharedStreams = false;
+    bool inlineCallbacks = false;
+    // revise layouts of layout agnostic nodes to reduce reorders, see MKLDNNGraph::PropagateLayouts()
+    bool layoutPropagation = true;
+    // back weights and the memory arena by transparent huge pages
+    bool hugePages = false;
+    // run graphs of all streams once on zero inputs while the network is loaded
+    bool warmup = false;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
+    std::string cacheDir = "";
+    std::string traceFile = "";
+    std::vector<std::string> bf16FP32Layers;
     int batchLimit = 0;
+    // performance counters are collected on 1 of every perfCountPeriod inferences
+    size_t perfCountPeriod = 1;
+    int dynamicShapesCacheSize = 16;
+    // nodes with smaller tensors execute their loops sequentially
+    size_t minParallelWork = 0;
+    // number of best convolution implementations benchmarked at load time, 0 disables autotuning
+    size_t convAutotuneCandidates = 0;
+    // embedding tables of this size in MB and larger are sharded across NUMA nodes, 0 disables sharding
+    size_t numaShardingThreshold = 0;
+    MemorySolver::Strategy memorySolverStrategy = MemorySolver::Strategy::Greedy;
+    // one of impl_desc_type::sse42, avx, avx2, avx512, or unknown if not limited
+    impl_desc_type maxIsa = impl_desc_type::unknown;
+    // FullyConnected weights with at least this fraction of zeros use sparse implementation, 1 disables it
+    float sparseWeightsThreshold = 1.0f;
+    // bits of FullyConnected weights codes (8 or 4), 0 if weights are not compressed
+    int weightsCompressionBits = 0;
+    // priority of tasks of infer requests created by the network
+    InferenceEngine::IStreamsExecutor::Priority requestPriority = InferenceEngine::IStreamsExecutor::NORMAL;
+    // deadline of infer requests created by the network in milliseconds, 0 if there is no deadline
+    int requestDeadline = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -31,6 +31,10 @@ enum impl_desc_type {
     reorder = 1<<19,
     // winograd
     winograd = 1<<20,
+    // compressed sparse weights
+    sparse = 1<<21,
+    // weights quantized to low precision codes
+    compressed = 1<<22,
     // real types
     ref_any             = ref  | any,
 
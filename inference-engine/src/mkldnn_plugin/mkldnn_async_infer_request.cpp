@@ -3,17 +3,53 @@
 //
 
 #include "mkldnn_async_infer_request.h"
+#include <threading/ie_istreams_executor.hpp>
 #include <memory>
+#include <utility>
+
+namespace {
+// passes tasks of the request to the streams executor with the request priority
+struct PriorityTaskExecutor : public InferenceEngine::ITaskExecutor {
+    PriorityTaskExecutor(const InferenceEngine::IStreamsExecutor::Ptr& executor, InferenceEngine::IStreamsExecutor::Priority priority) :
+        _executor{executor}, _priority{priority} {}
+
+    void run(InferenceEngine::Task task) override {
+        _executor->run(std::move(task), _priority);
+    }
+
+    InferenceEngine::IStreamsExecutor::Ptr      _executor;
+    InferenceEngine::IStreamsExecutor::Priority _priority;
+};
+}  // namespace
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {}
+        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
+    auto priority = std::static_pointer_cast<MKLDNNInferRequest>(inferRequest)->getPriority();
+    auto streamsExecutor = std::dynamic_pointer_cast<InferenceEngine::IStreamsExecutor>(taskExecutor);
+    if (nullptr != streamsExecutor && InferenceEngine::IStreamsExecutor::NORMAL != priority) {
+        auto syncRequest = inferRequest.get();
+        _pipeline = {{std::make_shared<PriorityTaskExecutor>(streamsExecutor, priority), [syncRequest] {syncRequest->Infer();}}};
+    }
+    SetDeadline(std::static_pointer_cast<MKLDNNInferRequest>(inferRequest)->getDeadline());
+}
 
 void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
 }
 
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    auto syncRequest = std::static_pointer_cast<MKLDNNInferRequest>(_syncRequest);
+    syncRequest->markQueued();
+    try {
+        InferenceEngine::AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+    } catch (...) {
+        syncRequest->unmarkQueued();
+        throw;
+    }
+}
+
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
     StopAndWait();
 }
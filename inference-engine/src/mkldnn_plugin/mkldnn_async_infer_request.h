@@ -19,6 +19,8 @@ public:
 
     void Infer_ThreadUnsafe() override;
 
+    void StartAsync_ThreadUnsafe() override;
+
     ~MKLDNNAsyncInferRequest() override;
 };
 
@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_conv_autotune.h"
+
+namespace MKLDNNPlugin {
+
+bool ConvAutotuneCache::find(const std::string& key, impl_desc_type& type) const {
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = entries.find(key);
+    if (found == entries.end())
+        return false;
+    type = found->second;
+    return true;
+}
+
+void ConvAutotuneCache::insert(const std::string& key, impl_desc_type type) {
+    std::lock_guard<std::mutex> lock(guard);
+    entries[key] = type;
+}
+
+std::map<std::string, impl_desc_type> ConvAutotuneCache::getEntries() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return entries;
+}
+
+impl_desc_type ConvAutotuneCache::findOrTune(const std::string& key, const std::function<impl_desc_type()>& tune) {
+    impl_desc_type type = impl_desc_type::unknown;
+    if (find(key, type))
+        return type;
+
+    std::lock_guard<std::mutex> lock(tuneGuard);
+    // other stream could tune the same shape while we were waiting
+    if (find(key, type))
+        return type;
+    type = tune();
+    if (type != impl_desc_type::unknown)
+        insert(key, type);
+    return type;
+}
+
+}  // namespace MKLDNNPlugin
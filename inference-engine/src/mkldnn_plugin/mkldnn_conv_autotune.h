@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "mkldnn/iml_type_mapper.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Implementations of convolutions selected by load time benchmarking (KEY_CPU_CONV_AUTOTUNE).
+ *
+ * Key describes convolution shape and precisions, so each shape is benchmarked once per plugin.
+ * Results are valid for the host CPU model only and are exported with networks for it.
+ *
+ * Is a thread safe
+ */
+class ConvAutotuneCache {
+public:
+    typedef std::shared_ptr<ConvAutotuneCache> Ptr;
+
+    explicit ConvAutotuneCache(const std::string& hostName) : hostName(hostName) {}
+
+    const std::string& getHostName() const { return hostName; }
+
+    bool find(const std::string& key, impl_desc_type& type) const;
+    void insert(const std::string& key, impl_desc_type type);
+    std::map<std::string, impl_desc_type> getEntries() const;
+
+    /**
+     * Returns the cached implementation of the key or runs the tuner and caches its result.
+     * Tuners are serialized, so streams loading the same network don't benchmark concurrently.
+     */
+    impl_desc_type findOrTune(const std::string& key, const std::function<impl_desc_type()>& tune);
+
+private:
+    std::string hostName;
+    mutable std::mutex guard;
+    std::mutex tuneGuard;
+    std::map<std::string, impl_desc_type> entries;
+};
+
+}  // namespace MKLDNNPlugin
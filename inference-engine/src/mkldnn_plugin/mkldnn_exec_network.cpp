@@ -12,18 +12,26 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "bf16transformer.h"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
 #include <threading/ie_executor_manager.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <cpp_interfaces/exception2status.hpp>
+#include <transformations/serialize.hpp>
+#include <pugixml.hpp>
+#include <ngraph/chrome_trace.hpp>
+#include <ngraph/opsets/opset1.hpp>
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
 #include <algorithm>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <cstdint>
+#include <sstream>
 #include <legacy/details/ie_cnn_network_tools.h>
 
 using namespace MKLDNNPlugin;
@@ -39,15 +47,120 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const InferenceEngine::CNNNetwork &originalNetwork,
+                                     const ConvAutotuneCache::Ptr &autotuneCache) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
+    _numaNodesWeights(numaNodesWeights),
+    _autotuneCache(autotuneCache),
+    _originalNetwork{originalNetwork},
     _cfg{cfg},
     _name{network.getName()} {
-    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
+    _clonedNetwork = PrepareNetwork(network, _compressedWeights);
+    _blobsAllocator = InferenceEngine::details::shared_from_irelease(InferenceEngine::CreatePooledAllocator(true));
+
+    if (!_cfg.traceFile.empty()) {
+        ngraph::event::Manager::open(_cfg.traceFile);
+        ngraph::event::Manager::enable_event_tracing();
+    }
+
+    if (_cfg.batchLimit > 1) {
+        // check topology for applicability
+        if (!CanProcessDynBatch(*_clonedNetwork)) {
+            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
+        }
+    }
+
+    CreateExecutors();
+
+    _graphs = decltype(_graphs){[&] {
+        auto graph = CreateGraph(_clonedNetwork, _compressedWeights);
+        if (_cfg.warmup)
+            graph->Warmup();
+        return graph;
+    }};
+
+    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+
+    // Int8 layers without JIT kernels can be slower than FP32 ones, it is worth notifying a user about
+    for (auto&& nodeName : _graphs.begin()->get()->GetInt8NonJitNodes())
+        _performanceWarnings.push_back(nodeName + ": Int8 node is executed without JIT kernel");
+
+    for (auto&& sum : _graphs.begin()->get()->GetUnfusedInt8Sums())
+        _performanceWarnings.push_back(sum + ": Sum is not fused into Int8 Convolution");
+
+    // Save all MemoryLayer data tensors. Will use insight about mechanics
+    // of MemoryLayer implementation. It uses output edge of MemoryLayer
+    // producer as storage for tensor to keep it between infer calls.
+    if (_graphs.size() == 1) {
+        for (auto &node : _graphs.begin()->get()->GetNodes()) {
+            if (node->getType() == MemoryInput) {
+                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+                auto state_store = memoryNode->getStore();
+                auto state_name = memoryNode->getId();
+
+                // Remove suffix with pair ID. Internal information.
+                auto suffix_idx = state_name.find("/id=");
+                if (suffix_idx != std::string::npos)
+                    state_name = state_name.substr(0, suffix_idx);
+
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            }
+        }
+    }
+}
+
+void MKLDNNExecNetwork::CreateExecutors() {
+    _streamsProcessors.clear();
+    _streamThreads = 0;
+    if (_cfg.exclusiveAsyncRequests) {
+        // special case when all InferRequests are muxed into a single queue
+        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+    } else {
+        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
+        _streamThreads = static_cast<unsigned int>(streamsExecutorConfig._threadsPerStream);
+        if (_cfg.sharedStreams) {
+            streamsExecutorConfig._name = "CPUSharedStreamsExecutor";
+            _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(streamsExecutorConfig);
+        } else {
+            streamsExecutorConfig._name = "CPUStreamsExecutor";
+            _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+            // shared streams may be created by another network with different config, so they are not reported
+            const auto bigCores = getBigCoreProcessors();
+            for (auto&& processors : streamsExecutorConfig.GetStreamsProcessors()) {
+                const bool big = std::all_of(processors.begin(), processors.end(), [&](int processor) {
+                    return std::binary_search(bigCores.begin(), bigCores.end(), processor);
+                });
+                const bool little = std::none_of(processors.begin(), processors.end(), [&](int processor) {
+                    return std::binary_search(bigCores.begin(), bigCores.end(), processor);
+                });
+                std::stringstream stream;
+                stream << (big ? "big" : (little ? "little" : "mixed")) << ':';
+                for (size_t i = 0; i < processors.size(); i++) {
+                    stream << (i ? "," : "") << processors[i];
+                }
+                _streamsProcessors.push_back(stream.str());
+            }
+        }
+    }
+    if (_cfg.inlineCallbacks) {
+        // the last pipeline stage (with the callback) is called by the thread that finished the inference
+        _callbackExecutor = nullptr;
+    } else if (0 != _cfg.streamExecutorConfig._streams) {
+        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    } else {
+        _callbackExecutor = _taskExecutor;
+    }
+}
+
+InferenceEngine::details::CNNNetworkImplPtr MKLDNNExecNetwork::PrepareNetwork(const InferenceEngine::ICNNNetwork &network,
+                                                                              MKLDNNCompressedWeightsMap &compressedWeights) {
+    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::PrepareNetwork", "cloneNet");
 
     // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNet(network);
+    auto clonedNetwork = cloneNet(network);
 
     if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         // Check if network is INT8 or Binary.
@@ -64,16 +177,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
 
         if (with_cpu_x86_avx512_core() && isFloatModel) {
-            BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            BF16Transformer bf16Transformer(_cfg.bf16FP32Layers);
+            CNNNetwork cnnetwork(clonedNetwork);
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
             // Overwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-            if (cfg.enforceBF16 == true)
+            if (_cfg.enforceBF16 == true)
                 bf16Transformer.convertToBFloat16(cnnetwork);
         } else {
             BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            CNNNetwork cnnetwork(clonedNetwork);
             bf16Transformer.convertToFloat(cnnetwork);
         }
     }
@@ -96,9 +209,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         getCreatorLayer(newEdgeAfterLayer) = constLayer;
         getInputTo(newEdgeAfterLayer).clear();
 
-        _clonedNetwork->addData(constLayer->name.c_str(), newEdgeAfterLayer);
+        clonedNetwork->addData(constLayer->name.c_str(), newEdgeAfterLayer);
         IE_SUPPRESS_DEPRECATED_START
-        _clonedNetwork->addLayer(constLayer);
+        clonedNetwork->addLayer(constLayer);
         IE_SUPPRESS_DEPRECATED_END
 
         constLayer->outData.push_back(newEdgeAfterLayer);
@@ -106,7 +219,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         layer->insData.push_back(newEdgeAfterLayer);
     };
 
-    auto all_layers = details::CNNNetSortTopologically(*_clonedNetwork);
+    auto all_layers = details::CNNNetSortTopologically(*clonedNetwork);
     for (auto &layer : all_layers) {
         if (layer->type == "ScaleShift" && layer->insData.size() == 1) {
             Blob::Ptr scalesBlob = layer->blobs["weights"];
@@ -134,71 +247,127 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
     }
 
-    OV_ITT_TASK_SKIP(taskChain);
-
-    if (_cfg.batchLimit > 1) {
-        // check topology for applicability
-        if (!CanProcessDynBatch(*_clonedNetwork)) {
-            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
+    OV_ITT_TASK_NEXT(taskChain, "compressWeights");
+    if (_cfg.sparseWeightsThreshold < 1.0f || _cfg.weightsCompressionBits != 0) {
+        for (auto &layer : all_layers) {
+            auto fcLayer = std::dynamic_pointer_cast<FullyConnectedLayer>(layer);
+            if (fcLayer == nullptr)
+                continue;
+            auto compressed = MKLDNNFullyConnectedNode::compressWeights(*fcLayer, _cfg.sparseWeightsThreshold,
+                                                                        _cfg.weightsCompressionBits, _numaNodesWeights[0]);
+            if (!compressed.sparse && !compressed.quantized)
+                continue;
+            compressedWeights[fcLayer->name] = compressed;
+
+            // FP32 weights are not used by the graphs, the ones created by the transformations are released here.
+            // The ngraph node of the layer is referenced by the nodes of the next layers and keeps the weights
+            // constant alive, so the constant is detached from the node as well
+            fcLayer->_weights.reset();
+            fcLayer->blobs.erase("weights");
+            auto node = fcLayer->getNode();
+            if (node && node->get_input_size() > 1 &&
+                ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1))) {
+                node->input(1).replace_source_output(
+                    std::make_shared<ngraph::opset1::Constant>(node->get_input_element_type(1), ngraph::Shape{0}));
+            }
         }
     }
 
-    if (cfg.exclusiveAsyncRequests) {
-        // special case when all InferRequests are muxed into a single queue
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
-    } else {
-        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
-    }
-    if (0 != cfg.streamExecutorConfig._streams) {
-        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
-            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
-    } else {
-        _callbackExecutor = _taskExecutor;
-    }
+    OV_ITT_TASK_SKIP(taskChain);
 
-    _graphs = decltype(_graphs){[&] {
-        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
-        //       is fixed and does not change content of network passed (CVS-26420)
-        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
+    return clonedNetwork;
+}
 
-        auto graph = std::make_shared<MKLDNNGraph>();
-        {
-            std::unique_lock<std::mutex> lock{_cfgMutex};
-            graph->setConfig(_cfg);
-        }
-        int numaNode = 0;
-        auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
-        if (nullptr != streamExecutor) {
-            numaNode = streamExecutor->GetNumaNodeId();
-        }
+MKLDNNGraph::Ptr MKLDNNExecNetwork::CreateGraph(const InferenceEngine::details::CNNNetworkImplPtr &network,
+                                               const MKLDNNCompressedWeightsMap &compressedWeights) {
+    // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
+    //       is fixed and does not change content of network passed (CVS-26420)
+    auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*network));
 
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
-        return graph;
-    }};
+    auto graph = std::make_shared<MKLDNNGraph>();
+    {
+        std::unique_lock<std::mutex> lock{_cfgMutex};
+        graph->setConfig(_cfg);
+    }
+    graph->setConvAutotuneCache(_autotuneCache);
+    graph->setNumaShardedCache(_numaNodesWeights.numaSharded());
+    graph->setCompressedWeights(compressedWeights);
+    int numaNode = 0;
+    auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamExecutor) {
+        numaNode = streamExecutor->GetNumaNodeId();
+    }
 
-    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+    auto& weightsCache = _cfg.crossProcessWeights ? _numaNodesWeights.crossProcess(numaNode)
+                         : _cfg.hugePages ? _numaNodesWeights.hugePages(numaNode) : _numaNodesWeights[numaNode];
+    graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, weightsCache);
+    return graph;
+}
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : _graphs.begin()->get()->GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
+void MKLDNNExecNetwork::EnableDynamicShapes(ReshapeCallback reshapeCallback) {
+    if (_cfg.batchLimit > 0)
+        THROW_IE_EXCEPTION << "Dynamic shapes cannot be used together with dynamic batch";
+    if (!memoryStates.empty())
+        THROW_IE_EXCEPTION << "Dynamic shapes are not supported for networks with memory layers";
+    if (!_originalNetwork.getFunction())
+        THROW_IE_EXCEPTION << "Dynamic shapes are supported only for networks in ngraph representation";
+    _shapeCacheCapacity = static_cast<std::size_t>(_cfg.dynamicShapesCacheSize);
+    _reshapeCallback = std::move(reshapeCallback);
+}
 
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+bool MKLDNNExecNetwork::IsWithinShapeBounds(const std::string &inputName, const InferenceEngine::SizeVector &dims) const {
+    auto input = _networkInputs.find(inputName);
+    if (input == _networkInputs.end())
+        return false;
+    const auto& bounds = input->second->getTensorDesc().getDims();
+    if (bounds.size() != dims.size())
+        return false;
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i] == 0 || dims[i] > bounds[i])
+            return false;
+    }
+    return true;
+}
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
+MKLDNNGraph::Ptr MKLDNNExecNetwork::GetGraphForShapes(const InputShapes &shapes) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::GetGraphForShapes");
+    std::shared_ptr<ShapeVariant> variant;
+    {
+        std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+        auto found = std::find_if(_shapeVariants.begin(), _shapeVariants.end(),
+                                  [&](const std::shared_ptr<ShapeVariant>& v) { return v->shapes == shapes; });
+        if (found != _shapeVariants.end()) {
+            variant = *found;
+            // keep most recently used variants in the front
+            _shapeVariants.splice(_shapeVariants.begin(), _shapeVariants, found);
         }
     }
+
+    if (variant) {
+        _shapeCacheHits++;
+    } else {
+        _shapeCacheMisses++;
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::CompileShapeVariant");
+        CNNNetwork reshaped(InferenceEngine::cloneNetwork(_originalNetwork));
+        reshaped.reshape(shapes);
+
+        variant = std::make_shared<ShapeVariant>();
+        variant->shapes = shapes;
+        variant->network = PrepareNetwork(*_reshapeCallback(reshaped), variant->compressedWeights);
+        auto network = variant->network;
+        auto compressedWeights = variant->compressedWeights;
+        variant->graphs = decltype(variant->graphs){[this, network, compressedWeights] {
+            return CreateGraph(network, compressedWeights);
+        }};
+
+        std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+        _shapeVariants.push_front(variant);
+        while (_shapeVariants.size() > _shapeCacheCapacity)
+            _shapeVariants.pop_back();
+    }
+
+    // graph is owned by the caller as well, so it is alive even if the variant is evicted
+    return variant->graphs.local();
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -209,6 +378,12 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
     for (auto g : _graphs) {
         g->setProperty(properties);
     }
+    std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+    for (auto&& variant : _shapeVariants) {
+        for (auto g : variant->graphs) {
+            g->setProperty(properties);
+        }
+    }
 }
 
 InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
@@ -222,6 +397,202 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return _graphs.begin()->get()->dump();
 }
 
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    auto function = _originalNetwork.getFunction();
+    if (function == nullptr) {
+        THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED) << "CPU plugin can export only networks in ngraph representation";
+    }
+
+    // header with the information which is not a part of IR: compile config and user precisions / layouts
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+    cpuNode.append_attribute("name").set_value(_name.c_str());
+
+    auto configsNode = cpuNode.append_child("configs");
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        for (auto&& config : _cfg._config) {
+            if (config.first == PluginConfigParams::KEY_CACHE_DIR)
+                continue;
+            auto configNode = configsNode.append_child("config");
+            configNode.append_attribute("key").set_value(config.first.c_str());
+            configNode.append_attribute("value").set_value(config.second.c_str());
+        }
+    }
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& input : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(input.first.c_str());
+        inputNode.append_attribute("precision").set_value(input.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(input.second->getLayout()));
+        inputNode.append_attribute("resize").set_value(static_cast<int>(input.second->getPreProcess().getResizeAlgorithm()));
+        inputNode.append_attribute("color").set_value(static_cast<int>(input.second->getPreProcess().getColorFormat()));
+    }
+
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& output : _networkOutputs) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(output.first.c_str());
+        outputNode.append_attribute("precision").set_value(output.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(output.second->getLayout()));
+    }
+
+    // convolution implementations selected by benchmarking on this CPU model, they are reused on import
+    if (_cfg.convAutotuneCandidates != 0 && _autotuneCache) {
+        auto autotuneNode = cpuNode.append_child("autotune");
+        autotuneNode.append_attribute("host").set_value(_autotuneCache->getHostName().c_str());
+        for (auto&& entry : _autotuneCache->getEntries()) {
+            auto convNode = autotuneNode.append_child("conv");
+            convNode.append_attribute("key").set_value(entry.first.c_str());
+            convNode.append_attribute("impl").set_value(static_cast<int>(entry.second));
+        }
+    }
+
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile);
+    serializer.run_on_function(std::const_pointer_cast<ngraph::Function>(function));
+
+    for (auto&& content : {xmlFile.str(), binFile.str()}) {
+        auto dataSize = static_cast<std::uint64_t>(content.size());
+        networkModel.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+        networkModel.write(content.data(), content.size());
+    }
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION << "Error during CPU network export";
+    }
+}
+
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config) {
+    std::map<std::string, std::string> properties;
+    bool streamsChanged = false;
+    bool trimMemory = false;
+    int perfCountWindow = -1;
+    for (auto&& kvp : config) {
+        // the memory trimming is an action on the loaded network rather than its option
+        if (kvp.first == PluginConfigParams::KEY_CPU_TRIM_MEMORY) {
+            const auto value = kvp.second.as<std::string>();
+            if (value != PluginConfigParams::YES && value != PluginConfigParams::NO)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_TRIM_MEMORY
+                    << ". Expected only YES/NO";
+            trimMemory = value == PluginConfigParams::YES;
+            continue;
+        }
+        if (kvp.first == PluginConfigParams::KEY_CPU_PERF_COUNT_WINDOW) {
+            const auto value = kvp.second.as<std::string>();
+            try {
+                perfCountWindow = std::stoi(value);
+            } catch (const std::exception&) {
+                perfCountWindow = -1;
+            }
+            if (perfCountWindow < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_WINDOW
+                    << ". Expected only non-negative integer numbers";
+            continue;
+        }
+        // only options which are read when infer requests are created, and the streams, which are recreated
+        // from the compiled network, can be changed for a loaded network
+        if (kvp.first == PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS ||
+            kvp.first == PluginConfigParams::KEY_CPU_THREADS_NUM) {
+            streamsChanged = true;
+        } else if (kvp.first != PluginConfigParams::KEY_CPU_REQUEST_PRIORITY &&
+                   kvp.first != PluginConfigParams::KEY_REQUEST_DEADLINE &&
+                   kvp.first != PluginConfigParams::KEY_PERF_COUNT &&
+                   kvp.first != PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD) {
+            ExecutableNetworkThreadSafeDefault::SetConfig(config);
+        }
+        properties[kvp.first] = kvp.second.as<std::string>();
+    }
+    if (streamsChanged) {
+        RecreateStreams(properties);
+    } else {
+        setProperty(properties);
+    }
+    if (trimMemory)
+        TrimMemory();
+    if (perfCountWindow >= 0)
+        StartPerfCountWindow(std::chrono::milliseconds(perfCountWindow));
+}
+
+void MKLDNNExecNetwork::StartPerfCountWindow(std::chrono::milliseconds duration) {
+    for (auto g : _graphs) {
+        g->StartPerfCountWindow(duration);
+    }
+    std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+    for (auto&& variant : _shapeVariants) {
+        for (auto g : variant->graphs) {
+            g->StartPerfCountWindow(duration);
+        }
+    }
+}
+
+void MKLDNNExecNetwork::TrimMemory() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::TrimMemory");
+    // graphs are trimmed by their streams, so a graph is never trimmed in the middle of an inference
+    std::atomic<uint64_t> released{0};
+    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [&] {
+        released += _graphs.local()->TrimMemory();
+    }});
+    _trimmedMemorySize = released.load();
+}
+
+void MKLDNNExecNetwork::RecreateStreams(const std::map<std::string, std::string> &properties) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::RecreateStreams");
+    if (_cfg.exclusiveAsyncRequests || _cfg.sharedStreams)
+        THROW_IE_EXCEPTION << "Streams can not be changed for the network which uses exclusive async requests or shared streams";
+    if (!memoryStates.empty())
+        THROW_IE_EXCEPTION << "Streams can not be changed for the network with memory layers";
+    // requests keep the executor they were created with
+    if (_numRequests > 0)
+        THROW_IE_EXCEPTION << "Streams can be changed only while the network has no infer requests";
+
+    Config cfg;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        cfg = _cfg;
+    }
+    cfg.readProperties(properties);
+
+    // the network keeps working with the current streams if the new ones can not be created
+    auto oldCfg = _cfg;
+    auto oldTaskExecutor = _taskExecutor;
+    auto oldCallbackExecutor = _callbackExecutor;
+    auto oldStreamsProcessors = _streamsProcessors;
+    try {
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            _cfg = cfg;
+        }
+        CreateExecutors();
+        // the network is already transformed and the weights are taken from the weights cache,
+        // so only the graphs of the new streams are created
+        decltype(_graphs) graphs{[this] {
+            auto graph = CreateGraph(_clonedNetwork, _compressedWeights);
+            if (_cfg.warmup)
+                graph->Warmup();
+            return graph;
+        }};
+        _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [&] {graphs.local();}});
+        _graphs = std::move(graphs);
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            _cfg = oldCfg;
+        }
+        _taskExecutor = oldTaskExecutor;
+        _callbackExecutor = oldCallbackExecutor;
+        _streamsProcessors = oldStreamsProcessors;
+        throw;
+    }
+
+    // graphs compiled for other input shapes belong to the threads of the old streams
+    std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+    _shapeVariants.clear();
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -246,6 +617,26 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_MEMORY_ARENA_SIZE));
+        metrics.push_back(METRIC_KEY(CPU_MEMORY_ARENA_LOWER_BOUND));
+        metrics.push_back(METRIC_KEY(CPU_NODES_ISA));
+        metrics.push_back(METRIC_KEY(CPU_REORDERS_NUM));
+        metrics.push_back(METRIC_KEY(CPU_PERFORMANCE_WARNINGS));
+        metrics.push_back(METRIC_KEY(CPU_RUNTIME_STATISTICS));
+        if (IsDynamicShapesEnabled()) {
+            metrics.push_back(METRIC_KEY(CPU_SHAPE_CACHE_HITS));
+            metrics.push_back(METRIC_KEY(CPU_SHAPE_CACHE_MISSES));
+        }
+        if (!_streamsProcessors.empty()) {
+            metrics.push_back(METRIC_KEY(CPU_STREAMS_PROCESSORS));
+        }
+        if (_cfg.hugePages) {
+            metrics.push_back(METRIC_KEY(CPU_HUGE_PAGES_FRACTION));
+        }
+        metrics.push_back(METRIC_KEY(CPU_TRIMMED_MEMORY_SIZE));
+        if (_streamThreads != 0) {
+            metrics.push_back(METRIC_KEY(CPU_STREAM_THREADS));
+        }
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -260,6 +651,30 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_MEMORY_ARENA_SIZE)) {
+        IE_SET_METRIC_RETURN(CPU_MEMORY_ARENA_SIZE, static_cast<uint64_t>(_graphs.begin()->get()->GetArenaSize()));
+    } else if (name == METRIC_KEY(CPU_MEMORY_ARENA_LOWER_BOUND)) {
+        IE_SET_METRIC_RETURN(CPU_MEMORY_ARENA_LOWER_BOUND, static_cast<uint64_t>(_graphs.begin()->get()->GetArenaLowerBound()));
+    } else if (name == METRIC_KEY(CPU_NODES_ISA)) {
+        IE_SET_METRIC_RETURN(CPU_NODES_ISA, _graphs.begin()->get()->GetNodesIsa());
+    } else if (name == METRIC_KEY(CPU_REORDERS_NUM)) {
+        IE_SET_METRIC_RETURN(CPU_REORDERS_NUM, static_cast<unsigned int>(_graphs.begin()->get()->GetReordersNum()));
+    } else if (name == METRIC_KEY(CPU_PERFORMANCE_WARNINGS)) {
+        IE_SET_METRIC_RETURN(CPU_PERFORMANCE_WARNINGS, _performanceWarnings);
+    } else if (name == METRIC_KEY(CPU_RUNTIME_STATISTICS)) {
+        IE_SET_METRIC_RETURN(CPU_RUNTIME_STATISTICS, _runtimeStatistics.get());
+    } else if (name == METRIC_KEY(CPU_SHAPE_CACHE_HITS) && IsDynamicShapesEnabled()) {
+        IE_SET_METRIC_RETURN(CPU_SHAPE_CACHE_HITS, _shapeCacheHits.load());
+    } else if (name == METRIC_KEY(CPU_SHAPE_CACHE_MISSES) && IsDynamicShapesEnabled()) {
+        IE_SET_METRIC_RETURN(CPU_SHAPE_CACHE_MISSES, _shapeCacheMisses.load());
+    } else if (name == METRIC_KEY(CPU_HUGE_PAGES_FRACTION) && _cfg.hugePages) {
+        IE_SET_METRIC_RETURN(CPU_HUGE_PAGES_FRACTION, _graphs.begin()->get()->GetHugePagesFraction());
+    } else if (name == METRIC_KEY(CPU_TRIMMED_MEMORY_SIZE)) {
+        IE_SET_METRIC_RETURN(CPU_TRIMMED_MEMORY_SIZE, _trimmedMemorySize.load());
+    } else if (name == METRIC_KEY(CPU_STREAMS_PROCESSORS) && !_streamsProcessors.empty()) {
+        IE_SET_METRIC_RETURN(CPU_STREAMS_PROCESSORS, _streamsProcessors);
+    } else if (name == METRIC_KEY(CPU_STREAM_THREADS) && _streamThreads != 0) {
+        IE_SET_METRIC_RETURN(CPU_STREAM_THREADS, _streamThreads);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -8,8 +8,12 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_runtime_stats.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <chrono>
+#include <functional>
+#include <list>
 #include <vector>
 #include <memory>
 #include <map>
@@ -30,32 +34,122 @@ public:
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const InferenceEngine::CNNNetwork &originalNetwork = {},
+                      const ConvAutotuneCache::Ptr &autotuneCache = nullptr);
 
     ~MKLDNNExecNetwork() override = default;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void ExportImpl(std::ostream& networkModel) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
+    using InputShapes = std::map<std::string, InferenceEngine::SizeVector>;
+
+    /**
+     * @brief Callback which applies plugin transformations to the reshaped original network
+     */
+    using ReshapeCallback = std::function<InferenceEngine::ICNNNetwork::Ptr(const InferenceEngine::CNNNetwork&)>;
+
+    /**
+     * @brief Allows infer requests to use any input shapes which do not exceed dimensions of loaded network.
+     * Graphs for such shapes are compiled on the first use and are kept in a bounded cache.
+     */
+    void EnableDynamicShapes(ReshapeCallback reshapeCallback);
+
+    bool IsDynamicShapesEnabled() const {
+        return static_cast<bool>(_reshapeCallback);
+    }
+
+    bool IsWithinShapeBounds(const std::string& inputName, const InferenceEngine::SizeVector& dims) const;
+
+    /**
+     * @brief Returns graph of the calling stream compiled for given input shapes
+     */
+    MKLDNNGraph::Ptr GetGraphForShapes(const InputShapes& shapes);
+
+    /**
+     * @brief Graphs per stream (executor thread). All infer requests executed by a stream use its graph,
+     * so intermediate tensors are allocated once per stream, and only input / output blobs belong to requests.
+     */
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
 protected:
     friend class MKLDNNInferRequest;
+
+    struct ShapeVariant {
+        InputShapes                                     shapes;
+        InferenceEngine::details::CNNNetworkImplPtr     network;
+        MKLDNNCompressedWeightsMap                      compressedWeights;
+        InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  graphs;
+    };
+
+    void CreateExecutors();
+    /**
+     * @brief Recreates the streams executor and the graphs of the streams for new streams / threads numbers,
+     * reusing the transformed network and the shared weights
+     */
+    void RecreateStreams(const std::map<std::string, std::string> &properties);
+    /**
+     * @brief Clones and transforms the network for the graphs, weights of FullyConnected layers are compressed
+     * to compressedWeights if it is enabled by the config
+     */
+    InferenceEngine::details::CNNNetworkImplPtr PrepareNetwork(const InferenceEngine::ICNNNetwork &network,
+                                                               MKLDNNCompressedWeightsMap &compressedWeights);
+    MKLDNNGraph::Ptr CreateGraph(const InferenceEngine::details::CNNNetworkImplPtr &network,
+                                 const MKLDNNCompressedWeightsMap &compressedWeights);
+    /**
+     * @brief Returns intermediate memory of the graphs of the streams to the OS, it is faulted in again by
+     * the next inference. Graphs of busy streams are trimmed after their current inference
+     */
+    void TrimMemory();
+    /**
+     * @brief Starts the window of the performance counters collection in the graphs of all streams
+     */
+    void StartPerfCountWindow(std::chrono::milliseconds duration);
+
     MKLDNNExtensionManager::Ptr extensionManager;
+    NumaNodesWeights&           _numaNodesWeights;
+    ConvAutotuneCache::Ptr      _autotuneCache;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
+    MKLDNNCompressedWeightsMap                  _compressedWeights;
+    // network passed to Engine::LoadNetwork before any transformations, it is used by Export
+    InferenceEngine::CNNNetwork                 _originalNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    ReshapeCallback                             _reshapeCallback;
+    std::mutex                                  _shapeVariantsMutex;
+    // most recently used variants go first
+    std::list<std::shared_ptr<ShapeVariant>>    _shapeVariants;
+    std::size_t                                 _shapeCacheCapacity = 0;
+    std::atomic<unsigned int>                   _shapeCacheHits = {0};
+    std::atomic<unsigned int>                   _shapeCacheMisses = {0};
+    // bytes released by the last memory trimming
+    std::atomic<uint64_t>                       _trimmedMemorySize = {0};
+    // "<core type>:<processors>" per stream, filled for hybrid aware threads binding only
+    std::vector<std::string>                    _streamsProcessors;
+    // threads per stream of the own streams executor, 0 if the requests share the "CPU" executor
+    unsigned int                                _streamThreads = 0;
+    RuntimeStatistics                           _runtimeStatistics;
+    // see METRIC_KEY(CPU_PERFORMANCE_WARNINGS)
+    std::vector<std::string>                    _performanceWarnings;
+    // allocates input / output blobs of requests if they are not bound to NUMA nodes. Blobs of destroyed
+    // requests are reused by new requests instead of allocating memory again
+    std::shared_ptr<InferenceEngine::IAllocator> _blobsAllocator;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
@@ -12,6 +12,9 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <cstdint>
+#include <functional>
+#include <numeric>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -19,9 +22,14 @@
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
+#include "mkldnn_memory_trim.h"
+#include "mkldnn_huge_pages.h"
+#include "mkldnn_numa_sharding.h"
 #include "mkldnn_itt.h"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
+#include <nodes/mkldnn_conv_node.h>
 
 #include <legacy/graph_tools.hpp>
 #include <ie_algorithm.hpp>
@@ -33,6 +41,8 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <ngraph/chrome_trace.hpp>
 
 #include "utils/blob_dump.h"
 
@@ -93,8 +103,10 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
 
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable caching if graph was created only once, unless weights are shared with other processes
+    // or the cache allocates them with huge pages
+    weightsCache = config.streamExecutorConfig._streams != 1 || config.crossProcessWeights || config.hugePages
+                   ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -340,6 +352,9 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    if (config.layoutPropagation)
+        PropagateLayouts();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -381,6 +396,9 @@ void MKLDNNGraph::InitGraph() {
 #endif
 
     ExecuteConstantNodesOnly();
+
+    if (config.interOpParallel)
+        InitExecutionWaves();
 }
 
 void MKLDNNGraph::SetOriginalLayerNames() {
@@ -411,6 +429,16 @@ void MKLDNNGraph::SetOriginalLayerNames() {
 void MKLDNNGraph::InitNodes() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::InitNodes");
     for (auto &node : graphNodes) {
+        if (node->getType() == FullyConnected) {
+            auto *fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+            auto compressed = compressedWeights.find(node->getName());
+            if (fcNode && compressed != compressedWeights.end())
+                fcNode->setCompressedWeights(compressed->second);
+        } else if (node->getType() == Convolution) {
+            auto *convNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+            if (convNode)
+                convNode->setAutotune(config.convAutotuneCandidates, convAutotuneCache);
+        }
         node->init();
     }
 }
@@ -434,6 +462,8 @@ void MKLDNNGraph::InitDescriptors() {
 
         OV_ITT_TASK_NEXT(taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
         node->filterSupportedPrimitiveDescriptors();
+        if (config.maxIsa != impl_desc_type::unknown)
+            node->filterSupportedPrimitiveDescriptorsByIsa(config.maxIsa);
     }
 
     for (auto &node : graphNodes) {
@@ -442,6 +472,81 @@ void MKLDNNGraph::InitDescriptors() {
     }
 }
 
+// Number of elements to be reordered on the edge if the parent and the child use the given descriptors.
+// Constant tensors are reordered once on load network stage, so they are free.
+static size_t getReorderCost(const MKLDNNEdgePtr& edge, const TensorDesc& parentDesc, const TensorDesc& childDesc) {
+    if (edge->getParent()->isConstant() || MKLDNNExtensionUtils::initTensorsAreEqual(parentDesc, childDesc))
+        return 0;
+    return static_cast<size_t>(edge->getDims().size());
+}
+
+static size_t getReordersCost(const MKLDNNNodePtr& node, const InferenceEngine::LayerConfig& config) {
+    size_t cost = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        auto edge = node->getParentEdgeAt(i);
+        auto parentSPD = edge->getParent()->getSelectedPrimitiveDescriptor();
+        int inNum = edge->getInputNum();
+        int outNum = edge->getOutputNum();
+        if (!parentSPD || inNum < 0 || inNum >= parentSPD->getConfig().outConfs.size() ||
+                outNum < 0 || outNum >= config.inConfs.size())
+            continue;
+        cost += getReorderCost(edge, parentSPD->getConfig().outConfs[inNum].desc, config.inConfs[outNum].desc);
+    }
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto edge = node->getChildEdgeAt(i);
+        auto childSPD = edge->getChild()->getSelectedPrimitiveDescriptor();
+        int inNum = edge->getInputNum();
+        int outNum = edge->getOutputNum();
+        if (!childSPD || inNum < 0 || inNum >= config.outConfs.size() ||
+                outNum < 0 || outNum >= childSPD->getConfig().inConfs.size())
+            continue;
+        cost += getReorderCost(edge, config.outConfs[inNum].desc, childSPD->getConfig().inConfs[outNum].desc);
+    }
+    return cost;
+}
+
+void MKLDNNGraph::PropagateLayouts() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::PropagateLayouts");
+
+    // Nodes select descriptors in topological order matching the layouts of their parents only, so a layout agnostic
+    // node between nodes of different layouts follows its producer and the reorder is inserted before each consumer.
+    // Descriptors of such nodes are revised here to minimize the number of elements reordered on all the edges of
+    // the graph: each pass moves every node to the descriptor of the same implementation type with the least cost
+    // of reorders on its edges, so the total cost decreases until no node can improve it.
+    std::vector<MKLDNNNodePtr> layoutAgnosticNodes;
+    for (auto &node : graphNodes) {
+        if ((node->getType() == Eltwise || node->getType() == Quantize) && !node->isConstant() &&
+                node->getSelectedPrimitiveDescriptor() && node->getSupportedPrimitiveDescriptors().size() > 1)
+            layoutAgnosticNodes.push_back(node);
+    }
+
+    constexpr int maxPasses = 8;
+    bool changed = true;
+    for (int pass = 0; changed && pass < maxPasses; pass++) {
+        changed = false;
+        for (auto &node : layoutAgnosticNodes) {
+            auto selected = node->getSelectedPrimitiveDescriptor();
+            auto implType = selected->getImplementationType();
+            size_t bestCost = getReordersCost(node, selected->getConfig());
+            int bestIndex = -1;
+            const auto& supportedPDs = node->getSupportedPrimitiveDescriptors();
+            for (size_t i = 0; i < supportedPDs.size() && bestCost > 0; i++) {
+                if (&supportedPDs[i] == selected || supportedPDs[i].getImplementationType() != implType)
+                    continue;
+                size_t cost = getReordersCost(node, supportedPDs[i].getConfig());
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIndex = static_cast<int>(i);
+                }
+            }
+            if (bestIndex >= 0) {
+                node->selectPrimitiveDescriptorByIndex(bestIndex);
+                changed = true;
+            }
+        }
+    }
+}
+
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -453,11 +558,83 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 void MKLDNNGraph::ExecuteConstantNodesOnly() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+    if (sharedConstEdges.empty()) {
+        for (auto &graphNode : graphNodes) {
+            if (!graphNode->isConstant())
+                continue;
+            graphNode->execute(stream);
+        }
+        return;
+    }
+
+    // Key of a constant node output is a hash of the node names and the constant blobs of its subgraph,
+    // so graphs of the same network created for different streams find the data computed by the first one.
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    std::unordered_map<MKLDNNNode*, uint64_t> hashes;
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
             continue;
-        graphNode->execute(stream);
+        std::string seed = graphNode->getName();
+        auto input = std::dynamic_pointer_cast<MKLDNNInputNode>(graphNode);
+        if (input && input->getConstBlob()) {
+            const auto& blob = input->getConstBlob();
+            seed += "_" + std::to_string(hashFunc.hash(blob->cbuffer().as<const unsigned char*>(), blob->byteSize()));
+        }
+        for (size_t i = 0; i < graphNode->getParentEdges().size(); i++) {
+            auto edge = graphNode->getParentEdgeAt(i);
+            seed += "_" + std::to_string(hashes[edge->getParent().get()]) + ":" + std::to_string(edge->getInputNum());
+        }
+        hashes[graphNode.get()] = hashFunc.hash(reinterpret_cast<const unsigned char*>(seed.data()), seed.size());
+    }
+
+    std::unordered_set<MKLDNNNode*> executed;
+    std::function<void(const MKLDNNNodePtr&)> executeWithParents = [&](const MKLDNNNodePtr& node) {
+        if (!executed.insert(node.get()).second)
+            return;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            executeWithParents(node->getParentEdgeAt(i)->getParent());
+        node->execute(stream);
+    };
+
+    // Constant nodes whose results are used by not shared edges are executed as usual. It is done first,
+    // so nothing is written to the shared memory after the edges refer to it.
+    std::unordered_set<MKLDNNEdge*> shared;
+    for (auto &edge : sharedConstEdges)
+        shared.insert(edge.get());
+    std::unordered_set<MKLDNNNode*> needed;
+    for (auto it = graphNodes.rbegin(); it != graphNodes.rend(); it++) {
+        auto &graphNode = *it;
+        if (!graphNode->isConstant())
+            continue;
+        for (size_t i = 0; i < graphNode->getChildEdges().size(); i++) {
+            auto edge = graphNode->getChildEdgeAt(i);
+            auto child = edge->getChild();
+            if (!shared.count(edge.get()) && (!child->isConstant() || needed.count(child.get()))) {
+                needed.insert(graphNode.get());
+                break;
+            }
+        }
+    }
+    for (auto &graphNode : graphNodes) {
+        if (needed.count(graphNode.get()))
+            executeWithParents(graphNode);
     }
+
+    // The cache holds its lock while the data is computed, so a subgraph is executed by one graph only
+    for (auto &edge : sharedConstEdges) {
+        auto parent = edge->getParent();
+        auto& memory = edge->getMemory();
+        const std::string key = "const_" + std::to_string(hashes[parent.get()]) + "_" + std::to_string(edge->getInputNum());
+        auto sharedMemory = weightsCache->findOrCreate(key, eng, memory.GetDescriptor(), [&] () {
+            executeWithParents(parent);
+            auto ptr = weightsCache->createMemory(eng, memory.GetDescriptor());
+            ptr->SetData(memory, false);
+            return ptr;
+        });
+        memory.GetPrimitivePtr()->set_data_handle(sharedMemory->GetData());
+        sharedConstOutputs.push_back(sharedMemory);
+    }
+    sharedConstScratch.reset();
 }
 
 void MKLDNNGraph::InitEdges() {
@@ -499,6 +676,33 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+// Constant data produced by a node (not the constant blob itself) and consumed as is by the rest of the graph
+static inline bool isSharedConstOutput(MKLDNNEdgePtr edge) {
+    return isConstOutput(edge) && edge->getStatus() == MKLDNNEdge::Status::NeedAllocation &&
+           edge->getParent()->getType() != Input && edge->getChild()->getType() != Output;
+}
+
+// Size of a row of the constant table consumed by the edge if the table is to be sharded across NUMA nodes, 0 otherwise
+static size_t numaShardedRowSize(const MKLDNNEdgePtr& edge, size_t thresholdMb) {
+    static const std::unordered_set<std::string> tableConsumers = {
+        "Gather", "EmbeddingBagOffsetsSum", "EmbeddingBagPackedSum", "EmbeddingSegmentsSum"
+    };
+    const auto& layer = edge->getChild()->getCnnLayer();
+    const auto& dims = edge->getDesc().getDims();
+    if (thresholdMb == 0 || edge->getOutputNum() != 0 || !layer || !tableConsumers.count(layer->type) || dims.size() < 2)
+        return 0;
+    if (layer->type == "Gather") {
+        int axis = layer->GetParamAsInt("axis", 0);
+        if (axis != 0 && axis != -static_cast<int>(dims.size()))
+            return 0;
+    }
+    const size_t byteSize = edge->getDesc().getPrecision().size() *
+                            std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+    if (byteSize < (thresholdMb << 20))
+        return 0;
+    return byteSize / dims[0];
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
 
@@ -569,10 +773,26 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
-    std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    // Constant data consumed as is needs no place in the arena. Such an edge refers to the memory of
+    // the constant blob, which in turn refers to the ngraph Constant, so the weights are not copied.
+    std::vector<std::shared_ptr<MKLDNNInputNode>> constSources(edge_clasters.size());
+    for (int i = 0; i < edge_clasters.size(); i++) {
+        if (edge_clasters[i].size() != 1)
+            continue;
+        auto &edge = edge_clasters[i][0];
+        auto input = std::dynamic_pointer_cast<MKLDNNInputNode>(edge->getParent());
+        if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation && input && input->isConstant() &&
+                input->getChildEdges().size() == 1 && input->canShareConstBlob(edge->getDesc()))
+            constSources[i] = input;
+    }
+
+    std::vector<MemorySolver::Box> boxes;
+    std::vector<bool> constClasters(edge_clasters.size(), false);
     for (int i = 0; i < edge_clasters.size(); i++) {
-        MemorySolver::Box &box = boxes[i];
-        box = { std::numeric_limits<int>::max(), 0, 0, i };
+        if (constSources[i])
+            continue;
+        boxes.push_back({ std::numeric_limits<int>::max(), 0, 0, i });
+        MemorySolver::Box &box = boxes.back();
         for (auto &edge : edge_clasters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
@@ -608,6 +828,7 @@ void MKLDNNGraph::AllocateWithReuse() {
             isOutput |= edge->getChild()->getType() == Output;
             isInput  |= edge->getParent()->getType() == Input;
         }
+        constClasters[i] = isConst;
 
         if (reuse_io_tensors) {
             if (isInput | isConst) box.start = 0;
@@ -622,14 +843,84 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
+    // Outputs of constant subgraphs shared by the weights cache are computed in a temporary buffer
+    // and released after ExecuteConstantNodesOnly, so the arena keeps no copy of them.
+    std::vector<int64_t> sharedConstOffsets(edge_clasters.size(), -1);
+    int64_t sharedConstSize = 0;
+    sharedConstEdges.clear();
+    if (weightsCache) {
+        std::vector<MemorySolver::Box> arenaBoxes;
+        for (auto &box : boxes) {
+            auto &claster = edge_clasters[box.id];
+            if (claster.size() == 1 && isSharedConstOutput(claster[0])) {
+                sharedConstOffsets[box.id] = sharedConstSize;
+                sharedConstSize += box.size;
+                sharedConstEdges.push_back(claster[0]);
+            } else {
+                arenaBoxes.push_back(box);
+            }
+        }
+        boxes.swap(arenaBoxes);
+    }
+    if (sharedConstSize > 0) {
+        sharedConstScratch = std::make_shared<MKLDNNMemory>(eng);
+        sharedConstScratch->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {static_cast<size_t>(sharedConstSize * alignment)},
+                                                                 Layout::C)));
+    }
+
     MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    arenaLowerBound = static_cast<size_t>(memSolver.maxDepth()) * alignment;
+    size_t total_size = static_cast<size_t>(memSolver.solve(config.memorySolverStrategy)) * alignment;
+    arenaSize = total_size;
+
+    // constant data is computed once on load, so the trimming keeps it
+    arenaConstRanges.clear();
+    for (auto &box : boxes) {
+        if (constClasters[box.id])
+            arenaConstRanges.emplace_back(static_cast<size_t>(memSolver.getOffset(box.id) * alignment),
+                                          static_cast<size_t>(box.size * alignment));
+    }
+    std::sort(arenaConstRanges.begin(), arenaConstRanges.end());
 
-    memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    MKLDNNMemoryDesc workspaceDesc(TensorDesc(Precision::I8, {total_size}, Layout::C));
+    if (config.hugePages) {
+        memWorkspace = CreateHugePagesMemory(eng, workspaceDesc);
+    } else {
+        memWorkspace = std::make_shared<MKLDNNMemory>(eng);
+        memWorkspace->Create(workspaceDesc);
+    }
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    const auto numaNodes = config.numaShardingThreshold != 0 ? getAvailableNUMANodes() : std::vector<int>{};
 
     for (int i = 0; i < edge_clasters.size(); i++) {
+        if (constSources[i]) {
+            auto &edge = edge_clasters[i][0];
+            const auto &constBlob = constSources[i]->getConstBlob();
+            const size_t rowSize = numaShardedCache && numaNodes.size() > 1
+                                   ? numaShardedRowSize(edge, config.numaShardingThreshold) : 0;
+            if (rowSize == 0) {
+                edge->allocate(constBlob->cbuffer().as<const void*>());
+                continue;
+            }
+            // graphs of all NUMA nodes refer to the single sharded copy of the table
+            const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+            const std::string key = "sharded_" + constSources[i]->getName() + "_" +
+                std::to_string(hashFunc.hash(constBlob->cbuffer().as<const unsigned char*>(), constBlob->byteSize()));
+            auto table = numaShardedCache->findOrCreate(key, [&] () {
+                auto ptr = CreateNumaShardedMemory(eng, MKLDNNMemoryDesc(edge->getDesc()), rowSize, numaNodes);
+                cpu_memcpy_s(ptr->GetData(), ptr->GetSize(), constBlob->cbuffer().as<const void*>(), constBlob->byteSize());
+                return ptr;
+            });
+            edge->allocate(table->GetData());
+            constSources[i]->setConstDataPlaced();
+            numaShardedTables.push_back(table);
+            continue;
+        }
+        if (sharedConstOffsets[i] >= 0) {
+            auto* scratch_ptr = static_cast<int8_t*>(sharedConstScratch->GetData());
+            edge_clasters[i][0]->allocate(scratch_ptr + sharedConstOffsets[i] * alignment);
+            continue;
+        }
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
@@ -677,7 +968,7 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool applyMeanImage) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -687,7 +978,10 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
-        if (ext_data_ptr != inter_data_ptr) {
+        if (!MKLDNNMemory::IsDense(in->getTensorDesc())) {
+            // ROI and padded inputs are gathered by the reorder, without compacting them into a dense blob first
+            input->second->getChildEdgeAt(0)->getMemory().SetData(in->getTensorDesc(), ext_data_ptr, false);
+        } else if (ext_data_ptr != inter_data_ptr) {
             auto l = in->getTensorDesc().getLayout();
             if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
                 l = NCHW;
@@ -698,7 +992,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
+        if (applyMeanImage && _meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
@@ -710,6 +1004,43 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
+void MKLDNNGraph::PushBatchedInputData(const std::string& name, const InferenceEngine::BatchedBlob::Ptr &in, bool applyMeanImage) {
+    if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
+
+    auto input = inputNodes.find(name);
+    if (input == inputNodes.end())
+        THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' doesn't correspond to input in network";
+
+    const auto& desc = in->getTensorDesc();
+    auto& memory = input->second->getChildEdgeAt(0)->getMemory();
+    const size_t itemSize = in->getBlob(0)->byteSize();
+    // the batch is the outermost dimension of the input, so each item is copied to its own contiguous part of it
+    if (memory.GetFormat() != MKLDNNMemory::Convert(desc.getLayout()) ||
+        memory.GetDataType() != MKLDNNExtensionUtils::IEPrecisionToDataType(desc.getPrecision()) ||
+        memory.GetSize() != itemSize * in->size()) {
+        auto blob = make_blob_with_precision(desc);
+        blob->allocate();
+        auto* dst = blob->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < in->size(); i++)
+            cpu_memcpy(dst + i * itemSize, in->getBlob(i)->cbuffer().as<const uint8_t*>(), itemSize);
+        PushInputData(name, blob, applyMeanImage);
+        return;
+    }
+
+    auto* dst = static_cast<uint8_t*>(memory.GetData());
+    parallel_for(in->size(), [&](size_t i) {
+        cpu_memcpy(dst + i * itemSize, in->getBlob(i)->cbuffer().as<const uint8_t*>(), itemSize);
+    });
+
+    if (applyMeanImage && _meanImages.find(name) != _meanImages.end()) {
+        if (desc.getPrecision() == InferenceEngine::Precision::FP32) {
+            _meanImages[name].Subtract(input->second->getChildEdgeAt(0)->getDims(), reinterpret_cast<float *>(dst), desc.getLayout());
+        } else {
+            THROW_IE_EXCEPTION << "Mean image of type " << desc.getPrecision().name() << " is unsupported";
+        }
+    }
+}
+
 void MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
@@ -760,34 +1091,235 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch, bool collectPerf) {
+    PerfHelper perf(node->PerfCounter(), collectPerf);
+    ngraph::event::Duration traceEvent(node->getName(), "node");
+
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
+
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+    if (!node->isConstant()) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+        // parallel scheduling of small nodes takes longer than their work
+        const bool sequential = config.minParallelWork != 0 && node->getParallelWorkAmount() < config.minParallelWork;
+        InferenceEngine::parallel_grain_scope grain(sequential ? std::numeric_limits<size_t>::max() : 1);
+        if (collectPerf) {
+            InferenceEngine::details::parallel_stats stats;
+            {
+                InferenceEngine::parallel_stats_scope statsScope(stats);
+                node->execute(stream);
+            }
+            node->PerfCounter().addParallelOverhead(stats.overhead_ns);
+        } else {
+            node->execute(stream);
+        }
+    }
+
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
+}
+
 void MKLDNNGraph::Infer(int batch) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    const bool collectPerf = IsPerfCountSampled();
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (IsCancellationRequested()) {
-            ResetCancellationRequest();
-            THROW_IE_EXCEPTION << InferenceEngine::details::as_status << InferenceEngine::INFER_CANCELLED;
+    if (executionWaves.empty()) {
+        for (int i = 0; i < graphNodes.size(); i++) {
+            if (IsCancellationRequested()) {
+                ResetCancellationRequest();
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << InferenceEngine::INFER_CANCELLED;
+            }
+
+            ExecuteNode(graphNodes[i], stream, batch, collectPerf);
+        }
+    } else {
+        for (auto& wave : executionWaves) {
+            if (IsCancellationRequested()) {
+                ResetCancellationRequest();
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << InferenceEngine::INFER_CANCELLED;
+            }
+
+            if (wave.size() == 1) {
+                ExecuteNode(graphNodes[wave[0]], stream, batch, collectPerf);
+                continue;
+            }
+            // nodes parallelize internally as well, nested parallelism is balanced by the stream's TBB arena
+            parallel_for(wave.size(), [&](size_t i) {
+                mkldnn::stream nodeStream = mkldnn::stream(stream::kind::eager);
+                ExecuteNode(graphNodes[wave[i]], nodeStream, batch, collectPerf);
+            });
         }
+    }
+
+    if (infer_count != -1) infer_count++;
+}
+
+bool MKLDNNGraph::IsPerfCountSampled() {
+    // the counters are reset by the inference thread, so running inferences don't race with the reset
+    if (perfCountResetRequested.exchange(false)) {
+        for (auto &node : graphNodes) {
+            node->PerfCounter() = PerfCount();
+        }
+    }
+    auto windowEnd = perfCountWindowEnd.load();
+    if (windowEnd != 0) {
+        if (std::chrono::steady_clock::now().time_since_epoch().count() < windowEnd)
+            return true;
+        // the window is over, the clock is not read by the following inferences
+        perfCountWindowEnd.compare_exchange_strong(windowEnd, 0);
+    }
+    if (!config.collectPerfCounters)
+        return false;
+    return perfCountInferences++ % config.perfCountPeriod == 0;
+}
 
-        PERF(graphNodes[i]);
+void MKLDNNGraph::StartPerfCountWindow(std::chrono::milliseconds duration) {
+    if (duration.count() == 0) {
+        perfCountWindowEnd = 0;
+        return;
+    }
+    const auto windowEnd = std::chrono::steady_clock::now() + duration;
+    perfCountWindowEnd = std::chrono::duration_cast<std::chrono::steady_clock::duration>(windowEnd.time_since_epoch()).count();
+    perfCountResetRequested = true;
+}
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+void MKLDNNGraph::Warmup() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::Warmup");
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput)
+            return;
+    }
+    for (auto &input : inputNodes) {
+        input.second->getChildEdgeAt(0)->getMemory().FillZero();
+    }
+    Infer();
+    // the warm-up run is not reported by the performance counters
+    for (auto &node : graphNodes) {
+        node->PerfCounter() = PerfCount();
+    }
+}
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+size_t MKLDNNGraph::TrimMemory() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::TrimMemory");
+
+    if (arenaSize == 0 || !memWorkspace)
+        return 0;
+    // state of memory layers lives in the arena
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return 0;
+    }
+
+    auto* arena = static_cast<uint8_t*>(memWorkspace->GetData());
+    size_t released = 0;
+    size_t offset = 0;
+    for (auto &range : arenaConstRanges) {
+        if (range.first > offset)
+            released += ReleaseMemoryPages(arena + offset, range.first - offset);
+        offset = std::max(offset, range.first + range.second);
+    }
+    if (arenaSize > offset)
+        released += ReleaseMemoryPages(arena + offset, arenaSize - offset);
+    return released;
+}
+
+void MKLDNNGraph::InitExecutionWaves() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::InitExecutionWaves");
+
+    executionWaves.clear();
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    // Nodes are executed in topological order, and memory of edges is reused according to this order.
+    // A node is moved to the current wave (i.e. before all nodes not executed yet) only if it doesn't depend
+    // on them, and doesn't touch memory any of them reads or writes.
+    using MemoryRange = std::pair<const uint8_t*, const uint8_t*>;
+    struct MemoryAccess {
+        std::vector<MemoryRange> reads;
+        std::vector<MemoryRange> writes;
+    };
+    auto addRange = [](std::vector<MemoryRange>& ranges, const MKLDNNEdgePtr& edge) {
+        const auto& memory = edge->getMemory();
+        auto begin = static_cast<const uint8_t*>(memory.GetData());
+        if (begin != nullptr && memory.GetSize() != 0)
+            ranges.emplace_back(begin, begin + memory.GetSize());
+    };
+    auto intersects = [](const std::vector<MemoryRange>& lhs, const std::vector<MemoryRange>& rhs) {
+        for (auto& l : lhs)
+            for (auto& r : rhs)
+                if (l.first < r.second && r.first < l.second)
+                    return true;
+        return false;
+    };
+
+    const size_t nodesCount = graphNodes.size();
+    std::unordered_map<const MKLDNNNode*, size_t> indices;
+    std::vector<MemoryAccess> access(nodesCount);
+    for (size_t i = 0; i < nodesCount; i++) {
+        auto& node = graphNodes[i];
+        indices[node.get()] = i;
+        // constant nodes are not executed on inference
+        if (node->isConstant())
+            continue;
+        for (size_t j = 0; j < node->getParentEdges().size(); j++)
+            addRange(access[i].reads, node->getParentEdgeAt(j));
+        for (size_t j = 0; j < node->getChildEdges().size(); j++)
+            addRange(access[i].writes, node->getChildEdgeAt(j));
+    }
+    auto conflicts = [&](size_t lhs, size_t rhs) {
+        return intersects(access[lhs].writes, access[rhs].writes) ||
+               intersects(access[lhs].writes, access[rhs].reads) ||
+               intersects(access[lhs].reads, access[rhs].writes);
+    };
+    // nodes with state shared outside of their edges are executed alone and in original order
+    auto isBarrier = [](const MKLDNNNodePtr& node) {
+        auto type = node->getType();
+        return type == MemoryInput || type == MemoryOutput || type == TensorIterator;
+    };
+
+    const size_t maxWaveSize = static_cast<size_t>(parallel_get_max_threads());
+    // limits number of not executed nodes checked, so waves are built in linear time
+    const size_t lookAhead = 64;
+    std::vector<bool> scheduled(nodesCount, false);
+    size_t first = 0;
+    bool hasParallelWaves = false;
+    while (first < nodesCount) {
+        std::vector<size_t> wave;
+        std::vector<size_t> pending;
+        for (size_t i = first; i < nodesCount && wave.size() < maxWaveSize && pending.size() < lookAhead; i++) {
+            if (scheduled[i])
+                continue;
+            auto& node = graphNodes[i];
+            bool barrier = isBarrier(node);
+            bool ready = !barrier || pending.empty();
+            for (size_t j = 0; ready && j < node->getParentEdges().size(); j++) {
+                auto parent = indices.find(node->getParentEdgeAt(j)->getParent().get());
+                ready = parent == indices.end() || scheduled[parent->second];
+            }
+            for (size_t j = 0; ready && j < pending.size(); j++)
+                ready = !conflicts(pending[j], i);
+            if (ready)
+                wave.push_back(i);
+            pending.push_back(i);
+            if (barrier)
+                break;
         }
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+        for (auto i : wave)
+            scheduled[i] = true;
+        while (first < nodesCount && scheduled[first])
+            first++;
+        hasParallelWaves |= wave.size() > 1;
+        executionWaves.push_back(std::move(wave));
     }
 
-    if (infer_count != -1) infer_count++;
+    // nothing to execute concurrently, keep plain sequential execution
+    if (!hasParallelWaves)
+        executionWaves.clear();
+#endif
 }
 
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
@@ -883,8 +1415,10 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[node->getName()];
         pc.execution_index = i++;
         // TODO: Why time counter is signed?
-        pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
-        pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+        pc.realTime_uSec = (long long) node->PerfCounter().avg();
+        // the difference is the time of parallel regions spent on scheduling and waiting for threads
+        pc.cpu_uSec = pc.realTime_uSec - std::min(pc.realTime_uSec, (long long) node->PerfCounter().avgParallelOverhead());
+        pc.status = pc.realTime_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
@@ -908,6 +1442,62 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
 }
 
+std::map<std::string, std::string> MKLDNNGraph::GetNodesIsa() const {
+    std::map<std::string, std::string> nodesIsa;
+    for (auto& node : graphNodes) {
+        if (node->isConstant() || node->getType() == Input || node->getType() == Output)
+            continue;
+        nodesIsa[node->getName()] = node->getImplementationIsa();
+    }
+    return nodesIsa;
+}
+
+size_t MKLDNNGraph::GetReordersNum() const {
+    return static_cast<size_t>(std::count_if(graphNodes.begin(), graphNodes.end(), [](const MKLDNNNodePtr& node) {
+        return node->getType() == Reorder && !node->isConstant();
+    }));
+}
+
+float MKLDNNGraph::GetHugePagesFraction() const {
+    // weights shared by nodes are counted once
+    std::vector<std::pair<const void*, size_t>> ranges;
+    std::unordered_set<const void*> counted;
+    auto addRange = [&](const MKLDNNMemoryPtr& memory) {
+        if (!memory || !memory->GetPrimitivePtr())
+            return;
+        const void* data = memory->GetPrimitive().get_data_handle();
+        if (data != nullptr && counted.insert(data).second)
+            ranges.emplace_back(data, memory->GetPrimitiveDescriptor().get_size());
+    };
+    if (arenaSize != 0)
+        addRange(memWorkspace);
+    for (auto& node : graphNodes) {
+        for (auto& memory : node->internalBlobMemory)
+            addRange(memory);
+    }
+
+    size_t total = 0;
+    for (auto& range : ranges)
+        total += range.second;
+    if (total == 0)
+        return 0.f;
+    return static_cast<float>(GetHugePagesBackedSize(ranges)) / total;
+}
+
+std::vector<std::string> MKLDNNGraph::GetInt8NonJitNodes() const {
+    std::vector<std::string> names;
+    for (auto& node : graphNodes) {
+        auto nodeType = node->getType();
+        if ((nodeType != Convolution && nodeType != Deconvolution && nodeType != FullyConnected) || !node->isInt8Implementation())
+            continue;
+        auto selectedPrimitiveDesc = node->getSelectedPrimitiveDescriptor();
+        auto type = selectedPrimitiveDesc ? selectedPrimitiveDesc->getImplementationType() : impl_desc_type::unknown;
+        if ((type & impl_desc_type::jit) != impl_desc_type::jit || (type & impl_desc_type::gemm) == impl_desc_type::gemm)
+            names.push_back(node->getName());
+    }
+    return names;
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
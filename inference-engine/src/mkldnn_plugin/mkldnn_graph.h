@@ -6,17 +6,21 @@
 
 #include "ie_parallel.hpp"
 #include "cpp/ie_cnn_network.h"
+#include "ie_compound_blob.h"
 #include "config.h"
 #include "mkldnn_memory.h"
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_conv_autotune.h"
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <chrono>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -45,6 +49,15 @@ public:
     }
 
     void setConfig(const Config &cfg);
+    void setConvAutotuneCache(const ConvAutotuneCache::Ptr &cache) {
+        convAutotuneCache = cache;
+    }
+    void setNumaShardedCache(const MKLDNNWeightsSharing::Ptr &cache) {
+        numaShardedCache = cache;
+    }
+    void setCompressedWeights(const MKLDNNCompressedWeightsMap &weights) {
+        compressedWeights = weights;
+    }
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty();
 
@@ -60,11 +73,22 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    // applyMeanImage is false if the mean values are already subtracted from the input, e.g. by pre-processing
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool applyMeanImage = true);
+    // gathers items of the batched blob right into the network input without assembling the batch in a separate buffer
+    void PushBatchedInputData(const std::string& name, const InferenceEngine::BatchedBlob::Ptr &in, bool applyMeanImage = true);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(int batch = -1);
 
+    // runs the graph once on zero inputs, so kernels are initialized and the memory is touched before
+    // the first inference; graphs with memory layers are skipped to keep their state intact
+    void Warmup();
+
+    // returns pages of the memory arena, except constant data, to the OS; they are faulted in again by the next
+    // inference. Must not be called concurrently with inference. Returns the number of released bytes
+    size_t TrimMemory();
+
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
     }
@@ -92,6 +116,33 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /** @brief Instruction set of selected implementation for each executable node, see MKLDNNNode::getImplementationIsa() */
+    std::map<std::string, std::string> GetNodesIsa() const;
+
+    /** @brief Number of non constant Reorder nodes, they are executed on each inference */
+    size_t GetReordersNum() const;
+
+    /** @brief Names of Int8 Convolution, Deconvolution and FullyConnected nodes executed without JIT kernels */
+    std::vector<std::string> GetInt8NonJitNodes() const;
+
+    /** @brief Eltwise sums of int8 convolution outputs which were not fused into the convolution, with the reason */
+    const std::vector<std::string>& GetUnfusedInt8Sums() const {
+        return unfusedInt8Sums;
+    }
+
+    /** @brief Size in bytes of the planned memory arena for intermediate tensors */
+    size_t GetArenaSize() const {
+        return arenaSize;
+    }
+
+    /** @brief Lower bound in bytes of the arena size: maximal total size of tensors alive at the same time */
+    size_t GetArenaLowerBound() const {
+        return arenaLowerBound;
+    }
+
+    /** @brief Fraction of the memory arena and weights of nodes which is backed by huge pages */
+    float GetHugePagesFraction() const;
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -126,6 +177,12 @@ public:
 
     void ResetInferCount() { infer_count = 0; }
 
+    /**
+     * @brief Starts collection of the performance counters on every inference for the given time,
+     * see KEY_CPU_PERF_COUNT_WINDOW. Counters collected before are reset by the next inference.
+     */
+    void StartPerfCountWindow(std::chrono::milliseconds duration);
+
     void SortTopologically();
 
 protected:
@@ -151,14 +208,36 @@ protected:
     }
     Status status;
     Config config;
+    ConvAutotuneCache::Ptr convAutotuneCache;
+    // store of embedding tables sharded across NUMA nodes, it is common for graphs of all nodes
+    MKLDNNWeightsSharing::Ptr numaShardedCache;
+    std::vector<MKLDNNMemoryPtr> numaShardedTables;
+    // weights of FullyConnected layers compressed for the network, FP32 weights of these layers are released
+    MKLDNNCompressedWeightsMap compressedWeights;
 
     // For dumping purposes. -1 - no counting, all other positive
     // values mean increment it within each Infer() call
     int infer_count = -1;
 
+    // inferences counted to sample the performance counters, see Config::perfCountPeriod
+    size_t perfCountInferences = 0;
+    // steady clock ticks when the window of the performance counters collection ends, 0 if there is no window
+    std::atomic<int64_t> perfCountWindowEnd{0};
+    std::atomic<bool> perfCountResetRequested{false};
+
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    size_t arenaSize = 0;
+    // (offset, size) in bytes of the arena parts holding constant data, sorted by offset
+    std::vector<std::pair<size_t, size_t>> arenaConstRanges;
+    size_t arenaLowerBound = 0;
+
+    // Outputs of constant subgraphs consumed by the rest of the graph. If the weights cache is used,
+    // they are computed once in sharedConstScratch and then refer to the memory of the cache
+    std::vector<MKLDNNEdgePtr> sharedConstEdges;
+    std::vector<MKLDNNMemoryPtr> sharedConstOutputs;
+    MKLDNNMemoryPtr sharedConstScratch;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -168,6 +247,14 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Indices of graphNodes grouped into waves executed one after another. Nodes of a wave have
+    // no dependencies and no memory conflicts with each other, so they are executed concurrently.
+    // Empty if inter-op parallelism is disabled.
+    std::vector<std::vector<size_t>> executionWaves;
+
+    // Filled by MKLDNNGraphOptimizer, see GetUnfusedInt8Sums()
+    std::vector<std::string> unfusedInt8Sums;
+
     mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -175,6 +262,7 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void PropagateLayouts();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
@@ -182,12 +270,16 @@ protected:
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
+    void InitExecutionWaves();
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch, bool collectPerf);
+    bool IsPerfCountSampled();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
+    friend class MKLDNNGraphOptimizer;
     friend InferenceEngine::CNNNetwork dump_graph_as_ie_net(const MKLDNNGraph &graph);
     friend InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
 
@@ -22,15 +22,15 @@ namespace MKLDNNPlugin {
 
 namespace {
 
-std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &);
+std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &, bool detailedPerfCounters);
 void drawer_callback(const InferenceEngine::CNNLayerPtr, ordered_properties &, ordered_properties &);
 
 }  // namespace
 
-CNNLayer::Ptr create_cnnlayer(const MKLDNNNodePtr &node) {
+CNNLayer::Ptr create_cnnlayer(const MKLDNNNodePtr &node, bool detailedPerfCounters) {
     CNNLayer::Ptr layer(new CNNLayer({node->getName(), "type", Precision::FP32}));
 
-    layer->params = extract_node_metadata(node);
+    layer->params = extract_node_metadata(node, detailedPerfCounters);
     layer->type = layer->params[ExecGraphInfoSerialization::LAYER_TYPE];
     layer->params.erase(ExecGraphInfoSerialization::LAYER_TYPE);
 
@@ -89,7 +89,7 @@ InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph
             should_be_hold = true;
         }
 
-        auto meta_data = extract_node_metadata(node);
+        auto meta_data = extract_node_metadata(node, graph.config.collectDetailedPerfCounters);
         std::shared_ptr<ngraph::Node> return_node;
         if (is_input) {
             auto desc = node->getChildEdgeAt(0)->getDesc();
@@ -150,7 +150,7 @@ InferenceEngine::CNNNetwork dump_graph_as_ie_net(const MKLDNNGraph &graph) {
 
     // Copy all nodes to network
     for (auto &node : graph.graphNodes) {
-        auto layer = create_cnnlayer(node);
+        auto layer = create_cnnlayer(node, graph.config.collectDetailedPerfCounters);
         node2layer[node] = layer;
         net->addLayer(layer);
     }
@@ -205,7 +205,7 @@ void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out) {
 
 namespace {
 
-std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &node) {
+std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &node, bool detailedPerfCounters) {
     std::map<std::string, std::string> serialization_info;
 
     if (node->getType() == Input && node->isConstant()) {
@@ -279,6 +279,22 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    if (detailedPerfCounters) {
+        // the ratio of operations to bytes tells compute bound nodes from memory bound ones
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_MIN] = std::to_string(node->PerfCounter().minimum());
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_MAX] = std::to_string(node->PerfCounter().maximum());
+        serialization_info[ExecGraphInfoSerialization::BYTES_READ] = std::to_string(node->getBytesRead());
+        serialization_info[ExecGraphInfoSerialization::BYTES_WRITTEN] = std::to_string(node->getBytesWritten());
+        const uint64_t operations = node->getOperationsCount();
+        if (operations != 0) {
+            serialization_info[ExecGraphInfoSerialization::OPERATIONS] = std::to_string(operations);
+            // operations per microsecond divided by 1000 are giga operations per second
+            if (node->PerfCounter().avg() != 0)
+                serialization_info[ExecGraphInfoSerialization::GOPS] =
+                    std::to_string(static_cast<double>(operations) / node->PerfCounter().avg() / 1000.0);
+        }
+    }
+
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     return serialization_info;
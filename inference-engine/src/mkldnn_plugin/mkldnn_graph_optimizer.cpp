@@ -17,6 +17,7 @@
 #include <nodes/mkldnn_permute_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 
 #include <blob_factory.hpp>
 #include <legacy/ie_layers_internal.hpp>
@@ -240,12 +241,10 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
                 if (arg0->getCnnLayer()->outData[0]->getPrecision() != Precision::U8)
                     return false;
 
-                if (parent0->getParentEdgesAtPort(1)[0]->getDims().size() < 2) {
-                    return false;
-                }
-
-                if (parent0->getParentEdgesAtPort(1)[0]->getDims()[1] != 1 &&
-                    parent0->getParentEdgesAtPort(1)[0]->getDims()[1] != IC)
+                // per-tensor zero point is broadcasted through channels, per-channel one is taken as is
+                auto zeroPointsDims = parent0->getParentEdgesAtPort(1)[0]->getDims();
+                bool isPerTensor = zeroPointsDims.size() == 1;
+                if (!isPerTensor && (zeroPointsDims.ndims() < 2 || zeroPointsDims[1] != IC || zeroPointsDims.size() != IC))
                     return false;
 
                 auto arg1 = parent0->getParentEdgesAtPort(0)[0]->getParent();
@@ -260,8 +259,8 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
                 if (zeroPointsData == nullptr)
                     THROW_IE_EXCEPTION << "zeroPointsBlob has not allocated buffer";
 
-                for (int j = 0; j < parent0->getParentEdgesAtPort(1)[0]->getDims()[1]; j++) {
-                    convNode->inputZeroPoints.push_back(zeroPointsData[j]);
+                for (int j = 0; j < IC; j++) {
+                    convNode->inputZeroPoints.push_back(zeroPointsData[isPerTensor ? 0 : j]);
                 }
             } else {
                 return false;
@@ -297,8 +296,9 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
                 if (arg0->getCnnLayer()->outData[0]->getPrecision() != Precision::I8)
                     return false;
 
-                if (parent0->getParentEdgesAtPort(1)[0]->getDims()[0] != 1 &&
-                    parent0->getParentEdgesAtPort(1)[0]->getDims()[0] != OC)
+                auto zeroPointsDims = parent0->getParentEdgesAtPort(1)[0]->getDims();
+                bool isPerTensor = zeroPointsDims.size() == 1;
+                if (!isPerTensor && (zeroPointsDims.ndims() < 1 || zeroPointsDims[0] != OC || zeroPointsDims.size() != OC))
                     return false;
 
                 auto arg1 = parent0->getParentEdgesAtPort(0)[0]->getParent();
@@ -313,8 +313,8 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
                 if (zeroPointsData == nullptr)
                     THROW_IE_EXCEPTION << "zeroPointsBlob has not allocated buffer";
 
-                for (int j = 0; j < parent0->getParentEdgesAtPort(1)[0]->getDims()[0]; j++) {
-                    convNode->weightsZeroPoints.push_back(static_cast<float>(zeroPointsData[j]));
+                for (int j = 0; j < OC; j++) {
+                    convNode->weightsZeroPoints.push_back(static_cast<float>(zeroPointsData[isPerTensor ? 0 : j]));
                 }
             } else {
                 return false;
@@ -679,8 +679,11 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+        if (node->getType() != FullyConnected || node->getChildEdges().size() != 1)
+            return false;
+        // implementations with compressed weights don't support post operations
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+        return fcNode == nullptr || !fcNode->withCompressedWeights();
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
@@ -1290,17 +1293,49 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
                                                 Round})));
     };
 
+    auto isInt8Convolution = [](MKLDNNNodePtr node) {
+        auto* convNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+        return convNode && convNode->canBeExecutedInInt8();
+    };
+
+    // Int8 residual blocks are much slower when Sum stays a separate node, so such cases are collected for a user
+    auto reportUnfused = [&](MKLDNNNodePtr sum, const std::string& reason) {
+        for (size_t i = 0; i < sum->getParentEdges().size(); i++) {
+            if (isInt8Convolution(sum->getParentEdgeAt(i)->getParent())) {
+                graph.unfusedInt8Sums.push_back(sum->getName() + " (" + reason + ")");
+                return;
+            }
+        }
+    };
+
+    // FakeQuantize after int8 Conv + Sum [+ Relu] requantizes the output, FP32 convolutions fuse it in FuseConvolutionAndSimpleOperation
+    auto isSutableQuantize = [&](MKLDNNNodePtr conv, MKLDNNNodePtr node) {
+        if (!isInt8Convolution(conv) || node->getType() != Quantize)
+            return false;
+
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+        if (quantizeNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
+
+        return !quantizeNode->isBinarization();
+    };
+
     for (auto &graphNode : graphNodes) {
         if (graphNode->getType() != Eltwise)
             continue;
 
         if (!std::dynamic_pointer_cast<MKLDNNEltwiseNode>(graphNode)->isSum()) continue;
-        if (std::dynamic_pointer_cast<MKLDNNEltwiseNode>(graphNode)->isWithBroadcast()) continue;
+        if (std::dynamic_pointer_cast<MKLDNNEltwiseNode>(graphNode)->isWithBroadcast()) {
+            reportUnfused(graphNode, "sum with broadcast");
+            continue;
+        }
 
         // TODO: Enlarge to several inputs
         bool isSutableNode = graphNode->getParentEdges().size() == 2;
-        if (!isSutableNode)
+        if (!isSutableNode) {
+            reportUnfused(graphNode, "sum of more than two inputs");
             continue;
+        }
 
         auto parent1 = graphNode->getParentEdgeAt(0)->getParent();
         auto parent2 = graphNode->getParentEdgeAt(1)->getParent();
@@ -1334,15 +1369,26 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
                 peerNode = parent1;
             }
         }
-        if (peerNode->isConstant())
+        if (peerNode->isConstant()) {
+            reportUnfused(graphNode, "constant second input");
             continue;
+        }
         auto sum = graphNode;
         auto lastNode = sum;
 
-        bool fuse_allowed = mergedConv->getChildEdges().size() == 1;
+        if (mergedConv->getChildEdges().size() != 1) {
+            reportUnfused(sum, "convolution output has several consumers");
+            continue;
+        }
+
+        bool fuse_allowed = true;
         for (size_t j = 0; fuse_allowed && j < mergedConv->getParentEdges().size(); j++)
             if (mergedConv->getParentEdgeAt(j)->getParent() == peerNode)
                 fuse_allowed = false;
+        if (!fuse_allowed) {
+            reportUnfused(sum, "second input is also an input of the convolution");
+            continue;
+        }
 
         // Fused Conv+Sum prim will be used inplace. That's mean that input blob will
         // be overwritten. Should verify that all other consumer already read it and
@@ -1353,15 +1399,29 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
                 break;
             fuse_allowed &= is_data_dependency(edge.lock()->getChild(), sum);
         }
-        if (!fuse_allowed) continue;
+        if (!fuse_allowed) {
+            reportUnfused(sum, "second input is read after the sum");
+            continue;
+        }
 
+        MKLDNNNodePtr activation;
         if (graphNode->getChildEdges().size() == 1 &&
                 isFusingSupported(graphNode, graphNode->getChildEdgeAt(0)->getChild())) {
-            auto relu_shared = graphNode->getChildEdgeAt(0)->getChild();
-            lastNode = relu_shared;
+            activation = graphNode->getChildEdgeAt(0)->getChild();
+            lastNode = activation;
             mergedConv->fuseWith(sum);
         }
 
+        MKLDNNNodePtr quantize;
+        if (lastNode->getChildEdges().size() == 1 && isSutableQuantize(mergedConv, lastNode->getChildEdgeAt(0)->getChild())) {
+            quantize = lastNode->getChildEdgeAt(0)->getChild();
+            mergedConv->fuseWith(lastNode);
+            lastNode = quantize;
+        } else if (!activation && sum->getChildEdges().size() == 1 && sum->getChildEdgeAt(0)->getChild()->getType() == Eltwise &&
+                   sum->getChildEdgeAt(0)->getChild()->getParentEdges().size() == 1) {
+            reportUnfused(sum, sum->getChildEdgeAt(0)->getChild()->getTypeStr() + " after the sum is not fused");
+        }
+
         mergedConv->fuseWith(lastNode);
 
         if (mergedConv->fusedWith.size() > 0 &&
@@ -1409,8 +1469,18 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
             child->addEdge(newEdge);
         }
 
-        if (lastNode != sum) {
-            lastNode->remove();
+        if (quantize) {
+            // quantization ranges are kept by the fused node, the data input is removed together with the sum
+            auto parentEdges = quantize->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getOutputNum() != 0)
+                    removeEdge(graph, p_edge);
+            }
+            quantize->remove();
+        }
+        if (activation) {
+            activation->remove();
         }
         sum->remove();
     }
@@ -1982,17 +2052,45 @@ void MKLDNNGraphOptimizer::removeEdge(MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
 void MKLDNNGraphOptimizer::FuseBroadcastAndEltwise(MKLDNNGraph &graph) {
     std::vector<MKLDNNNodePtr>& graphNodes = graph.GetNodes();
 
-    for (auto &graphNode : graphNodes) {
-        if (graphNode->getType() != Generic
-                || graphNode->getTypeStr() != "Broadcast"
-                || graphNode->getChildEdges().size() != 1lu
-                || graphNode->getChildEdgeAt(0)->getChild()->getType() != Eltwise)
+    // Eltwise node reads inputs with unit dims using zero offsets, so the numpy-style broadcast done by
+    // Broadcast and Tile nodes does not need to be materialized if all the consumers are Eltwise nodes
+    auto isConsumedByEltwiseOnly = [](const MKLDNNNodePtr& node) {
+        if (node->getChildEdges().empty())
+            return false;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            if (node->getChildEdgeAt(i)->getChild()->getType() != Eltwise)
+                return false;
+        }
+        return true;
+    };
+
+    auto isBroadcastNode = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Generic && node->getTypeStr() == "Broadcast";
+    };
+
+    // Tile repeats the whole dimension, so it is a broadcast only if the tiled dimension is 1
+    auto isBroadcastingTileNode = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Tile || node->getParentEdges().size() != 1)
+            return false;
+        auto tileLayer = dynamic_cast<TileLayer*>(node->getCnnLayer().get());
+        if (tileLayer == nullptr)
+            return false;
+        const auto& inDims = node->getParentEdgeAt(0)->getDims();
+        return tileLayer->axis >= 0 && tileLayer->axis < inDims.ndims() && inDims[tileLayer->axis] == 1;
+    };
+
+    // reverse order drops the chains of Tile nodes (one per tiled axis) starting from the consumers
+    for (auto nodeIt = graphNodes.rbegin(); nodeIt != graphNodes.rend(); nodeIt++) {
+        auto& graphNode = *nodeIt;
+        if (!(isBroadcastNode(graphNode) || isBroadcastingTileNode(graphNode))
+                || !isConsumedByEltwiseOnly(graphNode))
             continue;
 
         MKLDNNNodePtr& broadcastNode = graphNode;
-        MKLDNNNodePtr eltwiseNode = broadcastNode->getChildEdgeAt(0)->getChild();
-        eltwiseNode->inDims[broadcastNode->getChildEdgeAt(0)->getOutputNum()]
-                = broadcastNode->getParentEdgeAt(0)->getDims();
+        for (size_t i = 0; i < broadcastNode->getChildEdges().size(); i++) {
+            auto childEdge = broadcastNode->getChildEdgeAt(i);
+            childEdge->getChild()->inDims[childEdge->getOutputNum()] = broadcastNode->getParentEdgeAt(0)->getDims();
+        }
 
         auto& edges = graph.GetEdges();
         for (size_t i = 1lu; i < broadcastNode->getParentEdges().size(); i++) {
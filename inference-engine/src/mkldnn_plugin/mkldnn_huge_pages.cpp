@@ -0,0 +1,112 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_huge_pages.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+#ifdef __linux__
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/mman.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+#ifdef __linux__
+
+namespace {
+
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+inline size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+MKLDNNMemoryPtr CreateHugePagesMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc) {
+    const size_t size = mkldnn::memory::primitive_desc(desc, eng).get_size();
+    void* addr = MAP_FAILED;
+    // the mapping is 2 MB larger to align the data
+    const size_t length = alignUp(size, hugePageSize) + hugePageSize;
+    if (size >= hugePageSize)
+        addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+        MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng));
+        ptr->Create(desc);
+        return ptr;
+    }
+
+    void* data = reinterpret_cast<void*>(alignUp(reinterpret_cast<uintptr_t>(addr), hugePageSize));
+    // it fails if huge pages are disabled, the memory is still usable then
+    madvise(data, alignUp(size, hugePageSize), MADV_HUGEPAGE);
+
+    std::shared_ptr<void> mapping(addr, [length](void* p) { munmap(p, length); });
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng), [mapping](MKLDNNMemory* memory) { delete memory; });
+    ptr->Create(desc, data);
+    return ptr;
+}
+
+size_t GetHugePagesBackedSize(const std::vector<std::pair<const void*, size_t>>& ranges) {
+    std::ifstream smaps("/proc/self/smaps");
+    if (!smaps.is_open())
+        return 0;
+
+    // size of the range overlapped by the mapping [begin, end)
+    auto overlap = [&](uintptr_t begin, uintptr_t end) {
+        size_t result = 0;
+        for (auto&& range : ranges) {
+            const auto rangeBegin = reinterpret_cast<uintptr_t>(range.first);
+            const auto rangeEnd = rangeBegin + range.second;
+            if (rangeBegin < end && begin < rangeEnd)
+                result += (std::min)(end, rangeEnd) - (std::max)(begin, rangeBegin);
+        }
+        return result;
+    };
+
+    size_t backed = 0;
+    size_t overlapped = 0;
+    size_t mappingSize = 0;
+    std::string line;
+    while (std::getline(smaps, line)) {
+        // a mapping starts with "begin-end perms ...", its fields are "Name:   value kB"
+        const auto dash = line.find('-');
+        const auto space = line.find(' ');
+        if (dash != std::string::npos && space != std::string::npos && dash < space &&
+            line.find(':') > space) {
+            const auto begin = std::stoull(line.substr(0, dash), nullptr, 16);
+            const auto end = std::stoull(line.substr(dash + 1, space - dash - 1), nullptr, 16);
+            overlapped = overlap(begin, end);
+            mappingSize = end - begin;
+        } else if (overlapped != 0 && line.compare(0, 14, "AnonHugePages:") == 0) {
+            std::istringstream field(line.substr(14));
+            size_t kb = 0;
+            field >> kb;
+            // huge pages are assumed to be spread evenly if the mapping is larger than the ranges
+            const auto hugePages = static_cast<double>(kb) * 1024;
+            backed += (std::min)(overlapped, static_cast<size_t>(hugePages * overlapped / mappingSize));
+        }
+    }
+    return backed;
+}
+
+#else
+
+MKLDNNMemoryPtr CreateHugePagesMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc) {
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng));
+    ptr->Create(desc);
+    return ptr;
+}
+
+size_t GetHugePagesBackedSize(const std::vector<std::pair<const void*, size_t>>& /*ranges*/) {
+    return 0;
+}
+
+#endif
+
+}  // namespace MKLDNNPlugin
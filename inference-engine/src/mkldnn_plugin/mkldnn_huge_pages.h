@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_memory.h"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Creates memory which may be backed by transparent huge pages (Linux only).
+ *
+ * Memory of 2 MB and more is mapped separately, aligned to 2 MB and advised with MADV_HUGEPAGE before the first
+ * write, so the kernel backs it by huge pages if they are enabled in "always" or "madvise" mode. Smaller memory
+ * and memory on other OSes is allocated as usual.
+ */
+MKLDNNMemoryPtr CreateHugePagesMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc);
+
+/**
+ * Returns the number of bytes of the given (data, size) ranges backed by huge pages, according to
+ * AnonHugePages of /proc/self/smaps. Ranges must not overlap. Returns 0 if it is not known.
+ */
+size_t GetHugePagesBackedSize(const std::vector<std::pair<const void*, size_t>>& ranges);
+
+}  // namespace MKLDNNPlugin
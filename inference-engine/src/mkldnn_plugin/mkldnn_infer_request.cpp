@@ -4,13 +4,18 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <map>
 #include <blob_factory.hpp>
+#include <ie_system_conf.h>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
+#include <ngraph/chrome_trace.hpp>
 #include "mkldnn_exec_network.h"
 #include "mkldnn_itt.h"
 #include "nodes/common/cpu_convert.h"
@@ -24,6 +29,26 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
 , execNetwork(execNetwork_) {
     auto id = (execNetwork->_numRequests)++;
     profilingTask = openvino::itt::handle("MKLDNN_INFER_" + execNetwork->_name + "_" + std::to_string(id));
+    int streams = 0;
+    bool warmup = false;
+    {
+        std::lock_guard<std::mutex> lock{execNetwork->_cfgMutex};
+        priority = execNetwork->_cfg.requestPriority;
+        deadline = std::chrono::milliseconds{execNetwork->_cfg.requestDeadline};
+        streams = execNetwork->_cfg.streamExecutorConfig._streams;
+        warmup = execNetwork->_cfg.warmup;
+    }
+    // streams are spread over NUMA nodes in the same order by the streams executor, so input / output blobs
+    // of requests are spread round-robin as well. Intermediate memory belongs to graphs of streams and is
+    // first touched by threads of the stream
+    auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    const auto usedNumaNodes = std::min(numaNodes.size(), static_cast<size_t>(streams));
+    if (usedNumaNodes > 1) {
+        blobsAllocator = InferenceEngine::details::shared_from_irelease(
+            InferenceEngine::CreateNumaAllocator(numaNodes[id % usedNumaNodes]));
+    } else {
+        blobsAllocator = execNetwork->_blobsAllocator;
+    }
 
     if (execNetwork->_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -31,11 +56,16 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     for (const auto& it : _networkInputs) {
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
+        // pages of the blobs are faulted in now instead of during the first inference
+        if (warmup)
+            std::memset(blob->buffer(), 0, blob->byteSize());
     }
     // Allocate all output blobs
     for (const auto& it : _networkOutputs) {
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
+        if (warmup)
+            std::memset(blob->buffer(), 0, blob->byteSize());
     }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -69,8 +99,15 @@ MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
 
 void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
     bool needConvert = inPrec != inputBlob->getTensorDesc().getPrecision();
+    auto batched = InferenceEngine::as<InferenceEngine::BatchedBlob>(inputBlob);
+    const bool applyMeanImage = meanAppliedInputs.find(inputName) == meanAppliedInputs.end();
+
+    if (batched && !needConvert) {
+        graph->PushBatchedInputData(inputName, batched, applyMeanImage);
+        return;
+    }
 
-    if (inputBlob->cbuffer().as<const void *>() == nullptr) {
+    if (!batched && inputBlob->cbuffer().as<const void *>() == nullptr) {
         THROW_IE_EXCEPTION << "Input blob has no allocated memory";
     }
 
@@ -79,19 +116,36 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
         iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
                                          inputBlob->getTensorDesc().getLayout()));
         iconv->allocate();
-        if (inputBlob->size() != iconv->size())
-            THROW_IE_EXCEPTION << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
+        const size_t inputSize = batched ? InferenceEngine::details::product(inputBlob->getTensorDesc().getDims())
+                                         : inputBlob->size();
+        if (inputSize != iconv->size())
+            THROW_IE_EXCEPTION << "Can't copy tensor: input and converted tensors have different number of elements: " << inputSize << " and "
                                << iconv->size();
 
-        void *srcData = inputBlob->cbuffer().as<void *>();
-        void *dstData = iconv->buffer().as<void *>();
+        auto *dstData = iconv->buffer().as<uint8_t *>();
         if (dstData == nullptr) {
             THROW_IE_EXCEPTION << "Converted input blob has no allocated memory";
         }
-        cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
+        if (batched) {
+            // items are converted right into their places in the batch
+            const size_t itemSize = iconv->size() / batched->size();
+            for (size_t i = 0; i < batched->size(); i++) {
+                auto item = batched->getBlob(i);
+                cpu_convert(item->cbuffer().as<void *>(), dstData + i * itemSize * inPrec.size(),
+                            item->getTensorDesc().getPrecision(), inPrec, itemSize);
+            }
+        } else if (!MKLDNNMemory::IsDense(inputBlob->getTensorDesc())) {
+            // the strided view is converted while it is read
+            MKLDNNMemory dst(graph->getEngine());
+            dst.Create(MKLDNNMemoryDesc(iconv->getTensorDesc()), dstData);
+            dst.SetData(inputBlob->getTensorDesc(), inputBlob->cbuffer().as<const void *>(), false);
+        } else {
+            void *srcData = inputBlob->cbuffer().as<void *>();
+            cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
+        }
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    graph->PushInputData(inputName, needConvert ? iconv : inputBlob, applyMeanImage);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
@@ -132,23 +186,144 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::execDataPreprocessingWithMeanValues() {
+    meanAppliedInputs.clear();
+    for (auto& input : _inputs) {
+        auto it = _preProcData.find(input.first);
+        if (it == _preProcData.end())
+            continue;
+
+        const auto& info = _networkInputs[input.first]->getPreProcess();
+        // the graph subtracts mean values only and ignores scales, so the fused path is taken if it gives the same result
+        bool fuseMeanValues = graph->hasMeanImageFor(input.first) && info.getMeanVariant() == InferenceEngine::MEAN_VALUE;
+        for (size_t c = 0; fuseMeanValues && c < info.getNumberOfChannels(); c++)
+            fuseMeanValues = info[c]->stdScale == 1.0f;
+
+        if (fuseMeanValues) {
+            if (it->second->executeWithMeanValues(input.second, info, false, m_curBatch))
+                meanAppliedInputs.insert(input.first);
+        } else {
+            it->second->execute(input.second, info, false, m_curBatch);
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::markQueued() {
+    queueTime = RuntimeStatistics::Clock::now();
+    // the request dropped by its deadline was not dequeued by InferImpl()
+    if (!queued.exchange(true))
+        execNetwork->_runtimeStatistics.requestQueued();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::unmarkQueued() {
+    if (queued.exchange(false))
+        execNetwork->_runtimeStatistics.requestDequeued();
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
 
+    struct StatisticsGuard {
+        StatisticsGuard(RuntimeStatistics& statistics, bool queued, RuntimeStatistics::Clock::time_point queueTime)
+            : _statistics(statistics), _start(RuntimeStatistics::Clock::now()), _requestStart(queued ? queueTime : _start) {
+            if (queued)
+                _statistics.requestDequeued();
+            _statistics.inferenceStarted();
+        }
+        ~StatisticsGuard() {
+            auto end = RuntimeStatistics::Clock::now();
+            _statistics.inferenceFinished(end - _requestStart, end - _start);
+        }
+        RuntimeStatistics& _statistics;
+        RuntimeStatistics::Clock::time_point _start;
+        RuntimeStatistics::Clock::time_point _requestStart;
+    } statisticsGuard{execNetwork->_runtimeStatistics, queued.exchange(false), queueTime};
+
+    // graph of the current stream, it is shared with other requests executed by the stream
     graph = execNetwork->_graphs.local().get();
 
-    execDataPreprocessing(_inputs);
+    {
+        ngraph::event::Duration traceEvent("preprocessing", "request");
+        execDataPreprocessingWithMeanValues();
+    }
+
+    if (execNetwork->IsDynamicShapesEnabled())
+        selectGraphForInputShapes();
 
     changeDefaultPtr();
 
-    PushInputData();
+    {
+        ngraph::event::Duration traceEvent("push inputs", "request");
+        PushInputData();
+    }
 
     graph->Infer(m_curBatch);
 
+    ngraph::event::Duration traceEvent("pull outputs", "request");
     graph->PullOutputData(_outputs);
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::selectGraphForInputShapes() {
+    MKLDNNExecNetwork::InputShapes shapes;
+    bool reshaped = false;
+    for (auto&& input : _inputs) {
+        const auto& dims = input.second->getTensorDesc().getDims();
+        reshaped |= dims != _networkInputs[input.first]->getTensorDesc().getDims();
+        shapes[input.first] = dims;
+    }
+    shapeGraph = reshaped ? execNetwork->GetGraphForShapes(shapes) : nullptr;
+    if (shapeGraph)
+        graph = shapeGraph.get();
+
+    // output blobs follow output shapes of the selected graph
+    InferenceEngine::BlobMap blobs;
+    graph->getOutputBlobs(blobs);
+    for (auto&& output : blobs) {
+        auto found = _outputs.find(output.first);
+        InferenceEngine::TensorDesc desc = output.second->getTensorDesc();
+        if (found != _outputs.end() && found->second->getTensorDesc().getDims() == desc.getDims())
+            continue;
+
+        auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
+        desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
+
+        auto blob = make_blob_with_precision(desc);
+        blob->allocate();
+        _outputs[output.first] = blob;
+        if (isZeroCopyCompatible(output.first, blob, false)) {
+            externalPtr[output.first] = blob->buffer();
+        } else if (externalPtr.find(output.first) != externalPtr.end()) {
+            externalPtr.erase(output.first);
+        }
+    }
+}
+
+InferenceEngine::SizeVector MKLDNNPlugin::MKLDNNInferRequest::dynamicRefDims(const InferenceEngine::Blob::Ptr& blob,
+                                                                             const std::string& name, bool isInput) const {
+    if (!blob || !execNetwork->IsDynamicShapesEnabled())
+        return {};
+    const auto& dims = blob->getTensorDesc().getDims();
+    // outputs are reallocated by the plugin according to shapes of inputs
+    if (!isInput || execNetwork->IsWithinShapeBounds(name, dims))
+        return dims;
+    return {};
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    // reference dims depend on the blob shapes only with dynamic shapes, so results of checks may be reused otherwise
+    if (!execNetwork->IsDynamicShapesEnabled()) {
+        InferRequestInternal::checkBlobs();
+        return;
+    }
+    for (auto const& input : _inputs) {
+        checkBlob(input.second, input.first, true, dynamicRefDims(input.second, input.first, true));
+    }
+    for (auto const& output : _outputs) {
+        checkBlob(output.second, output.first, false, dynamicRefDims(output.second, output.first, false));
+    }
+}
+
 InferenceEngine::StatusCode MKLDNNPlugin::MKLDNNInferRequest::Cancel() {
     graph->Cancel();
     return InferenceEngine::OK;
@@ -159,6 +334,26 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
     graph->GetPerfData(perfMap);
+
+    // input / output nodes report whether user blob memory was bound to the graph directly
+    auto setExecType = [&](const std::string& nodeName, bool zeroCopy) {
+        auto pc = perfMap.find(nodeName);
+        if (pc == perfMap.end())
+            return;
+        std::string execType = zeroCopy ? "zero_copy" : "memcpy";
+        std::fill(std::begin(pc->second.exec_type), std::end(pc->second.exec_type), '\0');
+        execType.copy(pc->second.exec_type, sizeof(pc->second.exec_type) - 1, 0);
+    };
+    for (auto&& input : graph->inputNodes) {
+        if (_networkInputs.find(input.first) == _networkInputs.end())
+            continue;
+        auto found = zeroCopyBound.find(input.first);
+        setExecType(input.second->getName(), found != zeroCopyBound.end() && found->second);
+    }
+    for (auto&& output : graph->outputNodes) {
+        auto found = zeroCopyBound.find(output->getName().substr(4));
+        setExecType(output->getName(), found != zeroCopyBound.end() && found->second);
+    }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) {
@@ -167,6 +362,20 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
 
+    // blobs which were set or allocated before are returned without collecting blobs of the graph
+    auto input = _inputs.find(name);
+    if (input != _inputs.end() && _preProcData.find(name) == _preProcData.end()) {
+        data = input->second;
+        checkBlob(data, name, true, dynamicRefDims(data, name, true));
+        return;
+    }
+    auto output = _outputs.find(name);
+    if (output != _outputs.end()) {
+        data = output->second;
+        checkBlob(data, name, false, dynamicRefDims(data, name, false));
+        return;
+    }
+
     InferenceEngine::BlobMap blobs;
     graph->getInputBlobs(blobs);
 
@@ -180,12 +389,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkBlob(data, name, true, dynamicRefDims(data, name, true));
             return;
         }
 
         InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-        InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
         if (_networkInputs.find(name) != _networkInputs.end()) {
             InferenceEngine::Layout l = _networkInputs[name]->getLayout();
             InferenceEngine::Precision p = _networkInputs[name]->getPrecision();
@@ -194,10 +402,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             desc = InferenceEngine::TensorDesc(p, dims, l);
         }
 
-        _inputs[name] = make_blob_with_precision(desc);
+        _inputs[name] = blobsAllocator ? make_blob_with_precision(desc, blobsAllocator) : make_blob_with_precision(desc);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+        if (isZeroCopyCompatible(name, _inputs[name], true)) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
@@ -209,7 +416,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkBlob(data, name, false, dynamicRefDims(data, name, false));
             return;
         }
 
@@ -222,9 +429,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
         auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
         desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-        _outputs[name] = make_blob_with_precision(desc);
+        _outputs[name] = blobsAllocator ? make_blob_with_precision(desc, blobsAllocator) : make_blob_with_precision(desc);
         _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        if (isZeroCopyCompatible(name, _outputs[name], false)) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -234,6 +441,43 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     THROW_IE_EXCEPTION << "Cannot find blob with name: " << name;
 }
 
+// Items of a batched input are read from their own buffers, so each of them must be a dense memory blob
+// and the batch must be the outermost dimension
+static void checkBatchedInput(const InferenceEngine::BatchedBlob& batched) {
+    const auto layout = batched.getTensorDesc().getLayout();
+    if (layout == InferenceEngine::Layout::CN) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Batched blob with CN layout is not supported";
+    }
+    for (size_t i = 0; i < batched.size(); i++) {
+        auto item = batched.getBlob(i);
+        const auto& desc = item->getTensorDesc();
+        if (!item->is<InferenceEngine::MemoryBlob>() ||
+            desc.getBlockingDesc() != InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), desc.getLayout()).getBlockingDesc()) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Items of batched blob must be dense memory blobs";
+        }
+        if (item->buffer() == nullptr) {
+            THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Item " << i << " of batched blob is not allocated";
+        }
+    }
+}
+
+// Strided inputs are read by mkldnn reorders, so they are limited to the precisions mkldnn supports
+static void checkStridedInput(const InferenceEngine::Blob& data) {
+    switch (data.getTensorDesc().getPrecision()) {
+        case InferenceEngine::Precision::FP32:
+        case InferenceEngine::Precision::BF16:
+        case InferenceEngine::Precision::I32:
+        case InferenceEngine::Precision::I16:
+        case InferenceEngine::Precision::I8:
+        case InferenceEngine::Precision::U8:
+        case InferenceEngine::Precision::BOOL:
+            break;
+        default:
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Strided input blob of " << data.getTensorDesc().getPrecision()
+                               << " precision is not supported";
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "SetBlob");
     if (name == nullptr) {
@@ -243,6 +487,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
     if (!data)
         THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty blob with name: \'" << name << "\'";
     const bool compoundBlobPassed = data->is<InferenceEngine::CompoundBlob>();
+    auto batched = data->as<InferenceEngine::BatchedBlob>();
     if (!compoundBlobPassed && data->buffer() == nullptr)
         THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << name << "\'";
     if (data->size() == 0) {
@@ -251,7 +496,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
 
     InferenceEngine::InputInfo::Ptr foundInput;
     InferenceEngine::DataPtr foundOutput;
-    size_t dataSize = data->size();
+    // items of a batched blob are gathered to the input on inference, it is checked as the whole tensor
+    size_t dataSize = batched ? InferenceEngine::details::product(data->getTensorDesc().getDims()) : data->size();
     if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
         if (foundInput->getPrecision() != data->getTensorDesc().getPrecision()) {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob with precision: "
@@ -260,8 +506,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
 
         const bool preProcRequired = preProcessingRequired(foundInput, data);
         if (compoundBlobPassed && !preProcRequired) {
-            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
-                               << "cannot set compound blob: supported only for input pre-processing";
+            if (!batched) {
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
+                                   << "cannot set compound blob: supported only for input pre-processing";
+            }
+            checkBatchedInput(*batched);
         }
 
         if (preProcRequired) {
@@ -272,6 +521,19 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             // Stores the given blob as ROI blob. It will be used to fill in network input during
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
+        } else if (execNetwork->IsDynamicShapesEnabled() &&
+                   foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+            // graph for these shapes is selected on inference
+            if (!execNetwork->IsWithinShapeBounds(name, data->getTensorDesc().getDims())) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Dimensions are out of network bounds.";
+            }
+            if (data->getTensorDesc().getLayout() != foundInput->getTensorDesc().getLayout()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Layout mismatch.";
+            }
+            if (externalPtr.find(name) != externalPtr.end()) {
+                externalPtr.erase(name);
+            }
+            _inputs[name] = data;
         } else {
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
@@ -287,11 +549,16 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
 
             if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
                 foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
+                // ROI and padded views of the input layout are read in place on inference
+                const auto& inBlk = foundInput->getTensorDesc().getBlockingDesc();
+                const auto& dataBlk = data->getTensorDesc().getBlockingDesc();
+                if (batched || inBlk.getBlockDims() != dataBlk.getBlockDims() || inBlk.getOrder() != dataBlk.getOrder()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
+                }
+                checkStridedInput(*data);
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+            if (!batched && isZeroCopyCompatible(name, data, true)) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -321,8 +588,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (isZeroCopyCompatible(name, data, false)) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -331,16 +597,47 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
     }
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::isZeroCopyCompatible(const std::string& name, const InferenceEngine::Blob::Ptr& data, bool isInput) {
+    if (graph->getProperty().batchLimit || (isInput && graph->hasMeanImageFor(name)))
+        return false;
+
+    InferenceEngine::BlobMap blobs;
+    if (isInput)
+        graph->getInputBlobs(blobs);
+    else
+        graph->getOutputBlobs(blobs);
+    auto found = blobs.find(name);
+    if (found == blobs.end())
+        return false;
+
+    // graph memory is replaced by user memory, so both must have the same precision and physical layout
+    const auto& extDesc = data->getTensorDesc();
+    const auto& intDesc = found->second->getTensorDesc();
+    if (extDesc.getPrecision() != intDesc.getPrecision())
+        return false;
+    const auto& extBlk = extDesc.getBlockingDesc();
+    const auto& intBlk = intDesc.getBlockingDesc();
+    if (extBlk.getBlockDims() != intBlk.getBlockDims() || extBlk.getOrder() != intBlk.getOrder() ||
+            extBlk.getStrides() != intBlk.getStrides() || extBlk.getOffsetPadding() != intBlk.getOffsetPadding())
+        return false;
+
+    auto ptr = reinterpret_cast<uintptr_t>(data->buffer().as<void*>());
+    return ptr != 0 && ptr % extDesc.getPrecision().size() == 0;
+}
+
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
+    zeroCopyBound.clear();
     for (auto& it : externalPtr) {
         auto input = graph->inputNodes.find(it.first);
         if (input != graph->inputNodes.end()) {
-            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
+            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second) {
+                zeroCopyBound[it.first] = true;
                 continue;
+            }
             // Input cannot be in-place with other primitives
             bool canBeInPlace = true;
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
@@ -370,6 +667,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
                 changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
             }
+            zeroCopyBound[it.first] = canBeInPlace;
             continue;
         }
 
@@ -381,8 +679,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             }
         }
         if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
+            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second) {
+                zeroCopyBound[it.first] = true;
                 continue;
+            }
             bool canBeInPlace = true;
             void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
             // Cannot be in-place after concat because concat is using different ptrs without offsets
@@ -404,6 +704,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             } while (previousParent != parent);
             if (canBeInPlace)
                 changeEdgePtr(output->getParentEdgeAt(0), it.second);
+            zeroCopyBound[it.first] = canBeInPlace;
             continue;
         }
         THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
@@ -5,9 +5,13 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_runtime_stats.h"
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <map>
+#include <set>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -47,16 +51,64 @@ public:
 
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
+    void checkBlobs() override;
+
+    /**
+     * @brief Returns priority of the request tasks in the streams executor, it is fixed when the request is created
+     */
+    InferenceEngine::IStreamsExecutor::Priority getPriority() const {
+        return priority;
+    }
+
+    /**
+     * @brief Returns deadline of the request runs, it is fixed when the request is created
+     */
+    std::chrono::milliseconds getDeadline() const {
+        return deadline;
+    }
+
+    /**
+     * @brief Marks the request as waiting in the queue of the streams executor, the time in the queue is
+     * included into the latency reported by RuntimeStatistics
+     */
+    void markQueued();
+
+    /**
+     * @brief Reverts markQueued() if the request was not passed to the executor
+     */
+    void unmarkQueued();
+
 private:
     void PushInputData();
 
+    // runs pre-processing of the inputs and fuses their mean values subtraction into it where possible
+    void execDataPreprocessingWithMeanValues();
+
+    void selectGraphForInputShapes();
+
+    InferenceEngine::SizeVector dynamicRefDims(const InferenceEngine::Blob::Ptr& blob, const std::string& name, bool isInput) const;
+
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
+    bool isZeroCopyCompatible(const std::string& name, const InferenceEngine::Blob::Ptr& data, bool isInput);
+
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    std::atomic<bool>                   queued = {false};
+    std::chrono::steady_clock::time_point queueTime;
+    // graph compiled for current input shapes when they differ from the network ones
+    MKLDNNGraph::Ptr                    shapeGraph;
     std::map<std::string, void*>        externalPtr;
+    // inputs / outputs whose memory was bound to the graph without copy on the last inference
+    std::map<std::string, bool>         zeroCopyBound;
+    // inputs whose mean values were subtracted by pre-processing on the last inference
+    std::set<std::string>               meanAppliedInputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
+    InferenceEngine::IStreamsExecutor::Priority priority = InferenceEngine::IStreamsExecutor::NORMAL;
+    std::chrono::milliseconds           deadline {0};
+    // places blobs of the request on a NUMA node, nullptr on single node systems
+    std::shared_ptr<InferenceEngine::IAllocator> blobsAllocator;
 };
 }  // namespace MKLDNNPlugin
@@ -143,6 +143,18 @@ void MKLDNNMemory::SetData(const MKLDNNMemory& memory, bool ftz) const {
     }
 }
 
+void MKLDNNMemory::SetData(const TensorDesc& desc, const void* data, bool ftz) const {
+    // Strided views (ROI, padded rows) are read in place by the reorder. The view offset is already counted
+    // in the offset padding, so the offsets to data are reset to not apply it twice.
+    const auto& blk = desc.getBlockingDesc();
+    TensorDesc viewDesc(desc.getPrecision(), desc.getDims(),
+                        BlockingDesc(blk.getBlockDims(), blk.getOrder(), blk.getOffsetPadding(),
+                                     SizeVector(blk.getOrder().size(), 0), blk.getStrides()));
+    MKLDNNMemory src(eng);
+    src.Create(MKLDNNMemoryDesc(viewDesc), data, false);
+    SetData(src, ftz);
+}
+
 void MKLDNNMemory::FillZero() {
     void* dataPtr = GetData();
     memset(dataPtr, 0, GetSize());
@@ -249,6 +261,13 @@ bool MKLDNNMemory::isConsistant(memory::dims dims, memory::format format) {
     return (dims.size() == ndims);
 }
 
+bool MKLDNNMemory::IsDense(const TensorDesc& desc) {
+    if (desc.getLayout() == ANY || desc.getLayout() == SCALAR)
+        return true;
+    const auto& blk = desc.getBlockingDesc();
+    return blk == BlockingDesc(blk.getBlockDims(), blk.getOrder());
+}
+
 bool MKLDNNMemory::IsPlainFormat(memory::format format) {
     std::vector<memory::format> plains = {
     /* 1D */  memory::x,
@@ -106,10 +106,12 @@ public:
 
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format format, const void* data, size_t size, bool ftz = true) const;
     void SetData(const MKLDNNMemory& memory, bool ftz = true) const;
+    void SetData(const InferenceEngine::TensorDesc& desc, const void* data, bool ftz = true) const;
 
     void FillZero();
 
     static bool IsPlainFormat(mkldnn::memory::format format);
+    static bool IsDense(const InferenceEngine::TensorDesc& desc);
     static bool IsGroupedFormat(mkldnn::memory::format format);
     static mkldnn::memory::format GetPlainFormat(mkldnn::memory::dims dims);
     static InferenceEngine::Layout GetPlainLayout(mkldnn::memory::dims dims);
@@ -7,6 +7,7 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 #include <map>
 
@@ -56,8 +57,27 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
     }
 }
 
-int64_t MemorySolver::solve() {
+int64_t MemorySolver::solve(Strategy strategy) {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+
+    if (strategy == Strategy::Greedy)
+        return solveGreedy();
+
+    const auto boxes = _boxes;
+    int64_t greedy_required = solveGreedy();
+    auto greedy_offsets = std::move(_offsets);
+
+    _boxes = boxes;
+    _offsets.clear();
+    int64_t best_fit_required = solveBestFit();
+    if (best_fit_required < greedy_required)
+        return best_fit_required;
+
+    _offsets = std::move(greedy_offsets);
+    return greedy_required;
+}
+
+int64_t MemorySolver::solveGreedy() {
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
@@ -96,6 +116,54 @@ int64_t MemorySolver::solve() {
     return _min_required;
 }
 
+int64_t MemorySolver::solveBestFit() {
+    // Biggest first. For the same size longer living box goes first, it is harder to find a place for it later
+    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
+        if (l.size != r.size) return l.size > r.size;
+        if (l.finish - l.start != r.finish - r.start) return l.finish - l.start > r.finish - r.start;
+        return l.start < r.start;
+    });
+
+    int64_t _min_required = 0;
+    std::vector<const Box*> placed;
+    placed.reserve(_boxes.size());
+    std::vector<const Box*> alive;
+
+    for (Box& box : _boxes) {
+        int64_t id = box.id;
+
+        // already placed boxes which live at the same time with current one, ordered by offset
+        alive.clear();
+        for (auto *other : placed) {
+            if (other->start <= box.finish && box.start <= other->finish)
+                alive.push_back(other);
+        }
+        std::sort(alive.begin(), alive.end(), [](const Box* l, const Box* r) { return l->id < r->id; });
+
+        // find the smallest gap which fits the box, otherwise put it above all alive boxes
+        int64_t best_offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t gap_start = 0;
+        for (auto *other : alive) {
+            int64_t gap = other->id - gap_start;
+            if (gap >= box.size && gap < best_gap) {
+                best_gap = gap;
+                best_offset = gap_start;
+            }
+            gap_start = std::max(gap_start, other->id + other->size);
+        }
+        if (best_offset == -1) best_offset = gap_start;
+
+        box.id = best_offset;  // id will be used as offset storage
+        placed.push_back(&box);
+
+        _min_required = std::max(_min_required, box.id + box.size);
+        _offsets[id] = box.id;
+    }
+
+    return _min_required;
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
@@ -119,12 +187,18 @@ void MemorySolver::calcDepth() {
     int64_t depth = 0;
     std::map<int64_t, std::vector<const Box*>> release_at;
 
-    for (const Box& box : _boxes) {
-        int64_t time = box.start;
-        depth += box.size;
+    // solve() reorders boxes, so walk them in order of start
+    std::vector<const Box*> boxes;
+    boxes.reserve(_boxes.size());
+    for (const Box& box : _boxes) boxes.push_back(&box);
+    std::stable_sort(boxes.begin(), boxes.end(), [](const Box* l, const Box* r) { return l->start < r->start; });
+
+    for (const Box* box : boxes) {
+        int64_t time = box->start;
+        depth += box->size;
         top_depth++;
 
-        release_at[box.finish+1].push_back(&box);
+        release_at[box->finish+1].push_back(box);
 
         for (const Box *b : release_at[time]) {
             depth -= b->size;
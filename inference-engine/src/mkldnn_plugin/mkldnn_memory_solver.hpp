@@ -65,13 +65,26 @@ public:
         int64_t id;
     };
 
+    /** @brief Strategies of boxes placement */
+    enum class Strategy {
+        /** Biggest boxes first, each one is lifted up until it has no intersections */
+        Greedy,
+        /**
+         * Biggest and longest living boxes first, each one is put into the smallest gap
+         * between boxes living at the same time. As a result the smaller of this and Greedy
+         * solutions is used, so it is never worse than Greedy.
+         */
+        BestFit,
+    };
+
     explicit MemorySolver(const std::vector<Box>& boxes);
 
     /**
      * @brief Solve memory location with maximal reuse.
+     * @param strategy Strategy of boxes placement
      * @return Size of common memory blob required for storing all
      */
-    int64_t solve();
+    int64_t solve(Strategy strategy = Strategy::Greedy);
 
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
@@ -89,6 +102,8 @@ private:
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t solveGreedy();
+    int64_t solveBestFit();
 };
 
 }  // namespace MKLDNNPlugin
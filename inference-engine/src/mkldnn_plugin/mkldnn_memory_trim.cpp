@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_trim.h"
+
+#include <cstdint>
+
+#ifdef __linux__
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+#ifdef __linux__
+
+size_t ReleaseMemoryPages(void* data, size_t size) {
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(data) + pageSize - 1) / pageSize * pageSize;
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size) / pageSize * pageSize;
+    if (end <= begin)
+        return 0;
+
+    auto* pages = reinterpret_cast<void*>(begin);
+    const size_t length = end - begin;
+    std::vector<unsigned char> resident(length / pageSize);
+    size_t released = 0;
+    if (mincore(pages, length, resident.data()) == 0) {
+        for (auto page : resident) {
+            if (page & 1)
+                released += pageSize;
+        }
+    }
+    // anonymous private memory reads as zeros after MADV_DONTNEED
+    if (madvise(pages, length, MADV_DONTNEED) != 0)
+        return 0;
+    return released;
+}
+
+#else
+
+size_t ReleaseMemoryPages(void* /*data*/, size_t /*size*/) {
+    return 0;
+}
+
+#endif
+
+}  // namespace MKLDNNPlugin
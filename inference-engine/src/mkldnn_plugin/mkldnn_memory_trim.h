@@ -0,0 +1,20 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Returns physical pages of the memory range to the OS while keeping the range mapped (Linux only).
+ *
+ * Only pages entirely inside the range are released. Their content is lost: the next access reads zeros and
+ * faults the pages in again, so the memory is reallocated lazily. Returns the number of bytes which were
+ * resident before the call, 0 on other OSes.
+ */
+size_t ReleaseMemoryPages(void* data, size_t size);
+
+}  // namespace MKLDNNPlugin
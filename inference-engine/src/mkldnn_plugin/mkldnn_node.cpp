@@ -7,6 +7,8 @@
 #include "mkldnn_itt.h"
 
 #include "caseless.hpp"
+#include "ie_algorithm.hpp"
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <limits>
@@ -49,6 +51,7 @@
 
 #include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_debug.h"
+#include <ie_system_conf.h>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -391,6 +394,8 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     SEARCH_TYPE(jit);
     SEARCH_TYPE(gemm);
     SEARCH_TYPE(ref);
+    SEARCH_TYPE(sparse);
+    SEARCH_TYPE(compressed);
 
     SEARCH_TYPE(avx512);
     SEARCH_TYPE(avx2);
@@ -432,6 +437,65 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     return str_type;
 }
 
+static impl_desc_type getImplementationIsaType(impl_desc_type type) {
+    for (auto isa : {impl_desc_type::avx512, impl_desc_type::avx2, impl_desc_type::avx, impl_desc_type::sse42}) {
+        if ((type & isa) == isa)
+            return isa;
+    }
+    return impl_desc_type::unknown;
+}
+
+bool MKLDNNNode::isInt8Implementation() const {
+    auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
+    if (!selectedPrimitiveDesc || selectedPrimitiveDesc->getConfig().inConfs.empty())
+        return false;
+    auto precision = selectedPrimitiveDesc->getConfig().inConfs[0].desc.getPrecision();
+    return precision == InferenceEngine::Precision::I8 || precision == InferenceEngine::Precision::U8;
+}
+
+std::string MKLDNNNode::getImplementationIsa() const {
+    auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
+    impl_desc_type type = selectedPrimitiveDesc ? selectedPrimitiveDesc->getImplementationType() : impl_desc_type::unknown;
+
+    if ((type & impl_desc_type::ref) == impl_desc_type::ref)
+        return "ref";
+
+    impl_desc_type isa = getImplementationIsaType(type);
+    // jit_uni kernels of the plugin are generated for the best instruction set of the machine
+    if (isa == impl_desc_type::unknown && (type & impl_desc_type::jit_uni) == impl_desc_type::jit_uni) {
+        isa = with_cpu_x86_avx512f() ? impl_desc_type::avx512
+            : with_cpu_x86_avx2() ? impl_desc_type::avx2 : impl_desc_type::sse42;
+    }
+
+    switch (isa) {
+        case impl_desc_type::avx512:
+            return isInt8Implementation() && with_cpu_x86_avx512_core_vnni() ? "avx512_vnni" : "avx512";
+        case impl_desc_type::avx2:
+            return "avx2";
+        case impl_desc_type::avx:
+            return "avx";
+        case impl_desc_type::sse42:
+            return "sse42";
+        default:
+            break;
+    }
+    if ((type & impl_desc_type::blas) == impl_desc_type::blas)
+        return "blas";
+    if ((type & impl_desc_type::any) == impl_desc_type::any)
+        return "any";
+    return "unknown";
+}
+
+void MKLDNNNode::filterSupportedPrimitiveDescriptorsByIsa(impl_desc_type maxIsa) {
+    auto aboveMaxIsa = [&](const PrimitiveDescInfo& desc) {
+        return getImplementationIsaType(desc.getImplementationType()) > maxIsa;
+    };
+    if (std::all_of(supportedPrimitiveDescriptors.begin(), supportedPrimitiveDescriptors.end(), aboveMaxIsa))
+        return;
+    supportedPrimitiveDescriptors.erase(std::remove_if(supportedPrimitiveDescriptors.begin(), supportedPrimitiveDescriptors.end(), aboveMaxIsa),
+                                        supportedPrimitiveDescriptors.end());
+}
+
 const MKLDNNEdgePtr MKLDNNNode::getParentEdgeAt(size_t idx) const {
     if (idx >= parentEdges.size())
         THROW_IE_EXCEPTION << "Node " << getName() << " contains less parent edges than " << idx;
@@ -495,6 +559,35 @@ std::vector<memory::format> MKLDNNNode::getAvailableFormatsForDims(const MKLDNND
     return {memory::format::any};
 }
 
+size_t MKLDNNNode::getParallelWorkAmount() const {
+    size_t workAmount = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        workAmount = std::max(workAmount, static_cast<size_t>(getParentEdgeAt(i)->getDims().size()));
+    for (size_t i = 0; i < getChildEdges().size(); i++)
+        workAmount = std::max(workAmount, static_cast<size_t>(getChildEdgeAt(i)->getDims().size()));
+    return workAmount;
+}
+
+size_t MKLDNNNode::getBytesRead() const {
+    size_t bytes = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto desc = getParentEdgeAt(i)->getDesc();
+        bytes += desc.getPrecision().size() * InferenceEngine::details::product(desc.getDims().begin(), desc.getDims().end());
+    }
+    for (const auto& blobMemory : internalBlobMemory)
+        bytes += blobMemory->GetSize();
+    return bytes;
+}
+
+size_t MKLDNNNode::getBytesWritten() const {
+    size_t bytes = 0;
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto desc = getChildEdgeAt(i)->getDesc();
+        bytes += desc.getPrecision().size() * InferenceEngine::details::product(desc.getDims().begin(), desc.getDims().end());
+    }
+    return bytes;
+}
+
 void MKLDNNNode::execute(mkldnn::stream strm) {
     if (prim) {
         strm.submit({*prim});
@@ -749,8 +842,13 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             MKLDNNMemory memory{ engine };
             memory.Create(MKLDNNMemoryDesc(newDesc.getDims(), newDesc.getDataType(), newFormat), internalBlob->buffer());
 
-            MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
-            _ptr->Create(intDescs[i]);
+            MKLDNNMemoryPtr _ptr;
+            if (weightCache != nullptr) {
+                _ptr = weightCache->createMemory(engine, intDescs[i]);
+            } else {
+                _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
+                _ptr->Create(intDescs[i]);
+            }
             _ptr->SetData(memory);
 
             return _ptr;
@@ -758,14 +856,17 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            uint64_t data_hash = 0;
+            {
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNNode::prepareMemory::hash");
+                data_hash = weightCache->GetHashFunc().hash(internalBlob->buffer(), internalBlob->byteSize());
+            }
 
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
                                             + "_" + std::to_string(data_hash);
 
-            ptr = weightCache->findOrCreate(string_hash, create);
+            ptr = weightCache->findOrCreate(string_hash, engine, intDescs[i], create);
         } else {
             ptr = create();
         }
@@ -395,8 +395,43 @@ public:
 
     std::string getPrimitiveDescriptorType();
 
+    /**
+     * @brief Instruction set of selected implementation: "avx512_vnni", "avx512", "avx2", "avx", "sse42",
+     * "ref", "blas", "any" (selected by implementation in runtime) or "unknown"
+     */
+    std::string getImplementationIsa() const;
+
+    /**
+     * @brief Returns true if selected implementation consumes I8/U8 data
+     */
+    bool isInt8Implementation() const;
+
     PerfCount &PerfCounter() { return perfCounter; }
 
+    /**
+     * @brief Estimation of work amount used to decide whether the node loops should run in parallel,
+     * number of elements of the largest input or output tensor by default
+     */
+    virtual size_t getParallelWorkAmount() const;
+
+    /**
+     * @brief Estimation of number of operations performed by one execution, multiply and add are counted separately.
+     * Returns 0 if the node doesn't provide an estimation.
+     */
+    virtual uint64_t getOperationsCount() const {
+        return 0;
+    }
+
+    /**
+     * @brief Size of inputs and internal blobs (weights, biases) read by one execution
+     */
+    size_t getBytesRead() const;
+
+    /**
+     * @brief Size of outputs written by one execution
+     */
+    size_t getBytesWritten() const;
+
     virtual void setDynamicBatchLim(int lim);
 
     void resolveNotAllocatedEdges();
@@ -409,6 +444,12 @@ public:
      */
     virtual void filterSupportedPrimitiveDescriptors();
 
+    /**
+     * @brief Removes supportedPrimitiveDescriptors implemented with instruction set above maxIsa
+     * (one of impl_desc_type::sse42, avx, avx2, avx512). Nothing is removed if no other descriptors remain.
+     */
+    void filterSupportedPrimitiveDescriptorsByIsa(impl_desc_type maxIsa);
+
     virtual void createPrimitive() = 0;
 
     virtual void selectOptimalPrimitiveDescriptor();
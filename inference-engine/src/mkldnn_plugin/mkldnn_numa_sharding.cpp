@@ -0,0 +1,76 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_numa_sharding.h"
+
+#include <memory>
+
+#ifdef __linux__
+#include <climits>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+MKLDNNMemoryPtr createMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc) {
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng));
+    ptr->Create(desc);
+    return ptr;
+}
+
+}  // namespace
+
+#ifdef __linux__
+
+MKLDNNMemoryPtr CreateNumaShardedMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc,
+                                        size_t rowSize, const std::vector<int>& numaNodes) {
+    const size_t size = mkldnn::memory::primitive_desc(desc, eng).get_size();
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    if (numaNodes.size() < 2 || rowSize == 0 || size % rowSize != 0)
+        return createMemory(eng, desc);
+
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED)
+        return createMemory(eng, desc);
+
+    // pages are not touched yet, so the policy defines where they are placed on the first write.
+    // On failure (e.g. a kernel without NUMA support) pages are placed by the default first-touch policy
+    constexpr int mpolPreferred = 1;  // MPOL_PREFERRED from linux/mempolicy.h
+    const size_t bitsPerWord = sizeof(unsigned long) * CHAR_BIT;
+    const size_t rows = size / rowSize;
+    const size_t shards = numaNodes.size();
+    auto shardBegin = [&](size_t shard) {
+        return shard == shards ? size : rows * shard / shards * rowSize / pageSize * pageSize;
+    };
+    for (size_t shard = 0; shard < shards; shard++) {
+        const size_t begin = shardBegin(shard), end = shardBegin(shard + 1);
+        if (begin >= end)
+            continue;
+        const size_t node = static_cast<size_t>(numaNodes[shard]);
+        std::vector<unsigned long> nodeMask(node / bitsPerWord + 1, 0);
+        nodeMask[node / bitsPerWord] = 1ul << (node % bitsPerWord);
+        syscall(SYS_mbind, static_cast<char*>(addr) + begin, end - begin, mpolPreferred,
+                nodeMask.data(), nodeMask.size() * bitsPerWord + 1, 0);
+    }
+
+    std::shared_ptr<void> mapping(addr, [size](void* p) { munmap(p, size); });
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng), [mapping](MKLDNNMemory* memory) { delete memory; });
+    ptr->Create(desc, addr);
+    return ptr;
+}
+
+#else
+
+MKLDNNMemoryPtr CreateNumaShardedMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc,
+                                        size_t /*rowSize*/, const std::vector<int>& /*numaNodes*/) {
+    return createMemory(eng, desc);
+}
+
+#endif
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,24 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_memory.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Creates memory of a table whose rows are split into contiguous shards, one per NUMA node (Linux only).
+ *
+ * Shard k holds rows [k * rows / n, (k + 1) * rows / n), its pages are bound to numaNodes[k] before the first
+ * write, so the table is stored once and a lookup of a row reads the memory of the node owning it. Shard
+ * borders are aligned down to pages. With less than two nodes or on other OSes the memory is allocated as usual.
+ */
+MKLDNNMemoryPtr CreateNumaShardedMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc,
+                                        size_t rowSize, const std::vector<int>& numaNodes);
+
+}  // namespace MKLDNNPlugin
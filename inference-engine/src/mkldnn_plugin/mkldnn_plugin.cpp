@@ -14,12 +14,16 @@
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
 #include <ie_system_conf.h>
 #include <generic_ie.hpp>
 #include <nodes/list.hpp>
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_transformer.h>
 #include <ie_ngraph_utils.hpp>
+#include <xml_parse_utils.h>
 
 #include <legacy/convert_function_to_cnn_network.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/convert_opset1_to_legacy.hpp>
@@ -34,6 +38,7 @@
 
 #include <transformations/common_optimizations/common_optimizations.hpp>
 #include <transformations/common_optimizations/depth_to_space_fusion.hpp>
+#include <transformations/common_optimizations/conv_input_fusion.hpp>
 #include <transformations/op_conversions/convert_depth_to_space.hpp>
 #include <transformations/op_conversions/convert_space_to_depth.hpp>
 #include <transformations/op_conversions/convert_gelu.hpp>
@@ -61,8 +66,10 @@
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/constant_folding.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
@@ -84,7 +91,29 @@
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
-Engine::Engine() {
+static std::string getBrandString() {
+    std::string brand_string;
+#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
+    unsigned int addr_list[3] = { 0x80000002, 0x80000003, 0x80000004 };
+    unsigned int regs[4];
+    for (auto addr : addr_list) {
+        regs[0] = addr;
+#if defined(_WIN32) || defined(WIN32)
+        __cpuid(reinterpret_cast<int*>(regs), regs[0]);
+#else
+        __get_cpuid(regs[0], &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+        char *ch = reinterpret_cast<char*>(&regs[0]);
+        for (size_t j = 0; j < sizeof(regs); j++)
+            brand_string += ch[j];
+    }
+#else
+    brand_string = "Non Intel Architecture";
+#endif
+    return brand_string;
+}
+
+Engine::Engine() : autotuneCache(std::make_shared<ConvAutotuneCache>(getBrandString())) {
     _pluginName = "CPU";
     extensionManager->AddExtension(std::make_shared<Extensions::Cpu::MKLDNNExtensions>());
 }
@@ -105,6 +134,9 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
     manager.register_pass<ngraph::pass::ConvertPriorBox>();
     manager.register_pass<ngraph::pass::ConvertNMS5ToLegacyMatcher>();
     manager.register_pass<ngraph::pass::CommonOptimizations>();
+    // input normalization (u8 image -> mean -> scale) is folded into the first convolution instead of passes over the input
+    manager.register_pass<ngraph::pass::ConvolutionInputFusion>();
+    manager.register_pass<ngraph::pass::ConstantFolding>();
     manager.register_pass<ngraph::pass::ConvertRNNSequenceToTensorIterator>();
     manager.register_pass<ngraph::pass::ConvertGRUSequenceToTensorIterator>();
     manager.register_pass<ngraph::pass::ConvertLSTMSequenceToTensorIterator>();
@@ -193,6 +225,39 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
                 return true;
             });
 
+    // RNN primitive processes the whole sequence at once, so the sequence is kept as is when all the batches
+    // have the maximal length; otherwise it is executed as TensorIterator which takes sequence lengths into account
+    auto isSequencePrimitiveSupported = [](const_node_ptr &node) -> bool {
+        const size_t seqLengthsPort = ngraph::is_type<const ngraph::opset5::LSTMSequence>(node) ? 3 : 2;
+        const auto seqLengths = std::dynamic_pointer_cast<const ngraph::opset5::Constant>(
+                node->input_value(seqLengthsPort).get_node_shared_ptr());
+        if (!seqLengths)
+            return false;
+
+        const int64_t maxSeqLength = node->get_input_shape(0).at(1);
+        const auto lengths = seqLengths->cast_vector<int64_t>();
+        if (!std::all_of(lengths.begin(), lengths.end(), [&](int64_t length) { return length == maxSeqLength; }))
+            return false;
+
+        if (const auto &rnn_seq = std::dynamic_pointer_cast<const ngraph::opset5::RNNSequence>(node)) {
+            return rnn_seq->get_clip() == 0.0f;
+        } else if (const auto &gru_seq = std::dynamic_pointer_cast<const ngraph::opset5::GRUSequence>(node)) {
+            return gru_seq->get_clip() == 0.0f
+                   && gru_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh"};
+        } else if (const auto &lstm_seq = std::dynamic_pointer_cast<const ngraph::opset5::LSTMSequence>(node)) {
+            return lstm_seq->get_clip() == 0.0f &&
+                   lstm_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh", "tanh"};
+        }
+        return false;
+    };
+
+    pass_config->set_callback<ngraph::pass::ConvertRNNSequenceToTensorIterator,
+                              ngraph::pass::ConvertGRUSequenceToTensorIterator,
+                              ngraph::pass::ConvertLSTMSequenceToTensorIterator>(
+            [isSequencePrimitiveSupported](const_node_ptr &node) -> bool {
+                return isSequencePrimitiveSupported(node);
+            });
+
     // List of enabled/disabled transformations
     pass_config->disable<ngraph::pass::ConvertGELU>();
     pass_config->disable<ngraph::pass::HSwishDecomposition>();
@@ -269,6 +334,50 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
     }
 }
 
+// Everything but the function itself which the result of Transformation() depends on
+static std::string TransformationKey(const InferenceEngine::CNNNetwork &network, const Config& conf) {
+    std::ostringstream key;
+    for (auto&& item : conf._config)
+        key << item.first << '=' << item.second << ';';
+    for (auto&& input : network.getInputsInfo()) {
+        key << "in:" << input.first << ':' << input.second->getPrecision() << ':' << input.second->getLayout();
+        for (auto dim : input.second->getTensorDesc().getDims())
+            key << ',' << dim;
+        key << ';';
+    }
+    for (auto&& output : network.getOutputsInfo())
+        key << "out:" << output.first << ':' << output.second->getPrecision() << ':' << output.second->getLayout() << ';';
+    return key.str();
+}
+
+// transformed is the result of Transformation() for the network if it is already known
+static ICNNNetwork::Ptr TransformNetwork(const InferenceEngine::CNNNetwork &network, const Config& conf,
+                                         ICNNNetwork::Ptr transformed = nullptr) {
+    bool is_transformed = transformed != nullptr;
+    std::shared_ptr<ICNNNetwork> clonedNetwork = is_transformed ? transformed : InferenceEngine::cloneNetwork(network);
+
+    if (!is_transformed && clonedNetwork->getFunction()) {
+        Transformation(clonedNetwork, conf);
+        is_transformed = true;
+    }
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
+    if (implNetwork) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
+        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
+        ConstTransformer transformator(implNetwork.get());
+        transformator.fullTrim();
+        if (!is_transformed) {
+            NetPass::ConvertPrecision(*implNetwork, Precision::I64, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U64, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U32, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::FP16, Precision::FP32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::BOOL, Precision::U8);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U16, Precision::I32);
+        }
+    }
+    return clonedNetwork;
+}
+
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -302,30 +411,110 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    std::shared_ptr<ICNNNetwork> clonedNetwork = InferenceEngine::cloneNetwork(network);
+    ICNNNetwork::Ptr transformed;
+    if (network.getFunction()) {
+        std::lock_guard<std::mutex> lock{queriedNetworkMutex};
+        if (queriedNetwork.transformed && queriedNetwork.function.lock() == network.getFunction() &&
+            queriedNetwork.key == TransformationKey(network, conf)) {
+            transformed = queriedNetwork.transformed;
+        }
+        queriedNetwork = {};
+    }
 
-    bool is_transformed = false;
-    if (clonedNetwork->getFunction()) {
-        Transformation(clonedNetwork, conf);
-        is_transformed = true;
+    auto clonedNetwork = TransformNetwork(network, conf, transformed);
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing, network,
+                                                           autotuneCache);
+    if (conf.dynamicShapes) {
+        execNetwork->EnableDynamicShapes([conf] (const InferenceEngine::CNNNetwork& reshaped) {
+            return TransformNetwork(reshaped, conf);
+        });
     }
-    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
-    if (implNetwork) {
-        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
-        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
-        ConstTransformer transformator(implNetwork.get());
-        transformator.fullTrim();
-        if (!is_transformed) {
-            NetPass::ConvertPrecision(*implNetwork, Precision::I64, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U64, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U32, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::FP16, Precision::FP32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::BOOL, Precision::U8);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U16, Precision::I32);
+    return execNetwork;
+}
+
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+
+    // see MKLDNNExecNetwork::ExportImpl for the format description
+    std::string cpuXmlStr;
+    std::getline(networkModel, cpuXmlStr);
+
+    pugi::xml_document cpuXmlDoc;
+    pugi::xml_parse_result res = cpuXmlDoc.load_string(cpuXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+    pugi::xml_node cpuNode = cpuXmlDoc.document_element();
+
+    std::map<std::string, std::string> importedConfig;
+    auto configsNode = cpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty();
+         configNode = configNode.next_sibling("config")) {
+        importedConfig.emplace(GetStrAttr(configNode, "key"), GetStrAttr(configNode, "value"));
+    }
+    for (auto&& c : config) {
+        importedConfig[c.first] = c.second;
+    }
+
+    // benchmarking results are valid for the same CPU model only
+    auto autotuneNode = cpuNode.child("autotune");
+    if (!autotuneNode.empty() && GetStrAttr(autotuneNode, "host") == autotuneCache->getHostName()) {
+        for (auto convNode = autotuneNode.child("conv"); !convNode.empty(); convNode = convNode.next_sibling("conv")) {
+            autotuneCache->insert(GetStrAttr(convNode, "key"), static_cast<impl_desc_type>(GetIntAttr(convNode, "impl")));
         }
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    std::uint64_t dataSize = 0;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    std::string xmlString(static_cast<std::size_t>(dataSize), '\0');
+    networkModel.read(&xmlString[0], dataSize);
+
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    Blob::Ptr dataBlob;
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(
+            TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        networkModel.read(dataBlob->buffer(), dataSize);
+    }
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION << "Error reading CPU network from stream";
+    }
+
+    auto cnnnetwork = GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
+
+    auto inputs = cnnnetwork.getInputsInfo();
+    auto inputsNode = cpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto input = inputs.find(GetStrAttr(inputNode, "name"));
+        if (input == inputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network does not contain input " << GetStrAttr(inputNode, "name");
+        }
+        input->second->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        input->second->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+        input->second->getPreProcess().setResizeAlgorithm(static_cast<ResizeAlgorithm>(GetIntAttr(inputNode, "resize")));
+        input->second->getPreProcess().setColorFormat(static_cast<ColorFormat>(GetIntAttr(inputNode, "color")));
+    }
+
+    auto outputs = cnnnetwork.getOutputsInfo();
+    auto outputsNode = cpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto output = outputs.find(GetStrAttr(outputNode, "name"));
+        if (output == outputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network does not contain output " << GetStrAttr(outputNode, "name");
+        }
+        output->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        output->second->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+
+    return LoadNetwork(cnnnetwork, importedConfig);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -368,27 +557,11 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+        metrics.push_back(METRIC_KEY(CPU_AVAILABLE_PROCESSORS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
-        std::string brand_string;
-#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
-        unsigned int addr_list[3] = { 0x80000002, 0x80000003, 0x80000004 };
-        unsigned int regs[4];
-        for (auto addr : addr_list) {
-            regs[0] = addr;
-#if defined(_WIN32) || defined(WIN32)
-            __cpuid(reinterpret_cast<int*>(regs), regs[0]);
-#else
-            __get_cpuid(regs[0], &regs[0], &regs[1], &regs[2], &regs[3]);
-#endif
-            char *ch = reinterpret_cast<char*>(&regs[0]);
-            for (size_t j = 0; j < sizeof(regs); j++)
-                brand_string += ch[j];
-        }
-#else
-        brand_string = "Non Intel Architecture";
-#endif
-        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, brand_string);
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, getBrandString());
     } else if (name == METRIC_KEY(AVAILABLE_DEVICES)) {
         std::vector<std::string> availableDevices = { "" };
         IE_SET_METRIC_RETURN(AVAILABLE_DEVICES, availableDevices);
@@ -402,6 +575,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         capabilities.push_back(METRIC_VALUE(FP16));
         capabilities.push_back(METRIC_VALUE(INT8));
         capabilities.push_back(METRIC_VALUE(BIN));
+        capabilities.push_back(METRIC_VALUE(BATCHED_BLOB));
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -412,8 +586,15 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         std::tuple<unsigned int, unsigned int, unsigned int> range = std::make_tuple(1, 1, 1);
         IE_SET_METRIC_RETURN(RANGE_FOR_ASYNC_INFER_REQUESTS, range);
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
-        std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
+        // more streams than the container CPU quota allows are throttled
+        std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, std::max(1, std::min(parallel_get_max_threads(),
+                                                                                                getNumberOfLogicalCPUCores())));
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        // imported networks are compiled again from the IR, so caching them in KEY_CACHE_DIR does not pay off
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, false);
+    } else if (name == METRIC_KEY(CPU_AVAILABLE_PROCESSORS)) {
+        IE_SET_METRIC_RETURN(CPU_AVAILABLE_PROCESSORS, static_cast<unsigned int>(getNumberOfLogicalCPUCores()));
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -445,11 +626,12 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
         Transformation(clonedNetwork, conf);
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
+        mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
         for (details::CNNNetworkIterator itLayer{clonedNetwork.get()}; itLayer != details::CNNNetworkIterator(); itLayer++) {
             auto layerIsSupported = [&] {
                 std::unique_ptr<MKLDNNNode> ptr;
                 try {
-                    ptr.reset(MKLDNNNode::factory().create(*itLayer, {mkldnn::engine::kind::cpu, 0}, extensionManager, fake_w_cache));
+                    ptr.reset(MKLDNNNode::factory().create(*itLayer, eng, extensionManager, fake_w_cache));
                 } catch (InferenceEngine::details::InferenceEngineException&) {
                      return false;
                 }
@@ -498,6 +680,10 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
         for (auto&& layerName : supported) {
             res.supportedLayersMap.emplace(layerName, GetName());
         }
+
+        // the same network is often loaded right after the query
+        std::lock_guard<std::mutex> lock{queriedNetworkMutex};
+        queriedNetwork = {function, TransformationKey(network, conf), clonedNetwork};
     } else {
         details::CNNNetworkIterator i(network);
         while (i != details::CNNNetworkIterator()) {
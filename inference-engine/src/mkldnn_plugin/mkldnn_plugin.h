@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <memory>
 #include <functional>
+#include <mutex>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -36,10 +37,25 @@ public:
     InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork& network,
                                                      const std::map<std::string, std::string>& config) const override;
 
+    InferenceEngine::ExecutableNetwork ImportNetworkImpl(std::istream& networkModel,
+                                                         const std::map<std::string, std::string>& config) override;
+
 private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
+    // convolution implementations selected by benchmarking, shared by all networks of the plugin
+    ConvAutotuneCache::Ptr autotuneCache;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
+
+    // Network transformed by the last QueryNetwork. It is taken by LoadNetwork of the same function
+    // with the same inputs, outputs and config, so the transformations are not run twice.
+    struct QueriedNetwork {
+        std::weak_ptr<const ngraph::Function> function;
+        std::string key;
+        InferenceEngine::ICNNNetwork::Ptr transformed;
+    };
+    mutable std::mutex queriedNetworkMutex;
+    mutable QueriedNetwork queriedNetwork;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Live counters of executable network updated by infer requests. They are plain atomics,
+ * so they are always collected and can be read at any time without KEY_PERF_COUNT.
+ */
+class RuntimeStatistics {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    RuntimeStatistics() : _startTime(Clock::now()) {
+        for (auto&& bucket : _latencyBuckets)
+            bucket = 0;
+    }
+
+    void requestQueued() {
+        ++_queued;
+    }
+
+    void requestDequeued() {
+        --_queued;
+    }
+
+    void inferenceStarted() {
+        ++_running;
+    }
+
+    /**
+     * @brief Accounts finished inference
+     * @param latency time from request start to the end of the inference including time in the queue
+     * @param busy time the stream spent on the inference
+     */
+    void inferenceFinished(Clock::duration latency, Clock::duration busy) {
+        --_running;
+        ++_inferences;
+        _busyTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(busy).count();
+        ++_latencyBuckets[bucketIndex(std::chrono::duration_cast<std::chrono::microseconds>(latency).count())];
+    }
+
+    /**
+     * @brief Returns counters as a map: "inferences", "queued", "running", "busy_us" (sum over streams),
+     * "uptime_us" and "latency_p50_us", "latency_p90_us", "latency_p99_us" estimated with up to 25% error
+     */
+    std::map<std::string, uint64_t> get() const {
+        std::map<std::string, uint64_t> statistics;
+        statistics["inferences"] = _inferences.load();
+        statistics["queued"] = static_cast<uint64_t>(std::max<int64_t>(_queued.load(), 0));
+        statistics["running"] = static_cast<uint64_t>(std::max<int64_t>(_running.load(), 0));
+        statistics["busy_us"] = _busyTimeUs.load();
+        statistics["uptime_us"] = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _startTime).count();
+
+        std::array<uint64_t, BucketsCount> buckets;
+        uint64_t total = 0;
+        for (size_t i = 0; i < BucketsCount; i++) {
+            buckets[i] = _latencyBuckets[i].load();
+            total += buckets[i];
+        }
+        const std::pair<const char*, uint64_t> percentiles[] = {{"latency_p50_us", 50}, {"latency_p90_us", 90}, {"latency_p99_us", 99}};
+        for (auto&& percentile : percentiles) {
+            // nearest rank
+            const uint64_t rank = (total * percentile.second + 99) / 100;
+            size_t i = 0;
+            uint64_t count = buckets[0];
+            while (count < rank && i + 1 < BucketsCount)
+                count += buckets[++i];
+            statistics[percentile.first] = total == 0 ? 0 : bucketUpperBound(i);
+        }
+        return statistics;
+    }
+
+private:
+    // values below 4 have own buckets, each next power of two is split to 4 buckets
+    static constexpr size_t BucketsCount = 4 * 40;
+
+    static size_t bucketIndex(uint64_t value) {
+        if (value < 4)
+            return static_cast<size_t>(value);
+        size_t exponent = 63;
+        while (!(value >> exponent))
+            exponent--;
+        const size_t mantissa = (value >> (exponent - 2)) & 3;
+        return std::min(4 * (exponent - 1) + mantissa, BucketsCount - 1);
+    }
+
+    static uint64_t bucketUpperBound(size_t index) {
+        if (index < 4)
+            return index;
+        const size_t exponent = index / 4 + 1;
+        const uint64_t mantissa = index % 4;
+        return ((4 + mantissa + 1) << (exponent - 2)) - 1;
+    }
+
+    const Clock::time_point _startTime;
+    std::atomic<uint64_t> _inferences = {0};
+    std::atomic<int64_t> _queued = {0};
+    std::atomic<int64_t> _running = {0};
+    std::atomic<uint64_t> _busyTimeUs = {0};
+    std::array<std::atomic<uint64_t>, BucketsCount> _latencyBuckets;
+};
+
+}  // namespace MKLDNNPlugin
@@ -3,17 +3,396 @@
 //
 
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_huge_pages.h"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <vector>
+
+#ifndef _WIN32
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <cerrno>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
-NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
+MKLDNNMemoryPtr MKLDNNWeightsSharing::createMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc) const {
+    if (hugePages)
+        return CreateHugePagesMemory(eng, desc);
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng));
+    ptr->Create(desc);
+    return ptr;
+}
+
+namespace {
+
+constexpr uint64_t kPrime1 = 11400714785074694791ull;
+constexpr uint64_t kPrime2 = 14029467366897019727ull;
+constexpr uint64_t kPrime3 = 1609587929392839161ull;
+constexpr uint64_t kPrime4 = 9650029242287828579ull;
+constexpr uint64_t kPrime5 = 2870177450012600261ull;
+
+// big enough to amortize threading overhead, small enough to load all threads on large FC weights
+constexpr size_t kHashChunkSize = 1 << 20;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t lane(uint64_t acc, uint64_t input) {
+    acc += input * kPrime2;
+    acc = rotl(acc, 31);
+    return acc * kPrime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+    acc ^= lane(0, val);
+    return acc * kPrime1 + kPrime4;
+}
+
+uint64_t xxhash64(const unsigned char* p, size_t size, uint64_t seed) {
+    const unsigned char* const end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        const unsigned char* const limit = end - 32;
+        uint64_t v1 = seed + kPrime1 + kPrime2;
+        uint64_t v2 = seed + kPrime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - kPrime1;
+        do {
+            v1 = lane(v1, read64(p));
+            v2 = lane(v2, read64(p + 8));
+            v3 = lane(v3, read64(p + 16));
+            v4 = lane(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + kPrime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= lane(0, read64(p));
+        h = rotl(h, 27) * kPrime1 + kPrime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * kPrime1;
+        h = rotl(h, 23) * kPrime2 + kPrime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= (*p) * kPrime5;
+        h = rotl(h, 11) * kPrime1;
+    }
+
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+}
+
+}  // namespace
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kHashChunkSize)
+        return xxhash64(data, size, 0);
+
+    const size_t chunks = (size + kHashChunkSize - 1) / kHashChunkSize;
+    std::vector<uint64_t> chunkHashes(chunks);
+    InferenceEngine::parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * kHashChunkSize;
+        chunkHashes[i] = xxhash64(data + offset, std::min(kHashChunkSize, size - offset), i);
+    });
+
+    return xxhash64(reinterpret_cast<const unsigned char*>(chunkHashes.data()),
+                    chunkHashes.size() * sizeof(uint64_t), size);
+}
+
+#ifndef _WIN32
+namespace {
+
+enum SharedRegionState : uint32_t {
+    Initializing = 0,
+    Ready = 1,
+    Failed = 2,
+};
+
+/**
+ * Layout of shared region: header | key | data.
+ * The key is stored to detect collisions of region names.
+ * Every process using the region holds a shared flock on it, the system releases the locks of crashed
+ * processes, so a region which can be locked exclusively is not used by anyone.
+ */
+struct SharedRegionHeader {
+    std::atomic<uint32_t> state;
+    uint64_t keySize;
+    uint64_t dataSize;
+};
+
+constexpr size_t kRegionAlignment = 64;
+constexpr auto kWaitTimeout = std::chrono::seconds(60);
+
+size_t alignUp(size_t size) {
+    return (size + kRegionAlignment - 1) / kRegionAlignment * kRegionAlignment;
+}
+
+size_t dataOffset(size_t keySize) {
+    return alignUp(sizeof(SharedRegionHeader)) + alignUp(keySize);
+}
+
+// checks that the name was not unlinked and given to another region since fd was opened
+bool isLinked(int fd, const std::string& name) {
+    int nameFd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (nameFd < 0)
+        return false;
+    struct stat st = {}, nameSt = {};
+    bool same = fstat(fd, &st) == 0 && fstat(nameFd, &nameSt) == 0 &&
+                st.st_dev == nameSt.st_dev && st.st_ino == nameSt.st_ino;
+    close(nameFd);
+    return same;
+}
+
+// removes the region if no process holds it
+void unlinkIfUnused(int fd, const std::string& name) {
+    if (flock(fd, LOCK_EX | LOCK_NB) == 0 && isLinked(fd, name))
+        shm_unlink(name.c_str());
+}
+
+class SharedRegion {
+public:
+    SharedRegion(std::string name, int fd, void* addr, size_t length) :
+        _name(std::move(name)), _fd(fd), _addr(addr), _length(length) {}
+
+    ~SharedRegion() {
+        munmap(_addr, _length);
+        flock(_fd, LOCK_UN);
+        unlinkIfUnused(_fd, _name);
+        close(_fd);
+    }
+
+    SharedRegionHeader* header() const { return static_cast<SharedRegionHeader*>(_addr); }
+    char* key() const { return static_cast<char*>(_addr) + alignUp(sizeof(SharedRegionHeader)); }
+    void* data() const { return static_cast<char*>(_addr) + dataOffset(header()->keySize); }
+
+private:
+    std::string _name;
+    int _fd;
+    void* _addr;
+    size_t _length;
+};
+
+// FNV-1a: stable across builds, unlike std::hash
+uint64_t nameHash(const std::string& key) {
+    uint64_t hash = 14695981039346656037ull;
+    for (auto c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+MKLDNNMemoryPtr wrapShared(const std::shared_ptr<SharedRegion>& region,
+                           const mkldnn::engine& eng,
+                           const mkldnn::memory::desc& desc) {
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng), [region] (MKLDNNMemory* memory) { delete memory; });
+    ptr->Create(desc, region->data(), false);
+    return ptr;
+}
+
+}  // namespace
+
+MKLDNNSharedMemoryWeights::MKLDNNSharedMemoryWeights(int numa_id) :
+    _prefix{"/ie_cpu_" + std::to_string(geteuid()) + "_" + std::to_string(numa_id) + "_"} {
+    removeUnusedRegions();
+}
+
+void MKLDNNSharedMemoryWeights::removeUnusedRegions() const {
+    // regions of the processes killed before releasing them are left in the shm directory,
+    // the directory is known on Linux only
+    DIR* dir = opendir("/dev/shm");
+    if (dir == nullptr)
+        return;
+    while (auto entry = readdir(dir)) {
+        const std::string name = std::string{"/"} + entry->d_name;
+        if (name.compare(0, _prefix.size(), _prefix) != 0)
+            continue;
+        int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0)
+            continue;
+        struct stat st = {};
+        if (fstat(fd, &st) == 0 && st.st_uid == geteuid())
+            unlinkIfUnused(fd, name);
+        close(fd);
+    }
+    closedir(dir);
+}
+
+MKLDNNMemoryPtr MKLDNNSharedMemoryWeights::findOrCreate(const std::string& name_hash,
+                                                        const mkldnn::engine& eng,
+                                                        const mkldnn::memory::desc& desc,
+                                                        std::function<MKLDNNMemoryPtr(void)> create) {
+    // reordered data depends on the destination format as well
+    const std::string key = name_hash
+                            + "_" + std::to_string(desc.data.format)
+                            + "_" + std::to_string(desc.data.data_type)
+                            + "_" + std::to_string(mkldnn::memory::primitive_desc(desc, eng).get_size());
+
+    std::unique_lock<std::mutex> lock(guard);
+    auto found = sharedWeights.find(key);
+
+    MKLDNNMemoryPtr ptr;
+    if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
+        ptr = createShared(key, eng, desc, create);
+        sharedWeights[key] = ptr;
+    }
+    return ptr;
+}
+
+MKLDNNMemoryPtr MKLDNNSharedMemoryWeights::createShared(const std::string& key,
+                                                        const mkldnn::engine& eng,
+                                                        const mkldnn::memory::desc& desc,
+                                                        std::function<MKLDNNMemoryPtr(void)> create) {
+    char hash[17];
+    snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(nameHash(key)));
+    const std::string name = _prefix + hash;
+    const size_t dataSize = mkldnn::memory::primitive_desc(desc, eng).get_size();
+    const size_t length = dataOffset(key.size()) + dataSize;
+
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd >= 0) {
+        // this process computes the weights, others wait for it
+        if (flock(fd, LOCK_SH) != 0 || ftruncate(fd, static_cast<off_t>(length)) != 0) {
+            shm_unlink(name.c_str());
+            close(fd);
+            return create();
+        }
+        void* addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            shm_unlink(name.c_str());
+            close(fd);
+            return create();
+        }
+
+        auto header = static_cast<SharedRegionHeader*>(addr);
+        header->keySize = key.size();
+        header->dataSize = dataSize;
+        auto region = std::make_shared<SharedRegion>(name, fd, addr, length);
+        std::memcpy(region->key(), key.data(), key.size());
+
+        MKLDNNMemoryPtr local;
+        try {
+            local = create();
+            if (local->GetPrimitiveDescriptor().get_size() != dataSize)
+                THROW_IE_EXCEPTION << "Unexpected size of shared weights";
+            std::memcpy(region->data(), local->GetData(), dataSize);
+        } catch (...) {
+            header->state.store(Failed);
+            shm_unlink(name.c_str());
+            throw;
+        }
+        header->state.store(Ready);
+        return wrapShared(region, eng, local->GetDescriptor());
+    }
+
+    if (errno != EEXIST)
+        return create();
+
+    fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+        return create();
+
+    // do not trust regions created by other users
+    struct stat st = {};
+    auto deadline = std::chrono::steady_clock::now() + kWaitTimeout;
+    while (fstat(fd, &st) == 0 && st.st_uid == geteuid() && static_cast<size_t>(st.st_size) < length &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (st.st_uid != geteuid() || static_cast<size_t>(st.st_size) != length) {
+        close(fd);
+        return create();
+    }
+
+    void* addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        close(fd);
+        return create();
+    }
+
+    auto header = static_cast<SharedRegionHeader*>(addr);
+    uint32_t state = header->state.load();
+    while (state == Initializing && std::chrono::steady_clock::now() < deadline) {
+        // creator may have died in the middle of initialization, then nobody holds the region:
+        // drop it so the next load can create it again
+        if (flock(fd, LOCK_EX | LOCK_NB) == 0) {
+            if (isLinked(fd, name))
+                shm_unlink(name.c_str());
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        state = header->state.load();
+    }
+
+    auto matches = [&] {
+        return header->keySize == key.size() && header->dataSize == dataSize &&
+               std::memcmp(static_cast<char*>(addr) + alignUp(sizeof(SharedRegionHeader)), key.data(), key.size()) == 0;
+    };
+    if (state != Ready || !matches() || flock(fd, LOCK_SH) != 0) {
+        munmap(addr, length);
+        close(fd);
+        return create();
+    }
+
+    return wrapShared(std::make_shared<SharedRegion>(name, fd, addr, length), eng, desc);
+}
+#endif
+
+NumaNodesWeights::NumaNodesWeights() : _numa_sharded_cache(std::make_shared<MKLDNNWeightsSharing>()) {
+    for (auto numa_id : InferenceEngine::getAvailableNUMANodes()) {
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+        _huge_pages_cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(true);
+#ifndef _WIN32
+        _shared_cache_map[numa_id] = std::make_shared<MKLDNNSharedMemoryWeights>(numa_id);
+#else
+        _shared_cache_map[numa_id] = _cache_map[numa_id];
+#endif
+    }
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -30,4 +409,22 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::crossProcess(int numa_id) {
+    auto found = _shared_cache_map.find(numa_id);
+    if (found == _shared_cache_map.end())
+        THROW_IE_EXCEPTION << "Unknown numa node id " << numa_id;
+    return found->second;
+}
+
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::hugePages(int numa_id) {
+    auto found = _huge_pages_cache_map.find(numa_id);
+    if (found == _huge_pages_cache_map.end())
+        THROW_IE_EXCEPTION << "Unknown numa node id " << numa_id;
+    return found->second;
+}
+
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::numaSharded() {
+    return _numa_sharded_cache;
+}
+
 }  // namespace MKLDNNPlugin
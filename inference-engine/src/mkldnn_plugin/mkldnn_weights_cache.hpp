@@ -6,12 +6,14 @@
 
 #include <mkldnn_memory.h>
 
+#include <cstdint>
 #include <unordered_map>
 #include <functional>
 #include <string>
 #include <memory>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -21,30 +23,78 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * Hash of weights data used as a part of the cache key.
+ *
+ * Data is split into fixed size chunks which are hashed in parallel with four independent
+ * 64-bit lanes (xxHash64 scheme), then the chunk hashes are combined in order.
+ * So result does not depend on the number of threads.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+    uint64_t hash(const unsigned char* data, size_t size) const;
+};
+
+/**
+ * Weights matrix in compressed sparse row (CSR) format: non zero values of each row
+ * are stored contiguously together with their column indices.
+ */
+struct MKLDNNSparseWeights {
+    typedef std::shared_ptr<MKLDNNSparseWeights> Ptr;
+
+    size_t rows = 0;
+    size_t cols = 0;
+    std::vector<float> values;
+    std::vector<int32_t> columns;
+    // values of row i are [rowOffsets[i], rowOffsets[i + 1])
+    std::vector<int32_t> rowOffsets;
+};
+
+/**
+ * Weights matrix quantized per row (output channel) to 8 or 4 bits unsigned codes:
+ * w = (code - zeroPoints[row]) * scales[row]. In 4 bits case columns of a row are split to groups
+ * of packedGroupSize columns packed in packedGroupSize / 2 bytes: byte j of a group has the code
+ * of column j of the group in low half and the one of column j + packedGroupSize / 2 in high half,
+ * so both halves are unpacked to consecutive columns by vector instructions. Rows are padded to
+ * a whole number of bytes (groups in 4 bits case).
+ */
+struct MKLDNNQuantizedWeights {
+    typedef std::shared_ptr<MKLDNNQuantizedWeights> Ptr;
+
+    static constexpr size_t packedGroupSize = 32;
 
-        return ~crc;
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t bits = 8;
+    size_t rowStride = 0;
+    std::vector<uint8_t> codes;
+    std::vector<float> scales;
+    std::vector<float> zeroPoints;
+
+    uint8_t code(size_t row, size_t col) const {
+        const uint8_t *rowCodes = &codes[row * rowStride];
+        if (bits == 8)
+            return rowCodes[col];
+        const size_t half = packedGroupSize / 2;
+        const size_t group = col / packedGroupSize;
+        const size_t j = col % packedGroupSize;
+        const uint8_t packed = rowCodes[group * half + j % half];
+        return j < half ? packed & 0x0F : packed >> 4;
     }
+};
 
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+/**
+ * Compressed weights of a FullyConnected layer, one of pointers is set. They are created once for
+ * the network, so FP32 weights of the layer may be released.
+ */
+struct MKLDNNCompressedWeights {
+    MKLDNNSparseWeights::Ptr sparse;
+    MKLDNNQuantizedWeights::Ptr quantized;
 };
 
+// compressed weights of layers by layer name
+typedef std::unordered_map<std::string, MKLDNNCompressedWeights> MKLDNNCompressedWeightsMap;
+
 /**
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
@@ -54,6 +104,27 @@ protected:
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
+    explicit MKLDNNWeightsSharing(bool useHugePages = false) : hugePages(useHugePages) {}
+    virtual ~MKLDNNWeightsSharing() = default;
+
+    /**
+     * @brief Allocates memory for weights to be cached, it is backed by huge pages if the store is created for them
+     */
+    MKLDNNMemoryPtr createMemory(const mkldnn::engine& eng, const mkldnn::memory::desc& desc) const;
+
+    /**
+     * @brief Same as findOrCreate(name_hash, create), but also passes description of the memory
+     * which is returned by create, so a backend may restore it without calling create
+     */
+    virtual MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
+                                         const mkldnn::engine& /*eng*/,
+                                         const mkldnn::memory::desc& desc,
+                                         std::function<MKLDNNMemoryPtr(void)> create) {
+        // graphs compiled for different shapes may choose different weights format
+        return findOrCreate(name_hash + "_" + std::to_string(desc.data.format)
+                                      + "_" + std::to_string(desc.data.data_type), create);
+    }
+
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
                              std::function<MKLDNNMemoryPtr(void)> create) {
         std::unique_lock<std::mutex> lock(guard);
@@ -66,14 +137,65 @@ public:
         }
         return ptr;
     }
+
+    /**
+     * @brief Same as findOrCreate for compressed weights which are not representable as MKLDNNMemory
+     * (e.g. MKLDNNSparseWeights). Such weights are always shared within the process only.
+     */
+    template <typename T>
+    std::shared_ptr<T> findOrCreateCompressed(const std::string& name_hash,
+                                              std::function<std::shared_ptr<T>(void)> create) {
+        std::unique_lock<std::mutex> lock(guard);
+        auto found = sharedCompressedWeights.find(name_hash);
+
+        std::shared_ptr<T> ptr;
+        if (found == sharedCompressedWeights.end() || !(ptr = std::static_pointer_cast<T>(found->second.lock()))) {
+            ptr = create();
+            sharedCompressedWeights[name_hash] = ptr;
+        }
+        return ptr;
+    }
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
     std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
+    // values are of different types, the key is unique for each type
+    std::unordered_map<std::string, std::weak_ptr<void>> sharedCompressedWeights;
     std::mutex guard;
+    bool hugePages = false;
     static const SimpleDataHash simpleCRC;
 };
 
+#ifndef _WIN32
+/**
+ * Caching store which keeps MKLDNNMemory data in named POSIX shared memory,
+ * so the same weights are stored once for all processes of the same user.
+ * Regions are removed when the last process releases them, the regions left by
+ * killed processes are removed by the next plugin instance.
+ *
+ * Is a thread safe
+ */
+class MKLDNNSharedMemoryWeights : public MKLDNNWeightsSharing {
+public:
+    explicit MKLDNNSharedMemoryWeights(int numa_id);
+
+    MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
+                                 const mkldnn::engine& eng,
+                                 const mkldnn::memory::desc& desc,
+                                 std::function<MKLDNNMemoryPtr(void)> create) override;
+
+private:
+    void removeUnusedRegions() const;
+
+    MKLDNNMemoryPtr createShared(const std::string& key,
+                                 const mkldnn::engine& eng,
+                                 const mkldnn::memory::desc& desc,
+                                 std::function<MKLDNNMemoryPtr(void)> create);
+
+    std::string _prefix;
+};
+#endif
+
 /**
  * Collection of memory caching store per NUMA node(former socket)
  *
@@ -86,8 +208,26 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * @brief Returns caching store shared between processes for NUMA node
+     */
+    MKLDNNWeightsSharing::Ptr& crossProcess(int i);
+
+    /**
+     * @brief Returns caching store for NUMA node which allocates weights backed by huge pages
+     */
+    MKLDNNWeightsSharing::Ptr& hugePages(int i);
+
+    /**
+     * @brief Returns caching store of tables sharded across NUMA nodes, it is common for all nodes
+     */
+    MKLDNNWeightsSharing::Ptr& numaSharded();
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    std::map<int, MKLDNNWeightsSharing::Ptr> _shared_cache_map;
+    std::map<int, MKLDNNWeightsSharing::Ptr> _huge_pages_cache_map;
+    MKLDNNWeightsSharing::Ptr _numa_sharded_cache;
 };
 
 }  // namespace MKLDNNPlugin
@@ -4,10 +4,12 @@
 
 #include "cpu_convert.h"
 #include "cpu_memcpy.h"
+#include "cpu_convert_imp.hpp"
 #include "utils/bfloat16.hpp"
 #include <mkldnn_selective_build.h>
 #include <type_traits>
 #include <tuple>
+#include <algorithm>
 #include <ie_parallel.hpp>
 
 using namespace InferenceEngine;
@@ -71,6 +73,19 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         return;
     }
 
+    // common pairs are converted by vectorized kernels, chunks are big enough to hide the threading overhead
+    if (Extensions::Cpu::XARCH::convert_precision(srcPtr, dstPtr, srcPrc, dstPrc, 0)) {
+        const size_t chunkSize = 4096;
+        const auto srcBytes = static_cast<const uint8_t *>(srcPtr);
+        const auto dstBytes = static_cast<uint8_t *>(dstPtr);
+        parallel_for((size + chunkSize - 1) / chunkSize, [&](size_t chunk) {
+            const size_t start = chunk * chunkSize;
+            Extensions::Cpu::XARCH::convert_precision(srcBytes + start * srcPrc.size(), dstBytes + start * dstPrc.size(),
+                                                      srcPrc, dstPrc, (std::min)(chunkSize, size - start));
+        });
+        return;
+    }
+
     ConvertContext ctx = { srcPtr, dstPtr, size, false };
 
     OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc),
@@ -0,0 +1,195 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_convert_imp.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// the same as maxps / minps for NaN: it is replaced by the low bound
+inline float clamp(float x, float lo, float hi) {
+    x = x > lo ? x : lo;
+    return x < hi ? x : hi;
+}
+
+// largest float which is less than 2^31
+constexpr float int32MaxFloat = 2147483520.f;
+constexpr float int32MinFloat = -2147483648.f;
+
+// the same rounding as MKLDNNPlugin::bfloat16_t
+inline uint16_t floatToBf16(float x) {
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return static_cast<uint16_t>((bits + ((bits & 0x00010000) >> 1)) >> 16);
+}
+
+inline float bf16ToFloat(uint16_t x) {
+    uint32_t bits = static_cast<uint32_t>(x) << 16;
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+template <typename srcType>
+void convertToFloat(const srcType* src, float* dst, size_t size) {
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    for (; i + 8 <= size; i += 8) {
+        __m256i v;
+        if (std::is_same<srcType, uint8_t>::value)
+            v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        else if (std::is_same<srcType, int8_t>::value)
+            v = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        else
+            v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(v));
+    }
+#endif
+    for (; i < size; i++)
+        dst[i] = static_cast<float>(src[i]);
+}
+
+void convertFloatToInt32(const float* src, int32_t* dst, size_t size) {
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    const __m256 vlo = _mm256_set1_ps(int32MinFloat);
+    const __m256 vhi = _mm256_set1_ps(int32MaxFloat);
+    for (; i + 8 <= size; i += 8) {
+        __m256 v = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i), vlo), vhi);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvttps_epi32(v));
+    }
+#endif
+    for (; i < size; i++)
+        dst[i] = static_cast<int32_t>(clamp(src[i], int32MinFloat, int32MaxFloat));
+}
+
+template <typename dstType>
+void convertFloatToInt8(const float* src, dstType* dst, size_t size) {
+    constexpr bool isSigned = std::is_same<dstType, int8_t>::value;
+    constexpr float lo = isSigned ? -128.f : 0.f;
+    constexpr float hi = isSigned ? 127.f : 255.f;
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    const __m256 vlo = _mm256_set1_ps(lo);
+    const __m256 vhi = _mm256_set1_ps(hi);
+    // gathers the first dword of both 128-bit lanes, which keep 4 packed bytes each
+    const __m256i vpermute = _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0);
+    for (; i + 8 <= size; i += 8) {
+        __m256 v = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i), vlo), vhi);
+        __m256i vi = _mm256_cvttps_epi32(v);
+        // values are already in the range, so the saturation of packs doesn't change them
+        __m256i vw = isSigned ? _mm256_packs_epi32(vi, vi) : _mm256_packus_epi32(vi, vi);
+        __m256i vb = isSigned ? _mm256_packs_epi16(vw, vw) : _mm256_packus_epi16(vw, vw);
+        vb = _mm256_permutevar8x32_epi32(vb, vpermute);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(vb));
+    }
+#endif
+    for (; i < size; i++)
+        dst[i] = static_cast<dstType>(clamp(src[i], lo, hi));
+}
+
+void convertFloatToBf16(const float* src, uint16_t* dst, size_t size) {
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    const __m256i vmask = _mm256_set1_epi32(0x00010000);
+    for (; i + 8 <= size; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        v = _mm256_add_epi32(v, _mm256_srli_epi32(_mm256_and_si256(v, vmask), 1));
+        v = _mm256_srli_epi32(v, 16);
+        // values are in [0, 65535], so unsigned saturation doesn't change them
+        v = _mm256_permute4x64_epi64(_mm256_packus_epi32(v, v), 0xD8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(v));
+    }
+#endif
+    for (; i < size; i++)
+        dst[i] = floatToBf16(src[i]);
+}
+
+void convertBf16ToFloat(const uint16_t* src, float* dst, size_t size) {
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    for (; i + 8 <= size; i += 8) {
+        __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_slli_epi32(v, 16));
+    }
+#endif
+    for (; i < size; i++)
+        dst[i] = bf16ToFloat(src[i]);
+}
+
+void convertInt64ToInt32(const int64_t* src, int32_t* dst, size_t size) {
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    // low dwords of 4 qwords to the low 128-bit lane
+    const __m256i vpermute = _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0);
+    for (; i + 8 <= size; i += 8) {
+        __m256i v0 = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), vpermute);
+        __m256i v1 = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 4)), vpermute);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_inserti128_si256(v0, _mm256_castsi256_si128(v1), 1));
+    }
+#endif
+    for (; i < size; i++)
+        dst[i] = static_cast<int32_t>(src[i]);
+}
+
+void convertInt32ToInt64(const int32_t* src, int64_t* dst, size_t size) {
+    size_t i = 0;
+#if defined(HAVE_AVX2)
+    for (; i + 8 <= size; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 4), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+#endif
+    for (; i < size; i++)
+        dst[i] = static_cast<int64_t>(src[i]);
+}
+
+}  // namespace
+
+bool convert_precision(const void* src, void* dst, InferenceEngine::Precision::ePrecision srcPrc,
+                       InferenceEngine::Precision::ePrecision dstPrc, size_t size) {
+    using Precision = InferenceEngine::Precision;
+
+    if (dstPrc == Precision::FP32 && srcPrc == Precision::U8) {
+        convertToFloat(static_cast<const uint8_t*>(src), static_cast<float*>(dst), size);
+    } else if (dstPrc == Precision::FP32 && srcPrc == Precision::I8) {
+        convertToFloat(static_cast<const int8_t*>(src), static_cast<float*>(dst), size);
+    } else if (dstPrc == Precision::FP32 && srcPrc == Precision::I32) {
+        convertToFloat(static_cast<const int32_t*>(src), static_cast<float*>(dst), size);
+    } else if (dstPrc == Precision::FP32 && srcPrc == Precision::BF16) {
+        convertBf16ToFloat(static_cast<const uint16_t*>(src), static_cast<float*>(dst), size);
+    } else if (srcPrc == Precision::FP32 && dstPrc == Precision::I32) {
+        convertFloatToInt32(static_cast<const float*>(src), static_cast<int32_t*>(dst), size);
+    } else if (srcPrc == Precision::FP32 && dstPrc == Precision::U8) {
+        convertFloatToInt8(static_cast<const float*>(src), static_cast<uint8_t*>(dst), size);
+    } else if (srcPrc == Precision::FP32 && dstPrc == Precision::I8) {
+        convertFloatToInt8(static_cast<const float*>(src), static_cast<int8_t*>(dst), size);
+    } else if (srcPrc == Precision::FP32 && dstPrc == Precision::BF16) {
+        convertFloatToBf16(static_cast<const float*>(src), static_cast<uint16_t*>(dst), size);
+    } else if (srcPrc == Precision::I64 && dstPrc == Precision::I32) {
+        convertInt64ToInt32(static_cast<const int64_t*>(src), static_cast<int32_t*>(dst), size);
+    } else if (srcPrc == Precision::I32 && dstPrc == Precision::I64) {
+        convertInt32ToInt64(static_cast<const int32_t*>(src), static_cast<int64_t*>(dst), size);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+#include <ie_precision.hpp>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+namespace XARCH {
+
+/**
+ * Converts size elements of common precision pairs: U8, I8, I32 to FP32, FP32 to I32, U8, I8 (truncation toward
+ * zero with saturation), FP32 to BF16 and back, I64 to I32 (low bits) and I32 to I64. Returns false if the pair
+ * is not supported, so the support can be checked with zero size.
+ */
+bool convert_precision(const void* src, void* dst, InferenceEngine::Precision::ePrecision srcPrc,
+                       InferenceEngine::Precision::ePrecision dstPrc, size_t size);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
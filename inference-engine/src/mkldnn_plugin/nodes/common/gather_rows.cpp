@@ -0,0 +1,292 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <ie_parallel.hpp>
+#include "jit_generator.hpp"
+#include "gather_rows.h"
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_gather_rows_sum, field)
+
+struct jit_args_gather_rows_sum {
+    const float* src;
+    const void* indices;
+    const float* weights;
+    float* dst;
+    size_t indices_num;
+    size_t work_amount;
+};
+
+struct jit_gather_rows_sum_config_params {
+    size_t row_stride;
+    size_t index_size;
+};
+
+struct jit_uni_gather_rows_sum_kernel {
+    void (*ker_)(const jit_args_gather_rows_sum *);
+
+    void operator()(const jit_args_gather_rows_sum *args) { assert(ker_); ker_(args); }
+
+    jit_uni_gather_rows_sum_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_gather_rows_sum_kernel() {}
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_gather_rows_sum_kernel_f32 : public jit_uni_gather_rows_sum_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_rows_sum_kernel_f32)
+
+    explicit jit_uni_gather_rows_sum_kernel_f32(jit_gather_rows_sum_config_params jcp)
+        : jit_uni_gather_rows_sum_kernel(), jit_generator(), jcp(jcp) {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, unroll * simd_w);
+            jl(tail_loop_label, T_NEAR);
+
+            sum_rows(unroll);
+
+            add(reg_src, unroll * vlen);
+            add(reg_dst, unroll * vlen);
+            sub(reg_work_amount, unroll * simd_w);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label); {
+            cmp(reg_work_amount, simd_w);
+            jl(exit_label, T_NEAR);
+
+            sum_rows(1);
+
+            add(reg_src, vlen);
+            add(reg_dst, vlen);
+            sub(reg_work_amount, simd_w);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+    static constexpr int unroll = 4;
+    static constexpr int cache_line = 64;
+
+    jit_gather_rows_sum_config_params jcp;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_indices_num = r12;
+    Xbyak::Reg64 reg_work_amount = r13;
+    Xbyak::Reg64 reg_index_ptr = r14;
+    Xbyak::Reg64 reg_weight_ptr = r15;
+    Xbyak::Reg64 reg_count = rax;
+    Xbyak::Reg64 reg_row0 = rbx;
+    Xbyak::Reg64 reg_row1 = rdx;
+    Xbyak::Reg64 reg_next_row = rsi;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_weight = Vmm(2 * unroll);
+
+    // two sets of accumulators for even and odd rows, so additions of consecutive rows don't depend on each other
+    Vmm vmm_acc(int set, int i) { return Vmm(set * unroll + i); }
+
+    // sums `vecs` vectors of the rows, starting at the current column
+    void sum_rows(int vecs) {
+        Xbyak::Label weighted_label;
+        Xbyak::Label store_label;
+
+        for (int i = 0; i < vecs; i++) {
+            uni_vpxor(vmm_acc(0, i), vmm_acc(0, i), vmm_acc(0, i));
+            uni_vpxor(vmm_acc(1, i), vmm_acc(1, i), vmm_acc(1, i));
+        }
+
+        mov(reg_index_ptr, reg_indices);
+        mov(reg_weight_ptr, reg_weights);
+        mov(reg_count, reg_indices_num);
+
+        test(reg_weights, reg_weights);
+        jnz(weighted_label, T_NEAR);
+        rows_loop(vecs, false);
+        jmp(store_label, T_NEAR);
+
+        L(weighted_label);
+        rows_loop(vecs, true);
+
+        L(store_label);
+        for (int i = 0; i < vecs; i++) {
+            uni_vaddps(vmm_acc(0, i), vmm_acc(0, i), vmm_acc(1, i));
+            uni_vmovups(ptr[reg_dst + i * vlen], vmm_acc(0, i));
+        }
+    }
+
+    void rows_loop(int vecs, bool weighted) {
+        Xbyak::Label pair_loop_label;
+        Xbyak::Label single_row_label;
+        Xbyak::Label end_label;
+        Xbyak::Label accumulate_label;
+
+        L(pair_loop_label); {
+            cmp(reg_count, 2);
+            jl(single_row_label, T_NEAR);
+
+            // rows of the next iteration are prefetched while the current ones are accumulated
+            cmp(reg_count, 4);
+            jl(accumulate_label, T_NEAR);
+            prefetch_row(2, vecs);
+            prefetch_row(3, vecs);
+
+            L(accumulate_label);
+            load_row_address(reg_row0, 0);
+            load_row_address(reg_row1, 1);
+            accumulate(0, reg_row0, vecs, weighted, 0);
+            accumulate(1, reg_row1, vecs, weighted, 1);
+
+            add(reg_index_ptr, static_cast<int>(2 * jcp.index_size));
+            if (weighted)
+                add(reg_weight_ptr, static_cast<int>(2 * sizeof(float)));
+            sub(reg_count, 2);
+
+            jmp(pair_loop_label, T_NEAR);
+        }
+
+        L(single_row_label); {
+            cmp(reg_count, 1);
+            jl(end_label, T_NEAR);
+
+            load_row_address(reg_row0, 0);
+            accumulate(0, reg_row0, vecs, weighted, 0);
+        }
+
+        L(end_label);
+    }
+
+    void load_row_address(const Xbyak::Reg64& reg_row, int offset) {
+        if (jcp.index_size == sizeof(int32_t)) {
+            movsxd(reg_row, dword[reg_index_ptr + offset * sizeof(int32_t)]);
+        } else {
+            mov(reg_row, qword[reg_index_ptr + offset * sizeof(int64_t)]);
+        }
+        imul(reg_row, reg_row, static_cast<int>(jcp.row_stride));
+        add(reg_row, reg_src);
+    }
+
+    void prefetch_row(int offset, int vecs) {
+        load_row_address(reg_next_row, offset);
+        for (int i = 0; i < vecs * vlen; i += cache_line)
+            prefetcht0(ptr[reg_next_row + i]);
+    }
+
+    void accumulate(int set, const Xbyak::Reg64& reg_row, int vecs, bool weighted, int weight_offset) {
+        if (weighted) {
+            uni_vbroadcastss(vmm_weight, ptr[reg_weight_ptr + weight_offset * sizeof(float)]);
+            for (int i = 0; i < vecs; i++)
+                uni_vfmadd231ps(vmm_acc(set, i), vmm_weight, ptr[reg_row + i * vlen]);
+        } else {
+            for (int i = 0; i < vecs; i++)
+                uni_vaddps(vmm_acc(set, i), vmm_acc(set, i), ptr[reg_row + i * vlen]);
+        }
+    }
+};
+
+GatherRowsSum::GatherRowsSum(size_t rowLength, size_t indexSize) : rowLength(rowLength), indexSize(indexSize) {
+    auto jcp = jit_gather_rows_sum_config_params();
+    jcp.row_stride = rowLength * sizeof(float);
+    jcp.index_size = indexSize;
+
+    // the row stride is an immediate operand of the kernel
+    if (jcp.row_stride > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        return;
+
+    if (mayiuse(cpu::avx512_common)) {
+        kernel.reset(new jit_uni_gather_rows_sum_kernel_f32<cpu::avx512_common>(jcp));
+        blockSize = 16;
+    } else if (mayiuse(cpu::avx2)) {
+        kernel.reset(new jit_uni_gather_rows_sum_kernel_f32<cpu::avx2>(jcp));
+        blockSize = 8;
+    }
+}
+
+size_t GatherRowsSum::maxChunksNum() const {
+    // a chunk has one unrolled step of the kernel at least
+    const size_t minChunk = kernel ? 4 * blockSize : 16;
+    return std::max<size_t>(1, rowLength / minChunk);
+}
+
+void GatherRowsSum::execute(const float* src, const void* indices, const float* weights, size_t indicesNum, float* dst,
+                            size_t chunk, size_t chunksNum) const {
+    // chunks are aligned to vectors, the last one has the tail of the row
+    size_t blockStart = 0, blockEnd = 0;
+    splitter(rowLength / blockSize, chunksNum, chunk, blockStart, blockEnd);
+    const size_t start = blockStart * blockSize;
+    const size_t end = chunk + 1 == chunksNum ? rowLength : blockEnd * blockSize;
+    if (start >= end)
+        return;
+
+    size_t jitEnd = start;
+    if (kernel) {
+        jitEnd = start + (end - start) / blockSize * blockSize;
+        if (jitEnd > start) {
+            auto arg = jit_args_gather_rows_sum();
+            arg.src = src + start;
+            arg.indices = indices;
+            arg.weights = weights;
+            arg.dst = dst + start;
+            arg.indices_num = indicesNum;
+            arg.work_amount = jitEnd - start;
+            (*kernel)(&arg);
+        }
+    }
+
+    if (jitEnd < end) {
+        if (indexSize == sizeof(int32_t)) {
+            sumReference(src, static_cast<const int32_t*>(indices), weights, indicesNum, dst, jitEnd, end);
+        } else {
+            sumReference(src, static_cast<const int64_t*>(indices), weights, indicesNum, dst, jitEnd, end);
+        }
+    }
+}
+
+template <typename index_t>
+void GatherRowsSum::sumReference(const float* src, const index_t* indices, const float* weights, size_t indicesNum,
+                                 float* dst, size_t start, size_t end) const {
+    std::fill(dst + start, dst + end, 0.f);
+    for (size_t i = 0; i < indicesNum; i++) {
+        const float* row = src + static_cast<size_t>(indices[i]) * rowLength;
+        if (weights) {
+            for (size_t j = start; j < end; j++)
+                dst[j] += row[j] * weights[i];
+        } else {
+            for (size_t j = start; j < end; j++)
+                dst[j] += row[j];
+        }
+    }
+}
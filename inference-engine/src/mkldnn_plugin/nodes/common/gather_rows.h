@@ -0,0 +1,49 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+struct jit_uni_gather_rows_sum_kernel;
+
+/**
+ * Sums FP32 rows of a table selected by indices, each row is optionally multiplied by the weight of its index:
+ * dst = sum(src[indices[i]] * weights[i]). It is the inner loop of EmbeddingBag* and EmbeddingSegmentsSum layers.
+ * Rows are accumulated in registers by JIT kernel on AVX2 / AVX512 machines, two rows per iteration, and rows of
+ * the next iteration are prefetched. Indices must be validated by the caller.
+ */
+class GatherRowsSum {
+public:
+    /**
+     * @param rowLength number of elements in a row of the table
+     * @param indexSize size of an index in bytes: 4 for int32 or 8 for int64 / uint64 indices
+     */
+    GatherRowsSum(size_t rowLength, size_t indexSize);
+
+    /**
+     * @brief Computes the chunk of the sum, so a single sum can be split between threads
+     * @param weights weights of indices or nullptr
+     * @param chunk index of the chunk of the row, in [0, chunksNum) range
+     * @param chunksNum number of chunks the row is split to, not greater than maxChunksNum()
+     */
+    void execute(const float* src, const void* indices, const float* weights, size_t indicesNum, float* dst,
+                 size_t chunk = 0, size_t chunksNum = 1) const;
+
+    /**
+     * @brief Returns maximal number of chunks a row can be split to, chunks have a few vectors at least
+     */
+    size_t maxChunksNum() const;
+
+private:
+    template <typename index_t>
+    void sumReference(const float* src, const index_t* indices, const float* weights, size_t indicesNum, float* dst,
+                      size_t start, size_t end) const;
+
+    size_t rowLength;
+    size_t indexSize;
+    size_t blockSize = 1;
+    std::shared_ptr<jit_uni_gather_rows_sum_kernel> kernel;
+};
@@ -0,0 +1,287 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include "jit_generator.hpp"
+#include "quantized_gemv.h"
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_quantized_gemv, field)
+
+struct jit_args_quantized_gemv {
+    const float* src;
+    const uint8_t* codes;
+    float* dst;
+    size_t work_amount;
+};
+
+struct jit_quantized_gemv_config_params {
+    size_t rows;
+    size_t row_stride;
+    size_t bits;
+};
+
+struct jit_uni_quantized_gemv_kernel {
+    void (*ker_)(const jit_args_quantized_gemv *);
+
+    void operator()(const jit_args_quantized_gemv *args) { assert(ker_); ker_(args); }
+
+    jit_uni_quantized_gemv_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_quantized_gemv_kernel() {}
+};
+
+// Computes dot products of `rows` rows of codes with src, starting at the rows passed in codes. Work amount is
+// a number of columns: a multiple of vector length for 8 bits codes and of packed group size for 4 bits ones
+template <cpu_isa_t isa>
+struct jit_uni_quantized_gemv_kernel_f32 : public jit_uni_quantized_gemv_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_quantized_gemv_kernel_f32)
+
+    explicit jit_uni_quantized_gemv_kernel_f32(jit_quantized_gemv_config_params jcp)
+        : jit_uni_quantized_gemv_kernel(), jit_generator(), jcp(jcp) {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_row(0), ptr[reg_params + GET_OFF(codes)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        mov(reg_tmp, jcp.row_stride);
+        for (size_t r = 1; r < jcp.rows; r++)
+            lea(reg_row(r), ptr[reg_row(r - 1) + reg_tmp]);
+        xor_(reg_offset, reg_offset);
+
+        for (size_t r = 0; r < jcp.rows; r++) {
+            uni_vpxor(vmm_acc(r, 0), vmm_acc(r, 0), vmm_acc(r, 0));
+            uni_vpxor(vmm_acc(r, 1), vmm_acc(r, 1), vmm_acc(r, 1));
+        }
+
+        if (jcp.bits == 8)
+            loop_u8();
+        else
+            loop_u4();
+
+        for (size_t r = 0; r < jcp.rows; r++) {
+            uni_vaddps(vmm_acc(r, 0), vmm_acc(r, 0), vmm_acc(r, 1));
+            hsum_store(vmm_acc(r, 0), ptr[reg_dst + r * sizeof(float)]);
+        }
+
+        this->postamble();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+    static constexpr int max_rows = 4;
+    static constexpr int group_size = MKLDNNQuantizedWeights::packedGroupSize;
+
+    jit_quantized_gemv_config_params jcp;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_offset = rax;
+    Xbyak::Reg64 reg_tmp = rdx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_row(size_t r) {
+        const Xbyak::Reg64 rows[max_rows] = {r12, r13, r14, r15};
+        return rows[r];
+    }
+
+    // two accumulators per row, so consecutive vectors of a row don't depend on each other
+    Vmm vmm_acc(size_t r, int i) { return Vmm(static_cast<int>(r) * 2 + i); }
+    // src vectors of the iteration: 2 for 8 bits codes, a group of packed codes for 4 bits ones
+    Vmm vmm_src(int i) { return Vmm(2 * max_rows + i); }
+    Vmm vmm_code = Vmm(12);
+    Vmm vmm_high_code = Vmm(13);
+    Vmm vmm_mask = Vmm(14);
+    Xbyak::Xmm xmm_aux = Xbyak::Xmm(15);
+
+    void loop_u8() {
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, 2 * simd_w);
+            jl(tail_loop_label, T_NEAR);
+
+            accumulate_u8(2);
+
+            add(reg_src, 2 * vlen);
+            add(reg_offset, 2 * simd_w);
+            sub(reg_work_amount, 2 * simd_w);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label); {
+            cmp(reg_work_amount, simd_w);
+            jl(exit_label, T_NEAR);
+
+            accumulate_u8(1);
+
+            add(reg_src, vlen);
+            add(reg_offset, simd_w);
+            sub(reg_work_amount, simd_w);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+    }
+
+    void accumulate_u8(int vecs) {
+        for (int i = 0; i < vecs; i++)
+            uni_vmovups(vmm_src(i), ptr[reg_src + i * vlen]);
+
+        for (size_t r = 0; r < jcp.rows; r++) {
+            for (int i = 0; i < vecs; i++) {
+                uni_vpmovzxbd(vmm_code, ptr[reg_row(r) + reg_offset + i * simd_w]);
+                uni_vcvtdq2ps(vmm_code, vmm_code);
+                uni_vfmadd231ps(vmm_acc(r, i), vmm_code, vmm_src(i));
+            }
+        }
+    }
+
+    void loop_u4() {
+        Xbyak::Label loop_label;
+        Xbyak::Label exit_label;
+
+        mov(reg_tmp.cvt32(), 0x0F);
+        movd(Xbyak::Xmm(vmm_mask.getIdx()), reg_tmp.cvt32());
+        vpbroadcastd(vmm_mask, Xbyak::Xmm(vmm_mask.getIdx()));
+
+        L(loop_label); {
+            cmp(reg_work_amount, group_size);
+            jl(exit_label, T_NEAR);
+
+            accumulate_u4();
+
+            add(reg_src, group_size * sizeof(float));
+            add(reg_offset, group_size / 2);
+            sub(reg_work_amount, group_size);
+
+            jmp(loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+    }
+
+    // the low halves of the group bytes are codes of the first half of the group columns
+    void accumulate_u4() {
+        const int half_vecs = group_size / 2 / simd_w;
+        for (int i = 0; i < 2 * half_vecs; i++)
+            uni_vmovups(vmm_src(i), ptr[reg_src + i * vlen]);
+
+        for (size_t r = 0; r < jcp.rows; r++) {
+            for (int i = 0; i < half_vecs; i++) {
+                uni_vpmovzxbd(vmm_code, ptr[reg_row(r) + reg_offset + i * simd_w]);
+                uni_vpsrld(vmm_high_code, vmm_code, 4);
+                if (isa == cpu::avx512_common)
+                    vpandd(vmm_code, vmm_code, vmm_mask);
+                else
+                    vpand(vmm_code, vmm_code, vmm_mask);
+
+                uni_vcvtdq2ps(vmm_code, vmm_code);
+                uni_vfmadd231ps(vmm_acc(r, 0), vmm_code, vmm_src(i));
+                uni_vcvtdq2ps(vmm_high_code, vmm_high_code);
+                uni_vfmadd231ps(vmm_acc(r, 1), vmm_high_code, vmm_src(half_vecs + i));
+            }
+        }
+    }
+
+    void hsum_store(const Vmm& vmm_sum, const Xbyak::Address& dst) {
+        Xbyak::Xmm xmm_sum = Xbyak::Xmm(vmm_sum.getIdx());
+        Xbyak::Ymm ymm_sum = Xbyak::Ymm(vmm_sum.getIdx());
+        // VEX encoded instructions zero the upper part of the register, so it is extracted first
+        if (isa == cpu::avx512_common) {
+            vextractf64x4(Xbyak::Ymm(xmm_aux.getIdx()), Xbyak::Zmm(vmm_sum.getIdx()), 1);
+            vaddps(ymm_sum, ymm_sum, Xbyak::Ymm(xmm_aux.getIdx()));
+        }
+        vextractf128(xmm_aux, ymm_sum, 1);
+        vaddps(xmm_sum, xmm_sum, xmm_aux);
+        vmovshdup(xmm_aux, xmm_sum);            //  sum:1,2,3,4; aux:2,2,4,4
+        vaddps(xmm_sum, xmm_sum, xmm_aux);      //  sum:1+2,2+2,3+4,4+4
+        vmovhlps(xmm_aux, xmm_aux, xmm_sum);    //  aux:3+4,4+4,4,4
+        vaddps(xmm_sum, xmm_sum, xmm_aux);      //  sum:1+2+3+4,...
+        vmovss(dst, xmm_sum);
+    }
+};
+
+static constexpr size_t quantizedGemvRows = 4;
+
+QuantizedGemv::QuantizedGemv(const MKLDNNQuantizedWeights::Ptr& weights) : weights(weights) {
+    auto jcp = jit_quantized_gemv_config_params();
+    jcp.rows = quantizedGemvRows;
+    jcp.row_stride = weights->rowStride;
+    jcp.bits = weights->bits;
+
+    size_t step = 0;
+    if (mayiuse(cpu::avx512_common)) {
+        kernel.reset(new jit_uni_quantized_gemv_kernel_f32<cpu::avx512_common>(jcp));
+        jcp.rows = 1;
+        singleRowKernel.reset(new jit_uni_quantized_gemv_kernel_f32<cpu::avx512_common>(jcp));
+        step = 16;
+    } else if (mayiuse(cpu::avx2)) {
+        kernel.reset(new jit_uni_quantized_gemv_kernel_f32<cpu::avx2>(jcp));
+        jcp.rows = 1;
+        singleRowKernel.reset(new jit_uni_quantized_gemv_kernel_f32<cpu::avx2>(jcp));
+        step = 8;
+    }
+
+    // 4 bits codes are unpacked by whole groups only, the codes of the padding columns are not multiplied
+    if (step != 0 && weights->bits == 4)
+        step = MKLDNNQuantizedWeights::packedGroupSize;
+    if (step != 0)
+        jitCols = weights->cols / step * step;
+}
+
+void QuantizedGemv::execute(const float* src, float srcSum, const float* biases, float* dst,
+                            size_t rowStart, size_t rowEnd) const {
+    const float* scales = weights->scales.data();
+    const float* zeroPoints = weights->zeroPoints.data();
+
+    float dots[quantizedGemvRows];
+    for (size_t r = rowStart; r < rowEnd;) {
+        const size_t rows = rowEnd - r >= quantizedGemvRows ? quantizedGemvRows : 1;
+        if (jitCols != 0) {
+            auto arg = jit_args_quantized_gemv();
+            arg.src = src;
+            arg.codes = &weights->codes[r * weights->rowStride];
+            arg.dst = dots;
+            arg.work_amount = jitCols;
+            (rows == quantizedGemvRows ? *kernel : *singleRowKernel)(&arg);
+        } else {
+            std::fill(dots, dots + rows, 0.f);
+        }
+
+        // sum((code - zp) * x) = sum(code * x) - zp * sum(x)
+        for (size_t i = 0; i < rows; i++, r++) {
+            const float dot = dots[i] + dotReference(src, r, jitCols, weights->cols);
+            dst[r] = scales[r] * (dot - zeroPoints[r] * srcSum) + biases[r];
+        }
+    }
+}
+
+float QuantizedGemv::dotReference(const float* src, size_t row, size_t start, size_t end) const {
+    float dot = 0.f;
+    if (weights->bits == 8) {
+        const uint8_t* codes = &weights->codes[row * weights->rowStride];
+        for (size_t c = start; c < end; c++)
+            dot += static_cast<float>(codes[c]) * src[c];
+    } else {
+        for (size_t c = start; c < end; c++)
+            dot += static_cast<float>(weights->code(row, c)) * src[c];
+    }
+    return dot;
+}
@@ -0,0 +1,37 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include "mkldnn_weights_cache.hpp"
+
+struct jit_uni_quantized_gemv_kernel;
+
+/**
+ * Multiplies a matrix of quantized weights by FP32 vector: dst[r] = scales[r] * (sum(code(r, c) * src[c]) -
+ * zeroPoints[r] * sum(src[c])) + biases[r]. It is the inner loop of FullyConnected layer with compressed weights.
+ * Codes are converted to FP32 and accumulated in registers by JIT kernel on AVX2 / AVX512 machines, four rows
+ * per iteration, the columns out of whole vectors (groups of packed codes) are accumulated by reference code.
+ */
+class QuantizedGemv {
+public:
+    explicit QuantizedGemv(const MKLDNNPlugin::MKLDNNQuantizedWeights::Ptr& weights);
+
+    /**
+     * @brief Computes rows [rowStart, rowEnd) of the result
+     * @param srcSum sum of src elements, it is common for all rows
+     */
+    void execute(const float* src, float srcSum, const float* biases, float* dst, size_t rowStart, size_t rowEnd) const;
+
+private:
+    float dotReference(const float* src, size_t row, size_t start, size_t end) const;
+
+    MKLDNNPlugin::MKLDNNQuantizedWeights::Ptr weights;
+    // columns [0, jitCols) are accumulated by the kernels
+    size_t jitCols = 0;
+    std::shared_ptr<jit_uni_quantized_gemv_kernel> kernel;
+    std::shared_ptr<jit_uni_quantized_gemv_kernel> singleRowKernel;
+};
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <vector>
 #include <ie_parallel.hpp>
 #include <mkldnn_extension_utils.h>
@@ -24,11 +25,14 @@ struct jit_args_softmax {
     size_t src_stride;
     size_t dst_stride;
     size_t work_amount;
+    float *max;
+    float *sum;
 };
 
 struct jit_softmax_config_params {
     Precision src_dt;
     Precision dst_dt;
+    bool row_stats;
 };
 
 
@@ -214,6 +218,156 @@ private:
     }
 };
 
+// Softmax over contiguous rows (the reduced axis is the innermost one).
+// row_stats = true : src->per-lane max and sum of exp, computed in a single pass with the running max rescaling the sum
+// row_stats = false : src+max+1/sum->dst:exp(x-max)/sum
+template <cpu_isa_t isa>
+struct jit_uni_softmax_row_kernel_f32 : public jit_uni_softmax_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_softmax_row_kernel_f32)
+
+    jit_uni_softmax_row_kernel_f32(jit_softmax_config_params jcp) : jit_uni_softmax_kernel(), jit_generator() {
+        exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, alg_kind::eltwise_exp, 0.f, 0.f));
+
+        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
+            emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_max, ptr[reg_params + GET_OFF(max)]);
+        mov(reg_sum, ptr[reg_params + GET_OFF(sum)]);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        if (jcp.row_stats) {
+            load_vector(vmm_max, ptr[reg_src], jcp.src_dt);
+            uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+
+            L(loop_label); {
+                cmp(reg_work_amount, 0);
+                jle(loop_end_label, T_NEAR);
+
+                load_vector(vmm_val, ptr[reg_src], jcp.src_dt);
+
+                uni_vmovups(vmm_new_max, vmm_max);
+                uni_vmaxps(vmm_new_max, vmm_new_max, vmm_val);
+
+                // sum = sum * exp(max - new_max) + exp(x - new_max), both exponents in one injector call
+                uni_vmovups(vmm_scale, vmm_max);
+                uni_vsubps(vmm_scale, vmm_scale, vmm_new_max);
+                uni_vsubps(vmm_val, vmm_val, vmm_new_max);
+                exp_injector->compute_vector_range(vmm_scale.getIdx(), vmm_val.getIdx() + 1);
+                uni_vmulps(vmm_sum, vmm_sum, vmm_scale);
+                uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+
+                uni_vmovups(vmm_max, vmm_new_max);
+
+                add(reg_src, reg_src_stride);
+                sub(reg_work_amount, 1);
+
+                jmp(loop_label, T_NEAR);
+            }
+            L(loop_end_label);
+
+            uni_vmovups(ptr[reg_max], vmm_max);
+            uni_vmovups(ptr[reg_sum], vmm_sum);
+        } else {
+            mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+            mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+
+            uni_vbroadcastss(vmm_max, ptr[reg_max]);
+            uni_vbroadcastss(vmm_sum, ptr[reg_sum]);
+
+            L(loop_label); {
+                cmp(reg_work_amount, 0);
+                jle(loop_end_label, T_NEAR);
+
+                load_vector(vmm_val, ptr[reg_src], jcp.src_dt);
+
+                uni_vsubps(vmm_val, vmm_val, vmm_max);
+                exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                uni_vmulps(vmm_val, vmm_val, vmm_sum);
+
+                store_vector(ptr[reg_dst], vmm_val, jcp.dst_dt);
+
+                add(reg_src, reg_src_stride);
+                add(reg_dst, reg_dst_stride);
+                sub(reg_work_amount, 1);
+
+                jmp(loop_label, T_NEAR);
+            }
+            L(loop_end_label);
+        }
+
+        this->postamble();
+
+        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
+            emu_vcvtneps2bf16->emit_table();
+
+        exp_injector->prepare_table();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_src_stride = r10;
+    Xbyak::Reg64 reg_dst_stride = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_max = r13;
+    Xbyak::Reg64 reg_sum = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_max = Vmm(1);
+    Vmm vmm_new_max = Vmm(2);
+    Vmm vmm_sum = Vmm(3);
+    Vmm vmm_scale = Vmm(4);
+    Vmm vmm_val = Vmm(5);  // must follow vmm_scale, both are exponentiated at once
+
+    std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, Precision src_dt) {
+        switch (src_dt) {
+            case Precision::FP32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+    }
+    inline void store_vector(const Xbyak::Address &op, Vmm vmm_dst, Precision dst_dt) {
+        Xbyak::Ymm ymm_dst = Xbyak::Ymm(vmm_dst.getIdx());
+
+        switch (dst_dt) {
+            case Precision::FP32:
+                uni_vmovups(op, vmm_dst);
+                break;
+            case Precision::BF16:
+                if (mayiuse(avx512_core_bf16))
+                    vcvtneps2bf16(ymm_dst, vmm_dst);
+                else
+                    emu_vcvtneps2bf16->emit({static_cast<size_t>(vmm_dst.getIdx())}, {static_cast<size_t>(ymm_dst.getIdx())});
+                vmovdqu16(op, ymm_dst);
+                break;
+            default:
+                assert(!"unknown dst_dt");
+        }
+    }
+};
+
 SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
     : input_prec(inpPrc), output_prec(outPrc) {
     if (Precision::BF16 == output_prec) {
@@ -227,20 +381,92 @@ SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
     jcp.src_dt = inpPrc;
     jcp.dst_dt = outPrc;
 
+    auto row_stats_jcp = jcp;
+    row_stats_jcp.row_stats = true;
+
     if (mayiuse(cpu::avx512_common)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<cpu::avx512_common>(jcp));
+        softmax_row_stats_kernel.reset(new jit_uni_softmax_row_kernel_f32<cpu::avx512_common>(row_stats_jcp));
+        softmax_row_kernel.reset(new jit_uni_softmax_row_kernel_f32<cpu::avx512_common>(jcp));
         block_size = 16;
     } else if (mayiuse(cpu::avx2)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<cpu::avx2>(jcp));
+        softmax_row_stats_kernel.reset(new jit_uni_softmax_row_kernel_f32<cpu::avx2>(row_stats_jcp));
+        softmax_row_kernel.reset(new jit_uni_softmax_row_kernel_f32<cpu::avx2>(jcp));
         block_size = 8;
     } else if (mayiuse(cpu::sse42)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<cpu::sse42>(jcp));
+        softmax_row_stats_kernel.reset(new jit_uni_softmax_row_kernel_f32<cpu::sse42>(row_stats_jcp));
+        softmax_row_kernel.reset(new jit_uni_softmax_row_kernel_f32<cpu::sse42>(jcp));
         block_size = 4;
     }
 }
 
+template<typename in_data_t, typename out_data_t>
+void SoftmaxGeneric::calculate_rows(const in_data_t *src_data, out_data_t *dst_data, int B, int C) {
+    int blocks_num = C / block_size;
+    int tail_start = blocks_num * block_size;
+
+    parallel_for(B, [&](int b) {
+        const in_data_t *psrc = src_data + static_cast<size_t>(b) * C;
+        out_data_t *pdst = dst_data + static_cast<size_t>(b) * C;
+
+        float lane_max[16];
+        float lane_sum[16];
+        float max = psrc[0];
+        float expSum = 0.f;
+
+        if (blocks_num > 0) {
+            auto arg = jit_args_softmax();
+            arg.src = psrc;
+            arg.src_stride = static_cast<size_t>(block_size * sizeof(in_data_t));
+            arg.work_amount = static_cast<size_t>(blocks_num);
+            arg.max = lane_max;
+            arg.sum = lane_sum;
+            (*softmax_row_stats_kernel)(&arg);
+
+            for (int i = 0; i < block_size; i++)
+                max = std::max(max, lane_max[i]);
+            for (int i = 0; i < block_size; i++)
+                expSum += lane_sum[i] * exp(lane_max[i] - max);
+        }
+
+        for (int c = tail_start; c < C; c++) {
+            float val = psrc[c];
+            if (val > max) {
+                expSum *= exp(max - val);
+                max = val;
+            }
+            expSum += exp(val - max);
+        }
+
+        float expSumInv = 1.f / expSum;
+
+        if (blocks_num > 0) {
+            auto arg = jit_args_softmax();
+            arg.src = psrc;
+            arg.dst = pdst;
+            arg.src_stride = static_cast<size_t>(block_size * sizeof(in_data_t));
+            arg.dst_stride = static_cast<size_t>(block_size * sizeof(out_data_t));
+            arg.work_amount = static_cast<size_t>(blocks_num);
+            arg.max = &max;
+            arg.sum = &expSumInv;
+            (*softmax_row_kernel)(&arg);
+        }
+
+        for (int c = tail_start; c < C; c++) {
+            pdst[c] = exp(psrc[c] - max) * expSumInv;
+        }
+    });
+}
+
 template<typename in_data_t, typename out_data_t>
 void SoftmaxGeneric::calculate(const in_data_t *src_data, out_data_t *dst_data, int B, int C, int H, int W) {
+    if (H * W == 1 && softmax_row_kernel) {
+        calculate_rows(src_data, dst_data, B, C);
+        return;
+    }
+
     for (int b = 0; b < B; b++) {
         int tail_start = 0;
         if (softmax_kernel) {
@@ -301,7 +527,7 @@ void SoftmaxGeneric::execute(const uint8_t *src_data, uint8_t *dst_data, int B,
             calculate(bf16_src_data, float_dst_data, B, C, H, W);
         } else if (Precision::BF16 == output_prec) {
             auto bf16_dst_data = reinterpret_cast<bfloat16_t*>(dst_data);
-            calculate(bf16_dst_data, bf16_dst_data, B, C, H, W);
+            calculate(bf16_src_data, bf16_dst_data, B, C, H, W);
         } else {
             THROW_IE_EXCEPTION << "Unsupported output precision: " << output_prec.name();
         }
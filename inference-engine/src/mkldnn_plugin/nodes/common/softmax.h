@@ -44,10 +44,14 @@ public:
 private:
     template<typename in_data_t, typename out_data_t>
     void calculate(const in_data_t* src_data, out_data_t* dst_data, int B, int C, int H, int W);
+    template<typename in_data_t, typename out_data_t>
+    void calculate_rows(const in_data_t* src_data, out_data_t* dst_data, int B, int C);
 
 private:
     int block_size;
     InferenceEngine::Precision input_prec, output_prec;
     std::shared_ptr<jit_uni_softmax_kernel> softmax_kernel;
+    std::shared_ptr<jit_uni_softmax_kernel> softmax_row_stats_kernel;
+    std::shared_ptr<jit_uni_softmax_kernel> softmax_row_kernel;
 };
 
@@ -11,6 +11,7 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#include "nms_imp.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -97,6 +98,9 @@ public:
             _detections_count = InferenceEngine::make_shared_blob<int>({Precision::I32, detections_size, C});
             _detections_count->allocate();
 
+            _candidates_count = InferenceEngine::make_shared_blob<int>({Precision::I32, detections_size, C});
+            _candidates_count->allocate();
+
             const InferenceEngine::SizeVector &conf_size = layer->insData[idx_confidence].lock()->getTensorDesc().getDims();
             _reordered_conf = InferenceEngine::make_shared_blob<float>({Precision::FP32, conf_size, ANY});
             _reordered_conf->allocate();
@@ -138,6 +142,7 @@ public:
         int *buffer_data           = _buffer->buffer().as<int *>();
         int *indices_data          = _indices->buffer().as<int *>();
         int *num_priors_actual     = _num_priors_actual->buffer().as<int *>();
+        int *candidates_data       = _candidates_count->buffer().as<int *>();
 
         for (int n = 0; n < N; ++n) {
             const float *ppriors = prior_data;
@@ -178,61 +183,60 @@ public:
             }
         }
 
-        if (with_add_box_pred) {
-            for (int n = 0; n < N; ++n) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    if (arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
-                        }
-                    } else {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                        }
-                    }
+        // Confidences are reordered to class-major layout. Priors passing the confidence threshold are collected
+        // at the same time for Caffe style NMS, so the reordered confidences aren't read once more.
+        parallel_for2d(N, _num_classes, [&](int n, int c) {
+            float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+            int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+            const int num_priors_collected = !_decrease_label_id && c != _background_label_id ? num_priors_actual[n] : 0;
+
+            int count = 0;
+            for (int p = 0; p < _num_priors; ++p) {
+                float conf;
+                if (with_add_box_pred && arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
+                    conf = c == _background_label_id ? 1.0f : 0.0f;
+                } else {
+                    conf = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
                 }
-            }
-        } else {
-            for (int n = 0; n < N; ++n) {
-                for (int c = 0; c < _num_classes; ++c) {
-                    for (int p = 0; p < _num_priors; ++p) {
-                        reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                    }
+                pconf[p] = conf;
+
+                if (p < num_priors_collected && conf > _confidence_threshold) {
+                    pindices[count] = p;
+                    count++;
                 }
             }
-        }
+            candidates_data[n*_num_classes + c] = count;
+        });
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        if (!_decrease_label_id) {
+            // Caffe style
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                if (c != _background_label_id) {  // Ignore background class
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
-                });
-            } else {
-                // MXNet style
+
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, candidates_data[n*_num_classes + c]);
+                }
+            });
+        } else {
+            // MXNet style
+            parallel_for(N, [&](int n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -240,8 +244,11 @@ public:
                 const float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors;
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
-            }
+            });
+        }
 
+        for (int n = 0; n < N; ++n) {
+            int detections_total = 0;
             for (int c = 0; c < _num_classes; ++c) {
                 detections_total += detections_data[n*_num_classes + c];
             }
@@ -261,8 +268,8 @@ public:
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
+                std::partial_sort(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k,
+                                  conf_index_class_map.end(), SortScorePairDescend<std::pair<int, int>>);
                 conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
@@ -391,7 +398,7 @@ private:
                       bool decodeType = true); // after ARM = false
 
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int &detections, int num_priors_actual);
+                int *buffer, int *indices, int &detections, int candidates);
 
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
                 int *buffer, int *indices, int *detections, int num_priors_actual);
@@ -400,6 +407,7 @@ private:
     InferenceEngine::Blob::Ptr _buffer;
     InferenceEngine::Blob::Ptr _indices;
     InferenceEngine::Blob::Ptr _detections_count;
+    InferenceEngine::Blob::Ptr _candidates_count;
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
@@ -417,42 +425,29 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin;
-    float intersect_height = intersect_ymax - intersect_ymin;
+// Boxes kept by NMS in planar layout, so a candidate box is compared with all of them by SIMD code
+struct KeptBoxes {
+    std::vector<float> xmin, ymin, xmax, ymax, sizes;
 
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
+    void reserve(size_t size) {
+        for (auto coords : {&xmin, &ymin, &xmax, &ymax, &sizes})
+            coords->reserve(size);
     }
 
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
+    void add(const float *bbox, float size) {
+        xmin.push_back(bbox[0]);
+        ymin.push_back(bbox[1]);
+        xmax.push_back(bbox[2]);
+        ymax.push_back(bbox[3]);
+        sizes.push_back(size);
+    }
 
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
-}
+    // checks Jaccard overlap of the box with kept ones
+    bool overlaps(const float *bbox, float size, float threshold) const {
+        return XARCH::nms_box_suppressed(xmin.data(), ymin.data(), xmax.data(), ymax.data(), sizes.data(), sizes.size(),
+                                         bbox, size, threshold, false);
+    }
+};
 
 void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                        const float *loc_data,
@@ -562,34 +557,21 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
                           int* buffer,
                           int* indices,
                           int& detections,
-                          int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
-    }
+                          int candidates) {
+    // indices of candidates passing the confidence threshold are collected by the caller
+    int num_output_scores = (_top_k == -1 ? candidates : (std::min)(_top_k, candidates));
 
-    int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
-
-    std::partial_sort_copy(indices, indices + count,
+    std::partial_sort_copy(indices, indices + candidates,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    KeptBoxes kept;
+    kept.reserve(num_output_scores);
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        if (!kept.overlaps(&bboxes[idx*4], sizes[idx], _nms_threshold)) {
+            kept.add(&bboxes[idx*4], sizes[idx]);
             indices[detections] = idx;
             detections++;
         }
@@ -626,6 +608,7 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    std::vector<KeptBoxes> kept(_num_classes);
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
         const int cls = idx/_num_priors;
@@ -634,21 +617,9 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
         int &ndetection = detections[cls];
         int *pindices = indices + cls*_num_priors;
 
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int kept_idx = pindices[k];
-            float overlap = 0.0f;
-            if (_share_location) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls*_num_priors + prior, cls*_num_priors + kept_idx);
-            }
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        const int box_idx = _share_location ? prior : cls*_num_priors + prior;
+        if (!kept[cls].overlaps(&bboxes[box_idx*4], sizes[box_idx], _nms_threshold)) {
+            kept[cls].add(&bboxes[box_idx*4], sizes[box_idx]);
             pindices[ndetection++] = prior;
         }
     }
@@ -5,6 +5,9 @@
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
 
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 
@@ -30,6 +33,9 @@ public:
 
         _indicesLen = indicesData->getTensorDesc().getDims()[0];
         _offsetsLen = offsetsData->getTensorDesc().getDims()[0];
+
+        if (_rowsSum)
+            _rowsSum = std::make_shared<GatherRowsSum>(_embDepth, indicesData->getTensorDesc().getPrecision().size());
     }
 
     StatusCode execute(
@@ -157,9 +163,12 @@ protected:
                 weightsIdx = offsetsData[embIndex];
         };
 
+        const bool useRowsSum = std::is_same<T, float>::value && _rowsSum;
+        const size_t chunksNum = useRowsSum ? getChunksNum(OUTPUT_BAGS_NUM) : 1lu;
+
         auto threadBody = [&](const int ithr, const int nthr) {
             size_t start(0lu), end(0lu);
-            splitter(OUTPUT_BAGS_NUM, nthr, ithr, start, end);
+            splitter(OUTPUT_BAGS_NUM * chunksNum, nthr, ithr, start, end);
             if (start >= end)
                 return;
 
@@ -168,10 +177,23 @@ protected:
             size_t weightsIdx = 0lu;
             bool withWeights = _withWeights;
 
-            for (size_t obi = start; obi < end; obi++) {
+            for (size_t work = start; work < end; work++) {
+                const size_t obi = work / chunksNum;
+                const size_t chunk = work % chunksNum;
                 size_t dstIndex = obi * _embDepth;
                 get_idx(obi, indices, indicesSize, weightsIdx, withWeights);
-                if (indices != nullptr) {
+                if (indices != nullptr && useRowsSum) {
+                    withWeights = withWeights & _withWeights;
+                    for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                        if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                            errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                            return;
+                        }
+                    }
+                    _rowsSum->execute(reinterpret_cast<const float*>(srcData), indices,
+                                      withWeights ? reinterpret_cast<const float*>(weightsData) + weightsIdx : nullptr,
+                                      indicesSize, reinterpret_cast<float*>(dstData) + dstIndex, chunk, chunksNum);
+                } else if (indices != nullptr) {
                     withWeights = withWeights & _withWeights;
 
                     size_t inIdx = 0lu;
@@ -210,7 +232,7 @@ protected:
                             }
                         }
                     }
-                } else {
+                } else if (chunk == 0lu) {
                     for (size_t i = 0lu; i < _embDepth; i++) {
                         dstData[dstIndex + i] = 0;
                     }
@@ -6,8 +6,10 @@
 #include "ie_parallel.hpp"
 #include "list.hpp"
 
+#include <algorithm>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 using namespace InferenceEngine;
@@ -89,6 +91,8 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
         for (size_t i = 1lu; i < inDataDims.size(); i++) {
             _embDepth *= inDataDims[i];
         }
+        if (dataPrecision == Precision::FP32)
+            _rowsSum = std::make_shared<GatherRowsSum>(_embDepth, sizeof(size_t));
     } catch (InferenceEngine::details::InferenceEngineException &ex) {
         errorMsg = ex.what();
     }
@@ -145,9 +149,12 @@ void MKLDNNEmbeddingBagSum::processData(
 
     const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
 
+    const bool useRowsSum = std::is_same<T, float>::value && _rowsSum;
+    const size_t chunksNum = useRowsSum ? getChunksNum(outputBagsNum) : 1lu;
+
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitter(outputBagsNum * chunksNum, nthr, ithr, start, end);
         if (start >= end)
             return;
 
@@ -156,11 +163,23 @@ void MKLDNNEmbeddingBagSum::processData(
         size_t weightsIdx = 0lu;
         bool withWeights = _withWeights;
 
-        for (size_t obi = start; obi < end; obi++) {
+        for (size_t work = start; work < end; work++) {
+            const size_t obi = work / chunksNum;
+            const size_t chunk = work % chunksNum;
             size_t dstIndex = obi * _embDepth;
             getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
 
-            if (indices != nullptr) {
+            if (indices != nullptr && useRowsSum) {
+                withWeights = withWeights & _withWeights;
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    if (indices[inIdx] >= inDataDims[0])
+                        THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
+                            << "' has invalid embedding bag index: " << indices[inIdx];
+                }
+                _rowsSum->execute(reinterpret_cast<const float*>(srcData), indices,
+                                  withWeights ? reinterpret_cast<const float*>(weightsData) + weightsIdx : nullptr,
+                                  indicesSize, reinterpret_cast<float*>(dstData) + dstIndex, chunk, chunksNum);
+            } else if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
 
                 size_t inIdx = 0lu;
@@ -197,7 +216,7 @@ void MKLDNNEmbeddingBagSum::processData(
                         }
                     }
                 }
-            } else {
+            } else if (chunk == 0lu) {
                 for (size_t i = 0lu; i < _embDepth; i++) {
                     dstData[dstIndex + i] = 0;
                 }
@@ -207,3 +226,10 @@ void MKLDNNEmbeddingBagSum::processData(
 
     parallel_nt(0, threadBody);
 }
+
+size_t MKLDNNEmbeddingBagSum::getChunksNum(size_t bagsNum) const {
+    const size_t threadsNum = static_cast<size_t>(parallel_get_max_threads());
+    if (bagsNum == 0lu || bagsNum >= threadsNum)
+        return 1lu;
+    return std::min(_rowsSum->maxChunksNum(), (threadsNum + bagsNum - 1lu) / bagsNum);
+}
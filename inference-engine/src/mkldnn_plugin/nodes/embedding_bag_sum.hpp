@@ -5,6 +5,7 @@
 #pragma once
 
 #include "base.hpp"
+#include "common/gather_rows.h"
 
 #include <memory>
 #include <set>
@@ -41,6 +42,9 @@ protected:
     template<typename T>
     void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
 
+    // number of chunks the bags are split to, so every thread gets work when there are fewer bags than threads
+    size_t getChunksNum(size_t bagsNum) const;
+
     std::set<Precision> _supportedPrecisions;
 
     const size_t INDICES_IDX;
@@ -50,6 +54,8 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+    // sums FP32 rows, indices are size_t unless a derived class recreates it for own indices precision
+    std::shared_ptr<GatherRowsSum> _rowsSum;
 
     using INT32 = PrecisionTrait<Precision::I32>::value_type;
     using INT64 = PrecisionTrait<Precision::I64>::value_type;
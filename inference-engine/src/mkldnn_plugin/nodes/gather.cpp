@@ -10,14 +10,129 @@
 #include <cassert>
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/fp16_utils.h"
+#include "jit_generator.hpp"
+
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+#define GET_OFF(field) offsetof(jit_args_gather, field)
+
+struct jit_args_gather {
+    const void* src;
+    const int32_t* indices;
+    void* dst;
+    size_t work_amount;
+};
+
+struct jit_gather_config_params {
+    size_t index_range;
+};
+
+struct jit_uni_gather_kernel {
+    void (*ker_)(const jit_args_gather *);
+
+    void operator()(const jit_args_gather *args) { assert(ker_); ker_(args); }
+
+    jit_uni_gather_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_gather_kernel() {}
+};
+
+/**
+ * Gathers 4-byte elements by int32 indices with vector gather instructions: dst[i] = src[indices[i]].
+ * Elements of indices out of [0, index_range) range are zero.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_gather_kernel_32 : public jit_uni_gather_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_kernel_32)
+
+    explicit jit_uni_gather_kernel_32(jit_gather_config_params jcp) : jit_uni_gather_kernel(), jit_generator() {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        mov(reg_tmp.cvt32(), static_cast<uint32_t>(jcp.index_range));
+        movd(xmm_range, reg_tmp.cvt32());
+        vpbroadcastd(vmm_range, xmm_range);
+        if (isa == cpu::avx2)
+            uni_vpcmpeqd(vmm_minus_one, vmm_minus_one, vmm_minus_one);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, unroll * simd_w);
+            jl(exit_label, T_NEAR);
+
+            // independent gathers of a few vectors are in flight at the same time
+            for (int i = 0; i < unroll; i++)
+                gather_vector(i);
+
+            add(reg_indices, unroll * vlen);
+            add(reg_dst, unroll * vlen);
+            sub(reg_work_amount, unroll * simd_w);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional<isa == cpu::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(int32_t);
+    static constexpr int unroll = 4;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_tmp = r12;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Xmm xmm_range = Xbyak::Xmm(0);
+    Vmm vmm_range = Vmm(0);
+    Vmm vmm_minus_one = Vmm(1);
+    Vmm vmm_aux = Vmm(2);
+
+    Vmm vmm_index(int i) { return Vmm(3 + 3 * i); }
+    Vmm vmm_val(int i) { return Vmm(4 + 3 * i); }
+    Vmm vmm_mask(int i) { return Vmm(5 + 3 * i); }
+    Xbyak::Opmask k_mask(int i) { return Xbyak::Opmask(1 + i); }
+
+    void gather_vector(int i) {
+        uni_vmovups(vmm_index(i), ptr[reg_indices + i * vlen]);
+        uni_vpxor(vmm_val(i), vmm_val(i), vmm_val(i));
+        if (isa == cpu::avx2) {
+            // mask of lanes with 0 <= index < index_range
+            vpcmpgtd(vmm_mask(i), vmm_range, vmm_index(i));
+            vpcmpgtd(vmm_aux, vmm_index(i), vmm_minus_one);
+            vpand(vmm_mask(i), vmm_mask(i), vmm_aux);
+            vpgatherdd(vmm_val(i), ptr[reg_src + vmm_index(i) * 4], vmm_mask(i));
+        } else {
+            // negative indices are greater than index_range in unsigned comparison
+            vpcmpud(k_mask(i), vmm_index(i), vmm_range, 1);
+            vpgatherdd(vmm_val(i) | k_mask(i), ptr[reg_src + vmm_index(i) * 4]);
+        }
+        uni_vmovups(ptr[reg_dst + i * vlen], vmm_val(i));
+    }
+};
+
 class GatherImpl: public ExtLayerBase {
 public:
     explicit GatherImpl(const CNNLayer* layer) {
@@ -26,7 +141,8 @@ public:
                 THROW_IE_EXCEPTION << layer->name << " Incorrect number of input/output edges!";
 
             Precision inIdxPrecision = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getPrecision();
-            if (inIdxPrecision != Precision::FP32 && inIdxPrecision != Precision::I32 && inIdxPrecision != Precision::FP16)
+            if (inIdxPrecision != Precision::FP32 && inIdxPrecision != Precision::I32 && inIdxPrecision != Precision::FP16 &&
+                    inIdxPrecision != Precision::I64)
                 inIdxPrecision = Precision::I32;
 
             axis = layer->GetParamAsInt("axis");
@@ -68,6 +184,20 @@ public:
             config.outConfs.push_back(dataConfigOut);
             config.dynBatchSupport = false;
             confs.push_back(config);
+
+            // single elements of 4 bytes are gathered with vector instructions
+            if (dataLength == 1 && dataPrecision.size() == sizeof(int32_t) && inIdxPrecision == Precision::I32 &&
+                    indexRange <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+                auto jcp = jit_gather_config_params();
+                jcp.index_range = indexRange;
+                if (mayiuse(cpu::avx512_common)) {
+                    gather_kernel.reset(new jit_uni_gather_kernel_32<cpu::avx512_common>(jcp));
+                    block_size = 4 * 16;
+                } else if (mayiuse(cpu::avx2)) {
+                    gather_kernel.reset(new jit_uni_gather_kernel_32<cpu::avx2>(jcp));
+                    block_size = 4 * 8;
+                }
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -91,6 +221,12 @@ public:
         }
     };
 
+    struct i64toUi64 {
+        inline size_t operator()(const int64_t value) {
+            return static_cast<size_t>(value);
+        }
+    };
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         switch (inputs[GATHER_INDEXES]->getTensorDesc().getPrecision()) {
             case Precision::FP32:
@@ -100,7 +236,13 @@ public:
                 gather<ie_fp16, f16toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             case Precision::I32:
-                gather<int32_t, i32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                if (gather_kernel)
+                    gatherElements(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                else
+                    gather<int32_t, i32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                break;
+            case Precision::I64:
+                gather<int64_t, i64toUi64>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             default:
                 return GENERAL_ERROR;
@@ -118,21 +260,45 @@ private:
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
         size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
 
-        parallel_for(src_indexSize, [&](size_t i) {
-            unsigned int idx = Conversion()(src_index[i]);
+        // parallel over dictionaries as well as indices, so a small batch of indices is split between threads too
+        parallel_for2d(numDictionaries, src_indexSize, [&](size_t j, size_t i) {
+            size_t idx = Conversion()(src_index[i]);
 
             //  Index clipping
             if (idx < indexRange) {
                 //  Copying data to destination from Dictionary
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    cpu_memcpy_s(&dst_data[len * (i + j * src_indexSize)],
-                                output->byteSize() - (len * (i + j * src_indexSize)),
-                                &src_dataDict[len * (idx + j * indexRange)],
-                                len);
-                }
+                cpu_memcpy_s(&dst_data[len * (i + j * src_indexSize)],
+                            output->byteSize() - (len * (i + j * src_indexSize)),
+                            &src_dataDict[len * (idx + j * indexRange)],
+                            len);
+            } else {
+                memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
+            }
+        });
+    }
+
+    void gatherElements(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
+        const size_t src_indexSize = indexes->size();
+        const int32_t *src_index = indexes->cbuffer().as<const int32_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const int32_t *src_dataDict = dictionary->cbuffer().as<const int32_t *>() + dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        int32_t *dst_data = output->buffer().as<int32_t *>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        const size_t blocksNum = src_indexSize / block_size;
+        const size_t tailStart = blocksNum * block_size;
+        parallel_for2d(numDictionaries, blocksNum + 1, [&](size_t j, size_t b) {
+            const int32_t *dict = src_dataDict + j * indexRange;
+            int32_t *dst = dst_data + j * src_indexSize;
+            if (b < blocksNum) {
+                auto arg = jit_args_gather();
+                arg.src = dict;
+                arg.indices = src_index + b * block_size;
+                arg.dst = dst + b * block_size;
+                arg.work_amount = block_size;
+                (*gather_kernel)(&arg);
             } else {
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
+                for (size_t i = tailStart; i < src_indexSize; i++) {
+                    const auto idx = static_cast<unsigned int>(src_index[i]);
+                    dst[i] = idx < indexRange ? dict[idx] : 0;
                 }
             }
         });
@@ -142,6 +308,8 @@ private:
     size_t numDictionaries = 1;
     size_t indexRange = 0;
     size_t dataLength = 1;
+    size_t block_size = 1;
+    std::shared_ptr<jit_uni_gather_kernel> gather_kernel;
     const size_t GATHER_DICTIONARY = 0;
     const size_t GATHER_INDEXES = 1;
 };
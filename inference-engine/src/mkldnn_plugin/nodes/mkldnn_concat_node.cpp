@@ -153,9 +153,6 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    if (axis != 1)
-        return;
-
     auto numOfDim = static_cast<size_t>(dstDims.ndims());
 
     SizeVector order(numOfDim);
@@ -165,7 +162,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         order[i] = i;
     }
 
-    if (outputPrecision == Precision::I8 || outputPrecision == Precision::U8) {
+    if (axis == 1 && (outputPrecision == Precision::I8 || outputPrecision == Precision::U8)) {
         if (numOfDim == 4) {
             // Here we assume NHWC layout (channels are the last)
 
@@ -237,6 +234,10 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
+    // Inputs are views of the output memory at offsets along the axis. Strides before the axis are left undefined,
+    // so producers accepting strides write to the output directly and a reorder is inserted for the others.
+    config.dynBatchSupport = axis != 0;
+
     SizeVector strides(numOfDim);
     strides[numOfDim - 1] = 1;
     for (size_t i = 2; i <= numOfDim; i++) {
@@ -269,7 +270,9 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         order[numOfDim] = 1lu;
         offsets = SizeVector(blkDimsLen, 0lu);
 
-        // nChw8c, nChw16c, nCdhw8c, nCdhw16c
+        // nChw8c, nChw16c, nCdhw8c, nCdhw16c: channels of each input must be a multiple of the block when
+        // concatenating along channels, otherwise inputs share the same channels and are views along the outer or
+        // spatial dimensions of the output
         for (size_t sizeS : {8lu, 16lu}) {
             SizeVector blkDims = dstDims.ToSizeVector();
             if (blkDims[1] % sizeS)
@@ -373,7 +376,7 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
                 canOptimize = false;
         }
     }
-    if (hasUnknown && axis == 1) {
+    if (hasUnknown) {
         if (canSelectPrimitive.size() == 1) {
             selectPrimitiveDescriptorByIndex(static_cast<int>(canSelectPrimitive[0]));
             return;
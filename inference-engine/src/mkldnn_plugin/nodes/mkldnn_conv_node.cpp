@@ -13,6 +13,13 @@
 #include <legacy/ie_layers.h>
 #include <string>
 #include <vector>
+#include <functional>
+#include <numeric>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <sstream>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
@@ -591,6 +598,15 @@ bool MKLDNNConvolutionNode::created() const {
     return getType() == Convolution;
 }
 
+uint64_t MKLDNNConvolutionNode::getOperationsCount() const {
+    // output dims of the fused depthwise convolution don't describe the main one
+    if (withDWConv)
+        return 0;
+    const uint64_t outputChannels = getChildEdgeAt(0)->getDims()[1];
+    const uint64_t weightsCount = std::accumulate(weightDims.begin(), weightDims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    return 2 * getChildEdgeAt(0)->getDims().size() * (weightsCount / outputChannels);
+}
+
 void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                              const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
@@ -838,6 +854,134 @@ void MKLDNNConvolutionNode::filterSupportedDescriptors() {
     }
 }
 
+void MKLDNNConvolutionNode::setAutotune(size_t candidates, const ConvAutotuneCache::Ptr& cache) {
+    autotuneCandidates = candidates;
+    autotuneCache = cache;
+}
+
+void MKLDNNConvolutionNode::selectOptimalPrimitiveDescriptor() {
+    // user defined PrimitivesPriority has precedence, fused depthwise convolution can't be benchmarked separately
+    if (autotuneCandidates == 0 || !autotuneCache || !implPriorities.empty() || withDWConv) {
+        MKLDNNNode::selectOptimalPrimitiveDescriptor();
+        return;
+    }
+
+    // candidates are ranked by the default priorities, Winograd is not there and goes right after direct AVX512 kernels
+    std::vector<impl_desc_type> ranking = getPrimitivesPriority();
+    auto avx512 = std::find(ranking.begin(), ranking.end(), impl_desc_type::jit_avx512);
+    ranking.insert(avx512 == ranking.end() ? avx512 : avx512 + 1, impl_desc_type::jit_avx512_winograd);
+
+    std::vector<impl_desc_type> candidates;
+    for (auto type : ranking) {
+        if (candidates.size() == autotuneCandidates)
+            break;
+        for (const auto& pd : getSupportedPrimitiveDescriptors()) {
+            if (pd.getImplementationType() == type) {
+                candidates.push_back(type);
+                break;
+            }
+        }
+    }
+
+    if (candidates.size() > 1) {
+        auto best = autotuneCache->findOrTune(getAutotuneKey(candidates), [&] {
+            return tuneImplementation(candidates);
+        });
+        if (best != impl_desc_type::unknown)
+            implPriorities.insert(implPriorities.begin(), best);
+    }
+    MKLDNNNode::selectOptimalPrimitiveDescriptor();
+}
+
+template <typename T>
+static void appendDims(std::ostringstream& key, const char* name, const std::vector<T>& dims) {
+    key << name << ":";
+    for (size_t i = 0; i < dims.size(); i++)
+        key << (i ? "x" : "") << dims[i];
+    key << ";";
+}
+
+std::string MKLDNNConvolutionNode::getAutotuneKey(const std::vector<impl_desc_type>& candidates) const {
+    std::ostringstream key;
+    appendDims(key, "src", getParentEdgeAt(0)->getDims().ToSizeVector());
+    appendDims(key, "dst", getChildEdgeAt(0)->getDims().ToSizeVector());
+    appendDims(key, "wei", weightDims);
+    appendDims(key, "str", stride);
+    appendDims(key, "dil", dilation);
+    appendDims(key, "padl", paddingL);
+    appendDims(key, "padr", paddingR);
+    const auto config = getSupportedPrimitiveDescriptors()[0].getConfig();
+    key << "g:" << groupNum << ";bias:" << withBiases << ";sum:" << withSum
+        << ";prc:" << config.inConfs[0].desc.getPrecision().name() << "_" << config.outConfs[0].desc.getPrecision().name() << ";";
+    std::vector<int> types(candidates.begin(), candidates.end());
+    appendDims(key, "impl", types);
+    return key.str();
+}
+
+static double measureConvolution(convolution_forward::primitive_desc& pd, bool withBiases) {
+    auto allocate = [](const memory::primitive_desc& mpd) {
+        memory mem(mpd);
+        std::memset(mem.get_data_handle(), 0, mpd.get_size());
+        return mem;
+    };
+    auto src = allocate(pd.src_primitive_desc());
+    auto weights = allocate(pd.weights_primitive_desc());
+    auto dst = allocate(pd.dst_primitive_desc());
+    std::unique_ptr<convolution_forward> conv;
+    std::unique_ptr<memory> bias;
+    if (withBiases) {
+        bias.reset(new memory(allocate(pd.bias_primitive_desc())));
+        conv.reset(new convolution_forward(pd, src, weights, *bias, dst));
+    } else {
+        conv.reset(new convolution_forward(pd, src, weights, dst));
+    }
+
+    const int runs = 5;
+    double best = std::numeric_limits<double>::max();
+    // the first run is a warm up
+    for (int i = 0; i <= runs; i++) {
+        auto start = std::chrono::steady_clock::now();
+        mkldnn::stream(stream::kind::eager).submit({*conv});
+        auto time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (i > 0)
+            best = std::min(best, time);
+    }
+    return best;
+}
+
+impl_desc_type MKLDNNConvolutionNode::tuneImplementation(const std::vector<impl_desc_type>& candidates) {
+    // post ops cost the same for all implementations and their data is not prepared yet, so they are not applied
+    mkldnn::primitive_attr attr;
+    addZeroPoints(attr);
+
+    impl_desc_type best = impl_desc_type::unknown;
+    double bestTime = std::numeric_limits<double>::max();
+    for (auto type : candidates) {
+        for (auto& desc : descs) {
+            auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), attr);
+            while (itpd.is_not_end() && parse_impl_name(itpd.get_impl_info_str()) != type)
+                itpd++;
+            if (!itpd.is_not_end())
+                continue;
+
+            try {
+                std::shared_ptr<convolution_forward::desc> convDesc = desc;
+                convolution_forward::primitive_desc pd(*convDesc, getEngine());
+                itpd.getPrimitiveDescriptor(pd);
+                double time = measureConvolution(pd, withBiases);
+                if (time < bestTime) {
+                    bestTime = time;
+                    best = type;
+                }
+            } catch (...) {
+                // implementation which can't be benchmarked is not selected by autotuning
+            }
+            break;
+        }
+    }
+    return best;
+}
+
 bool MKLDNNConvolutionNode::isPossibleToSkipInitConfig(MKLDNNDescriptor &desc) {
     //  WA: In some cases, we can predict in advance the type of primitive that will be called in the future.
     //  In particular, isPossibleToSkipInitConfig() checks whether we can skip the creation of primitives with
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_conv_autotune.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -26,9 +27,11 @@ public:
     void createPrimitive() override;
     void initSupportedPrimitiveDescriptors() override;
     void filterSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
     void filterSupportedDescriptors();
     bool isPossibleToSkipInitConfig(MKLDNNDescriptor &desc);
     bool created() const override;
+    uint64_t getOperationsCount() const override;
     bool canBeInPlace() const override {
         return false;
     }
@@ -49,6 +52,12 @@ public:
 
     bool canBeExecutedInInt8();
 
+    /**
+     * Enables selection of the fastest of given number of best implementations by benchmarking them,
+     * results are shared through the cache by convolutions of the same shape.
+     */
+    void setAutotune(size_t candidates, const ConvAutotuneCache::Ptr& cache);
+
     std::vector<uint8_t> inputZeroPoints;
     std::vector<float> weightsZeroPoints;
     std::vector<int32_t> outputCompensation;
@@ -60,6 +69,8 @@ protected:
 private:
     mkldnn::memory::data_type precisionToDataType(InferenceEngine::Precision prec);
     void addZeroPoints(mkldnn::primitive_attr& attr) const;
+    std::string getAutotuneKey(const std::vector<impl_desc_type>& candidates) const;
+    impl_desc_type tuneImplementation(const std::vector<impl_desc_type>& candidates);
 
     bool withBiases;
     bool withSum;
@@ -88,6 +99,9 @@ private:
     int baseInputsNumber;
 
     InferenceEngine::Precision eltwisePrecision;
+
+    size_t autotuneCandidates = 0;
+    ConvAutotuneCache::Ptr autotuneCache;
 };
 
 }  // namespace MKLDNNPlugin
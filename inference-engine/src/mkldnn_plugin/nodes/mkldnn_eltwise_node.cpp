@@ -22,6 +22,7 @@
 #include "jit_mkldnn_emitters.hpp"
 #include "ref_eltwise.hpp"
 #include "mkldnn_pooling_node.h"
+#include "mkldnn_generic_node.h"
 #include <mkldnn_selective_build.h>
 
 using namespace MKLDNNPlugin;
@@ -495,7 +496,7 @@ private:
                 post_op_emitters[eltwise_post_op_idx]->emit(in_idxs, out_idxs, aux_idxs);
 
                 eltwise_post_op_idx++;
-            } else {
+            } else if (eltwiseNode.getFusedWith()[i].get()->getType() == Quantize) {
                 auto quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(eltwiseNode.getFusedWith()[i].get());
 
                 bool do_dequantization = quantizeNode->getAlgorithm() == mkldnn::quantization_quantize_dequantize;
@@ -1175,6 +1176,12 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
 void MKLDNNEltwiseNode::createPrimitive() {
     auto config = getSelectedPrimitiveDescriptor()->getConfig();
 
+    customBodies.clear();
+    for (auto& fusedNode : fusedWith) {
+        if (auto genericNode = dynamic_cast<MKLDNNGenericNode*>(fusedNode.get()))
+            customBodies.push_back(genericNode->getEltwiseImpl());
+    }
+
     auto initDims = [this, config](size_t maxInputSize) {
         size_t inputNum = getParentEdges().size();
 
@@ -1485,6 +1492,7 @@ void MKLDNNEltwiseNode::executeOptimized6D(const std::vector<const uint8_t *>& s
                           i3 * offsets_oc[3] + i4 * offsets_oc[4]) * sizeof(float);
 
             (*eltwise_kernel)(&arg);
+            applyCustomBodies(arg.dst, arg.work_amount);
         });
 }
 
@@ -1530,10 +1538,18 @@ void MKLDNNEltwiseNode::executeOptimizedGeneric(const std::vector<const uint8_t
             }
 
             (*eltwise_kernel)(&arg);
+            applyCustomBodies(arg.dst, arg.work_amount);
         }
     });
 }
 
+void MKLDNNEltwiseNode::applyCustomBodies(void *dst, size_t count) {
+    // custom bodies are fused only when the node produces FP32 values, so they are computed in-place
+    auto dst_f = reinterpret_cast<float *>(dst);
+    for (auto& body : customBodies)
+        body->compute(dst_f, dst_f, count);
+}
+
 void MKLDNNEltwiseNode::executeReference(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr) {
     size_t inputNum = src_ptrs.size();
 
@@ -1723,7 +1739,7 @@ bool MKLDNNEltwiseNode::canFuse(const MKLDNNNodePtr& node) const {
         return false;
     };
 
-    if (!mayiuse(cpu::sse42))
+    if (!mayiuse(cpu::sse42) || isFusedWith(Generic))
         return false;
 
     // FQ inputs with quantization parameters will be hided inside post_op object, so will not increase inputs number
@@ -1751,6 +1767,17 @@ bool MKLDNNEltwiseNode::canFuse(const MKLDNNNodePtr& node) const {
         return true;
     }
 
+    // Extension bodies are applied after the kernel, so nothing can be fused after them
+    if (node->getType() == Generic) {
+        auto *genericNode = dynamic_cast<MKLDNNGenericNode *>(node.get());
+        auto layer = node->getCnnLayer();
+        return genericNode != nullptr && genericNode->getEltwiseImpl() != nullptr && layer != nullptr &&
+               layer->insData.size() == 1 && layer->outData.size() == 1 &&
+               layer->insData[0].lock()->getPrecision() == Precision::FP32 &&
+               layer->outData[0]->getPrecision() == Precision::FP32 &&
+               layer->insData[0].lock()->getTensorDesc().getDims() == layer->outData[0]->getTensorDesc().getDims();
+    }
+
     if (node->getType() == Quantize) {
         auto *quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(node.get());
         if (quantizeNode == nullptr)
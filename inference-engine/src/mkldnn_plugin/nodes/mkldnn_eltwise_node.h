@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ie_common.h>
+#include <ie_iextension.h>
 #include <mkldnn_node.h>
 #include <string>
 #include <vector>
@@ -161,9 +162,12 @@ private:
     std::vector<float> scales = {};
     std::vector<float> shifts = {};
 
+    std::vector<InferenceEngine::ILayerEltwiseImpl::Ptr> customBodies = {};
+
     inline void executeOptimized6D(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr);
     inline void executeOptimizedGeneric(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr);
     inline void executeReference(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr);
+    inline void applyCustomBodies(void *dst, size_t count);
 
     void offset_out_calc(std::vector<size_t>& offset, std::vector<size_t>& dims);
     void offset_in_calc(std::vector<size_t>& offset, std::vector<size_t>& dims_in, std::vector<size_t>& dims_out);
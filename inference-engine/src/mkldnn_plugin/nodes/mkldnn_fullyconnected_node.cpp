@@ -11,6 +11,11 @@
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <functional>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -87,7 +92,7 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     auto * fcLayer = dynamic_cast<FullyConnectedLayer*>(getCnnLayer().get());
     if (fcLayer == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert fully connected layer.";
-    if (fcLayer->_weights == nullptr && baseInputsNumber == 1) {
+    if (fcLayer->_weights == nullptr && baseInputsNumber == 1 && !withCompressedWeights()) {
         THROW_IE_EXCEPTION << "Weights are empty for layer: " << fcLayer->name
                            << " used in MKLDNN node: " << getName() << "\n"
                            << "Use the second argumemt of InferenceEngine::Core::ReadNetwork"
@@ -117,7 +122,7 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
                            << inDims.ndims() << " dims.";
     }
 
-    if (baseInputsNumber == 1) {
+    if (baseInputsNumber == 1 && !withCompressedWeights()) {
         internalBlobs.push_back(createInternalBlob(weightsDims, true));
     }
 
@@ -127,10 +132,13 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     } else {
         biasesDims.push_back(static_cast<int>(fcLayer->_out_num));
     }
-    if (withBiases && baseInputsNumber == 1) {
+    if (withBiases && baseInputsNumber == 1 && !withCompressedWeights()) {
         internalBlobs.push_back(createInternalBlob(biasesDims, false));
     }
 
+    if (withCompressedWeights())
+        return;
+
     if (this->getCnnLayer()->blobs.find("weights") != this->getCnnLayer()->blobs.end()) {
         Blob::Ptr weights = this->getCnnLayer()->blobs.find("weights")->second;
         if (weights->getTensorDesc().getPrecision() == Precision::I8) {
@@ -164,7 +172,262 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::setCompressedWeights(const MKLDNNCompressedWeights& weights) {
+    sparseWeights = weights.sparse;
+    quantizedWeights = weights.quantized;
+}
+
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withCompressedWeights()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+    config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), memory::f32, memory::nc);
+    config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), memory::f32, memory::nc);
+    supportedPrimitiveDescriptors.push_back({config, sparseWeights ? impl_desc_type::sparse : impl_desc_type::compressed,
+                                             memory::nc});
+}
+
+void MKLDNNFullyConnectedNode::initDescriptor(const InferenceEngine::LayerConfig& config) {
+    if (!withCompressedWeights()) {
+        MKLDNNNode::initDescriptor(config);
+        return;
+    }
+    auto* selectedPD = getSelectedPrimitiveDescriptor();
+    if (selectedPD)
+        selectedPD->getConfig() = config;
+}
+
+static MKLDNNSparseWeights::Ptr compressSparse(const float *weights, size_t rows, size_t cols) {
+    auto compressed = std::make_shared<MKLDNNSparseWeights>();
+    compressed->rows = rows;
+    compressed->cols = cols;
+    compressed->rowOffsets.resize(rows + 1, 0);
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t c = 0; c < cols; c++) {
+            float value = weights[r * cols + c];
+            if (value == 0.0f)
+                continue;
+            compressed->values.push_back(value);
+            compressed->columns.push_back(static_cast<int32_t>(c));
+        }
+        compressed->rowOffsets[r + 1] = static_cast<int32_t>(compressed->values.size());
+    }
+    return compressed;
+}
+
+static MKLDNNQuantizedWeights::Ptr compressQuantized(const float *weights, size_t rows, size_t cols, size_t bits) {
+    auto compressed = std::make_shared<MKLDNNQuantizedWeights>();
+    compressed->rows = rows;
+    compressed->cols = cols;
+    compressed->bits = bits;
+    compressed->rowStride = bits == 8 ? cols : div_up(cols, MKLDNNQuantizedWeights::packedGroupSize) *
+                                               (MKLDNNQuantizedWeights::packedGroupSize / 2);
+    compressed->codes.resize(rows * compressed->rowStride, 0);
+    compressed->scales.resize(rows);
+    compressed->zeroPoints.resize(rows);
+
+    const float maxCode = static_cast<float>((1 << bits) - 1);
+    parallel_for(rows, [&](size_t r) {
+        const float *row = weights + r * cols;
+        // zero has to be representable exactly to keep zero weights zero
+        float minValue = std::min(0.0f, *std::min_element(row, row + cols));
+        float maxValue = std::max(0.0f, *std::max_element(row, row + cols));
+        float scale = (maxValue - minValue) / maxCode;
+        if (scale == 0.0f)
+            scale = 1.0f;
+        float zeroPoint = std::min(maxCode, std::max(0.0f, std::round(-minValue / scale)));
+
+        uint8_t *codes = &compressed->codes[r * compressed->rowStride];
+        for (size_t c = 0; c < cols; c++) {
+            float code = std::min(maxCode, std::max(0.0f, std::round(row[c] / scale) + zeroPoint));
+            uint8_t value = static_cast<uint8_t>(code);
+            if (bits == 8) {
+                codes[c] = value;
+            } else {
+                const size_t half = MKLDNNQuantizedWeights::packedGroupSize / 2;
+                const size_t j = c % MKLDNNQuantizedWeights::packedGroupSize;
+                codes[c / MKLDNNQuantizedWeights::packedGroupSize * half + j % half] |=
+                        j < half ? value : static_cast<uint8_t>(value << 4);
+            }
+        }
+        compressed->scales[r] = scale;
+        compressed->zeroPoints[r] = zeroPoint;
+    });
+    return compressed;
+}
+
+MKLDNNCompressedWeights MKLDNNFullyConnectedNode::compressWeights(const CNNLayer& layer, float sparseThreshold,
+                                                                  int compressionBits, const MKLDNNWeightsSharing::Ptr& cache) {
+    MKLDNNCompressedWeights compressed;
+    if (sparseThreshold >= 1.0f && compressionBits != 8 && compressionBits != 4)
+        return compressed;
+
+    auto * fcLayer = dynamic_cast<const FullyConnectedLayer*>(&layer);
+    if (fcLayer == nullptr || fcLayer->insData.size() != 1)
+        return compressed;
+    if (fcLayer->_weights == nullptr || fcLayer->input()->getDims().size() != 2)
+        return compressed;
+    if (fcLayer->_weights->getTensorDesc().getPrecision() != Precision::FP32 ||
+        fcLayer->input()->getPrecision() != Precision::FP32 ||
+        fcLayer->outData[0]->getPrecision() != Precision::FP32)
+        return compressed;
+    if (fcLayer->_biases != nullptr && fcLayer->_biases->getTensorDesc().getPrecision() != Precision::FP32)
+        return compressed;
+
+    const size_t rows = fcLayer->_out_num;
+    const size_t cols = fcLayer->input()->getDims()[1];
+    const size_t size = fcLayer->_weights->size();
+    if (size == 0 || size != rows * cols)
+        return compressed;
+
+    const float *weights = fcLayer->_weights->cbuffer().as<const float *>();
+    bool sparse = false;
+    if (sparseThreshold < 1.0f) {
+        size_t zeros = parallel_sum(size, static_cast<size_t>(0), [&](size_t i) -> size_t {
+            return weights[i] == 0.0f ? 1 : 0;
+        });
+        sparse = static_cast<float>(zeros) >= sparseThreshold * static_cast<float>(size);
+    }
+    if (!sparse && compressionBits != 8 && compressionBits != 4)
+        return compressed;
+
+    std::string string_hash;
+    if (cache != nullptr) {
+        const size_t byteSize = fcLayer->_weights->byteSize();
+        const uint64_t data_hash = cache->GetHashFunc().hash(fcLayer->_weights->cbuffer().as<const unsigned char *>(), byteSize);
+        string_hash = fcLayer->name + (sparse ? "_sparse_" : "_u" + std::to_string(compressionBits) + "_")
+                      + std::to_string(byteSize) + "_" + std::to_string(data_hash);
+    }
+
+    if (sparse) {
+        auto create = [&] () {
+            return compressSparse(weights, rows, cols);
+        };
+        compressed.sparse = cache != nullptr ? cache->findOrCreateCompressed<MKLDNNSparseWeights>(string_hash, create)
+                                             : create();
+    } else {
+        auto create = [&] () {
+            return compressQuantized(weights, rows, cols, static_cast<size_t>(compressionBits));
+        };
+        compressed.quantized = cache != nullptr ? cache->findOrCreateCompressed<MKLDNNQuantizedWeights>(string_hash, create)
+                                                : create();
+    }
+    return compressed;
+}
+
+void MKLDNNFullyConnectedNode::createCompressedPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate for node " << getName();
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Input memory didn't allocate for node " << getName();
+
+    auto * fcLayer = dynamic_cast<FullyConnectedLayer*>(getCnnLayer().get());
+    if (fcLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot convert fully connected layer.";
+
+    const size_t rows = sparseWeights ? sparseWeights->rows : quantizedWeights->rows;
+    compressedBiases.assign(rows, 0.0f);
+    if (withBiases) {
+        const float *biases = fcLayer->_biases->cbuffer().as<const float *>();
+        std::copy(biases, biases + std::min<size_t>(rows, fcLayer->_biases->size()), compressedBiases.begin());
+    }
+
+    if (quantizedWeights)
+        quantizedGemv = std::make_shared<QuantizedGemv>(quantizedWeights);
+}
+
+// Kernels compute a block of output channels for all batch items, so every thread writes
+// contiguous parts of the output and compressed rows of the block stay in cache
+static constexpr size_t compressedKernelBlockSize = 16;
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    const float *src = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemory().GetData()) +
+                       getParentEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst = reinterpret_cast<float *>(getChildEdgeAt(0)->getMemory().GetData()) +
+                 getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t batch = static_cast<size_t>(batchToProcess());
+    const size_t rows = sparseWeights->rows;
+    const size_t cols = sparseWeights->cols;
+    const float *values = sparseWeights->values.data();
+    const int32_t *columns = sparseWeights->columns.data();
+    const int32_t *rowOffsets = sparseWeights->rowOffsets.data();
+    const float *biases = compressedBiases.data();
+
+    const size_t blocks = div_up(rows, compressedKernelBlockSize);
+    parallel_for(blocks, [&](size_t b) {
+        const size_t rowStart = b * compressedKernelBlockSize;
+        const size_t rowEnd = std::min(rows, rowStart + compressedKernelBlockSize);
+        for (size_t n = 0; n < batch; n++) {
+            const float *srcRow = src + n * cols;
+            float *dstRow = dst + n * rows;
+            for (size_t r = rowStart; r < rowEnd; r++) {
+                float acc = biases[r];
+                for (int32_t i = rowOffsets[r]; i < rowOffsets[r + 1]; i++)
+                    acc += values[i] * srcRow[columns[i]];
+                dstRow[r] = acc;
+            }
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::executeQuantized() {
+    const float *src = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemory().GetData()) +
+                       getParentEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst = reinterpret_cast<float *>(getChildEdgeAt(0)->getMemory().GetData()) +
+                 getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t batch = static_cast<size_t>(batchToProcess());
+    const size_t rows = quantizedWeights->rows;
+    const size_t cols = quantizedWeights->cols;
+    const float *biases = compressedBiases.data();
+
+    std::vector<float> srcSums(batch);
+    parallel_for(batch, [&](size_t n) {
+        srcSums[n] = std::accumulate(src + n * cols, src + (n + 1) * cols, 0.0f);
+    });
+
+    const size_t blocks = div_up(rows, compressedKernelBlockSize);
+    parallel_for(blocks, [&](size_t b) {
+        const size_t rowStart = b * compressedKernelBlockSize;
+        const size_t rowEnd = std::min(rows, rowStart + compressedKernelBlockSize);
+        for (size_t n = 0; n < batch; n++)
+            quantizedGemv->execute(src + n * cols, srcSums[n], biases, dst + n * rows, rowStart, rowEnd);
+    });
+}
+
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (sparseWeights) {
+        executeSparse();
+        return;
+    }
+    if (quantizedWeights) {
+        executeQuantized();
+        return;
+    }
+    MKLDNNNode::execute(strm);
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (withCompressedWeights()) {
+        if (compressedBiases.empty())
+            createCompressedPrimitive();
+        return;
+    }
     if (prim)
         return;
 
@@ -273,6 +536,13 @@ bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
 
+uint64_t MKLDNNFullyConnectedNode::getOperationsCount() const {
+    if (weightsDims.empty())
+        return 0;
+    const uint64_t weightsCount = std::accumulate(weightsDims.begin(), weightsDims.end(), uint64_t(1), std::multiplies<uint64_t>());
+    return 2 * getChildEdgeAt(0)->getDims().size() * (weightsCount / weightsDims[0]);
+}
+
 memory::format MKLDNNFullyConnectedNode::weightsFormatForSrcFormat(memory::format sourceFormat) {
     switch (sourceFormat) {
         case memory::format::x:
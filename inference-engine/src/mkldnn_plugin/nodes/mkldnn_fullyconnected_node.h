@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/quantized_gemv.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -18,8 +19,12 @@ public:
     ~MKLDNNFullyConnectedNode() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void initDescriptor(const InferenceEngine::LayerConfig& config) override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
+    uint64_t getOperationsCount() const override;
     bool canBeInPlace() const override {
         return false;
     }
@@ -37,6 +42,23 @@ public:
     const mkldnn::memory& getWeights() const;
     const mkldnn::memory& getBias() const;
 
+    /**
+     * @brief Compresses constant FP32 weights of the layer: to sparse format if fraction of zero weights is not
+     * less than sparseThreshold, otherwise quantized to compressionBits (8 or 4, 0 disables). Returns empty
+     * weights if the layer is not supported. Compressed weights are shared through the cache, if it is passed.
+     */
+    static MKLDNNCompressedWeights compressWeights(const InferenceEngine::CNNLayer& layer, float sparseThreshold,
+                                                   int compressionBits, const MKLDNNWeightsSharing::Ptr& cache);
+    /**
+     * @brief Switches the node to implementation with compressed weights, so FP32 weights of the layer
+     * are not used and may be released. Must be called before graph optimizations, because these
+     * implementations don't support fused operations.
+     */
+    void setCompressedWeights(const MKLDNNCompressedWeights& weights);
+    bool withCompressedWeights() const {
+        return sparseWeights != nullptr || quantizedWeights != nullptr;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -52,6 +74,15 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    void createCompressedPrimitive();
+    void executeSparse();
+    void executeQuantized();
+
+    MKLDNNSparseWeights::Ptr sparseWeights;
+    MKLDNNQuantizedWeights::Ptr quantizedWeights;
+    std::shared_ptr<QuantizedGemv> quantizedGemv;
+    std::vector<float> compressedBiases;
 };
 
 }  // namespace MKLDNNPlugin
@@ -122,7 +122,7 @@ void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
 
     auto inPrec0 = getCnnLayer()->insData[0].lock()->getPrecision();
     auto inPrec1 = getCnnLayer()->insData[1].lock()->getPrecision();
-    if ((inPrec0 != Precision::U8 && inPrec0 != Precision::I8) || inPrec1 != Precision::I8 || isThreeInputs) {
+    if ((inPrec0 != Precision::U8 && inPrec0 != Precision::I8) || (inPrec1 != Precision::U8 && inPrec1 != Precision::I8) || isThreeInputs) {
         if (inPrec0 == Precision::BF16 || inPrec1 == Precision::BF16) {
             inPrec0 = Precision::BF16;
             inPrec1 = Precision::BF16;
@@ -223,6 +223,29 @@ inline void process_gemm(char transa, char transb, int M, int N, int K, float al
     });
 }
 
+// There is no integer gemm for unsigned B, so B is shifted to the signed range and the shift is compensated
+// with the row sums of A: A * B = A * (B - 128) + 128 * sum_k(A)
+template<typename T>
+inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const T *A, int lda,
+                         const uint8_t *B, int ldb, float beta, float *C, int ldc) {
+    std::vector<int8_t> shiftedB(static_cast<size_t>(K) * N);
+    parallel_for(shiftedB.size(), [&](size_t i) {
+        shiftedB[i] = static_cast<int8_t>(static_cast<int32_t>(B[i]) - 128);
+    });
+
+    process_gemm(transa, transb, M, N, K, alpha, A, lda, shiftedB.data(), ldb, beta, C, ldc);
+
+    parallel_for(M, [&](size_t m) {
+        int32_t sum = 0;
+        for (int k = 0; k < K; k++)
+            sum += static_cast<int32_t>(transa == 'T' ? A[k * lda + m] : A[m * lda + k]);
+
+        const float compensation = alpha * 128.f * sum;
+        for (int n = 0; n < N; n++)
+            C[m * ldc + n] += compensation;
+    });
+}
+
 template<typename T0, typename T1>
 void MKLDNNGemmNode::process_data() {
     auto inDims0 = getParentEdgeAt(0)->getDims();
@@ -303,10 +326,16 @@ void MKLDNNGemmNode::execute(mkldnn::stream strm) {
             process_data<uint16_t, uint16_t>();
             break;
         case Precision::I8:
-            process_data<int8_t, int8_t>();
+            if (getParentEdgeAt(1)->getDesc().getPrecision() == Precision::U8)
+                process_data<int8_t, uint8_t>();
+            else
+                process_data<int8_t, int8_t>();
             break;
         case Precision::U8:
-            process_data<uint8_t, int8_t>();
+            if (getParentEdgeAt(1)->getDesc().getPrecision() == Precision::U8)
+                process_data<uint8_t, uint8_t>();
+            else
+                process_data<uint8_t, int8_t>();
             break;
         default:
             THROW_IE_EXCEPTION << "Gemm node: first input has unsupported precision";
@@ -317,6 +346,12 @@ bool MKLDNNGemmNode::created() const {
     return getType() == Gemm;
 }
 
+uint64_t MKLDNNGemmNode::getOperationsCount() const {
+    auto inDims0 = getParentEdgeAt(0)->getDims();
+    uint64_t K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
+    return 2 * getChildEdgeAt(0)->getDims().size() * K;
+}
+
 int MKLDNNGemmNode::getMaxBatch() {
     if (!outDims.empty())
         return outDims[0][0];
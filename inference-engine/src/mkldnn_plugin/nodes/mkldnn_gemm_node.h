@@ -22,6 +22,7 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    uint64_t getOperationsCount() const override;
     int getMaxBatch() override;
 
 private:
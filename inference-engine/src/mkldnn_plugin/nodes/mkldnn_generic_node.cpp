@@ -112,6 +112,12 @@ void MKLDNNGenericNode::cleanup() {
     extFactory.reset();
 }
 
+InferenceEngine::ILayerEltwiseImpl::Ptr MKLDNNGenericNode::getEltwiseImpl() const {
+    if (impls.size() != 1)
+        return nullptr;
+    return std::dynamic_pointer_cast<InferenceEngine::ILayerEltwiseImpl>(impls[0]);
+}
+
 void MKLDNNGenericNode::execLayer() {
     bool isDynBatch = dynBatchLim > 0;
     std::vector<InferenceEngine::Blob::Ptr> inputs;
@@ -189,8 +195,15 @@ void MKLDNNGenericNode::initDescriptor(const InferenceEngine::LayerConfig &confi
         }
     }
     for (auto &outConf : rightConfig.outConfs) {
-        if (outConf.inPlace < getParentEdges().size() &&
-            getParentEdgeAt(static_cast<size_t>(outConf.inPlace))->getParent()->getChildEdges().size() > 1) {
+        if (outConf.inPlace < 0 || static_cast<size_t>(outConf.inPlace) >= getParentEdges().size() ||
+            static_cast<size_t>(outConf.inPlace) >= rightConfig.inConfs.size())
+            continue;
+        // The output may overwrite the input only if nobody else reads it, it is not a constant that is computed
+        // once and the kernel doesn't change its size
+        auto parent = getParentEdgeAt(static_cast<size_t>(outConf.inPlace))->getParent();
+        const auto &inDesc = rightConfig.inConfs[outConf.inPlace].desc;
+        if (parent->getChildEdges().size() > 1 || (parent->isConstant() && !isConstant()) ||
+            inDesc.getDims() != outConf.desc.getDims() || inDesc.getPrecision() != outConf.desc.getPrecision()) {
             outConf.inPlace = -1;
         }
     }
@@ -34,6 +34,9 @@ public:
     void execLayer();
     void cleanup() override;
 
+    // Element-wise body of the extension implementation which may be fused into an Eltwise node, nullptr otherwise
+    InferenceEngine::ILayerEltwiseImpl::Ptr getEltwiseImpl() const;
+
 
 protected:
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
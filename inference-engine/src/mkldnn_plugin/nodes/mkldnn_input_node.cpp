@@ -140,10 +140,18 @@ namespace {
     }
 }   // namespace
 
+bool MKLDNNInputNode::canShareConstBlob(const InferenceEngine::TensorDesc& desc) const {
+    return constBlob && !isMeanImage &&
+           (constBlob->getTensorDesc() == desc || isCompatibleTensors(constBlob->getTensorDesc(), desc));
+}
+
 void MKLDNNInputNode::execute(mkldnn::stream strm) {
-    if (!constBlob)
+    if (!constBlob || constDataPlaced)
         return;
     auto dstBlob = getChildEdgeAt(0)->getBlob();
+    // the edge memory may refer to the constant data itself
+    if (dstBlob->cbuffer().as<const void*>() == constBlob->cbuffer().as<const void*>())
+        return;
 
     if (constBlob->size() != dstBlob->size()) {
         THROW_IE_EXCEPTION << "Incorrect blob sizes for node " << getName();
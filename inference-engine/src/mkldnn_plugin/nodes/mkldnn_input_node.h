@@ -24,12 +24,28 @@ public:
     void withMeanImage() {
         isMeanImage = true;
     }
+    const InferenceEngine::Blob::Ptr& getConstBlob() const {
+        return constBlob;
+    }
+    /**
+     * @brief Checks that the constant blob can be used as memory of the output edge with the given descriptor
+     * without conversion, so the data need not be copied
+     */
+    bool canShareConstBlob(const InferenceEngine::TensorDesc& desc) const;
+    /**
+     * @brief Marks that the output edge memory is already filled with the constant data, e.g. it is a table
+     * sharded across NUMA nodes, so execute() does not copy the data again
+     */
+    void setConstDataPlaced() {
+        constDataPlaced = true;
+    }
 
 private:
     InferenceEngine::Precision precision;
 
     InferenceEngine::Blob::Ptr constBlob;
     bool isMeanImage = false;
+    bool constDataPlaced = false;
 };
 
 }  // namespace MKLDNNPlugin
@@ -1813,6 +1813,24 @@ void MKLDNNInterpolateNode::buildTblNN(SizeVector& srcDimPad5d, SizeVector& dstD
         indexTable[OD + OH + ox] = nearestRound(ix, isWDownsample);
         indexTable[OD + OH + ox] = clipCoord(indexTable[OD + OH + ox], IW);
     }
+
+    // byte offsets of source rows and pixels used by the kernels go after the indices:
+    // h_0 * IW..h_OH-1 * IW, w_0..w_OW-1 for planar layout and w_0..w_OW-1 multiplied by channels gathered in a pixel otherwise
+    if (layout == InterpolateLayoutType::planar) {
+        indexTable.resize(OD + 2 * OH + 2 * OW);
+        for (int oy = 0; oy < OH; oy++) {
+            indexTable[OD + OH + OW + oy] = indexTable[OD + oy] * IW * srcDataSize;
+        }
+        for (int ox = 0; ox < OW; ox++) {
+            indexTable[OD + 2 * OH + OW + ox] = indexTable[OD + OH + ox] * srcDataSize;
+        }
+    } else {
+        size_t CGatherLen = (layout == InterpolateLayoutType::by_channel) ? srcDimPad5d[1] : (mayiuse(cpu::avx512_common) ? 16 : 8);
+        indexTable.resize(OD + OH + 2 * OW);
+        for (int ox = 0; ox < OW; ox++) {
+            indexTable[OD + OH + OW + ox] = indexTable[OD + OH + ox] * CGatherLen * srcDataSize;
+        }
+    }
 }
 
 void MKLDNNInterpolateNode::buildTblLinearOnnx(SizeVector& srcDimPad5d, SizeVector& dstDim5d,
@@ -2030,7 +2048,9 @@ void MKLDNNInterpolateNode::buildTblCubic(SizeVector& srcDimPad5d, SizeVector& d
     const int idxNum = 1;
     size_t idxWeightSize = (CUBIC_GRID_LEN + idxNum) * OW + (CUBIC_GRID_LEN + idxNum) * OH;
     if (layout != InterpolateLayoutType::planar) {
-        indexTable.resize(idxWeightSize);
+        // byte offsets of the source grid rows and columns, the grid is clipped to the source borders
+        size_t offsetsSize = CUBIC_GRID_LEN * OW + CUBIC_GRID_LEN * OH;
+        indexTable.resize(idxWeightSize + offsetsSize);
     } else {
         size_t sequenceSize = 2 * OH * OW;
         indexTable.resize(idxWeightSize + sequenceSize);
@@ -2068,7 +2088,25 @@ void MKLDNNInterpolateNode::buildTblCubic(SizeVector& srcDimPad5d, SizeVector& d
         yFactor[CUBIC_GRID_LEN * oy + 3] = coffes[3];
     }
 
-    if (layout == InterpolateLayoutType::planar) {
+    if (layout != InterpolateLayoutType::planar) {
+        int CGatherLen = (layout == InterpolateLayoutType::by_channel) ? srcDimPad5d[1] : (mayiuse(cpu::avx512_common) ? 16 : 8);
+        tblAdvance += CUBIC_GRID_LEN * OH;
+        int *xOffset = static_cast<int*>(&indexTable[tblAdvance]);
+        tblAdvance += CUBIC_GRID_LEN * OW;
+        int *yOffset = static_cast<int*>(&indexTable[tblAdvance]);
+        for (int ox = 0; ox < OW; ox++) {
+            for (int i = 0; i < CUBIC_GRID_LEN; i++) {
+                int x = std::max(0, std::min(xOrigin[ox] - 1 + i, IW - 1));
+                xOffset[CUBIC_GRID_LEN * ox + i] = x * CGatherLen * srcDataSize;
+            }
+        }
+        for (int oy = 0; oy < OH; oy++) {
+            for (int i = 0; i < CUBIC_GRID_LEN; i++) {
+                int y = std::max(0, std::min(yOrigin[oy] - 1 + i, IH - 1));
+                yOffset[CUBIC_GRID_LEN * oy + i] = y * CGatherLen * IW * srcDataSize;
+            }
+        }
+    } else {
         tblAdvance += CUBIC_GRID_LEN * OH;
         int *sequenceOH = static_cast<int*>(&indexTable[tblAdvance]);
         tblAdvance += OH * OW;
@@ -2157,7 +2195,6 @@ void MKLDNNInterpolateNode::execute(mkldnn::stream strm) {
     }
 
     uint8_t *src_data = nullptr;
-    std::vector<uint8_t> srcPadded;
     if (hasPad) {
         int padB0 = (dimSize > 2) ? padBegin[0] : 0;
         int padB1 = (dimSize > 2) ? padBegin[1] : 0;
@@ -2283,7 +2320,7 @@ void MKLDNNInterpolateNode::execute(mkldnn::stream strm) {
 void MKLDNNInterpolateNode::NNCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int ID, int IH, int IW, int OD, int OH, int OW) {
     int *index_d = static_cast<int*>(&indexTable[0]);
     int *index_h = static_cast<int*>(&indexTable[OD]);
-    int *index_w = static_cast<int*>(&indexTable[OD + OH]);
+    int *index_w_kernel = static_cast<int*>(&indexTable[OD + OH + OW]);
 
     Layout layout = getParentEdgeAt(0)->getDesc().getLayout();
     bool is_nhwc = (layout == NHWC || layout == NDHWC) ? true : false;
@@ -2292,10 +2329,6 @@ void MKLDNNInterpolateNode::NNCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr
         if (is_nhwc) {
             const uint8_t *in_ptr = in_ptr_ + (IW * IH * ID * C * b) * srcDataSize;
             uint8_t *out_ptr = out_ptr_ + (OW * OH * OD * C * b) * dstDataSize;
-            std::vector<int> index_w_kernel(OW);
-            for (int ox = 0; ox < OW; ox++) {
-                index_w_kernel[ox] = index_w[ox] * C * srcDataSize;
-            }
             parallel_for2d(OD, OH, [&](size_t d, size_t h) {
                 // kernel for C * OW
                 uint8_t *out_ptr_dh = out_ptr + (C * OW * OH * d + C * OW * h) * dstDataSize;
@@ -2303,7 +2336,7 @@ void MKLDNNInterpolateNode::NNCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr
                 auto arg = jit_interpolate_call_args();
                 arg.dst = out_ptr_dh;
                 arg.src_ptr[0] = in_ptr_dh;
-                arg.index = static_cast<int*>(&(index_w_kernel[0]));
+                arg.index = index_w_kernel;
                 arg.work_amount = C;
                 arg.oc_off = 0;
                 (*interpolateKernel)(&arg);
@@ -2313,10 +2346,6 @@ void MKLDNNInterpolateNode::NNCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr
             int CB = div_up(C, blk_size);
             const uint8_t *in_ptr = in_ptr_ + (IW * IH * ID * CB * blk_size * b) * srcDataSize;
             uint8_t *out_ptr = out_ptr_ + (OW * OH * OD * CB * blk_size * b) * dstDataSize;
-            std::vector<int> index_w_kernel(OW);
-            for (int ox = 0; ox < OW; ox++) {
-                index_w_kernel[ox] = index_w[ox] * blk_size * srcDataSize;
-            }
             parallel_for2d(CB, OD, [&](size_t cb, size_t d) {
                 uint8_t *out_ptr_cbd = out_ptr + (blk_size * OW * OH * OD * cb + blk_size * OW * OH * d) * dstDataSize;
                 const uint8_t *in_ptr_cbd = in_ptr + (blk_size * IW * IH * ID * cb + blk_size * IW * IH * index_d[d]) * srcDataSize;
@@ -2324,7 +2353,7 @@ void MKLDNNInterpolateNode::NNCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr
                 for (int h = 0; h < OH; h++) {  // kernel for blk_size * OW
                     arg.dst = out_ptr_cbd + blk_size * OW * h * dstDataSize;
                     arg.src_ptr[0] = in_ptr_cbd + blk_size * IW * index_h[h] * srcDataSize;
-                    arg.index = static_cast<int*>(&(index_w_kernel[0]));
+                    arg.index = index_w_kernel;
                     arg.work_amount = static_cast<size_t>(OW);
                     arg.oc_off = cb * blk_size * sizeof(float);
                     (*interpolateKernel)(&arg);
@@ -2336,18 +2365,8 @@ void MKLDNNInterpolateNode::NNCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr
 
 void MKLDNNInterpolateNode::NNPlanar(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int ID, int IH, int IW, int OD, int OH, int OW) {
     int *index_d = static_cast<int*>(&indexTable[0]);
-    int *index_h = static_cast<int*>(&indexTable[OD]);
-    int *index_w = static_cast<int*>(&indexTable[OD + OH]);
-
-    std::vector<int> index_kernel(OH + OW);
-    // index_h * IW * srcDataSize to reduce and simplify redundant compute
-    for (int oh = 0; oh < OH; oh++) {
-        index_kernel[oh] = index_h[oh] * IW * srcDataSize;
-    }
-    // index_w * srcDataSize
-    for (int ow = 0; ow < OW; ow++) {
-        index_kernel[OH + ow] = index_w[ow] * srcDataSize;
-    }
+    // index_h * IW * srcDataSize and index_w * srcDataSize, see buildTblNN()
+    int *index_kernel = static_cast<int*>(&indexTable[OD + OH + OW]);
 
     parallel_for3d(B, C, OD, [&](size_t b, size_t c, size_t od) {
         const uint8_t *in_ptr = in_ptr_ + (IW * IH * ID * C * b + IW * IH * ID * c + IW * IH * index_d[od]) * srcDataSize;
@@ -2356,7 +2375,7 @@ void MKLDNNInterpolateNode::NNPlanar(const uint8_t *in_ptr_, uint8_t *out_ptr_,
         auto arg = jit_interpolate_call_args();
         arg.src_ptr[0] = in_ptr;
         arg.dst = out_ptr;
-        arg.index = static_cast<int*>(&index_kernel[0]);  // need index_h and index_w in kernel, it's in continous memory so one param
+        arg.index = index_kernel;  // need index_h and index_w in kernel, it's in continous memory so one param
         arg.oc_off = static_cast<size_t>(c * sizeof(float));
         // work_amount is OH(out loop) and OW(inner loop), can get in kernel from jcp.
         (*interpolateKernel)(&arg);
@@ -2596,10 +2615,10 @@ void MKLDNNInterpolateNode::linearInterpolation(const uint8_t *in_ptr_, uint8_t
 
 void MKLDNNInterpolateNode::cubicCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int IH, int IW, int OH, int OW) {
     const int idxNum = 1;
-    int *xOrigin = static_cast<int*>(&indexTable[0]);
     float *xFactor = reinterpret_cast<float*>(&indexTable[OW]);
-    int *yOrigin = static_cast<int*>(&indexTable[(CUBIC_GRID_LEN + idxNum) * OW]);
     float *yFactor = reinterpret_cast<float*>(&indexTable[(CUBIC_GRID_LEN + idxNum) * OW + OH]);
+    int *xOffset = static_cast<int*>(&indexTable[(CUBIC_GRID_LEN + idxNum) * (OW + OH)]);
+    int *yOffset = static_cast<int*>(&indexTable[(CUBIC_GRID_LEN + idxNum) * (OW + OH) + CUBIC_GRID_LEN * OW]);
 
     Layout layout = getParentEdgeAt(0)->getDesc().getLayout();
     bool isByChannel = (layout == NHWC) ? true : false;
@@ -2614,16 +2633,10 @@ void MKLDNNInterpolateNode::cubicCGathered(const uint8_t *in_ptr_, uint8_t *out_
         uint8_t *out_ptr_nhw = out_ptr_ + (OH * OW * CSize * b + OW * CGatherLen * h + CGatherLen * w) * dstDataSize;
         const uint8_t *in_ptr_n = in_ptr_ + (IH * IW * CSize * b) * srcDataSize;
 
-        std::vector<int> kernelIndex(CUBIC_GRID_LEN * CUBIC_GRID_LEN);  // 16 address offset to src(batch) or src(CB)
-        int iy = yOrigin[h];
-        int ix = xOrigin[w];
-        for (int y = iy - 1, i = 0; y <= iy + 2; y++, i++) {
-            int yInRange = std::max(0, std::min(y, IH - 1));
-            yInRange = yInRange * CGatherLen * IW * srcDataSize;
-            for (int x = ix - 1, j = 0; x <= ix + 2; x++, j++) {
-                int xInRange = std::max(0, std::min(x, IW - 1));
-                xInRange = yInRange + xInRange * CGatherLen * srcDataSize;
-                kernelIndex[i * CUBIC_GRID_LEN + j] = xInRange;
+        int kernelIndex[16];  // CUBIC_GRID_LEN * CUBIC_GRID_LEN address offsets to src(batch) or src(CB)
+        for (int i = 0; i < CUBIC_GRID_LEN; i++) {
+            for (int j = 0; j < CUBIC_GRID_LEN; j++) {
+                kernelIndex[i * CUBIC_GRID_LEN + j] = yOffset[h * CUBIC_GRID_LEN + i] + xOffset[w * CUBIC_GRID_LEN + j];
             }
         }
         auto arg = jit_interpolate_call_args();
@@ -164,6 +164,8 @@ private:
     size_t srcDataSize, dstDataSize;
 
     std::vector<int> indexTable;
+    // padded source is kept between executions, so the pads are zeroed once and only the data is copied
+    std::vector<uint8_t> srcPadded;
 
     std::shared_ptr<jit_uni_interpolate_kernel> interpolateKernel;
 };
@@ -6,6 +6,8 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_memory_node.hpp"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 #include "common/cpu_memcpy.h"
 
 using namespace mkldnn;
@@ -14,6 +16,26 @@ using namespace InferenceEngine;
 
 std::mutex MKLDNNMemoryNodeVirtualEdge::holderMutex;
 
+static bool isViewOfAnotherMemory(const MKLDNNNodePtr& node) {
+    if (node->isConstant() || node->isInplace())
+        return true;
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+    auto* concat = dynamic_cast<MKLDNNConcatNode *>(node.get());
+    if (concat && concat->isOptimized())
+        return true;
+#endif
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+    if (dynamic_cast<MKLDNNSplitNode *>(node.get()))
+        return true;
+#endif
+    return false;
+}
+
+static void setDataHandle(const std::vector<MKLDNNMemoryPtr>& memory, void* data) {
+    for (const auto& mem : memory)
+        mem->GetPrimitivePtr()->set_data_handle(data);
+}
+
 MKLDNNMemoryOutputNode::MKLDNNMemoryOutputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(layer, eng, cache) , MKLDNNMemoryNode(layer) {
     if (created()) {
@@ -42,6 +64,31 @@ void MKLDNNMemoryOutputNode::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, memory::format::any);
 }
 
+/**
+ * The new state may be written by the producer directly into the state buffer only if the producer edge memory
+ * isn't shared with any other edge. The rules are the same as for zero-copy network outputs in MKLDNNInferRequest.
+ */
+void MKLDNNMemoryOutputNode::createPrimitive() {
+    auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(inputNode);
+    IE_ASSERT(inputMemoryNode != nullptr);
+
+    auto edge = getParentEdgeAt(0);
+    auto parent = edge->getParent();
+    if (parent->getType() == Input || parent->getType() == MemoryInput || parent->getChildEdges().size() != 1 ||
+            isViewOfAnotherMemory(parent))
+        return;
+    for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+        if (parent->getParentEdgeAt(i)->getMemory().GetPrimitive().get_data_handle() ==
+                edge->getMemory().GetPrimitive().get_data_handle())
+            return;
+    }
+    if (MKLDNNMemoryDesc(edge->getMemory().GetDescriptor()) !=
+            MKLDNNMemoryDesc(inputMemoryNode->getChildEdgeAt(0)->getMemory().GetDescriptor()))
+        return;
+
+    inputMemoryNode->setStateProducer({edge->getMemoryPtr()});
+}
+
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
@@ -52,7 +99,8 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}),
+          spareStore(new MKLDNNMemory{eng}) {
     if (created()) {
         holder = MKLDNNMemoryNodeVirtualEdge::registerInput(this);
     }
@@ -63,9 +111,31 @@ void MKLDNNMemoryInputNode::createPrimitive() {
 
     auto mem_desc = getChildEdgeAt(0)->getMemoryPtr()->GetDescriptor();
     dataStore->Create(mem_desc);
+    spareStore->Create(mem_desc);
 
     // default memory state is zero filled
     dataStore->FillZero();
+
+    // consumers may read the state buffer directly if no other memory object refers to their input data,
+    // the rules are the same as for zero-copy network inputs in MKLDNNInferRequest
+    consumerMemory.clear();
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto edge = getChildEdgeAt(i);
+        auto child = edge->getChild();
+        bool redirectable = !isViewOfAnotherMemory(child) &&
+                            MKLDNNMemoryDesc(edge->getMemory().GetDescriptor()) == MKLDNNMemoryDesc(mem_desc);
+        for (size_t j = 0; redirectable && j < child->getChildEdges().size(); j++) {
+            redirectable = child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() !=
+                           edge->getMemory().GetPrimitive().get_data_handle();
+        }
+        if (!redirectable) {
+            consumerMemory.clear();
+            break;
+        }
+        consumerMemory.push_back(edge->getMemoryPtr());
+    }
+
+    setDataHandle(producerMemory, spareStore->GetData());
 }
 
 /**
@@ -100,14 +170,31 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::setStateProducer(const std::vector<MKLDNNMemoryPtr>& memory) {
+    producerMemory = memory;
+    if (spareStore->GetPrimitivePtr())
+        setDataHandle(producerMemory, spareStore->GetData());
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
+    //           spareStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    if (producerMemory.empty())
+        simple_copy(*spareStore, new_state);
+
+    auto state = spareStore->GetData();
+    spareStore->GetPrimitivePtr()->set_data_handle(dataStore->GetData());
+    dataStore->GetPrimitivePtr()->set_data_handle(state);
+    setDataHandle(producerMemory, spareStore->GetData());
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
+    if (!consumerMemory.empty()) {
+        setDataHandle(consumerMemory, dataStore->GetData());
+        return;
+    }
+
     auto dst_mem = getChildEdgeAt(0)->getMemory();
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
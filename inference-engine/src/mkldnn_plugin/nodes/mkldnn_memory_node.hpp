@@ -11,6 +11,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -69,7 +70,7 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     ~MKLDNNMemoryOutputNode() override;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override {
         return getType() == MemoryOutput;
@@ -102,9 +103,21 @@ public:
 
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
+    /**
+     * @brief Sets memory of the edge which produces the new state. The producer writes the new state directly
+     * into the spare buffer, so it doesn't have to be copied on storeState.
+     */
+    void setStateProducer(const std::vector<MKLDNNMemoryPtr>& memory);
     MKLDNNMemoryPtr getStore();
  private:
+    /**
+     * @brief dataStore keeps the current state, spareStore receives the next one. Buffers are swapped on
+     * storeState, so consumers executed after MemoryOutput still see the state of the current inference.
+     */
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr spareStore;
+    std::vector<MKLDNNMemoryPtr> consumerMemory;
+    std::vector<MKLDNNMemoryPtr> producerMemory;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 #endif
@@ -219,6 +219,106 @@ private:
     }
 };
 
+// src->mean,m2 of every vector lane in a single pass (Welford), planar layout only
+template <cpu_isa_t isa>
+struct jit_uni_mvn_welford_kernel_f32 : public jit_uni_mvn_mean_variance_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_mvn_welford_kernel_f32)
+
+    explicit jit_uni_mvn_welford_kernel_f32(jit_mvn_config_params jcp) : jit_uni_mvn_mean_variance_kernel(jcp), jit_generator() {
+        this->preamble();
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_mean, ptr[reg_params + GET_OFF(mean)]);
+        mov(reg_variance, ptr[reg_params + GET_OFF(variance)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_stride, ptr[reg_params + GET_OFF(src_stride)]);
+
+        mov(reg_one.cvt32(), float2int(1.0f));
+        movd(xmm_one, reg_one.cvt32());
+        uni_vbroadcastss(vmm_one, xmm_one);
+
+        uni_vpxor(vmm_mean, vmm_mean, vmm_mean);
+        uni_vpxor(vmm_m2, vmm_m2, vmm_m2);
+        uni_vpxor(vmm_count, vmm_count, vmm_count);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            load_vector(vmm_val, ptr[reg_src], jcp_.src_dt);
+            if (!isFloatCompatible(jcp_.src_dt))
+                uni_vcvtdq2ps(vmm_val, vmm_val);
+
+            // delta = x - mean; mean += delta / n; m2 += delta * (x - mean)
+            uni_vaddps(vmm_count, vmm_count, vmm_one);
+            uni_vmovups(vmm_delta, vmm_val);
+            uni_vsubps(vmm_delta, vmm_delta, vmm_mean);
+            uni_vmovups(vmm_aux, vmm_delta);
+            uni_vdivps(vmm_aux, vmm_aux, vmm_count);
+            uni_vaddps(vmm_mean, vmm_mean, vmm_aux);
+            uni_vsubps(vmm_val, vmm_val, vmm_mean);
+            uni_vfmadd231ps(vmm_m2, vmm_delta, vmm_val);
+
+            add(reg_src, reg_stride);
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        uni_vmovups(ptr[reg_mean], vmm_mean);
+        uni_vmovups(ptr[reg_variance], vmm_m2);
+
+        this->postamble();
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_mean = r9;
+    Xbyak::Reg64 reg_variance = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_stride = r12;
+    Xbyak::Reg64 reg_one = r13;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_mean = Vmm(1);
+    Vmm vmm_m2 = Vmm(2);
+    Vmm vmm_count = Vmm(3);
+    Vmm vmm_one = Vmm(4);
+    Vmm vmm_delta = Vmm(5);
+    Vmm vmm_aux = Vmm(6);
+    Xbyak::Xmm xmm_one = Xbyak::Xmm(4);
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
+        switch (src_dt) {
+            case memory::f32:
+            case memory::s32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case memory::s8:
+                uni_vpmovsxbd(vmm_src, op);
+                break;
+            case memory::u8:
+                uni_vpmovzxbd(vmm_src, op);
+                break;
+            case memory::bf16:
+                uni_vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
+            default:
+                assert(!"unknown dst_dt");
+        }
+    }
+};
+
 // mean,variance->mvn
 template <cpu_isa_t isa>
 struct jit_uni_mvn_kernel_f32 : public jit_uni_mvn_kernel, public jit_generator {
@@ -615,6 +715,8 @@ void MKLDNNMVNNode::createPrimitive() {
         if (normalize_variance) {
             jcp.normalize_variance = true;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
+            if (jcp.planar_layout && !across_channels)
+                mvn_welford_kernel.reset(new jit_uni_mvn_welford_kernel_f32<cpu::avx512_common>(jcp));
         }
     } else if (mayiuse(cpu::avx2)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx2>(jcp, *attr.get()));
@@ -624,6 +726,8 @@ void MKLDNNMVNNode::createPrimitive() {
         if (normalize_variance) {
             jcp.normalize_variance = true;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
+            if (jcp.planar_layout && !across_channels)
+                mvn_welford_kernel.reset(new jit_uni_mvn_welford_kernel_f32<cpu::avx2>(jcp));
         }
     } else if (mayiuse(cpu::sse42)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::sse42>(jcp, *attr.get()));
@@ -633,6 +737,8 @@ void MKLDNNMVNNode::createPrimitive() {
         if (normalize_variance) {
             jcp.normalize_variance = true;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp));
+            if (jcp.planar_layout && !across_channels)
+                mvn_welford_kernel.reset(new jit_uni_mvn_welford_kernel_f32<cpu::sse42>(jcp));
         }
     }
 }
@@ -920,7 +1026,59 @@ void MKLDNNMVNNode::mvn_pln(const in_data_t* src_data, out_data_t* dst_data, con
             }
         } else {  // per channel
             float C2inv = 1.f / static_cast<float>(C2);
-            if (mvn_mean_kernel && mvn_variance_kernel && mvn_kernel) {
+            if (mvn_welford_kernel && mvn_kernel) {
+                parallel_for(C, [&](size_t c) {
+                    size_t blocks_num = C2 / blk_size;
+                    size_t tail_per_channel = blocks_num * blk_size;
+                    size_t cc = cb + c * C2;
+
+                    // mean and m2 of every lane for one pass over the channel, then merged
+                    float lane_mean[16];
+                    float lane_m2[16];
+                    float mean = 0.f;
+                    float m2 = 0.f;
+                    size_t count = 0;
+                    if (blocks_num > 0) {
+                        auto arg = jit_mvn_call_args();
+                        arg.src = src_data + cc;
+                        arg.mean = lane_mean;
+                        arg.variance = lane_m2;
+                        arg.src_stride = static_cast<size_t>(blk_size * sizeof(in_data_t));
+                        arg.work_amount = blocks_num;
+                        (*mvn_welford_kernel)(&arg);
+
+                        for (size_t i = 0; i < blk_size; i++)
+                            mean += lane_mean[i];
+                        mean /= static_cast<float>(blk_size);
+                        for (size_t i = 0; i < blk_size; i++)
+                            m2 += lane_m2[i] + static_cast<float>(blocks_num) * (lane_mean[i] - mean) * (lane_mean[i] - mean);
+                        count = tail_per_channel;
+                    }
+
+                    for (size_t tail = tail_per_channel; tail < C2; tail++) {
+                        float val = src_data[cc + tail];
+                        float delta = val - mean;
+                        mean += delta / static_cast<float>(++count);
+                        m2 += delta * (val - mean);
+                    }
+                    float variance = 1.f / sqrtf(m2 * C2inv + eps);
+
+                    // mvn for this channel
+                    auto arg = jit_mvn_call_args();
+                    arg.src = src_data + cc;
+                    arg.dst = dst_data + cc;
+                    arg.mean = static_cast<float*>(&mean);
+                    arg.variance = static_cast<float*>(&variance);
+                    arg.src_stride = static_cast<size_t>(blk_size * sizeof(in_data_t));
+                    arg.dst_stride = static_cast<size_t>(blk_size * sizeof(out_data_t));
+                    arg.work_amount = blocks_num;
+                    (*mvn_kernel)(&arg);
+
+                    for (size_t tail = tail_per_channel; tail < C2; tail++) {
+                        dst_data[cc + tail] = (src_data[cc + tail] - mean) * variance;
+                    }
+                });
+            } else if (mvn_mean_kernel && mvn_variance_kernel && mvn_kernel) {
                 parallel_for(C, [&](size_t c) {
                     // mean for this channel
                     size_t tail_per_channel = (C2 / blk_size) * blk_size;
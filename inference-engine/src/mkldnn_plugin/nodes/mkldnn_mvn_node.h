@@ -104,6 +104,8 @@ private:
 
     std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_mean_kernel;
     std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_variance_kernel;
+    // computes mean and variance at once for the planar per channel case
+    std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_welford_kernel;
     std::shared_ptr<jit_uni_mvn_kernel> mvn_kernel;
 };
 
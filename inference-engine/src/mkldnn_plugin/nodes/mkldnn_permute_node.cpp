@@ -10,6 +10,7 @@
 #include "ie_parallel.hpp"
 #include "jit_generator.hpp"
 #include <algorithm>
+#include <limits>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -130,6 +131,93 @@ private:
     Xbyak::Xmm xmm = Xbyak::Xmm(0);
 };
 
+#define GET_OFF_TRANSPOSE(field) offsetof(jit_args_transpose, field)
+
+//  Transposes 8x8 tiles of floats with unpack and shuffle instructions. Source rows of a tile are contiguous along
+//  destination columns, the kernel walks along source rows tile by tile.
+struct jit_avx2_transpose_kernel_f32 : public jit_uni_transpose_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_transpose_kernel_f32)
+
+    explicit jit_avx2_transpose_kernel_f32(jit_transpose_conf_t jtp) : jit_uni_transpose_kernel(jtp), jit_generator() {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF_TRANSPOSE(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF_TRANSPOSE(dst)]);
+        mov(reg_tiles, ptr[reg_params + GET_OFF_TRANSPOSE(tiles)]);
+
+        const int src_stride = static_cast<int>(jtp.src_stride * sizeof(float));
+        const int dst_stride = static_cast<int>(jtp.dst_stride * sizeof(float));
+
+        Xbyak::Label tile_loop_label;
+        Xbyak::Label exit_label;
+
+        L(tile_loop_label); {
+            cmp(reg_tiles, 0);
+            je(exit_label, T_NEAR);
+
+            mov(reg_src_row, reg_src);
+            for (int i = 0; i < 8; i++) {
+                vmovups(row(i), ptr[reg_src_row]);
+                if (i < 7)
+                    add(reg_src_row, src_stride);
+            }
+
+            vunpcklps(tmp(0), row(0), row(1));
+            vunpckhps(tmp(1), row(0), row(1));
+            vunpcklps(tmp(2), row(2), row(3));
+            vunpckhps(tmp(3), row(2), row(3));
+            vunpcklps(tmp(4), row(4), row(5));
+            vunpckhps(tmp(5), row(4), row(5));
+            vunpcklps(tmp(6), row(6), row(7));
+            vunpckhps(tmp(7), row(6), row(7));
+
+            vshufps(row(0), tmp(0), tmp(2), 0x44);
+            vshufps(row(1), tmp(0), tmp(2), 0xEE);
+            vshufps(row(2), tmp(1), tmp(3), 0x44);
+            vshufps(row(3), tmp(1), tmp(3), 0xEE);
+            vshufps(row(4), tmp(4), tmp(6), 0x44);
+            vshufps(row(5), tmp(4), tmp(6), 0xEE);
+            vshufps(row(6), tmp(5), tmp(7), 0x44);
+            vshufps(row(7), tmp(5), tmp(7), 0xEE);
+
+            for (int i = 0; i < 4; i++) {
+                vperm2f128(tmp(i), row(i), row(i + 4), 0x20);
+                vperm2f128(tmp(i + 4), row(i), row(i + 4), 0x31);
+            }
+
+            mov(reg_dst_row, reg_dst);
+            for (int i = 0; i < 8; i++) {
+                vmovups(ptr[reg_dst_row], tmp(i));
+                add(reg_dst_row, dst_stride);
+            }
+
+            add(reg_src, 8 * sizeof(float));
+            mov(reg_dst, reg_dst_row);
+            sub(reg_tiles, 1);
+
+            jmp(tile_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_tiles = r10;
+    Xbyak::Reg64 reg_src_row = r11;
+    Xbyak::Reg64 reg_dst_row = r12;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Ymm row(int i) { return Xbyak::Ymm(i); }
+    Xbyak::Ymm tmp(int i) { return Xbyak::Ymm(8 + i); }
+};
+
 MKLDNNPermuteNode::MKLDNNPermuteNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(layer, eng, cache) {}
 
@@ -332,6 +420,34 @@ void MKLDNNPermuteNode::createPrimitive() {
         }
     }
 
+    //  Dims of size 1 are removed and dims which are contiguous both in source and destination are merged, so the
+    //  kernel has less nested loops and longer contiguous runs. Dims of the parallel part (the first n2 ones)
+    //  are merged only with each other, the batch dim is kept for dynamic batch.
+    const int first_mergeable = jpp.supported_dynamic_batch ? 1 : 0;
+    auto erase_dim = [&](int i) {
+        sorted_src_strides.erase(sorted_src_strides.begin() + i);
+        sorted_dst_strides.erase(sorted_dst_strides.begin() + i);
+        sorted_order.erase(sorted_order.begin() + i);
+        sorted_dst_dims.erase(sorted_dst_dims.begin() + i);
+        if (i < n2)
+            n2--;
+    };
+    for (int i = static_cast<int>(sorted_dst_dims.size()) - 1; i >= first_mergeable && sorted_dst_dims.size() > 1; i--) {
+        if (sorted_dst_dims[i] == 1)
+            erase_dim(i);
+    }
+    for (int i = static_cast<int>(sorted_dst_dims.size()) - 2; i >= first_mergeable; i--) {
+        if ((i + 1 < n2) != (i < n2))
+            continue;
+        if (sorted_src_strides[i] == sorted_src_strides[i + 1] * sorted_dst_dims[i + 1] &&
+            sorted_dst_strides[i] == sorted_dst_strides[i + 1] * sorted_dst_dims[i + 1]) {
+            sorted_dst_dims[i] *= sorted_dst_dims[i + 1];
+            sorted_src_strides[i] = sorted_src_strides[i + 1];
+            sorted_dst_strides[i] = sorted_dst_strides[i + 1];
+            erase_dim(i + 1);
+        }
+    }
+
     int max_threads = mkldnn_get_max_threads();
     const int n_max = 3;    //  max count dims for parallel
     int n = 0;
@@ -358,6 +474,104 @@ void MKLDNNPermuteNode::createPrimitive() {
     } else if (mayiuse(cpu::sse42)) {
         permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::sse42>(jpp));
     }
+
+    prepareTranspose(jpp);
+}
+
+void MKLDNNPermuteNode::prepareTranspose(const jit_permute_conf_t& jpp) {
+    //  When the innermost destination dim isn't contiguous in source, the permutation is a set of 2D transposes
+    //  between it and the dim which is contiguous in source. They are done by 8x8 tiles in registers.
+    transpose_kernel.reset();
+    if (jpp.data_size != sizeof(float) || !mayiuse(cpu::avx2))
+        return;
+
+    const int ndims = static_cast<int>(jpp.ndims);
+    const int a = std::distance(jpp.dst_strides.begin(), std::find(jpp.dst_strides.begin(), jpp.dst_strides.end(), 1));
+    const int b = std::distance(jpp.src_strides.begin(), std::find(jpp.src_strides.begin(), jpp.src_strides.end(), 1));
+    if (a == ndims || b == ndims || a == b)
+        return;
+    if (jpp.supported_dynamic_batch && (a == 0 || b == 0))
+        return;
+
+    const size_t tile = jit_transpose_conf_t::tile_size;
+    if (jpp.dst_block_dims[a] < tile || jpp.dst_block_dims[b] < tile)
+        return;
+
+    jit_transpose_conf_t jtp;
+    jtp.src_stride = jpp.src_strides[a];
+    jtp.dst_stride = jpp.dst_strides[b];
+    //  strides are immediate operands of the kernel
+    if (tile * jtp.src_stride * sizeof(float) > static_cast<size_t>(std::numeric_limits<int32_t>::max()) ||
+        tile * jtp.dst_stride * sizeof(float) > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        return;
+
+    transposeParams = TransposeParams();
+    transposeParams.a_dim = jpp.dst_block_dims[a];
+    transposeParams.b_dim = jpp.dst_block_dims[b];
+    transposeParams.batch_outer = jpp.supported_dynamic_batch;
+    for (int i = 0; i < ndims; i++) {
+        if (i != a && i != b) {
+            transposeParams.outer_dims.push_back(jpp.dst_block_dims[i]);
+            transposeParams.outer_src_strides.push_back(jpp.src_strides[i]);
+            transposeParams.outer_dst_strides.push_back(jpp.dst_strides[i]);
+        }
+    }
+
+    transpose_kernel.reset(new jit_avx2_transpose_kernel_f32(jtp));
+}
+
+void MKLDNNPermuteNode::executeTranspose(const float* src_data, float* dst_data, int MB) {
+    const auto& tp = transposeParams;
+    const size_t tile = jit_transpose_conf_t::tile_size;
+    const size_t src_stride = transpose_kernel->jtp.src_stride;
+    const size_t dst_stride = transpose_kernel->jtp.dst_stride;
+
+    SizeVector outer_dims = tp.outer_dims;
+    if (tp.batch_outer)
+        outer_dims[0] = MB;
+    size_t outer_work = 1;
+    for (auto dim : outer_dims)
+        outer_work *= dim;
+
+    //  a work item is the part of b rows, which is read and written by cache lines
+    const size_t b_chunk = 8 * tile;
+    const size_t b_chunks = div_up(tp.b_dim, b_chunk);
+
+    auto copy = [&](const float* src, float* dst, size_t a_start, size_t a_end, size_t b_start, size_t b_end) {
+        for (size_t a = a_start; a < a_end; a++)
+            for (size_t b = b_start; b < b_end; b++)
+                dst[b * dst_stride + a] = src[a * src_stride + b];
+    };
+
+    parallel_for(outer_work * b_chunks, [&](size_t work) {
+        const size_t b_start = (work % b_chunks) * b_chunk;
+        const size_t b_end = std::min(b_start + b_chunk, tp.b_dim);
+        size_t outer = work / b_chunks;
+
+        size_t src_off = 0, dst_off = 0;
+        for (int i = static_cast<int>(outer_dims.size()) - 1; i >= 0; i--) {
+            const size_t idx = outer % outer_dims[i];
+            outer /= outer_dims[i];
+            src_off += idx * tp.outer_src_strides[i];
+            dst_off += idx * tp.outer_dst_strides[i];
+        }
+        const float* src = src_data + src_off;
+        float* dst = dst_data + dst_off;
+
+        const size_t b_tiles_end = b_start + (b_end - b_start) / tile * tile;
+        size_t a = 0;
+        for (; a + tile <= tp.a_dim; a += tile) {
+            if (b_tiles_end > b_start) {
+                auto arg = jit_args_transpose();
+                arg.src = src + a * src_stride + b_start;
+                arg.dst = dst + b_start * dst_stride + a;
+                arg.tiles = (b_tiles_end - b_start) / tile;
+                (*transpose_kernel)(&arg);
+            }
+            copy(src, dst, a, a + tile, b_tiles_end, b_end);
+        }
+        copy(src, dst, a, tp.a_dim, b_start, b_end);
+    });
 }
 
 static void permute_to_0231(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
@@ -877,6 +1091,15 @@ void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
 
+    if (transpose_kernel) {
+        auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData()) +
+                        srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+        auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData()) +
+                        dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+        executeTranspose(src_data, dst_data, batchToProcess());
+        return;
+    }
+
     if (prec == Precision::FP32) {
         for (const auto &impl : OptimizedCases) {
             if (impl.first == order && impl.second.isValidParams(batchToProcess(), srcMemPtr, dstMemPtr)) {
@@ -904,6 +1127,15 @@ void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
         }
 
         switch (jpp.n) {
+            case 0: {
+                //  all dims were merged to one
+                auto arg = jit_args_permute();
+                arg.src = src_data;
+                arg.dst = dst_data;
+
+                (*permute_kernel)(&arg);
+                break;
+            }
             case 1:
                 parallel_for(dst_dims[0], [&](int i0) {
                     auto arg = jit_args_permute();
@@ -41,6 +41,30 @@ struct jit_uni_permute_kernel {
     virtual ~jit_uni_permute_kernel() {}
 };
 
+struct jit_transpose_conf_t {
+    static constexpr size_t tile_size = 8;
+
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+struct jit_args_transpose {
+    const float* src;
+    float* dst;
+    size_t tiles;
+};
+
+struct jit_uni_transpose_kernel {
+    void (*ker_)(const jit_args_transpose *);
+
+    void operator()(const jit_args_transpose *args) { assert(ker_); ker_(args); }
+
+    jit_transpose_conf_t jtp;
+
+    explicit jit_uni_transpose_kernel(jit_transpose_conf_t jtp) : ker_(nullptr), jtp(jtp) {}
+    virtual ~jit_uni_transpose_kernel() {}
+};
+
 class MKLDNNPermuteNode : public MKLDNNNode {
 public:
     MKLDNNPermuteNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -60,6 +84,9 @@ public:
     }
 
 private:
+    void prepareTranspose(const jit_permute_conf_t& jpp);
+    void executeTranspose(const float* src_data, float* dst_data, int MB);
+
     InferenceEngine::SizeVector order;
     InferenceEngine::Precision prec;
 
@@ -74,6 +101,17 @@ private:
 
     static const std::multimap<InferenceEngine::SizeVector, PermuteImpl> OptimizedCases;
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
+
+    //  2D transpose of a (innermost in destination) and b (innermost in source) dims for each index of outer dims
+    struct TransposeParams {
+        size_t a_dim = 0;
+        size_t b_dim = 0;
+        InferenceEngine::SizeVector outer_dims;
+        InferenceEngine::SizeVector outer_src_strides;
+        InferenceEngine::SizeVector outer_dst_strides;
+        bool batch_outer = false;
+    } transposeParams;
+    std::shared_ptr<jit_uni_transpose_kernel> transpose_kernel;
 };
 
 }  // namespace MKLDNNPlugin
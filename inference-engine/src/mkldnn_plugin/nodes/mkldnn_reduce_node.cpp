@@ -1556,6 +1556,24 @@ void MKLDNNReduceNode::reduce_type(const uint8_t *in_ptr, uint8_t *out_ptr, size
 }
 
 void MKLDNNReduceNode::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
+    // reduced axes are the innermost ones (full tensor and last axes reductions), so every output element
+    // is reduced from a contiguous row of the source
+    const size_t src_dims5d[] = {IB, IC, ID, IH, IW};
+    const size_t dst_dims5d[] = {OB, OC, OD, OH, OW};
+    bool reduced_found = false, innermost = true;
+    for (int i = 4; i >= 0; i--) {
+        if (src_dims5d[i] != dst_dims5d[i])
+            reduced_found = true;
+        else if (src_dims5d[i] != 1 && reduced_found)
+            innermost = false;
+    }
+    if (reduced_found && innermost) {
+        const size_t rows = OB * OC * OD * OH * OW;
+        reduce_PLN_rows(in_ptr, out_ptr, rows, IB * IC * ID * IH * IW / rows);
+        reduce_kernel_post_process(out_ptr);
+        return;
+    }
+
     for (size_t ib = 0; ib < IB; ib++) {
         size_t ob = ReduceN ? 0 : ib; GET_PTR_N_PLN;
         if (!ReduceC && !ReduceD && ReduceH && ReduceW) {
@@ -1616,6 +1634,56 @@ void MKLDNNReduceNode::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
     reduce_kernel_post_process(out_ptr);
 }
 
+void MKLDNNReduceNode::reduce_PLN_rows(const uint8_t *in_ptr, uint8_t *out_ptr, size_t rows, size_t row_len) {
+    // rows shorter than this are not split between threads
+    const size_t min_part_len = 4096;
+    const size_t threads_num = static_cast<size_t>(parallel_get_max_threads());
+    size_t parts = 1;
+    if (output_prec == Precision::FP32 && rows < threads_num)
+        parts = std::min(div_up(threads_num, rows), row_len / min_part_len);
+
+    if (parts <= 1) {
+        parallel_for(rows, [&](size_t r) {
+            reduce_kernel_process(in_ptr + r * row_len * src_data_size, out_ptr + r * dst_data_size, row_len, 1);
+        });
+        return;
+    }
+
+    // each thread reduces its part of a row to a partial result, which are combined in the row order
+    partials.resize(rows * parts);
+    init_dst_data(reinterpret_cast<uint8_t *>(&partials[0]), partials.size() * sizeof(float));
+    const size_t part_len = div_up(row_len, parts);
+    parallel_for2d(rows, parts, [&](size_t r, size_t p) {
+        const size_t start = p * part_len;
+        if (start >= row_len)
+            return;
+        reduce_kernel_process(in_ptr + (r * row_len + start) * src_data_size, reinterpret_cast<uint8_t *>(&partials[r * parts + p]),
+                              std::min(part_len, row_len - start), 1);
+    });
+
+    auto out_p = reinterpret_cast<float *>(out_ptr);
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t p = 0; p < parts; p++)
+            out_p[r] = combine_partials(out_p[r], partials[r * parts + p]);
+    }
+}
+
+inline float MKLDNNReduceNode::combine_partials(float a, float b) const {
+    switch (reduceMode) {
+        case Reduce::And:
+        case Reduce::Min:
+            return std::min(a, b);
+        case Reduce::Or:
+        case Reduce::Max:
+            return std::max(a, b);
+        case Reduce::Prod:
+            return a * b;
+        default:
+            // sum based reductions accumulate |x|, x^2, exp(x) or x, the rest is done by the post kernel
+            return a + b;
+    }
+}
+
 void MKLDNNReduceNode::reduce_BLK(const uint8_t *in_ptr, uint8_t *out_ptr) {
     size_t ICB = div_up(IC, blk_size);
     size_t OCB = div_up(OC, blk_size);
@@ -90,6 +90,7 @@ public:
 private:
     void reduce_type(const uint8_t *in_ptr, uint8_t *out_ptr, size_t dst_size);
     void reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr);
+    void reduce_PLN_rows(const uint8_t *in_ptr, uint8_t *out_ptr, size_t rows, size_t row_len);
     void reduce_BLK(const uint8_t *in_ptr, uint8_t *out_ptr);
     void reduce_BLK_concern_padding(const uint8_t *in_ptr, uint8_t *out_ptr);
     inline void reduce_kernel_process(const uint8_t *in_p, uint8_t *out_p, size_t work_amount, size_t reduce_w = 2);
@@ -99,6 +100,7 @@ private:
     inline void reduce_ref(const float *in_ptr, float *out_ptr);
     void reduce_ref_process(const float *in_ptr, float *out_ptr, float init_value, std::function<float(float, float)> func);
     inline void reduce_ref_map(float *out_ptr, size_t work_amount_dst, size_t reduced_dims_work_amount);
+    inline float combine_partials(float a, float b) const;
 
     Reduce reduceMode = Reduce::Sum;
     size_t blk_size;
@@ -117,6 +119,8 @@ private:
     InferenceEngine::SizeVector src_strides;
     InferenceEngine::SizeVector process_dst_dims;
     InferenceEngine::SizeVector axes_for_reduction;
+    // results of parts of long rows reduced by different threads
+    std::vector<float> partials;
 
     std::shared_ptr<jit_uni_reduce_kernel> reduce_kernel;
     std::shared_ptr<jit_uni_reduce_post_kernel> reduce_post_kernel;
@@ -9,6 +9,7 @@
 #include <mkldnn.hpp>
 #include <string>
 #include <vector>
+#include <utility>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
@@ -393,11 +394,23 @@ void MKLDNNScatterUpdateNode::scatterUpdate(uint8_t *indices, uint8_t *update, i
     size_t blockToUpdate = srcBlockND[axis + 1];
     size_t blockToUpdateSize = blockToUpdate * dataSize;
 
-    parallel_for2d(batchToUpdate, idxLength, [&](size_t b, size_t idx) {
+    // consecutive indices (e.g. a range of positions in a cache) point to adjacent blocks in both tensors,
+    // so every such run is copied by a single memcpy
+    std::vector<std::pair<size_t, size_t>> idxRuns;  // first position in indices and length of the run
+    for (size_t idx = 0; idx < idxLength; idx++) {
+        int64_t idxValue = getIndicesValue(indices, idx);
+        if (idx > 0 && getIndicesValue(indices, idx - 1) + 1 == idxValue)
+            idxRuns.back().second++;
+        else
+            idxRuns.emplace_back(idx, 1);
+    }
+
+    parallel_for2d(batchToUpdate, idxRuns.size(), [&](size_t b, size_t r) {
+        size_t idx = idxRuns[r].first;
         int64_t idxValue = getIndicesValue(indices, idx);
         uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
         uint8_t *updateEntry = update + (b * updateBlockND[axis] + idx * blockToUpdate) * dataSize;
-        cpu_memcpy(dstEntry, updateEntry, blockToUpdateSize);
+        cpu_memcpy(dstEntry, updateEntry, idxRuns[r].second * blockToUpdateSize);
     });
 }
 
@@ -8,6 +8,10 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <cpu_isa_traits.hpp>
+#include <numeric>
+#include <functional>
+#include "common/softmax.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -57,9 +61,16 @@ void MKLDNNSoftMaxNode::getSupportedDescriptors() {
 }
 
 void MKLDNNSoftMaxNode::createPrimitive() {
-    if (prim)
+    if (prim || rowSoftmax)
         return;
 
+    const auto& dims = getParentEdgeAt(0)->getDims();
+    if (axis == dims.ndims() - 1 && MKLDNNMemory::GetPlainLayout(dims) == getParentEdgeAt(0)->getDesc().getLayout() &&
+            mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::sse42)) {
+        rowSoftmax = std::make_shared<SoftmaxGeneric>(Precision::FP32, Precision::FP32);
+        return;
+    }
+
     memory::desc in_candidate = getParentEdgeAt(0)->getMemory().GetDescriptor();
     MKLDNNDescriptor desc(std::shared_ptr<softmax_forward::desc>(
             new softmax_forward::desc(prop_kind::forward_scoring, in_candidate, axis)));
@@ -87,6 +98,21 @@ void MKLDNNSoftMaxNode::createPrimitive() {
                                 getChildEdgeAt(0)->getMemory().GetPrimitive()));
 }
 
+void MKLDNNSoftMaxNode::execute(mkldnn::stream strm) {
+    if (!rowSoftmax) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    const auto& dims = getParentEdgeAt(0)->getDesc().getDims();
+    int C = static_cast<int>(dims[axis]);
+    int B = static_cast<int>(std::accumulate(dims.begin(), dims.begin() + axis, static_cast<size_t>(1), std::multiplies<size_t>()));
+
+    auto src_data = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetData());
+    auto dst_data = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetData());
+    rowSoftmax->execute(src_data, dst_data, B, C, 1, 1);
+}
+
 bool MKLDNNSoftMaxNode::created() const {
     return getType() == SoftMax;
 }
@@ -10,6 +10,8 @@
 #include <memory>
 #include <vector>
 
+class SoftmaxGeneric;
+
 namespace MKLDNNPlugin {
 
 class MKLDNNSoftMaxNode : public MKLDNNNode {
@@ -23,9 +25,12 @@ public:
     void getSupportedDescriptors() override;
     void createPrimitive() override;
     bool created() const override;
+    void execute(mkldnn::stream strm) override;
 
 private:
     int axis = 0;
+    // used instead of the mkldnn primitive when softmax is computed over the innermost axis of a planar tensor
+    std::shared_ptr<SoftmaxGeneric> rowSoftmax;
 };
 
 }  // namespace MKLDNNPlugin
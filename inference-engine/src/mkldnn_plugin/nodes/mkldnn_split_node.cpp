@@ -183,11 +183,10 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    // Optimized inplace case
+    // Optimized inplace case: outputs are views of the input memory, which are strided for inner axes.
+    // Channel blocks of the outputs are aligned by construction of the blocked descriptors above.
     std::vector<size_t> pdIndexesToReuse(1, 0); // at least the first plain layout can be optimized inplace.
-    if (axis < 2) {
-        pdIndexesToReuse.insert(pdIndexesToReuse.end(), blockedPdIndexes.begin(), blockedPdIndexes.end());
-    }
+    pdIndexesToReuse.insert(pdIndexesToReuse.end(), blockedPdIndexes.begin(), blockedPdIndexes.end());
 
     for (auto refPdIndex : pdIndexesToReuse) {
         const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
@@ -9,8 +9,11 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -47,10 +50,67 @@ static InferenceEngine::LayerConfig make_plain_config(const InferenceEngine::CNN
     return config;
 }
 
+/**
+ * Body input memory may be pointed to another buffer only if no other body memory object refers to the same data.
+ * The rules are the same as for zero-copy network inputs in MKLDNNInferRequest.
+ * Returns memory of all the input edges or empty vector if the data can't be redirected.
+ */
+static std::vector<MKLDNNMemoryPtr> getRedirectableInputMemory(const MKLDNNNodePtr &input) {
+    std::vector<MKLDNNMemoryPtr> memory;
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto edge = input->getChildEdgeAt(i);
+        auto child = edge->getChild();
+        if (child->isConstant() || child->isInplace())
+            return {};
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return {};
+#endif
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+        if (dynamic_cast<MKLDNNSplitNode *>(child.get()))
+            return {};
+#endif
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    edge->getMemory().GetPrimitive().get_data_handle())
+                return {};
+        }
+        memory.push_back(edge->getMemoryPtr());
+    }
+    return memory;
+}
+
+/**
+ * Same as getRedirectableInputMemory for body output, the rules follow zero-copy network outputs.
+ */
+static std::vector<MKLDNNMemoryPtr> getRedirectableOutputMemory(const MKLDNNNodePtr &output) {
+    auto edge = output->getParentEdgeAt(0);
+    auto parent = edge->getParent();
+    if (parent->getType() == Input || parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+        return {};
+    for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+        if (parent->getParentEdgeAt(i)->getMemory().GetPrimitive().get_data_handle() ==
+                edge->getMemory().GetPrimitive().get_data_handle())
+            return {};
+    }
+    return {edge->getMemoryPtr()};
+}
+
+static void setDataHandle(const std::vector<MKLDNNMemoryPtr> &memory, void *data) {
+    for (const auto &mem : memory)
+        mem->GetPrimitivePtr()->set_data_handle(data);
+}
+
+/**
+ * Slices the full tensor along the axis. If the part memory can be redirected and a slice has the same
+ * physical layout as the part, the part memory is pointed directly to the slice, otherwise slice is copied.
+ */
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
-                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng) {
+                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng,
+                       const std::vector<MKLDNNMemoryPtr> &redirectable_part = {}) {
         const auto &full_blob = sliced_src ? from : to;
         const auto &part_blob = !sliced_src ? from : to;
 
@@ -84,7 +144,14 @@ public:
         chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
         chunk_stride_in_byte *= sign_of_stride;
 
-        if (sliced_src) {
+        // slice is a dense block when all the outer dimensions are 1
+        const bool dense_chunk = std::all_of(full_dims.begin(), full_dims.begin() + axis, [](ptrdiff_t dim) { return dim == 1; });
+        if (!redirectable_part.empty() && dense_chunk &&
+                full_blob->GetDataType() == part_blob->GetDataType() &&
+                full_blob->GetFormat() == MKLDNNMemory::GetPlainFormat(full_blob->GetDims()) &&
+                part_blob->GetFormat() == MKLDNNMemory::GetPlainFormat(part_blob->GetDims())) {
+            redirected_part = redirectable_part;
+        } else if (sliced_src) {
             reorders.emplace_back(chunk_mem_prim, to->GetPrimitive());
         } else {
             reorders.emplace_back(from->GetPrimitive(), chunk_mem_prim);
@@ -97,15 +164,26 @@ public:
         auto full_mem = mem_holder[FULL_DATA];
         auto chunk_mem = mem_holder[CHUNK_DATA];
 
-        chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                chunk_offset_in_byte + chunk_stride_in_byte * iter);
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter;
+
+        if (!redirected_part.empty()) {
+            setDataHandle(redirected_part, chunk_ptr);
+            return;
+        }
 
+        chunk_mem.set_data_handle(chunk_ptr);
         strm.submit({reorders.begin(), reorders.end()});
     }
 
+    bool isRedirected() const {
+        return !redirected_part.empty();
+    }
+
 private:
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
+    std::vector<MKLDNNMemoryPtr> redirected_part;
 
     const int FULL_DATA = 0;
     const int CHUNK_DATA = 1;
@@ -125,6 +203,27 @@ public:
     }
 };
 
+/**
+ * Back edge which swaps data of the body output and the body input instead of copying.
+ * Body output of an iteration becomes the body input of the next one and vice versa.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<MKLDNNMemoryPtr> &from, const std::vector<MKLDNNMemoryPtr> &to)
+        : from(from), to(to) {}
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter != 0) {
+            auto output_data = from.front()->GetPrimitive().get_data_handle();
+            setDataHandle(from, to.front()->GetPrimitive().get_data_handle());
+            setDataHandle(to, output_data);
+        }
+    }
+
+private:
+    std::vector<MKLDNNMemoryPtr> from, to;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -203,6 +302,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto &in_node = in_map.at(in_data->getName());
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
         input_mem.push_back(in_mem);
+        redirectable_input_mem.push_back(getRedirectableInputMemory(in_node));
     }
 
     // Assume that order of outputs in original TI and produces sub_graph is same
@@ -210,6 +310,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
     for (size_t i = 0; i < out_vec.size(); i++) {
         auto out_mem = out_vec[i]->getParentEdgeAt(0)->getMemoryPtr();
         output_mem.push_back(out_mem);
+        redirectable_output_mem.push_back(getRedirectableOutputMemory(out_vec[i]));
     }
 }
 
@@ -229,38 +330,80 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 
     const auto &eng = getEngine();
 
+    // special purpose ports
+    constexpr auto key_cur_iter_port = "loop_body_current_iteration_idx";
+    constexpr auto key_cond_port = "loop_body_condition_output_idx";
+    constexpr auto key_trip_count_port = "loop_trip_count_idx";
+    constexpr auto key_init_cond_port = "loop_execution_condition_idx";
+
+    // Body memory may be pointed to external data only if no other port writes to it through the same memory:
+    // sliced inputs are read-only views of the TI input, back edges swap the body input and output data
+    std::vector<int> sliced_inputs(input_mem.size()), initialized_inputs(input_mem.size());
+    std::vector<int> back_edge_inputs(input_mem.size()), iteration_inputs(input_mem.size());
+    std::vector<int> sliced_outputs(output_mem.size()), back_edge_outputs(output_mem.size());
+    for (const auto &map_rule : ti->input_port_map)
+        (map_rule.axis == -1 ? initialized_inputs : sliced_inputs)[map_rule.to]++;
+    for (const auto &map_rule : ti->output_port_map)
+        if (map_rule.axis != -1)
+            sliced_outputs[map_rule.to]++;
+    for (const auto &map_rule : ti->back_edges) {
+        back_edge_outputs[map_rule.from]++;
+        back_edge_inputs[map_rule.to]++;
+    }
+    for (auto idx : ti->GetParamAsInts(key_cur_iter_port, {}))
+        iteration_inputs[idx]++;
+
     for (auto map_rule : ti->input_port_map) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
+        } else {
+            bool redirect = sliced_inputs[map_rule.to] == 1 && initialized_inputs[map_rule.to] == 0 &&
+                            back_edge_inputs[map_rule.to] == 0 && iteration_inputs[map_rule.to] == 0;
+            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng,
+                    redirect ? redirectable_input_mem[map_rule.to] : std::vector<MKLDNNMemoryPtr>{}));
+        }
     }
 
+    // Redirected body outputs must be pointed to the slice before the iteration, but after back edges
+    // have read the previous iteration results
+    std::vector<std::shared_ptr<PortIteratorHelper>> redirected_outputs;
     for (auto map_rule : ti->output_port_map) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
+        } else {
+            bool redirect = sliced_outputs[map_rule.to] == 1;
+            std::shared_ptr<PortIteratorHelper> mapper(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng,
+                    redirect ? redirectable_output_mem[map_rule.to] : std::vector<MKLDNNMemoryPtr>{}));
+            if (mapper->isRedirected())
+                redirected_outputs.push_back(mapper);
+            else
+                after_mappers.push_back(mapper);
+        }
     }
 
     for (auto map_rule : ti->back_edges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        const auto &from_redirectable = redirectable_output_mem[map_rule.from];
+        const auto &to_redirectable = redirectable_input_mem[map_rule.to];
+        bool swap = sliced_outputs[map_rule.from] == 0 && back_edge_outputs[map_rule.from] == 1 &&
+                    sliced_inputs[map_rule.to] == 0 && back_edge_inputs[map_rule.to] == 1 && iteration_inputs[map_rule.to] == 0 &&
+                    !from_redirectable.empty() && !to_redirectable.empty() &&
+                    from_mem->GetPrimitiveDescriptor() == to_mem->GetPrimitiveDescriptor();
+        if (swap)
+            before_mappers.emplace_back(new BackEdgeSwapHelper(from_redirectable, to_redirectable));
+        else
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
     }
 
-    // special purpose ports
-    constexpr auto key_cur_iter_port = "loop_body_current_iteration_idx";
-    constexpr auto key_cond_port = "loop_body_condition_output_idx";
-    constexpr auto key_trip_count_port = "loop_trip_count_idx";
-    constexpr auto key_init_cond_port = "loop_execution_condition_idx";
+    before_mappers.insert(before_mappers.end(), redirected_outputs.begin(), redirected_outputs.end());
 
     auto iter_idx_ports = ti->GetParamAsInts(key_cur_iter_port, {});
     for (auto idx : iter_idx_ports) {
@@ -61,6 +61,8 @@ private:
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    /// Body memory which may be pointed to external data, empty if it must be copied
+    std::vector<std::vector<MKLDNNMemoryPtr>> redirectable_input_mem, redirectable_output_mem;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
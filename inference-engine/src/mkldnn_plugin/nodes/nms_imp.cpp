@@ -0,0 +1,86 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_imp.hpp"
+
+#include <algorithm>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+bool nms_box_suppressed(const float* x0, const float* y0, const float* x1, const float* y1, const float* areas,
+                        size_t num_boxes, const float* box, float box_area, float threshold, bool inclusive) {
+    size_t i = 0;
+
+#if defined(HAVE_AVX512F)
+    const __m512 vx0i = _mm512_set1_ps(box[0]);
+    const __m512 vy0i = _mm512_set1_ps(box[1]);
+    const __m512 vx1i = _mm512_set1_ps(box[2]);
+    const __m512 vy1i = _mm512_set1_ps(box[3]);
+    const __m512 vareai = _mm512_set1_ps(box_area);
+    const __m512 vthreshold = _mm512_set1_ps(threshold);
+    const __m512 vzero = _mm512_setzero_ps();
+
+    for (; i + 16 <= num_boxes; i += 16) {
+        __m512 vwidth = _mm512_sub_ps(_mm512_min_ps(vx1i, _mm512_loadu_ps(x1 + i)), _mm512_max_ps(vx0i, _mm512_loadu_ps(x0 + i)));
+        __m512 vheight = _mm512_sub_ps(_mm512_min_ps(vy1i, _mm512_loadu_ps(y1 + i)), _mm512_max_ps(vy0i, _mm512_loadu_ps(y0 + i)));
+        __m512 vintersection = _mm512_mul_ps(_mm512_max_ps(vwidth, vzero), _mm512_max_ps(vheight, vzero));
+
+        // IoU of boxes without intersection is set to 0 by the mask, their union may be 0
+        __mmask16 intersected = _mm512_cmp_ps_mask(vintersection, vzero, _CMP_GT_OS);
+        __m512 vunion = _mm512_sub_ps(_mm512_add_ps(vareai, _mm512_loadu_ps(areas + i)), vintersection);
+        __m512 viou = _mm512_maskz_div_ps(intersected, vintersection, vunion);
+
+        __mmask16 suppressed = inclusive ? _mm512_cmp_ps_mask(viou, vthreshold, _CMP_GE_OS)
+                                         : _mm512_cmp_ps_mask(viou, vthreshold, _CMP_GT_OS);
+        if (suppressed)
+            return true;
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 vx0i = _mm256_set1_ps(box[0]);
+    const __m256 vy0i = _mm256_set1_ps(box[1]);
+    const __m256 vx1i = _mm256_set1_ps(box[2]);
+    const __m256 vy1i = _mm256_set1_ps(box[3]);
+    const __m256 vareai = _mm256_set1_ps(box_area);
+    const __m256 vthreshold = _mm256_set1_ps(threshold);
+    const __m256 vzero = _mm256_setzero_ps();
+
+    for (; i + 8 <= num_boxes; i += 8) {
+        __m256 vwidth = _mm256_sub_ps(_mm256_min_ps(vx1i, _mm256_loadu_ps(x1 + i)), _mm256_max_ps(vx0i, _mm256_loadu_ps(x0 + i)));
+        __m256 vheight = _mm256_sub_ps(_mm256_min_ps(vy1i, _mm256_loadu_ps(y1 + i)), _mm256_max_ps(vy0i, _mm256_loadu_ps(y0 + i)));
+        __m256 vintersection = _mm256_mul_ps(_mm256_max_ps(vwidth, vzero), _mm256_max_ps(vheight, vzero));
+
+        // IoU of boxes without intersection is set to 0 by the mask, their union may be 0
+        __m256 vintersected = _mm256_cmp_ps(vintersection, vzero, _CMP_GT_OS);
+        __m256 vunion = _mm256_sub_ps(_mm256_add_ps(vareai, _mm256_loadu_ps(areas + i)), vintersection);
+        __m256 viou = _mm256_and_ps(_mm256_div_ps(vintersection, vunion), vintersected);
+
+        __m256 vsuppressed = inclusive ? _mm256_cmp_ps(viou, vthreshold, _CMP_GE_OS)
+                                       : _mm256_cmp_ps(viou, vthreshold, _CMP_GT_OS);
+        if (_mm256_movemask_ps(vsuppressed))
+            return true;
+    }
+#endif
+
+    for (; i < num_boxes; i++) {
+        const float width = (std::min)(box[2], x1[i]) - (std::max)(box[0], x0[i]);
+        const float height = (std::min)(box[3], y1[i]) - (std::max)(box[1], y0[i]);
+        const float intersection = (std::max)(width, 0.f) * (std::max)(height, 0.f);
+        const float iou = intersection > 0.f ? intersection / (box_area + areas[i] - intersection) : 0.f;
+        if (inclusive ? iou >= threshold : iou > threshold)
+            return true;
+    }
+
+    return false;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+namespace XARCH {
+
+/**
+ * Checks the box against boxes already selected by NMS, which are stored in planar layout: min and max coordinates
+ * along the first (x0, x1) and the second (y0, y1) axes and areas. The box is {x0, y0, x1, y1} with its area.
+ * IoU of boxes which don't intersect is 0. Returns true if IoU with any of the boxes is greater than the threshold,
+ * or equal to it for inclusive comparison.
+ */
+bool nms_box_suppressed(const float* x0, const float* y0, const float* x1, const float* y1, const float* areas,
+                        size_t num_boxes, const float* box, float box_area, float threshold, bool inclusive);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
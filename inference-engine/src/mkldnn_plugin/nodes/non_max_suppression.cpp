@@ -13,6 +13,7 @@
 #include <queue>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
+#include "nms_imp.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -256,11 +257,44 @@ public:
         });
     }
 
+    // converts boxes to corners in planar layout, so a box is compared with all selected boxes by SIMD code
+    void unpackBoxes(const float *boxes, const SizeVector &boxesStrides) {
+        unpackedBoxes.resize(num_batches * NMS_UNPACKED_SIZE * num_boxes);
+        parallel_for2d(num_batches, num_boxes, [&](size_t batch_idx, size_t box_idx) {
+            const float *box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+            float *unpacked = unpackedBoxes.data() + batch_idx * NMS_UNPACKED_SIZE * num_boxes + box_idx;
+            float ymin, xmin, ymax, xmax;
+            if (boxEncodingType == boxEncoding::CENTER) {
+                //  box format: x_center, y_center, width, height
+                ymin = box[1] - box[3] / 2.f;
+                xmin = box[0] - box[2] / 2.f;
+                ymax = box[1] + box[3] / 2.f;
+                xmax = box[0] + box[2] / 2.f;
+            } else {
+                //  box format: y1, x1, y2, x2
+                ymin = (std::min)(box[0], box[2]);
+                xmin = (std::min)(box[1], box[3]);
+                ymax = (std::max)(box[0], box[2]);
+                xmax = (std::max)(box[1], box[3]);
+            }
+            unpacked[0 * num_boxes] = ymin;
+            unpacked[1 * num_boxes] = xmin;
+            unpacked[2 * num_boxes] = ymax;
+            unpacked[3 * num_boxes] = xmax;
+            unpacked[4 * num_boxes] = (ymax - ymin) * (xmax - xmin);
+        });
+    }
+
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
                              std::vector<filteredBoxes> &filtBoxes) {
-        int max_out_box = static_cast<int>(max_output_boxes_per_class);
+        unpackBoxes(boxes, boxesStrides);
+
+        auto greater = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+            return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+        };
+
         parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const float *unpacked = unpackedBoxes.data() + batch_idx * NMS_UNPACKED_SIZE * num_boxes;
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
             std::vector<std::pair<float, int>> sorted_boxes;
@@ -269,29 +303,44 @@ public:
                     sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
             }
 
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                                });
-                int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
+            // selected boxes in the same planar layout as unpacked ones
+            const size_t max_out_box = (std::min)(max_output_boxes_per_class, sorted_boxes.size());
+            std::vector<float> selected(NMS_UNPACKED_SIZE * max_out_box);
+            float *selectedCoords[NMS_UNPACKED_SIZE];
+            for (size_t i = 0; i < NMS_UNPACKED_SIZE; i++)
+                selectedCoords[i] = selected.data() + i * max_out_box;
+
+            // Usually only a few best candidates are checked before max_out_box boxes are selected, so candidates
+            // are sorted by chunks of growing size: the next chunk is moved to the front by nth_element when
+            // the previous one is exhausted.
+            size_t sortedNum = 0;
+            size_t chunk = (std::max)(2 * max_out_box, static_cast<size_t>(64));
+
+            size_t io_selection_size = 0;
+            int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+            for (size_t candidate = 0; (candidate < sorted_boxes.size()) && (io_selection_size < max_out_box); candidate++) {
+                if (candidate == sortedNum) {
+                    auto chunkEnd = sorted_boxes.begin() + (std::min)(sortedNum + chunk, sorted_boxes.size());
+                    if (chunkEnd != sorted_boxes.end())
+                        std::nth_element(sorted_boxes.begin() + sortedNum, chunkEnd, sorted_boxes.end(), greater);
+                    std::sort(sorted_boxes.begin() + sortedNum, chunkEnd, greater);
+                    sortedNum = static_cast<size_t>(chunkEnd - sorted_boxes.begin());
+                    chunk *= 2;
+                }
 
-                    if (box_is_selected) {
-                        filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+                const int box_idx = sorted_boxes[candidate].second;
+                const float box[4] = {unpacked[0 * num_boxes + box_idx], unpacked[1 * num_boxes + box_idx],
+                                      unpacked[2 * num_boxes + box_idx], unpacked[3 * num_boxes + box_idx]};
+                const float box_area = unpacked[4 * num_boxes + box_idx];
+
+                if (!XARCH::nms_box_suppressed(selectedCoords[0], selectedCoords[1], selectedCoords[2], selectedCoords[3],
+                                               selectedCoords[4], io_selection_size, box, box_area, iou_threshold, true)) {
+                    for (size_t i = 0; i < 4; i++)
+                        selectedCoords[i][io_selection_size] = box[i];
+                    selectedCoords[4][io_selection_size] = box_area;
+
+                    filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[candidate].first, batch_idx, class_idx, box_idx);
+                    io_selection_size++;
                 }
             }
             numFiltBox[batch_idx][class_idx] = io_selection_size;
@@ -423,6 +472,9 @@ private:
     const size_t NMS_SELECTEDSCORES = 1;
     const size_t NMS_VALIDOUTPUTS = 2;
 
+    // ymin, xmin, ymax, xmax and area of unpacked boxes
+    static constexpr size_t NMS_UNPACKED_SIZE = 5;
+
     enum class boxEncoding {
         CORNER,
         CENTER
@@ -441,6 +493,7 @@ private:
     float scale;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    std::vector<float> unpackedBoxes;
     const std::string inType = "input", outType = "output";
     std::string logPrefix;
 
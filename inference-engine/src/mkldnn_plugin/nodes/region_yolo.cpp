@@ -277,8 +277,11 @@ public:
             mask = layer->GetParamAsInts("mask", {});
 
             jit_logistic_config_params jcp;
-            jcp.src_dt = jcp.dst_dt = output_prec;
-            jcp.src_data_size = jcp.dst_data_size = output_prec.size();
+            // activations read the input directly, so the activated channels aren't copied to the output before
+            jcp.src_dt = input_prec;
+            jcp.dst_dt = output_prec;
+            jcp.src_data_size = input_prec.size();
+            jcp.dst_data_size = output_prec.size();
 
             block_size = 1;
             if (mayiuse(cpu::avx512_common)) {
@@ -327,15 +330,21 @@ public:
         auto *dst_data = outputs[0]->buffer().as<uint8_t *>();
 
         try {
-            cpu_convert(src_data, dst_data, inputs[0]->getTensorDesc().getPrecision(), outputs[0]->getTensorDesc().getPrecision(), B * IC * IH * IW);
+            // every channel of the output is written once: box coordinates and confidences (and classes of Yolo v3)
+            // are activated, the rest of coordinates are copied, classes of Yolo v2 are written by softmax
+            if (IC * IH * IW != inputs_size)
+                cpu_convert(src_data, dst_data, input_prec, output_prec, B * IC * IH * IW);
 
             for (int b = 0; b < B; b++) {
                 for (int n = 0; n < num_; n++) {
                     size_t index = b * inputs_size + n * IW * IH * (classes + coords + 1);
-                    calculate_logistic(index, total_size, dst_data);
+                    calculate_logistic(index, total_size, src_data, dst_data);
+
+                    cpu_convert(src_data + input_prec.size() * (index + total_size), dst_data + output_prec.size() * (index + total_size),
+                                input_prec, output_prec, IW * IH * coords - total_size);
 
                     index = b * inputs_size + IW * IH * (n * (classes + coords + 1) + coords);
-                    calculate_logistic(index, end_index, dst_data);
+                    calculate_logistic(index, end_index, src_data, dst_data);
                 }
             }
 
@@ -392,7 +401,8 @@ private:
     }
 
 
-    inline void calculate_logistic(size_t start_index, int count, uint8_t * dst_data) {
+    inline void calculate_logistic(size_t start_index, int count, const uint8_t * src_data, uint8_t * dst_data) {
+        auto src_data_size = input_prec.size();
         auto dst_data_size = output_prec.size();
         if (logistic_kernel) {
             int blocks_num = MKLDNNPlugin::div_up(count, block_size);
@@ -401,12 +411,14 @@ private:
                 int work_amount = std::min(count - idx, block_size);
 
                 auto arg = jit_args_logistic();
-                arg.src = arg.dst = dst_data + dst_data_size * (start_index + idx);
+                arg.src = src_data + src_data_size * (start_index + idx);
+                arg.dst = dst_data + dst_data_size * (start_index + idx);
                 arg.work_amount = static_cast<size_t>(work_amount);
 
                 (*logistic_kernel)(&arg);
             });
         } else {
+            cpu_convert(src_data + src_data_size * start_index, dst_data + dst_data_size * start_index, input_prec, output_prec, count);
             if (Precision::FP32 == output_prec) {
                 auto float_dst_data = reinterpret_cast<float*>(dst_data);
                 for (int i = 0; i < count; i++) {
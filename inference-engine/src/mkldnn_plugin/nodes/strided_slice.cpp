@@ -344,20 +344,31 @@ void StridedSliceImpl::strided_slice_vp(Blob::Ptr& input, Blob::Ptr& output) {
     size_t dataSize = input->getTensorDesc().getPrecision().size();
     const uint8_t* src_data = input->cbuffer().as<const uint8_t*>() + input->getTensorDesc().getBlockingDesc().getOffsetPadding() * dataSize;
     uint8_t* dst_data = output->buffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding() * dataSize;
-    auto dst_size = output->byteSize();
-    memset(dst_data, 0, dst_size);
+    //  The whole output is written by the copy, so it isn't zeroed
+
+    //  Inner dims which are taken entirely are merged with the sliced one, so the copied block is contiguous
+    //  in both tensors. Merging stops when there are not enough blocks for all threads.
+    size_t blockAxis = dst_dims.size() - 1;
+    size_t work_amount_dst = dstStrides[0] * dst_dims[0] / dst_dims[blockAxis];
+    while (blockAxis > 0 && dst_dims[blockAxis] == src_dims[blockAxis] && stride_dms[blockAxis - 1] == 1 &&
+           work_amount_dst / dst_dims[blockAxis - 1] >= static_cast<size_t>(parallel_get_max_threads())) {
+        blockAxis--;
+        work_amount_dst /= dst_dims[blockAxis];
+    }
+    size_t len = dataSize;
+    size_t block_src_idx = 0;
+    for (size_t j = blockAxis; j < dst_dims.size(); j++) {
+        len *= dst_dims[j];
+        block_src_idx += begin_dms[j] * srcStrides[j];
+    }
 
     //  Vectorized copy
-    size_t dims_size_1 = dst_dims.size() - 1;
-    size_t len = dst_dims[dims_size_1] * dataSize;
-    size_t work_amount_dst = dstStrides[0] * dst_dims[0] / dst_dims[dims_size_1];
-
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
-        SizeVector counters(dims_size_1, 0);
+        SizeVector counters(blockAxis, 0);
         splitter(work_amount_dst, nthr, ithr, start, end);
-        size_t src_idx = begin_dms[dims_size_1];
-        for (int j = dims_size_1 - 1, i = start; j >= 0; j--) {
+        size_t src_idx = block_src_idx;
+        for (int j = static_cast<int>(blockAxis) - 1, i = start; j >= 0; j--) {
             counters[j] = i % dst_dims[j];
             src_idx += (begin_dms[j] + counters[j] * stride_dms[j]) * srcStrides[j];
             i /= dst_dims[j];
@@ -365,7 +376,7 @@ void StridedSliceImpl::strided_slice_vp(Blob::Ptr& input, Blob::Ptr& output) {
 
         for (size_t iwork = start, dst_idx = start * len, i = 1; iwork < end; ++iwork, dst_idx += len) {
             cpu_memcpy(&dst_data[dst_idx], &src_data[src_idx * dataSize], len);
-            for (int j = dims_size_1 - 1; j >= 0; j--) {
+            for (int j = static_cast<int>(blockAxis) - 1; j >= 0; j--) {
                 counters[j]++;
                 if (counters[j] < dst_dims[j]) {
                     src_idx += stride_dms[j] * srcStrides[j];
@@ -375,7 +386,7 @@ void StridedSliceImpl::strided_slice_vp(Blob::Ptr& input, Blob::Ptr& output) {
                 }
             }
             if (!i) {
-                for (src_idx = begin_dms[dims_size_1]; i < dims_size_1; ++i)
+                for (src_idx = block_src_idx; i < blockAxis; ++i)
                     src_idx += (begin_dms[i] + counters[i] * stride_dms[i]) * srcStrides[i];
             }
         }
@@ -7,9 +7,12 @@
 #include <cmath>
 #include <limits>
 #include <cfloat>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 #include <functional>
 #include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
@@ -445,6 +448,156 @@ public:
         });
     }
 
+    // maps values to unsigned integers, so the best value has the largest key
+    inline uint32_t radixKey(float value) const {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        // -0 is equal to 0
+        if ((bits & 0x7fffffffu) == 0)
+            bits = 0;
+        bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        return mode_max ? bits : ~bits;
+    }
+
+    // Finds positions of k largest of n keys. The k-th key is found by 11, 11 and 10 bits with histograms, each next
+    // pass counts only the keys with the same higher bits. Positions are stored in ascending order, equal keys are
+    // selected in the order of positions as by insertion sort.
+    static void radixSelect(const uint32_t* keys, int n, int k, int* selected, std::vector<int>& candidates) {
+        const int shifts[] = {21, 10, 0};
+        const int bits[] = {11, 11, 10};
+        int histogram[1 << 11];
+
+        uint32_t prefix = 0, prefixMask = 0;
+        // number of keys equal to the prefix to select
+        int remaining = k;
+        for (int pass = 0; pass < 3; pass++) {
+            const int shift = shifts[pass];
+            const uint32_t digitMask = (1u << bits[pass]) - 1;
+            std::fill(histogram, histogram + digitMask + 1, 0);
+            if (pass == 0) {
+                for (int i = 0; i < n; i++)
+                    histogram[keys[i] >> shift]++;
+            } else {
+                for (int i : candidates)
+                    histogram[(keys[i] >> shift) & digitMask]++;
+            }
+
+            uint32_t digit = digitMask;
+            while (histogram[digit] < remaining) {
+                remaining -= histogram[digit];
+                digit--;
+            }
+            prefix |= digit << shift;
+            prefixMask |= digitMask << shift;
+
+            if (pass == 0) {
+                candidates.clear();
+                for (int i = 0; i < n; i++) {
+                    if ((keys[i] & prefixMask) == prefix)
+                        candidates.push_back(i);
+                }
+            } else {
+                candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                                [&](int i) { return (keys[i] & prefixMask) != prefix; }),
+                                 candidates.end());
+            }
+        }
+
+        // prefix is the k-th key now
+        int count = 0;
+        for (int i = 0; i < n && count < k; i++) {
+            if (keys[i] > prefix) {
+                selected[count++] = i;
+            } else if (keys[i] == prefix && remaining > 0) {
+                selected[count++] = i;
+                remaining--;
+            }
+        }
+    }
+
+    // Top k by radix select for large k, when insertion sort of k values is slower than a few passes over the axis.
+    // Only the selected values are sorted then.
+    void topk_radix(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+        const int after_num = count(in_dims, axis + 1, in_dims.size());
+        const int rows = before_num * after_num;
+
+        // When there are not enough rows to load all threads, the axis is split to chunks and top k values of chunks
+        // are selected in parallel, then they are merged.
+        int chunks = 1;
+        const int threads = parallel_get_max_threads();
+        if (rows < threads)
+            chunks = (std::max)(1, (std::min)(threads / rows, dim / (std::max)(src_k, radix_select_min_chunk)));
+
+        std::vector<int> chunk_selected;
+        if (chunks > 1) {
+            chunk_selected.resize(static_cast<size_t>(rows) * chunks * src_k);
+            parallel_for2d(rows, chunks, [&](int row, int chunk) {
+                int start = 0, end = 0;
+                splitter(dim, chunks, chunk, start, end);
+                const float* src = src_data + (row / after_num) * dim * after_num + row % after_num + start * after_num;
+
+                std::vector<uint32_t> keys(end - start);
+                for (int i = 0; i < end - start; i++)
+                    keys[i] = radixKey(src[i * after_num]);
+
+                int* selected = &chunk_selected[(static_cast<size_t>(row) * chunks + chunk) * src_k];
+                std::vector<int> candidates;
+                radixSelect(keys.data(), end - start, src_k, selected, candidates);
+                for (int i = 0; i < src_k; i++)
+                    selected[i] += start;
+            });
+        }
+
+        parallel_for(rows, [&](int row) {
+            const int i0 = row / after_num;
+            const int i1 = row % after_num;
+            const float* src = src_data + i0 * dim * after_num + i1;
+
+            std::vector<int> selected(src_k);
+            std::vector<int> candidates;
+            if (chunks > 1) {
+                // positions selected in chunks are in ascending order, so ties are still resolved by positions
+                const int* positions = &chunk_selected[static_cast<size_t>(row) * chunks * src_k];
+                std::vector<uint32_t> keys(chunks * src_k);
+                for (int i = 0; i < chunks * src_k; i++)
+                    keys[i] = radixKey(src[positions[i] * after_num]);
+                radixSelect(keys.data(), chunks * src_k, src_k, selected.data(), candidates);
+                for (int i = 0; i < src_k; i++)
+                    selected[i] = positions[selected[i]];
+            } else {
+                std::vector<uint32_t> keys(dim);
+                for (int i = 0; i < dim; i++)
+                    keys[i] = radixKey(src[i * after_num]);
+                radixSelect(keys.data(), dim, src_k, selected.data(), candidates);
+            }
+
+            if (sort_value) {
+                std::sort(selected.begin(), selected.end(), [&](int l, int r) {
+                    const uint32_t lkey = radixKey(src[l * after_num]);
+                    const uint32_t rkey = radixKey(src[r * after_num]);
+                    return lkey > rkey || (lkey == rkey && l < r);
+                });
+            }
+
+            for (int i2 = 0; i2 < src_k; i2++) {
+                const int dst_index = (i0 * src_k + i2) * after_num + i1;
+                if (dst_data)
+                    dst_data[dst_index] = src[selected[i2] * after_num];
+                if (dst_idx)
+                    dst_idx[dst_index] = selected[i2];
+            }
+        });
+    }
+
+    bool useRadixSelect() const {
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        // blocked SIMD implementation processes a few rows at once
+        if (!is_last_dim && src_k < count_vec)
+            return false;
+#endif
+        return src_k >= radix_select_min_k;
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -511,6 +664,8 @@ public:
                 else
                     top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
             }
+        } else if (useRadixSelect()) {
+            topk_radix(src, dst_data, dst_idx, in_dims);
         } else {
             if (is_last_dim) {
                 if (mode_max)
@@ -547,6 +702,10 @@ private:
 
     int dim, before_num;
 
+    const int radix_select_min_k = 16;
+    // minimal length of the axis chunk processed by a thread
+    const int radix_select_min_chunk = 4096;
+
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
 #elif defined(HAVE_SSE) || defined(HAVE_AVX2)
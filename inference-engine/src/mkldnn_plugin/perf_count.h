@@ -4,21 +4,34 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 
 namespace MKLDNNPlugin {
 
 class PerfCount {
     uint64_t duration;
     uint32_t num;
+    uint64_t parallelOverhead;
+    uint64_t minDuration;
+    uint64_t maxDuration;
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
 public:
-    PerfCount(): duration(0), num(0) {}
+    PerfCount(): duration(0), num(0), parallelOverhead(0), minDuration(0), maxDuration(0) {}
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    uint64_t minimum() { return minDuration; }
+    uint64_t maximum() { return maxDuration; }
+    // average time of parallel regions not spent by their longest thread
+    uint64_t avgParallelOverhead() { return (num == 0) ? 0 : parallelOverhead / num; }
+
+    void addParallelOverhead(uint64_t overhead_ns) {
+        parallelOverhead += overhead_ns / 1000;
+    }
 
 private:
     void start_itr() {
@@ -28,7 +41,10 @@ private:
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        uint64_t itrDuration = std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        minDuration = (num == 0) ? itrDuration : std::min(minDuration, itrDuration);
+        maxDuration = std::max(maxDuration, itrDuration);
+        duration += itrDuration;
         num++;
     }
 
@@ -37,11 +53,16 @@ private:
 
 class PerfHelper {
     PerfCount &counter;
+    bool enabled;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, bool enabled = true): counter(count), enabled(enabled) {
+        if (enabled) counter.start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        if (enabled) counter.finish_itr();
+    }
 };
 
 }  // namespace MKLDNNPlugin
@@ -37,6 +37,7 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
                // by default, no preferred device:
                _multiDeviceExecutableNetwork->_thisPreferredDeviceName = "";
+               _multiDeviceExecutableNetwork->_thisDeadline = GetDeadline();
                // if any input is remote (e.g. was set with SetBlob), let' use the corresponding device
                for (const auto &it : _multiDeviceExecutableNetwork->GetInputsInfo()) {
                    Blob::Ptr b;
@@ -66,6 +67,11 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         {
          /*TaskExecutor*/ _multiDeviceExecutableNetwork, /*task*/ [this] {
                _workerInferRequest = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
+               // the scheduler drops the request that can not start before the deadline without a worker request
+               if (nullptr == _workerInferRequest) {
+                   THROW_IE_EXCEPTION << InferenceEngine::details::as_status << InferenceEngine::StatusCode::INFER_DEADLINE_EXPIRED
+                                      << "The request was not started before its deadline";
+               }
                _inferRequest->SetBlobsToAnotherRequest(_workerInferRequest->_inferRequest);
         }},
         // final task in the pipeline:
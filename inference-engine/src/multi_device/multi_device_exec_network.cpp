@@ -3,7 +3,10 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <mutex>
+#include <chrono>
+#include <limits>
 #include <string>
 #include <vector>
 #include <memory>
@@ -27,6 +30,20 @@ namespace MultiDevicePlugin {
 thread_local MultiDeviceExecutableNetwork::WorkerInferRequest* MultiDeviceExecutableNetwork::_thisWorkerInferRequest = nullptr;
 // TODO: revert to the plain variable (see header file), when we moved to the next CentOS 8.x in our support matrix
 thread_local const char* MultiDeviceExecutableNetwork::_thisPreferredDeviceName = "";
+thread_local MultiDeviceExecutableNetwork::Time MultiDeviceExecutableNetwork::_thisDeadline = {};
+
+int ParseRequestDeadline(const std::string& value) {
+    int deadline = -1;
+    try {
+        deadline = std::stoi(value);
+    } catch (const std::exception&) {
+    }
+    if (deadline < 0) {
+        THROW_IE_EXCEPTION << "Unsupported value " << value << " for the " << PluginConfigParams::KEY_REQUEST_DEADLINE
+                           << " key of the MULTI device. Expected only non negative integer numbers";
+    }
+    return deadline;
+}
 
 struct IdleGuard {
     explicit IdleGuard(MultiDeviceExecutableNetwork::WorkerInferRequest* workerInferRequestPtr,
@@ -55,103 +72,428 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
     _devicePriorities{networkDevices},
     _devicePrioritiesInitial{networkDevices},
-    _networksPerDevice{networksPerDevice},
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
-    for (auto&& networkValue : _networksPerDevice) {
-        auto& device  = networkValue.first;
-        auto& network = networkValue.second;
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itPolicy != _config.end() &&
+        itPolicy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_EXPECTED_COMPLETION_TIME) {
+        _schedulingPolicy = SchedulingPolicy::ExpectedCompletionTime;
+    }
+    auto itAdaptive = _config.find(MultiDeviceConfigParams::KEY_MULTI_ADAPTIVE_NUM_REQUESTS);
+    _adaptiveNumRequests = itAdaptive != _config.end() && itAdaptive->second.as<std::string>() == PluginConfigParams::YES;
+    auto itDeadline = _config.find(PluginConfigParams::KEY_REQUEST_DEADLINE);
+    if (itDeadline != _config.end()) {
+        _requestDeadline = ParseRequestDeadline(itDeadline->second.as<std::string>());
+    }
+    // the per-device containers are created for all the devices beforehand, so the devices loaded later
+    // (MULTI_EARLY_START) do not modify the maps while the requests are scheduled
+    for (auto&& device : _devicePrioritiesInitial) {
+        _idleWorkerRequests[device.deviceName];
+        _inferPipelineTasksDeviceSpecific[device.deviceName] = std::unique_ptr<ThreadSafeQueue<PipelineTask>>(new ThreadSafeQueue<PipelineTask>);
+        _statistics[device.deviceName];
+    }
+    for (auto&& networkValue : networksPerDevice) {
+        AddDevice(networkValue.first, networkValue.second);
+    }
+}
 
-        auto itNumRequests = std::find_if(_devicePriorities.cbegin(), _devicePriorities.cend(),
-                [&device](const DeviceInformation& d){ return d.deviceName == device;});
-        unsigned int optimalNum = 0;
-        try {
-            optimalNum = network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
-        } catch (const InferenceEngine::details::InferenceEngineException &iie) {
-            THROW_IE_EXCEPTION
-                    << "Every device used with the Multi-Device should "
-                    << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
-                    << "Failed to query the metric for the " << device << " with error:" << iie.what();
-        }
-        const auto numRequests = (_devicePriorities.end() == itNumRequests ||
-            itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
+void MultiDeviceExecutableNetwork::AddDevice(const DeviceName& device, const ExecutableNetwork& network) {
+    auto itNumRequests = std::find_if(_devicePrioritiesInitial.cbegin(), _devicePrioritiesInitial.cend(),
+            [&device](const DeviceInformation& d){ return d.deviceName == device;});
+    unsigned int optimalNum = 0;
+    try {
+        optimalNum = network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    } catch (const InferenceEngine::details::InferenceEngineException &iie) {
+        THROW_IE_EXCEPTION
+                << "Every device used with the Multi-Device should "
+                << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                << "Failed to query the metric for the " << device << " with error:" << iie.what();
+    }
+    const auto numRequests = (_devicePrioritiesInitial.end() == itNumRequests ||
+        itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _networksPerDevice[device] = network;
+    }
+    std::size_t maxNumRequests = 0;
+    {
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        auto& statistics = _statistics.at(device);
+        statistics._numRequests = numRequests;
+        statistics._numActiveRequests = numRequests;
+        statistics._minNumRequests = 1;
+        statistics._maxNumRequests = _adaptiveNumRequests ? std::max<std::size_t>(2 * numRequests, 1) : numRequests;
+        statistics._windowStart = std::chrono::steady_clock::now();
+        maxNumRequests = statistics._maxNumRequests;
+    }
+    auto& idleWorkerRequests = _idleWorkerRequests.at(device);
+    // the queue is closed until the device is loaded, so no one uses it concurrently with the capacity setting
+    idleWorkerRequests.set_capacity(maxNumRequests);
+    for (std::size_t i = 0; i < numRequests; ++i) {
+        IE_ASSERT(idleWorkerRequests.try_push(CreateWorkerRequest(device)) == true);
+    }
+    // picking up the tasks that were queued while the device was loading
+    for (std::size_t i = 0; i < numRequests; ++i) {
+        ScheduleWaitingTask(device);
+    }
+}
+
+MultiDeviceExecutableNetwork::WorkerInferRequest* MultiDeviceExecutableNetwork::CreateWorkerRequest(const DeviceName& device) {
+    auto network = [&] {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _networksPerDevice.at(device);
+    }();
+    auto inferRequest = network.CreateInferRequest();
+    WorkerInferRequest* workerRequestPtr = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_workerRequestsMutex);
         auto& workerRequests = _workerRequests[device];
-        auto& idleWorkerRequests = _idleWorkerRequests[device];
-        workerRequests.resize(numRequests);
-        _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
-        auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
-        idleWorkerRequests.set_capacity(numRequests);
-        for (auto&& workerRequest : workerRequests) {
-            workerRequest._inferRequest = network.CreateInferRequest();
-            auto* workerRequestPtr = &workerRequest;
-            IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
-            workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
-                    IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
-                    workerRequestPtr->_status = status;
-                    {
-                        auto capturedTask = std::move(workerRequestPtr->_task);
-                        capturedTask();
-                    }
-                    // try to return the request to the idle list (fails if the overall object destruction has began)
-                    if (idleGuard.Release()->try_push(workerRequestPtr)) {
-                        // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
-                        // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
-                        Task t;
-                        if (_inferPipelineTasks.try_pop(t))
-                            ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
-                            ScheduleToWorkerInferRequest(std::move(t), device);
+        workerRequests.emplace_back();
+        workerRequestPtr = &workerRequests.back();
+    }
+    workerRequestPtr->_inferRequest = inferRequest;
+    auto* idleWorkerRequestsPtr = &(_idleWorkerRequests.at(device));
+    workerRequestPtr->_inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+        [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+            IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
+            workerRequestPtr->_status = status;
+            {
+                const auto latency = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count();
+                std::lock_guard<std::mutex> lock(_statisticsMutex);
+                auto& statistics = _statistics.at(device);
+                if (StatusCode::OK == status) {
+                    constexpr double latencyWeight = 0.25;
+                    statistics._latency = (statistics._latency == 0.0) ? latency :
+                        latencyWeight * latency + (1.0 - latencyWeight) * statistics._latency;
+                    if (_adaptiveNumRequests)
+                        UpdateNumRequests(statistics);
+                }
+                statistics._numBusyRequests--;
+            }
+            {
+                auto capturedTask = std::move(workerRequestPtr->_task);
+                capturedTask();
+            }
+            if (_adaptiveNumRequests) {
+                bool park = false, grow = false;
+                {
+                    std::lock_guard<std::mutex> lock(_statisticsMutex);
+                    auto& statistics = _statistics.at(device);
+                    park = statistics._numActiveRequests > statistics._numRequests;
+                    if (park) {
+                        statistics._numActiveRequests--;
+                        _parkedWorkerRequests[device].push_back(workerRequestPtr);
                     }
-                });
+                    grow = statistics._numActiveRequests < statistics._numRequests;
+                }
+                if (park) {
+                    // the pool is shrunk, so the request does not return to the idle list
+                    idleGuard.Release();
+                    return;
+                }
+                if (grow)
+                    AddWorkerRequests(device);
+            }
+            // try to return the request to the idle list (fails if the overall object destruction has began)
+            if (idleGuard.Release()->try_push(workerRequestPtr)) {
+                ScheduleWaitingTask(device);
+            }
+        });
+    return workerRequestPtr;
+}
+
+void MultiDeviceExecutableNetwork::ScheduleWaitingTask(const DeviceName& device) {
+    // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
+    // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
+    // the tasks of the requests that missed their deadlines while waiting are dropped and the next task is tried
+    PipelineTask t;
+    while (true) {
+        DeviceName preferredDevice;
+        if (!_inferPipelineTasks.try_pop(t)) {
+            if (!_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(_statisticsMutex);
+                _statistics.at(device)._numQueuedTasks--;
+            }
+            preferredDevice = device;
+        }
+        if (Time{} != t._deadline && std::chrono::steady_clock::now() > t._deadline) {
+            DropPipelineTask(t);
+            continue;
+        }
+        ScheduleToWorkerInferRequest(std::move(t), preferredDevice);
+        return;
+    }
+}
+
+void MultiDeviceExecutableNetwork::DropPipelineTask(PipelineTask& inferPipelineTask) {
+    // the task that runs without a worker request completes the request with the INFER_DEADLINE_EXPIRED status
+    _thisWorkerInferRequest = nullptr;
+    auto capturedTask = std::move(inferPipelineTask._task);
+    capturedTask();
+}
+
+// Hill climbing over the number of the device worker requests, called under the _statisticsMutex on every completion.
+// The pool grows while the tasks wait for the requests and the growth improves the throughput,
+// and shrinks while some of the requests stay unused.
+void MultiDeviceExecutableNetwork::UpdateNumRequests(DeviceStatistics& statistics) {
+    constexpr std::size_t windowSizePerRequest = 8;
+    constexpr double minThroughputGain = 0.05;
+
+    if (++statistics._windowCompletions < windowSizePerRequest * statistics._numRequests) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration<double, std::milli>(now - statistics._windowStart).count();
+    const auto throughput = elapsed > 0.0 ? statistics._windowCompletions / elapsed : 0.0;
+
+    int resize = 0;
+    if (statistics._lastResize > 0 && throughput < statistics._lastThroughput * (1.0 + minThroughputGain)) {
+        // the previous growth did not pay off: the device is saturated, so revert and do not try to grow further
+        resize = -1;
+        statistics._maxNumRequests = statistics._numRequests - 1;
+    } else if (statistics._windowQueuedTasks > statistics._windowCompletions / 2 &&
+               statistics._windowMaxBusyRequests >= statistics._numRequests &&
+               statistics._numRequests < statistics._maxNumRequests) {
+        resize = 1;
+    } else if (statistics._windowQueuedTasks == 0 &&
+               statistics._windowMaxBusyRequests < statistics._numRequests &&
+               statistics._numRequests > statistics._minNumRequests) {
+        resize = -1;
+    }
+
+    statistics._numRequests += resize;
+    statistics._lastResize = resize;
+    statistics._lastThroughput = throughput;
+    statistics._windowCompletions = 0;
+    statistics._windowQueuedTasks = 0;
+    statistics._windowMaxBusyRequests = statistics._numBusyRequests;
+    statistics._windowStart = now;
+}
+
+void MultiDeviceExecutableNetwork::AddWorkerRequests(const DeviceName& device) {
+    while (true) {
+        WorkerInferRequest* workerRequestPtr = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(_statisticsMutex);
+            auto& statistics = _statistics.at(device);
+            if (statistics._numActiveRequests >= statistics._numRequests) {
+                return;
+            }
+            statistics._numActiveRequests++;
+            auto& parkedWorkerRequests = _parkedWorkerRequests[device];
+            if (!parkedWorkerRequests.empty()) {
+                workerRequestPtr = parkedWorkerRequests.back();
+                parkedWorkerRequests.pop_back();
+            }
         }
+        if (nullptr == workerRequestPtr) {
+            try {
+                workerRequestPtr = CreateWorkerRequest(device);
+            } catch (const InferenceEngine::details::InferenceEngineException&) {
+                // the device can not afford more requests, so the current number is the upper bound
+                std::lock_guard<std::mutex> lock(_statisticsMutex);
+                auto& statistics = _statistics.at(device);
+                statistics._numActiveRequests--;
+                statistics._numRequests = statistics._maxNumRequests = statistics._numActiveRequests;
+                return;
+            }
+        }
+        if (!_idleWorkerRequests.at(device).try_push(workerRequestPtr)) {
+            return;
+        }
+        ScheduleWaitingTask(device);
+    }
+}
+
+bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
+                                                   NotBusyWorkerRequests& idleWorkerRequests,
+                                                   const DeviceName& device) {
+    WorkerInferRequest* workerRequestPtr = nullptr;
+    if (idleWorkerRequests.try_pop(workerRequestPtr)) {
+        IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
+        _thisWorkerInferRequest = workerRequestPtr;
+        workerRequestPtr->_startTime = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(_statisticsMutex);
+            auto& statistics = _statistics.at(device);
+            statistics._numBusyRequests++;
+            statistics._windowMaxBusyRequests = std::max(statistics._windowMaxBusyRequests, statistics._numBusyRequests);
+        }
+        try {
+            auto capturedTask = std::move(inferPipelineTask);
+            capturedTask();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_statisticsMutex);
+            _statistics.at(device)._numBusyRequests--;
+            throw;
+        }
+        idleGuard.Release();
+        return true;
     }
+    return false;
 }
 
-void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
+double MultiDeviceExecutableNetwork::ExpectedCompletionTime(const DeviceStatistics& statistics) const {
+    // the task has to wait for (pending / numRequests) full "waves" of the device requests before it starts,
+    // for the device that has not completed any request yet only the idle requests are considered
+    const auto pending = statistics._numBusyRequests + statistics._numQueuedTasks;
+    return (statistics._latency == 0.0) ?
+        (pending < statistics._numRequests ? 0.0 : std::numeric_limits<double>::max()) :
+        statistics._latency * static_cast<double>(pending / statistics._numRequests + 1);
+}
+
+DeviceName MultiDeviceExecutableNetwork::SelectDeviceByExpectedCompletionTime(const std::vector<DeviceInformation>& devices) {
+    std::lock_guard<std::mutex> lock(_statisticsMutex);
+    DeviceName bestDevice;
+    auto bestTime = std::numeric_limits<double>::max();
+    for (auto&& device : devices) {
+        const auto& statistics = _statistics.at(device.deviceName);
+        if (statistics._numRequests == 0) {
+            continue;
+        }
+        const auto expectedTime = ExpectedCompletionTime(statistics);
+        // strict comparison keeps the DEVICE_PRIORITIES order for the equal estimations
+        if (expectedTime < bestTime) {
+            bestTime = expectedTime;
+            bestDevice = device.deviceName;
+        }
+    }
+    return bestDevice;
+}
+
+// The first device (in the DEVICE_PRIORITIES order) that is expected to complete the task in the time left,
+// or the device with the smallest expected completion time if no device is expected to make it.
+DeviceName MultiDeviceExecutableNetwork::SelectDeviceByDeadline(const std::vector<DeviceInformation>& devices,
+                                                                double timeLeft, double& expectedStartTime) {
+    std::lock_guard<std::mutex> lock(_statisticsMutex);
+    DeviceName bestDevice;
+    auto bestTime = std::numeric_limits<double>::max();
+    expectedStartTime = std::numeric_limits<double>::max();
+    for (auto&& device : devices) {
+        const auto& statistics = _statistics.at(device.deviceName);
+        if (statistics._numRequests == 0) {
+            continue;
+        }
+        const auto expectedTime = ExpectedCompletionTime(statistics);
+        const auto startTime = (expectedTime == std::numeric_limits<double>::max()) ?
+            expectedTime : std::max(expectedTime - statistics._latency, 0.0);
+        if (expectedTime <= timeLeft) {
+            expectedStartTime = startTime;
+            return device.deviceName;
+        }
+        if (expectedTime < bestTime) {
+            bestTime = expectedTime;
+            expectedStartTime = startTime;
+            bestDevice = device.deviceName;
+        }
+    }
+    return bestDevice;
+}
+
+void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(PipelineTask inferPipelineTask, DeviceName preferred_device) {
     auto devices = [&] {
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    const bool hasDeadline = Time{} != inferPipelineTask._deadline;
+    const bool scheduledByPolicy = preferred_device.empty() && !devices.empty() &&
+                                   (hasDeadline || _schedulingPolicy == SchedulingPolicy::ExpectedCompletionTime);
+    if (scheduledByPolicy) {
+        if (hasDeadline) {
+            const auto timeLeft = std::chrono::duration<double, std::milli>(
+                inferPipelineTask._deadline - std::chrono::steady_clock::now()).count();
+            double expectedStartTime = 0.0;
+            preferred_device = SelectDeviceByDeadline(devices, timeLeft, expectedStartTime);
+            // no device is expected to start the task before the deadline (e.g. all of them are overloaded),
+            // so the request completes right away instead of taking a place in the queue
+            if (timeLeft <= 0.0 ||
+                (expectedStartTime != std::numeric_limits<double>::max() && expectedStartTime > timeLeft)) {
+                DropPipelineTask(inferPipelineTask);
+                return;
+            }
+        } else {
+            preferred_device = SelectDeviceByExpectedCompletionTime(devices);
+        }
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
-        WorkerInferRequest* workerRequestPtr = nullptr;
-        NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
-        if (idleWorkerRequests.try_pop(workerRequestPtr)) {
-            IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
-            _thisWorkerInferRequest = workerRequestPtr;
-            {
-                auto capturedTask = std::move(inferPipelineTask);
-                capturedTask();
-            }
-            idleGuard.Release();
+        if (RunPipelineTask(inferPipelineTask._task, _idleWorkerRequests[device.deviceName], device.deviceName))
             return;
-        }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
-        _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    if (!preferred_device.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(_statisticsMutex);
+            auto& statistics = _statistics.at(preferred_device);
+            statistics._numQueuedTasks++;
+            statistics._windowQueuedTasks++;
+        }
+        auto& deviceTasks = *_inferPipelineTasksDeviceSpecific[preferred_device];
+        deviceTasks.push(std::move(inferPipelineTask));
+        // the selected device may complete all its requests before the task is queued,
+        // so re-check for the idle request to not leave the task waiting for the next completion
+        if (scheduledByPolicy) {
+            auto& idleWorkerRequests = _idleWorkerRequests[preferred_device];
+            WorkerInferRequest* workerRequestPtr = nullptr;
+            PipelineTask t;
+            if (idleWorkerRequests.try_pop(workerRequestPtr) &&
+                idleWorkerRequests.try_push(workerRequestPtr) &&
+                deviceTasks.try_pop(t)) {
+                {
+                    std::lock_guard<std::mutex> lock(_statisticsMutex);
+                    _statistics.at(preferred_device)._numQueuedTasks--;
+                }
+                ScheduleToWorkerInferRequest(std::move(t), preferred_device);
+            }
+        }
+    } else {
+        {
+            // all the devices are busy
+            std::lock_guard<std::mutex> lock(_statisticsMutex);
+            for (auto&& statistics : _statistics) {
+                statistics.second._windowQueuedTasks++;
+            }
+        }
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
-    ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName);
+    ScheduleToWorkerInferRequest({std::move(inferPipelineTask), _thisDeadline}, _thisPreferredDeviceName);
 }
 
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
+    if (_pendingDeviceLoads) {
+        // the loads use the core and the device plugins, so they are not left running after the network
+        std::unique_lock<std::mutex> lock(_pendingDeviceLoads->_mutex);
+        _pendingDeviceLoads->_multiNetwork = nullptr;
+        _pendingDeviceLoads->_loadCompleted.wait(lock, [&] { return 0 == _pendingDeviceLoads->_numPendingLoads; });
+    }
     {
         std::lock_guard<std::mutex> lock(_mutex);
         _devicePriorities.clear();
     }
+    {
+        // stop the adaptive pool resizing, so the worker requests are neither created nor returned back
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        for (auto&& statistics : _statistics) {
+            statistics.second._numRequests = statistics.second._maxNumRequests = 0;
+            statistics.second._lastResize = 0;
+        }
+    }
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` worker infer requests' threads.
      *       But AsyncInferRequest destructor should wait for all asynchronous tasks by the request
      */
-    for (auto&& networkValue : _networksPerDevice) {
+    for (auto&& idleWorkerRequests : _idleWorkerRequests) {
         // stop accepting any idle requests back (for re-scheduling)
-        _idleWorkerRequests.at(networkValue.first).set_capacity(0);
+        idleWorkerRequests.second.set_capacity(0);
     }
     _workerRequests.clear();
 }
@@ -162,12 +504,19 @@ RemoteContext::Ptr MultiDeviceExecutableNetwork::GetContext() const {
         return _devicePriorities;
     }();
 
+    auto networks = [&] {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _networksPerDevice;
+    }();
+
     std::string devices_names;
     for (auto&& device : devices) {
         devices_names += device.deviceName + " ";
-        const auto& n  = _networksPerDevice.at(device.deviceName);
+        auto itNetwork = networks.find(device.deviceName);
+        if (itNetwork == networks.end())
+            continue;
         try {
-            return n.GetContext();
+            return itNetwork->second.GetContext();
         } catch (const NotImplemented& ex) {
         }
     }
@@ -180,6 +529,7 @@ InferenceEngine::InferRequestInternal::Ptr MultiDeviceExecutableNetwork::CreateI
     auto num = _numRequestsCreated++;
     size_t sum = 0;
     InferenceEngine::InferRequest request_to_share_blobs_with;
+    std::lock_guard<std::mutex> lock(_workerRequestsMutex);
     // borrowing device-specific blobs from the underlying requests for the device-agnostic, user-facing requests
     // this allows to potentially save on the data-copy later (if the requests are scheduled in the same order)
     for (const auto& device : _devicePrioritiesInitial) {
@@ -201,16 +551,22 @@ IInferRequest::Ptr MultiDeviceExecutableNetwork::CreateInferRequest() {
                                                                              _needPerfCounters,
                                                                              std::static_pointer_cast<MultiDeviceExecutableNetwork>(shared_from_this()),
                                                                              _callbackExecutor);
+    asyncTreadSafeImpl->SetDeadline(std::chrono::milliseconds{_requestDeadline.load()});
     asyncRequest.reset(new InferRequestBase<MultiDeviceAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
     asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
     return asyncRequest;
 }
 
 void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    // requests keep the deadline they are created with, so it can be changed for the loaded network
+    auto deadline = config.find(PluginConfigParams::KEY_REQUEST_DEADLINE);
+    const int deadlineValue = (deadline == config.end()) ? 0 : ParseRequestDeadline(deadline->second.as<std::string>());
+    const bool onlyDeadline = (deadline != config.end()) && (config.size() == 1);
     auto priorities = config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
-    if (priorities == config.end() || config.size() > 1) {
-        THROW_IE_EXCEPTION << "The only config supported for the Network's SetConfig is MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES";
-    } else {
+    if (!onlyDeadline && (priorities == config.end() || config.size() > ((deadline == config.end()) ? 1 : 2))) {
+        THROW_IE_EXCEPTION << "The only configs supported for the Network's SetConfig are "
+                           << "MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES and PluginConfigParams::KEY_REQUEST_DEADLINE";
+    } else if (!onlyDeadline) {
         auto multiPlugin = std::dynamic_pointer_cast<MultiDeviceInferencePlugin>(this->_plugin);
         assert(multiPlugin != nullptr);
         auto metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
@@ -225,7 +581,8 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
         {
             std::lock_guard<std::mutex> lock{_mutex};
             for (auto && device : metaDevices) {
-                if (_networksPerDevice.find(device.deviceName) == _networksPerDevice.end()) {
+                if (std::none_of(_devicePrioritiesInitial.begin(), _devicePrioritiesInitial.end(),
+                                 [&device](const DeviceInformation& d) { return d.deviceName == device.deviceName; })) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "You can only change device priorities but not add new devices with"
                         << " the Network's SetConfig(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES. "
                         << device.deviceName <<
@@ -238,6 +595,13 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
         }
     }
+    if (deadline != config.end()) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _config[PluginConfigParams::KEY_REQUEST_DEADLINE] = deadline->second;
+        }
+        _requestDeadline = deadlineValue;
+    }
 }
 
 InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetConfig(const std::string &name) const {
@@ -250,9 +614,13 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetConfig(const std::st
 }
 
 InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::string &name) const {
+    auto networks = [&] {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _networksPerDevice;
+    }();
     if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
         unsigned int res = 0u;
-        for (auto n : _networksPerDevice) {
+        for (auto n : networks) {
             try {
                 res += n.second.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
             } catch (const InferenceEngine::details::InferenceEngineException &iie) {
@@ -264,8 +632,8 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
     } else if (name == METRIC_KEY(NETWORK_NAME)) {
-        auto it = _networksPerDevice.begin();
-        IE_ASSERT(it != _networksPerDevice.end());
+        auto it = networks.begin();
+        IE_ASSERT(it != networks.end());
         IE_SET_METRIC_RETURN(NETWORK_NAME, it->second.GetMetric(
             METRIC_KEY(NETWORK_NAME)).as<std::string>());
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
@@ -276,7 +644,11 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(SUPPORTED_CONFIG_KEYS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                                MultiDeviceConfigParams::KEY_MULTI_ADAPTIVE_NUM_REQUESTS,
+                                                MultiDeviceConfigParams::KEY_MULTI_EARLY_START,
+                                                PluginConfigParams::KEY_REQUEST_DEADLINE };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
@@ -6,6 +6,10 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -16,10 +20,7 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 #include <ie_parallel.hpp>
 #include <threading/ie_itask_executor.hpp>
-
-#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
-# include <tbb/concurrent_queue.h>
-#endif
+#include <threading/ie_thread_safe_containers.hpp>
 
 namespace MultiDevicePlugin {
 
@@ -34,76 +35,65 @@ struct DeviceInformation {
 template<typename T>
 using DeviceMap = std::unordered_map<DeviceName, T>;
 
-#if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
-template <typename T>
-using ThreadSafeQueue = tbb::concurrent_queue<T>;
-template <typename T>
-using ThreadSafeBoundedQueue = tbb::concurrent_bounded_queue<T>;
-#else
-template <typename T>
-class ThreadSafeQueue {
-public:
-    void push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _queue.push(std::move(value));
-    }
-    bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (!_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
-            return false;
-        }
-    }
-protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-};
-template <typename T>
-class ThreadSafeBoundedQueue {
-public:
-    ThreadSafeBoundedQueue() = default;
-    bool try_push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity) {
-            _queue.push(std::move(value));
-        }
-        return _capacity;
-    }
-    bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity && !_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
-            return false;
-        }
-    }
-    void set_capacity(std::size_t newCapacity) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _capacity = newCapacity;
-    }
-
-protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-    bool            _capacity = false;
+using InferenceEngine::ThreadSafeQueue;
+using InferenceEngine::ThreadSafeBoundedQueue;
+
+class MultiDeviceExecutableNetwork;
+
+// the value of the KEY_REQUEST_DEADLINE in milliseconds, throws if it is not a non-negative integer
+int ParseRequestDeadline(const std::string& value);
+
+// the devices that still load the network when the executable network is already created (MULTI_EARLY_START)
+struct PendingDeviceLoads {
+    std::mutex                                      _mutex;
+    std::condition_variable                         _loadCompleted;
+    std::size_t                                     _numPendingLoads = 0;
+    // the networks loaded before the executable network is created
+    DeviceMap<InferenceEngine::ExecutableNetwork>   _loadedNetworks;
+    DeviceMap<std::exception_ptr>                   _loadErrors;
+    MultiDeviceExecutableNetwork*                   _multiNetwork = nullptr;
 };
-#endif
 
 class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault,
                                      public InferenceEngine::ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
+    using Time = std::chrono::steady_clock::time_point;
     struct WorkerInferRequest {
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        Time                            _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
+    // the request pipeline task that waits for a worker request, with the request deadline (if any)
+    struct PipelineTask {
+        InferenceEngine::Task   _task;
+        Time                    _deadline;
+    };
+
+    enum class SchedulingPolicy {
+        DevicePriority,
+        ExpectedCompletionTime
+    };
+
+    // running statistics used by the SchedulingPolicy::ExpectedCompletionTime
+    struct DeviceStatistics {
+        double      _latency = 0.0;  // exponentially weighted moving average of completed requests latency, ms
+        std::size_t _numBusyRequests = 0;
+        std::size_t _numQueuedTasks = 0;
+        std::size_t _numRequests = 0;
+        // adaptive sizing of the worker requests pool (MULTI_ADAPTIVE_NUM_REQUESTS)
+        std::size_t _numActiveRequests = 0;
+        std::size_t _minNumRequests = 0;
+        std::size_t _maxNumRequests = 0;
+        std::size_t _windowCompletions = 0;
+        std::size_t _windowQueuedTasks = 0;
+        std::size_t _windowMaxBusyRequests = 0;
+        Time        _windowStart;
+        double      _lastThroughput = 0.0;
+        int         _lastResize = 0;
+    };
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
@@ -120,24 +110,48 @@ public:
     InferenceEngine::RemoteContext::Ptr GetContext() const override;
     ~MultiDeviceExecutableNetwork() override;
 
-    void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    void ScheduleToWorkerInferRequest(PipelineTask, DeviceName preferred_device = "");
+    bool RunPipelineTask(InferenceEngine::Task& inferPipelineTask, NotBusyWorkerRequests& idleWorkerRequests,
+                         const DeviceName& device);
+    void DropPipelineTask(PipelineTask& inferPipelineTask);
+    double ExpectedCompletionTime(const DeviceStatistics& statistics) const;
+    DeviceName SelectDeviceByExpectedCompletionTime(const std::vector<DeviceInformation>& devices);
+    DeviceName SelectDeviceByDeadline(const std::vector<DeviceInformation>& devices, double timeLeft, double& expectedTime);
+    WorkerInferRequest* CreateWorkerRequest(const DeviceName& device);
+    void ScheduleWaitingTask(const DeviceName& device);
+    void UpdateNumRequests(DeviceStatistics& statistics);
+    void AddWorkerRequests(const DeviceName& device);
+    void AddDevice(const DeviceName& device, const InferenceEngine::ExecutableNetwork& network);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
     // the bug is e.g. manifesting on the old CentOS (and it's 4.8.x gcc) used in our testing
     // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=81880
     static thread_local const char*                             _thisPreferredDeviceName;
+    // the deadline of the request that passes the pipeline task to the run()
+    static thread_local Time                                    _thisDeadline;
     mutable std::mutex                                          _mutex;
     std::vector<DeviceInformation>                              _devicePriorities;
     const std::vector<DeviceInformation>                        _devicePrioritiesInitial;
+    // only the loaded devices, guarded by the _mutex as the devices are added while the network is in use
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
-    ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
-    DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
+    ThreadSafeQueue<PipelineTask>                               _inferPipelineTasks;
+    DeviceMap<std::unique_ptr<ThreadSafeQueue<PipelineTask>>>   _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
-    DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    std::mutex                                                  _workerRequestsMutex;
+    // deque keeps the worker requests addresses stable when the pool grows
+    DeviceMap<std::deque<WorkerInferRequest>>                   _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
+    std::atomic<int>                                            _requestDeadline = {0};
+    SchedulingPolicy                                            _schedulingPolicy = SchedulingPolicy::DevicePriority;
+    std::mutex                                                  _statisticsMutex;
+    DeviceMap<DeviceStatistics>                                 _statistics;
+    bool                                                        _adaptiveNumRequests = false;
+    DeviceMap<std::vector<WorkerInferRequest*>>                 _parkedWorkerRequests;
+    std::shared_ptr<PendingDeviceLoads>                         _pendingDeviceLoads;
+    InferenceEngine::ITaskExecutor::Ptr                         _loadExecutor;
 };
 
 }  // namespace MultiDevicePlugin
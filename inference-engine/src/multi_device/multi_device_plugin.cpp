@@ -3,16 +3,20 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <exception>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
 
 #include <ie_metric_helpers.hpp>
 #include <multi-device/multi_device_config.hpp>
+#include <threading/ie_executor_manager.hpp>
 #include "multi_device_plugin.hpp"
 
 // ------------------------------MultiDeviceInferencePlugin----------------------------
@@ -26,6 +30,29 @@ namespace {
         }
         return config;
     }
+
+    // a single failure is rethrown as is, so its status is kept, otherwise errors of all devices are reported
+    void throwLoadErrors(const std::vector<DeviceInformation>& metaDevices, const DeviceMap<std::exception_ptr>& loadErrors) {
+        if (loadErrors.size() == 1) {
+            std::rethrow_exception(loadErrors.begin()->second);
+        } else if (!loadErrors.empty()) {
+            std::ostringstream errors;
+            for (auto&& metaDevice : metaDevices) {
+                auto itError = loadErrors.find(metaDevice.deviceName);
+                if (itError == loadErrors.end())
+                    continue;
+                errors << "\n" << metaDevice.deviceName << ": ";
+                try {
+                    std::rethrow_exception(itError->second);
+                } catch (const std::exception& e) {
+                    errors << e.what();
+                } catch (...) {
+                    errors << "unknown exception";
+                }
+            }
+            THROW_IE_EXCEPTION << "Failed to load the network to devices of the MULTI device:" << errors.str();
+        }
+    }
 }  // namespace
 
 std::map<std::string, std::string> MultiDeviceInferencePlugin::GetSupportedConfig(
@@ -108,6 +135,18 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string{MULTI_CONFIG_VALUE(DEVICE_PRIORITY)} : it->second };
+    } else if (name == MULTI_CONFIG_KEY(ADAPTIVE_NUM_REQUESTS)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(ADAPTIVE_NUM_REQUESTS));
+        return { it == _config.end() ? std::string{CONFIG_VALUE(NO)} : it->second };
+    } else if (name == MULTI_CONFIG_KEY(EARLY_START)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(EARLY_START));
+        return { it == _config.end() ? std::string{CONFIG_VALUE(NO)} : it->second };
+    } else if (name == CONFIG_KEY(REQUEST_DEADLINE)) {
+        auto it = _config.find(CONFIG_KEY(REQUEST_DEADLINE));
+        return { it == _config.end() ? std::string{"0"} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -140,6 +179,10 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+            MultiDeviceConfigParams::KEY_MULTI_ADAPTIVE_NUM_REQUESTS,
+            MultiDeviceConfigParams::KEY_MULTI_EARLY_START,
+            PluginConfigParams::KEY_REQUEST_DEADLINE,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -169,20 +212,132 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
 
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    const std::string policyValue = (policy == fullConfig.end()) ? MULTI_CONFIG_VALUE(DEVICE_PRIORITY) : policy->second;
+    if (policyValue != MULTI_CONFIG_VALUE(DEVICE_PRIORITY) && policyValue != MULTI_CONFIG_VALUE(EXPECTED_COMPLETION_TIME)) {
+        THROW_IE_EXCEPTION << "Unsupported value " << policyValue << " for the "
+                           << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY << " key of the MULTI device";
+    }
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = policyValue;
+
+    auto adaptive = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_ADAPTIVE_NUM_REQUESTS);
+    const std::string adaptiveValue = (adaptive == fullConfig.end()) ? CONFIG_VALUE(NO) : adaptive->second;
+    if (adaptiveValue != CONFIG_VALUE(YES) && adaptiveValue != CONFIG_VALUE(NO)) {
+        THROW_IE_EXCEPTION << "Unsupported value " << adaptiveValue << " for the "
+                           << MultiDeviceConfigParams::KEY_MULTI_ADAPTIVE_NUM_REQUESTS << " key of the MULTI device";
+    }
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_ADAPTIVE_NUM_REQUESTS] = adaptiveValue;
+
+    auto earlyStart = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_EARLY_START);
+    const std::string earlyStartValue = (earlyStart == fullConfig.end()) ? CONFIG_VALUE(NO) : earlyStart->second;
+    if (earlyStartValue != CONFIG_VALUE(YES) && earlyStartValue != CONFIG_VALUE(NO)) {
+        THROW_IE_EXCEPTION << "Unsupported value " << earlyStartValue << " for the "
+                           << MultiDeviceConfigParams::KEY_MULTI_EARLY_START << " key of the MULTI device";
+    }
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_EARLY_START] = earlyStartValue;
+
+    auto deadline = fullConfig.find(PluginConfigParams::KEY_REQUEST_DEADLINE);
+    const std::string deadlineValue = (deadline == fullConfig.end()) ? std::string{"0"} : deadline->second;
+    ParseRequestDeadline(deadlineValue);
+    multiNetworkConfig[PluginConfigParams::KEY_REQUEST_DEADLINE] = deadlineValue;
+
+    for (auto&& metaDevice : metaDevices) {
+        // the MULTI requests apply the deadline, the worker requests start when the time is already spent on waiting
+        metaDevice.config.erase(PluginConfigParams::KEY_REQUEST_DEADLINE);
+        multiNetworkConfig.insert(metaDevice.config.begin(), metaDevice.config.end());
+    }
+
+    auto perfConfig = fullConfig.find(PluginConfigParams::KEY_PERF_COUNT);
+    bool enablePerfCounters = (fullConfig.end() != perfConfig) && (perfConfig->second == PluginConfigParams::YES);
+
+    // devices are booted and networks are compiled independently, so loads are issued in parallel
+    auto executor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+        IStreamsExecutor::Config{"MultiDeviceAsyncLoad",
+                                 static_cast<int>(metaDevices.size()),
+                                 1 /*single thread per stream*/,
+                                 IStreamsExecutor::ThreadBindingType::NONE});
+
+    if (earlyStartValue == CONFIG_VALUE(YES)) {
+        // the network is returned with the first loaded device, the rest are added to it as their loads complete
+        auto pendingLoads = std::make_shared<PendingDeviceLoads>();
+        pendingLoads->_numPendingLoads = metaDevices.size();
+        auto core = GetCore();
+        for (auto&& metaDevice : metaDevices) {
+            executor->run([pendingLoads, core, network, metaDevice] {
+                ExecutableNetwork exeNetwork;
+                std::exception_ptr loadError;
+                try {
+                    exeNetwork = core->LoadNetwork(network, metaDevice.deviceName, metaDevice.config);
+                } catch (...) {
+                    loadError = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(pendingLoads->_mutex);
+                if (!loadError && nullptr != pendingLoads->_multiNetwork) {
+                    try {
+                        pendingLoads->_multiNetwork->AddDevice(metaDevice.deviceName, exeNetwork);
+                    } catch (...) {
+                        loadError = std::current_exception();
+                    }
+                } else if (!loadError) {
+                    pendingLoads->_loadedNetworks.insert({ metaDevice.deviceName, exeNetwork });
+                }
+                if (loadError)
+                    pendingLoads->_loadErrors[metaDevice.deviceName] = loadError;
+                pendingLoads->_numPendingLoads--;
+                pendingLoads->_loadCompleted.notify_all();
+            });
+        }
+
+        std::unique_lock<std::mutex> lock(pendingLoads->_mutex);
+        auto allLoadsCompleted = [&] { return 0 == pendingLoads->_numPendingLoads; };
+        pendingLoads->_loadCompleted.wait(lock, [&] { return !pendingLoads->_loadedNetworks.empty() || allLoadsCompleted(); });
+        if (pendingLoads->_loadedNetworks.empty()) {
+            throwLoadErrors(metaDevices, pendingLoads->_loadErrors);
+        }
+        MultiDeviceExecutableNetwork::Ptr multiNetwork;
+        try {
+            multiNetwork = std::make_shared<MultiDeviceExecutableNetwork>(pendingLoads->_loadedNetworks,
+                                                                          metaDevices,
+                                                                          multiNetworkConfig,
+                                                                          enablePerfCounters);
+        } catch (...) {
+            // the loads use the core and the device plugins, so they are not left running
+            pendingLoads->_loadCompleted.wait(lock, allLoadsCompleted);
+            throw;
+        }
+        multiNetwork->_pendingDeviceLoads = pendingLoads;
+        multiNetwork->_loadExecutor = executor;
+        pendingLoads->_multiNetwork = multiNetwork.get();
+        return multiNetwork;
+    }
+
+    std::vector<ExecutableNetwork> loadedNetworks(metaDevices.size());
+    std::vector<std::exception_ptr> loadErrors(metaDevices.size());
+    std::vector<Task> loads;
+    for (std::size_t i = 0; i < metaDevices.size(); ++i) {
+        loads.push_back([&, i] {
+            try {
+                loadedNetworks[i] = GetCore()->LoadNetwork(network, metaDevices[i].deviceName, metaDevices[i].config);
+            } catch (...) {
+                loadErrors[i] = std::current_exception();
+            }
+        });
+    }
+    executor->runAndWait(loads);
+
+    DeviceMap<std::exception_ptr> failedLoads;
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
-    for (auto& p : metaDevices) {
-        auto & deviceName = p.deviceName;
-        auto & deviceConfig = p.config;
-        executableNetworkPerDevice.insert({ deviceName, GetCore()->LoadNetwork(network, deviceName, deviceConfig) });
-        multiNetworkConfig.insert(deviceConfig.begin(), deviceConfig.end());
+    for (std::size_t i = 0; i < metaDevices.size(); ++i) {
+        if (loadErrors[i])
+            failedLoads.insert({ metaDevices[i].deviceName, loadErrors[i] });
+        else
+            executableNetworkPerDevice.insert({ metaDevices[i].deviceName, loadedNetworks[i] });
     }
+    throwLoadErrors(metaDevices, failedLoads);
     if (executableNetworkPerDevice.empty())
         THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to load Executable network to any device "
                                             <<  "that the MULTI device is initialized to work with";
 
-    auto perfConfig = fullConfig.find(PluginConfigParams::KEY_PERF_COUNT);
-    bool enablePerfCounters = (fullConfig.end() != perfConfig) && (perfConfig->second == PluginConfigParams::YES);
-
     return std::make_shared<MultiDeviceExecutableNetwork>(executableNetworkPerDevice,
                                                           metaDevices,
                                                           multiNetworkConfig,
@@ -12,7 +12,9 @@
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_internal.hpp>
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
+#include <ngraph/chrome_trace.hpp>
 
+#include <chrono>
 #include <exception>
 #include <future>
 #include <map>
@@ -164,6 +166,16 @@ public:
         return _syncRequest->Cancel();
     }
 
+    /**
+     * @brief Sets the deadline of the following runs of the request, counted from the run start.
+     *        The run that has not started the first pipeline stage by the deadline is not executed and completes
+     *        with StatusCode::INFER_DEADLINE_EXPIRED.
+     * @param[in]  timeout The time from the run start, zero disables the deadline
+     */
+    void SetDeadline(std::chrono::milliseconds timeout) {
+        _deadlineTimeout = timeout;
+    }
+
 protected:
     /**
      * @brief Each pipeline stage is a @ref Task that is executed by specified ITaskExecutor implementation
@@ -185,6 +197,9 @@ protected:
     void RunFirstStage(const Pipeline::iterator itBeginStage, const Pipeline::iterator itEndStage,
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         _promise = {};
+        _deadline = (_deadlineTimeout.count() > 0) ? std::chrono::steady_clock::now() + _deadlineTimeout
+                                                   : std::chrono::steady_clock::time_point{};
+        _checkDeadline = (_deadlineTimeout.count() > 0);
         bool stop = [&] {
             std::lock_guard<std::mutex> lock(_mutex);
             if (!_stop) {
@@ -208,6 +223,9 @@ protected:
             try {
                 auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
                 IE_ASSERT(nullptr != firstStageExecutor);
+                // the event is written when the first stage starts
+                if (ngraph::event::Manager::is_tracing_enabled())
+                    _queueWaitEvent.reset(new ngraph::event::Duration("queue wait", "request"));
                 firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
             } catch (...) {
                 _promise.set_exception(std::current_exception());
@@ -256,6 +274,14 @@ protected:
         Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
     }
 
+    /**
+     * @brief Returns the deadline of the current run
+     * @return The deadline or default constructed time point if the run has no deadline
+     */
+    std::chrono::steady_clock::time_point GetDeadline() const {
+        return _deadline;
+    }
+
     ITaskExecutor::Ptr _requestExecutor;  //!< Used to run inference CPU tasks.
     ITaskExecutor::Ptr _callbackExecutor;  //!< Used to run post inference callback in asynchronous pipline
     ITaskExecutor::Ptr _syncCallbackExecutor;  //!< Used to run post inference callback in synchronous pipline
@@ -330,9 +356,21 @@ private:
             auto itNextStage = itStage + 1;
 
             try {
+                _queueWaitEvent.reset();
+                // only the wait for the first stage is limited, the started run is not interrupted
+                if (_checkDeadline) {
+                    _checkDeadline = false;
+                    if (std::chrono::steady_clock::now() > _deadline) {
+                        THROW_IE_EXCEPTION << InferenceEngine::details::as_status << StatusCode::INFER_DEADLINE_EXPIRED
+                                           << "The request was not started before its deadline";
+                    }
+                }
                 auto& stageTask = std::get<Stage_e::task>(thisStage);
                 IE_ASSERT(nullptr != stageTask);
-                stageTask();
+                {
+                    ngraph::event::Duration stageEvent("pipeline stage", "request");
+                    stageTask();
+                }
                if (itEndStage != itNextStage) {
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
@@ -355,6 +393,7 @@ private:
                         if (nullptr != callback) {
                             InferenceEngine::CurrentException() = localCurrentException;
                             try {
+                                ngraph::event::Duration callbackEvent("callback", "request");
                                 callback(_publicInterface, requestStatus);
                             } catch (...) {
                                 localCurrentException = std::current_exception();
@@ -385,5 +424,9 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     bool _stop = false;
+    std::unique_ptr<ngraph::event::Duration> _queueWaitEvent;
+    std::chrono::milliseconds _deadlineTimeout {0};
+    std::chrono::steady_clock::time_point _deadline;
+    bool _checkDeadline = false;
 };
 }  // namespace InferenceEngine
@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/plugin_itt.hpp"
@@ -225,11 +226,16 @@ public:
      * @brief      Checks that both inputs and outputs blob are valid. Throws an exception if they are not.
      */
     virtual void checkBlobs() {
+        // blobs are added to the maps on the first GetBlob call, so the cache is reset when the number changes
+        if (_checkedBlobs.size() != _inputs.size() + _outputs.size()) {
+            _checkedBlobs.assign(_inputs.size() + _outputs.size(), CheckedBlob{});
+        }
+        size_t idx = 0;
         for (auto const& input : _inputs) {
-            checkBlob(input.second, input.first, true);
+            checkBlobCached(_checkedBlobs[idx++], input.second, input.first, true);
         }
         for (auto const& output : _outputs) {
-            checkBlob(output.second, output.first, false);
+            checkBlobCached(_checkedBlobs[idx++], output.second, output.first, false);
         }
     }
 
@@ -248,6 +254,15 @@ protected:
     std::map<std::string, PreProcessDataPtr> _preProcData;        //!< A map of pre-process data per input
     int m_curBatch;  //!< Current batch value used in dynamic batching
 
+    /**
+     * @brief A blob which passed checkBlob with its size at that moment
+     */
+    struct CheckedBlob {
+        const Blob* blob = nullptr;  //!< A checked blob, nullptr if there is no valid check result
+        size_t size = 0;             //!< A size of the blob at the check
+    };
+    std::vector<CheckedBlob> _checkedBlobs;  //!< Results of checkBlobs in the order of _inputs and _outputs
+
     /**
      * @brief A shared pointer to ExecutableNetworkInternal interface
      * @note Needed to correctly handle ownership between objects.
@@ -285,24 +300,17 @@ protected:
         if (_networkOutputs.empty()) {
             THROW_IE_EXCEPTION << "Internal error: network outputs is not set";
         }
-        auto foundInputPair = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
-                                           [&](const std::pair<std::string, InputInfo::Ptr>& pair) {
-                                               return pair.first == name;
-                                           });
-        auto foundOutputPair = std::find_if(std::begin(_networkOutputs), std::end(_networkOutputs),
-                                            [&](const std::pair<std::string, DataPtr>& pair) {
-                                                return pair.first == name;
-                                            });
-        if (foundOutputPair == std::end(_networkOutputs) && (foundInputPair == std::end(_networkInputs))) {
-            THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input or output with name: \'" << name << "\'";
-        }
+        auto foundInputPair = _networkInputs.find(name);
         if (foundInputPair != std::end(_networkInputs)) {
             foundInput = foundInputPair->second;
             return true;
-        } else {
-            foundOutput = foundOutputPair->second;
-            return false;
         }
+        auto foundOutputPair = _networkOutputs.find(name);
+        if (foundOutputPair == std::end(_networkOutputs)) {
+            THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input or output with name: \'" << name << "\'";
+        }
+        foundOutput = foundOutputPair->second;
+        return false;
     }
 
     /**
@@ -314,51 +322,72 @@ protected:
      * @param[in]  refDims  The reference dims, empty if not specified
      */
     void checkBlob(const Blob::Ptr& blob, const std::string& name, bool isInput, const SizeVector& refDims = {}) const {
-        std::string bType = isInput ? "Input" : "Output";
-        std::string sType = isInput ? "input" : "output";
-        std::string strNotAllocated(bType + " data was not allocated.");
-        std::string strNotMatched("The " + sType + " blob size is not equal to the network " + sType + " size");
+        // messages are built only on failure, the check runs for each blob on every inference
+        auto bType = [isInput]() { return isInput ? "Input" : "Output"; };
+        auto sType = [isInput]() { return isInput ? "input" : "output"; };
 
         if (!blob) {
-            THROW_IE_EXCEPTION << strNotAllocated;
+            THROW_IE_EXCEPTION << bType() << " data was not allocated.";
         }
         size_t refSize;
         if (refDims.empty()) {
-            SizeVector dims;
+            const TensorDesc* desc = nullptr;
             if (isInput) {
-                auto foundInputPair = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
-                                                   [&](const std::pair<std::string, InputInfo::Ptr>& pair) {
-                                                       return pair.first == name;
-                                                   });
+                auto foundInputPair = _networkInputs.find(name);
                 if (foundInputPair == std::end(_networkInputs)) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input with name: \'" << name << "\'";
                 }
-                dims = foundInputPair->second->getTensorDesc().getDims();
-                refSize = foundInputPair->second->getTensorDesc().getLayout() != SCALAR
-                    ? details::product(dims)
-                    : 1;
+                desc = &foundInputPair->second->getTensorDesc();
             } else {
-                auto foundOutputPair = std::find_if(std::begin(_networkOutputs), std::end(_networkOutputs),
-                                                    [&](const std::pair<std::string, DataPtr>& pair) {
-                                                        return pair.first == name;
-                                                    });
+                auto foundOutputPair = _networkOutputs.find(name);
                 if (foundOutputPair == std::end(_networkOutputs)) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find output with name: \'" << name << "\'";
                 }
-                dims = foundOutputPair->second->getTensorDesc().getDims();
-                refSize = foundOutputPair->second->getTensorDesc().getLayout() != SCALAR
-                    ? details::product(dims)
-                    : 1;
+                desc = &foundOutputPair->second->getTensorDesc();
             }
+            refSize = desc->getLayout() != SCALAR ? details::product(desc->getDims()) : 1;
         } else {
             refSize = details::product(refDims);
         }
 
-        if (refSize != blob->size()) {
-            THROW_IE_EXCEPTION << strNotMatched + ": got " << blob->size() << " expecting " << refSize;
+        // a batched blob is checked as the tensor made of its items
+        auto batched = blob->as<BatchedBlob>();
+        const size_t blobSize = batched ? details::product(blob->getTensorDesc().getDims()) : blob->size();
+        if (refSize != blobSize) {
+            THROW_IE_EXCEPTION << "The " << sType() << " blob size is not equal to the network " << sType()
+                               << " size: got " << blobSize << " expecting " << refSize;
+        }
+        if (batched) {
+            for (size_t i = 0; i < batched->size(); i++) {
+                if (batched->getBlob(i)->buffer() == nullptr) THROW_IE_EXCEPTION << bType() << " data was not allocated.";
+            }
+            return;
         }
         const bool remoteBlobPassed = blob->is<RemoteBlob>();
-        if (!remoteBlobPassed && blob->buffer() == nullptr) THROW_IE_EXCEPTION << strNotAllocated;
+        if (!remoteBlobPassed && blob->buffer() == nullptr) THROW_IE_EXCEPTION << bType() << " data was not allocated.";
+    }
+
+    /**
+     * @brief      Checks @p blob with checkBlob unless it already passed the check stored in @p checked.
+     * @note       A blob is checked again if it was replaced, resized or deallocated. Remote blobs are always checked.
+     *
+     * @param[in]  checked  The result of the previous check of the blob with the same name, updated on success
+     * @param[in]  blob     The blob to check
+     * @param[in]  name     The name of input or output depending of if the @p blob is input or output
+     * @param[in]  isInput  Indicates if @p is input
+     * @param[in]  refDims  The reference dims, empty if not specified
+     */
+    void checkBlobCached(CheckedBlob& checked, const Blob::Ptr& blob, const std::string& name, bool isInput,
+                         const SizeVector& refDims = {}) const {
+        if (blob && checked.blob == blob.get() && checked.size == blob->size() && !(blob->buffer() == nullptr)) {
+            return;
+        }
+        checked = CheckedBlob{};
+        checkBlob(blob, name, isInput, refDims);
+        if (!blob->is<RemoteBlob>()) {
+            checked.blob = blob.get();
+            checked.size = blob->size();
+        }
     }
 
     /**
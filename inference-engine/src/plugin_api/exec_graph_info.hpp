@@ -51,6 +51,42 @@ static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a minimal execution time of the executable primitive.
+ */
+static const char PERF_COUNTER_MIN[] = "execTimeMinMcs";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a maximal execution time of the executable primitive.
+ */
+static const char PERF_COUNTER_MAX[] = "execTimeMaxMcs";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a number of bytes read by one execution of the executable primitive.
+ */
+static const char BYTES_READ[] = "bytesRead";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a number of bytes written by one execution of the executable primitive.
+ */
+static const char BYTES_WRITTEN[] = "bytesWritten";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a number of operations performed by one execution of the executable primitive.
+ */
+static const char OPERATIONS[] = "operations";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an achieved performance of the executable primitive in giga operations per second.
+ */
+static const char GOPS[] = "gops";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief Used to get output layouts of primitive.
@@ -84,6 +120,8 @@ static const char RUNTIME_PRECISION[] = "runtimePrecision";
  * - ExecGraphInfoSerialization::IMPL_TYPE
  * - ExecGraphInfoSerialization::OUTPUT_PRECISIONS
  * - ExecGraphInfoSerialization::PERF_COUNTER
+ * - ExecGraphInfoSerialization::PERF_COUNTER_MIN, PERF_COUNTER_MAX, BYTES_READ, BYTES_WRITTEN, OPERATIONS
+ *   and GOPS if a plugin collects detailed performance counters
  * - ExecGraphInfoSerialization::OUTPUT_LAYOUTS
  * - ExecGraphInfoSerialization::EXECUTION_ORDER
  * - ExecGraphInfoSerialization::LAYER_TYPE
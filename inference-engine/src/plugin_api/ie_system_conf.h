@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ie_api.h"
+#include <exception>
 #include <vector>
 
 namespace InferenceEngine {
@@ -38,12 +39,33 @@ INFERENCE_ENGINE_API_CPP(std::vector<int>) getAvailableNUMANodes();
 
 /**
  * @brief      Returns number of CPU physical cores on Linux/Windows (which is considered to be more performance friendly for servers)
- *             (on other OSes it simply relies on the original parallel API of choice, which usually uses the logical cores )
+ *             (on other OSes it simply relies on the original parallel API of choice, which usually uses the logical cores ).
+ *             On Linux only the cores of the process affinity mask are counted and limited by the cgroup CPU quota
  * @ingroup    ie_dev_api_system_conf
  * @return     Number of physical CPU cores.
  */
 INFERENCE_ENGINE_API_CPP(int) getNumberOfCPUCores();
 
+/**
+ * @brief      Returns number of logical CPU processors the process can run on. On Linux the processors of the process
+ *             affinity mask (cpuset) are counted and limited by the cgroup CPU quota, so containers get their CPU limit
+ *             rather than the host processors. On Windows processors of the process affinity mask are counted
+ *             (within a single processor group), on other OSes it relies on the parallel API of choice.
+ *             The topology is detected once per process.
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Number of logical CPU processors.
+ */
+INFERENCE_ENGINE_API_CPP(int) getNumberOfLogicalCPUCores();
+
+/**
+ * @brief      Returns logical processors of big (performance) cores on hybrid CPUs which combine cores of different types.
+ *             Processors are listed by Linux kernel in `/sys/devices/cpu_core/cpus`, on other OSes and for CPUs
+ *             with a single type of cores the vector is empty
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Sorted ids of big cores logical processors
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) getBigCoreProcessors();
+
 /**
  * @brief      Checks whether CPU supports SSE 4.2 capability
  * @ingroup    ie_dev_api_system_conf
@@ -86,4 +108,11 @@ INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core();
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_bfloat16();
 
+/**
+ * @brief      Checks whether CPU supports AVX512 VNNI capability
+ * @ingroup    ie_dev_api_system_conf
+ * @return     `True` is tAVX512_VNNI instructions are available, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core_vnni();
+
 }  // namespace InferenceEngine
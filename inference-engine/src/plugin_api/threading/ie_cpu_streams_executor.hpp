@@ -20,7 +20,7 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from queues of each priority.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -42,6 +42,8 @@ public:
 
     void run(Task task) override;
 
+    void run(Task task, Priority priority) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
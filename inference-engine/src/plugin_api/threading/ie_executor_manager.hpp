@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -29,6 +30,8 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -40,6 +43,9 @@ public:
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr> > cpuStreamsExecutors;
+    // process-wide streams with fair share scheduler, released when the last user is gone
+    std::weak_ptr<IStreamsExecutor> sharedStreamsExecutor;
+    std::weak_ptr<void> fairShareScheduler;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
 };
@@ -83,6 +89,15 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns an executor which runs tasks by process-wide CPU streams shared by all callers.
+     *        Callers take turns in the shared streams, so every caller (e.g. executable network) gets a fair share
+     *        of them and the total number of threads is limited by the shared streams configuration
+     * @param config Configuration of the shared streams, it is used if no shared streams are alive only
+     * @return A shared pointer to a new executor of the caller
+     */
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     /**
      * @cond
      */
@@ -41,7 +41,17 @@ public:
     enum ThreadBindingType : std::uint8_t {
         NONE,    //!< Don't bind threads
         CORES,   //!< Bind threads to cores
-        NUMA     //!< Bind threads to NUMA nodes
+        NUMA,    //!< Bind threads to NUMA nodes
+        HYBRID_AWARE  //!< Bind threads to cores taking core types of hybrid CPUs into account
+    };
+
+    /**
+     * @brief Defines task priority. Tasks of higher priority are taken by the next free stream first
+     */
+    enum Priority : std::uint8_t {
+        LOW,     //!< Background tasks
+        NORMAL,  //!< Default priority of tasks passed to ITaskExecutor::run
+        HIGH     //!< Latency sensitive tasks
     };
 
     /**
@@ -76,6 +86,14 @@ public:
         */
         static Config MakeDefaultMultiThreaded(const Config& initial);
 
+        /**
+        * @brief Distributes logical processors between streams for @ref HYBRID_AWARE binding.
+        *        A latency (single) stream uses big cores only, throughput streams are placed on big cores first
+        *        and then on small cores, so threads of one stream run on cores of the same type
+        * @return logical processors of each stream, empty if the binding is not hybrid aware or the CPU is not hybrid
+        */
+        std::vector<std::vector<int>> GetStreamsProcessors() const;
+
         std::string        _name;  //!< Used by `ITT` to name executor threads
         int                _streams                 = 1;  //!< Number of streams.
         int                _threadsPerStream        = 0;  //!< Number of threads per stream that executes `ie_parallel` calls
@@ -83,6 +101,8 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        int                _priorityAgingTime       = 100;  //!< Waiting time in milliseconds which raises a task priority by one level, 0 disables aging
+        int                _spinWaitTime            = 0;  //!< Time in microseconds an idle stream thread polls for tasks before it blocks, 0 disables polling
 
         /**
          * @brief      A constructor with arguments
@@ -135,6 +155,16 @@ public:
     * @param task A task to start
     */
     virtual void Execute(Task task) = 0;
+
+    using ITaskExecutor::run;
+
+    /**
+    * @brief Execute the task in one of streams taking its priority into account.
+    *        Default implementation ignores the priority
+    * @param task A task to start
+    * @param priority The task priority
+    */
+    virtual void run(Task task, Priority priority);
 };
 
 
@@ -8,6 +8,7 @@
 
 #include <tuple>
 #include <memory>
+#include <vector>
 
 #if !(defined(__APPLE__) || defined(_WIN32))
 #include <sched.h>
@@ -85,4 +86,24 @@ INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadByMask(int ncores, const CpuSet&
  * @return     `True` in case of success, `false` otherwise
  */
 INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadToSocket(int socket);
+
+/**
+ * @brief      Returns ids of logical processors enabled in the process mask
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  ncores       The ncores
+ * @param[in]  processMask  The process mask
+ * @return     Sorted ids of logical processors, empty vector if pinning is not supported
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) GetMaskProcessors(int ncores, const CpuSet& processMask);
+
+/**
+ * @brief      Pins a current thread to a logical processor from the list in the round-robin scheme
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  thrIdx      The thr index
+ * @param[in]  processors  Ids of logical processors
+ * @return     `True` in case of success, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadToProcessor(int thrIdx, const std::vector<int>& processors);
 }  //  namespace InferenceEngine
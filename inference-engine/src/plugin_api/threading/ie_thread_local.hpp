@@ -9,11 +9,15 @@
  * @file ie_thread_local.hpp
  */
 
+#include "ie_api.h"
 #include "ie_parallel.hpp"
 
+#include <cstdint>
+
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
 # include <tbb/enumerable_thread_specific.h>
 #else
+# include <array>
 # include <unordered_map>
 # include <memory>
 # include <thread>
@@ -24,6 +28,13 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Returns a process wide unique identifier of a ThreadLocal object, which is never reused
+ * @ingroup ie_dev_api_threading
+ * @return A new identifier
+ */
+INFERENCE_ENGINE_API_CPP(std::uint64_t) NewThreadLocalId();
+
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
 
 /**
@@ -43,16 +54,21 @@ struct ThreadLocal {
     Map             _map;
     mutable std::mutex _mutex;
     Create          _create;
+    // identifies the values of the object in the caches of threads, changed when the values are moved
+    std::uint64_t   _id = NewThreadLocalId();
 
     ThreadLocal() : _create{[]{return T{};}} {}
     explicit ThreadLocal(const T& init) : _create{[init]{return init;}} {}
     ThreadLocal(ThreadLocal&& other) :
     _map{std::move(other._map)},
     _create{std::move(other._create)} {
+        other._id = NewThreadLocalId();
     }
     ThreadLocal& operator=(ThreadLocal&& other) {
         _map    = std::move(other._map);
         _create = std::move(other._create);
+        _id = NewThreadLocalId();
+        other._id = NewThreadLocalId();
         return *this;
     }
     ThreadLocal(const ThreadLocal&)             = delete;
@@ -61,14 +77,36 @@ struct ThreadLocal {
     {}
 
     T& local() {
-        auto threadId = std::this_thread::get_id();
-        std::lock_guard<std::mutex> lock{_mutex};
-        auto itThreadLocal = _map.find(threadId);
-        if (itThreadLocal != _map.end()) {
-            return itThreadLocal->second;
-        } else {
-            return _map.emplace(threadId, _create()).first->second;
+        // Values are never removed from the map and its nodes are stable, so a thread keeps pointers to
+        // the values it used recently and finds them without the lock. A few entries serve threads which
+        // alternate between several objects, e.g. streams shared by several networks.
+        struct CacheEntry {
+            const ThreadLocal* owner;
+            std::uint64_t id;
+            T* value;
+        };
+        static thread_local std::array<CacheEntry, 4> cache = {};
+        static thread_local std::size_t nextEntry = 0;
+        for (auto&& entry : cache) {
+            if (entry.owner == this && entry.id == _id) {
+                return *entry.value;
+            }
+        }
+
+        T* value = nullptr;
+        {
+            auto threadId = std::this_thread::get_id();
+            std::lock_guard<std::mutex> lock{_mutex};
+            auto itThreadLocal = _map.find(threadId);
+            if (itThreadLocal != _map.end()) {
+                value = &itThreadLocal->second;
+            } else {
+                value = &_map.emplace(threadId, _create()).first->second;
+            }
         }
+        cache[nextEntry] = {this, _id, value};
+        nextEntry = (nextEntry + 1) % cache.size();
+        return *value;
     }
 
     auto size() const -> decltype(_map.size())  {
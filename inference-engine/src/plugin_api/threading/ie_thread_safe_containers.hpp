@@ -0,0 +1,197 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_thread_safe_containers.hpp
+ * @brief A header file for queues that are used to pass tasks and requests between threads
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+
+#include "ie_parallel.hpp"
+
+#if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
+# include <tbb/concurrent_queue.h>
+#endif
+
+namespace InferenceEngine {
+
+#if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
+template <typename T>
+using ThreadSafeQueue = tbb::concurrent_queue<T>;
+#else
+/**
+ * @brief Unbounded multiple producers multiple consumers queue
+ * @ingroup ie_dev_api_threading
+ * @tparam T A type of the queue elements
+ */
+template <typename T>
+class ThreadSafeQueue {
+public:
+    /**
+     * @brief Pushes the value to the queue tail
+     * @param value The value to push
+     */
+    void push(T value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push(std::move(value));
+    }
+
+    /**
+     * @brief Pops the value from the queue head if the queue is not empty
+     * @param value The popped value
+     * @return `true` if the value is popped
+     */
+    bool try_pop(T& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_queue.empty()) {
+            value = std::move(_queue.front());
+            _queue.pop();
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+protected:
+    std::queue<T>   _queue;
+    std::mutex      _mutex;
+};
+#endif
+
+/**
+ * @brief Bounded lock-free multiple producers multiple consumers queue
+ * @details The queue is a ring of cells with sequence numbers: a producer (consumer) claims the cell by the
+ * compare-and-swap of the tail (head) position and publishes it by the cell sequence, so neither push nor pop
+ * takes a lock. An operation waits only for a concurrent one that has claimed the same cell but has not published
+ * it yet, so a push does not fail while the queue has room. The capacity is rounded up to the power of two.
+ * @ingroup ie_dev_api_threading
+ * @tparam T A type of the queue elements
+ */
+template <typename T>
+class ThreadSafeBoundedQueue {
+public:
+    ThreadSafeBoundedQueue() = default;
+
+    /**
+     * @brief Pushes the value to the queue tail
+     * @param value The value to push
+     * @return `false` if the queue is full or the capacity is zero
+     */
+    bool try_push(T value) {
+        if (!_open.load(std::memory_order_acquire)) {
+            return false;
+        }
+        Cell* cell = nullptr;
+        auto pos = _tail.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (0 == diff) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the cell is either still occupied (the queue is full) or is being released by a lagging pop
+                const auto head = _head.load(std::memory_order_acquire);
+                if (_tail.load(std::memory_order_relaxed) - head > _mask) {
+                    return false;
+                }
+                std::this_thread::yield();
+                pos = _tail.load(std::memory_order_relaxed);
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the value from the queue head
+     * @param value The popped value
+     * @return `false` if the queue is empty or the capacity is zero
+     */
+    bool try_pop(T& value) {
+        if (!_open.load(std::memory_order_acquire)) {
+            return false;
+        }
+        Cell* cell = nullptr;
+        auto pos = _head.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (0 == diff) {
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the cell is either empty (the queue is empty) or is being published by a lagging push
+                if (_tail.load(std::memory_order_acquire) == pos) {
+                    return false;
+                }
+                std::this_thread::yield();
+                pos = _head.load(std::memory_order_relaxed);
+            } else {
+                pos = _head.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Sets the queue capacity
+     * @note The non-zero capacity should be set before the queue is used, while the zero capacity closes
+     * the queue, so pushes and pops fail, and can be set concurrently with them
+     * @param newCapacity The capacity of the queue
+     */
+    void set_capacity(std::size_t newCapacity) {
+        if (0 == newCapacity) {
+            _open.store(false, std::memory_order_release);
+            return;
+        }
+        std::size_t size = 1;
+        while (size < newCapacity) {
+            size <<= 1;
+        }
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+        _mask = size - 1;
+        _head.store(0, std::memory_order_relaxed);
+        _tail.store(0, std::memory_order_relaxed);
+        _open.store(true, std::memory_order_release);
+    }
+
+protected:
+    struct Cell {
+        std::atomic<std::size_t>    _sequence = {0};
+        T                           _value;
+    };
+    // the positions are on separate cache lines, so producers and consumers do not invalidate each other
+    static constexpr std::size_t cacheLineSize = 64;
+    std::atomic<std::size_t>                _head = {0};
+    char                                    _headPadding[cacheLineSize - sizeof(std::atomic<std::size_t>)];
+    std::atomic<std::size_t>                _tail = {0};
+    char                                    _tailPadding[cacheLineSize - sizeof(std::atomic<std::size_t>)];
+    std::unique_ptr<Cell[]>                 _cells;
+    std::size_t                             _mask = 0;
+    std::atomic<bool>                       _open = {false};
+};
+
+}  // namespace InferenceEngine
@@ -126,6 +126,49 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void calcRowLinear_32F(float *dst[],
+                       const float *src0[],
+                       const float *src1[],
+                       const float  alpha[],
+                       const int    mapsx[],
+                       const float  beta[],
+                       const Size&  inSz,
+                       const Size&  outSz,
+                               int  lpi) {
+    calcRowLinear_32FC1(dst, src0, src1, alpha, mapsx, beta, inSz, outSz, lpi);
+}
+
+void convertRow_8U32F(const uint8_t in[], float out[], int length) {
+    convertRow_8U32F_impl(in, out, length);
+}
+
+void convertRow_16U32F(const uint16_t in[], float out[], int length) {
+    convertRow_16U32F_impl(in, out, length);
+}
+
+void convertRow_32F8U(const float in[], uint8_t out[], int length) {
+    convertRow_32F8U_impl(in, out, length);
+}
+
+void convertRow_32F16U(const float in[], uint16_t out[], int length) {
+    convertRow_32F16U_impl(in, out, length);
+}
+
+void convertRowMeanScale_8U32F(const uint8_t in[], float out[], int length,
+                               float mean, float scale) {
+    convertRowMeanScale_8U32F_impl(in, out, length, mean, scale);
+}
+
+void convertRowMeanScale_16U32F(const uint16_t in[], float out[], int length,
+                                float mean, float scale) {
+    convertRowMeanScale_16U32F_impl(in, out, length, mean, scale);
+}
+
+void convertRowMeanScale_32F32F(const float in[], float out[], int length,
+                                float mean, float scale) {
+    convertRowMeanScale_32F32F_impl(in, out, length, mean, scale);
+}
+
 }  // namespace neon
 }  // namespace kernels
 }  // namespace gapi
@@ -201,6 +201,40 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+void convertRow_8U32F(const uint8_t in[],
+                            float out[],
+                              int length);
+
+void convertRow_16U32F(const uint16_t in[],
+                                float out[],
+                                  int length);
+
+void convertRow_32F8U(const float in[],
+                          uint8_t out[],
+                              int length);
+
+void convertRow_32F16U(const float in[],
+                          uint16_t out[],
+                               int length);
+
+void convertRowMeanScale_8U32F(const uint8_t in[],
+                                     float out[],
+                                       int length,
+                                     float mean,
+                                     float scale);
+
+void convertRowMeanScale_16U32F(const uint16_t in[],
+                                       float out[],
+                                         int length,
+                                       float mean,
+                                       float scale);
+
+void convertRowMeanScale_32F32F(const float in[],
+                                      float out[],
+                                        int length,
+                                      float mean,
+                                      float scale);
+
 }  // namespace avx
 }  // namespace kernels
 }  // namespace gapi
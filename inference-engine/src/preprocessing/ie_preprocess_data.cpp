@@ -775,6 +775,9 @@ public:
 
     void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
 
+    bool executeWithMeanValues(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial,
+                               int batchSize = -1) override;
+
     void Release() noexcept override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
@@ -823,6 +826,11 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
                              "there's nothing to be done";
     }
 
+    if (_userBlob->is<ROIBatchedBlob>()) {
+        THROW_IE_EXCEPTION << "Pre-processing of a batch of ROIs is unsupported in this mode. "
+                              "Use default pre-processing instead to process batches of ROIs.";
+    }
+
     if (batchSize > 1) {
         THROW_IE_EXCEPTION << "Batch pre-processing is unsupported in this mode. "
                               "Use default pre-processing instead to process batches.";
@@ -879,6 +887,42 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
     }
 }
 
+bool PreProcessData::executeWithMeanValues(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial,
+        int batchSize) {
+    // mean values are fused into the G-API graph only, the graph writes them to FP32 output planes
+    const bool fusable = PreprocEngine::useGAPI()
+                         && info.getMeanVariant() == MEAN_VALUE
+                         && preprocessedBlob != nullptr
+                         && preprocessedBlob->getTensorDesc().getPrecision() == Precision::FP32
+                         && preprocessedBlob->getTensorDesc().getDims().size() == 4
+                         && preprocessedBlob->getTensorDesc().getDims()[1] == info.getNumberOfChannels();
+    if (!fusable) {
+        execute(preprocessedBlob, info, serial, batchSize);
+        return false;
+    }
+
+    OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Preprocessing");
+
+    if (_userBlob == nullptr) {
+        THROW_IE_EXCEPTION << "Input pre-processing is called with null _userBlob";
+    }
+
+    PreprocEngine::MeanScale meanScale;
+    meanScale.reserve(info.getNumberOfChannels());
+    for (size_t c = 0; c < info.getNumberOfChannels(); ++c) {
+        meanScale.emplace_back(info[c]->meanValue, info[c]->stdScale);
+    }
+
+    batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _userBlob);
+
+    if (!_preproc) {
+        _preproc.reset(new PreprocEngine);
+    }
+
+    return _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, info.getResizeAlgorithm(), info.getColorFormat(),
+                                        serial, batchSize, meanScale);
+}
+
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // if G-API pre-processing is used, let it check that pre-processing is applicable
     if (PreprocEngine::useGAPI()) {
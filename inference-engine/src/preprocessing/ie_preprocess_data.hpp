@@ -57,6 +57,20 @@ public:
      */
     virtual void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
 
+    /**
+     * @brief Executes input pre-processing and applies per-channel mean values and scales of the pre-processing
+     * information in the same pass, so the pre-processed blob holds `(value - meanValue) * stdScale`.
+     * @note Only MEAN_VALUE variant and FP32 pre-processed blob are supported, otherwise the method falls back to
+     * execute() and the caller is responsible for mean values and scales.
+     * @param preprocessedBlob pre-processed output blob to be used for inference.
+     * @param info pre-processing info that specifies resize algorithm, color format and mean values.
+     * @param serial disable OpenMP threading if the value set to true.
+     * @param batchSize batch size for pre-processing.
+     * @return `true` if mean values and scales are applied to the pre-processed blob
+     */
+    virtual bool executeWithMeanValues(Blob::Ptr &preprocessedBlob, const PreProcessInfo& info, bool serial,
+                                       int batchSize = -1) = 0;
+
     //FIXME: rename to verifyAplicable
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
 };
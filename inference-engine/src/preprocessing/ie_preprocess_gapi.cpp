@@ -10,6 +10,7 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <iterator>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -549,7 +550,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const PreprocEngine::MeanScale &mean_scale) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -664,7 +666,16 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
+    if (!mean_scale.empty()) {
+        // mean values and scales are applied by the same kernel which converts planes to the output precision
+        if (out_desc.prec != CV_32F || static_cast<int>(mean_scale.size()) != out_desc.d.C) {
+            THROW_IE_EXCEPTION << "[G-API] internal error: mean values and scales are applicable to "
+                               << "FP32 output with " << out_desc.d.C << " channels only";
+        }
+        for (std::size_t c = 0; c < outputs.size(); ++c) {
+            outputs[c] = gapi::ConvertDepthMeanScale::on(outputs[c], mean_scale[c].first, mean_scale[c].second);
+        }
+    } else if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
         auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
             std::vector<cv::GMat> dst_gmats;
             std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
@@ -684,7 +695,44 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+PreprocEngine::PreprocEngine() = default;
+
+PreprocEngine::~PreprocEngine() {
+    // let other engines reuse the graphs compiled by this one
+    if (_lastCall && !_lastComp.empty()) {
+        _cache->put({*_lastCall, static_cast<int>(_lastComp.size())}, std::move(_lastComp));
+    }
+}
+
+std::shared_ptr<PreprocEngine::CompiledCache> PreprocEngine::CompiledCache::get() {
+    // engines hold the cache, so it outlives engines destroyed after the static objects
+    static const auto cache = std::make_shared<CompiledCache>();
+    return cache;
+}
+
+cv::util::optional<PreprocEngine::CompiledSlices> PreprocEngine::CompiledCache::take(const Key &key) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // the most recently released graphs are the most likely ones to be requested again
+    for (auto it = _idle.rbegin(); it != _idle.rend(); ++it) {
+        if (it->first == key) {
+            auto slices = std::move(it->second);
+            _idle.erase(std::next(it).base());
+            return cv::util::make_optional(std::move(slices));
+        }
+    }
+    return {};
+}
+
+void PreprocEngine::CompiledCache::put(Key key, CompiledSlices slices) {
+    // bounds the memory held by graphs compiled for descriptors which are not used anymore
+    constexpr std::size_t max_idle = 64;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _idle.emplace_back(std::move(key), std::move(slices));
+    if (_idle.size() > max_idle) {
+        _idle.pop_front();
+    }
+}
 
 PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
     // Given our knowledge about Fluid, full graph rebuild is required
@@ -695,6 +743,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
+    // 6. mean values or scales have changed (they are kernel parameters)
     if (!_lastCall) {
         return Update::REBUILD;
     }
@@ -702,13 +751,15 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    MeanScale last_mean_scale;
+    std::tie(last_in, last_out, last_algo, last_mean_scale) = *_lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    MeanScale new_mean_scale;
+    std::tie(new_in, new_out, new_algo, new_mean_scale) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -724,7 +775,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_mean_scale != new_mean_scale) {
         return Update::REBUILD;
     }
 
@@ -769,6 +820,19 @@ bool PreprocEngine::useGAPI() {
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
+    // every ROI of a batch of ROIs is pre-processed to its own batch element of dst
+    if (auto roisBlob = as<ROIBatchedBlob>(src)) {
+        if (dst->is<MemoryBlob>() && dst->getTensorDesc().getDims().size() == 4 &&
+            roisBlob->size() > dst->getTensorDesc().getDims()[0]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Number of ROIs " << roisBlob->size()
+                               << " is greater than the network's batch size " << dst->getTensorDesc().getDims()[0];
+        }
+        for (size_t i = 0; i < roisBlob->size(); ++i) {
+            checkApplicabilityGAPI(roisBlob->getBlob(i), dst);
+        }
+        return;
+    }
+
     // src is either a memory blob, an NV12, or an I420 blob
     const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
     if (!src->is<MemoryBlob>() && !yuv420_blob) {
@@ -807,7 +871,17 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (blob->is<ROIBatchedBlob>()) {
+        // a batch of ROIs is processed up to the number of ROIs
+        const auto rois_number = static_cast<int>(blob->size());
+        if (batch > rois_number) {
+            THROW_IE_EXCEPTION  << "Provided batch size " << batch
+                                << " is greater than the number of ROIs " << rois_number;
+        }
+        if (batch < 0) {
+            batch = rois_number;
+        }
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
@@ -824,25 +898,17 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
 
 void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
-    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
+    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size,
     Update update) {
 
-    const int thread_num =
-#if IE_THREAD == IE_THREAD_OMP
-        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
-#endif
-        0;                  // use all available threads
-
-    // to suppress unused warnings
-    (void)(omp_serial);
-
-    // Split the whole graph into `total_slices` slices, where
-    // `total_slices` is provided by the parallel runtime and assumed
-    // to be number of threads used.  However it is not guaranteed
-    // that an actual number of threads will be as assumed, so it
-    // possible that all slices are processed by the same thread.
-    //
-    parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
+    // Split the whole graph into `total_slices` slices of output rows,
+    // one per thread of the calling stream (see getSlicesNumber).
+    // The runtime may provide less threads than requested, so a
+    // thread processes every slice with the index matching its own
+    // one modulo the number of threads: all slices are computed and
+    // the slice compiled for a ROI is always run for the same ROI.
+    const int total_slices = static_cast<int>(_lastComp.size());
+    auto processSlice = [&, this](const int slice_n) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
         auto& compiled = _lastComp[slice_n];
@@ -871,7 +937,10 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
                     remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
             }
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
+            if (lines_per_thread <= 0) {
+                compiled = cv::GCompiled{};  // no job for current slice
+                return;
+            }
 
             auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
@@ -888,6 +957,8 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             }
         }
 
+        if (!compiled) return;  // the output has less rows than slices
+
         for (int i = 0; i < batch_size; ++i) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
@@ -900,13 +971,36 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_graph);
             compiled(std::move(call_ins), std::move(call_outs));
         }
+    };
+
+    parallel_nt_static(total_slices, [&](const int ithr, const int nthr) {
+        for (int slice_n = ithr; slice_n < total_slices; slice_n += nthr) {
+            processSlice(slice_n);
+        }
     });
 }
 
+int PreprocEngine::getSlicesNumber(bool omp_serial) {
+#if IE_THREAD == IE_THREAD_OMP
+    // disable threading for OpenMP if was asked for
+    if (omp_serial) {
+        return 1;
+    }
+#endif
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    // the concurrency of the calling thread: when pre-processing runs in a stream of a streams executor
+    // it is the number of the stream threads (TBB arena or OpenMP threads of the stream), so all stream
+    // threads share the rows of a large image in the latency mode, while streams of one thread each
+    // do not oversubscribe the cores in the throughput mode
+    return std::max(1, parallel_get_max_threads());
+}
+
 template<typename BlobTypePtr>
 bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const MeanScale &mean_scale) {
 
     validateBlob(inBlob);
 
@@ -948,15 +1042,39 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  mean_scale };
 
-    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
+    if (algorithm == NO_RESIZE && mean_scale.empty() && std::get<0>(thisCall) == std::get<1>(thisCall)) {
         //if requested output parameters match input blob no need to do anything
         THROW_IE_EXCEPTION  << "No job to do in the PreProcessing ?";
         return true;
     }
 
-    const Update update = needUpdate(thisCall);
+    Update update = needUpdate(thisCall);
+
+    // graph is compiled for the ROI of every slice, so it must be compiled again if the number of slices changes
+    // (e.g. the request is called synchronously and then asynchronously in a stream with another number of threads)
+    const auto slices_number = getSlicesNumber(omp_serial);
+    if (static_cast<int>(_lastComp.size()) != slices_number) {
+        update = Update::REBUILD;
+    }
+
+    if (Update::NOTHING != update) {
+        // take the graphs compiled for this call by another engine (or by this one earlier), if there are any,
+        // otherwise the current graphs are either released to the cache and new ones are compiled, or reshaped
+        auto cached = _cache->take({thisCall, slices_number});
+        if (cached || Update::REBUILD == update) {
+            if (_lastCall && !_lastComp.empty()) {
+                _cache->put({*_lastCall, static_cast<int>(_lastComp.size())}, std::move(_lastComp));
+            }
+            _lastComp = cached ? std::move(cached.value()) : CompiledSlices(slices_number);
+        }
+        if (cached) {
+            _lastCall = cv::util::make_optional(std::move(thisCall));
+            update = Update::NOTHING;
+        }
+    }
 
     Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
@@ -974,21 +1092,42 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            out_layout,
                            algorithm,
                            in_fmt,
-                           out_fmt));
+                           out_fmt,
+                           mean_scale));
         }
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size, update);
+
+    return true;
+}
+
+bool PreprocEngine::preprocessROIs(const ROIBatchedBlob::Ptr &inBlob, const MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const MeanScale &mean_scale) {
+    const auto& out_dims = outBlob->getTensorDesc().getDims();
+    if (out_dims.size() != 4 || inBlob->size() > out_dims[0]) {
+        THROW_IE_EXCEPTION  << "Number of ROIs " << inBlob->size() << " does not fit the network's input "
+                            << details::dumpVec(out_dims);
+    }
 
+    // the ROIs share the image memory and each one is resized right into its batch element of the network's
+    // input, so no ROI is copied out of the image. ROIs of equal sizes reuse the graphs compiled for each other
+    for (int i = 0; i < batch_size; ++i) {
+        Blob::Ptr outItem = outBlob->createROI(ROI{static_cast<size_t>(i), 0, 0, out_dims[3], out_dims[2]});
+        if (!preprocessWithGAPI(inBlob->getBlob(i), outItem, algorithm, in_fmt, omp_serial, 1, mean_scale)) {
+            return false;
+        }
+    }
     return true;
 }
 
 bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const MeanScale &mean_scale) {
     if (!useGAPI()) {
         return false;
     }
@@ -1001,6 +1140,10 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
         THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
     }
 
+    if (auto roisBlob = as<ROIBatchedBlob>(inBlob)) {
+        return preprocessROIs(roisBlob, outMemoryBlob, algorithm, in_fmt, omp_serial, batch_size, mean_scale);
+    }
+
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
     // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
@@ -1012,7 +1155,7 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, mean_scale);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1021,7 +1164,7 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, mean_scale);
     }
 
     default:
@@ -1031,7 +1174,7 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, mean_scale);
     }
 }
 }  // namespace InferenceEngine
@@ -8,7 +8,11 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <list>
+#include <memory>
+#include <mutex>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
@@ -22,12 +26,38 @@
 namespace InferenceEngine {
 
 class PreprocEngine {
+public:
+    // per-channel mean value and scale that are applied as (value - mean) * scale
+    using MeanScale = std::vector<std::pair<float, float>>;
+
+private:
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, MeanScale>;
     template<typename T> using Opt = cv::util::optional<T>;
 
+    using CompiledSlices = std::vector<cv::GCompiled>;
+
+    // Compiled graphs which are not used by any engine at the moment. A compiled graph is not thread-safe, so
+    // an engine takes the slices compiled for its call out of the cache and puts them back when its call changes
+    // or the engine is destroyed: infer requests switching between the same input resolutions reuse graphs
+    // compiled by each other instead of compiling their own ones.
+    class CompiledCache {
+    public:
+        using Key = std::pair<CallDesc, int>;  // call descriptor and number of slices
+
+        Opt<CompiledSlices> take(const Key &key);
+        void put(Key key, CompiledSlices slices);
+
+        static std::shared_ptr<CompiledCache> get();
+
+    private:
+        std::mutex _mutex;
+        std::list<std::pair<Key, CompiledSlices>> _idle;  // the least recently released graphs come first
+    };
+
     Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    CompiledSlices _lastComp;
+    std::shared_ptr<CompiledCache> _cache = CompiledCache::get();
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -41,21 +71,28 @@ class PreprocEngine {
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
-                      bool omp_serial,
                       Update update);
 
+    // number of output row slices processed in parallel by the calling thread
+    static int getSlicesNumber(bool omp_serial);
+
     template<typename BlobTypePtr>
     bool preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, const MeanScale &mean_scale);
+
+    bool preprocessROIs(const ROIBatchedBlob::Ptr &inBlob, const MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const MeanScale &mean_scale);
 
 public:
     PreprocEngine();
+    ~PreprocEngine();
     static bool useGAPI();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     bool preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1, const MeanScale &mean_scale = {});
 };
 
 }  // namespace InferenceEngine
@@ -1100,6 +1100,19 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
     }
     #endif  // HAVE_SSE
 
+    #ifdef HAVE_NEON
+    if (std::is_same<T, float>::value) {
+        neon::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                reinterpret_cast<const float**>(src0),
+                                reinterpret_cast<const float**>(src1),
+                                reinterpret_cast<const float*>(alpha),
+                                reinterpret_cast<const int*>(mapsx),
+                                reinterpret_cast<const float*>(beta),
+                                inSz, outSz, lpi);
+        return;
+    }
+    #endif  // HAVE_NEON
+
     for (int l = 0; l < lpi; l++) {
         constexpr static const auto unity = Mapper::unity;
 
@@ -1636,6 +1649,34 @@ static void calcAreaRow(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer
         }
         #endif  // HAVE_SSE
 
+        #ifdef HAVE_NEON
+        if (std::is_same<T, uchar>::value) {
+            neon::calcRowArea_8U(reinterpret_cast<uchar*>(dst),
+                                 reinterpret_cast<const uchar**>(src),
+                                 inSz, outSz,
+                                 static_cast<Q0_16>(ymapper.alpha),
+                                 reinterpret_cast<const MapperUnit8U&>(ymap),
+                                 xmaxdf[0],
+                                 reinterpret_cast<const short*>(xindex),
+                                 reinterpret_cast<const Q0_16*>(xalpha),
+                                 reinterpret_cast<Q8_8*>(vbuf));
+            continue;  // next l = 0, ..., lpi-1
+        }
+
+        if (std::is_same<T, float>::value) {
+            neon::calcRowArea_32F(reinterpret_cast<float*>(dst),
+                                  reinterpret_cast<const float**>(src),
+                                  inSz, outSz,
+                                  static_cast<float>(ymapper.alpha),
+                                  reinterpret_cast<const MapperUnit32F&>(ymap),
+                                  xmaxdf[0],
+                                  reinterpret_cast<const int*>(xindex),
+                                  reinterpret_cast<const float*>(xalpha),
+                                  reinterpret_cast<float*>(vbuf));
+            continue;
+        }
+        #endif  // HAVE_NEON
+
         // vertical pass
         int y_1st = ymap.index0;
         int ylast = ymap.index1 - 1;
@@ -2329,6 +2370,42 @@ GAPI_FLUID_KERNEL(FI420toRGB, I420toRGB, false) {
     }
 };
 
+// calls the row function of the best instruction set supported by the CPU (the last call is not vectorized)
+#define DISPATCH_ROW_FUNC(func, scalar_call, ...)    \
+    CALL_AVX512_ROW_FUNC(func, __VA_ARGS__)          \
+    CALL_AVX2_ROW_FUNC(func, __VA_ARGS__)            \
+    CALL_SSE_ROW_FUNC(func, __VA_ARGS__)             \
+    CALL_NEON_ROW_FUNC(func, __VA_ARGS__)            \
+    scalar_call;
+
+#ifdef HAVE_AVX512
+#define CALL_AVX512_ROW_FUNC(func, ...) \
+    if (with_cpu_x86_avx512_core()) { avx512::func(__VA_ARGS__); return; }
+#else
+#define CALL_AVX512_ROW_FUNC(func, ...)
+#endif
+
+#ifdef HAVE_AVX2
+#define CALL_AVX2_ROW_FUNC(func, ...) \
+    if (with_cpu_x86_avx2()) { avx::func(__VA_ARGS__); return; }
+#else
+#define CALL_AVX2_ROW_FUNC(func, ...)
+#endif
+
+#ifdef HAVE_SSE
+#define CALL_SSE_ROW_FUNC(func, ...) \
+    if (with_cpu_x86_sse42()) { func(__VA_ARGS__); return; }
+#else
+#define CALL_SSE_ROW_FUNC(func, ...)
+#endif
+
+#ifdef HAVE_NEON
+#define CALL_NEON_ROW_FUNC(func, ...) \
+    { neon::func(__VA_ARGS__); return; }
+#else
+#define CALL_NEON_ROW_FUNC(func, ...)
+#endif
+
 namespace {
     template <typename src_t, typename dst_t>
     void convert_precision(const uint8_t* src, uint8_t* dst, const int width) {
@@ -2339,6 +2416,36 @@ namespace {
             out[i] = saturate_cast<dst_t>(in[i]);
         }
     }
+
+    // conversions to and from the network precisions are vectorized, the rest ones are rare
+    template <typename src_t, typename dst_t>
+    void convert_row(const uint8_t* src, uint8_t* dst, const int width) {
+        convert_precision<src_t, dst_t>(src, dst, width);
+    }
+
+    template <>
+    void convert_row<uint8_t, float>(const uint8_t* src, uint8_t* dst, const int width) {
+        DISPATCH_ROW_FUNC(convertRow_8U32F, (convert_precision<uint8_t, float>(src, dst, width)),
+                          src, reinterpret_cast<float*>(dst), width)
+    }
+
+    template <>
+    void convert_row<uint16_t, float>(const uint8_t* src, uint8_t* dst, const int width) {
+        DISPATCH_ROW_FUNC(convertRow_16U32F, (convert_precision<uint16_t, float>(src, dst, width)),
+                          reinterpret_cast<const uint16_t*>(src), reinterpret_cast<float*>(dst), width)
+    }
+
+    template <>
+    void convert_row<float, uint8_t>(const uint8_t* src, uint8_t* dst, const int width) {
+        DISPATCH_ROW_FUNC(convertRow_32F8U, (convert_precision<float, uint8_t>(src, dst, width)),
+                          reinterpret_cast<const float*>(src), dst, width)
+    }
+
+    template <>
+    void convert_row<float, uint16_t>(const uint8_t* src, uint8_t* dst, const int width) {
+        DISPATCH_ROW_FUNC(convertRow_32F16U, (convert_precision<float, uint16_t>(src, dst, width)),
+                          reinterpret_cast<const float*>(src), reinterpret_cast<uint16_t*>(dst), width)
+    }
 }
 
 GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
@@ -2356,9 +2463,9 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
         using table_string_t = std::array<p_f, supported_types_n>;
 
         constexpr std::array<table_string_t, supported_types_n> func_table = {
-                table_string_t{convert_precision<uint16_t, uint16_t>, convert_precision<uint16_t, float>, convert_precision<uint16_t, uint8_t>},
-                table_string_t{convert_precision<float,    uint16_t>, convert_precision<float,    float>, convert_precision<float,    uint8_t>},
-                table_string_t{convert_precision<uint8_t,  uint16_t>, convert_precision<uint8_t,  float>, convert_precision<uint8_t,  uint8_t>}
+                table_string_t{convert_row<uint16_t, uint16_t>, convert_row<uint16_t, float>, convert_row<uint16_t, uint8_t>},
+                table_string_t{convert_row<float,    uint16_t>, convert_row<float,    float>, convert_row<float,    uint8_t>},
+                table_string_t{convert_row<uint8_t,  uint16_t>, convert_row<uint8_t,  float>, convert_row<uint8_t,  uint8_t>}
         };
 
         auto depth_to_index = [](int depth){
@@ -2380,6 +2487,74 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+namespace {
+    template <typename src_t>
+    void convert_mean_scale_precision(const uint8_t* src, float* dst, const int width, const float mean,
+                                      const float scale) {
+        const auto *in = reinterpret_cast<const src_t *>(src);
+
+        for (int i = 0; i < width; i++) {
+            dst[i] = (static_cast<float>(in[i]) - mean) * scale;
+        }
+    }
+
+    template <typename src_t>
+    void convert_mean_scale(const uint8_t* src, float* dst, const int width, const float mean, const float scale);
+
+    template <>
+    void convert_mean_scale<uint8_t>(const uint8_t* src, float* dst, const int width, const float mean,
+                                     const float scale) {
+        DISPATCH_ROW_FUNC(convertRowMeanScale_8U32F,
+                          (convert_mean_scale_precision<uint8_t>(src, dst, width, mean, scale)),
+                          src, dst, width, mean, scale)
+    }
+
+    template <>
+    void convert_mean_scale<uint16_t>(const uint8_t* src, float* dst, const int width, const float mean,
+                                      const float scale) {
+        DISPATCH_ROW_FUNC(convertRowMeanScale_16U32F,
+                          (convert_mean_scale_precision<uint16_t>(src, dst, width, mean, scale)),
+                          reinterpret_cast<const uint16_t*>(src), dst, width, mean, scale)
+    }
+
+    template <>
+    void convert_mean_scale<float>(const uint8_t* src, float* dst, const int width, const float mean,
+                                   const float scale) {
+        DISPATCH_ROW_FUNC(convertRowMeanScale_32F32F,
+                          (convert_mean_scale_precision<float>(src, dst, width, mean, scale)),
+                          reinterpret_cast<const float*>(src), dst, width, mean, scale)
+    }
+}
+
+#undef DISPATCH_ROW_FUNC
+#undef CALL_AVX512_ROW_FUNC
+#undef CALL_AVX2_ROW_FUNC
+#undef CALL_SSE_ROW_FUNC
+#undef CALL_NEON_ROW_FUNC
+
+GAPI_FLUID_KERNEL(FConvertDepthMeanScale, ConvertDepthMeanScale, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, float mean, float scale, cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F || src.meta().depth == CV_16U);
+        GAPI_Assert(dst.meta().depth == CV_32F);
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        const auto *in  = src.InLineB(0);
+              auto *out = dst.OutLine<float>();
+
+        auto const width = dst.length();
+        switch (src.meta().depth) {
+            case CV_8U:  convert_mean_scale<uint8_t>(in, out, width, mean, scale);  break;
+            case CV_16U: convert_mean_scale<uint16_t>(in, out, width, mean, scale); break;
+            case CV_32F: convert_mean_scale<float>(in, out, width, mean, scale);    break;
+            default: GAPI_Assert(!"not supported depth");
+        }
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2407,6 +2582,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FConvertDepth
+        , FConvertDepthMeanScale
         >();
 }
 
@@ -152,6 +152,14 @@ namespace gapi {
         }
     };
 
+    // converts the plane to FP32 and computes (value - mean) * scale in the same pass
+    G_TYPED_KERNEL(ConvertDepthMeanScale, <cv::GMat(cv::GMat, float mean, float scale)>, "com.intel.ie.ConvertDepthMeanScale") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, float, float) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_32F);
+
+            return in.withDepth(CV_32F);
+        }
+    };
 
 
     cv::gapi::GKernelPackage preprocKernels();
@@ -796,7 +796,7 @@ static inline void calcRowLinear_32FC1(float *dst[],
     bool xRatioEq1 = inSz.width == outSz.width;
     bool yRatioEq1 = inSz.height == outSz.height;
 
-#if CPU_SIMD
+#if MANUAL_SIMD
     const int nlanes = v_float32::nlanes;
 #endif
 
@@ -807,7 +807,7 @@ static inline void calcRowLinear_32FC1(float *dst[],
 
             int x = 0;
 
-#if CPU_SIMD
+#if MANUAL_SIMD
             for (; x <= outSz.width - nlanes; x += nlanes) {
                 v_float32 alpha0 = vx_load(&alpha[x]);
                 //  v_float32 alpha1 = 1.f - alpha0;
@@ -850,7 +850,7 @@ static inline void calcRowLinear_32FC1(float *dst[],
         for (int line = 0; line < lpi; ++line) {
             int x = 0;
 
-#if CPU_SIMD
+#if MANUAL_SIMD
             for (; x <= outSz.width - nlanes; x += nlanes) {
                 v_float32 alpha0 = vx_load(&alpha[x]);
                 //  v_float32 alpha1 = 1.f - alpha0;
@@ -885,7 +885,7 @@ static inline void calcRowLinear_32FC1(float *dst[],
 
             int x = 0;
 
-#if CPU_SIMD
+#if MANUAL_SIMD
             for (; x <= length - nlanes; x += nlanes) {
                 v_float32 s0 = vx_load(&src0[line][x]);
                 v_float32 s1 = vx_load(&src1[line][x]);
@@ -911,6 +911,140 @@ static inline void calcRowLinear_32FC1(float *dst[],
     }
 }
 
+//------------------------------------------------------------------------------
+
+// Convert depth (rounding and saturation are the same as of saturate_cast)
+inline void convertRow_8U32F_impl(const uint8_t in[], float out[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    for (; l <= length - nlanes; l += nlanes) {
+        v_float32 r = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(&in[l])));
+        vx_store(&out[l], r);
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = saturate_cast<float>(in[l]);
+    }
+}
+
+inline void convertRow_16U32F_impl(const uint16_t in[], float out[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    for (; l <= length - nlanes; l += nlanes) {
+        v_float32 r = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand(&in[l])));
+        vx_store(&out[l], r);
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = saturate_cast<float>(in[l]);
+    }
+}
+
+inline void convertRow_32F8U_impl(const float in[], uint8_t out[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_uint8::nlanes;
+    const int flanes = v_float32::nlanes;
+
+    for (; l <= length - nlanes; l += nlanes) {
+        v_int16 r0 = v_pack(v_round(vx_load(&in[l])),              v_round(vx_load(&in[l +     flanes])));
+        v_int16 r1 = v_pack(v_round(vx_load(&in[l + 2 * flanes])), v_round(vx_load(&in[l + 3 * flanes])));
+        vx_store(&out[l], v_pack_u(r0, r1));
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = saturate_cast<uint8_t>(in[l]);
+    }
+}
+
+inline void convertRow_32F16U_impl(const float in[], uint16_t out[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_uint16::nlanes;
+    const int flanes = v_float32::nlanes;
+
+    for (; l <= length - nlanes; l += nlanes) {
+        v_uint16 r = v_pack_u(v_round(vx_load(&in[l])), v_round(vx_load(&in[l + flanes])));
+        vx_store(&out[l], r);
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = saturate_cast<uint16_t>(in[l]);
+    }
+}
+
+// Convert depth to 32F and apply (value - mean) * scale
+inline void convertRowMeanScale_8U32F_impl(const uint8_t in[], float out[], int length,
+                                           float mean, float scale) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean  = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    for (; l <= length - nlanes; l += nlanes) {
+        v_float32 r = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(&in[l])));
+        vx_store(&out[l], (r - vmean) * vscale);
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (static_cast<float>(in[l]) - mean) * scale;
+    }
+}
+
+inline void convertRowMeanScale_16U32F_impl(const uint16_t in[], float out[], int length,
+                                            float mean, float scale) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean  = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    for (; l <= length - nlanes; l += nlanes) {
+        v_float32 r = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand(&in[l])));
+        vx_store(&out[l], (r - vmean) * vscale);
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (static_cast<float>(in[l]) - mean) * scale;
+    }
+}
+
+inline void convertRowMeanScale_32F32F_impl(const float in[], float out[], int length,
+                                            float mean, float scale) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean  = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    for (; l <= length - nlanes; l += nlanes) {
+        vx_store(&out[l], (vx_load(&in[l]) - vmean) * vscale);
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (in[l] - mean) * scale;
+    }
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -0,0 +1,415 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_binary_reader.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/variant.hpp>
+#include <transformations/rt_info/dequantization_attribute.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/primitives_priority_attribute.hpp>
+#include <transformations/serialize_binary.hpp>
+
+using namespace InferenceEngine;
+
+namespace {
+
+using AttributeType = ngraph::pass::SerializeBinary::AttributeType;
+using RuntimeInfoType = ngraph::pass::SerializeBinary::RuntimeInfoType;
+
+/**
+ * @brief Reads values from the memory in the format written by ngraph::pass::SerializeBinary
+ * and checks that the data is not truncated
+ */
+class BinaryStream {
+public:
+    BinaryStream(const char* data, size_t size): pos(data), end(data + size) {}
+
+    template <typename T>
+    T read() {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be read as is");
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    std::string readString() {
+        const auto size = read<uint64_t>();
+        return std::string(take(size), size);
+    }
+
+    template <typename T>
+    std::vector<T> readVector() {
+        const auto size = read<uint64_t>();
+        if (size > static_cast<uint64_t>(end - pos) / sizeof(T))
+            THROW_IE_EXCEPTION << "Unexpected end of the model data";
+        std::vector<T> values(size);
+        std::memcpy(values.data(), take(size * sizeof(T)), size * sizeof(T));
+        return values;
+    }
+
+    std::vector<std::string> readStrings() {
+        const auto size = read<uint64_t>();
+        std::vector<std::string> values;
+        for (uint64_t i = 0; i < size; ++i)
+            values.emplace_back(readString());
+        return values;
+    }
+
+private:
+    const char* pos;
+    const char* end;
+
+    const char* take(uint64_t size) {
+        if (size > static_cast<uint64_t>(end - pos))
+            THROW_IE_EXCEPTION << "Unexpected end of the model data";
+        const char* data = pos;
+        pos += size;
+        return data;
+    }
+};
+
+struct Attribute {
+    AttributeType type;
+    std::string payload;
+};
+
+/**
+ * @brief Sets attributes of an operation from the values saved by ngraph::pass::SerializeBinary
+ */
+class BinaryDeserializer : public ngraph::AttributeVisitor {
+public:
+    BinaryDeserializer(const std::map<std::string, Attribute>& attributes, const Blob::CPtr& weights)
+        : attributes(attributes), weights(weights) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (attributes.count(name))
+            THROW_IE_EXCEPTION << "Attribute adapter can not be found for " << name << " parameter";
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        const Attribute* attribute = find(name, AttributeType::Data);
+        if (!attribute) return;
+        uint64_t offset, size;
+        std::tie(offset, size) = getDataLocation(name, *attribute, weights);
+        if (size != adapter.size())
+            THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for " << name << " parameter";
+        std::memcpy(adapter.get_ptr(), weights->cbuffer().as<const char*>() + offset, size);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        uint8_t value;
+        if (get(name, AttributeType::Bool, value)) adapter.set(value != 0);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        set(name, AttributeType::String, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        set(name, AttributeType::Int64, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        set(name, AttributeType::Double, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        set(name, AttributeType::VectorInt8, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        set(name, AttributeType::VectorInt16, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        set(name, AttributeType::VectorInt32, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        set(name, AttributeType::VectorInt64, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        set(name, AttributeType::VectorUInt8, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        set(name, AttributeType::VectorUInt16, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        set(name, AttributeType::VectorUInt32, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        set(name, AttributeType::VectorUInt64, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        set(name, AttributeType::VectorFloat, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        set(name, AttributeType::VectorDouble, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        set(name, AttributeType::VectorString, adapter);
+    }
+
+    static std::pair<uint64_t, uint64_t> getDataLocation(const std::string& name, const Attribute& attribute,
+                                                         const Blob::CPtr& weights) {
+        BinaryStream stream(attribute.payload.data(), attribute.payload.size());
+        const auto location = stream.readVector<uint64_t>();
+        if (location.size() != 2)
+            THROW_IE_EXCEPTION << "Incorrect location of " << name << " data";
+        const uint64_t length = weights ? weights->byteSize() : 0;
+        if (!length)
+            THROW_IE_EXCEPTION << "Empty weights data in bin file or bin file cannot be found!";
+        if (location[0] > length || length - location[0] < location[1])
+            THROW_IE_EXCEPTION << "Incorrect weights in bin file!";
+        return {location[0], location[1]};
+    }
+
+private:
+    const std::map<std::string, Attribute>& attributes;
+    const Blob::CPtr& weights;
+
+    const Attribute* find(const std::string& name, AttributeType type) const {
+        auto it = attributes.find(name);
+        if (it == attributes.end()) return nullptr;
+        if (it->second.type != type)
+            THROW_IE_EXCEPTION << "Attribute " << name << " has unexpected type";
+        return &it->second;
+    }
+
+    template <typename T>
+    static void decode(BinaryStream& stream, T& value) {
+        value = stream.read<T>();
+    }
+    static void decode(BinaryStream& stream, std::string& value) {
+        value = stream.readString();
+    }
+    template <typename T>
+    static void decode(BinaryStream& stream, std::vector<T>& value) {
+        value = stream.readVector<T>();
+    }
+    static void decode(BinaryStream& stream, std::vector<std::string>& value) {
+        value = stream.readStrings();
+    }
+
+    template <typename T>
+    bool get(const std::string& name, AttributeType type, T& value) const {
+        const Attribute* attribute = find(name, type);
+        if (!attribute) return false;
+        BinaryStream stream(attribute->payload.data(), attribute->payload.size());
+        decode(stream, value);
+        return true;
+    }
+
+    template <typename T>
+    void set(const std::string& name, AttributeType type, ngraph::ValueAccessor<T>& adapter) const {
+        T value;
+        if (get(name, type, value)) adapter.set(value);
+    }
+};
+
+class BinaryParser {
+public:
+    BinaryParser(const std::vector<IExtensionPtr>& exts, bool shareWeights): shareWeights(shareWeights) {
+        opsets = {ngraph::get_opset1(), ngraph::get_opset2(), ngraph::get_opset3(),
+                  ngraph::get_opset4(), ngraph::get_opset5(), ngraph::get_opset6()};
+        for (const auto& ext : exts) {
+            for (const auto& it : ext->getOpSets())
+                opsets.emplace_back(it.second);
+        }
+    }
+
+    std::shared_ptr<ngraph::Function> parse(BinaryStream& stream, const Blob::CPtr& weights) {
+        if (stream.read<uint32_t>() != ngraph::pass::SerializeBinary::Magic)
+            THROW_IE_EXCEPTION << "The model is not in the nGraph binary format";
+        const auto version = stream.read<uint32_t>();
+        if (version != ngraph::pass::SerializeBinary::FormatVersion)
+            THROW_IE_EXCEPTION << "Unsupported version of the nGraph binary format: " << version;
+        const auto name = stream.readString();
+
+        const auto count = stream.read<uint64_t>();
+        std::vector<std::shared_ptr<ngraph::Node>> nodes;
+        std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
+        for (uint64_t id = 0; id < count; ++id) {
+            auto node = createNode(stream, nodes, weights);
+            if (auto read_value = std::dynamic_pointer_cast<ngraph::op::ReadValue>(node))
+                variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+            nodes.emplace_back(node);
+        }
+
+        const auto parameters = getNodes<ngraph::op::Parameter>(stream, nodes);
+        const auto results = getNodes<ngraph::op::Result>(stream, nodes);
+        const auto sinks = getNodes<ngraph::op::Sink>(stream, nodes);
+
+        auto function = std::make_shared<ngraph::Function>(results, sinks, parameters, name);
+        for (const auto& sink : sinks) {
+            if (auto assign = std::dynamic_pointer_cast<ngraph::op::Assign>(sink))
+                assign->add_control_dependency(variable_id_to_read_value.at(assign->get_variable_id()));
+        }
+        return function;
+    }
+
+private:
+    std::vector<ngraph::OpSet> opsets;
+    bool shareWeights;
+
+    const ngraph::OpSet& findOpSet(const std::string& type, uint64_t version) const {
+        const ngraph::NodeTypeInfo typeInfo{type.c_str(), version};
+        for (const auto& opset : opsets) {
+            if (opset.contains_type(typeInfo))
+                return opset;
+        }
+        THROW_IE_EXCEPTION << "Cannot create " << type << " operation of version " << version
+                           << ": the operation is not found in the registered opsets";
+    }
+
+    std::shared_ptr<ngraph::Node> createNode(BinaryStream& stream,
+                                             const std::vector<std::shared_ptr<ngraph::Node>>& nodes,
+                                             const Blob::CPtr& weights) {
+        const auto type = stream.readString();
+        const auto version = stream.read<uint64_t>();
+        const auto name = stream.readString();
+
+        ngraph::OutputVector inputs(stream.read<uint32_t>());
+        for (auto& input : inputs) {
+            const auto producer = stream.read<uint64_t>();
+            const auto port = stream.read<uint64_t>();
+            if (producer >= nodes.size() || port >= nodes[producer]->get_output_size())
+                THROW_IE_EXCEPTION << type << " operation " << name << " has incorrect input";
+            input = nodes[producer]->output(port);
+        }
+
+        std::map<std::string, Attribute> attributes;
+        while (true) {
+            auto attributeName = stream.readString();
+            const auto attributeType = static_cast<AttributeType>(stream.read<uint8_t>());
+            if (attributeType == AttributeType::End) break;
+            attributes[std::move(attributeName)] = Attribute{attributeType, stream.readString()};
+        }
+
+        std::shared_ptr<ngraph::Node> node;
+        if (shareWeights && type == ngraph::op::Constant::type_info.name &&
+            version == ngraph::op::Constant::type_info.version) {
+            node = createSharedConstant(attributes, weights);
+        } else {
+            node.reset(findOpSet(type, version).create(type));
+            node->set_arguments(inputs);
+            BinaryDeserializer visitor(attributes, weights);
+            if (node->visit_attributes(visitor))
+                node->constructor_validate_and_infer_types();
+        }
+        node->set_friendly_name(name);
+
+        readRtInfo(stream, *node);
+        return node;
+    }
+
+    std::shared_ptr<ngraph::Node> createSharedConstant(const std::map<std::string, Attribute>& attributes,
+                                                       const Blob::CPtr& weights) {
+        ngraph::element::Type type;
+        ngraph::Shape shape;
+        {
+            // the attributes are decoded by the same adapters which the constant uses to save them
+            BinaryDeserializer visitor(attributes, weights);
+            visitor.on_attribute("element_type", type);
+            visitor.on_attribute("shape", shape);
+        }
+
+        auto value = attributes.find("value");
+        if (value == attributes.end() || value->second.type != AttributeType::Data)
+            THROW_IE_EXCEPTION << "Constant has no value";
+        uint64_t offset, size;
+        std::tie(offset, size) = BinaryDeserializer::getDataLocation("value", value->second, weights);
+        if (size < std::ceil(ngraph::shape_size(shape) * type.bitwidth() / 8.f))
+            THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for Constant op!";
+
+        // the buffer holds weights blob, so the memory stays valid while the constant is alive
+        char* data = weights->cbuffer().as<char*>() + offset;
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<const Blob::CPtr>>(data, size, weights);
+        return std::make_shared<ngraph::op::Constant>(type, shape, buffer);
+    }
+
+    static void readRtInfo(BinaryStream& stream, ngraph::Node& node) {
+        auto& rtInfo = node.get_rt_info();
+        const auto count = stream.read<uint32_t>();
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto key = stream.readString();
+            switch (static_cast<RuntimeInfoType>(stream.read<uint8_t>())) {
+            case RuntimeInfoType::String:
+                rtInfo[key] = std::make_shared<ngraph::VariantWrapper<std::string>>(stream.readString());
+                break;
+            case RuntimeInfoType::Int64:
+                rtInfo[key] = std::make_shared<ngraph::VariantWrapper<int64_t>>(stream.read<int64_t>());
+                break;
+            case RuntimeInfoType::FusedNames: {
+                ngraph::FusedNames names;
+                for (const auto& name : stream.readStrings())
+                    names.fuseWith(ngraph::FusedNames(name));
+                rtInfo[key] = std::make_shared<ngraph::VariantWrapper<ngraph::FusedNames>>(names);
+                break;
+            }
+            case RuntimeInfoType::PrimitivesPriority:
+                rtInfo[key] = std::make_shared<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(
+                    ngraph::PrimitivesPriority(stream.readString()));
+                break;
+            case RuntimeInfoType::Dequantization:
+                rtInfo[key] = std::make_shared<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(
+                    ngraph::DequantizationAttr(stream.readString()));
+                break;
+            default:
+                THROW_IE_EXCEPTION << "Unknown type of runtime info " << key << " in " << node.get_friendly_name();
+            }
+        }
+    }
+
+    template <typename T>
+    static std::vector<std::shared_ptr<T>> getNodes(BinaryStream& stream,
+                                                    const std::vector<std::shared_ptr<ngraph::Node>>& nodes) {
+        std::vector<std::shared_ptr<T>> result(stream.read<uint32_t>());
+        for (auto& node : result) {
+            const auto id = stream.read<uint64_t>();
+            if (id >= nodes.size() || !(node = std::dynamic_pointer_cast<T>(nodes[id])))
+                THROW_IE_EXCEPTION << "Incorrect reference to the operation with id: " << id;
+        }
+        return result;
+    }
+};
+
+}  // namespace
+
+bool BinaryReader::supportModel(std::istream& model) const {
+    uint32_t magic = 0;
+    model.seekg(0, model.beg);
+    model.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    const bool supported = model.gcount() == sizeof(magic) && magic == ngraph::pass::SerializeBinary::Magic;
+    model.clear();
+    model.seekg(0, model.beg);
+    return supported;
+}
+
+CNNNetwork BinaryReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
+    return read(model, nullptr, exts);
+}
+
+CNNNetwork BinaryReader::read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const {
+    model.seekg(0, model.end);
+    const auto size = static_cast<size_t>(model.tellg());
+    model.seekg(0, model.beg);
+    std::vector<char> data(size);
+    model.read(data.data(), size);
+
+    BinaryStream stream(data.data(), data.size());
+    BinaryParser parser(exts, details::areWeightsShareable(model));
+    return CNNNetwork(parser.parse(stream, weights), exts);
+}
+
+INFERENCE_PLUGIN_API(StatusCode) InferenceEngine::CreateReader(IReader*& reader, ResponseDesc *resp) noexcept {
+    try {
+        reader = new BinaryReader();
+        return OK;
+    }
+    catch (std::exception &) {
+        return GENERAL_ERROR;
+    }
+}
@@ -8,9 +8,14 @@
 #include <typeinfo>
 #include <unordered_set>
 #include <algorithm>
+#include <cstring>
 #include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ngraph/ngraph.hpp>
 #include <set>
 #include <sstream>
@@ -23,6 +28,7 @@
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/variant.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 
 #include <cpp/ie_cnn_network.h>
 #include "ie_blob_stream.hpp"
@@ -31,15 +37,16 @@
 #include "generic_ie.hpp"
 #include "precision_utils.h"
 #include "blob_factory.hpp"
+#include "ie_parallel.hpp"
 
 using namespace InferenceEngine;
 using namespace XMLParseUtils;
 
 IRParser::IRParser(size_t version): IRParser(version, {}) {}
-IRParser::IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts) {
+IRParser::IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts, bool shareWeights) {
     switch (version) {
     case 10:
-        parser = std::make_shared<V10Parser>(exts);
+        parser = std::make_shared<V10Parser>(exts, shareWeights);
         break;
     default:
         THROW_IE_EXCEPTION << "Unsupported IR version: " << version;
@@ -50,6 +57,10 @@ std::shared_ptr<ICNNNetwork> IRParser::parse(const pugi::xml_node& root, const B
     return parser->parse(root, weights);
 }
 
+std::shared_ptr<ICNNNetwork> IRParser::parse(std::istream& model, const Blob::CPtr& weights) {
+    return parser->parse(model, weights);
+}
+
 /**
  * Hold original blob in order to avoid situations when original blob is allocated on stack
  */
@@ -63,7 +74,21 @@ public:
         originBlob(weights) { }
 };
 
-V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
+namespace {
+
+// Check that operation in default opsets
+bool isDefaultOpSet(const std::string& version) {
+    for (size_t i = 1; i <= 6; i++) {
+        std::string opset_name = "opset" + std::to_string(i);
+        if (version == opset_name)
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts, bool shareWeights) : _exts(exts), _shareWeights(shareWeights) {
     // Load default opsets
     opsets["opset1"] = ngraph::get_opset1();
     opsets["opset2"] = ngraph::get_opset2();
@@ -86,43 +111,372 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
 std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const Blob::CPtr& weights) {
     OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
 
-    using node_params = struct {
-        pugi::xml_node xml;
-        GenericLayerParams params;
-    };
-    std::map<size_t, node_params> params;
-
-    std::vector<size_t> outputs;
-    std::unordered_set<std::string> opName;
+    GraphState graph;
+    std::map<size_t, pugi::xml_node> layers;
 
     // Read all layers and store their parameters in params map
     FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
-        if (opName.find(node_param.name) != opName.end())
-            THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
-        opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
-        if (node_param.type == "Result" || node_param.type == "Assign") {
-            outputs.push_back(node_param.layerId);
-        }
+        layers[addLayer(graph, parseGenericParams(node))] = node;
     }
 
-    using edge = struct { size_t fromLayerId, fromPortId, toPortId; };
-    std::map<size_t, std::vector<edge>> edges;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
-
     // Read all edges and store them for further usage
     FOREACH_CHILD(_ec, root.child("edges"), "edge") {
-        size_t fromLayer = GetUIntAttr(_ec, "from-layer");
-        size_t fromPort = GetUIntAttr(_ec, "from-port");
-        size_t toLayer = GetUIntAttr(_ec, "to-layer");
-        size_t toPort = GetUIntAttr(_ec, "to-port");
-        edges[toLayer].push_back({fromLayer, fromPort, toPort});
+        addEdge(graph, _ec);
+    }
+
+    auto order = topologicalOrder(graph);
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphNodes");
+
+    std::vector<pugi::xml_node> constants;
+    for (auto& layer_id : order) {
+        if (isConstant(graph, graph.params[layer_id]))
+            constants.push_back(layers[layer_id]);
+    }
+    createConstants(graph, constants.size(), [&constants](size_t i, pugi::xml_document&) {
+        return constants[i];
+    }, weights);
+
+    //  Following topological order create nGraph operations
+    for (auto& layer_id : order) {
+        if (!graph.id_to_node.count(layer_id))
+            createLayer(graph, layer_id, layers[layer_id], weights);
+    }
+
+    return buildNetwork(graph, order, GetStrAttr(root, "name", ""), root, weights);
+}
+
+namespace {
+
+std::string readModel(std::istream& model) {
+    std::string xml;
+    model.seekg(0, model.end);
+    const auto size = model.tellg();
+    model.clear();
+    model.seekg(0, model.beg);
+    if (size > 0) {
+        xml.resize(static_cast<size_t>(size));
+        model.read(&xml[0], size);
+        xml.resize(static_cast<size_t>(model.gcount()));
+    } else {
+        xml.assign(std::istreambuf_iterator<char>(model), std::istreambuf_iterator<char>());
+    }
+    return xml;
+}
+
+/**
+ * Finds boundaries of elements in IR xml text, so that every layer and edge is parsed by pugixml
+ * separately and the document of the whole model is never built
+ */
+class XmlScanner {
+public:
+    static constexpr size_t npos = std::string::npos;
+
+    explicit XmlScanner(const std::string& xml): _xml(xml) {}
+
+    // Position of the root element or npos if the text is not a plain UTF-8 xml
+    size_t root() const {
+        size_t pos = _xml.compare(0, 3, "\xEF\xBB\xBF") == 0 ? 3 : 0;
+        pos = _xml.find_first_not_of(" \t\r\n", pos);
+        if (pos == npos || _xml[pos] != '<')
+            return npos;
+        return element(pos);
+    }
+
+    // Position of the first element named name at the level which continues from pos,
+    // npos if the parent element ends before
+    size_t element(size_t pos, const char* name = nullptr) const {
+        while (pos != npos && (pos = markup(pos)) != npos) {
+            if (_xml.compare(pos, 2, "</") == 0)
+                return npos;
+            if (name == nullptr || hasName(pos, name))
+                return pos;
+            pos = end(pos);
+        }
+        return npos;
+    }
+
+    // Position of the content of element at pos, npos if the element is empty
+    size_t children(size_t pos) const {
+        if (pos == npos)
+            return npos;
+        bool selfClosed = false;
+        pos = startTagEnd(pos, selfClosed);
+        return selfClosed ? npos : pos;
+    }
+
+    // Position which follows the element at pos
+    size_t end(size_t pos) const {
+        bool selfClosed = false;
+        pos = startTagEnd(pos, selfClosed);
+        for (size_t depth = selfClosed ? 0 : 1; depth > 0;) {
+            pos = markup(pos);
+            if (pos == npos)
+                THROW_IE_EXCEPTION << "Unexpected end of IR xml: element is not closed";
+            if (_xml.compare(pos, 2, "</") == 0) {
+                pos = skip(pos, ">");
+                --depth;
+            } else {
+                pos = startTagEnd(pos, selfClosed);
+                if (!selfClosed)
+                    ++depth;
+            }
+        }
+        return pos;
+    }
+
+    void load(pugi::xml_document& doc, size_t begin, size_t end) const {
+        pugi::xml_parse_result res = doc.load_buffer(_xml.data() + begin, end - begin,
+                                                     pugi::parse_default, pugi::encoding_utf8);
+        if (res.status != pugi::status_ok) {
+            THROW_IE_EXCEPTION << res.description() << "at offset " << begin + res.offset;
+        }
+    }
+
+    // Loads attributes of the element at pos without its content
+    void loadStartTag(pugi::xml_document& doc, size_t pos) const {
+        bool selfClosed = false;
+        const size_t tagEnd = startTagEnd(pos, selfClosed);
+        std::string tag = _xml.substr(pos, tagEnd - pos - (selfClosed ? 2 : 1)) + "/>";
+        pugi::xml_parse_result res = doc.load_buffer(tag.data(), tag.size(), pugi::parse_default, pugi::encoding_utf8);
+        if (res.status != pugi::status_ok) {
+            THROW_IE_EXCEPTION << res.description() << "at offset " << pos + res.offset;
+        }
+    }
+
+    bool hasName(size_t pos, const char* name) const {
+        const size_t length = std::strlen(name);
+        if (_xml.compare(pos + 1, length, name) != 0 || pos + 1 + length >= _xml.size())
+            return false;
+        const char next = _xml[pos + 1 + length];
+        return next == '>' || next == '/' || std::isspace(static_cast<unsigned char>(next));
+    }
+
+private:
+    const std::string& _xml;
+
+    // Position which follows the first occurrence of str after pos
+    size_t skip(size_t pos, const char* str) const {
+        pos = _xml.find(str, pos);
+        if (pos == npos)
+            THROW_IE_EXCEPTION << "Unexpected end of IR xml: markup is not closed";
+        return pos + std::strlen(str);
+    }
+
+    // Position of the next start or end tag, comments and declarations are skipped
+    size_t markup(size_t pos) const {
+        while ((pos = _xml.find('<', pos)) != npos) {
+            if (_xml.compare(pos, 4, "<!--") == 0) {
+                pos = skip(pos + 4, "-->");
+            } else if (_xml.compare(pos, 9, "<![CDATA[") == 0) {
+                pos = skip(pos + 9, "]]>");
+            } else if (_xml.compare(pos, 2, "<?") == 0) {
+                pos = skip(pos + 2, "?>");
+            } else if (_xml.compare(pos, 2, "<!") == 0) {
+                pos = skip(pos + 2, ">");
+            } else {
+                return pos;
+            }
+        }
+        return npos;
+    }
+
+    size_t startTagEnd(size_t pos, bool& selfClosed) const {
+        char quote = 0;
+        for (size_t i = pos + 1; i < _xml.size(); ++i) {
+            const char c = _xml[i];
+            if (quote) {
+                if (c == quote)
+                    quote = 0;
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '>') {
+                selfClosed = _xml[i - 1] == '/';
+                return i + 1;
+            }
+        }
+        THROW_IE_EXCEPTION << "Unexpected end of IR xml: tag is not closed";
+    }
+};
+
+}  // namespace
+
+std::shared_ptr<ICNNNetwork> V10Parser::parse(std::istream& model, const Blob::CPtr& weights) {
+    OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader_RT, "V10Parser", "ParseStream");
+
+    const std::string xml = readModel(model);
+    XmlScanner scanner(xml);
+
+    const size_t root = scanner.root();
+    if (root == XmlScanner::npos) {
+        // Let pugixml detect encoding of the text
+        pugi::xml_document xmlDoc;
+        pugi::xml_parse_result res = xmlDoc.load_buffer(xml.data(), xml.size());
+        if (res.status != pugi::status_ok) {
+            THROW_IE_EXCEPTION << res.description() << "at offset " << res.offset;
+        }
+        return parse(xmlDoc.document_element(), weights);
+    }
+
+    pugi::xml_document rootDoc;
+    scanner.loadStartTag(rootDoc, root);
+
+    size_t layersPos = XmlScanner::npos, edgesPos = XmlScanner::npos, preProcessPos = XmlScanner::npos;
+    for (size_t pos = scanner.element(scanner.children(root)); pos != XmlScanner::npos;
+         pos = scanner.element(scanner.end(pos))) {
+        if (layersPos == XmlScanner::npos && scanner.hasName(pos, "layers")) {
+            layersPos = pos;
+        } else if (edgesPos == XmlScanner::npos && scanner.hasName(pos, "edges")) {
+            edgesPos = pos;
+        } else if (preProcessPos == XmlScanner::npos && scanner.hasName(pos, "pre-process")) {
+            preProcessPos = pos;
+        }
+    }
+
+    GraphState graph;
+    pugi::xml_document doc;
+
+    // Edges follow layers in IR, but they are read first to create every layer right after it is read
+    for (size_t pos = scanner.element(scanner.children(edgesPos), "edge"), end; pos != XmlScanner::npos;
+         pos = scanner.element(end, "edge")) {
+        end = scanner.end(pos);
+        scanner.load(doc, pos, end);
+        addEdge(graph, doc.document_element());
+    }
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphNodes");
+
+    // Only start tags are parsed to find constants, they are parsed entirely by createConstants
+    std::vector<std::pair<size_t, size_t>> constants;
+    for (size_t pos = scanner.element(scanner.children(layersPos), "layer"), end; pos != XmlScanner::npos;
+         pos = scanner.element(end, "layer")) {
+        end = scanner.end(pos);
+        scanner.loadStartTag(doc, pos);
+        GenericLayerParams params;
+        params.layerId = GetUIntAttr(doc.document_element(), "id");
+        params.type = GetStrAttr(doc.document_element(), "type");
+        params.version = GetStrAttr(doc.document_element(), "version", "");
+        if (isConstant(graph, params))
+            constants.emplace_back(pos, end);
+    }
+    createConstants(graph, constants.size(), [&scanner, &constants](size_t i, pugi::xml_document& constDoc) {
+        scanner.load(constDoc, constants[i].first, constants[i].second);
+        return constDoc.document_element();
+    }, weights);
+
+    // Layers which come before their inputs are parsed again after all layers are read
+    std::map<size_t, std::pair<size_t, size_t>> deferred;
+    const auto inputsCreated = [&graph](size_t layerId) {
+        auto edges = graph.edges.find(layerId);
+        if (edges == graph.edges.end())
+            return true;
+        return std::all_of(edges->second.begin(), edges->second.end(), [&graph](const Edge& e) {
+            return graph.id_to_node.count(e.fromLayerId) != 0;
+        });
+    };
+
+    auto constant = constants.begin();
+    for (size_t pos = scanner.element(scanner.children(layersPos), "layer"), end; pos != XmlScanner::npos;
+         pos = scanner.element(end, "layer")) {
+        end = scanner.end(pos);
+        if (constant != constants.end() && constant->first == pos) {
+            ++constant;
+            continue;
+        }
+        scanner.load(doc, pos, end);
+        const auto node = doc.document_element();
+        const size_t layerId = addLayer(graph, parseGenericParams(node));
+        if (inputsCreated(layerId)) {
+            createLayer(graph, layerId, node, weights);
+        } else {
+            deferred[layerId] = {pos, end};
+        }
+    }
+
+    // Layers which are not reachable from outputs are dropped here as they are not a part of the function
+    auto order = topologicalOrder(graph);
+    for (auto& layer_id : order) {
+        auto layer = deferred.find(layer_id);
+        if (layer == deferred.end())
+            continue;
+        scanner.load(doc, layer->second.first, layer->second.second);
+        createLayer(graph, layer_id, doc.document_element(), weights);
+    }
+
+    pugi::xml_document preProcessDoc;
+    if (preProcessPos != XmlScanner::npos) {
+        scanner.load(preProcessDoc, preProcessPos, scanner.end(preProcessPos));
+    }
+
+    return buildNetwork(graph, order, GetStrAttr(rootDoc.document_element(), "name", ""), preProcessDoc, weights);
+}
+
+size_t V10Parser::addLayer(GraphState& graph, GenericLayerParams&& node_param) {
+    if (graph.opName.find(node_param.name) != graph.opName.end())
+        THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
+    graph.opName.insert(node_param.name);
+    if (node_param.type == "Result" || node_param.type == "Assign") {
+        graph.outputs.push_back(node_param.layerId);
     }
+    const size_t layerId = node_param.layerId;
+    graph.params[layerId] = std::move(node_param);
+    return layerId;
+}
+
+void V10Parser::addEdge(GraphState& graph, const pugi::xml_node& node) {
+    size_t fromLayer = GetUIntAttr(node, "from-layer");
+    size_t fromPort = GetUIntAttr(node, "from-port");
+    size_t toLayer = GetUIntAttr(node, "to-layer");
+    size_t toPort = GetUIntAttr(node, "to-port");
+    graph.edges[toLayer].push_back({fromLayer, fromPort, toPort});
+}
+
+bool V10Parser::isConstant(const GraphState& graph, const GenericLayerParams& params) const {
+    // Operations of extensions may be not thread safe, so only constants of default opsets are created in parallel
+    return params.type == "Const" && isDefaultOpSet(params.version) && !graph.edges.count(params.layerId);
+}
+
+void V10Parser::createConstants(GraphState& graph, size_t count,
+                                const std::function<pugi::xml_node(size_t, pugi::xml_document&)>& getNode,
+                                const Blob::CPtr& weights) {
+    OV_ITT_SCOPED_TASK(itt::domains::V10Reader_RT, "V10Parser::createConstants");
+
+    std::vector<GenericLayerParams> params(count);
+    std::vector<std::shared_ptr<ngraph::Node>> nodes(count);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    // Constants have no inputs, so they are created independently. Data of every constant is validated
+    // and either shared with weights or copied from there by createNode
+    parallel_for(count, [&](size_t i) {
+        try {
+            pugi::xml_document doc;
+            const auto node = getNode(i, doc);
+            params[i] = parseGenericParams(node);
+            nodes[i] = createNode({}, node, weights, params[i]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+                error = std::current_exception();
+        }
+    });
+    if (error)
+        std::rethrow_exception(error);
+
+    for (size_t i = 0; i < count; ++i) {
+        const size_t layerId = params[i].layerId;
+        // Layers of a document are added before the constants are created
+        if (!graph.params.count(layerId))
+            addLayer(graph, std::move(params[i]));
+        graph.id_to_node[layerId] = nodes[i];
+    }
+}
 
+std::vector<size_t> V10Parser::topologicalOrder(GraphState& graph) {
     // Run DFS starting from outputs to get nodes topological order
     std::set<size_t> used;
     std::vector<size_t> order;
+    auto& edges = graph.edges;
     std::function<void(size_t)> dfs = [&edges, &order, &used, &dfs](const size_t id) {
         if (used.count(id)) return;
         used.insert(id);
@@ -131,9 +485,47 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const
         }
         order.push_back(id);
     };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    std::for_each(graph.outputs.begin(), graph.outputs.end(), dfs);
+    return order;
+}
 
-    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphNodes");
+void V10Parser::createLayer(GraphState& graph, size_t layerId, const pugi::xml_node& node, const Blob::CPtr& weights) {
+    auto& p = graph.params[layerId];
+    auto& layerEdges = graph.edges[layerId];
+    ngraph::OutputVector inputs(layerEdges.size());
+    for (auto& e : layerEdges) {
+        auto input_node = graph.id_to_node.find(e.fromLayerId);
+        if (input_node == graph.id_to_node.end()) {
+            THROW_IE_EXCEPTION << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+        }
+        auto& p_output = graph.params[e.fromLayerId];
+        if (p.getRealInputPortId(e.toPortId) >= inputs.size())
+            THROW_IE_EXCEPTION << p.type << " layer " << p.name << " with id: " << p.layerId
+                << " is inconsistent!";
+        inputs[p.getRealInputPortId(e.toPortId)] =
+            input_node->second->output(p_output.getRealOutputPortId(e.fromPortId));
+    }
+
+    auto ngraph_node = createNode(inputs, node, weights, p);
+    graph.id_to_node[layerId] = ngraph_node;
+
+    // Check that output shape after nGraph node validation the same as in IR
+    // because IR always right!
+    // Temporary disabled!
+    //        for (size_t i = 0; i < p.outputPorts.size(); ++i) {
+    //            if (p.outputPorts[i].dims != ngraph_node->output(i).get_shape()) {
+    //                THROW_IE_EXCEPTION << "Shape after nGraph infer " <<
+    //                details::dumpVec(ngraph_node->output(i).get_shape())
+    //                                   << " differ from IR shapes: " <<
+    //                                   details::dumpVec(p.outputPorts[i].dims);
+    //            }
+    //        }
+}
+
+std::shared_ptr<ICNNNetwork> V10Parser::buildNetwork(GraphState& graph, const std::vector<size_t>& order,
+                                                     const std::string& name, const pugi::xml_node& root,
+                                                     const Blob::CPtr& weights) {
+    OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader_RT, "V10Parser", "ConstructNgraphFunction");
 
     ngraph::ParameterVector parameter_nodes;
     ngraph::ResultVector result_nodes;
@@ -141,37 +533,8 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const
     ngraph::SinkVector assign_nodes;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
-    //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
-        auto& p = params[layer_id];
-        ngraph::OutputVector inputs(edges[layer_id].size());
-        for (auto& e : edges[layer_id]) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
-                THROW_IE_EXCEPTION << "Attempt to access node " << e.fromLayerId << " that not in graph.";
-            }
-            auto& p_output = params[e.fromLayerId].params;
-            if (p.params.getRealInputPortId(e.toPortId) >= inputs.size())
-                THROW_IE_EXCEPTION << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
-                    << " is inconsistent!";
-            inputs[p.params.getRealInputPortId(e.toPortId)] =
-                input_node->output(p_output.getRealOutputPortId(e.fromPortId));
-        }
-
-        auto node = createNode(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
-
-        // Check that output shape after nGraph node validation the same as in IR
-        // because IR always right!
-        // Temporary disabled!
-        //        for (size_t i = 0; i < p.params.outputPorts.size(); ++i) {
-        //            if (p.params.outputPorts[i].dims != node->output(i).get_shape()) {
-        //                THROW_IE_EXCEPTION << "Shape after nGraph infer " <<
-        //                details::dumpVec(node->output(i).get_shape())
-        //                                   << " differ from IR shapes: " <<
-        //                                   details::dumpVec(p.params.outputPorts[i].dims);
-        //            }
-        //        }
+        auto node = graph.id_to_node.at(layer_id);
 
         if (auto parameter_node = std::dynamic_pointer_cast<ngraph::op::Parameter>(node)) {
             parameter_nodes.emplace_back(parameter_node);
@@ -191,10 +554,8 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const
         allNodes.emplace_back(node);
     }
 
-    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphFunction");
-
     ::ngraph::op::GenericIE::DisableReshape noReshape(allNodes);
-    auto function = std::make_shared<ngraph::Function>(result_nodes, assign_nodes, parameter_nodes, GetStrAttr(root, "name", ""));
+    auto function = std::make_shared<ngraph::Function>(result_nodes, assign_nodes, parameter_nodes, name);
     for (const auto& assign : assign_nodes) {
         assign->add_control_dependency(
             variable_id_to_read_value.at(std::dynamic_pointer_cast<ngraph::op::Assign>(assign)->get_variable_id()));
@@ -420,16 +781,6 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
         std::make_shared<LayerCreator<ngraph::op::v1::LogicalNot>>("LogicalNot"),
     };
 
-    // Check that operation in default opsets
-    auto isDefaultOpSet = [](const std::string& version) -> bool {
-        for (size_t i = 1; i <= 6; i++) {
-            std::string opset_name = "opset" + std::to_string(i);
-            if (version == opset_name)
-                return true;
-        }
-        return false;
-    };
-
     for (size_t i = 0; i < inputs.size(); i++) {
         if (!inputs[i].get_node())
             THROW_IE_EXCEPTION << params.type << " layer " << params.name << " with id: " << params.layerId
@@ -460,6 +811,10 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
         }
     }
 
+    if (!ngraphNode && _shareWeights && params.type == "Const" && isDefaultOpSet(params.version)) {
+        ngraphNode = createSharedConstant(node, weights, params);
+    }
+
     // Try to create operation from loaded opsets
     if (!ngraphNode && opsets.count(params.version)) {
         auto opset = opsets.at(params.version);
@@ -554,6 +909,38 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
     return ngraphNode;
 }
 
+std::shared_ptr<ngraph::Node> V10Parser::createSharedConstant(const pugi::xml_node& node, const Blob::CPtr& weights,
+                                                              const GenericLayerParams& params) {
+    pugi::xml_node dn = node.child("data");
+    if (dn.empty())
+        THROW_IE_EXCEPTION << "No attrtibutes defined for " << params.type << " op!";
+
+    const auto el_type = details::convertPrecision(GetStrAttr(dn, "element_type"));
+    ngraph::Shape shape;
+    {
+        std::stringstream ss(GetStrAttr(dn, "shape", ""));
+        std::string field;
+        while (getline(ss, field, ',')) {
+            shape.push_back(static_cast<size_t>(std::stoull(field)));
+        }
+    }
+    size_t offset = GetUInt64Attr(dn, "offset");
+    size_t size = GetUInt64Attr(dn, "size");
+
+    size_t length = weights ? weights->byteSize() : 0;
+    if (!length)
+        THROW_IE_EXCEPTION << "Empty weights data in bin file or bin file cannot be found!";
+    if (length < offset + size)
+        THROW_IE_EXCEPTION << "Incorrect weights in bin file!";
+    if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
+        THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for " << params.type << " op!";
+
+    // the buffer holds weights blob, so the memory stays valid while the constant is alive
+    char* data = weights->cbuffer().as<char*>() + offset;
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<const Blob::CPtr>>(data, size, weights);
+    return std::make_shared<ngraph::op::Constant>(el_type, shape, buffer);
+}
+
 namespace InferenceEngine {
 
 
@@ -17,11 +17,13 @@
 
 #include <cctype>
 #include <algorithm>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace InferenceEngine {
@@ -31,13 +33,24 @@ public:
     using Ptr = std::shared_ptr<IParser>;
     virtual ~IParser() = default;
     virtual std::shared_ptr<ICNNNetwork> parse(const pugi::xml_node& root, const Blob::CPtr& weights) = 0;
+
+    // Parsers which do not need the whole xml document override it
+    virtual std::shared_ptr<ICNNNetwork> parse(std::istream& model, const Blob::CPtr& weights) {
+        pugi::xml_document xmlDoc;
+        pugi::xml_parse_result res = xmlDoc.load(model);
+        if (res.status != pugi::status_ok) {
+            THROW_IE_EXCEPTION << res.description() << "at offset " << res.offset;
+        }
+        return parse(xmlDoc.document_element(), weights);
+    }
 };
 
 class IRParser {
 public:
     explicit IRParser(size_t version);
-    IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts);
+    IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts, bool shareWeights = false);
     std::shared_ptr<ICNNNetwork> parse(const pugi::xml_node& root, const Blob::CPtr& weights);
+    std::shared_ptr<ICNNNetwork> parse(std::istream& model, const Blob::CPtr& weights);
     virtual ~IRParser() = default;
 
 private:
@@ -47,6 +60,7 @@ private:
 class CNNParser : public IParser {
 public:
     CNNParser() = default;
+    using IParser::parse;
     std::shared_ptr<ICNNNetwork> parse(const pugi::xml_node& root, const Blob::CPtr& weights) override;
 };
 
@@ -54,12 +68,16 @@ public:
 
 class V10Parser : public IParser {
 public:
-    explicit V10Parser(const std::vector<IExtensionPtr>& exts);
+    explicit V10Parser(const std::vector<IExtensionPtr>& exts, bool shareWeights = false);
     std::shared_ptr<ICNNNetwork> parse(const pugi::xml_node& root, const Blob::CPtr& weights) override;
+    // Reads layers and edges one by one without building the document of the whole model
+    std::shared_ptr<ICNNNetwork> parse(std::istream& model, const Blob::CPtr& weights) override;
 
 private:
     std::map<std::string, ngraph::OpSet> opsets;
     const std::vector<IExtensionPtr> _exts;
+    // Constants refer to weights blob memory instead of copying it
+    const bool _shareWeights;
 
     struct GenericLayerParams {
         struct LayerPortData {
@@ -171,9 +189,37 @@ private:
         }
     };
 
+    struct Edge {
+        size_t fromLayerId, fromPortId, toPortId;
+    };
+
+    // Layers which are read so far and nGraph nodes created for them
+    struct GraphState {
+        std::map<size_t, GenericLayerParams> params;
+        std::map<size_t, std::vector<Edge>> edges;
+        std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+        std::vector<size_t> outputs;
+        std::unordered_set<std::string> opName;
+    };
+
+    size_t addLayer(GraphState& graph, GenericLayerParams&& params);
+    void addEdge(GraphState& graph, const pugi::xml_node& node);
+    bool isConstant(const GraphState& graph, const GenericLayerParams& params) const;
+    void createConstants(GraphState& graph, size_t count,
+                         const std::function<pugi::xml_node(size_t, pugi::xml_document&)>& getNode,
+                         const Blob::CPtr& weights);
+    std::vector<size_t> topologicalOrder(GraphState& graph);
+    void createLayer(GraphState& graph, size_t layerId, const pugi::xml_node& node, const Blob::CPtr& weights);
+    std::shared_ptr<ICNNNetwork> buildNetwork(GraphState& graph, const std::vector<size_t>& order,
+                                              const std::string& name, const pugi::xml_node& root,
+                                              const Blob::CPtr& weights);
+
     std::shared_ptr<ngraph::Node> createNode(const ngraph::OutputVector& inputs, const pugi::xml_node& node,
                                              const Blob::CPtr& weights, const GenericLayerParams& params);
 
+    std::shared_ptr<ngraph::Node> createSharedConstant(const pugi::xml_node& node, const Blob::CPtr& weights,
+                                                       const GenericLayerParams& params);
+
     GenericLayerParams parseGenericParams(const pugi::xml_node& node);
     void parsePreProcess(CNNNetwork& network, const pugi::xml_node& root, const Blob::CPtr& weights);
 
@@ -36,16 +36,9 @@ CNNNetwork IRReader::read(std::istream& model, const std::vector<IExtensionPtr>&
 CNNNetwork IRReader::read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const {
     OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "IRReader::read");
 
-    pugi::xml_document xmlDoc;
-    pugi::xml_parse_result res = xmlDoc.load(model);
-    if (res.status != pugi::status_ok) {
-        THROW_IE_EXCEPTION << res.description() << "at offset " << res.offset;
-    }
-    pugi::xml_node root = xmlDoc.document_element();
-
-    auto version = details::GetIRVersion(root);
-    IRParser parser(version, exts);
-    return CNNNetwork(parser.parse(root, weights));
+    auto version = details::GetIRVersion(model);
+    IRParser parser(version, exts, details::areWeightsShareable(model));
+    return CNNNetwork(parser.parse(model, weights));
 }
 
 INFERENCE_PLUGIN_API(StatusCode) InferenceEngine::CreateReader(IReader*& reader, ResponseDesc *resp) noexcept {
@@ -10,7 +10,7 @@
 using namespace InferenceEngine;
 
 IRParser::IRParser(size_t version): IRParser(version, {}) {}
-IRParser::IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts) {
+IRParser::IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts, bool) {
     if (version < 10) {
         parser = std::make_shared<CNNParser>();
         return;
@@ -23,6 +23,10 @@ std::shared_ptr<ICNNNetwork> IRParser::parse(const pugi::xml_node& root, const B
     return parser->parse(root, weights);
 }
 
+std::shared_ptr<ICNNNetwork> IRParser::parse(std::istream& model, const Blob::CPtr& weights) {
+    return parser->parse(model, weights);
+}
+
 /**
  * Hold original blob in order to avoid situations when original blob is allocated on stack
  */
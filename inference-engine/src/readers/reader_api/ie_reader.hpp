@@ -60,4 +60,28 @@ public:
  */
 INFERENCE_PLUGIN_API(StatusCode) CreateReader(IReader*& reader, ResponseDesc* resp) noexcept;
 
+namespace details {
+
+/**
+ * @brief Marks a model stream, so a reader knows that the weights blob passed together with the stream
+ * is owned by Inference Engine (e.g. a memory-mapped weights file) and can be referenced by the created network
+ * instead of being copied
+ * @note The slot 0 of the stream extensible array of integers is used, in the same way as pword(0) holds model path
+ * @param model A model stream
+ */
+inline void markWeightsAsShareable(std::ios_base& model) {
+    model.iword(0) = 1;
+}
+
+/**
+ * @brief Checks whether weights passed together with the model stream can be referenced instead of copied
+ * @param model A model stream
+ * @return `true` if weights memory can be shared with the created network
+ */
+inline bool areWeightsShareable(std::ios_base& model) {
+    return model.iword(0) == 1;
+}
+
+}  // namespace details
+
 }  // namespace InferenceEngine
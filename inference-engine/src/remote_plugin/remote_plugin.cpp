@@ -0,0 +1,507 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_plugin_config.hpp>
+#include <blob_factory.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <remote/remote_config.hpp>
+#include <threading/ie_executor_manager.hpp>
+#include <ngraph/graph_util.hpp>
+#include <transformations/serialize.hpp>
+#include "remote_plugin.hpp"
+
+namespace RemotePlugin {
+    using namespace InferenceEngine;
+namespace {
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    std::vector<std::string> ParseWorkers(const std::string& workers) {
+        std::vector<std::string> addresses;
+        std::istringstream stream(workers);
+        std::string address;
+        while (std::getline(stream, address, ',')) {
+            address.erase(std::remove(address.begin(), address.end(), ' '), address.end());
+            if (!address.empty()) {
+                addresses.push_back(address);
+            }
+        }
+        return addresses;
+    }
+
+    // the blob with the dense network layout, so its memory is sent and received as is
+    TensorDesc DenseDesc(const TensorDesc& desc) {
+        return TensorDesc(desc.getPrecision(), desc.getDims(), desc.getLayout());
+    }
+
+    MemoryBlob::Ptr AsDenseMemoryBlob(const Blob::Ptr& blob, const TensorDesc& networkDesc, const std::string& name) {
+        auto memoryBlob = as<MemoryBlob>(blob);
+        if (nullptr == memoryBlob || memoryBlob->getTensorDesc() != DenseDesc(networkDesc)) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "REMOTE device supports just the memory blobs with the dense "
+                               << "layout of the network, while the blob " << name << " is not";
+        }
+        return memoryBlob;
+    }
+}  // namespace
+
+// ------------------------------RemoteInferRequest----------------------------
+RemoteInferRequest::RemoteInferRequest(const InputsDataMap&  networkInputs,
+                                       const OutputsDataMap& networkOutputs)
+    : InferRequestInternal(networkInputs, networkOutputs) {
+    for (const auto &it : _networkInputs) {
+        _inputs[it.first] = make_blob_with_precision(DenseDesc(it.second->getTensorDesc()));
+        _inputs[it.first]->allocate();
+    }
+    for (const auto &it : _networkOutputs) {
+        _outputs[it.first] = make_blob_with_precision(DenseDesc(it.second->getTensorDesc()));
+        _outputs[it.first]->allocate();
+    }
+}
+
+void RemoteInferRequest::PrepareInputs() {
+    _error.clear();
+    execDataPreprocessing(_inputs);
+    for (const auto &it : _networkInputs) {
+        AsDenseMemoryBlob(_inputs[it.first], it.second->getTensorDesc(), it.first);
+    }
+    for (const auto &it : _networkOutputs) {
+        AsDenseMemoryBlob(_outputs[it.first], it.second->getTensorDesc(), it.first);
+    }
+}
+
+std::vector<iovec> RemoteInferRequest::GetInputBuffers(std::uint64_t& size) const {
+    std::vector<iovec> buffers;
+    size = 0;
+    for (const auto &it : _networkInputs) {
+        auto blob = as<MemoryBlob>(_inputs.at(it.first));
+        buffers.push_back({const_cast<std::uint8_t*>(blob->rmap().as<const std::uint8_t*>()), blob->byteSize()});
+        size += blob->byteSize();
+    }
+    return buffers;
+}
+
+void RemoteInferRequest::ReadOutputs(Socket& socket, std::uint64_t size) {
+    std::uint64_t outputsSize = 0;
+    for (const auto &it : _networkOutputs) {
+        outputsSize += _outputs.at(it.first)->byteSize();
+    }
+    if (outputsSize != size) {
+        THROW_IE_EXCEPTION << "The REMOTE worker returned " << size << " bytes of the outputs, while "
+                           << outputsSize << " bytes are expected";
+    }
+    for (const auto &it : _networkOutputs) {
+        auto blob = as<MemoryBlob>(_outputs.at(it.first));
+        socket.Read(blob->wmap().as<void*>(), blob->byteSize());
+    }
+}
+
+// ------------------------------RemoteConnection----------------------------
+RemoteConnection::RemoteConnection(const std::string& address, const std::vector<char>& loadPayload) :
+    _address{address},
+    _socket{Socket::Connect(address)} {
+    MessageHeader header;
+    header.type = static_cast<std::uint32_t>(MessageType::Load);
+    header.size = loadPayload.size();
+    _socket.Write(header, loadPayload.data());
+    auto reply = _socket.ReadHeader();
+    auto payload = _socket.ReadPayload(reply, kMaxControlPayloadSize);
+    PayloadReader reader{payload};
+    if (reply.type == static_cast<std::uint32_t>(MessageType::Error)) {
+        THROW_IE_EXCEPTION << "The REMOTE worker " << _address << " failed to load the network: " << reader.ReadString();
+    } else if (reply.type != static_cast<std::uint32_t>(MessageType::Loaded)) {
+        THROW_IE_EXCEPTION << "Unexpected reply of the REMOTE worker " << _address;
+    }
+    _numWorkerRequests = std::max<std::size_t>(1, static_cast<std::size_t>(reader.ReadInteger()));
+    _writerThread = std::thread(&RemoteConnection::WriterThread, this);
+    _readerThread = std::thread(&RemoteConnection::ReaderThread, this);
+}
+
+RemoteConnection::~RemoteConnection() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+    }
+    _queueCondition.notify_all();
+    _writerThread.join();
+    // the worker finishes the requests in flight and closes the connection once the socket is shut down
+    Fail("The REMOTE connection to " + _address + " is closed");
+    _readerThread.join();
+}
+
+void RemoteConnection::Submit(RemoteInferRequest* request, Task task) {
+    request->_task = std::move(task);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_error.empty()) {
+            _queue.push_back(request);
+            _queueCondition.notify_one();
+            return;
+        }
+        request->_error = _error;
+    }
+    Task failed = std::move(request->_task);
+    failed();
+}
+
+double RemoteConnection::GetLoad() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return static_cast<double>(_queue.size() + _inFlight.size()) / _numWorkerRequests;
+}
+
+void RemoteConnection::WriterThread() {
+    while (true) {
+        std::vector<MessageHeader> headers;
+        std::vector<iovec> buffers;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _queueCondition.wait(lock, [this] { return _terminate || !_queue.empty(); });
+            if (_terminate) {
+                break;
+            }
+            // all the requests submitted since the previous write are sent at once,
+            // they are in flight before they are sent, so the reader finds them in any case
+            headers.resize(_queue.size());
+            for (std::size_t i = 0; i < headers.size(); ++i) {
+                auto request = _queue[i];
+                auto inputs = request->GetInputBuffers(headers[i].size);
+                headers[i].type = static_cast<std::uint32_t>(MessageType::Infer);
+                headers[i].id = _nextId++;
+                buffers.push_back({&headers[i], sizeof(MessageHeader)});
+                buffers.insert(buffers.end(), inputs.begin(), inputs.end());
+                _inFlight.emplace(headers[i].id, request);
+            }
+            _queue.clear();
+        }
+        try {
+            _socket.Write(std::move(buffers));
+        } catch (const std::exception& e) {
+            Fail(e.what());
+        }
+    }
+}
+
+void RemoteConnection::ReaderThread() {
+    try {
+        while (true) {
+            auto header = _socket.ReadHeader();
+            RemoteInferRequest* request = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto itRequest = _inFlight.find(header.id);
+                if (itRequest == _inFlight.end()) {
+                    THROW_IE_EXCEPTION << "The REMOTE worker " << _address << " returned the result of unknown request";
+                }
+                request = itRequest->second;
+                _inFlight.erase(itRequest);
+            }
+            try {
+                if (header.type == static_cast<std::uint32_t>(MessageType::Result)) {
+                    request->ReadOutputs(_socket, header.size);
+                } else if (header.type == static_cast<std::uint32_t>(MessageType::Error)) {
+                    auto payload = _socket.ReadPayload(header, kMaxControlPayloadSize);
+                    request->_error = "The REMOTE worker " + _address + " failed to infer: " + PayloadReader{payload}.ReadString();
+                } else {
+                    THROW_IE_EXCEPTION << "Unexpected message of the REMOTE worker " << _address;
+                }
+            } catch (...) {
+                // the request is not in flight any more, so it is not failed by the connection
+                request->_error = "The REMOTE connection to " + _address + " is broken";
+                Task failed = std::move(request->_task);
+                failed();
+                throw;
+            }
+            Task completed = std::move(request->_task);
+            completed();
+        }
+    } catch (const std::exception& e) {
+        Fail(e.what());
+    }
+}
+
+void RemoteConnection::Fail(const std::string& error) {
+    std::vector<RemoteInferRequest*> requests;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_error.empty()) {
+            _error = error;
+        }
+        requests.insert(requests.end(), _queue.begin(), _queue.end());
+        for (auto&& request : _inFlight) {
+            requests.push_back(request.second);
+        }
+        _queue.clear();
+        _inFlight.clear();
+    }
+    _socket.Shutdown();
+    for (auto&& request : requests) {
+        request->_error = error;
+        Task failed = std::move(request->_task);
+        failed();
+    }
+}
+
+// ------------------------------RemoteAsyncInferRequest----------------------------
+RemoteAsyncInferRequest::RemoteAsyncInferRequest(
+    const RemoteInferRequest::Ptr&          inferRequest,
+    const RemoteExecutableNetwork::Ptr&     remoteExecutableNetwork,
+    const ITaskExecutor::Ptr&               callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _remoteExecutableNetwork{remoteExecutableNetwork},
+    _inferRequest{inferRequest} {
+    // this executor sends the request to a worker while the task (checking the result) is called once the outputs are received
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(RemoteAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_remoteExecutableNetwork->SelectConnection().Submit(_this->_inferRequest.get(), std::move(task));
+        };
+        RemoteAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
+            _inferRequest->PrepareInputs();
+        }},
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+            if (!_inferRequest->_error.empty()) {
+                THROW_IE_EXCEPTION << _inferRequest->_error;
+            }
+        }}
+    };
+}
+
+void RemoteAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+RemoteAsyncInferRequest::~RemoteAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------RemoteExecutableNetwork----------------------------
+RemoteExecutableNetwork::RemoteExecutableNetwork(const std::vector<RemoteConnection::Ptr>&   connections,
+                                                 const std::string&                          networkName,
+                                                 const std::unordered_map<std::string, Parameter>& config) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _connections{connections},
+    _networkName{networkName},
+    _config{config} {
+}
+
+RemoteConnection& RemoteExecutableNetwork::SelectConnection() const {
+    auto leastLoaded = _connections.front().get();
+    auto leastLoad = leastLoaded->GetLoad();
+    for (auto&& connection : _connections) {
+        auto load = connection->GetLoad();
+        if (load < leastLoad) {
+            leastLoad = load;
+            leastLoaded = connection.get();
+        }
+    }
+    return *leastLoaded;
+}
+
+InferenceEngine::InferRequestInternal::Ptr RemoteExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                                          OutputsDataMap networkOutputs) {
+    return std::make_shared<RemoteInferRequest>(networkInputs, networkOutputs);
+}
+
+IInferRequest::Ptr RemoteExecutableNetwork::CreateInferRequest() {
+    IInferRequest::Ptr asyncRequest;
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<RemoteAsyncInferRequest>(std::static_pointer_cast<RemoteInferRequest>(syncRequestImpl),
+                                                                        std::static_pointer_cast<RemoteExecutableNetwork>(shared_from_this()),
+                                                                        _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<RemoteAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+    return asyncRequest;
+}
+
+InferenceEngine::Parameter RemoteExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        THROW_IE_EXCEPTION << NOT_FOUND_str << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+InferenceEngine::Parameter RemoteExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        // every request of the worker has one more request on the wire, so the worker does not wait for the network
+        unsigned int res = 0u;
+        for (auto&& connection : _connections) {
+            res += 2 * static_cast<unsigned int>(connection->_numWorkerRequests);
+        }
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _networkName);
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys;
+        for (auto&& config : _config) {
+            configKeys.push_back(config.first);
+        }
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------RemoteInferencePlugin----------------------------
+InferenceEngine::Parameter RemoteInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == REMOTE_CONFIG_KEY(DEVICE_CONFIG) || name == REMOTE_CONFIG_KEY(WORKERS)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            THROW_IE_EXCEPTION << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+}
+
+void RemoteInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "RemotePlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(RemoteInferencePlugin, version)
+
+RemoteInferencePlugin::RemoteInferencePlugin() {
+    _pluginName = "REMOTE";
+}
+
+InferenceEngine::Parameter RemoteInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { "REMOTE" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            RemoteConfigParams::KEY_REMOTE_DEVICE_CONFIG,
+            RemoteConfigParams::KEY_REMOTE_WORKERS};
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+}
+
+ExecutableNetworkInternal::Ptr RemoteInferencePlugin::LoadExeNetworkImpl(const CNNNetwork &network,
+                                                                         const std::map<std::string, std::string>& config) {
+    if (network.getFunction() == nullptr) {
+        THROW_IE_EXCEPTION << "REMOTE device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(RemoteConfigParams::KEY_REMOTE_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_REMOTE_DEVICE_CONFIG key is not set for REMOTE device";
+    }
+    auto workers = fullConfig.find(RemoteConfigParams::KEY_REMOTE_WORKERS);
+    if (workers == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_REMOTE_WORKERS key is not set for REMOTE device";
+    }
+    auto addresses = ParseWorkers(workers->second);
+    if (addresses.empty()) {
+        THROW_IE_EXCEPTION << "Unsupported value " << workers->second << " for the "
+                           << RemoteConfigParams::KEY_REMOTE_WORKERS << " key of the REMOTE device";
+    }
+
+    // the rest of the settings are applied by the workers to the device
+    std::map<std::string, std::string> workerConfig = fullConfig;
+    workerConfig.erase(RemoteConfigParams::KEY_REMOTE_DEVICE_CONFIG);
+    workerConfig.erase(RemoteConfigParams::KEY_REMOTE_WORKERS);
+
+    // the IR keeps just the network, so the precisions and layouts of the inputs and outputs are sent separately
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize(xmlFile, binFile).run_on_function(ngraph::clone_function(*network.getFunction()));
+    PayloadWriter payload;
+    payload.Append(deviceConfig->second);
+    payload.Append(static_cast<std::uint64_t>(workerConfig.size()));
+    for (auto&& kvp : workerConfig) {
+        payload.Append(kvp.first);
+        payload.Append(kvp.second);
+    }
+    payload.Append(static_cast<std::uint64_t>(network.getInputsInfo().size()));
+    for (auto&& input : network.getInputsInfo()) {
+        payload.Append(input.first);
+        payload.Append(std::string{input.second->getPrecision().name()});
+        payload.Append(static_cast<std::uint64_t>(input.second->getLayout()));
+    }
+    payload.Append(static_cast<std::uint64_t>(network.getOutputsInfo().size()));
+    for (auto&& output : network.getOutputsInfo()) {
+        payload.Append(output.first);
+        payload.Append(std::string{output.second->getPrecision().name()});
+        payload.Append(static_cast<std::uint64_t>(output.second->getLayout()));
+    }
+    payload.Append(xmlFile.str());
+    payload.Append(binFile.str());
+
+    // the workers compile the network independently, so the loads are issued in parallel
+    auto executor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+        IStreamsExecutor::Config{"RemoteAsyncLoad",
+                                 static_cast<int>(addresses.size()),
+                                 1 /*single thread per stream*/,
+                                 IStreamsExecutor::ThreadBindingType::NONE});
+    std::vector<RemoteConnection::Ptr> connections(addresses.size());
+    std::vector<std::exception_ptr> loadErrors(addresses.size());
+    std::vector<Task> loads;
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        loads.push_back([&, i] {
+            try {
+                connections[i] = std::make_shared<RemoteConnection>(addresses[i], payload._data);
+            } catch (...) {
+                loadErrors[i] = std::current_exception();
+            }
+        });
+    }
+    executor->runAndWait(loads);
+    for (auto&& loadError : loadErrors) {
+        if (loadError) {
+            std::rethrow_exception(loadError);
+        }
+    }
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
+    networkConfig.insert(*deviceConfig);
+    networkConfig.insert(*workers);
+    networkConfig.insert(workerConfig.begin(), workerConfig.end());
+
+    return std::make_shared<RemoteExecutableNetwork>(connections, network.getName(), networkConfig);
+}
+
+}  // namespace RemotePlugin
@@ -0,0 +1,142 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
+#include "remote_transport.hpp"
+
+namespace RemotePlugin {
+
+class RemoteInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<RemoteInferRequest>;
+    RemoteInferRequest(const InferenceEngine::InputsDataMap&  networkInputs,
+                       const InferenceEngine::OutputsDataMap& networkOutputs);
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>&) const override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    void InferImpl() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    // runs the pre-processing and checks the inputs can be sent as is
+    void PrepareInputs();
+    // the memory of the input blobs in the order of the names, it is sent without copies
+    std::vector<iovec> GetInputBuffers(std::uint64_t& size) const;
+    // receives the outputs directly to the memory of the output blobs
+    void ReadOutputs(Socket& socket, std::uint64_t size);
+
+    // called by the connection once the outputs are received or the request failed with the _error
+    InferenceEngine::Task   _task;
+    std::string             _error;
+};
+
+/**
+ * @brief The connection of the executable network to one worker process. The writer thread sends all the requests
+ * submitted since its previous send in a single write (the headers and the input blobs memory), the reader thread
+ * receives the results of the requests in flight as they are returned by the worker.
+ */
+class RemoteConnection {
+public:
+    using Ptr = std::shared_ptr<RemoteConnection>;
+
+    // connects to the worker and loads the network with the Load message payload
+    RemoteConnection(const std::string& address, const std::vector<char>& loadPayload);
+    ~RemoteConnection();
+
+    void Submit(RemoteInferRequest* request, InferenceEngine::Task task);
+    // the number of the queued and in flight requests per request of the worker
+    double GetLoad() const;
+
+    const std::string       _address;
+    std::size_t             _numWorkerRequests = 1;
+
+protected:
+    void WriterThread();
+    void ReaderThread();
+    // fails all the queued and in flight requests, the following requests fail immediately
+    void Fail(const std::string& error);
+
+    Socket                                                  _socket;
+    mutable std::mutex                                      _mutex;
+    std::condition_variable                                 _queueCondition;
+    std::deque<RemoteInferRequest*>                         _queue;
+    std::unordered_map<std::uint64_t, RemoteInferRequest*>  _inFlight;
+    std::uint64_t                                           _nextId = 0;
+    std::string                                             _error;
+    bool                                                    _terminate = false;
+    std::thread                                             _writerThread;
+    std::thread                                             _readerThread;
+};
+
+class RemoteExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<RemoteExecutableNetwork>;
+
+    RemoteExecutableNetwork(const std::vector<RemoteConnection::Ptr>&                           connections,
+                            const std::string&                                                  networkName,
+                            const std::unordered_map<std::string, InferenceEngine::Parameter>&  config);
+    ~RemoteExecutableNetwork() override = default;
+
+    InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name) const override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+    InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
+
+    // the connection to the least loaded worker
+    RemoteConnection& SelectConnection() const;
+
+protected:
+    std::vector<RemoteConnection::Ptr>                                  _connections;
+    std::string                                                         _networkName;
+    std::unordered_map<std::string, InferenceEngine::Parameter>         _config;
+};
+
+class RemoteAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<RemoteAsyncInferRequest>;
+
+    RemoteAsyncInferRequest(const RemoteInferRequest::Ptr&             inferRequest,
+                            const RemoteExecutableNetwork::Ptr&        remoteExecutableNetwork,
+                            const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    ~RemoteAsyncInferRequest() override;
+
+protected:
+    RemoteExecutableNetwork::Ptr    _remoteExecutableNetwork;
+    RemoteInferRequest::Ptr         _inferRequest;
+};
+
+class RemoteInferencePlugin : public InferenceEngine::InferencePluginInternal {
+public:
+    RemoteInferencePlugin();
+    ~RemoteInferencePlugin() override = default;
+
+    InferenceEngine::ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::CNNNetwork&        network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+};
+
+}  // namespace RemotePlugin
@@ -0,0 +1,228 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <climits>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <details/ie_exception.hpp>
+#include "remote_transport.hpp"
+
+namespace RemotePlugin {
+namespace {
+    // the blobs are sent with the headers of the pipelined requests in one call, so Nagle's delay is not needed
+    void SetSocketOptions(int fd) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+#ifdef SO_NOSIGPIPE
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+    }
+}  // namespace
+
+Socket::~Socket() {
+    if (_fd >= 0) {
+        close(_fd);
+    }
+}
+
+Socket::Socket(Socket&& other) : _fd{other._fd} {
+    other._fd = -1;
+}
+
+Socket& Socket::operator=(Socket&& other) {
+    std::swap(_fd, other._fd);
+    return *this;
+}
+
+Socket Socket::Connect(const std::string& address) {
+    auto colon = address.find_last_of(':');
+    if (colon == std::string::npos || colon == 0 || colon + 1 == address.size()) {
+        THROW_IE_EXCEPTION << "Wrong address of the REMOTE worker: " << address << ", please use the <host>:<port> format";
+    }
+    auto host = address.substr(0, colon);
+    auto port = address.substr(colon + 1);
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    auto rc = getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses);
+    if (rc != 0) {
+        THROW_IE_EXCEPTION << "Failed to resolve the REMOTE worker address " << address << ": " << gai_strerror(rc);
+    }
+    Socket result;
+    for (auto it = addresses; it != nullptr && result._fd < 0; it = it->ai_next) {
+        Socket candidate{socket(it->ai_family, it->ai_socktype, it->ai_protocol)};
+        if (candidate._fd >= 0 && 0 == connect(candidate._fd, it->ai_addr, it->ai_addrlen)) {
+            result = std::move(candidate);
+        }
+    }
+    freeaddrinfo(addresses);
+    if (result._fd < 0) {
+        THROW_IE_EXCEPTION << "Failed to connect to the REMOTE worker " << address << ": " << std::strerror(errno);
+    }
+    SetSocketOptions(result._fd);
+    return result;
+}
+
+Socket Socket::Listen(const std::string& host, int port) {
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<std::uint16_t>(port));
+    if (1 != inet_pton(AF_INET, host.c_str(), &address.sin_addr)) {
+        THROW_IE_EXCEPTION << "Wrong IPv4 address to listen on: " << host;
+    }
+    Socket result{socket(AF_INET, SOCK_STREAM, 0)};
+    if (result._fd < 0) {
+        THROW_IE_EXCEPTION << "Failed to create a socket: " << std::strerror(errno);
+    }
+    int one = 1;
+    setsockopt(result._fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (0 != bind(result._fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) || 0 != listen(result._fd, SOMAXCONN)) {
+        THROW_IE_EXCEPTION << "Failed to listen on " << host << ":" << port << ": " << std::strerror(errno);
+    }
+    return result;
+}
+
+int Socket::LocalPort() const {
+    sockaddr_in address = {};
+    socklen_t size = sizeof(address);
+    if (0 != getsockname(_fd, reinterpret_cast<sockaddr*>(&address), &size)) {
+        THROW_IE_EXCEPTION << "Failed to get the socket address: " << std::strerror(errno);
+    }
+    return ntohs(address.sin_port);
+}
+
+Socket Socket::Accept() {
+    Socket result;
+    do {
+        result._fd = accept(_fd, nullptr, nullptr);
+    } while (result._fd < 0 && errno == EINTR);
+    if (result._fd < 0) {
+        THROW_IE_EXCEPTION << "Failed to accept a connection: " << std::strerror(errno);
+    }
+    SetSocketOptions(result._fd);
+    return result;
+}
+
+void Socket::Write(std::vector<iovec> buffers) {
+#ifdef MSG_NOSIGNAL
+    constexpr int flags = MSG_NOSIGNAL;
+#else
+    constexpr int flags = 0;
+#endif
+    std::size_t first = 0;
+    while (first < buffers.size()) {
+        msghdr message = {};
+        message.msg_iov = buffers.data() + first;
+        message.msg_iovlen = std::min<std::size_t>(buffers.size() - first, IOV_MAX);
+        auto written = sendmsg(_fd, &message, flags);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            THROW_IE_EXCEPTION << "Failed to send data to the REMOTE connection: " << std::strerror(errno);
+        }
+        // skips the sent buffers and the sent part of the partially sent one
+        auto remaining = static_cast<std::size_t>(written);
+        while (first < buffers.size() && remaining >= buffers[first].iov_len) {
+            remaining -= buffers[first].iov_len;
+            ++first;
+        }
+        if (remaining > 0) {
+            buffers[first].iov_base = static_cast<char*>(buffers[first].iov_base) + remaining;
+            buffers[first].iov_len -= remaining;
+        }
+    }
+}
+
+void Socket::Write(const MessageHeader& header, const void* payload) {
+    std::vector<iovec> buffers = {{const_cast<MessageHeader*>(&header), sizeof(header)}};
+    if (header.size > 0) {
+        buffers.push_back({const_cast<void*>(payload), static_cast<std::size_t>(header.size)});
+    }
+    Write(std::move(buffers));
+}
+
+void Socket::Read(void* data, std::size_t size) {
+    auto ptr = static_cast<char*>(data);
+    while (size > 0) {
+        auto received = recv(_fd, ptr, size, 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            THROW_IE_EXCEPTION << "The REMOTE connection is closed" << (received < 0 ? ": " : "")
+                               << (received < 0 ? std::strerror(errno) : "");
+        }
+        ptr += received;
+        size -= static_cast<std::size_t>(received);
+    }
+}
+
+MessageHeader Socket::ReadHeader() {
+    MessageHeader header;
+    Read(&header, sizeof(header));
+    return header;
+}
+
+std::vector<char> Socket::ReadPayload(const MessageHeader& header, std::uint64_t maxSize) {
+    if (header.size > maxSize) {
+        THROW_IE_EXCEPTION << "The REMOTE message of " << header.size << " bytes exceeds the limit of " << maxSize << " bytes";
+    }
+    std::vector<char> payload(static_cast<std::size_t>(header.size));
+    Read(payload.data(), payload.size());
+    return payload;
+}
+
+void Socket::Shutdown() {
+    if (_fd >= 0) {
+        shutdown(_fd, SHUT_RDWR);
+    }
+}
+
+void PayloadWriter::Append(const std::string& value) {
+    Append(static_cast<std::uint64_t>(value.size()));
+    _data.insert(_data.end(), value.begin(), value.end());
+}
+
+void PayloadWriter::Append(std::uint64_t value) {
+    auto bytes = reinterpret_cast<const char*>(&value);
+    _data.insert(_data.end(), bytes, bytes + sizeof(value));
+}
+
+std::string PayloadReader::ReadString() {
+    auto size = ReadInteger();
+    if (size > _data.size() - _offset) {
+        THROW_IE_EXCEPTION << "Malformed message of the REMOTE connection";
+    }
+    std::string value(_data.data() + _offset, static_cast<std::size_t>(size));
+    _offset += static_cast<std::size_t>(size);
+    return value;
+}
+
+std::uint64_t PayloadReader::ReadInteger() {
+    std::uint64_t value = 0;
+    if (sizeof(value) > _data.size() - _offset) {
+        THROW_IE_EXCEPTION << "Malformed message of the REMOTE connection";
+    }
+    std::memcpy(&value, _data.data() + _offset, sizeof(value));
+    _offset += sizeof(value);
+    return value;
+}
+
+}  // namespace RemotePlugin
@@ -0,0 +1,98 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <sys/uio.h>
+
+namespace RemotePlugin {
+
+/**
+ * @brief The messages between the REMOTE plugin and the worker process. The plugin opens a connection per executable
+ * network and worker: the first message is Load, that is answered by Loaded (or Error), then any number of Infer
+ * messages are sent without waiting for the results (pipelining), the Result (or Error) messages return in any order
+ * with the id of the Infer message. The blobs are sent as raw bytes, so the hosts must have the same byte order.
+ */
+enum class MessageType : std::uint32_t {
+    Load = 1,   // device, config, inputs and outputs info, IR xml and weights
+    Loaded,     // the number of requests the worker runs in parallel
+    Infer,      // input blobs in the order of the names
+    Result,     // output blobs in the order of the names
+    Error,      // error message
+};
+
+struct MessageHeader {
+    std::uint32_t   type = 0;
+    std::uint32_t   reserved = 0;
+    std::uint64_t   id = 0;
+    std::uint64_t   size = 0;  // payload size in bytes
+};
+static_assert(sizeof(MessageHeader) == 24, "MessageHeader must have no padding");
+
+// the limit of the Loaded and Error messages, the sizes of the blobs are checked against the network
+constexpr std::uint64_t kMaxControlPayloadSize = 1 << 20;
+
+/**
+ * @brief Blocking TCP socket. All the errors are reported with exceptions
+ */
+class Socket {
+public:
+    Socket() = default;
+    explicit Socket(int fd) : _fd{fd} {}
+    ~Socket();
+    Socket(Socket&& other);
+    Socket& operator=(Socket&& other);
+    Socket(const Socket&) = delete;
+    Socket& operator=(const Socket&) = delete;
+
+    // connects to the "<host>:<port>" address
+    static Socket Connect(const std::string& address);
+    // listens on the IPv4 address, the port 0 selects any free port
+    static Socket Listen(const std::string& host, int port);
+    Socket Accept();
+    int LocalPort() const;
+
+    // writes all the buffers at once (a single system call if possible)
+    void Write(std::vector<iovec> buffers);
+    void Write(const MessageHeader& header, const void* payload = nullptr);
+    void Read(void* data, std::size_t size);
+    MessageHeader ReadHeader();
+    // the size comes from the other side, so the payload is not allocated if it exceeds the limit
+    std::vector<char> ReadPayload(const MessageHeader& header, std::uint64_t maxSize);
+    // unblocks the reads and writes of other threads, which then fail
+    void Shutdown();
+
+private:
+    int _fd = -1;
+};
+
+/**
+ * @brief Serialization of the Load and Error message payloads
+ */
+class PayloadWriter {
+public:
+    void Append(const std::string& value);
+    void Append(std::uint64_t value);
+    std::vector<char>   _data;
+};
+
+class PayloadReader {
+public:
+    explicit PayloadReader(const std::vector<char>& data) : _data{data} {}
+    std::string ReadString();
+    std::uint64_t ReadInteger();
+
+private:
+    const std::vector<char>&    _data;
+    std::size_t                 _offset = 0;
+};
+
+}  // namespace RemotePlugin
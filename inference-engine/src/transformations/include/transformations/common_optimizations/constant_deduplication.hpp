@@ -0,0 +1,33 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/pass.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API ConstantDeduplication;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief ConstantDeduplication transformation replaces Constant operations having
+ * the same element type, shape and data with the first of them, so each distinct
+ * tensor is stored and converted by plugins once. Constants are matched by a hash
+ * of their data and compared before replacement; constants sharing one buffer (e.g.
+ * read from the same offset of the IR weights) are matched without reading the data.
+ */
+class ngraph::pass::ConstantDeduplication: public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API ConvolutionInputFusion;
+class TRANSFORMATIONS_API AddConvolutionFusion;
+class TRANSFORMATIONS_API MultiplyConvolutionFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief ConvolutionInputFusion folds per input channel normalization of the Convolution input
+ * (x * scale + shift, the form LinOpSequenceFusion brings Subtract(mean) -> Multiply(scale) to)
+ * into the Convolution weights and an Add of the output channels bias.
+ */
+class ngraph::pass::ConvolutionInputFusion: public ngraph::pass::GraphRewrite {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ConvolutionInputFusion() {
+        add_matcher<ngraph::pass::AddConvolutionFusion>();
+        add_matcher<ngraph::pass::MultiplyConvolutionFusion>();
+    }
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief AddConvolutionFusion replaces Add(x, shift) -> Convolution with Convolution -> Add(bias),
+ * where bias is the sum of the weights multiplied by shift. The padding of the input with zeros
+ * isn't shifted, so only Convolutions without padding are fused.
+ */
+class ngraph::pass::AddConvolutionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    AddConvolutionFusion();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief MultiplyConvolutionFusion replaces Multiply(x, scale) -> Convolution with Convolution
+ * with the weights multiplied by scale over input channels.
+ */
+class ngraph::pass::MultiplyConvolutionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MultiplyConvolutionFusion();
+};
@@ -25,6 +25,9 @@ class TRANSFORMATIONS_API UnrollTensorIterator;
  * the number of iterations of the TensorIterator layer, are created and connected to each other and to the external
  * network. If the number of TensorIterator iterations is greater than 1, then additional Concat and Split layers
  * are added to the network.
+ * Loop layer is unrolled the same way if its execution condition is a constant true and the number of iterations
+ * is known. The state of the body (ReadValue/Assign with the same variable) is read by the first copy of the body,
+ * written by the last one and passed between the copies directly.
  */
 
 class ngraph::pass::UnrollTensorIterator: public ngraph::pass::FunctionPass {
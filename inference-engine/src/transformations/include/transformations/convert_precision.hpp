@@ -67,6 +67,10 @@ class TRANSFORMATIONS_API ConvertPrecision;
  *     GreaterEqual
  *     Less
  *     LessEqual
+ *
+ * Constants which have "KEEP_CONST_PRECISION" key in runtime info keep their precision: their consumers get
+ * the data through a Convert operation which is excluded from constant folding. This way compressed (e.g. FP16)
+ * weights are not decompressed by the conversion, a plugin may consume them as is.
  */
 
 class ngraph::pass::ConvertPrecision : public ngraph::pass::FunctionPass {
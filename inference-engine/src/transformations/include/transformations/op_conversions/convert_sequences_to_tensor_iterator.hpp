@@ -24,6 +24,7 @@ class TRANSFORMATIONS_API ConvertLSTMSequenceToTensorIterator;
 /**
  * @ingroup ie_transformation_common_api
  * @brief ConvertRNNSequenceToTensorIterator transformation converts RNNSequence layer to TensorIterator
+ * unless the transformation callback returns true for it
  * *
  */
 
@@ -36,6 +37,7 @@ public:
 /**
  * @ingroup ie_transformation_common_api
  * @brief ConvertGRUSequenceToTensorIterator transformation converts GRUSequence layer to TensorIterator
+ * unless the transformation callback returns true for it
  * *
  */
 
@@ -48,6 +50,7 @@ public:
 /**
  * @ingroup ie_transformation_common_api
  * @brief ConvertLSTMSequenceToTensorIterator transformation converts LSTMSequence layer to TensorIterator
+ * unless the transformation callback returns true for it
  * *
  */
 
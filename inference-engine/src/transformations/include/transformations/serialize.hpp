@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <ostream>
 #include <string>
 
 #include "ngraph/opsets/opset.hpp"
@@ -37,9 +38,20 @@ public:
               Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {})
         : m_xmlPath{xmlPath}, m_binPath{binPath}, m_version{version}, m_custom_opsets{custom_opsets} {}
 
+    /**
+     * @brief Serializes the function into the given streams instead of files
+     * @param xmlFile Stream for the IR topology (.xml content)
+     * @param binFile Stream for the IR weights (.bin content)
+     */
+    Serialize(std::ostream& xmlFile, std::ostream& binFile,
+              Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {})
+        : m_xmlFile{&xmlFile}, m_binFile{&binFile}, m_version{version}, m_custom_opsets{custom_opsets} {}
+
 private:
     const std::string m_xmlPath;
     const std::string m_binPath;
+    std::ostream* m_xmlFile = nullptr;
+    std::ostream* m_binFile = nullptr;
     const Version m_version;
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
 };
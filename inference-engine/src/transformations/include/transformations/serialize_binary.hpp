@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "ngraph/pass/pass.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API SerializeBinary;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief SerializeBinary transformation saves ngraph::Function in a compact binary format,
+ * which is read back by the Inference Engine binary reader without any graph transformations.
+ *
+ * The topology file (.ngbin) stores the operations in topological order. Every operation is
+ * written as its type name and version, friendly name, inputs (producer index and output index),
+ * attributes collected by the Visitor API and runtime info. The weights file (.bin) holds the data
+ * of constants, every constant starts at an offset aligned to ConstantAlignment bytes,
+ * so the reader can refer to a memory mapped weights file instead of copying it.
+ *
+ * All numbers are stored in host byte order; strings and vectors are prefixed with their
+ * 64-bit length.
+ * @attention
+ * - sub-graph operations (TensorIterator, Loop) are not supported
+ * - GenericIE operation type (experimental opset) is not supported
+ * - only string and integer runtime info and FusedNames, PrimitivesPriority and DequantizationAttr
+ * attributes are saved, other runtime info is skipped
+ */
+class ngraph::pass::SerializeBinary : public ngraph::pass::FunctionPass {
+public:
+    enum : uint32_t {
+        Magic = 0x4E42474E,  // "NGBN"
+        FormatVersion = 1,
+        ConstantAlignment = 64
+    };
+
+    enum class AttributeType : uint8_t {
+        End = 0,
+        Bool,
+        Int64,
+        Double,
+        String,
+        VectorInt8,
+        VectorInt16,
+        VectorInt32,
+        VectorInt64,
+        VectorUInt8,
+        VectorUInt16,
+        VectorUInt32,
+        VectorUInt64,
+        VectorFloat,
+        VectorDouble,
+        VectorString,
+        Data  // offset and size of the data in the weights file
+    };
+
+    enum class RuntimeInfoType : uint8_t {
+        String = 0,
+        Int64,
+        FusedNames,
+        PrimitivesPriority,
+        Dequantization
+    };
+
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    SerializeBinary(const std::string& modelPath, const std::string& binPath)
+        : m_modelPath{modelPath}, m_binPath{binPath} {}
+
+    /**
+     * @brief Serializes the function into the given streams instead of files
+     * @param modelFile Stream for the topology (.ngbin content)
+     * @param binFile Stream for the weights (.bin content)
+     */
+    SerializeBinary(std::ostream& modelFile, std::ostream& binFile)
+        : m_modelFile{&modelFile}, m_binFile{&binFile} {}
+
+private:
+    const std::string m_modelPath;
+    const std::string m_binPath;
+    std::ostream* m_modelFile = nullptr;
+    std::ostream* m_binFile = nullptr;
+};
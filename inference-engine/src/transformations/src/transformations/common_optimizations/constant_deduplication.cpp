@@ -0,0 +1,104 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "transformations/common_optimizations/constant_deduplication.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantDeduplication, "ConstantDeduplication", 0);
+
+namespace {
+
+struct ConstantInfo {
+    std::shared_ptr<ngraph::opset1::Constant> constant;
+    size_t byte_size = 0;
+    uint64_t hash = 0;
+    bool hashed = false;
+};
+
+// FNV-1a over 8-byte words
+uint64_t hash_data(const char* data, size_t size) {
+    const uint64_t prime = 1099511628211ull;
+    uint64_t hash = 14695981039346656037ull;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * prime;
+    }
+    return hash;
+}
+
+uint64_t get_hash(ConstantInfo& info) {
+    if (!info.hashed) {
+        info.hash = hash_data(static_cast<const char*>(info.constant->get_data_ptr()), info.byte_size);
+        info.hashed = true;
+    }
+    return info.hash;
+}
+
+bool is_same_data(ConstantInfo& a, ConstantInfo& b) {
+    const char* a_data = static_cast<const char*>(a.constant->get_data_ptr());
+    const char* b_data = static_cast<const char*>(b.constant->get_data_ptr());
+    if (a_data == b_data)
+        return true;
+    return get_hash(a) == get_hash(b) && std::memcmp(a_data, b_data, a.byte_size) == 0;
+}
+
+bool feeds_result(const std::shared_ptr<ngraph::Node>& node) {
+    for (const auto& input : node->output(0).get_target_inputs()) {
+        if (ngraph::is_type<ngraph::opset1::Result>(input.get_node()))
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+bool ngraph::pass::ConstantDeduplication::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    bool rewritten = false;
+    // the data is hashed only for the constants of the same type and shape
+    std::map<std::pair<element::Type, Shape>, std::vector<ConstantInfo>> groups;
+    for (auto & node : f->get_ordered_ops()) {
+        // Recursively apply transformation for sub-graph based operations
+        if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node)) {
+            if (auto sub_graph = sub_graph_node->get_function()) {
+                rewritten |= run_on_function(sub_graph);
+            }
+        }
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node);
+        // constants consumed by Result define output names, they are kept
+        if (!constant || feeds_result(constant))
+            continue;
+
+        ConstantInfo info;
+        info.constant = constant;
+        // integer math, float loses the tail bytes of large constants
+        info.byte_size = (shape_size(constant->get_shape()) * constant->get_element_type().bitwidth() + 7) / 8;
+
+        auto& group = groups[{constant->get_element_type(), constant->get_shape()}];
+        bool replaced = false;
+        for (auto& first : group) {
+            if (is_same_data(first, info)) {
+                copy_runtime_info({first.constant, constant}, first.constant);
+                constant->output(0).replace(first.constant->output(0));
+                replaced = rewritten = true;
+                break;
+            }
+        }
+        if (!replaced)
+            group.push_back(info);
+    }
+    return rewritten;
+}
@@ -0,0 +1,143 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/conv_input_fusion.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include <transformations/utils/utils.hpp>
+
+using namespace ngraph;
+
+namespace {
+
+// Reshapes per input channel constant to [1, C, 1, 1] to apply it to the weights of [O, C, Y, X] layout.
+// Returns empty output if the constant isn't applied per input channel or it broadcasts the Convolution input.
+Output<Node> align_to_input_channels(const Output<Node> & constant, const Shape & weights_shape) {
+    auto expected_shape = Shape(weights_shape.size(), 1);
+    expected_shape[1] = weights_shape[1];
+    if (op::util::check_for_broadcast(expected_shape, constant.get_shape())) {
+        return {};
+    }
+    if (shape_size(constant.get_shape()) == 1) {
+        return constant;
+    }
+    return std::make_shared<opset4::Reshape>(constant,
+                                             opset4::Constant::create(element::i64, Shape{expected_shape.size()}, expected_shape), false);
+}
+
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::ConvolutionInputFusion, "ConvolutionInputFusion", 0);
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::AddConvolutionFusion, "AddConvolutionFusion", 0);
+
+ngraph::pass::AddConvolutionFusion::AddConvolutionFusion() {
+    auto input = pattern::any_input();
+    auto add_const = pattern::wrap_type<opset4::Constant>(pattern::has_static_shape());
+    auto add = pattern::wrap_type<opset4::Add>({input, add_const}, pattern::consumers_count(1));
+    auto weights = pattern::wrap_type<opset4::Constant>();
+    auto conv = pattern::wrap_type<opset4::Convolution>({add, weights});
+
+    matcher_pass_callback callback = [=](pattern::Matcher & m) -> bool {
+        const auto & pattern_to_output = m.get_pattern_value_map();
+
+        auto m_conv = std::dynamic_pointer_cast<opset4::Convolution>(pattern_to_output.at(conv).get_node_shared_ptr());
+        const auto & m_add = pattern_to_output.at(add).get_node_shared_ptr();
+        const auto & m_input = pattern_to_output.at(input);
+        const auto & m_weights = pattern_to_output.at(weights);
+        const auto & m_const = pattern_to_output.at(add_const);
+
+        if (!m_conv || m_transformation_callback(m_conv) || m_const.get_element_type() != m_weights.get_element_type()) {
+            return false;
+        }
+
+        // The Convolution pads the shifted input with zeros, which can't be expressed with the bias
+        auto is_zero = [](std::ptrdiff_t pad) { return pad == 0; };
+        if (m_conv->get_auto_pad() == op::PadType::SAME_UPPER || m_conv->get_auto_pad() == op::PadType::SAME_LOWER ||
+            !std::all_of(m_conv->get_pads_begin().begin(), m_conv->get_pads_begin().end(), is_zero) ||
+            !std::all_of(m_conv->get_pads_end().begin(), m_conv->get_pads_end().end(), is_zero)) {
+            return false;
+        }
+
+        const auto & weights_shape = m_weights.get_shape();
+        auto shift = align_to_input_channels(m_const, weights_shape);
+        if (!shift.get_node_shared_ptr()) {
+            return false;
+        }
+
+        // Each output channel is shifted by the sum of its weights multiplied by the input channels shift
+        const auto weights_rank = weights_shape.size();
+        std::vector<int64_t> reduce_axes(weights_rank - 1);
+        std::iota(reduce_axes.begin(), reduce_axes.end(), 1);
+        auto weighted_shift = std::make_shared<opset4::Multiply>(m_weights, shift);
+        auto reduced_shift = std::make_shared<opset4::ReduceSum>(weighted_shift,
+                                                                 opset4::Constant::create(element::i64, Shape{reduce_axes.size()}, reduce_axes),
+                                                                 false);
+        auto bias_shape = Shape(weights_rank, 1);
+        bias_shape[1] = weights_shape[0];
+        auto bias = std::make_shared<opset4::Reshape>(reduced_shift,
+                                                      opset4::Constant::create(element::i64, Shape{bias_shape.size()}, bias_shape), false);
+
+        // The new Convolution may get the input Multiply fused as well
+        auto new_conv = register_new_node<opset4::Convolution>(m_input, m_weights, m_conv->get_strides(), m_conv->get_pads_begin(),
+                                                               m_conv->get_pads_end(), m_conv->get_dilations(), m_conv->get_auto_pad());
+        auto new_add = std::make_shared<opset4::Add>(new_conv, bias);
+        new_conv->set_friendly_name(m_conv->get_friendly_name() + "/WithoutBias");
+        new_add->set_friendly_name(m_conv->get_friendly_name());
+        copy_runtime_info({m_add, m_conv}, {new_conv, weighted_shift, reduced_shift, bias, new_add});
+        replace_node(m_conv, new_add);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(conv, "AddConvolutionFusion");
+    register_matcher(m, callback);
+}
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::MultiplyConvolutionFusion, "MultiplyConvolutionFusion", 0);
+
+ngraph::pass::MultiplyConvolutionFusion::MultiplyConvolutionFusion() {
+    auto input = pattern::any_input();
+    auto mul_const = pattern::wrap_type<opset4::Constant>(pattern::has_static_shape());
+    auto mul = pattern::wrap_type<opset4::Multiply>({input, mul_const}, pattern::consumers_count(1));
+    auto weights = pattern::wrap_type<opset4::Constant>();
+    auto conv = pattern::wrap_type<opset4::Convolution>({mul, weights});
+
+    matcher_pass_callback callback = [=](pattern::Matcher & m) -> bool {
+        const auto & pattern_to_output = m.get_pattern_value_map();
+
+        const auto & m_conv = pattern_to_output.at(conv).get_node_shared_ptr();
+        const auto & m_mul = pattern_to_output.at(mul).get_node_shared_ptr();
+        const auto & m_input = pattern_to_output.at(input);
+        const auto & m_weights = pattern_to_output.at(weights);
+        const auto & m_const = pattern_to_output.at(mul_const);
+
+        if (m_transformation_callback(m_conv) || m_const.get_element_type() != m_weights.get_element_type()) {
+            return false;
+        }
+
+        auto scale = align_to_input_channels(m_const, m_weights.get_shape());
+        if (!scale.get_node_shared_ptr()) {
+            return false;
+        }
+
+        // Scale of the input channel is applied to all weights which read it
+        auto weights_multiply = std::make_shared<opset4::Multiply>(m_weights, scale);
+        auto new_conv = m_conv->copy_with_new_inputs({m_input, weights_multiply});
+        new_conv->set_friendly_name(m_conv->get_friendly_name());
+        copy_runtime_info({m_mul, m_conv}, {new_conv, scale.get_node_shared_ptr(), weights_multiply});
+        replace_node(m_conv, new_conv);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(conv, "MultiplyConvolutionFusion");
+    register_matcher(m, callback);
+}
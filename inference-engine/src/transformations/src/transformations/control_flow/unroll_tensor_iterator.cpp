@@ -5,11 +5,14 @@
 #include "transformations/control_flow/unroll_tensor_iterator.hpp"
 #include "transformations/utils/utils.hpp"
 
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <ngraph/graph_util.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/rt_info.hpp>
 
@@ -17,15 +20,28 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::UnrollTensorIterator, "UnrollTensorIterator
 
 bool ngraph::pass::UnrollTensorIterator::run_on_function(std::shared_ptr<ngraph::Function> f) {
     for (const auto& op : f->get_ops()) {
-        auto ti = std::dynamic_pointer_cast<ngraph::opset4::TensorIterator>(op);
+        auto ti = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(op);
         if (!ti || m_transformation_callback(ti)) {
             continue;
         }
 
-        const auto& function = ti->get_body();
-        const auto num_iter = ti->get_num_iterations();
+        const auto& function = ti->get_function();
+        int64_t num_iter = -1;
+        int64_t current_iteration_idx = -1;
+        if (const auto& tensor_iterator = std::dynamic_pointer_cast<ngraph::opset4::TensorIterator>(ti)) {
+            num_iter = tensor_iterator->get_num_iterations();
+        } else if (const auto& loop = std::dynamic_pointer_cast<ngraph::opset5::Loop>(ti)) {
+            // Loop is unrolled only if it is known in advance that all its iterations are executed
+            const auto& exec_condition = std::dynamic_pointer_cast<ngraph::opset5::Constant>(
+                    loop->input_value(1).get_node_shared_ptr());
+            current_iteration_idx = loop->get_special_body_ports().current_iteration_input_idx;
+            if (exec_condition && exec_condition->cast_vector<bool>()[0] && (current_iteration_idx < 0 ||
+                    function->get_parameters()[current_iteration_idx]->get_output_partial_shape(0).is_static())) {
+                num_iter = loop->get_num_iterations();
+            }
+        }
 
-        // negative value means inconsistent TI
+        // negative value means inconsistent TI or Loop with unknown number of iterations
         if (num_iter <= -1) {
             continue;
         }
@@ -39,6 +55,12 @@ bool ngraph::pass::UnrollTensorIterator::run_on_function(std::shared_ptr<ngraph:
                 node->set_friendly_name(ti->get_friendly_name() + "/" + std::to_string(idx + 1) + "/" + node->get_friendly_name());
                 copy_runtime_info(ti, node);
             }
+            if (current_iteration_idx >= 0) {
+                const auto& param = body_functions[idx]->get_parameters()[current_iteration_idx];
+                auto iteration = ngraph::opset5::Constant::create(param->get_element_type(), param->get_shape(), {idx});
+                copy_runtime_info(ti, iteration);
+                param->output(0).replace(iteration);
+            }
         }
 
         // Port map : inputs and back edges
@@ -163,8 +185,48 @@ bool ngraph::pass::UnrollTensorIterator::run_on_function(std::shared_ptr<ngraph:
             }
         }
 
-        for (const auto& body_func : body_functions) {
-            f->add_sinks(body_func->get_sinks());
+        // States (e.g. inserted by the LowLatency transformation) are read by the first copy of the body and
+        // written by the last one, the copies in between pass the state values to each other directly.
+        std::map<std::string, std::shared_ptr<ngraph::opset5::ReadValue>> first_read_values;
+        for (const auto& node : body_functions[0]->get_ops()) {
+            if (auto read_value = std::dynamic_pointer_cast<ngraph::opset5::ReadValue>(node)) {
+                first_read_values[read_value->get_variable_id()] = read_value;
+            }
+        }
+        for (int64_t j = 0; j < num_iter; j++) {
+            std::map<std::string, std::shared_ptr<ngraph::opset5::Assign>> next_assigns;
+            for (const auto& sink : body_functions[j]->get_sinks()) {
+                auto assign = std::dynamic_pointer_cast<ngraph::opset5::Assign>(sink);
+                if (assign && j + 1 < num_iter) {
+                    next_assigns[assign->get_variable_id()] = assign;
+                } else {
+                    f->add_sinks({sink});
+                }
+            }
+            if (next_assigns.empty()) {
+                continue;
+            }
+
+            for (const auto& node : body_functions[j + 1]->get_ops()) {
+                auto read_value = std::dynamic_pointer_cast<ngraph::opset5::ReadValue>(node);
+                auto first_read_value = read_value ? first_read_values.find(read_value->get_variable_id())
+                                                   : first_read_values.end();
+                if (first_read_value == first_read_values.end() || !next_assigns.count(read_value->get_variable_id())) {
+                    continue;
+                }
+                auto& assign = next_assigns[read_value->get_variable_id()];
+                read_value->output(0).replace(assign->input_value(0));
+                // keep the order: the state is read before the final value is assigned
+                for (auto dependent : std::vector<Node*>(read_value->get_control_dependents())) {
+                    dependent->remove_control_dependency(read_value);
+                    dependent->add_control_dependency(first_read_value->second);
+                }
+                assign->clear_control_dependencies();
+                next_assigns.erase(read_value->get_variable_id());
+            }
+            for (const auto& assign : next_assigns) {
+                f->add_sinks({assign.second});
+            }
         }
     }
     return true;
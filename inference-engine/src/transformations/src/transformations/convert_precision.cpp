@@ -5,17 +5,20 @@
 #include "transformations/convert_precision.hpp"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
 
 using namespace ngraph;
 
 bool fuse_type_to_constant(std::shared_ptr<ngraph::Node> & node, ngraph::element::Type to, const std::vector<ngraph::Input<ngraph::Node>> & consumers);
+bool keep_constant_precision(std::shared_ptr<ngraph::Node> & node, ngraph::element::Type to, const std::vector<ngraph::Input<ngraph::Node>> & consumers);
 bool fuse_type_to_shapeof(std::shared_ptr<ngraph::Node> & node, ngraph::element::Type to, size_t idx);
 bool fuse_type_to_shapeof_v0(std::shared_ptr<ngraph::Node> & node, ngraph::element::Type to, size_t idx);
 bool fuse_type_to_parameter(std::shared_ptr<ngraph::Node> & node, ngraph::element::Type to, size_t idx);
@@ -128,7 +131,11 @@ bool ngraph::pass::ConvertPrecision::run_on_function(std::shared_ptr<ngraph::Fun
             if (output.get_element_type() == m_from) {
                 // Handle case with Constants as they can have consumers from other nGraph Function object
                 if (ngraph::op::is_constant(node) && const_to_internal_output.count(node)) {
-                    fuse_type_to_constant(node, m_to, const_to_internal_output.at(node));
+                    if (node->get_rt_info().count("KEEP_CONST_PRECISION")) {
+                        keep_constant_precision(node, m_to, const_to_internal_output.at(node));
+                    } else {
+                        fuse_type_to_constant(node, m_to, const_to_internal_output.at(node));
+                    }
                     break;
                 }
 
@@ -197,6 +204,16 @@ bool ngraph::pass::ConvertPrecision::run_on_function(std::shared_ptr<ngraph::Fun
     return true;
 }
 
+bool keep_constant_precision(std::shared_ptr<Node> & node, element::Type to, const std::vector<Input<Node>> & consumers) {
+    auto convert = std::make_shared<opset4::Convert>(node, to);
+    convert->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = std::make_shared<VariantWrapper<std::string>>("");
+    convert->set_friendly_name(node->get_friendly_name() + "/convert");
+    for (auto & input : consumers) {
+        input.replace_source_output(convert);
+    }
+    return false;
+}
+
 bool fuse_type_to_shapeof(std::shared_ptr<Node> & node, element::Type to, size_t idx) {
     if (auto shapeof = as_type_ptr<opset4::ShapeOf>(node)) {
         if (to == element::i32 || to == element::i64) {
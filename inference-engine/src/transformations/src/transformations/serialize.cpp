@@ -3,6 +3,7 @@
 //
 
 #include <array>
+#include <cstring>
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -38,8 +39,63 @@ struct Edge {
 };
 
 struct ConstantAtributes {
-    int size = 0;
-    int offset = 0;
+    int64_t size = 0;
+    int64_t offset = 0;
+};
+
+// Writes the data of the constants straight from their buffers to the bin stream.
+// Identical constants (e.g. weights shared by the copies of a layer) are written once.
+class ConstantWriter {
+public:
+    explicit ConstantWriter(std::ostream& bin) : m_bin(bin) {}
+
+    ConstantAtributes write(const char* data, int64_t size) {
+        auto same_buffer = m_buffers.find(data);
+        if (same_buffer != m_buffers.end() && same_buffer->second.size == size) {
+            return same_buffer->second;
+        }
+
+        const size_t hash = hash_data(data, size);
+        auto candidates = m_hashes.equal_range(hash);
+        for (auto it = candidates.first; it != candidates.second; ++it) {
+            const ConstantAtributes& written = m_buffers.at(it->second);
+            if (written.size == size && std::memcmp(it->second, data, size) == 0) {
+                m_buffers[data] = written;
+                return written;
+            }
+        }
+
+        ConstantAtributes attr;
+        attr.size = size;
+        attr.offset = m_offset;
+        m_bin.write(data, size);
+        m_offset += size;
+        m_buffers[data] = attr;
+        m_hashes.emplace(hash, data);
+        return attr;
+    }
+
+private:
+    // FNV-1a over 8-byte words
+    static size_t hash_data(const char* data, int64_t size) {
+        const uint64_t prime = 1099511628211ull;
+        uint64_t hash = 14695981039346656037ull ^ static_cast<uint64_t>(size);
+        int64_t i = 0;
+        for (; i + static_cast<int64_t>(sizeof(uint64_t)) <= size; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            hash = (hash ^ word) * prime;
+        }
+        for (; i < size; i++) {
+            hash = (hash ^ static_cast<uint8_t>(data[i])) * prime;
+        }
+        return static_cast<size_t>(hash);
+    }
+
+    std::ostream& m_bin;
+    int64_t m_offset = 0;
+    std::unordered_map<const char*, ConstantAtributes> m_buffers;
+    std::unordered_multimap<size_t, const char*> m_hashes;
 };
 
 class XmlVisitor : public ngraph::AttributeVisitor {
@@ -176,17 +232,14 @@ const std::vector<Edge> create_edge_mapping(
 }
 
 // TODO: refactor to Vistor API when Constant will be supporting it
-ConstantAtributes dump_constant_data(std::vector<uint8_t>& bin,
+ConstantAtributes dump_constant_data(ConstantWriter& bin,
                                      const ngraph::op::Constant& c) {
     NGRAPH_CHECK(c.get_output_partial_shape(0.).is_static(),
                  "Unsupported dynamic output shape in ", c);
 
-    ConstantAtributes attr;
-    const uint8_t* p = reinterpret_cast<const uint8_t*>(c.get_data_ptr());
-    attr.size = ngraph::shape_size(c.get_shape()) * c.get_element_type().size();
-    attr.offset = bin.size();
-    bin.insert(end(bin), p, p + attr.size);
-    return attr;
+    const char* p = static_cast<const char*>(c.get_data_ptr());
+    const int64_t size = ngraph::shape_size(c.get_shape()) * c.get_element_type().size();
+    return bin.write(p, size);
 }
 
 std::string get_opset_name(
@@ -365,7 +418,7 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
 }
 
 void ngfunction_2_irv10(
-    pugi::xml_document& doc, std::vector<uint8_t>& bin,
+    pugi::xml_document& doc, ConstantWriter& bin,
     ngraph::Function& f,
     const std::map<std::string, ngraph::OpSet>& custom_opsets) {
     const bool exec_graph = is_exec_graph(f);
@@ -480,26 +533,30 @@ void ngfunction_2_irv10(
 // ! [function_pass:serialize_cpp]
 // serialize.cpp
 bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
-    // prepare data
-    pugi::xml_document xml_doc;
-    std::vector<uint8_t> constants;
-    switch (m_version) {
-    case Version::IR_V10:
-        ngfunction_2_irv10(xml_doc, constants, *f, m_custom_opsets);
-        break;
-    default:
-        NGRAPH_UNREACHABLE("Unsupported version");
-        break;
-    }
-
-    // create xml file
-    std::ofstream xml_file(m_xmlPath, std::ios::out);
-    xml_doc.save(xml_file);
+    // weights are written to the bin stream while the xml document is built,
+    // so they are never copied to an intermediate buffer
+    auto write = [&](std::ostream& xml_file, std::ostream& bin_file) {
+        pugi::xml_document xml_doc;
+        ConstantWriter constants(bin_file);
+        switch (m_version) {
+        case Version::IR_V10:
+            ngfunction_2_irv10(xml_doc, constants, *f, m_custom_opsets);
+            break;
+        default:
+            NGRAPH_UNREACHABLE("Unsupported version");
+            break;
+        }
+        xml_doc.save(xml_file);
+    };
 
-    // create bin file
-    std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
-    bin_file.write(reinterpret_cast<const char*>(constants.data()),
-                   constants.size() * sizeof(constants[0]));
+    if (m_xmlFile && m_binFile) {
+        write(*m_xmlFile, *m_binFile);
+    } else {
+        // create xml and bin files
+        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
+        write(xml_file, bin_file);
+    }
 
     // Return false because we didn't change nGraph Function
     return false;
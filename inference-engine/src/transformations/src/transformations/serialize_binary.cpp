@@ -0,0 +1,243 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#include <ngraph/variant.hpp>
+#include "ngraph/ops.hpp"
+#include "transformations/rt_info/dequantization_attribute.hpp"
+#include "transformations/rt_info/fused_names_attribute.hpp"
+#include "transformations/rt_info/primitives_priority_attribute.hpp"
+#include "transformations/serialize_binary.hpp"
+
+using namespace ngraph;
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::SerializeBinary, "SerializeBinary", 0);
+
+namespace {  // helpers
+using AttributeType = pass::SerializeBinary::AttributeType;
+using RuntimeInfoType = pass::SerializeBinary::RuntimeInfoType;
+
+template <typename T>
+void write_value(std::ostream& out, const T& value) {
+    static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be written as is");
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write_value(std::ostream& out, const std::string& value) {
+    write_value<uint64_t>(out, value.size());
+    out.write(value.data(), value.size());
+}
+
+template <typename T>
+void write_value(std::ostream& out, const std::vector<T>& values) {
+    write_value<uint64_t>(out, values.size());
+    out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+void write_value(std::ostream& out, const std::vector<std::string>& values) {
+    write_value<uint64_t>(out, values.size());
+    for (const auto& value : values) write_value(out, value);
+}
+
+void write_type(std::ostream& out, AttributeType type) {
+    write_value(out, static_cast<uint8_t>(type));
+}
+
+void write_type(std::ostream& out, RuntimeInfoType type) {
+    write_value(out, static_cast<uint8_t>(type));
+}
+}  // namespace
+
+namespace {  // implementation details
+class BinaryVisitor : public ngraph::AttributeVisitor {
+    std::ostream& m_out;
+    std::vector<uint8_t>& m_bin;
+    const ngraph::Node* m_node;
+
+    // Every attribute is prefixed with its size, so a reader can skip attributes it does not need
+    template <typename T>
+    void write_attribute(const std::string& name, AttributeType type, const T& value) {
+        std::ostringstream payload;
+        write_value(payload, value);
+        write_value(m_out, name);
+        write_type(m_out, type);
+        write_value(m_out, payload.str());
+    }
+
+public:
+    BinaryVisitor(std::ostream& out, std::vector<uint8_t>& bin, const ngraph::Node* node)
+        : m_out(out), m_bin(bin), m_node(node) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        NGRAPH_CHECK(false, "Unsupported attribute ", name, " in ", *m_node);
+    }
+    void on_adapter(const std::string& name, ngraph::VisitorAdapter& adapter) override {
+        NGRAPH_CHECK(false, "Unsupported attribute ", name, " in ", *m_node);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        const auto begin = reinterpret_cast<const uint8_t*>(adapter.get_ptr());
+        const uint64_t size = adapter.size();
+        // pad the weights, so the data can be referred to with the natural alignment in memory
+        m_bin.resize((m_bin.size() + pass::SerializeBinary::ConstantAlignment - 1) /
+                     pass::SerializeBinary::ConstantAlignment * pass::SerializeBinary::ConstantAlignment);
+        const uint64_t offset = m_bin.size();
+        m_bin.insert(m_bin.end(), begin, begin + size);
+        write_attribute(name, AttributeType::Data, std::vector<uint64_t>{offset, size});
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        write_attribute(name, AttributeType::Bool, static_cast<uint8_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        write_attribute(name, AttributeType::String, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        write_attribute(name, AttributeType::Int64, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        write_attribute(name, AttributeType::Double, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        write_attribute(name, AttributeType::VectorInt8, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        write_attribute(name, AttributeType::VectorInt16, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        write_attribute(name, AttributeType::VectorInt32, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write_attribute(name, AttributeType::VectorInt64, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        write_attribute(name, AttributeType::VectorUInt8, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        write_attribute(name, AttributeType::VectorUInt16, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        write_attribute(name, AttributeType::VectorUInt32, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write_attribute(name, AttributeType::VectorUInt64, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        write_attribute(name, AttributeType::VectorFloat, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        write_attribute(name, AttributeType::VectorDouble, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        write_attribute(name, AttributeType::VectorString, adapter.get());
+    }
+};
+
+void write_rt_info(std::ostream& out, const ngraph::Node& node) {
+    std::ostringstream entries;
+    uint32_t count = 0;
+    for (const auto& item : node.get_rt_info()) {
+        const auto& variant = item.second;
+        if (auto value = ngraph::as_type_ptr<VariantWrapper<std::string>>(variant)) {
+            write_value(entries, item.first);
+            write_type(entries, RuntimeInfoType::String);
+            write_value(entries, value->get());
+        } else if (auto value = ngraph::as_type_ptr<VariantWrapper<int64_t>>(variant)) {
+            write_value(entries, item.first);
+            write_type(entries, RuntimeInfoType::Int64);
+            write_value(entries, value->get());
+        } else if (auto value = ngraph::as_type_ptr<VariantWrapper<FusedNames>>(variant)) {
+            write_value(entries, item.first);
+            write_type(entries, RuntimeInfoType::FusedNames);
+            write_value(entries, value->get().getVectorNames());
+        } else if (auto value = ngraph::as_type_ptr<VariantWrapper<PrimitivesPriority>>(variant)) {
+            write_value(entries, item.first);
+            write_type(entries, RuntimeInfoType::PrimitivesPriority);
+            write_value(entries, value->get().getPrimitivesPriority());
+        } else if (auto value = ngraph::as_type_ptr<VariantWrapper<DequantizationAttr>>(variant)) {
+            write_value(entries, item.first);
+            write_type(entries, RuntimeInfoType::Dequantization);
+            write_value(entries, value->get().getDequantizationAttr());
+        } else {
+            continue;
+        }
+        ++count;
+    }
+    write_value(out, count);
+    out << entries.str();
+}
+
+template <typename T>
+void write_indices(std::ostream& out, const std::vector<std::shared_ptr<T>>& nodes,
+                   const std::unordered_map<const ngraph::Node*, uint64_t>& node_ids) {
+    write_value<uint32_t>(out, nodes.size());
+    for (const auto& node : nodes) {
+        write_value(out, node_ids.at(node.get()));
+    }
+}
+
+void ngfunction_2_binary(std::ostream& out, std::vector<uint8_t>& bin, const ngraph::Function& f) {
+    write_value<uint32_t>(out, pass::SerializeBinary::Magic);
+    write_value<uint32_t>(out, pass::SerializeBinary::FormatVersion);
+    write_value(out, f.get_friendly_name());
+
+    const auto ordered_ops = f.get_ordered_ops();
+    std::unordered_map<const ngraph::Node*, uint64_t> node_ids;
+    write_value<uint64_t>(out, ordered_ops.size());
+    for (const auto& node : ordered_ops) {
+        NGRAPH_CHECK(!std::dynamic_pointer_cast<op::util::SubGraphOp>(node), "Unsupported sub-graph operation ", node);
+
+        const auto& type_info = node->get_type_info();
+        write_value(out, std::string(type_info.name));
+        write_value(out, type_info.version);
+        write_value(out, node->get_friendly_name());
+
+        write_value<uint32_t>(out, node->get_input_size());
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            write_value(out, node_ids.at(source.get_node()));
+            write_value<uint64_t>(out, source.get_index());
+        }
+
+        BinaryVisitor visitor(out, bin, node.get());
+        NGRAPH_CHECK(node->visit_attributes(visitor), "Visitor API is not supported in ", node);
+        write_value(out, std::string());
+        write_type(out, AttributeType::End);
+
+        write_rt_info(out, *node);
+
+        const uint64_t id = node_ids.size();
+        node_ids[node.get()] = id;
+    }
+
+    write_indices(out, f.get_parameters(), node_ids);
+    write_indices(out, f.get_results(), node_ids);
+    write_indices(out, f.get_sinks(), node_ids);
+}
+
+}  // namespace
+
+bool pass::SerializeBinary::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    std::ostringstream model;
+    std::vector<uint8_t> constants;
+    ngfunction_2_binary(model, constants, *f);
+
+    auto write = [&](std::ostream& model_file, std::ostream& bin_file) {
+        model_file << model.str();
+        bin_file.write(reinterpret_cast<const char*>(constants.data()),
+                       constants.size() * sizeof(constants[0]));
+    };
+
+    if (m_modelFile && m_binFile) {
+        write(*m_modelFile, *m_binFile);
+    } else {
+        std::ofstream model_file(m_modelPath, std::ios::out | std::ios::binary);
+        std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
+        write(model_file, bin_file);
+    }
+
+    // Return false because we didn't change nGraph Function
+    return false;
+}
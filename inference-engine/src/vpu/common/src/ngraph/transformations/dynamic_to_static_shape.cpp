@@ -100,6 +100,14 @@ const Transformations& getDefaultTransformations() {
         {ngraph::opset3::Maximum::type_info,               dynamicToStaticShapeBinaryEltwise},
         {ngraph::opset3::Minimum::type_info,               dynamicToStaticShapeBinaryEltwise},
         {ngraph::opset3::Less::type_info,                  dynamicToStaticShapeBinaryEltwise},
+        {ngraph::opset3::NotEqual::type_info,              dynamicToStaticShapeBinaryEltwise},
+        {ngraph::opset3::GreaterEqual::type_info,          dynamicToStaticShapeBinaryEltwise},
+        {ngraph::opset3::LessEqual::type_info,             dynamicToStaticShapeBinaryEltwise},
+        {ngraph::opset3::SquaredDifference::type_info,     dynamicToStaticShapeBinaryEltwise},
+        {ngraph::opset3::FloorMod::type_info,              dynamicToStaticShapeBinaryEltwise},
+        {ngraph::opset3::LogicalAnd::type_info,            dynamicToStaticShapeBinaryEltwise},
+        {ngraph::opset3::LogicalOr::type_info,             dynamicToStaticShapeBinaryEltwise},
+        {ngraph::opset3::LogicalXor::type_info,            dynamicToStaticShapeBinaryEltwise},
         {ngraph::opset5::NonMaxSuppression::type_info,     dynamicToStaticNonMaxSuppression},
         {ngraph::opset3::NonZero::type_info,               dynamicToStaticShapeNonZero},
         {ngraph::opset3::TopK::type_info,                  dynamicToStaticShapeTopK},
@@ -117,6 +125,13 @@ const Transformations& getDefaultTransformations() {
         {ngraph::opset3::Exp::type_info,                   dynamicToStaticUnaryElementwise},
         {ngraph::opset3::Sqrt::type_info,                  dynamicToStaticUnaryElementwise},
         {ngraph::opset3::LogicalNot::type_info,            dynamicToStaticUnaryElementwise},
+        {ngraph::opset3::Tanh::type_info,                  dynamicToStaticUnaryElementwise},
+        {ngraph::opset3::Erf::type_info,                   dynamicToStaticUnaryElementwise},
+        {ngraph::opset3::Elu::type_info,                   dynamicToStaticUnaryElementwise},
+        {ngraph::opset3::Gelu::type_info,                  dynamicToStaticUnaryElementwise},
+        {ngraph::opset5::Mish::type_info,                  dynamicToStaticUnaryElementwise},
+        {ngraph::opset5::SoftPlus::type_info,              dynamicToStaticUnaryElementwise},
+        {ngraph::opset5::HSwish::type_info,                dynamicToStaticUnaryElementwise},
         {ngraph::opset5::ScatterElementsUpdate::type_info, dynamicToStaticUnaryElementwise},
         {ngraph::opset3::StridedSlice::type_info,          dynamicToStaticShapeStridedSlice},
         {ngraph::opset3::Squeeze::type_info,               dynamicToStaticShapeSqueeze},
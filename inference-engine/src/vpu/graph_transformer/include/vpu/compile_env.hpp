@@ -55,6 +55,24 @@ public:
     static void updateConfig(const CompilationConfig& config);
     static void free();
 
+    //
+    // The environment is thread local. Parallel parts of the passes make
+    // the environment of the compiling thread current for the worker thread
+    // with this scope. Profiler is not thread safe, so such code must not
+    // contain profiler sections.
+    //
+    class WorkerScope final {
+    public:
+        explicit WorkerScope(const CompileEnv& env);
+        ~WorkerScope();
+
+        WorkerScope(const WorkerScope&) = delete;
+        WorkerScope& operator=(const WorkerScope&) = delete;
+
+    private:
+        CompileEnv* _prevEnv = nullptr;
+    };
+
 private:
     explicit CompileEnv(Platform platform);
 };
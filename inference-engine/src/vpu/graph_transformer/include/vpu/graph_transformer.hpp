@@ -45,6 +45,7 @@ struct CompilationConfig final {
     int numCMXSlices = -1;
     int numExecutors = -1;
     int tilingCMXLimitKB = -1;
+    int hwTilingSearchDepth = 1;
 
     bool hwOptimization = true;
     bool hwExtraSplit = false;
@@ -32,6 +32,19 @@ struct UsedMemory final {
 void printTo(std::ostream& os, const UsedMemory& usedMemory);
 void printTo(DotLabel& lbl, const UsedMemory& usedMemory);
 
+//
+// StageCMXUsage
+//
+
+struct StageCMXUsage final {
+    int data = 0;    // bytes occupied by data alive during the stage
+    int extent = 0;  // bytes from the top of CMX to the lowest allocated data, including holes
+    int SHAVEs = 0;
+};
+
+void printTo(std::ostream& os, const StageCMXUsage& usage);
+void printTo(DotLabel& lbl, const StageCMXUsage& usage);
+
 //
 // AllocationResult
 //
@@ -73,6 +86,11 @@ public:
 
     void reset();
 
+    /**
+     * Sets the index of the stage being processed, it is used to track data live ranges
+     */
+    void setCurrentStageIndex(int index) { _curStageIndex = index; }
+
     /**
      * Allocates memory for single data node
      */
@@ -98,6 +116,15 @@ public:
 
     AllocatorForShaves& getAllocatorOfShaves() { return _allocatorOfShaves; }
 
+    /**
+     * Re-assigns DDR offsets of intermediate data packing them over their live ranges.
+     * The new layout is applied only if it reduces BSS size.
+     */
+    bool packDDRByLiveRanges();
+
+    void recordStageCMXUsage(const Stage& stage);
+    const StageMap<StageCMXUsage>& getStagesCMXUsage() const { return _cmxUsagePerStage; }
+
 private:
     allocator::MemChunk* allocateMem(MemoryType memType, int size, int inUse);
     void freeMem(allocator::MemChunk* chunk);
@@ -126,6 +153,12 @@ private:
 
     DataMap<allocator::MemChunk*> _memChunksPerData;
 
+    int _curStageIndex = 0;
+    DataMap<allocator::LiveRange> _liveRanges;
+    bool _hasDataMovedFromCMX = false;
+
+    StageMap<StageCMXUsage> _cmxUsagePerStage;
+
     int _blobMemOffset = 0;
     int _inputMemOffset = 0;
     int _outputMemOffset = 0;
@@ -44,6 +44,18 @@ struct FreeMemory final {
     int size = 0;
 };
 
+//
+// Indexes of the stages where the memory is allocated and released.
+// The memory is in use by both boundary stages.
+//
+
+struct LiveRange final {
+    MemoryType memType = MemoryType::DDR;
+    int size = 0;
+    int begin = 0;
+    int end = -1;
+};
+
 struct MemoryPool final {
     int curMemOffset = 0;
     int memUsed = 0;
@@ -43,6 +43,15 @@ const int CNN_MAX_COEFF_PER_BLOCK = 256;
 
 const int CMX_DATA_BYTE_WIDTH = 16;
 
+//
+// NCE cost model constants (estimates, in NCE clock cycles)
+//
+
+const int NCE_MACS_PER_CYCLE = 256;
+const int NCE_POOL_OPS_PER_CYCLE = 16;
+const int NCE_DESCRIPTOR_OVERHEAD_CYCLES = 128;
+const int NCE_DMA_BYTES_PER_CYCLE = 8;
+
 //
 // Tiling scheme
 //
@@ -99,6 +108,9 @@ struct HwTiling final {
     int sowTiles = 0;
     int socTiles = 0;
 
+    // Estimated NCE cycles for the whole tiling (see estimateHwTileCycles).
+    double estimatedCycles = 0.0;
+
     SmallVector<HwPlaneTilePtr<Tiles>> planeTiles;
 };
 
@@ -108,6 +120,7 @@ void printTo(std::ostream& os, const HwTilingPtr<Tiles>& tiling) {
     os << "sohTiles=" << tiling->sohTiles << std::endl;
     os << "sowTiles=" << tiling->sowTiles << std::endl;
     os << "socTiles=" << tiling->socTiles << std::endl;
+    os << "estimatedCycles=" << tiling->estimatedCycles << std::endl;
     os << "]";
 }
 
@@ -117,6 +130,7 @@ void printTo(DotLabel& lbl, const HwTilingPtr<Tiles>& tiling) {
     subLbl.appendPair("sohTiles", tiling->sohTiles);
     subLbl.appendPair("sowTiles", tiling->sowTiles);
     subLbl.appendPair("socTiles", tiling->socTiles);
+    subLbl.appendPair("estimatedCycles", tiling->estimatedCycles);
 }
 
 template <class Tiles>
@@ -315,4 +329,24 @@ HwConvTileInfo splitHwConvIntoOutChannelsTiles(
         int kernelSizeX, int kernelSizeY,
         int kernelStride);
 
+//
+// NCE cost model.
+//
+
+// Estimates the number of cycles the NCE spends on a single HW stage:
+// DMA of input, weights and output between CMX and DDR plus the compute itself.
+double estimateHwTileCycles(const HwConvChannelTilePtr& channelTile, int kernelSizeX, int kernelSizeY);
+double estimateHwTileCycles(const HwPoolChannelTilePtr& channelTile, int kernelSizeX, int kernelSizeY);
+
+template <class Tiles>
+double estimateHwTilingCycles(const HwTilingPtr<Tiles>& tiling, int kernelSizeX, int kernelSizeY) {
+    double cycles = 0.0;
+    for (const auto& planeTile : tiling->planeTiles) {
+        for (const auto& channelTile : planeTile->channelTiles) {
+            cycles += estimateHwTileCycles(channelTile, kernelSizeX, kernelSizeY);
+        }
+    }
+    return cycles;
+}
+
 }  // namespace vpu
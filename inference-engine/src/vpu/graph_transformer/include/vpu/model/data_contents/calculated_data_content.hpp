@@ -9,6 +9,8 @@
 #include <vpu/utils/small_vector.hpp>
 #include <vpu/model/data_desc.hpp>
 
+#include <mutex>
+
 namespace vpu {
 
 //
@@ -16,6 +18,7 @@ namespace vpu {
 //
 //   * It performs calculation on the first call and stores it in internal buffer.
 //   * Next access will return the pointer to calculated buffer.
+//   * The content can be accessed from several threads, all of them get the same buffer.
 //
 
 class CalculatedDataContent : public DataContent {
@@ -29,6 +32,7 @@ private:
 
 private:
     mutable std::vector<uint8_t> _temp;
+    mutable std::mutex _tempMutex;
 };
 
 } // namespace vpu
@@ -90,7 +90,6 @@ protected:
 private:
     DataDesc _desc;
     DataContent::CPtr _origContent;
-    mutable std::vector<fp16_t> _intermBuf;
     int _KX;
     int _KY;
     int _IC;
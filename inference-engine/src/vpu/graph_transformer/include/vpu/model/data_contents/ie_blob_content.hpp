@@ -8,6 +8,8 @@
 
 #include <vpu/model/data.hpp>
 
+#include <mutex>
+
 namespace vpu {
 
 class IeBlobContent final : public DataContent {
@@ -23,6 +25,7 @@ private:
     DataType _resultDataType;
     mutable ie::Blob::CPtr _blob;
     mutable ie::Blob::CPtr _blobFp16;
+    mutable std::mutex _blobFp16Mutex;
 };
 
 DataContent::Ptr ieBlobContent(const ie::Blob::CPtr& blob, DataType resultPrecision = DataType::FP16);
@@ -9,6 +9,9 @@
 
 #include <ie_blob.h>
 
+#include <mutex>
+#include <vector>
+
 namespace vpu {
 
 class PReLUBlobContent final : public DataContent {
@@ -27,6 +30,7 @@ private:
 
     mutable InferenceEngine::Blob::CPtr _blobFp16;
     mutable std::vector<fp16_t> _tempFp16;
+    mutable std::mutex _tempMutex;
 };
 
 } // namespace vpu
@@ -19,6 +19,12 @@ DECLARE_VPU_CONFIG(MYRIAD_NUMBER_OF_SHAVES);
 DECLARE_VPU_CONFIG(MYRIAD_NUMBER_OF_CMX_SLICES);
 DECLARE_VPU_CONFIG(MYRIAD_TILING_CMX_LIMIT_KB);
 
+/**
+ * @brief Number of the best heuristic HW tiling candidates per stage which are ranked
+ * by the NCE cost model (DMA plus compute cycles). Default = 1 (heuristic choice only).
+ */
+DECLARE_VPU_CONFIG(MYRIAD_HW_TILING_SEARCH_DEPTH);
+
 DECLARE_VPU_CONFIG(MYRIAD_TENSOR_STRIDES);
 
 DECLARE_VPU_CONFIG(MYRIAD_IR_WITH_SCALES_DIRECTORY);
@@ -111,6 +117,19 @@ DECLARE_VPU_CONFIG(MYRIAD_PLUGIN_LOG_FILE_PATH);
 
 DECLARE_VPU_CONFIG(MYRIAD_DEVICE_CONNECT_TIMEOUT);
 
+/**
+ * @brief Number of inference requests which may be queued on a device at once (-1 means twice the number of streams).
+ * Transfer of queued inputs overlaps execution and download of the previous requests.
+ */
+DECLARE_VPU_CONFIG(MYRIAD_PIPELINE_DEPTH);
+
+/**
+ * @brief Allows to allocate the network on an already booted device which runs other networks ("NO" by default).
+ * A new device is booted only if none of the booted ones has a free graph slot, so several small networks
+ * share one device instead of occupying a device each.
+ */
+DECLARE_VPU_CONFIG(MYRIAD_SHARE_DEVICE);
+
 namespace VPUConfigParams {
 
 IE_SUPPRESS_DEPRECATED_START
@@ -12,6 +12,7 @@
 #include <vpu/utils/numeric.hpp>
 
 #include <precision_utils.h>
+#include <ie_parallel.hpp>
 #include <legacy/graph_tools.hpp>
 #include <description_buffer.hpp>
 #include <xml_parse_utils.h>
@@ -112,6 +113,7 @@ ElfN_Ehdr BackEnd::createElfHeader() {
 }
 
 void BackEnd::serializeConstData(const Model& model, const mv_blob_header& blobHdr, std::vector<char>& blob) {
+    std::vector<Data> constDatas;
     for (const auto& data : model->datas()) {
         if (data->usage() != DataUsage::Const) {
             continue;
@@ -122,11 +124,19 @@ void BackEnd::serializeConstData(const Model& model, const mv_blob_header& blobH
         IE_ASSERT(data->numConsumers() != 0);
         IE_ASSERT(data->dataLocation().location == Location::Blob);
 
+        constDatas.push_back(data);
+    }
+
+    // Most of the contents (weights repacking, FP16 conversion) are calculated on the first access,
+    // they are independent and placed to different blob offsets, so it is done in parallel
+    ie::parallel_for(constDatas.size(), [&](size_t i) {
+        const auto& data = constDatas[i];
+
         const auto content = data->content();
         IE_ASSERT(content != nullptr);
 
         std::copy_n(content->get<uint8_t>(), content->byteSize(), blob.data() + blobHdr.const_data_section_offset + data->dataLocation().offset);
-    }
+    });
 }
 
 void BackEnd::serializeConstShapes(const Model& model, const mv_blob_header& blobHdr, std::vector<char>& blob) {
@@ -70,6 +70,14 @@ const CompileEnv* CompileEnv::getOrNull() {
     return g_compileEnv;
 }
 
+CompileEnv::WorkerScope::WorkerScope(const CompileEnv& env) : _prevEnv(g_compileEnv) {
+    g_compileEnv = const_cast<CompileEnv*>(&env);
+}
+
+CompileEnv::WorkerScope::~WorkerScope() {
+    g_compileEnv = _prevEnv;
+}
+
 void CompileEnv::init(Platform platform, const CompilationConfig& config, const Logger::Ptr& log) {
     g_compileEnv = new CompileEnv(platform);
     g_compileEnv->config = config;
@@ -13,6 +13,7 @@
 #include <vpu/model/model.hpp>
 #include <vpu/utils/auto_scope.hpp>
 #include <vpu/utils/numeric.hpp>
+#include <vpu/utils/profiling.hpp>
 
 namespace vpu {
 
@@ -41,6 +42,25 @@ void printTo(DotLabel& lbl, const UsedMemory& usedMemory) {
     subLbl.appendPair("output", usedMemory.output);
 }
 
+//
+// StageCMXUsage
+//
+
+void printTo(std::ostream& os, const StageCMXUsage& usage) {
+    os << "[";
+    os << "data=" << usage.data << ", ";
+    os << "extent=" << usage.extent << ", ";
+    os << "SHAVEs=" << usage.SHAVEs;
+    os << "]";
+}
+
+void printTo(DotLabel& lbl, const StageCMXUsage& usage) {
+    DotLabel subLbl(lbl);
+    subLbl.appendPair("data", usage.data);
+    subLbl.appendPair("extent", usage.extent);
+    subLbl.appendPair("SHAVEs", usage.SHAVEs);
+}
+
 //
 // Allocator
 //
@@ -293,6 +313,12 @@ bool Allocator::allocateData(const Data& data) {
     _memChunksPerData.emplace(data, chunk);
     _allocatedIntermData.emplace(data);
 
+    auto& liveRange = _liveRanges[data];
+    liveRange.memType = chunk->memType;
+    liveRange.size = chunk->size;
+    liveRange.begin = _curStageIndex;
+    liveRange.end = -1;
+
     return chunk->memType == memoryType;
 }
 
@@ -365,6 +391,8 @@ void Allocator::freeData(const Data& data, DeallocationMode mode) {
 
             _memChunksPerData.erase(parent);
             _allocatedIntermData.erase(parent);
+
+            _liveRanges[parent].end = _curStageIndex;
         }
     };
 
@@ -417,6 +445,7 @@ void Allocator::freeData(const Data& data, DeallocationMode mode) {
             IE_ASSERT(ddrChunk!= nullptr);
 
             _memChunksPerData[data] = ddrChunk;
+            _hasDataMovedFromCMX = true;
 
             data->setDataAllocationInfo({Location::BSS, ddrChunk->pointer});
             updateChildDataAllocation(data, DDR_MAX_SIZE);
@@ -678,6 +707,115 @@ void Allocator::reset() {
     _allocatedIntermData.clear();
 
     _memChunksPerData.clear();
+
+    _curStageIndex = 0;
+    _liveRanges.clear();
+    _hasDataMovedFromCMX = false;
+
+    _cmxUsagePerStage.clear();
+}
+
+bool Allocator::packDDRByLiveRanges() {
+    VPU_PROFILE(packDDRByLiveRanges);
+
+    //
+    // Data moved from CMX live in DDR only for the tail of their range,
+    // keep the allocation made on the fly in this case.
+    //
+
+    if (_hasDataMovedFromCMX) {
+        return false;
+    }
+
+    struct Placement final {
+        Data data;
+        const allocator::LiveRange* range;
+        int offset;
+    };
+
+    std::vector<Placement> placements;
+    placements.reserve(_liveRanges.size());
+
+    for (const auto& p : _liveRanges) {
+        const auto& range = p.second;
+
+        if (range.memType != MemoryType::DDR) {
+            continue;
+        }
+        if (range.end < range.begin) {
+            // the data was not released, the live range is unknown
+            return false;
+        }
+
+        placements.push_back({p.first, &range, 0});
+    }
+
+    //
+    // Greedy packing of the interval graph: the largest data are placed first,
+    // each one at the lowest offset which doesn't intersect data alive at the same time.
+    //
+
+    std::sort(placements.begin(), placements.end(), [](const Placement& lhs, const Placement& rhs) {
+        if (lhs.range->size != rhs.range->size) {
+            return lhs.range->size > rhs.range->size;
+        }
+        if (lhs.range->begin != rhs.range->begin) {
+            return lhs.range->begin < rhs.range->begin;
+        }
+        return lhs.data->name() < rhs.data->name();
+    });
+
+    int packedSize = 0;
+    std::vector<const Placement*> conflicts;
+
+    for (auto it = placements.begin(); it != placements.end(); ++it) {
+        conflicts.clear();
+        for (auto prev = placements.begin(); prev != it; ++prev) {
+            if (prev->range->begin <= it->range->end && it->range->begin <= prev->range->end) {
+                conflicts.push_back(&*prev);
+            }
+        }
+
+        std::sort(conflicts.begin(), conflicts.end(), [](const Placement* lhs, const Placement* rhs) {
+            return lhs->offset < rhs->offset;
+        });
+
+        int offset = 0;
+        for (const auto& conflict : conflicts) {
+            if (offset + it->range->size <= conflict->offset) {
+                break;
+            }
+            offset = std::max(offset, conflict->offset + conflict->range->size);
+        }
+
+        it->offset = offset;
+        packedSize = std::max(packedSize, offset + it->range->size);
+    }
+
+    if (packedSize >= _ddrMemoryPool.memUsed) {
+        return false;
+    }
+
+    for (const auto& placement : placements) {
+        placement.data->setDataAllocationInfo({Location::BSS, placement.offset});
+        updateChildDataAllocation(placement.data, DDR_MAX_SIZE);
+    }
+
+    _ddrMemoryPool.memUsed = packedSize;
+
+    return true;
+}
+
+void Allocator::recordStageCMXUsage(const Stage& stage) {
+    StageCMXUsage usage;
+
+    for (const auto& chunk : _cmxMemoryPool.allocatedChunks) {
+        usage.data += chunk.size;
+    }
+    usage.extent = _cmxMemoryPool.curMemOffset;
+    usage.SHAVEs = stage->numSHAVEs();
+
+    _cmxUsagePerStage[stage] = usage;
 }
 
 AllocationResult Allocator::preprocess(const Model& model) {
@@ -276,7 +276,25 @@ bool HWConvolutionTiler::tileForHW() {
         }
     }
 
-    return !_hwTilings.empty();
+    if (_hwTilings.empty()) {
+        return false;
+    }
+
+    //
+    // Heuristic search gives few candidates, choose the cheapest one according to the NCE cost model.
+    // The order of the search results breaks the ties.
+    //
+
+    for (const auto& hwTiling : _hwTilings) {
+        hwTiling->estimatedCycles = estimateHwTilingCycles(
+            hwTiling, _convolutionOptions._kernelSizeX, _convolutionOptions._kernelSizeY);
+    }
+
+    const auto best = std::min_element(_hwTilings.begin(), _hwTilings.end(),
+        [](const HwConvTilingPtr& lhs, const HwConvTilingPtr& rhs) { return lhs->estimatedCycles < rhs->estimatedCycles; });
+    _hwTilings = {*best};
+
+    return true;
 }
 
 bool GraphDataTiling::ceilNeeded() const {
@@ -474,6 +474,8 @@ void HWConvStageTiler::createHWStageForTile(const Data& hwInputTile,
     hwStage->attrs().set<HwPaddingInfo>("pad", hwPad);
 
     hwStage->attrs().set<HwConvTileInfo>("tiling", channelTile->finalTiles);
+    hwStage->attrs().set<double>("estimatedCycles",
+        estimateHwTileCycles(channelTile, stageOptions.kernelSizeX, stageOptions.kernelSizeY));
 
     if (tiling->socTiles > 1) {
         hwStage->attrs().set<bool>("withReLU", false);
@@ -267,7 +267,25 @@ bool HWPoolingTiler::tileForHW() {
         }
     }
 
-    return _hwTilings.size() != 0;
+    if (_hwTilings.empty()) {
+        return false;
+    }
+
+    //
+    // Heuristic search gives few candidates, choose the cheapest one according to the NCE cost model.
+    // The order of the search results breaks the ties.
+    //
+
+    for (const auto& hwTiling : _hwTilings) {
+        hwTiling->estimatedCycles = estimateHwTilingCycles(
+            hwTiling, _convolutionOptions._kernelSizeX, _convolutionOptions._kernelSizeY);
+    }
+
+    const auto best = std::min_element(_hwTilings.begin(), _hwTilings.end(),
+        [](const HwPoolTilingPtr& lhs, const HwPoolTilingPtr& rhs) { return lhs->estimatedCycles < rhs->estimatedCycles; });
+    _hwTilings = {*best};
+
+    return true;
 }
 
 std::unique_ptr<GraphDataTiling> PoolGraphDataTilingFactory::makeDirTiling(const ConvolutionOptions& convolutionOptions,
@@ -179,6 +179,8 @@ void HWPoolStageTiler::createHWStageForTile(const Data& hwInputTile,
     hwStage->attrs().set("pad", getPoolPadding(planeTile, hwInput->desc().dims(), stageOptions));
 
     hwStage->attrs().set<HwPoolTileInfo>("tiling", channelTile->finalTiles);
+    hwStage->attrs().set<double>("estimatedCycles",
+        estimateHwTileCycles(channelTile, stageOptions.kernelSizeX, stageOptions.kernelSizeY));
 
     hwStage->attrs().set<bool>("withReLU", stageOptions.withReLU);
 }
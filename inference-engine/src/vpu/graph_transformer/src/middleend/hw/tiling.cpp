@@ -575,4 +575,62 @@ HwConvTileInfo splitHwConvIntoOutChannelsTiles(
     return tileInfo;
 }
 
+//
+// NCE cost model.
+//
+
+namespace {
+
+template <class Tiles>
+HwPlaneTilePtr<Tiles> parentPlaneTile(const HwChannelTilePtr<Tiles>& channelTile) {
+    auto planeTile = channelTile->parent.lock();
+    IE_ASSERT(planeTile != nullptr);
+    return planeTile;
+}
+
+double dmaCycles(double bytes) {
+    return bytes / NCE_DMA_BYTES_PER_CYCLE;
+}
+
+}  // namespace
+
+double estimateHwTileCycles(const HwConvChannelTilePtr& channelTile, int kernelSizeX, int kernelSizeY) {
+    const auto planeTile = parentPlaneTile(channelTile);
+    const auto& tileInfo = channelTile->finalTiles;
+
+    const double inputPlane = static_cast<double>(planeTile->widthInfo.inputWithJunk) * planeTile->heightInfo.inputWithJunk;
+    const double outputPlane = static_cast<double>(planeTile->widthInfo.outputWithJunk) * planeTile->heightInfo.outputWithJunk;
+    const double kernelSize = static_cast<double>(kernelSizeX) * kernelSizeY;
+
+    // Input tile is re-read by every descriptor, weights and output are transferred once.
+    // Partial sums of SoC tiles (all but the first one) are read back for accumulation.
+    double bytes = 0.0;
+    bytes += tileInfo.numDescr * inputPlane * tileInfo.extendedInputDimC;
+    bytes += kernelSize * tileInfo.extendedInputDimC * tileInfo.extendedOutputDimC;
+    bytes += outputPlane * tileInfo.extendedOutputDimC * (channelTile->socInd > 0 ? 2 : 1);
+    bytes *= sizeof(fp16_t);
+
+    const auto compute =
+        outputPlane * kernelSize * tileInfo.extendedInputDimC * tileInfo.extendedOutputDimC / NCE_MACS_PER_CYCLE;
+    const auto overhead =
+        tileInfo.numDescr * (NCE_DESCRIPTOR_OVERHEAD_CYCLES + CNN_MODES_COST[static_cast<int>(tileInfo.mode)]);
+
+    return dmaCycles(bytes) + compute + overhead;
+}
+
+double estimateHwTileCycles(const HwPoolChannelTilePtr& channelTile, int kernelSizeX, int kernelSizeY) {
+    const auto planeTile = parentPlaneTile(channelTile);
+    const auto& tileInfo = channelTile->finalTiles;
+
+    const double inputPlane = static_cast<double>(planeTile->widthInfo.inputWithJunk) * planeTile->heightInfo.inputWithJunk;
+    const double outputPlane = static_cast<double>(planeTile->widthInfo.outputWithJunk) * planeTile->heightInfo.outputWithJunk;
+    const double numChannels = static_cast<double>(tileInfo.numDescr) * tileInfo.chansPerDescr;
+
+    const auto bytes = (inputPlane + outputPlane) * numChannels * sizeof(fp16_t);
+    const auto compute = outputPlane * kernelSizeX * kernelSizeY * numChannels / NCE_POOL_OPS_PER_CYCLE;
+    const auto overhead = tileInfo.numDescr * NCE_DESCRIPTOR_OVERHEAD_CYCLES;
+
+    return dmaCycles(bytes) + compute + overhead;
+}
+
 }  // namespace vpu
@@ -5,6 +5,7 @@
 #include <vpu/middleend/pass_manager.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <queue>
 #include <set>
 #include <memory>
@@ -18,6 +19,66 @@ namespace vpu {
 
 namespace {
 
+//
+// Selects CMX Datas to be moved to DDR so that at least requiredSize bytes are released.
+// Datas with the farthest next use are taken first, since they occupy CMX for the longest time without being accessed.
+//
+
+DataVector selectDatasToSpill(const DataVector& cmxDatas, int failedStageInd, int requiredSize) {
+    struct Candidate final {
+        Data data;
+        int nextUse;
+    };
+
+    std::vector<Candidate> candidates;
+    candidates.reserve(cmxDatas.size());
+
+    for (const auto& cmxData : cmxDatas) {
+        bool hasConsumersInCMX = false;
+        int nextUse = std::numeric_limits<int>::max();
+
+        for (const auto& consumerEdge : cmxData->consumerEdges()) {
+            const auto& consumer = consumerEdge->consumer();
+            if (consumer->attrs().getOrDefault<bool>("CMX-to-DDR", false)) {
+                continue;
+            }
+
+            hasConsumersInCMX = true;
+            if (consumer->index() >= failedStageInd) {
+                nextUse = std::min(nextUse, consumer->index());
+            }
+        }
+
+        if (hasConsumersInCMX) {
+            candidates.push_back({cmxData, nextUse});
+        }
+    }
+
+    if (candidates.empty()) {
+        return cmxDatas;
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs) {
+        if (lhs.nextUse != rhs.nextUse) {
+            return lhs.nextUse > rhs.nextUse;
+        }
+        return calcAllocationSize(lhs.data) > calcAllocationSize(rhs.data);
+    });
+
+    DataVector datasToSpill;
+    int releasedSize = 0;
+    for (const auto& candidate : candidates) {
+        if (releasedSize >= requiredSize) {
+            break;
+        }
+
+        datasToSpill.push_back(candidate.data);
+        releasedSize += calcAllocationSize(candidate.data);
+    }
+
+    return datasToSpill;
+}
+
 class PassImpl final : public Pass {
 public:
     explicit PassImpl(const StageBuilder::Ptr& stageBuilder) : _stageBuilder(stageBuilder) {}
@@ -205,7 +266,7 @@ void PassImpl::adjustModelForMemReqs(const Model& model) {
 
     auto& allocator = model->getAllocator();
 
-    StageSet allFailedStages;
+    StageMap<int> numFailuresPerStage;
 
     for (;;) {
         auto allocRes = runAllocator(model);
@@ -221,10 +282,15 @@ void PassImpl::adjustModelForMemReqs(const Model& model) {
         env.log->trace("Stage # %d [%s] failed to allocate : %s", failedStageInd, failedStage->name(), allocRes.status);
         VPU_LOGGER_SECTION(env.log);
 
-        VPU_INTERNAL_CHECK(allFailedStages.count(failedStage) == 0,
+        //
+        // At first only the part of CMX which is required by the failed Data is flushed,
+        // if it doesn't help (e.g. due to fragmentation) all Datas allocated in CMX are flushed.
+        //
+
+        const auto numFailures = ++numFailuresPerStage[failedStage];
+        VPU_INTERNAL_CHECK(numFailures <= 2,
             "Memory allocation failed: unable to satisfy requirements for stage %v with type %v",
             failedStage->name(), failedStage->type());
-        allFailedStages.emplace(failedStage);
 
         //
         // Try to flush Data allocated in CMX
@@ -239,6 +305,11 @@ void PassImpl::adjustModelForMemReqs(const Model& model) {
         auto allCmxDatas = allocator.getAllocatedDatas(MemoryType::CMX);
         env.log->trace("Got %d datas in CMX : %v", allCmxDatas.size(), allCmxDatas);
 
+        if (failedData != nullptr && numFailures == 1) {
+            allCmxDatas = selectDatasToSpill(allCmxDatas, failedStageInd, calcAllocationSize(failedData));
+            env.log->trace("Spill %d datas with the farthest next use : %v", allCmxDatas.size(), allCmxDatas);
+        }
+
         if (allCmxDatas.empty()) {
             if (allocRes.status == AllocationStatus::SHAVES_FAILED) {
                 VPU_THROW_FORMAT("Can't allocate SHAVEs for Stage node %v", failedStage->name());
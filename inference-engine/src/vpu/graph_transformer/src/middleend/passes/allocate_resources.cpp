@@ -51,7 +51,10 @@ AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableSh
     // Allocate resources per stage.
     //
 
+    int stageIndex = 0;
     for (const auto& stage : model->getStages()) {
+        allocator.setCurrentStageIndex(stageIndex++);
+
         //
         // Release SHAVEs in any case at the end of iteration.
         //
@@ -152,6 +155,8 @@ AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableSh
             }
         }
 
+        allocator.recordStageCMXUsage(stage);
+
         //
         // Release stage inputs.
         //
@@ -184,6 +189,8 @@ AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableSh
         }
     }
 
+    allocator.setCurrentStageIndex(stageIndex);
+
     //
     // Clean up undeallocated shapes
     //
@@ -201,6 +208,14 @@ AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableSh
         }
     }
 
+    //
+    // The final allocation: live ranges of all datas are known now, so DDR can be packed tighter
+    //
+
+    if (enableShapeAllocation == EnableShapeAllocation::YES && checkOnlyCmx == CheckOnlyCMX::NO) {
+        allocator.packDDRByLiveRanges();
+    }
+
     //
     // Allocate shape for all datas
     //
@@ -243,6 +258,8 @@ public:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(allocateResources);
 
+    const auto& env = CompileEnv::get();
+
     auto& allocator = model->getAllocator();
 
     //
@@ -263,6 +280,25 @@ void PassImpl::run(const Model& model) {
     //
 
     model->attrs().set<UsedMemory>("usedMemory", allocator.usedMemoryAmount());
+
+    //
+    // CMX usage per stage, it is shown in the internal graph dump
+    //
+
+    env.log->debug("CMX usage per stage:");
+    VPU_LOGGER_SECTION(env.log);
+
+    const auto& cmxUsagePerStage = allocator.getStagesCMXUsage();
+    for (const auto& stage : model->getStages()) {
+        const auto usage = cmxUsagePerStage.find(stage);
+        if (usage == cmxUsagePerStage.end()) {
+            continue;
+        }
+
+        stage->attrs().set<StageCMXUsage>("cmxUsage", usage->second);
+
+        env.log->debug("Stage # %d [%s] : %v", stage->index(), stage->name(), usage->second);
+    }
 }
 
 }  // namespace
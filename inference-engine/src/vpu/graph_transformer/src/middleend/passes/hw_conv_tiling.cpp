@@ -8,6 +8,9 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
+
+#include <ie_parallel.hpp>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -31,9 +34,69 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+HWTilingNS::HWConvolutionTiler findTiling(const Stage& origStage) {
+    const auto& env = CompileEnv::get();
+
+    const HWConvStageOptions stageOptions(origStage);
+    const HWConvStageIO stageIO(origStage, origStage->output(0));
+
+    //
+    // Unsupported paddings
+    //
+
+    //
+    // Try to find "best" tiling
+    //
+
+    const auto tilingsCount = static_cast<std::size_t>(env.config.hwTilingSearchDepth);
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        stageIO.origOutput->desc().dims(),
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        stageOptions.withPool
+    };
+
+    const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
+
+    if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
+        const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
+            origStage->name(),
+            stageIO.origInput->desc().dims(),
+            stageIO.origOutputDesc.dims(),
+            stageIO.origOutputDesc.dims(),
+            stageOptions.kernelSizeX,
+            stageOptions.kernelSizeY,
+            stageOptions.kernelStride,
+            stageOptions.padLeft,
+            stageOptions.padRight,
+            stageOptions.padTop,
+            stageOptions.padBottom,
+            false
+        };
+
+        return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
+    }
+
+    return tiler1stAttempt;
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const auto& env = CompileEnv::get();
+
+    std::vector<Stage> hwStages;
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -44,61 +107,25 @@ void PassImpl::run(const Model& model) {
             continue;
         }
 
-        const HWConvStageOptions stageOptions(origStage);
-        const HWConvStageIO stageIO(origStage, origStage->output(0));
-
-        //
-        // Unsupported paddings
-        //
+        hwStages.push_back(origStage);
+    }
 
-        //
-        // Try to find "best" tiling
-        //
+    //
+    // Tiling search doesn't modify the model, so it is done for all stages in parallel
+    //
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+    std::vector<std::unique_ptr<HWTilingNS::HWConvolutionTiler>> tilers(hwStages.size());
+    ie::parallel_for(hwStages.size(), [&](size_t i) {
+        CompileEnv::WorkerScope envScope(env);
+        tilers[i].reset(new HWTilingNS::HWConvolutionTiler(findTiling(hwStages[i])));
+    });
 
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
+    for (size_t stageInd = 0; stageInd < hwStages.size(); ++stageInd) {
+        const auto& origStage = hwStages[stageInd];
+        const auto& tiler = *tilers[stageInd];
 
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
-            }
-        }();
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
@@ -32,6 +32,8 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwPoolTiling);
 
+    const auto& env = CompileEnv::get();
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubMaxPool &&
             origStage->type() != StageType::StubAvgPool) {
@@ -50,7 +52,7 @@ void PassImpl::run(const Model& model) {
         // Try to find "best" tiling
         //
 
-        const size_t tilingsCount = 1;
+        const auto tilingsCount = static_cast<std::size_t>(env.config.hwTilingSearchDepth);
         const HWTilingNS::Direction direction =
                 HWTilingNS::Direction::INPUT_TO_OUTPUT;
         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
@@ -10,6 +10,7 @@
 #include <vpu/model/data_contents/scaled_content.hpp>
 
 #include <precision_utils.h>
+#include <ie_parallel.hpp>
 
 #include <cmath>
 
@@ -214,30 +215,53 @@ void PassImpl::run(const Model& model) {
     int  normalVal  = 0;
     const auto& env = CompileEnv::get();
 
+    std::vector<Stage> scalableStages;
+    std::vector<float> irScales;
     for (const auto& stage : model->getStages()) {
         if (!isScalable(stage)) {
             continue;
         }
         IE_ASSERT(stage->origLayer() != nullptr);
 
-        // Get scale from IR, compute if it was absent
-        auto scale = stage->origLayer()->GetParamAsFloat("vpu_scale", 0);
-        if (!scale) {
-            auto weights = stage->input(1);
+        scalableStages.push_back(stage);
+        irScales.push_back(stage->origLayer()->GetParamAsFloat("vpu_scale", 0));
+    }
+
+    //
+    // Weights exponents statistics don't depend on other stages, they are collected in parallel
+    //
+
+    std::vector<int> maxExps(scalableStages.size());
+    std::vector<int> meanExps(scalableStages.size());
+    ie::parallel_for(scalableStages.size(), [&](size_t i) {
+        if (irScales[i]) {
+            return;
+        }
 
-            auto content = weights->content();
-            IE_ASSERT(content != nullptr);
+        auto weights = scalableStages[i]->input(1);
 
-            auto weightsVals = content->get<fp16_t>();
-            IE_ASSERT(weightsVals != nullptr);
+        auto content = weights->content();
+        IE_ASSERT(content != nullptr);
 
-            auto exponents = calculateExponents(weightsVals, weights->desc().totalDimSize());
+        auto weightsVals = content->get<fp16_t>();
+        IE_ASSERT(weightsVals != nullptr);
 
-            int maxExp = *std::max_element(exponents.begin(), exponents.end());
-            int shift = largestExp - maxExp;
+        auto exponents = calculateExponents(weightsVals, weights->desc().totalDimSize());
+
+        maxExps[i] = *std::max_element(exponents.begin(), exponents.end());
+        meanExps[i] = getMeanValue(exponents);
+    });
+
+    for (size_t i = 0; i < scalableStages.size(); ++i) {
+        const auto& stage = scalableStages[i];
+
+        // Get scale from IR, compute if it was absent
+        auto scale = irScales[i];
+        if (!scale) {
+            auto weights = stage->input(1);
 
-            auto meanExp = getMeanValue(exponents);
-            shift = std::min(-meanExp, shift);
+            int shift = largestExp - maxExps[i];
+            shift = std::min(-meanExps[i], shift);
 
             {
                 if (firstStage && shift < 4 && isGrowingOutput && weights->desc().dim(Dim::C) > 1) {
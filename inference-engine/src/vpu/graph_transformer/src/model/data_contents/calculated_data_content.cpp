@@ -4,12 +4,27 @@
 
 #include <vpu/model/data_contents/calculated_data_content.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace vpu {
 
 const void* CalculatedDataContent::getRaw() const {
+    {
+        std::lock_guard<std::mutex> lock(_tempMutex);
+        if (!_temp.empty()) {
+            return _temp.data();
+        }
+    }
+
+    // The lock is not held during the calculation: it may run parallel loops and
+    // a thread waiting for them can pick up another access to this content
+    std::vector<uint8_t> temp(byteSize());
+    fillTempBuf(temp.data());
+
+    std::lock_guard<std::mutex> lock(_tempMutex);
     if (_temp.empty()) {
-        _temp.resize(byteSize());
-        fillTempBuf(_temp.data());
+        _temp = std::move(temp);
     }
     return _temp.data();
 }
@@ -6,6 +6,8 @@
 
 #include <vpu/utils/ie_helpers.hpp>
 
+#include <utility>
+
 namespace vpu {
 
 IeBlobContent::IeBlobContent(const ie::Blob::CPtr& blob, DataType resultDataType) : _blob(blob), _resultDataType(resultDataType) {
@@ -22,9 +24,20 @@ size_t IeBlobContent::byteSize() const {
 
 const void* IeBlobContent::getRaw() const {
     if (_resultDataType == DataType::FP16) {
-        if (_blobFp16 == nullptr) {
-            _blobFp16 = _blob->getTensorDesc().getPrecision() == ie::Precision::FP16 ?
+        {
+            std::lock_guard<std::mutex> lock(_blobFp16Mutex);
+            if (_blobFp16 != nullptr) {
+                return _blobFp16->cbuffer();
+            }
+        }
+
+        // converted without holding the lock, see CalculatedDataContent::getRaw
+        auto blobFp16 = _blob->getTensorDesc().getPrecision() == ie::Precision::FP16 ?
                         _blob : convertBlobFP32toFP16(_blob);
+
+        std::lock_guard<std::mutex> lock(_blobFp16Mutex);
+        if (_blobFp16 == nullptr) {
+            _blobFp16 = std::move(blobFp16);
         }
         return _blobFp16->cbuffer();
     } else { // S32
@@ -9,6 +9,9 @@
 
 #include <ie_parallel.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace vpu {
 
 PReLUBlobContent::PReLUBlobContent(const ie::Blob::CPtr& blob, const DataDesc& desc, int repeat) :
@@ -23,33 +26,51 @@ size_t PReLUBlobContent::byteSize() const {
 }
 
 const void* PReLUBlobContent::getRaw() const {
-    if (_blobFp16 == nullptr) {
-        _blobFp16 = _blob->getTensorDesc().getPrecision() == ie::Precision::FP16 ?
-                    _blob : convertBlobFP32toFP16(_blob);
+    // The buffers are calculated without holding the lock, see CalculatedDataContent::getRaw
+    ie::Blob::CPtr blobFp16;
+    {
+        std::lock_guard<std::mutex> lock(_tempMutex);
+        if (_repeat != 1 && !_tempFp16.empty()) {
+            return _tempFp16.data();
+        }
+        blobFp16 = _blobFp16;
+    }
+
+    if (blobFp16 == nullptr) {
+        blobFp16 = _blob->getTensorDesc().getPrecision() == ie::Precision::FP16 ?
+                   _blob : convertBlobFP32toFP16(_blob);
+
+        std::lock_guard<std::mutex> lock(_tempMutex);
+        if (_blobFp16 == nullptr) {
+            _blobFp16 = blobFp16;
+        }
+        blobFp16 = _blobFp16;
     }
 
     if (_repeat == 1) {
-        return _blobFp16->cbuffer();
+        return blobFp16->cbuffer();
     }
 
-    if (_tempFp16.empty()) {
-        VPU_PROFILE(PReLUBlobContent);
+    VPU_PROFILE(PReLUBlobContent);
 
-        IE_ASSERT(_desc.totalDimSize() % _repeat == 0);
+    IE_ASSERT(_desc.totalDimSize() % _repeat == 0);
 
-        auto origNumElems = _desc.totalDimSize() / _repeat;
-        IE_ASSERT(checked_cast<size_t>(origNumElems) <= _blobFp16->size());
+    auto origNumElems = _desc.totalDimSize() / _repeat;
+    IE_ASSERT(checked_cast<size_t>(origNumElems) <= blobFp16->size());
 
-        auto origPtr = _blobFp16->cbuffer().as<const fp16_t*>();
-        IE_ASSERT(origPtr != nullptr);
+    auto origPtr = blobFp16->cbuffer().as<const fp16_t*>();
+    IE_ASSERT(origPtr != nullptr);
 
-        _tempFp16.resize(checked_cast<size_t>(_desc.totalDimSize()));
+    std::vector<fp16_t> tempFp16(checked_cast<size_t>(_desc.totalDimSize()));
 
-        ie::parallel_for(_repeat, [this, origPtr, origNumElems](int i) {
-            std::copy_n(origPtr, origNumElems, _tempFp16.data() + i * origNumElems);
-        });
-    }
+    ie::parallel_for(_repeat, [&tempFp16, origPtr, origNumElems](int i) {
+        std::copy_n(origPtr, origNumElems, tempFp16.data() + i * origNumElems);
+    });
 
+    std::lock_guard<std::mutex> lock(_tempMutex);
+    if (_tempFp16.empty()) {
+        _tempFp16 = std::move(tempFp16);
+    }
     return _tempFp16.data();
 }
 
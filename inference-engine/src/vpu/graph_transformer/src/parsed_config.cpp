@@ -49,6 +49,7 @@ IE_SUPPRESS_DEPRECATED_START
         ie::MYRIAD_NUMBER_OF_SHAVES,
         ie::MYRIAD_NUMBER_OF_CMX_SLICES,
         ie::MYRIAD_TILING_CMX_LIMIT_KB,
+        ie::MYRIAD_HW_TILING_SEARCH_DEPTH,
 
         ie::MYRIAD_TENSOR_STRIDES,
 
@@ -221,6 +222,14 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     setOption(_compileConfig.numExecutors,     config, ie::MYRIAD_THROUGHPUT_STREAMS, preprocessCompileOption);
     setOption(_compileConfig.tilingCMXLimitKB, config, ie::MYRIAD_TILING_CMX_LIMIT_KB, preprocessCompileOption);
 
+    setOption(_compileConfig.hwTilingSearchDepth, config, ie::MYRIAD_HW_TILING_SEARCH_DEPTH, [](const std::string& src) {
+        const auto value = parseInt(src);
+        if (value <= 0) {
+            throw std::invalid_argument("Value must be positive.");
+        }
+        return value;
+    });
+
     if ((_compileConfig.numSHAVEs < 0 && _compileConfig.numCMXSlices >= 0) ||
         (_compileConfig.numSHAVEs >= 0 && _compileConfig.numCMXSlices < 0)) {
         THROW_IE_EXCEPTION << "You should set both option for resource management: VPU_NUMBER_OF_CMX_SLICES and VPU_NUMBER_OF_SHAVES";
@@ -31,6 +31,7 @@ const std::unordered_set<std::string>& MyriadConfig::getRunTimeOptions() const {
 IE_SUPPRESS_DEPRECATED_START
     static const std::unordered_set<std::string> options = merge(ParsedConfig::getRunTimeOptions(), {
         CONFIG_KEY(DEVICE_ID),
+        CONFIG_KEY(CACHE_DIR),
 
         ie::MYRIAD_ENABLE_FORCE_RESET,
 
@@ -41,6 +42,8 @@ IE_SUPPRESS_DEPRECATED_START
 
         ie::MYRIAD_PLUGIN_LOG_FILE_PATH,
         ie::MYRIAD_DEVICE_CONNECT_TIMEOUT,
+        ie::MYRIAD_PIPELINE_DEPTH,
+        ie::MYRIAD_SHARE_DEVICE,
 
         ie::MYRIAD_DDR_TYPE,
 
@@ -118,6 +121,16 @@ IE_SUPPRESS_DEPRECATED_END
         { ie::MYRIAD_DDR_MICRON_1GB,   MovidiusDdrType::MICRON_1GB }
     };
 
+    const auto parsePipelineDepth = [](const std::string& src) {
+        const auto value = parseInt(src);
+
+        if (value > 0 || value == -1) {
+            return value;
+        }
+
+        throw std::invalid_argument("Value must be positive or default(-1).");
+    };
+
     ParsedConfig::parse(config);
 
     setOption(_pluginLogFilePath,                       config, ie::MYRIAD_PLUGIN_LOG_FILE_PATH);
@@ -128,6 +141,8 @@ IE_SUPPRESS_DEPRECATED_END
     setOption(_deviceConnectTimeout,                    config, ie::MYRIAD_DEVICE_CONNECT_TIMEOUT, parseSeconds);
     setOption(_powerConfig,      powerConfigs,          config, ie::MYRIAD_POWER_MANAGEMENT);
     setOption(_memoryType,       memoryTypes,           config, ie::MYRIAD_DDR_TYPE);
+    setOption(_pipelineDepth,                           config, ie::MYRIAD_PIPELINE_DEPTH, parsePipelineDepth);
+    setOption(_shareDevice,      switches,              config, ie::MYRIAD_SHARE_DEVICE);
 
 IE_SUPPRESS_DEPRECATED_START
     setOption(_forceReset,       switches,              config, VPU_MYRIAD_CONFIG_KEY(FORCE_RESET));
@@ -72,6 +72,14 @@ public:
         return _memoryType;
     }
 
+    int pipelineDepth() const {
+        return _pipelineDepth;
+    }
+
+    bool shareDevice() const {
+        return _shareDevice;
+    }
+
 protected:
     const std::unordered_set<std::string>& getCompileOptions() const override;
     const std::unordered_set<std::string>& getRunTimeOptions() const override;
@@ -88,6 +96,8 @@ private:
     std::chrono::seconds _deviceConnectTimeout = std::chrono::seconds(15);
     std::string _deviceName;
     MovidiusDdrType _memoryType = MovidiusDdrType::AUTO;
+    int _pipelineDepth = -1;
+    bool _shareDevice = false;
 };
 
 }  // namespace MyriadPlugin
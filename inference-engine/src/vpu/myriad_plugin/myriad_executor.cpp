@@ -75,7 +75,8 @@ MyriadExecutor::MyriadExecutor(bool forceReset, std::shared_ptr<IMvnc> mvnc,
  * @brief Boot available device
  */
 ncStatus_t MyriadExecutor::bootNextDevice(std::vector<DevicePtr> &devicePool,
-                                          const MyriadConfig& config) {
+                                          const MyriadConfig& config,
+                                          std::unique_lock<std::mutex>& poolLock) {
     VPU_PROFILE(bootNextDevice);
 // #-17972, #-16790
 #if defined(NO_BOOT)
@@ -89,7 +90,6 @@ ncStatus_t MyriadExecutor::bootNextDevice(std::vector<DevicePtr> &devicePool,
     const ncDeviceProtocol_t& configProtocol = config.protocol();
     const std::string& configDevName = config.deviceName();
     PowerConfig powerConfig = config.powerConfig();
-    int lastDeviceIdx = devicePool.empty() ? -1 : devicePool.back()->_deviceIdx;
 
     ncStatus_t statusOpen = NC_ERROR;
 
@@ -132,6 +132,18 @@ ncStatus_t MyriadExecutor::bootNextDevice(std::vector<DevicePtr> &devicePool,
         configDevName.copy(in_deviceDesc.name, NC_MAX_NAME_SIZE - 1);
     }
 
+    // Firmware loading takes seconds per device and mvnc serializes device selection on its own,
+    // so the pool is unlocked to let other networks boot devices and allocate graphs meanwhile
+    struct PoolRelock {
+        std::unique_lock<std::mutex>& lock;
+        ~PoolRelock() {
+            if (!lock.owns_lock()) {
+                lock.lock();
+            }
+        }
+    } poolRelock{poolLock};
+    poolLock.unlock();
+
     statusOpen = ncSetDeviceConnectTimeout(static_cast<int>(config.deviceConnectTimeout().count()));
     if (statusOpen) {
         return statusOpen;
@@ -207,7 +219,9 @@ ncStatus_t MyriadExecutor::bootNextDevice(std::vector<DevicePtr> &devicePool,
 
     /* TODO: what should we do if we do not know maximum available graphs? What if we got number <= 0? */
     device._graphNum = 1;
-    device._deviceIdx = lastDeviceIdx + 1;
+
+    poolLock.lock();
+    device._deviceIdx = devicePool.empty() ? 0 : devicePool.back()->_deviceIdx + 1;
     devicePool.push_back(std::make_shared<DeviceDesc>(device));
     return NC_OK;
 }
@@ -215,7 +229,7 @@ ncStatus_t MyriadExecutor::bootNextDevice(std::vector<DevicePtr> &devicePool,
 DevicePtr MyriadExecutor::openDevice(std::vector<DevicePtr>& devicePool,
                                      const MyriadConfig& config) {
     VPU_PROFILE(openDevice);
-    std::lock_guard<std::mutex> lock(device_mutex);
+    std::unique_lock<std::mutex> lock(device_mutex);
 
     auto firstBootedButEmptyDevice = std::find_if(devicePool.begin(), devicePool.end(),
         [&config](const DevicePtr &device) {
@@ -223,6 +237,25 @@ DevicePtr MyriadExecutor::openDevice(std::vector<DevicePtr>& devicePool,
                    && device->isSuitableForConfig(config);
         });
 
+    // Sharing: put the network next to the already running ones rather than occupying another device
+    if (config.shareDevice() && config.deviceName().empty()) {
+        auto leastLoadedDevice = devicePool.end();
+        for (auto it = devicePool.begin(); it != devicePool.end(); ++it) {
+            const auto& device = *it;
+            if (device->isBooted() && !device->isEmpty() && device->isNotFull()
+                && device->isSuitableForConfig(config)
+                && (leastLoadedDevice == devicePool.end() || device->_graphNum < (*leastLoadedDevice)->_graphNum)) {
+                leastLoadedDevice = it;
+            }
+        }
+
+        if (leastLoadedDevice != devicePool.end()) {
+            auto &device = *leastLoadedDevice;
+            device->_graphNum++;
+            return device;
+        }
+    }
+
     if (firstBootedButEmptyDevice != devicePool.end()) {
         auto &device = *firstBootedButEmptyDevice;
         device->_graphNum = 1;
@@ -246,7 +279,7 @@ DevicePtr MyriadExecutor::openDevice(std::vector<DevicePtr>& devicePool,
         }
     }
 
-    ncStatus_t booted = bootNextDevice(devicePool, config);
+    ncStatus_t booted = bootNextDevice(devicePool, config, lock);
 
     // TODO Is any tests for this case? #-19309
     // In case, then there is no another not booted device, use already booted with minimum number of executors
@@ -306,7 +339,8 @@ void MyriadExecutor::closeDevices(std::vector<DevicePtr> &devicePool, std::share
 void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
                                    const std::vector<char> &graphFileContent,
                                    const std::pair<const char*, size_t> &graphHeaderDesc,
-                                   size_t numStages, const std::string & networkName, int executors) {
+                                   size_t numStages, const std::string & networkName, int executors,
+                                   int pipelineDepth) {
     VPU_PROFILE(allocateGraph);
     _numStages = static_cast<int>(numStages);
     graphDesc._name = networkName;
@@ -369,7 +403,11 @@ void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
         THROW_IE_EXCEPTION << "Failed to get output description: " << ncStatusToStr(graphDesc._graphHandle, status);
     }
 
-    unsigned int fifo_elements = (device->_platform == NC_MYRIAD_2 && executors == 1) ? 4 : 2 * executors;
+    // Every FIFO element holds one queued request: while the device executes one of them,
+    // inputs of the next requests are uploaded and outputs of the finished ones are downloaded
+    const int defaultPipelineDepth = (device->_platform == NC_MYRIAD_2 && executors == 1) ? 4 : 2 * executors;
+    graphDesc._pipelineDepth = pipelineDepth > 0 ? pipelineDepth : defaultPipelineDepth;
+    unsigned int fifo_elements = static_cast<unsigned int>(graphDesc._pipelineDepth);
 
     status = ncFifoCreate("input", NC_FIFO_HOST_WO, &graphDesc._inputFifoHandle);
     if (status != NC_OK) {
@@ -377,6 +415,24 @@ void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
     }
 
     status = ncFifoAllocate(graphDesc._inputFifoHandle, device->_deviceHandle, &graphDesc._inputDesc, fifo_elements);
+    if (status != NC_OK && pipelineDepth <= 0 && fifo_elements > static_cast<unsigned int>(executors)) {
+        // The device memory is shared by all the graphs loaded to the device, so the default depth
+        // may not fit next to them: fall back to a single queued request per executor
+        _log->warning("Failed to allocate input FIFO of %u elements: %s, retrying with %d elements",
+                      fifo_elements, ncStatusToStr(graphDesc._graphHandle, status), executors);
+        ncFifoDestroy(&graphDesc._inputFifoHandle);
+        graphDesc._inputFifoHandle = nullptr;
+
+        graphDesc._pipelineDepth = executors;
+        fifo_elements = static_cast<unsigned int>(executors);
+
+        status = ncFifoCreate("input", NC_FIFO_HOST_WO, &graphDesc._inputFifoHandle);
+        if (status != NC_OK) {
+            THROW_IE_EXCEPTION << "Failed to init input FIFO: " << ncStatusToStr(graphDesc._graphHandle, status);
+        }
+
+        status = ncFifoAllocate(graphDesc._inputFifoHandle, device->_deviceHandle, &graphDesc._inputDesc, fifo_elements);
+    }
     if (status != NC_OK) {
         THROW_IE_EXCEPTION << "Failed to create input FIFO: " << ncStatusToStr(graphDesc._graphHandle, status);
     }
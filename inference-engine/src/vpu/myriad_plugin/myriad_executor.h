@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <map>
 #include <iomanip>
 #include <utility>
@@ -30,6 +31,8 @@ struct GraphDesc {
 
     ncFifoHandle_t *_inputFifoHandle = nullptr;
     ncFifoHandle_t *_outputFifoHandle = nullptr;
+
+    int _pipelineDepth = 0;
 };
 
 struct DeviceDesc {
@@ -96,7 +99,8 @@ public:
                        const std::pair<const char*, size_t> &graphHeaderDesc,
                        size_t numStages,
                        const std::string & networkName,
-                       int executors);
+                       int executors,
+                       int pipelineDepth);
 
     void deallocateGraph(DevicePtr &device, GraphDesc &graphDesc);
 
@@ -133,9 +137,11 @@ private:
      * @brief Try to boot any available device that suitable for selected platform and protocol
      * @param configPlatform Boot the selected platform
      * @param configProtocol Boot device with selected protocol
+     * @param poolLock Lock of the device pool, it is released while the device is being booted
      */
     ncStatus_t bootNextDevice(std::vector<DevicePtr> &devicePool,
-                              const MyriadConfig& config);
+                              const MyriadConfig& config,
+                              std::unique_lock<std::mutex>& poolLock);
 };
 
 typedef std::shared_ptr<MyriadExecutor> MyriadExecutorPtr;
@@ -137,8 +137,17 @@ void MyriadInferRequest::InferAsync() {
         }
     }
 
+    const auto sendStart = std::chrono::steady_clock::now();
     _executor->queueInference(_graphDesc, inputBuffer.data(),
                               _inputInfo.totalSize, nullptr, 0);
+    _sendTensorTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sendStart);
+}
+
+void MyriadInferRequest::readResult(void* resultData, unsigned int resultBytes) {
+    // waits for the request to leave the device pipeline, so the time includes device execution
+    const auto readStart = std::chrono::steady_clock::now();
+    _executor->getResult(_graphDesc, resultData, resultBytes);
+    _getResultTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - readStart);
 }
 
 static void copyBlobAccordingUpperBound(
@@ -209,12 +218,12 @@ void MyriadInferRequest::GetResult() {
         const auto& blob = (*it).second;
 
         if (blob->getTensorDesc().getLayout() == getVpuLayout(name)) {
-            _executor->getResult(_graphDesc, blob->buffer(), static_cast<unsigned>(blob->byteSize()));
+            readResult(blob->buffer(), static_cast<unsigned>(blob->byteSize()));
             return;
         }
     }
 
-    _executor->getResult(_graphDesc, resultBuffer.data(), static_cast<unsigned>(resultBuffer.size()));
+    readResult(resultBuffer.data(), static_cast<unsigned>(resultBuffer.size()));
 
     for (const auto& output : _outputs) {
         const auto& ieBlobName = output.first;
@@ -293,4 +302,20 @@ void MyriadInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEng
         _stagesMetaData,
         perfInfo.data(), static_cast<int>(perfInfo.size()),
         _config.perfReport(), _config.printReceiveTensorTime());
+
+    if (_config.perfCount()) {
+        const auto addHostStage = [&perfMap](const std::string& name, const std::chrono::microseconds& time) {
+            InferenceEngineProfileInfo profInfo = {};
+            profInfo.status = InferenceEngineProfileInfo::EXECUTED;
+            profInfo.realTime_uSec = time.count();
+            profInfo.cpu_uSec = time.count();
+            profInfo.execution_index = 0;
+            name.copy(profInfo.layer_type, sizeof(profInfo.layer_type) / sizeof(profInfo.layer_type[0]) - 1, 0);
+            name.copy(profInfo.exec_type, sizeof(profInfo.exec_type) / sizeof(profInfo.exec_type[0]) - 1, 0);
+            perfMap[name] = profInfo;
+        };
+
+        addHostStage("<Send-Tensor>", _sendTensorTime);
+        addHostStage("<Get-Result>", _getResultTime);
+    }
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <string>
 #include <vector>
@@ -35,6 +36,12 @@ class MyriadInferRequest : public InferenceEngine::InferRequestInternal {
     std::vector<uint8_t> resultBuffer;
     std::vector<uint8_t> inputBuffer;
 
+    // host side time of the last request spent in the input and output FIFOs
+    std::chrono::microseconds _sendTensorTime {};
+    std::chrono::microseconds _getResultTime {};
+
+    void readResult(void* resultData, unsigned int resultBytes);
+
 public:
     typedef std::shared_ptr<MyriadInferRequest> Ptr;
 
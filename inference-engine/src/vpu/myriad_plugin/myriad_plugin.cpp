@@ -277,6 +277,7 @@ IE_SUPPRESS_DEPRECATED_START
         { KEY_PERF_COUNT, CONFIG_VALUE(NO) },
         { KEY_CONFIG_FILE, "" },
         { KEY_DEVICE_ID, "" },
+        { KEY_CACHE_DIR, "" },
     };
 IE_SUPPRESS_DEPRECATED_END
 }
@@ -359,6 +360,8 @@ InferenceEngine::Parameter Engine::GetMetric(const std::string& name,
         } else {
             return Parameter();
         }
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     }
     THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
 }
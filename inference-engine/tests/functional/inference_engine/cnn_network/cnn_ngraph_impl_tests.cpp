@@ -1132,4 +1132,31 @@ TEST(CNNNGraphImplTests, SaveOriginalResultNameForMultiOutputOp) {
         ASSERT_NE(outputs.find("text_features"), outputs.end());
     }
 }
+
+TEST(CNNNGraphImplTests, ReshapeSeveralTimes) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+        param->set_friendly_name("data");
+        auto relu = std::make_shared<ngraph::opset5::Relu>(param);
+        relu->set_friendly_name("relu");
+        auto result = std::make_shared<ngraph::opset5::Result>(relu);
+        ngraph = std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param});
+    }
+
+    InferenceEngine::details::CNNNetworkNGraphImpl cnnNet(ngraph);
+    const auto param = ngraph->get_parameters()[0];
+    for (const auto& dims : {SizeVector{1, 3, 32, 32}, SizeVector{2, 3, 16, 16}, SizeVector{1, 3, 22, 22}}) {
+        ASSERT_EQ(OK, cnnNet.reshape({{"data", dims}}, nullptr));
+
+        InputsDataMap inputs;
+        cnnNet.getInputsInfo(inputs);
+        ASSERT_EQ(dims, inputs["data"]->getTensorDesc().getDims());
+        OutputsDataMap outputs;
+        cnnNet.getOutputsInfo(outputs);
+        ASSERT_EQ(dims, outputs["relu"]->getTensorDesc().getDims());
+        // parameters are reshaped in place
+        ASSERT_EQ(param, cnnNet.getFunction()->get_parameters()[0]);
+    }
+}
 IE_SUPPRESS_DEPRECATED_END
@@ -0,0 +1,82 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_plugin_config.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "compilation_context.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+CNNNetwork makeNetwork(float bias, int64_t axis = 1) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+    param->set_friendly_name("input");
+    auto add = std::make_shared<ngraph::opset1::Add>(param,
+        ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {1.f, 2.f, bias}));
+    auto softmax = std::make_shared<ngraph::opset1::Softmax>(add, axis);
+    auto result = std::make_shared<ngraph::opset1::Result>(softmax);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+}  // namespace
+
+TEST(NetworkCompilationContextTests, sameNetworkHasSameHash) {
+    auto hash = NetworkCompilationContext::computeHash(makeNetwork(3.f), "DEVICE", {});
+    ASSERT_FALSE(hash.empty());
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(makeNetwork(3.f), "DEVICE", {}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnConstantData) {
+    ASSERT_NE(NetworkCompilationContext::computeHash(makeNetwork(3.f), "DEVICE", {}),
+              NetworkCompilationContext::computeHash(makeNetwork(4.f), "DEVICE", {}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnAttributes) {
+    ASSERT_NE(NetworkCompilationContext::computeHash(makeNetwork(3.f, 1), "DEVICE", {}),
+              NetworkCompilationContext::computeHash(makeNetwork(3.f, 2), "DEVICE", {}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnInputPrecision) {
+    auto network = makeNetwork(3.f);
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    ASSERT_NE(NetworkCompilationContext::computeHash(makeNetwork(3.f), "DEVICE", {}),
+              NetworkCompilationContext::computeHash(network, "DEVICE", {}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnConfigButNotOnCacheDir) {
+    auto network = makeNetwork(3.f);
+    auto hash = NetworkCompilationContext::computeHash(network, "DEVICE", {{"KEY", "1"}});
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(network, "DEVICE", {{"KEY", "2"}}));
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(network, "OTHER_DEVICE", {{"KEY", "1"}}));
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(network, "DEVICE",
+                                                           {{"KEY", "1"}, {CONFIG_KEY(CACHE_DIR), "cache"}}));
+}
+
+TEST(NetworkCompilationContextTests, fileHashDependsOnWeightsContent) {
+    const std::string xmlPath = "compilation_context_test.xml";
+    const std::string binPath = "compilation_context_test.bin";
+    CommonTestUtils::createFile(xmlPath, "<net/>");
+    // same size, path and likely the same modification time
+    CommonTestUtils::createFile(binPath, "0123");
+    auto hash = NetworkCompilationContext::computeHash(xmlPath, "DEVICE", {});
+    CommonTestUtils::createFile(binPath, "0124");
+    auto otherHash = NetworkCompilationContext::computeHash(xmlPath, "DEVICE", {});
+    CommonTestUtils::removeIRFiles(xmlPath, binPath);
+
+    ASSERT_FALSE(hash.empty());
+    ASSERT_NE(hash, otherHash);
+    ASSERT_TRUE(NetworkCompilationContext::computeHash(xmlPath, "DEVICE", {}).empty());
+}
@@ -10,6 +10,7 @@
 #include <common_test_utils/test_assertions.hpp>
 #include <functional_test_utils/test_model/test_model.hpp>
 #include <onnx_custom_op.hpp>
+#include <exec_graph_info.hpp>
 
 
 class CustomAbsKernel : public InferenceEngine::ILayerExecImpl {
@@ -78,6 +79,36 @@ class CustomAbsKernel : public InferenceEngine::ILayerExecImpl {
         const std::shared_ptr<ngraph::Node> node;
 };
 
+class CustomAbsEltwiseKernel : public InferenceEngine::ILayerEltwiseImpl {
+    public:
+        explicit CustomAbsEltwiseKernel(const std::shared_ptr<ngraph::Node>& node): kernel(node) {}
+
+        InferenceEngine::StatusCode
+        init(InferenceEngine::LayerConfig& config, InferenceEngine::ResponseDesc* resp) noexcept override {
+            return kernel.init(config, resp);
+        }
+
+        InferenceEngine::StatusCode getSupportedConfigurations(std::vector<InferenceEngine::LayerConfig>& conf,
+                                                               InferenceEngine::ResponseDesc* resp) noexcept override {
+            return kernel.getSupportedConfigurations(conf, resp);
+        }
+
+        InferenceEngine::StatusCode
+        execute(std::vector<InferenceEngine::Blob::Ptr>& inputs, std::vector<InferenceEngine::Blob::Ptr>& outputs,
+                InferenceEngine::ResponseDesc* resp) noexcept override {
+            return kernel.execute(inputs, outputs, resp);
+        }
+
+        void compute(const float* src, float* dst, size_t count) const noexcept override {
+            for (size_t i = 0; i < count; i++) {
+                dst[i] = src[i] < 0 ? (-src[i] * 2) : src[i];
+            }
+        }
+
+    private:
+        CustomAbsKernel kernel;
+};
+
 class CustomAbs : public ngraph::op::Op {
 public:
     static constexpr ngraph::NodeTypeInfo type_info{"CustomAbs", 100500};
@@ -129,6 +160,13 @@ class CustomAbsExtension : public InferenceEngine::IExtension {
         }
 };
 
+class CustomAbsEltwiseExtension : public CustomAbsExtension {
+    public:
+        InferenceEngine::ILayerImpl::Ptr getImplementation(const std::shared_ptr<ngraph::Node>& node, const std::string& implType) override {
+            return std::make_shared<CustomAbsEltwiseKernel>(node);
+        }
+};
+
 void infer_model(InferenceEngine::Core& ie, const std::string& model, const std::vector<float>& input_values, const std::vector<float>& expected) {
     InferenceEngine::Blob::CPtr weights;
     auto network = ie.ReadNetwork(model, weights);
@@ -268,6 +306,75 @@ TEST(Extension, XmlModelWithCustomAbs) {
 }
 
 
+TEST(Extension, InPlaceCustomAbsKeepsSharedInput) {
+    // CustomAbs asks to compute the output in-place, but its input is read by Relu as well
+    auto param = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, ngraph::Shape{10});
+    auto abs = std::make_shared<CustomAbs>(param);
+    auto relu = std::make_shared<ngraph::op::Relu>(param);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{abs, relu}, ngraph::ParameterVector{param});
+
+    InferenceEngine::Core ie;
+    ie.AddExtension(std::make_shared<CustomAbsExtension>());
+    InferenceEngine::CNNNetwork network(function);
+    auto inference_req = ie.LoadNetwork(network, "CPU").CreateInferRequest();
+
+    std::vector<float> input_values{1, -2, 3, -4, 5, -6, 7, -8, 9, -10};
+    auto blob = inference_req.GetBlob(network.getInputsInfo().begin()->first);
+    std::copy(input_values.begin(), input_values.end(), blob->buffer().as<float*>());
+    inference_req.Infer();
+
+    auto read = [&](const std::shared_ptr<ngraph::Node>& node) {
+        auto output = inference_req.GetBlob(node->get_friendly_name());
+        const auto* data = output->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + output->size());
+    };
+    ASSERT_EQ(std::vector<float>({1, 4, 3, 8, 5, 12, 7, 16, 9, 20}), read(abs));
+    ASSERT_EQ(std::vector<float>({1, 0, 3, 0, 5, 0, 7, 0, 9, 0}), read(relu));
+    const auto* input_data = blob->cbuffer().as<const float*>();
+    ASSERT_EQ(input_values, std::vector<float>(input_data, input_data + blob->size()));
+}
+
+
+TEST(Extension, EltwiseCustomAbsIsFusedIntoEltwise) {
+    auto param = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+    auto scale = ngraph::op::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {-1.f});
+    auto multiply = std::make_shared<ngraph::op::v1::Multiply>(param, scale);
+    auto abs = std::make_shared<CustomAbs>(multiply);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{abs}, ngraph::ParameterVector{param});
+
+    InferenceEngine::Core ie;
+    ie.AddExtension(std::make_shared<CustomAbsEltwiseExtension>());
+    InferenceEngine::CNNNetwork network(function);
+    auto exe_network = ie.LoadNetwork(network, "CPU");
+
+    // Multiply and CustomAbs are executed by the same layer
+    bool fused = false;
+    for (const auto& op : exe_network.GetExecGraphInfo().getFunction()->get_ops()) {
+        auto names = op->get_rt_info().find(ExecGraphInfoSerialization::ORIGINAL_NAMES);
+        if (names == op->get_rt_info().end())
+            continue;
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(names->second)->get();
+        fused = fused || (value.find(multiply->get_friendly_name()) != std::string::npos &&
+                          value.find(abs->get_friendly_name()) != std::string::npos);
+    }
+    ASSERT_TRUE(fused);
+
+    auto inference_req = exe_network.CreateInferRequest();
+    auto blob = inference_req.GetBlob(network.getInputsInfo().begin()->first);
+    auto input_data = blob->buffer().as<float*>();
+    for (size_t i = 0; i < blob->size(); i++)
+        input_data[i] = static_cast<float>(i % 7) - 3.f;
+    inference_req.Infer();
+
+    auto output = inference_req.GetBlob(network.getOutputsInfo().begin()->first);
+    const auto* output_data = output->cbuffer().as<const float*>();
+    for (size_t i = 0; i < output->size(); i++) {
+        float value = -input_data[i];
+        ASSERT_EQ(value < 0 ? -value * 2 : value, output_data[i]);
+    }
+}
+
+
 static std::string get_extension_path() {
     return FileUtils::makeSharedLibraryName<char>({},
             std::string("template_extension") + IE_BUILD_POSTFIX);
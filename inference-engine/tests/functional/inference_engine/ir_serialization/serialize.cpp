@@ -3,10 +3,13 @@
 //
 
 #include <fstream>
+#include <sstream>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
 #include "gtest/gtest.h"
 #include "ie_core.hpp"
+#include "ngraph/opsets/opset5.hpp"
+#include "transformations/serialize.hpp"
 
 #ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
 #define IR_SERIALIZATION_MODELS_PATH ""
@@ -63,3 +66,54 @@ INSTANTIATE_TEST_CASE_P(ONNXSerialization, SerializationTest,
                         std::make_tuple("split_equal_parts_2d.prototxt"),
                         std::make_tuple("addmul_abc.prototxt"),
                         std::make_tuple("add_abc_initializers.prototxt")));
+
+TEST(SerializationTest, SerializeToStreamsIsTheSameAsToFiles) {
+    InferenceEngine::Core ie;
+    auto function = ie.ReadNetwork(IR_SERIALIZATION_MODELS_PATH "addmul_abc.xml").getFunction();
+
+    const std::string xml_path = "stream_test.xml", bin_path = "stream_test.bin";
+    ngraph::pass::Serialize(xml_path, bin_path).run_on_function(function);
+
+    std::stringstream xml_stream, bin_stream;
+    ngraph::pass::Serialize(xml_stream, bin_stream).run_on_function(function);
+
+    std::ifstream xml_file(xml_path), bin_file(bin_path, std::ios::binary);
+    std::string xml_content{std::istreambuf_iterator<char>(xml_file), std::istreambuf_iterator<char>()};
+    std::string bin_content{std::istreambuf_iterator<char>(bin_file), std::istreambuf_iterator<char>()};
+    xml_file.close();
+    bin_file.close();
+    std::remove(xml_path.c_str());
+    std::remove(bin_path.c_str());
+
+    ASSERT_EQ(xml_content, xml_stream.str());
+    ASSERT_EQ(bin_content, bin_stream.str());
+}
+
+TEST(SerializationTest, IdenticalConstantsAreWrittenOnce) {
+    auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 64});
+    const std::vector<float> values(64, 0.5f);
+    auto bias1 = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 64}, values);
+    auto bias2 = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 64}, values);
+    auto scale = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 64}, std::vector<float>(64, 2.f));
+    auto add1 = std::make_shared<ngraph::opset5::Add>(data, bias1);
+    auto mul = std::make_shared<ngraph::opset5::Multiply>(add1, scale);
+    auto add2 = std::make_shared<ngraph::opset5::Add>(mul, bias2);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add2}, ngraph::ParameterVector{data});
+
+    std::stringstream xml_stream, bin_stream;
+    ngraph::pass::Serialize(xml_stream, bin_stream).run_on_function(function);
+    ASSERT_EQ(bin_stream.str().size(), 2 * values.size() * sizeof(float));
+
+    InferenceEngine::Core ie;
+    const std::string bin_content = bin_stream.str();
+    auto weights = InferenceEngine::make_shared_blob<uint8_t>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {bin_content.size()}, InferenceEngine::Layout::C));
+    weights->allocate();
+    std::copy(bin_content.begin(), bin_content.end(), weights->buffer().as<char*>());
+    auto result = ie.ReadNetwork(xml_stream.str(), weights).getFunction();
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result, function, true);
+    ASSERT_TRUE(success) << message;
+}
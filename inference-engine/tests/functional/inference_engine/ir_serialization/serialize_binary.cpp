@@ -0,0 +1,142 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <set>
+#include <sstream>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "gtest/gtest.h"
+#include "ie_core.hpp"
+#include "ngraph/opsets/opset5.hpp"
+#include "transformations/rt_info/fused_names_attribute.hpp"
+#include "transformations/serialize_binary.hpp"
+
+#ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
+#define IR_SERIALIZATION_MODELS_PATH ""
+#endif
+
+typedef std::tuple<std::string> BinarySerializationParams;
+
+class BinarySerializationTest: public CommonTestUtils::TestsCommon,
+                               public testing::WithParamInterface<BinarySerializationParams> {
+public:
+    std::string m_out_model_path;
+    std::string m_out_bin_path;
+
+    void SetUp() override {
+        const auto & model_path = IR_SERIALIZATION_MODELS_PATH + std::get<0>(GetParam());
+
+        m_out_model_path = "binary_test.ngbin";
+        m_out_bin_path = "binary_test.bin";
+
+        InferenceEngine::Core ie;
+        auto expected = ie.ReadNetwork(model_path);
+        ngraph::pass::SerializeBinary(m_out_model_path, m_out_bin_path).run_on_function(expected.getFunction());
+        auto result = ie.ReadNetwork(m_out_model_path);
+
+        bool success;
+        std::string message;
+        std::tie(success, message) = compare_functions(result.getFunction(), expected.getFunction(), true, true);
+        ASSERT_TRUE(success) << message;
+    }
+
+    void TearDown() override {
+        std::remove(m_out_model_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+};
+
+TEST_P(BinarySerializationTest, CompareFunctions) {
+}
+
+INSTANTIATE_TEST_CASE_P(IRSerialization, BinarySerializationTest,
+        testing::Values(std::make_tuple("add_abc.xml"),
+                        std::make_tuple("add_abc_f64.xml"),
+                        std::make_tuple("split_equal_parts_2d.xml"),
+                        std::make_tuple("addmul_abc.xml"),
+                        std::make_tuple("add_abc_initializers.xml"),
+                        std::make_tuple("experimental_detectron_roi_feature_extractor.xml"),
+                        std::make_tuple("experimental_detectron_detection_output.xml"),
+                        std::make_tuple("nms5.xml"),
+                        std::make_tuple("shape_of.xml")));
+
+namespace {
+std::shared_ptr<ngraph::Function> create_function_with_rt_info() {
+    auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 2, 2});
+    auto bias = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {1, 2, 3});
+    auto add = std::make_shared<ngraph::opset5::Add>(data, bias);
+    auto relu = std::make_shared<ngraph::opset5::Relu>(add);
+    relu->set_friendly_name("relu");
+
+    auto& rt_info = relu->get_rt_info();
+    rt_info["layout"] = std::make_shared<ngraph::VariantWrapper<std::string>>("nchw");
+    rt_info["index"] = std::make_shared<ngraph::VariantWrapper<int64_t>>(42);
+    ngraph::FusedNames names("add");
+    names.fuseWith(ngraph::FusedNames("relu"));
+    rt_info[ngraph::VariantWrapper<ngraph::FusedNames>::type_info.name] =
+        std::make_shared<ngraph::VariantWrapper<ngraph::FusedNames>>(names);
+
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{data}, "rt_info");
+}
+
+InferenceEngine::Blob::Ptr make_weights(const std::string& content) {
+    auto weights = InferenceEngine::make_shared_blob<uint8_t>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {content.size()}, InferenceEngine::Layout::C));
+    weights->allocate();
+    std::copy(content.begin(), content.end(), weights->buffer().as<char*>());
+    return weights;
+}
+}  // namespace
+
+TEST(BinarySerializationTest, RuntimeInfoIsRestored) {
+    auto function = create_function_with_rt_info();
+
+    std::stringstream model_stream, bin_stream;
+    ngraph::pass::SerializeBinary(model_stream, bin_stream).run_on_function(function);
+
+    InferenceEngine::Core ie;
+    auto result = ie.ReadNetwork(model_stream.str(), make_weights(bin_stream.str())).getFunction();
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result, function, true, true, true);
+    ASSERT_TRUE(success) << message;
+
+    auto relu = result->get_result()->get_input_node_shared_ptr(0);
+    const auto& rt_info = relu->get_rt_info();
+    ASSERT_EQ(std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(rt_info.at("layout"))->get(), "nchw");
+    ASSERT_EQ(std::dynamic_pointer_cast<ngraph::VariantWrapper<int64_t>>(rt_info.at("index"))->get(), 42);
+    ASSERT_EQ(ngraph::getFusedNames(relu), "add,relu");
+}
+
+TEST(BinarySerializationTest, ConstantsAreAligned) {
+    auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{3});
+    auto scale = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{3}, {1, 2, 3});
+    auto shift = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{3}, {4, 5, 6});
+    auto add = std::make_shared<ngraph::opset5::Add>(std::make_shared<ngraph::opset5::Multiply>(data, scale), shift);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{data});
+
+    std::stringstream model_stream, bin_stream;
+    ngraph::pass::SerializeBinary(model_stream, bin_stream).run_on_function(function);
+
+    // the second constant starts at the next aligned offset
+    const auto weights = bin_stream.str();
+    ASSERT_EQ(weights.size(), ngraph::pass::SerializeBinary::ConstantAlignment + 3 * sizeof(float));
+    const auto first = reinterpret_cast<const float*>(weights.data());
+    const auto second = reinterpret_cast<const float*>(weights.data() + ngraph::pass::SerializeBinary::ConstantAlignment);
+    std::set<std::vector<float>> constants{std::vector<float>(first, first + 3), std::vector<float>(second, second + 3)};
+    ASSERT_EQ(constants, std::set<std::vector<float>>({{1, 2, 3}, {4, 5, 6}}));
+}
+
+TEST(BinarySerializationTest, TruncatedModelThrows) {
+    auto function = create_function_with_rt_info();
+
+    std::stringstream model_stream, bin_stream;
+    ngraph::pass::SerializeBinary(model_stream, bin_stream).run_on_function(function);
+    const auto model = model_stream.str();
+
+    InferenceEngine::Core ie;
+    ASSERT_THROW(ie.ReadNetwork(model.substr(0, model.size() / 2), make_weights(bin_stream.str())),
+                 InferenceEngine::details::InferenceEngineException);
+}
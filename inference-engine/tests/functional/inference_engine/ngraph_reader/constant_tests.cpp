@@ -53,3 +53,120 @@ TEST_F(NGraphReaderTests, ReadConstantNetwork) {
 
         IE_SUPPRESS_DEPRECATED_END
 }
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkWithSeveralConstants) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="constant0" type="Const" version="opset1">
+            <data element_type="f32" offset="0" shape="1,3" size="12"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="constant1" type="Const" version="opset1">
+            <data element_type="f32" offset="12" shape="1,3" size="12"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="add" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="3" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Core ie;
+    Blob::Ptr weights = make_shared_blob<float>(TensorDesc(Precision::FP32, {6}, Layout::C));
+    weights->allocate();
+    auto data = weights->buffer().as<float*>();
+    for (size_t i = 0; i < weights->size(); ++i) {
+        data[i] = static_cast<float>(i);
+    }
+
+    auto nGraph = ie.ReadNetwork(model, weights).getFunction();
+    ASSERT_NE(nullptr, nGraph);
+    std::map<std::string, std::vector<float>> values;
+    for (const auto& op : nGraph->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op)) {
+            values[constant->get_friendly_name()] = constant->cast_vector<float>();
+        }
+    }
+    ASSERT_EQ(2, values.size());
+    ASSERT_EQ(std::vector<float>({0.f, 1.f, 2.f}), values["constant0"]);
+    ASSERT_EQ(std::vector<float>({3.f, 4.f, 5.f}), values["constant1"]);
+}
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkWithIncorrectWeights) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="constant" type="Const" version="opset1">
+            <data element_type="f32" offset="0" shape="1,3,22,22" size="5808"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Core ie;
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {100}, Layout::C));
+    weights->allocate();
+
+    ASSERT_THROW(ie.ReadNetwork(model, weights), InferenceEngine::details::InferenceEngineException);
+}
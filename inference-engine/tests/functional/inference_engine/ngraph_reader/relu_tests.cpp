@@ -227,3 +227,77 @@ TEST_F(NGraphReaderTests, ReadReLUScalarNetwork) {
     (void)convertedNetwork;
     IE_SUPPRESS_DEPRECATED_END
 }
+
+TEST_F(NGraphReaderTests, ReadReLUNetworkWithCommentsAndUnusedParameter) {
+    std::string model = R"V0G0N(<?xml version="1.0"?>
+<!-- <net name="Commented" version="10"> -->
+<net name="Network > 1" version="10">
+    <layers>
+        <!-- <layer name="commented" type="Parameter" id="5" version="opset1"/> -->
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="activation" id="1" type="ReLU" version="opset1">
+            <input>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in1" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,22,22"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="unused" type="Parameter" id="3" version="opset1">
+            <data element_type="f32" shape="1,3"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Core ie;
+    Blob::Ptr weights;
+
+    auto network = ie.ReadNetwork(model, weights);
+    auto nGraph = network.getFunction();
+    ASSERT_NE(nullptr, nGraph);
+    ASSERT_EQ("Network > 1", nGraph->get_friendly_name());
+    ASSERT_EQ(1, nGraph->get_parameters().size());
+    ASSERT_EQ("in1", nGraph->get_parameters()[0]->get_friendly_name());
+    ASSERT_EQ(1, nGraph->get_results().size());
+}
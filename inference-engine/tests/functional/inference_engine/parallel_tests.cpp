@@ -0,0 +1,63 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <ie_parallel.hpp>
+
+using namespace InferenceEngine;
+
+TEST(ParallelGrainTests, smallLoopIsExecutedByCallingThread) {
+    const auto callerId = std::this_thread::get_id();
+    std::atomic<int> otherThreads {0};
+    std::atomic<int> iterations {0};
+    {
+        parallel_grain_scope grain(1000);
+        parallel_for2d(10, 10, [&](int, int) {
+            if (std::this_thread::get_id() != callerId)
+                otherThreads++;
+            iterations++;
+        });
+    }
+    ASSERT_EQ(0, otherThreads.load());
+    ASSERT_EQ(100, iterations.load());
+}
+
+TEST(ParallelGrainTests, grainIsRestoredAfterScope) {
+    {
+        parallel_grain_scope outer(10);
+        {
+            parallel_grain_scope inner(100);
+            ASSERT_EQ(100, details::parallel_grain());
+        }
+        ASSERT_EQ(10, details::parallel_grain());
+    }
+    ASSERT_EQ(1, details::parallel_grain());
+}
+
+TEST(ParallelGrainTests, numberOfThreadsRespectsGrain) {
+    parallel_grain_scope grain(4);
+    ASSERT_EQ(1, details::parallel_work_threads(7));
+    ASSERT_LE(details::parallel_work_threads(16), 4);
+    ASSERT_LE(details::parallel_work_threads(16), parallel_get_max_threads());
+}
+
+TEST(ParallelStatsTests, statsAreCollectedInScopeOnly) {
+    details::parallel_stats stats;
+    {
+        parallel_stats_scope scope(stats);
+        ASSERT_EQ(&stats, details::parallel_stats_sink());
+        parallel_for(1000, [](int) {});
+    }
+    ASSERT_EQ(nullptr, details::parallel_stats_sink());
+#if (IE_THREAD == IE_THREAD_TBB)
+    if (parallel_get_max_threads() > 1)
+        ASSERT_EQ(1, stats.regions);
+#else
+    ASSERT_EQ(0, stats.regions);
+#endif
+}
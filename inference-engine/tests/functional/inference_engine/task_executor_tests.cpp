@@ -3,6 +3,7 @@
 //
 
 #include <future>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -186,6 +187,95 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+class PriorityStreamsExecutorTests : public ::testing::Test {
+protected:
+    // runs the tasks by a single stream which is blocked until all tasks are queued, returns execution order
+    std::vector<int> RunBlocked(int priorityAgingTime, const std::vector<IStreamsExecutor::Priority>& priorities,
+                                int delayBeforeLastTask = 0) {
+        IStreamsExecutor::Config config{"TestPriorityStreamsExecutor", 1, 1};
+        config._priorityAgingTime = priorityAgingTime;
+        auto executor = std::make_shared<CPUStreamsExecutor>(config);
+        std::promise<void> unblock;
+        auto blocker = unblock.get_future().share();
+        std::promise<void> started;
+        executor->run([&] {
+            started.set_value();
+            blocker.wait();
+        });
+        started.get_future().wait();
+
+        std::mutex mutex;
+        std::vector<int> order;
+        std::vector<std::future<void>> futures;
+        for (int i = 0; i < static_cast<int>(priorities.size()); ++i) {
+            if (delayBeforeLastTask && i == static_cast<int>(priorities.size()) - 1)
+                std::this_thread::sleep_for(std::chrono::milliseconds(delayBeforeLastTask));
+            auto task = std::make_shared<std::packaged_task<void()>>([&, i] {
+                std::lock_guard<std::mutex> lock{mutex};
+                order.push_back(i);
+            });
+            futures.emplace_back(task->get_future());
+            executor->run([task] {(*task)();}, priorities[i]);
+        }
+        unblock.set_value();
+        for (auto&& future : futures) future.get();
+        return order;
+    }
+};
+
+TEST_F(PriorityStreamsExecutorTests, highPriorityTaskIsTakenFirst) {
+    auto order = RunBlocked(0, {IStreamsExecutor::LOW, IStreamsExecutor::NORMAL,
+                                IStreamsExecutor::LOW, IStreamsExecutor::HIGH});
+    ASSERT_EQ((std::vector<int>{3, 1, 0, 2}), order);
+}
+
+TEST_F(PriorityStreamsExecutorTests, waitingTaskPriorityIsRaisedByAging) {
+    auto order = RunBlocked(1, {IStreamsExecutor::LOW, IStreamsExecutor::HIGH}, 20);
+    ASSERT_EQ((std::vector<int>{0, 1}), order);
+}
+
+TEST(SpinWaitStreamsExecutorTests, polledTasksAreExecutedAndPollingIsStoppedOnDestruction) {
+    IStreamsExecutor::Config config{"TestSpinWaitStreamsExecutor", 2, 1};
+    config._spinWaitTime = 10000000;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+    for (int i = 0; i < 10; ++i) {
+        std::packaged_task<void()> task{[] {}};
+        auto future = task.get_future();
+        executor->run([&task] {task();});
+        ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(5)));
+    }
+    const auto start = std::chrono::steady_clock::now();
+    executor.reset();
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST(SystemConfTests, topologyIsDetectedOncePerProcess) {
+    const auto cores = getNumberOfCPUCores();
+    const auto processors = getNumberOfLogicalCPUCores();
+    ASSERT_GT(cores, 0);
+    ASSERT_GE(processors, cores);
+    // threads pinned to a single core still get the topology of the process
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            ASSERT_EQ(cores, getNumberOfCPUCores());
+            ASSERT_EQ(processors, getNumberOfLogicalCPUCores());
+            ASSERT_EQ(getAvailableNUMANodes(), getAvailableNUMANodes());
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST(SystemConfTests, defaultThreadsDoNotExceedAvailableProcessors) {
+    if (parallel_get_env_threads() != 0) {
+        GTEST_SKIP();
+    }
+    auto config = IStreamsExecutor::Config::MakeDefaultMultiThreaded({"TestDefaultConfig", 2});
+    ASSERT_LE(config._threadsPerStream * config._streams, std::max(2, getNumberOfLogicalCPUCores()));
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
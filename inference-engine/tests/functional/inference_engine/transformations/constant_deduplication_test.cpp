@@ -0,0 +1,81 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <transformations/common_optimizations/constant_deduplication.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, ConstantDeduplication) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+        auto scale1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        auto mul1 = std::make_shared<ngraph::opset1::Multiply>(data, scale1);
+        auto scale2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        auto mul2 = std::make_shared<ngraph::opset1::Multiply>(mul1, scale2);
+        // same data of other shape and type are not merged
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{3}, {1, 2, 3});
+        auto add = std::make_shared<ngraph::opset1::Add>(mul2, bias);
+        auto shift = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 4});
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(add, shift);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{sub}, ngraph::ParameterVector{data});
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+        ASSERT_TRUE(ngraph::pass::ConstantDeduplication().run_on_function(f));
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        auto mul1 = std::make_shared<ngraph::opset1::Multiply>(data, scale);
+        auto mul2 = std::make_shared<ngraph::opset1::Multiply>(mul1, scale);
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{3}, {1, 2, 3});
+        auto add = std::make_shared<ngraph::opset1::Add>(mul2, bias);
+        auto shift = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 4});
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(add, shift);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{sub}, ngraph::ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(f->get_ops().size(), 9u);
+}
+
+TEST(TransformationTests, ConstantDeduplicationKeepsOutputs) {
+    auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{3});
+    auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{3}, {1, 2, 3});
+    auto add = std::make_shared<ngraph::opset1::Add>(data, bias);
+    auto output_const = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{3}, {1, 2, 3});
+
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{add, output_const}, ngraph::ParameterVector{data});
+    ASSERT_FALSE(ngraph::pass::ConstantDeduplication().run_on_function(f));
+}
+
+TEST(TransformationTests, ConstantDeduplicationComparesTail) {
+    // the byte size of 2^25 + 1 elements is not exact in float
+    const ngraph::Shape shape{(1ul << 25) + 1};
+    std::vector<uint8_t> values(ngraph::shape_size(shape), 1);
+    auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, shape);
+    auto first = ngraph::opset1::Constant::create(ngraph::element::u8, shape, values);
+    auto add = std::make_shared<ngraph::opset1::Add>(data, first);
+    values.back() = 2;
+    auto second = ngraph::opset1::Constant::create(ngraph::element::u8, shape, values);
+    auto sub = std::make_shared<ngraph::opset1::Subtract>(add, second);
+
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{sub}, ngraph::ParameterVector{data});
+    ASSERT_FALSE(ngraph::pass::ConstantDeduplication().run_on_function(f));
+    ASSERT_EQ(second, sub->input_value(1).get_node_shared_ptr());
+}
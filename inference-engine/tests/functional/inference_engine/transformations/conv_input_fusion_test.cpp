@@ -0,0 +1,148 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/constant_folding.hpp>
+#include <transformations/common_optimizations/conv_input_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+
+std::shared_ptr<ngraph::opset4::Convolution> makeConvolution(const ngraph::Output<ngraph::Node>& input,
+                                                             const ngraph::Output<ngraph::Node>& weights,
+                                                             std::ptrdiff_t pad) {
+    return std::make_shared<ngraph::opset4::Convolution>(input, weights, ngraph::Strides{2, 2}, ngraph::CoordinateDiff{pad, pad},
+                                                         ngraph::CoordinateDiff{pad, pad}, ngraph::Strides{1, 1});
+}
+
+std::shared_ptr<ngraph::Function> makeNormalizedConvolution(std::ptrdiff_t pad) {
+    auto input = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 64, 64});
+    auto scale = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {0.5, 0.25, 2.0});
+    auto mul = std::make_shared<ngraph::opset4::Multiply>(input, scale);
+    auto shift = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {-1.0, -2.0, -3.0});
+    auto add = std::make_shared<ngraph::opset4::Add>(mul, shift);
+    auto weights = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{8, 3, 3, 3}, {1.5});
+    auto conv = makeConvolution(add, weights, pad);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+}
+
+void runConvolutionInputFusion(const std::shared_ptr<ngraph::Function>& f) {
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::ConvolutionInputFusion>();
+    manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.run_passes(f);
+}
+
+}  // namespace
+
+TEST(TransformationTests, ConvolutionInputFusionScaleAndShift) {
+    auto f = makeNormalizedConvolution(0);
+    runConvolutionInputFusion(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    std::shared_ptr<ngraph::Function> f_ref;
+    {
+        auto input = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 64, 64});
+        auto weights = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{8, 3, 3, 3}, {1.5});
+        auto conv = makeConvolution(input, weights, 0);
+        auto bias = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{1, 8, 1, 1}, {-81.0});
+        auto add = std::make_shared<ngraph::opset4::Add>(conv, bias);
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    // bias is the sum of 3x3 weights (1.5) multiplied by the input shift (-1, -2, -3) of each channel
+    auto add = f->get_result()->get_input_node_shared_ptr(0);
+    auto bias = std::dynamic_pointer_cast<ngraph::opset4::Constant>(add->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, bias);
+    for (auto value : bias->cast_vector<float>())
+        ASSERT_FLOAT_EQ(-81.0f, value);
+
+    // weights of every input channel are multiplied by the channel scale
+    auto conv = add->get_input_node_shared_ptr(0);
+    auto weights = std::dynamic_pointer_cast<ngraph::opset4::Constant>(conv->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, weights);
+    const auto values = weights->cast_vector<float>();
+    ASSERT_FLOAT_EQ(0.75f, values[0]);
+    ASSERT_FLOAT_EQ(0.375f, values[9]);
+    ASSERT_FLOAT_EQ(3.0f, values[18]);
+}
+
+TEST(TransformationTests, ConvolutionInputFusionWithPaddingFusesScaleOnly) {
+    auto f = makeNormalizedConvolution(1);
+    runConvolutionInputFusion(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    std::shared_ptr<ngraph::Function> f_ref;
+    {
+        auto input = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 64, 64});
+        auto scale = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {0.5, 0.25, 2.0});
+        auto mul = std::make_shared<ngraph::opset4::Multiply>(input, scale);
+        auto shift = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {-1.0, -2.0, -3.0});
+        auto add = std::make_shared<ngraph::opset4::Add>(mul, shift);
+        auto weights = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{8, 3, 3, 3}, {1.5});
+        auto conv = makeConvolution(add, weights, 1);
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvolutionInputFusionScaleWithPadding) {
+    std::shared_ptr<ngraph::Function> f, f_ref;
+    {
+        auto input = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 64, 64});
+        auto scale = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{3, 1, 1}, {0.5, 0.25, 2.0});
+        auto mul = std::make_shared<ngraph::opset4::Multiply>(input, scale);
+        auto weights = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{8, 3, 3, 3}, {1.5});
+        auto conv = makeConvolution(mul, weights, 1);
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+        runConvolutionInputFusion(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 64, 64});
+        auto weights = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{8, 3, 3, 3}, {1.5});
+        auto conv = makeConvolution(input, weights, 1);
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvolutionInputFusionNegativeSpatialScale) {
+    std::shared_ptr<ngraph::Function> f, f_ref;
+    auto makeFunction = [] {
+        auto input = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 64, 64});
+        auto scale = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 1, 64}, {0.5});
+        auto mul = std::make_shared<ngraph::opset4::Multiply>(input, scale);
+        auto weights = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{8, 3, 3, 3}, {1.5});
+        auto conv = makeConvolution(mul, weights, 0);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+    };
+    f = makeFunction();
+    runConvolutionInputFusion(f);
+    f_ref = makeFunction();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -16,6 +16,7 @@
 #include <transformations/convert_precision.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/variant.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -622,3 +623,37 @@ TEST(TransformationTests, ConvertPrecision_ConstantConversion_U32MaxToI32) {
 TEST(TransformationTests, ConvertPrecision_ConstantConversion_U32ToI32) {
     constant_convert_test(element::Type_t::u32, element::Type_t::i32, 42, 42);
 }
+
+TEST(TransformationTests, ConvertPrecision_KeepConstPrecision) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<opset4::Parameter>(element::f16, Shape{1, 3, 8, 8});
+        auto weights = opset4::Constant::create(element::f16, Shape{4, 3, 1, 1}, {1});
+        weights->get_rt_info()["KEEP_CONST_PRECISION"] = std::make_shared<VariantWrapper<std::string>>("");
+        auto conv = std::make_shared<opset4::Convolution>(input, weights, Strides{1, 1}, CoordinateDiff{0, 0},
+                                                          CoordinateDiff{0, 0}, Strides{1, 1});
+
+        f = std::make_shared<Function>(NodeVector{conv}, ParameterVector{input});
+
+        pass::Manager manager;
+        manager.register_pass<ngraph::pass::ConvertPrecision>(ngraph::element::f16, ngraph::element::f32);
+        manager.run_passes(f);
+
+        auto convert = conv->input_value(1).get_node_shared_ptr();
+        ASSERT_TRUE(is_type<opset4::Convert>(convert));
+        ASSERT_TRUE(convert->get_rt_info().count("DISABLED_CONSTANT_FOLDING"));
+    }
+
+    {
+        auto input = std::make_shared<opset4::Parameter>(element::f32, Shape{1, 3, 8, 8});
+        auto weights = opset4::Constant::create(element::f16, Shape{4, 3, 1, 1}, {1});
+        auto convert = std::make_shared<opset4::Convert>(weights, element::f32);
+        auto conv = std::make_shared<opset4::Convolution>(input, convert, Strides{1, 1}, CoordinateDiff{0, 0},
+                                                          CoordinateDiff{0, 0}, Strides{1, 1});
+
+        f_ref = std::make_shared<Function>(NodeVector{conv}, ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
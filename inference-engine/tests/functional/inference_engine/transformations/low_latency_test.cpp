@@ -351,3 +351,127 @@ TEST(TransformationTests, LowLatencyLSTMReshape) {
     auto res = compare_functions(f, f_ref);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+namespace {
+std::shared_ptr<ngraph::Function> create_gru_chunk_reference() {
+    auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{2, 1, 16});
+    auto H = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+    const std::string variable_name_H("GRU/variable0");
+    auto read_value_H = std::make_shared<opset5::ReadValue>(H, variable_name_H);
+
+    auto axis = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+    auto split = std::make_shared<opset5::Split>(X, opset5::Constant::create(element::i64, Shape{}, {0}), 2);
+    auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{384, 16}, std::vector<float>(384 * 16, 0));
+    auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{384, 128}, std::vector<float>(384 * 128, 0));
+    auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{384}, std::vector<float>(384, 0));
+
+    // the second iteration takes the hidden state from the first one, not from the variable
+    auto gru_cell_1 = std::make_shared<opset5::GRUCell>(std::make_shared<opset5::Squeeze>(split->output(0), axis),
+                                                        read_value_H, W, R, B, 128);
+    auto gru_cell_2 = std::make_shared<opset5::GRUCell>(std::make_shared<opset5::Squeeze>(split->output(1), axis),
+                                                        gru_cell_1, W, R, B, 128);
+    auto assign_H = std::make_shared<opset5::Assign>(gru_cell_2, variable_name_H);
+    assign_H->add_control_dependency(read_value_H);
+
+    auto concat = std::make_shared<opset5::Concat>(OutputVector{std::make_shared<opset5::Unsqueeze>(gru_cell_1, axis),
+                                                                std::make_shared<opset5::Unsqueeze>(gru_cell_2, axis)}, 0);
+    auto f_ref = std::make_shared<ngraph::Function>(OutputVector{concat}, ParameterVector{X, H});
+    f_ref->add_sinks({assign_H});
+    return f_ref;
+}
+
+std::shared_ptr<ngraph::Function> create_gru_body(const std::shared_ptr<opset5::Parameter>& Xi,
+                                                  const std::shared_ptr<opset5::Parameter>& Yi,
+                                                  std::shared_ptr<opset5::Result>& res_1,
+                                                  std::shared_ptr<opset5::Result>& res_2) {
+    auto axis = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+    auto squeeze = std::make_shared<opset5::Squeeze>(Xi, axis);
+    auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{384, 16}, std::vector<float>(384 * 16, 0));
+    auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{384, 128}, std::vector<float>(384 * 128, 0));
+    auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{384}, std::vector<float>(384, 0));
+
+    auto gru_cell = std::make_shared<opset5::GRUCell>(squeeze, Yi, W, R, B, 128);
+    res_1 = std::make_shared<opset5::Result>(gru_cell);
+    res_2 = std::make_shared<opset5::Result>(std::make_shared<opset5::Unsqueeze>(gru_cell, axis));
+    return std::make_shared<ngraph::Function>(OutputVector{res_1, res_2}, ParameterVector{Xi, Yi});
+}
+}  // namespace
+
+TEST(TransformationTests, LowLatencyGRUChunk) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{2, 1, 16});
+        auto Y = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        auto Xi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        auto Yi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        std::shared_ptr<opset5::Result> res_1, res_2;
+        auto body = create_gru_body(Xi, Yi, res_1, res_2);
+
+        auto tensor_iterator = std::make_shared<opset5::TensorIterator>();
+        tensor_iterator->set_body(body);
+
+        tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+        tensor_iterator->set_merged_input(Yi, Y, res_1);
+
+        auto out0 = tensor_iterator->get_concatenated_slices(res_2, 0, 1, 1, -1, 0);
+
+        auto res_ti = std::make_shared<opset5::Result>(tensor_iterator->output(0));
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{res_ti}, ngraph::ParameterVector{X, Y});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::LowLatency>();
+        manager.register_pass<ngraph::pass::UnrollTensorIterator>();
+        manager.run_passes(f);
+
+        ASSERT_NO_THROW(check_rt_info(f));
+        ASSERT_EQ(f->get_sinks().size(), 1);
+    }
+    f_ref = create_gru_chunk_reference();
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, LowLatencyLoop) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{2, 1, 16});
+        auto Y = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        auto Xi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        auto Yi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        std::shared_ptr<opset5::Result> res_1, res_2;
+        auto body = create_gru_body(Xi, Yi, res_1, res_2);
+        auto body_condition = std::make_shared<opset5::Result>(
+                opset5::Constant::create(element::boolean, Shape{1}, {true}));
+        body->add_results({body_condition});
+
+        auto trip_count = opset5::Constant::create(element::i64, Shape{1}, {2});
+        auto exec_condition = opset5::Constant::create(element::boolean, Shape{1}, {true});
+        auto loop = std::make_shared<opset5::Loop>(trip_count, exec_condition);
+        loop->set_function(body);
+        loop->set_special_body_ports(opset5::Loop::SpecialBodyPorts{-1, 2});
+
+        loop->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+        loop->set_merged_input(Yi, Y, res_1);
+
+        auto out0 = loop->get_concatenated_slices(res_2, 0, 1, 1, -1, 0);
+
+        auto res_loop = std::make_shared<opset5::Result>(loop->output(0));
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{res_loop}, ngraph::ParameterVector{X, Y});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::LowLatency>();
+        manager.register_pass<ngraph::pass::UnrollTensorIterator>();
+        manager.run_passes(f);
+
+        ASSERT_NO_THROW(check_rt_info(f));
+        ASSERT_EQ(f->get_sinks().size(), 1);
+    }
+    f_ref = create_gru_chunk_reference();
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
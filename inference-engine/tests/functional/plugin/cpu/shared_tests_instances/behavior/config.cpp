@@ -24,7 +24,26 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::HYBRID_AWARE}},
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MAX_ISA, InferenceEngine::PluginConfigParams::CPU_ISA_SSE42}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_BF16_FP32_LAYERS, "Softmax,fc1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, "0.7"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, InferenceEngine::PluginConfigParams::CPU_WEIGHTS_U8}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MIN_PARALLEL_WORK, "64"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_CONV_AUTOTUNE, "3"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_NUMA_SHARDING_THRESHOLD, "256"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SPIN_WAIT_TIME, "100"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DETAILED_PERF_COUNT, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_REQUEST_PRIORITY, InferenceEngine::PluginConfigParams::CPU_REQUEST_PRIORITY_HIGH}},
+            {{InferenceEngine::PluginConfigParams::KEY_REQUEST_DEADLINE, "100"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INLINE_CALLBACKS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_LAYOUT_PROPAGATION, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_HUGE_PAGES, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_WARMUP, InferenceEngine::PluginConfigParams::YES}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -39,7 +58,18 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                     InferenceEngine::MultiDeviceConfigParams::MULTI_EXPECTED_COMPLETION_TIME}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_ADAPTIVE_NUM_REQUESTS,
+                     InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_EARLY_START,
+                     InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::PluginConfigParams::KEY_REQUEST_DEADLINE, "100"}}
     };
 
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CorrectConfigTests,
@@ -59,7 +89,25 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, "0"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MAX_ISA, "AVX"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, "1.5"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, "I8"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MIN_PARALLEL_WORK, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_CONV_AUTOTUNE, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_NUMA_SHARDING_THRESHOLD, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SPIN_WAIT_TIME, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DETAILED_PERF_COUNT, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_REQUEST_PRIORITY, "URGENT"}},
+            {{InferenceEngine::PluginConfigParams::KEY_REQUEST_DEADLINE, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INLINE_CALLBACKS, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_LAYOUT_PROPAGATION, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_HUGE_PAGES, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_WARMUP, "ON"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -68,7 +116,9 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::PluginConfigParams::KEY_REQUEST_DEADLINE, "-1"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiconf = {
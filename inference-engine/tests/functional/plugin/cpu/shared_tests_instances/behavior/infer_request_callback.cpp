@@ -3,6 +3,7 @@
 //
 
 #include "multi-device/multi_device_config.hpp"
+#include "auto_batch/auto_batch_config.hpp"
 
 #include "behavior/infer_request_callback.hpp"
 
@@ -16,13 +17,20 @@ const std::vector<InferenceEngine::Precision> netPrecisions = {
 const std::vector<std::map<std::string, std::string>> configs = {
         {},
         {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, InferenceEngine::PluginConfigParams::CPU_THROUGHPUT_AUTO}},
-        {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "0"}, {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}}
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "0"}, {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}},
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, InferenceEngine::PluginConfigParams::CPU_THROUGHPUT_AUTO},
+         {InferenceEngine::PluginConfigParams::KEY_CPU_INLINE_CALLBACKS, InferenceEngine::PluginConfigParams::YES}}
 };
 
 const std::vector<std::map<std::string, std::string>> multiConfigs = {
         {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}}
 };
 
+const std::vector<std::map<std::string, std::string>> autoBatchConfigs = {
+        {{ AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(2)"},
+         { AUTO_BATCH_CONFIG_KEY(TIMEOUT) , "10"}}
+};
+
 INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CallbackTests,
         ::testing::Combine(
             ::testing::ValuesIn(netPrecisions),
@@ -36,4 +44,11 @@ INSTANTIATE_TEST_CASE_P(smoke_Multi_BehaviorTests, CallbackTests,
                 ::testing::Values(CommonTestUtils::DEVICE_MULTI),
                 ::testing::ValuesIn(multiConfigs)),
         CallbackTests::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_AutoBatch_BehaviorTests, CallbackTests,
+        ::testing::Combine(
+                ::testing::ValuesIn(netPrecisions),
+                ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+                ::testing::ValuesIn(autoBatchConfigs)),
+        CallbackTests::getTestCaseName);
 }  // namespace
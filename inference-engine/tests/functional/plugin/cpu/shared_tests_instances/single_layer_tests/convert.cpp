@@ -34,4 +34,25 @@ INSTANTIATE_TEST_CASE_P(smoke_ConvertLayerTest, ConvertLayerTest,
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                         ConvertLayerTest::getTestCaseName);
 
+// vectorized pairs with tails which are not multiple of the vector length
+const std::vector<std::vector<size_t>> tailShape = {{2, 3, 5, 7}};
+
+const std::vector<Precision> vectorizedPrecisions = {
+        Precision::U8,
+        Precision::I8,
+        Precision::I32,
+        Precision::I64,
+        Precision::FP32
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ConvertLayerTest_Tails, ConvertLayerTest,
+                        ::testing::Combine(
+                                ::testing::Values(tailShape),
+                                ::testing::ValuesIn(vectorizedPrecisions),
+                                ::testing::ValuesIn(vectorizedPrecisions),
+                                ::testing::Values(Layout::ANY),
+                                ::testing::Values(Layout::ANY),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ConvertLayerTest::getTestCaseName);
+
 }  // namespace
\ No newline at end of file
@@ -50,4 +50,35 @@ INSTANTIATE_TEST_CASE_P(
         GatherLayerTest::getTestCaseName
 );
 
+// enough indices on the innermost axis for vectorized gather of single elements
+const std::vector<std::vector<int>> indicesInnermost = {
+        std::vector<int>{0, 7, 14, 21, 28, 35, 2, 9, 16, 23, 30, 37, 4, 11, 18, 25, 32, 39, 6, 13, 20, 27, 34, 1, 8, 15, 22,
+                29, 36, 3, 10, 17, 24, 31, 38, 5, 12, 19, 26, 33, 0, 7, 14, 21, 28, 35, 2, 9, 16, 23, 30, 37, 4, 11,
+                18, 25, 32, 39, 6, 13, 20, 27, 34, 1, 8, 15, 22, 29, 36, 3},
+};
+const std::vector<std::vector<size_t>> indicesShapesInnermost = {
+        std::vector<size_t>{70},
+        std::vector<size_t>{7, 10}
+};
+
+const auto paramsInnermost = testing::Combine(
+        testing::ValuesIn(indicesInnermost),
+        testing::ValuesIn(indicesShapesInnermost),
+        testing::Values(3),
+        testing::ValuesIn(inputShapes),
+        testing::ValuesIn(netPrecisions),
+        testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+        testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+        testing::Values(InferenceEngine::Layout::ANY),
+        testing::Values(InferenceEngine::Layout::ANY),
+        testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(
+        smoke_GatherInnermost,
+        GatherLayerTest,
+        paramsInnermost,
+        GatherLayerTest::getTestCaseName
+);
+
 }  // namespace
@@ -12,6 +12,7 @@ using namespace LayerTestsDefinitions;
 const std::vector<std::vector<size_t>> inputShapes = {
     {1, 32, 17},
     {1, 37, 9},
+    {2, 4, 1027},
     {1, 16, 5, 8},
     {2, 19, 5, 10},
     {7, 32, 2, 8},
@@ -30,7 +30,9 @@ std::map<std::vector<size_t>, std::map<std::vector<size_t>, std::vector<int>>> a
 };
 //indices should not be random value
 const std::vector<std::vector<size_t>> idxValue = {
-        {0, 2, 4, 6, 1, 3, 5, 7}
+        {0, 2, 4, 6, 1, 3, 5, 7},
+        // runs of consecutive indices
+        {2, 3, 4, 5, 0, 1, 6, 7}
 };
 
 const auto ScatterUpdateCase = ::testing::Combine(
@@ -23,6 +23,7 @@ const std::vector<InferenceEngine::SizeVector> inputShapes2D = {
     InferenceEngine::SizeVector {1, 100},
     InferenceEngine::SizeVector {100, 1},
     InferenceEngine::SizeVector {10, 10},
+    InferenceEngine::SizeVector {3, 1037},
 };
 
 const std::vector<size_t> axis2D = {
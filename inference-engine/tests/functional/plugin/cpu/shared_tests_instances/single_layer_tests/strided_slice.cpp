@@ -60,6 +60,13 @@ std::vector<StridedSliceSpecificParams> ss_only_test_cases = {
                                 { 0, 1 }, { 0, 1 },  { 0, 0 },  { 0, 0 },  { 0, 0 } },
         StridedSliceSpecificParams{ { 5, 5, 5, 5 }, { -1, 0, -1, 0 }, { -50, 0, -60, 0 }, { -1, 1, -1, 1 },
                                 { 0, 0, 0, 0 }, { 0, 1, 0, 1 },  { 0, 0, 0, 0 },  { 0, 0, 0, 0 },  { 0, 0, 0, 0 } },
+        // inner dims are taken entirely, so the copied blocks are merged
+        StridedSliceSpecificParams{ { 2, 12, 100, 64 }, { 0, 0, 10, 0 }, { 0, 0, 60, 0 }, { 1, 1, 1, 1 },
+                                { 1, 1, 0, 1 }, { 1, 1, 0, 1 },  { },  { },  { } },
+        StridedSliceSpecificParams{ { 2, 12, 100, 64 }, { 0, 2, 0, 0 }, { 0, 8, 0, 0 }, { 1, 1, 1, 1 },
+                                { 1, 0, 1, 1 }, { 1, 0, 1, 1 },  { },  { },  { } },
+        StridedSliceSpecificParams{ { 4, 12, 100, 64 }, { 0, 0, 0, 0 }, { 0, 12, 50, 0 }, { 2, 1, 1, 1 },
+                                { 1, 1, 1, 1 }, { 1, 0, 0, 1 },  { },  { },  { } },
 };
 
 INSTANTIATE_TEST_CASE_P(
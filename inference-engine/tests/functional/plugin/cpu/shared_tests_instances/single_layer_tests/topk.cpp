@@ -52,4 +52,44 @@ INSTANTIATE_TEST_CASE_P(smoke_TopK, TopKLayerTest,
                 ::testing::Values(std::vector<size_t>({10, 10, 10})),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         TopKLayerTest::getTestCaseName);
+
+// k is large enough for radix select
+const std::vector<int64_t> largeK = {
+        20,
+        64,
+};
+
+const std::vector<int64_t> largeKAxes = {
+        1,
+        2,
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_LargeK, TopKLayerTest,
+        ::testing::Combine(
+                ::testing::ValuesIn(largeK),
+                ::testing::ValuesIn(largeKAxes),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::Values(InferenceEngine::Precision::FP32),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::Values(std::vector<size_t>({2, 100, 1000})),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
+
+// the axis is split between threads
+INSTANTIATE_TEST_CASE_P(smoke_TopK_LongAxis, TopKLayerTest,
+        ::testing::Combine(
+                ::testing::Values(100),
+                ::testing::Values(0),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::Values(InferenceEngine::Precision::FP32),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::Values(std::vector<size_t>({50000})),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
 }  // namespace
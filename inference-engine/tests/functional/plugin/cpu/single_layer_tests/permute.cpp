@@ -114,6 +114,28 @@ const auto params4D = ::testing::Combine(
 
 INSTANTIATE_TEST_CASE_P(smoke_Permute4D_CPU, PermuteLayerCPUTest, params4D, PermuteLayerCPUTest::getTestCaseName);
 
+// transposed dims are not multiples of the tile size
+const std::vector<std::vector<size_t>> inputShapes4DTails = {
+        {2, 19, 9, 35}
+};
+
+const std::vector<std::vector<size_t>> inputOrder4DTails = {
+        std::vector<size_t>{0, 2, 3, 1},
+        std::vector<size_t>{0, 3, 1, 2},
+        std::vector<size_t>{0, 3, 2, 1},
+        std::vector<size_t>{0, 2, 1, 3},
+};
+
+const auto params4DTails = ::testing::Combine(
+        ::testing::ValuesIn(inputOrder4DTails),
+        ::testing::Values(Precision::FP32),
+        ::testing::ValuesIn(inputShapes4DTails),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::Values(additional_config),
+        ::testing::Values(CPUSpecificParams({nchw}, {}, {}, {})));
+
+INSTANTIATE_TEST_CASE_P(smoke_Permute4DTails_CPU, PermuteLayerCPUTest, params4DTails, PermuteLayerCPUTest::getTestCaseName);
+
 const std::vector<std::vector<size_t>> inputShapes5D = {
         {2, 32, 5, 10, 20}
 };
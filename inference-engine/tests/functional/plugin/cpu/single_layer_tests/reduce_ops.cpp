@@ -250,6 +250,21 @@ const auto params_MultiAxis_5D = testing::Combine(
                 testing::Values(CommonTestUtils::DEVICE_CPU)),
         testing::ValuesIn(filterCPUSpecificParams(cpuParams_5D)));
 
+// rows long enough to be split between threads
+const auto params_InnermostAxes = testing::Combine(
+        testing::Combine(
+            testing::ValuesIn(std::vector<std::vector<int>>{{3}, {2, 3}, {0, 1, 2, 3}}),
+            testing::Values(opTypes[1]),
+            testing::ValuesIn(keepDims),
+            testing::Values(ngraph::helpers::ReductionType::Min, ngraph::helpers::ReductionType::L1),
+            testing::Values(InferenceEngine::Precision::FP32),
+            testing::Values(InferenceEngine::Precision::FP32),
+            testing::Values(InferenceEngine::Precision::FP32),
+            testing::Values(InferenceEngine::Layout::ANY),
+            testing::Values(std::vector<size_t>{1, 2, 3, 8201}),
+            testing::Values(CommonTestUtils::DEVICE_CPU)),
+        testing::Values(emptyCPUSpec));
+
 const auto params_MultiAxisLogical = testing::Combine(
         testing::Combine(
             testing::ValuesIn(axesND),
@@ -327,6 +342,13 @@ INSTANTIATE_TEST_CASE_P(
         ReduceCPULayerTest::getTestCaseName
 );
 
+INSTANTIATE_TEST_CASE_P(
+        smoke_Reduce_InnermostAxes_CPU,
+        ReduceCPULayerTest,
+        params_InnermostAxes,
+        ReduceCPULayerTest::getTestCaseName
+);
+
 INSTANTIATE_TEST_CASE_P(
         smoke_ReduceLogical_ReductionTypes_CPU,
         ReduceCPULayerTest,
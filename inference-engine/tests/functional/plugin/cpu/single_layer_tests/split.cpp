@@ -97,15 +97,9 @@ const auto planarChannels_5D = CPUSpecificParams{{ndhwc}, {ndhwc}, {}, "ref"};
 const auto blocked8_4D = CPUSpecificParams{{nChw8c}, {nChw8c}, {}, "unknown"};
 const auto blocked8_5D = CPUSpecificParams{{nCdhw8c}, {nCdhw8c}, {}, "unknown"};
 
-const auto blocked8_4D_ref = CPUSpecificParams{{nChw8c}, {nChw8c}, {}, "ref"};
-const auto blocked8_5D_ref = CPUSpecificParams{{nCdhw8c}, {nCdhw8c}, {}, "ref"};
-
 const auto blocked16_4D = CPUSpecificParams{{nChw16c}, {nChw16c}, {}, "unknown"};
 const auto blocked16_5D = CPUSpecificParams{{nCdhw16c}, {nCdhw16c}, {}, "unknown"};
 
-const auto blocked16_4D_ref = CPUSpecificParams{{nChw16c}, {nChw16c}, {}, "ref"};
-const auto blocked16_5D_ref = CPUSpecificParams{{nCdhw16c}, {nCdhw16c}, {}, "ref"};
-
 // List of precisions natively supported by mkldnn.
 const std::vector<Precision> netPrecisions = {
         Precision::I8,
@@ -118,7 +112,7 @@ const std::vector<Precision> netPrecisions = {
 INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block8inPlace, SplitLayerCPUTest,
                     ::testing::Combine(
                             ::testing::Values(3),
-                            ::testing::Values(0, 1),
+                            ::testing::Values(0, 1, 2, 3),
                             ::testing::ValuesIn(netPrecisions),
                             ::testing::Values(std::vector<size_t>({3, 24, 24, 9})),
                             ::testing::Values(std::vector<size_t>({})),
@@ -126,21 +120,10 @@ INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block8inPlace, SplitLayerCPUTest,
                             ::testing::Values(planar_4D, planar_4D_ref, planarChannels_4D, blocked8_4D)),
                     SplitLayerCPUTest::getTestCaseName);
 
-INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block8, SplitLayerCPUTest,
-                        ::testing::Combine(
-                                ::testing::Values(3),
-                                ::testing::Values(2, 3),
-                                ::testing::ValuesIn(netPrecisions),
-                                ::testing::Values(std::vector<size_t>({3, 24, 24, 9})),
-                                ::testing::Values(std::vector<size_t>({})),
-                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
-                                ::testing::Values(planar_4D, planar_4D_ref, planarChannels_4D, blocked8_4D_ref)),
-                        SplitLayerCPUTest::getTestCaseName);
-
 INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block16inPlace, SplitLayerCPUTest,
                         ::testing::Combine(
                                 ::testing::Values(4),
-                                ::testing::Values(0, 1),
+                                ::testing::Values(0, 1, 2, 3),
                                 ::testing::ValuesIn(netPrecisions),
                                 ::testing::Values(std::vector<size_t>({4, 64, 32, 12})),
                                 ::testing::Values(std::vector<size_t>({})),
@@ -148,21 +131,10 @@ INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block16inPlace, SplitLayerCPUTest,
                                 ::testing::Values(blocked16_4D)),
                         SplitLayerCPUTest::getTestCaseName);
 
-INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block16, SplitLayerCPUTest,
-                        ::testing::Combine(
-                                ::testing::Values(4),
-                                ::testing::Values(2, 3),
-                                ::testing::ValuesIn(netPrecisions),
-                                ::testing::Values(std::vector<size_t>({4, 64, 32, 12})),
-                                ::testing::Values(std::vector<size_t>({})),
-                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
-                                ::testing::Values(blocked16_4D_ref)),
-                        SplitLayerCPUTest::getTestCaseName);
-
 INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block8inPlace, SplitLayerCPUTest,
                         ::testing::Combine(
                                 ::testing::Values(3),
-                                ::testing::Values(0, 1),
+                                ::testing::Values(0, 1, 2, 3, 4),
                                 ::testing::ValuesIn(netPrecisions),
                                 ::testing::Values(std::vector<size_t>({3, 24, 24, 9, 15})),
                                 ::testing::Values(std::vector<size_t>({})),
@@ -170,21 +142,10 @@ INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block8inPlace, SplitLayerCPUTest,
                                 ::testing::Values(planar_5D, planar_5D_ref, planarChannels_5D, blocked8_5D)),
                         SplitLayerCPUTest::getTestCaseName);
 
-INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block8, SplitLayerCPUTest,
-                        ::testing::Combine(
-                                ::testing::Values(3),
-                                ::testing::Values(2, 3, 4),
-                                ::testing::ValuesIn(netPrecisions),
-                                ::testing::Values(std::vector<size_t>({3, 24, 24, 9, 15})),
-                                ::testing::Values(std::vector<size_t>({})),
-                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
-                                ::testing::Values(planar_5D, planar_5D_ref, planarChannels_5D, blocked8_5D_ref)),
-                        SplitLayerCPUTest::getTestCaseName);
-
 INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block16inPlace, SplitLayerCPUTest,
                         ::testing::Combine(
                                 ::testing::Values(4),
-                                ::testing::Values(0, 1),
+                                ::testing::Values(0, 1, 2, 3, 4),
                                 ::testing::ValuesIn(netPrecisions),
                                 ::testing::Values(std::vector<size_t>({4, 64, 32, 12, 20})),
                                 ::testing::Values(std::vector<size_t>({})),
@@ -192,17 +153,6 @@ INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block16inPlace, SplitLayerCPUTest,
                                 ::testing::Values(blocked16_5D)),
                         SplitLayerCPUTest::getTestCaseName);
 
-INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block16, SplitLayerCPUTest,
-                        ::testing::Combine(
-                                ::testing::Values(4),
-                                ::testing::Values(2, 3, 4),
-                                ::testing::ValuesIn(netPrecisions),
-                                ::testing::Values(std::vector<size_t>({4, 64, 32, 12, 20})),
-                                ::testing::Values(std::vector<size_t>({})),
-                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
-                                ::testing::Values(blocked16_5D_ref)),
-                        SplitLayerCPUTest::getTestCaseName);
-
 INSTANTIATE_TEST_CASE_P(smoke_Split3D, SplitLayerCPUTest,
                         ::testing::Combine(
                                 ::testing::Values(7),
@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <auto_batch/auto_batch_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+    auto softmax = std::make_shared<ngraph::opset1::Softmax>(param, 1);
+    auto result = std::make_shared<ngraph::opset1::Result>(softmax);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+// every request gets its own input, so the results of the swapped batch slots differ
+void fill(InferRequest& req, const std::string& name, float shift) {
+    auto blob = req.GetBlob(name);
+    auto data = blob->buffer().as<float*>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = shift + 0.1f * i;
+}
+
+void checkSoftmax(InferRequest& req, const std::string& inputName, const std::string& outputName) {
+    auto in = req.GetBlob(inputName)->cbuffer().as<const float*>();
+    auto out = req.GetBlob(outputName)->cbuffer().as<const float*>();
+    auto size = req.GetBlob(inputName)->size();
+    float sum = 0.f;
+    for (size_t i = 0; i < size; i++)
+        sum += std::exp(in[i]);
+    for (size_t i = 0; i < size; i++)
+        ASSERT_NEAR(std::exp(in[i]) / sum, out[i], 1e-5f) << "element " << i;
+}
+
+}  // namespace
+
+TEST(AutoBatchCPUTest, AnyRequestsFormBatch) {
+    Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    // the timeout is much longer than the test, so the requests are finished by the batch only
+    auto execNet = ie.LoadNetwork(network, std::string{"BATCH:"} + CommonTestUtils::DEVICE_CPU + "(2)",
+                                  {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "600000"}});
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < 3; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+        fill(requests.back(), inputName, static_cast<float>(i));
+    }
+
+    // the first and the last requests are created for different batched requests of the device
+    requests[0].StartAsync();
+    requests[2].StartAsync();
+    ASSERT_EQ(StatusCode::OK, requests[0].Wait(10000));
+    ASSERT_EQ(StatusCode::OK, requests[2].Wait(10000));
+    checkSoftmax(requests[0], inputName, outputName);
+    checkSoftmax(requests[2], inputName, outputName);
+
+    // the requests are gathered again in another order
+    requests[1].StartAsync();
+    requests[0].StartAsync();
+    ASSERT_EQ(StatusCode::OK, requests[1].Wait(10000));
+    ASSERT_EQ(StatusCode::OK, requests[0].Wait(10000));
+    checkSoftmax(requests[1], inputName, outputName);
+    checkSoftmax(requests[0], inputName, outputName);
+}
+
+TEST(AutoBatchCPUTest, RequestRunsWithoutBatchOnTimeout) {
+    Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNet = ie.LoadNetwork(network, std::string{"BATCH:"} + CommonTestUtils::DEVICE_CPU + "(4)",
+                                  {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "10"}});
+    auto req = execNet.CreateInferRequest();
+    fill(req, inputName, 1.f);
+
+    // a single request never fills the batch
+    req.Infer();
+    checkSoftmax(req, inputName, outputName);
+    fill(req, inputName, 2.f);
+    req.Infer();
+    checkSoftmax(req, inputName, outputName);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_compound_blob.h>
+#include <blob_factory.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeReluNetwork(Precision inPrecision) {
+    CNNNetwork network(ngraph::builder::subgraph::makeSingleRelu({3, 4, 5, 6}));
+    network.getInputsInfo().begin()->second->setPrecision(inPrecision);
+    return network;
+}
+
+void compareBatchedWithContiguous(Precision inPrecision) {
+    Core ie;
+    auto network = makeReluNetwork(inPrecision);
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    const auto &inDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+    auto contiguous = FuncTestUtils::createAndFillBlob(inDesc);
+    auto itemDesc = inDesc;
+    itemDesc.getDims()[0] = 1;
+    const size_t itemSize = contiguous->byteSize() / inDesc.getDims()[0];
+    std::vector<Blob::Ptr> items;
+    for (size_t i = 0; i < inDesc.getDims()[0]; i++) {
+        auto item = make_blob_with_precision(itemDesc);
+        item->allocate();
+        std::memcpy(item->buffer().as<uint8_t *>(), contiguous->cbuffer().as<const uint8_t *>() + i * itemSize, itemSize);
+        items.push_back(item);
+    }
+
+    auto request = execNet.CreateInferRequest();
+    request.SetBlob(inputName, make_shared_blob<BatchedBlob>(items));
+    request.Infer();
+    auto output = request.GetBlob(outputName);
+
+    auto refRequest = execNet.CreateInferRequest();
+    refRequest.SetBlob(inputName, contiguous);
+    refRequest.Infer();
+    FuncTestUtils::compareBlobs(output, refRequest.GetBlob(outputName));
+}
+
+}  // namespace
+
+TEST(BatchedBlobCPUTest, BatchedInputMatchesContiguousInput) {
+    compareBatchedWithContiguous(Precision::FP32);
+}
+
+TEST(BatchedBlobCPUTest, BatchedInputWithConversionMatchesContiguousInput) {
+    compareBatchedWithContiguous(Precision::U8);
+}
+
+TEST(BatchedBlobCPUTest, BatchedInputOfWrongSizeIsRejected) {
+    Core ie;
+    auto network = makeReluNetwork(Precision::FP32);
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto itemDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+    itemDesc.getDims()[0] = 1;
+    std::vector<Blob::Ptr> items = {FuncTestUtils::createAndFillBlob(itemDesc), FuncTestUtils::createAndFillBlob(itemDesc)};
+
+    auto request = execNet.CreateInferRequest();
+    ASSERT_THROW(request.SetBlob(network.getInputsInfo().begin()->first, make_shared_blob<BatchedBlob>(items)),
+                 details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <exec_graph_info.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,        // Input shape
+        std::vector<size_t>,        // Broadcast input shape
+        bool,                       // Use Tile instead of Broadcast
+        std::string                 // Device name
+> BroadcastEltwiseTuple;
+
+// Mask which is broadcast to the input shape and read by several Eltwise nodes, like attention masks and position biases.
+// CPU plugin does not materialize the broadcast output, the Eltwise nodes read the mask with zero strides.
+class BroadcastEltwiseTest : public testing::WithParamInterface<BroadcastEltwiseTuple>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<BroadcastEltwiseTuple> &obj) {
+        std::vector<size_t> inputShape, maskShape;
+        bool useTile;
+        std::string targetName;
+        std::tie(inputShape, maskShape, useTile, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "MS=" << CommonTestUtils::vec2str(maskShape) << "_";
+        results << (useTile ? "Tile" : "Broadcast") << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        std::vector<size_t> inputShape, maskShape;
+        bool useTile;
+        std::tie(inputShape, maskShape, useTile, targetDevice) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape, maskShape});
+        std::shared_ptr<ngraph::Node> mask;
+        if (useTile) {
+            std::vector<int64_t> repeats(inputShape.size());
+            for (size_t i = 0; i < inputShape.size(); i++) {
+                repeats[i] = maskShape[i] == 1 ? inputShape[i] : 1;
+            }
+            auto repeatsNode = ngraph::builder::makeConstant(ngraph::element::i64, {repeats.size()}, repeats);
+            mask = std::make_shared<ngraph::opset1::Tile>(params[1], repeatsNode);
+        } else {
+            auto shapeNode = ngraph::builder::makeConstant(ngraph::element::i64, {inputShape.size()},
+                                                           std::vector<int64_t>(inputShape.begin(), inputShape.end()));
+            mask = std::make_shared<ngraph::opset1::Broadcast>(params[1], shapeNode);
+        }
+
+        auto masked = ngraph::builder::makeEltwise(params[0], mask, ngraph::helpers::EltwiseTypes::ADD);
+        auto scaled = ngraph::builder::makeEltwise(params[0], mask, ngraph::helpers::EltwiseTypes::MULTIPLY);
+        auto sum = ngraph::builder::makeEltwise(masked, scaled, ngraph::helpers::EltwiseTypes::ADD);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(sum)};
+        function = std::make_shared<ngraph::Function>(results, params, "broadcast_eltwise");
+    }
+
+    void CheckBroadcastIsNotMaterialized() {
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, function);
+        for (const auto &node : function->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE(rtInfo.end(), it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, value);
+            ASSERT_NE("Tile", value->get()) << node->get_friendly_name();
+            ASSERT_NE("Broadcast", value->get()) << node->get_friendly_name();
+        }
+    }
+};
+
+TEST_P(BroadcastEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckBroadcastIsNotMaterialized();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_BroadcastEltwise, BroadcastEltwiseTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{2, 4, 16, 16}),
+                                ::testing::Values(std::vector<size_t>{1, 1, 16, 16},
+                                                  std::vector<size_t>{2, 1, 1, 16}),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        BroadcastEltwiseTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
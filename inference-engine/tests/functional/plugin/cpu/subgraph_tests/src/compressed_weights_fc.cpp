@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+const size_t batch = 2;
+
+CNNNetwork makeFCNetwork(size_t inChannels, size_t outChannels) {
+    // integers in [-8, 7] range, every row has both bounds, so the values are exact in 8 and 4 bits
+    std::vector<float> weights(outChannels * inChannels);
+    for (size_t r = 0; r < outChannels; r++)
+        for (size_t c = 0; c < inChannels; c++)
+            weights[r * inChannels + c] = static_cast<float>((r * 7 + c * 3) % 16) - 8.0f;
+    std::vector<float> biases(outChannels);
+    for (size_t i = 0; i < biases.size(); i++)
+        biases[i] = 0.25f * static_cast<float>(i);
+
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{batch, inChannels});
+    auto weightsNode = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{outChannels, inChannels}, weights);
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(param, weightsNode, false, true);
+    auto biasesNode = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, outChannels}, biases);
+    auto add = std::make_shared<ngraph::opset1::Add>(matMul, biasesNode);
+    auto result = std::make_shared<ngraph::opset1::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+std::vector<float> infer(InferRequest& request, const std::string& inputName, const std::string& outputName,
+                         const std::vector<float>& input) {
+    auto inBlob = request.GetBlob(inputName);
+    std::copy(input.begin(), input.end(), inBlob->buffer().as<float *>());
+    request.Infer();
+
+    auto outBlob = request.GetBlob(outputName);
+    const float *out = outBlob->cbuffer().as<const float *>();
+    return std::vector<float>(out, out + outBlob->size());
+}
+
+}  // namespace
+
+// compression, input channels, output channels
+using CompressedWeightsFCParams = std::tuple<std::string, size_t, size_t>;
+
+class CompressedWeightsFCTest : public ::testing::TestWithParam<CompressedWeightsFCParams> {};
+
+TEST_P(CompressedWeightsFCTest, MatchesUncompressed) {
+    std::string compression;
+    size_t inChannels, outChannels;
+    std::tie(compression, inChannels, outChannels) = GetParam();
+
+    Core ie;
+    auto network = makeFCNetwork(inChannels, outChannels);
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+
+    std::vector<float> input(batch * inChannels);
+    for (size_t i = 0; i < input.size(); i++)
+        input[i] = static_cast<float>(i % 11) * 0.125f - 0.5f;
+
+    auto denseNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto compressedNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                        {{PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, compression},
+                                         {PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}});
+
+    auto denseRequest = denseNet.CreateInferRequest();
+    auto compressedRequest = compressedNet.CreateInferRequest();
+    auto expected = infer(denseRequest, inputName, outputName, input);
+    auto actual = infer(compressedRequest, inputName, outputName, input);
+
+    std::string execType;
+    for (auto&& counter : compressedRequest.GetPerformanceCounts()) {
+        if (std::string(counter.second.layer_type) == "FullyConnected")
+            execType = counter.second.exec_type;
+    }
+    ASSERT_NE(std::string::npos, execType.find("compressed"));
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_NEAR(expected[i], actual[i], 1e-3f * std::max(1.0f, std::abs(expected[i]))) << "at index " << i;
+}
+
+// the shapes have the rows and columns out of the vectorized blocks of the kernels as well
+INSTANTIATE_TEST_CASE_P(smoke_CompressedWeightsFC, CompressedWeightsFCTest,
+                        ::testing::Combine(
+                            ::testing::Values(PluginConfigParams::CPU_WEIGHTS_U8, PluginConfigParams::CPU_WEIGHTS_I4),
+                            ::testing::Values(17, 33, 100),
+                            ::testing::Values(2, 20, 22)));
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,78 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::Precision, // Input precision
+        std::ptrdiff_t,             // Convolution padding
+        std::string                 // Device name
+> ConvInputFusionTuple;
+
+// Image normalization (mean, scale) in front of the first Convolution, which CPU plugin folds into its weights and bias
+class ConvInputFusionTest : public testing::WithParamInterface<ConvInputFusionTuple>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConvInputFusionTuple> &obj) {
+        InferenceEngine::Precision inputPrecision;
+        std::ptrdiff_t pad;
+        std::string targetName;
+        std::tie(inputPrecision, pad, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "inPRC=" << inputPrecision.name() << "_";
+        results << "pad=" << pad << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        threshold = 0.1f;
+
+        std::ptrdiff_t pad;
+        std::tie(inPrc, pad, targetDevice) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 3, 32, 32}});
+        auto mean = ngraph::builder::makeConstant(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, std::vector<float>{100.f, 120.f, 110.f});
+        auto scale = ngraph::builder::makeConstant(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, std::vector<float>{0.02f, 0.01f, 0.015f});
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(params[0], mean);
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(sub, scale);
+        auto conv = ngraph::builder::makeConvolution(mul, ngraph::element::f32, {3, 3}, {2, 2}, {pad, pad}, {pad, pad}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 16);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, params, "conv_input_fusion");
+    }
+};
+
+TEST_P(ConvInputFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<std::ptrdiff_t> pads = {0, 1};
+
+INSTANTIATE_TEST_CASE_P(smoke_ConvInputFusion, ConvInputFusionTest,
+                        ::testing::Combine(
+                                ::testing::Values(InferenceEngine::Precision::U8, InferenceEngine::Precision::FP32),
+                                ::testing::ValuesIn(pads),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ConvInputFusionTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
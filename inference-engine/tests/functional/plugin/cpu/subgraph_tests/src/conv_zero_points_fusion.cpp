@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <exec_graph_info.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,        // Input shape
+        bool,                       // Asymmetric quantization of weights
+        std::string                 // Device name
+> ConvZeroPointsFusionTuple;
+
+// Convolution of asymmetrically quantized activations, low precision transformations put per-tensor zero points of
+// u8 activations (and i8 weights) to Subtract nodes, which CPU plugin folds into the convolution compensation.
+// The result is compared with the reference of the original FakeQuantize network, where nothing is fused.
+class ConvZeroPointsFusionTest : public testing::WithParamInterface<ConvZeroPointsFusionTuple>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConvZeroPointsFusionTuple> &obj) {
+        std::vector<size_t> inputShape;
+        bool asymmetricWeights;
+        std::string targetName;
+        std::tie(inputShape, asymmetricWeights, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "weights=" << (asymmetricWeights ? "asymmetric" : "symmetric") << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        threshold = 0.1f;
+
+        std::vector<size_t> inputShape;
+        bool asymmetricWeights;
+        std::tie(inputShape, asymmetricWeights, targetDevice) = this->GetParam();
+
+        // zero point of the activations is 50: the range is not symmetric around zero
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto dataFq = ngraph::builder::makeFakeQuantize(params[0], ngraph::element::f32, 256, {1, 1, 1, 1},
+                                                        {-0.5f}, {2.05f}, {-0.5f}, {2.05f});
+
+        const size_t outChannels = 16;
+        const ngraph::Shape weightsShape{outChannels, inputShape[1], 3, 3};
+        std::vector<float> weightsData(ngraph::shape_size(weightsShape));
+        for (size_t i = 0; i < weightsData.size(); i++)
+            weightsData[i] = static_cast<float>(static_cast<int>(i % 21) - 10) / 10.f;
+        auto weights = ngraph::builder::makeConstant(ngraph::element::f32, weightsShape, weightsData);
+        const float weightsLow = asymmetricWeights ? -0.8f : -1.27f;
+        const float weightsHigh = asymmetricWeights ? 1.75f : 1.27f;
+        auto weightsFq = ngraph::builder::makeFakeQuantize(weights, ngraph::element::f32, asymmetricWeights ? 256 : 255,
+                                                           {1, 1, 1, 1}, {weightsLow}, {weightsHigh},
+                                                           {weightsLow}, {weightsHigh});
+
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(dataFq, weightsFq, ngraph::Strides{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::Strides{1, 1});
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, params, "conv_zero_points_fusion");
+    }
+
+    static std::string getLayerType(const std::shared_ptr<ngraph::Node> &node) {
+        const auto &rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        IE_ASSERT(rtInfo.end() != it);
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        IE_ASSERT(nullptr != value);
+        return value->get();
+    }
+
+    // the zero points Subtract nodes are dropped, so nothing but the convolution works with the quantized inputs
+    void CheckZeroPointsAreFused() {
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, function);
+        size_t convolutions = 0;
+        for (const auto &node : function->get_ops()) {
+            if (getLayerType(node) != "Convolution")
+                continue;
+            convolutions++;
+            for (const auto &input : node->input_values()) {
+                ASSERT_NE("Eltwise", getLayerType(input.get_node_shared_ptr())) << node->get_friendly_name();
+            }
+        }
+        ASSERT_EQ(1u, convolutions);
+    }
+};
+
+TEST_P(ConvZeroPointsFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckZeroPointsAreFused();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_ConvZeroPointsFusion, ConvZeroPointsFusionTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{1, 3, 16, 16},
+                                                  std::vector<size_t>{2, 8, 10, 10}),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ConvZeroPointsFusionTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
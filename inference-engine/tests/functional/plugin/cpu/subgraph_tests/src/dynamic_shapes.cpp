@@ -0,0 +1,108 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr makeInput(const SizeVector& dims) {
+    auto blob = make_shared_blob<float>({Precision::FP32, dims, Layout::NCHW});
+    blob->allocate();
+    auto data = blob->buffer().as<float*>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = (i % 2) ? -1.f * i : 1.f * i;
+    return blob;
+}
+
+const std::map<std::string, std::string> dynamicShapesConfig = {
+    {PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES}
+};
+
+}  // namespace
+
+TEST(DynamicShapesTest, InferWithSmallerInputShapes) {
+    Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, dynamicShapesConfig);
+    auto req = execNet.CreateInferRequest();
+
+    for (const SizeVector& dims : {SizeVector{1, 3, 8, 8}, SizeVector{1, 3, 16, 16}, SizeVector{1, 3, 8, 8}, SizeVector{1, 3, 5, 16}}) {
+        auto input = makeInput(dims);
+        req.SetBlob(inputName, input);
+        req.Infer();
+
+        auto output = req.GetBlob(outputName);
+        ASSERT_EQ(dims, output->getTensorDesc().getDims());
+        auto in = input->cbuffer().as<const float*>();
+        auto out = output->cbuffer().as<const float*>();
+        for (size_t i = 0; i < output->size(); i++)
+            ASSERT_EQ(std::max(in[i], 0.f), out[i]) << "element " << i;
+    }
+
+    // network shape does not use the cache, 8x8 is compiled once
+    ASSERT_EQ(1u, execNet.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_HITS)).as<unsigned int>());
+    ASSERT_EQ(2u, execNet.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_MISSES)).as<unsigned int>());
+}
+
+TEST(DynamicShapesTest, CacheSizeLimitsCompiledShapes) {
+    Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto config = dynamicShapesConfig;
+    config[PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE] = "1";
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    auto req = execNet.CreateInferRequest();
+
+    for (const SizeVector& dims : {SizeVector{1, 3, 8, 8}, SizeVector{1, 3, 4, 4}, SizeVector{1, 3, 8, 8}}) {
+        req.SetBlob(inputName, makeInput(dims));
+        req.Infer();
+    }
+
+    ASSERT_EQ(0u, execNet.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_HITS)).as<unsigned int>());
+    ASSERT_EQ(3u, execNet.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_MISSES)).as<unsigned int>());
+}
+
+TEST(DynamicShapesTest, SetBlobThrowsForShapesOutOfBounds) {
+    Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto req = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, dynamicShapesConfig).CreateInferRequest();
+
+    ASSERT_THROW(req.SetBlob(inputName, makeInput({1, 3, 32, 16})), details::InferenceEngineException);
+    ASSERT_THROW(req.SetBlob(inputName, makeInput({1, 3, 16})), details::InferenceEngineException);
+}
+
+TEST(DynamicShapesTest, SetBlobThrowsForOtherShapesWithoutConfig) {
+    Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto req = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+
+    ASSERT_THROW(req.SetBlob(inputName, makeInput({1, 3, 8, 8})), details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
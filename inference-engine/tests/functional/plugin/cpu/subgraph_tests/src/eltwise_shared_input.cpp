@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using ngraph::helpers::EltwiseTypes;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,        // Input shape
+        std::vector<EltwiseTypes>,  // Eltwise operations applied to chain and the network input
+        std::string                 // Device name
+> EltwiseSharedInputTuple;
+
+// Eltwise chain which uses the network input again on every step, like residual connections or x * f(x) activations.
+// CPU plugin doesn't fuse the Eltwise nodes which share an input, the results of such chains are checked.
+class EltwiseSharedInputTest : public testing::WithParamInterface<EltwiseSharedInputTuple>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EltwiseSharedInputTuple> &obj) {
+        std::vector<size_t> inputShape;
+        std::vector<EltwiseTypes> eltwiseOpTypes;
+        std::string targetName;
+        std::tie(inputShape, eltwiseOpTypes, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        for (int i = 0; i < eltwiseOpTypes.size(); i++) {
+            results << "Op" << std::to_string(i) << "=" << eltwiseOpTypes[i] << "_";
+        }
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() {
+        threshold = 0.1f;
+
+        std::vector<size_t> inputShape;
+        std::vector<EltwiseTypes> eltwiseOpTypes;
+        std::tie(inputShape, eltwiseOpTypes, targetDevice) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        std::vector<size_t> constShape(inputShape.size(), 1);
+        constShape[1] = inputShape[1];
+        auto scale = ngraph::builder::makeConstant(ngraph::element::f32, ngraph::Shape{constShape}, std::vector<float>{}, true);
+
+        std::shared_ptr<ngraph::Node> chain = ngraph::builder::makeEltwise(params[0], scale, EltwiseTypes::MULTIPLY);
+        for (auto opType : eltwiseOpTypes) {
+            chain = ngraph::builder::makeEltwise(chain, params[0], opType);
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(chain)};
+        function = std::make_shared<ngraph::Function>(results, params, "eltwise_shared_input");
+    }
+};
+
+TEST_P(EltwiseSharedInputTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+std::vector<std::vector<size_t>> inputShapes = {
+        {1, 16, 5, 7},
+        {2, 3, 10},
+        {1, 64}
+};
+
+std::vector<std::vector<EltwiseTypes>> eltwiseOps = {
+        { EltwiseTypes::ADD },
+        { EltwiseTypes::ADD, EltwiseTypes::MULTIPLY },
+        { EltwiseTypes::SUBTRACT, EltwiseTypes::MULTIPLY, EltwiseTypes::ADD },
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_EltwiseSharedInput, EltwiseSharedInputTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::ValuesIn(eltwiseOps),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EltwiseSharedInputTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
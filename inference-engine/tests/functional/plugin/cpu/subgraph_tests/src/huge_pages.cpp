@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+// 4 MB of weights, so they are large enough to be backed by huge pages
+CNNNetwork makeMatMulNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1024});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1024, 1024},
+                                                    std::vector<float>(1024 * 1024, 0.01f));
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(param, weights, false, true);
+    auto result = std::make_shared<ngraph::opset1::Result>(matMul);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr infer(ExecutableNetwork& execNet, const CNNNetwork& network) {
+    auto request = execNet.CreateInferRequest();
+    for (auto&& input : network.getInputsInfo()) {
+        auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc());
+        request.SetBlob(input.first, blob);
+    }
+    request.Infer();
+    return request.GetBlob(network.getOutputsInfo().begin()->first);
+}
+
+}  // namespace
+
+TEST(HugePagesTest, ReportsFractionAndKeepsResults) {
+    Core ie;
+    auto network = makeMatMulNetwork();
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::YES}});
+    auto refExecNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    auto metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_HUGE_PAGES_FRACTION)));
+
+    auto output = infer(execNet, network);
+    auto refOutput = infer(refExecNet, network);
+    FuncTestUtils::compareBlobs(output, refOutput);
+
+    auto fraction = execNet.GetMetric(METRIC_KEY(CPU_HUGE_PAGES_FRACTION)).as<float>();
+    ASSERT_GE(fraction, 0.f);
+    ASSERT_LE(fraction, 1.f);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
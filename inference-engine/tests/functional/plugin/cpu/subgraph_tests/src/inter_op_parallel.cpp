@@ -0,0 +1,80 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+// Inception-like block: several independent branches of small layers joined by Concat
+CNNNetwork makeBranchedNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8, 16, 16});
+    ngraph::OutputVector branches;
+    for (size_t i = 0; i < 4; i++) {
+        std::shared_ptr<ngraph::Node> branch = param;
+        for (size_t j = 0; j <= i; j++) {
+            auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 8, 1, 1},
+                                                          std::vector<float>(8, 0.5f + i + j));
+            branch = std::make_shared<ngraph::opset1::Multiply>(branch, scale);
+            branch = std::make_shared<ngraph::opset1::Sigmoid>(branch);
+        }
+        branches.push_back(branch);
+    }
+    auto concat = std::make_shared<ngraph::opset1::Concat>(branches, 1);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(concat);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+std::vector<float> infer(const std::map<std::string, std::string>& config) {
+    Core ie;
+    auto network = makeBranchedNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto req = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config).CreateInferRequest();
+
+    auto input = req.GetBlob(inputName);
+    auto data = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        data[i] = 0.01f * static_cast<float>(i % 200) - 1.f;
+
+    std::vector<float> result;
+    for (int iteration = 0; iteration < 3; iteration++) {
+        req.Infer();
+        auto output = req.GetBlob(outputName);
+        auto out = output->cbuffer().as<const float*>();
+        if (result.empty()) {
+            result.assign(out, out + output->size());
+        } else {
+            for (size_t i = 0; i < result.size(); i++)
+                EXPECT_EQ(result[i], out[i]) << "iteration " << iteration << ", element " << i;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(InterOpParallelTest, ResultsMatchSequentialExecution) {
+    auto expected = infer({{PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::NO}});
+    auto actual = infer({{PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::YES}});
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_EQ(expected[i], actual[i]) << "element " << i;
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+// Convolution output is usually blocked, while the second input of Multiply and the network output are planar,
+// so the planar Multiply needs a single reorder of the convolution output instead of two reorders around it
+CNNNetwork makeConvMultiplyNetwork() {
+    auto shape = ngraph::Shape{1, 16, 14, 14};
+    auto param0 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    auto param1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16, 16, 3, 3}, std::vector<float>(16 * 16 * 3 * 3, 0.1f));
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(param0, weights, ngraph::Strides{1, 1},
+                                                              ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(conv, param1);
+    auto result = std::make_shared<ngraph::opset1::Result>(multiply);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param0, param1}));
+}
+
+// inputs are filled with the same random values on each call
+Blob::Ptr infer(ExecutableNetwork& execNet, const CNNNetwork& network) {
+    auto request = execNet.CreateInferRequest();
+    for (auto&& input : network.getInputsInfo()) {
+        auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc());
+        request.SetBlob(input.first, blob);
+    }
+    request.Infer();
+    return request.GetBlob(network.getOutputsInfo().begin()->first);
+}
+
+}  // namespace
+
+TEST(LayoutPropagationTest, ReordersNumMetricIsReported) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeConvMultiplyNetwork(), CommonTestUtils::DEVICE_CPU);
+
+    auto metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_REORDERS_NUM)));
+    ASSERT_NO_THROW(execNet.GetMetric(METRIC_KEY(CPU_REORDERS_NUM)).as<unsigned int>());
+}
+
+TEST(LayoutPropagationTest, DoesNotIncreaseReordersNum) {
+    Core ie;
+    auto network = makeConvMultiplyNetwork();
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_LAYOUT_PROPAGATION, PluginConfigParams::YES}});
+    auto localExecNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                       {{PluginConfigParams::KEY_CPU_LAYOUT_PROPAGATION, PluginConfigParams::NO}});
+
+    auto reordersNum = execNet.GetMetric(METRIC_KEY(CPU_REORDERS_NUM)).as<unsigned int>();
+    auto localReordersNum = localExecNet.GetMetric(METRIC_KEY(CPU_REORDERS_NUM)).as<unsigned int>();
+    ASSERT_LE(reordersNum, localReordersNum);
+
+    auto output = infer(execNet, network);
+    auto localOutput = infer(localExecNet, network);
+    FuncTestUtils::compareBlobs(output, localOutput);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
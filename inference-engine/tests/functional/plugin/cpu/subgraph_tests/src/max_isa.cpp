@@ -0,0 +1,67 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeConvNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 14, 14});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{16, 16, 3, 3}, std::vector<float>(16 * 16 * 3 * 3, 0.1f));
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(param, weights, ngraph::Strides{1, 1},
+                                                              ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+    conv->set_friendly_name("conv");
+    auto result = std::make_shared<ngraph::opset1::Result>(conv);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+}  // namespace
+
+TEST(MaxIsaTest, NodesIsaMetricIsReported) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeConvNetwork(), CommonTestUtils::DEVICE_CPU);
+
+    auto metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_NODES_ISA)));
+
+    auto nodesIsa = execNet.GetMetric(METRIC_KEY(CPU_NODES_ISA)).as<std::map<std::string, std::string>>();
+    ASSERT_NE(nodesIsa.end(), nodesIsa.find("conv"));
+    ASSERT_FALSE(nodesIsa["conv"].empty());
+}
+
+TEST(MaxIsaTest, PerformanceWarningsAreEmptyForFP32Network) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeConvNetwork(), CommonTestUtils::DEVICE_CPU);
+
+    auto metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_PERFORMANCE_WARNINGS)));
+    ASSERT_TRUE(execNet.GetMetric(METRIC_KEY(CPU_PERFORMANCE_WARNINGS)).as<std::vector<std::string>>().empty());
+}
+
+TEST(MaxIsaTest, ConvolutionRespectsMaxIsa) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeConvNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_MAX_ISA, PluginConfigParams::CPU_ISA_SSE42}});
+
+    auto nodesIsa = execNet.GetMetric(METRIC_KEY(CPU_NODES_ISA)).as<std::map<std::string, std::string>>();
+    ASSERT_NE(nodesIsa.end(), nodesIsa.find("conv"));
+    for (auto&& isa : {"avx512_vnni", "avx512", "avx2", "avx"})
+        ASSERT_NE(isa, nodesIsa["conv"]);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
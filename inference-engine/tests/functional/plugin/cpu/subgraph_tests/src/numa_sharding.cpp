@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+// 2 MB table of 4096 rows, so it is sharded with 1 MB threshold
+std::shared_ptr<ngraph::opset3::Constant> makeTable() {
+    std::vector<float> values(4096 * 128);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = static_cast<float>(i % 1021) / 1021.f;
+    return ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{4096, 128}, values);
+}
+
+std::vector<int32_t> makeIndices(size_t count) {
+    std::vector<int32_t> indices(count);
+    for (size_t i = 0; i < count; i++)
+        indices[i] = static_cast<int32_t>((i * 977) % 4096);
+    return indices;
+}
+
+CNNNetwork makeGatherNetwork() {
+    auto indices = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{64});
+    auto gather = std::make_shared<ngraph::opset3::Gather>(
+        makeTable(), indices, ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0}));
+    auto result = std::make_shared<ngraph::opset3::Result>(gather);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{indices}));
+}
+
+CNNNetwork makeEmbeddingBagNetwork() {
+    auto indices = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{16, 8});
+    auto bag = std::make_shared<ngraph::opset3::EmbeddingBagPackedSum>(makeTable(), indices);
+    auto result = std::make_shared<ngraph::opset3::Result>(bag);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{indices}));
+}
+
+std::vector<Blob::Ptr> inferAll(ExecutableNetwork& execNet, const CNNNetwork& network) {
+    auto input = network.getInputsInfo().begin();
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < 4; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+        auto blob = make_shared_blob<int32_t>(input->second->getTensorDesc());
+        blob->allocate();
+        auto indices = makeIndices(blob->size());
+        std::copy(indices.begin(), indices.end(), blob->buffer().as<int32_t*>());
+        requests.back().SetBlob(input->first, blob);
+        requests.back().StartAsync();
+    }
+    std::vector<Blob::Ptr> outputs;
+    for (auto& request : requests) {
+        request.Wait(IInferRequest::WaitMode::RESULT_READY);
+        outputs.push_back(request.GetBlob(network.getOutputsInfo().begin()->first));
+    }
+    return outputs;
+}
+
+void checkShardedResults(const CNNNetwork& network) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_NUMA_SHARDING_THRESHOLD, "1"},
+                                   {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, PluginConfigParams::CPU_THROUGHPUT_NUMA}});
+    auto refExecNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    auto refOutput = inferAll(refExecNet, network).front();
+    for (auto&& output : inferAll(execNet, network))
+        FuncTestUtils::compareBlobs(output, refOutput);
+}
+
+}  // namespace
+
+TEST(NumaShardingTest, GatherKeepsResults) {
+    checkShardedResults(makeGatherNetwork());
+}
+
+TEST(NumaShardingTest, EmbeddingBagKeepsResults) {
+    checkShardedResults(makeEmbeddingBagNetwork());
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,87 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeNetwork() {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 16, 64, 64}});
+    auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 32);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, params));
+}
+
+long long totalRealTime(const InferRequest& req) {
+    long long total = 0;
+    for (auto&& counter : req.GetPerformanceCounts())
+        total += counter.second.realTime_uSec;
+    return total;
+}
+
+}  // namespace
+
+TEST(PerfCountSamplingCPUTest, NodesAreNotTimedWithoutPerfCount) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    auto req = execNet.CreateInferRequest();
+    req.Infer();
+
+    ASSERT_EQ(0, totalRealTime(req));
+}
+
+TEST(PerfCountSamplingCPUTest, SampledInferenceIsReported) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES},
+                                   {PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD, "100"}});
+    ASSERT_EQ("100", execNet.GetConfig(PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD).as<std::string>());
+    auto req = execNet.CreateInferRequest();
+    for (int i = 0; i < 3; i++)
+        req.Infer();
+
+    ASSERT_GT(totalRealTime(req), 0);
+}
+
+TEST(PerfCountSamplingCPUTest, WindowCollectsCountersOfLoadedNetwork) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    auto req = execNet.CreateInferRequest();
+    req.Infer();
+    ASSERT_EQ(0, totalRealTime(req));
+
+    execNet.SetConfig({{PluginConfigParams::KEY_CPU_PERF_COUNT_WINDOW, "60000"}});
+    req.Infer();
+    ASSERT_GT(totalRealTime(req), 0);
+
+    // PERF_COUNT can be enabled at runtime as well
+    execNet.SetConfig({{PluginConfigParams::KEY_CPU_PERF_COUNT_WINDOW, "0"},
+                       {PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}});
+    ASSERT_EQ(PluginConfigParams::YES, execNet.GetConfig(PluginConfigParams::KEY_PERF_COUNT).as<std::string>());
+}
+
+TEST(PerfCountSamplingCPUTest, WrongValuesAreRejected) {
+    Core ie;
+    ASSERT_THROW(ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                {{PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD, "0"}}), details::InferenceEngineException);
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    ASSERT_THROW(execNet.SetConfig({{PluginConfigParams::KEY_CPU_PERF_COUNT_WINDOW, "-1"}}), details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
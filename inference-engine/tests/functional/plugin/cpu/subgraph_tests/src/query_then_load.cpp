@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 8, 8});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4, 3, 3, 3},
+                                                    std::vector<float>(4 * 3 * 3 * 3, 0.1f));
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(param, weights, ngraph::Strides{1, 1},
+                                                              ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                              ngraph::Strides{1, 1});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr infer(ExecutableNetwork& execNet, const Blob::Ptr& input) {
+    auto request = execNet.CreateInferRequest();
+    request.SetBlob(execNet.GetInputsInfo().begin()->first, input);
+    request.Infer();
+    return request.GetBlob(execNet.GetOutputsInfo().begin()->first);
+}
+
+}  // namespace
+
+TEST(QueryThenLoadTest, LoadAfterQueryKeepsResults) {
+    Core ie;
+    auto network = makeNetwork();
+    auto refExecNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+
+    auto queryResult = ie.QueryNetwork(network, CommonTestUtils::DEVICE_CPU);
+    ASSERT_FALSE(queryResult.supportedLayersMap.empty());
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+    FuncTestUtils::compareBlobs(infer(execNet, input), infer(refExecNet, input));
+}
+
+TEST(QueryThenLoadTest, LoadAfterQueryUsesNewInputPrecision) {
+    Core ie;
+    auto network = makeNetwork();
+    ie.QueryNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ(Precision::U8, execNet.GetInputsInfo().begin()->second->getPrecision());
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+void inferAndCheck(ExecutableNetwork& execNet, float value) {
+    auto request = execNet.CreateInferRequest();
+    auto inBlob = request.GetBlob(execNet.GetInputsInfo().begin()->first);
+    auto in = inBlob->buffer().as<float *>();
+    std::fill(in, in + inBlob->size(), value);
+    request.StartAsync();
+    ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+
+    auto outBlob = request.GetBlob(execNet.GetOutputsInfo().begin()->first);
+    const float *out = outBlob->cbuffer().as<const float *>();
+    for (size_t i = 0; i < outBlob->size(); i++)
+        ASSERT_EQ(std::max(value, 0.0f), out[i]);
+}
+
+}  // namespace
+
+TEST(RequestDeadlineCPUTest, RequestsStartedInTimeAreExecuted) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(CNNNetwork(ngraph::builder::subgraph::makeSingleRelu()), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_REQUEST_DEADLINE, "10000"}});
+    inferAndCheck(execNet, -1.0f);
+
+    ASSERT_NO_THROW(execNet.SetConfig({{PluginConfigParams::KEY_REQUEST_DEADLINE, Parameter{std::string{"20000"}}}}));
+    ASSERT_EQ(std::string{"20000"}, execNet.GetConfig(PluginConfigParams::KEY_REQUEST_DEADLINE).as<std::string>());
+    inferAndCheck(execNet, 2.0f);
+}
+
+TEST(RequestDeadlineCPUTest, MultiRequestsStartedInTimeAreExecuted) {
+    Core ie;
+    CNNNetwork network(ngraph::builder::subgraph::makeSingleRelu());
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_MULTI,
+                                  {{MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES, CommonTestUtils::DEVICE_CPU},
+                                   {PluginConfigParams::KEY_REQUEST_DEADLINE, "10000"}});
+    inferAndCheck(execNet, -1.0f);
+
+    ASSERT_NO_THROW(execNet.SetConfig({{PluginConfigParams::KEY_REQUEST_DEADLINE, Parameter{std::string{"20000"}}}}));
+    ASSERT_EQ(std::string{"20000"}, execNet.GetConfig(PluginConfigParams::KEY_REQUEST_DEADLINE).as<std::string>());
+    inferAndCheck(execNet, 2.0f);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+void inferAndCheck(InferRequest& request, const std::string& inputName, const std::string& outputName, float value) {
+    auto inBlob = request.GetBlob(inputName);
+    auto in = inBlob->buffer().as<float *>();
+    std::fill(in, in + inBlob->size(), value);
+    request.StartAsync();
+    request.Wait(IInferRequest::WaitMode::RESULT_READY);
+
+    auto outBlob = request.GetBlob(outputName);
+    const float *out = outBlob->cbuffer().as<const float *>();
+    for (size_t i = 0; i < outBlob->size(); i++)
+        ASSERT_EQ(std::max(value, 0.0f), out[i]);
+}
+
+}  // namespace
+
+TEST(RequestPriorityCPUTest, RequestsOfDifferentPrioritiesShareNetwork) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(CNNNetwork(ngraph::builder::subgraph::makeSingleRelu()), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"},
+                                   {PluginConfigParams::KEY_CPU_REQUEST_PRIORITY, PluginConfigParams::CPU_REQUEST_PRIORITY_LOW}});
+    auto inputName = execNet.GetInputsInfo().begin()->first;
+    auto outputName = execNet.GetOutputsInfo().begin()->first;
+
+    auto lowRequest = execNet.CreateInferRequest();
+    ASSERT_NO_THROW(execNet.SetConfig({{PluginConfigParams::KEY_CPU_REQUEST_PRIORITY,
+                                        Parameter{std::string{PluginConfigParams::CPU_REQUEST_PRIORITY_HIGH}}}}));
+    ASSERT_EQ(std::string{PluginConfigParams::CPU_REQUEST_PRIORITY_HIGH},
+              execNet.GetConfig(PluginConfigParams::KEY_CPU_REQUEST_PRIORITY).as<std::string>());
+    auto highRequest = execNet.CreateInferRequest();
+
+    inferAndCheck(lowRequest, inputName, outputName, -1.0f);
+    inferAndCheck(highRequest, inputName, outputName, 2.0f);
+}
+
+TEST(RequestPriorityCPUTest, OtherKeysCannotBeChangedForLoadedNetwork) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(CNNNetwork(ngraph::builder::subgraph::makeSingleRelu()), CommonTestUtils::DEVICE_CPU);
+    ASSERT_THROW(execNet.SetConfig({{PluginConfigParams::KEY_CPU_BIND_THREAD, Parameter{std::string{PluginConfigParams::NO}}}}),
+                 details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,70 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeReluNetwork(Precision inPrecision, Layout inLayout) {
+    CNNNetwork network(ngraph::builder::subgraph::makeSingleRelu({1, 3, 4, 5}));
+    network.getInputsInfo().begin()->second->setPrecision(inPrecision);
+    network.getInputsInfo().begin()->second->setLayout(inLayout);
+    return network;
+}
+
+void compareRoiWithDense(Precision inPrecision, Layout inLayout) {
+    Core ie;
+    auto network = makeReluNetwork(inPrecision, inLayout);
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    // the input is a crop of a larger frame
+    const auto &inDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+    auto frame = FuncTestUtils::createAndFillBlob(TensorDesc(inPrecision, {1, 3, 8, 10}, inLayout));
+    auto roi = make_shared_blob(frame, ROI(0, 3, 2, 5, 4));
+    auto dense = make_blob_with_precision(inDesc);
+    dense->allocate();
+    blob_copy(roi, dense);
+
+    auto request = execNet.CreateInferRequest();
+    request.SetBlob(inputName, roi);
+    request.Infer();
+    auto output = request.GetBlob(outputName);
+
+    auto refRequest = execNet.CreateInferRequest();
+    refRequest.SetBlob(inputName, dense);
+    refRequest.Infer();
+    FuncTestUtils::compareBlobs(output, refRequest.GetBlob(outputName));
+}
+
+}  // namespace
+
+TEST(RoiInputCPUTest, RoiInputMatchesDenseInput) {
+    compareRoiWithDense(Precision::FP32, Layout::NCHW);
+}
+
+TEST(RoiInputCPUTest, RoiInputMatchesDenseInputNHWC) {
+    compareRoiWithDense(Precision::FP32, Layout::NHWC);
+}
+
+TEST(RoiInputCPUTest, RoiInputWithU8MatchesDenseInput) {
+    compareRoiWithDense(Precision::U8, Layout::NCHW);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
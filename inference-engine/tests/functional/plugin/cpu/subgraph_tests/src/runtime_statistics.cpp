@@ -0,0 +1,48 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+TEST(RuntimeStatisticsTest, CountersAreUpdatedByInferences) {
+    Core ie;
+    CNNNetwork network(ngraph::builder::subgraph::makeSingleRelu({1, 16, 14, 14}));
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    auto metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_RUNTIME_STATISTICS)));
+
+    auto statistics = execNet.GetMetric(METRIC_KEY(CPU_RUNTIME_STATISTICS)).as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(0, statistics["inferences"]);
+    ASSERT_EQ(0, statistics["latency_p99_us"]);
+
+    auto syncRequest = execNet.CreateInferRequest();
+    syncRequest.Infer();
+    auto asyncRequest = execNet.CreateInferRequest();
+    asyncRequest.StartAsync();
+    asyncRequest.Wait(IInferRequest::WaitMode::RESULT_READY);
+
+    statistics = execNet.GetMetric(METRIC_KEY(CPU_RUNTIME_STATISTICS)).as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(2, statistics["inferences"]);
+    ASSERT_EQ(0, statistics["queued"]);
+    ASSERT_EQ(0, statistics["running"]);
+    ASSERT_LE(statistics["latency_p50_us"], statistics["latency_p90_us"]);
+    ASSERT_LE(statistics["latency_p90_us"], statistics["latency_p99_us"]);
+    ASSERT_LE(statistics["busy_us"], statistics["uptime_us"]);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,70 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeMatMulNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 64});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{64, 64},
+                                                    std::vector<float>(64 * 64, 0.1f));
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(param, weights, false, true);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(matMul);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+// inputs are filled with the same random values on each call
+Blob::Ptr infer(ExecutableNetwork& execNet, const CNNNetwork& network) {
+    auto request = execNet.CreateInferRequest();
+    for (auto&& input : network.getInputsInfo()) {
+        auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc());
+        request.SetBlob(input.first, blob);
+    }
+    request.Infer();
+    return request.GetBlob(network.getOutputsInfo().begin()->first);
+}
+
+}  // namespace
+
+TEST(RuntimeStreamsCPUTest, StreamsCanBeChangedForLoadedNetwork) {
+    Core ie;
+    auto network = makeMatMulNetwork();
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+    auto refOutput = infer(execNet, network);
+
+    ASSERT_NO_THROW(execNet.SetConfig({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, Parameter{std::string{"2"}}},
+                                       {PluginConfigParams::KEY_CPU_THREADS_NUM, Parameter{std::string{"2"}}}}));
+    ASSERT_EQ("2", execNet.GetConfig(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS).as<std::string>());
+    ASSERT_EQ(2u, execNet.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+
+    auto output = infer(execNet, network);
+    FuncTestUtils::compareBlobs(output, refOutput);
+}
+
+TEST(RuntimeStreamsCPUTest, StreamsCannotBeChangedWhileRequestsExist) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeMatMulNetwork(), CommonTestUtils::DEVICE_CPU);
+    auto request = execNet.CreateInferRequest();
+    ASSERT_THROW(execNet.SetConfig({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, Parameter{std::string{"2"}}}}),
+                 details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
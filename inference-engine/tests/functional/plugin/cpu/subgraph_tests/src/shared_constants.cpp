@@ -0,0 +1,68 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+// out = in + relu(c1 * c2), the constant part is computed on load
+CNNNetwork makeConstSubgraphNetwork(float value) {
+    const ngraph::Shape shape{1, 64};
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    auto c1 = ngraph::opset1::Constant::create(ngraph::element::f32, shape, std::vector<float>(64, value));
+    auto c2 = ngraph::opset1::Constant::create(ngraph::element::f32, shape, std::vector<float>(64, 2.0f));
+    auto mul = std::make_shared<ngraph::opset1::Multiply>(c1, c2);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(mul);
+    auto add = std::make_shared<ngraph::opset1::Add>(param, relu);
+    auto result = std::make_shared<ngraph::opset1::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+void inferAndCheck(ExecutableNetwork& execNet, float expected) {
+    auto inputName = execNet.GetInputsInfo().begin()->first;
+    auto outputName = execNet.GetOutputsInfo().begin()->first;
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < 4; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+        auto inBlob = requests.back().GetBlob(inputName);
+        auto in = inBlob->buffer().as<float *>();
+        std::fill(in, in + inBlob->size(), 1.0f);
+        requests.back().StartAsync();
+    }
+    for (auto& request : requests) {
+        request.Wait(IInferRequest::WaitMode::RESULT_READY);
+        auto outBlob = request.GetBlob(outputName);
+        const float *out = outBlob->cbuffer().as<const float *>();
+        for (size_t i = 0; i < outBlob->size(); i++)
+            ASSERT_EQ(expected, out[i]);
+    }
+}
+
+}  // namespace
+
+TEST(SharedConstantsCPUTest, ConstantSubgraphsOfDifferentNetworksAreNotMixed) {
+    Core ie;
+    std::map<std::string, std::string> config = {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}};
+    auto execNet1 = ie.LoadNetwork(makeConstSubgraphNetwork(3.0f), CommonTestUtils::DEVICE_CPU, config);
+    auto execNet2 = ie.LoadNetwork(makeConstSubgraphNetwork(-3.0f), CommonTestUtils::DEVICE_CPU, config);
+
+    inferAndCheck(execNet1, 7.0f);
+    inferAndCheck(execNet2, 1.0f);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
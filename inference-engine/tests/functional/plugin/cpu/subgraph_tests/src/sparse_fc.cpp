@@ -0,0 +1,105 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+const size_t batch = 3, inChannels = 64, outChannels = 40;
+
+CNNNetwork makeSparseFCNetwork() {
+    std::vector<float> weights(inChannels * outChannels, 0.0f);
+    // ~90% of zeros
+    for (size_t i = 0; i < weights.size(); i += 10)
+        weights[i] = static_cast<float>(i % 7) - 3.0f;
+    std::vector<float> biases(outChannels);
+    for (size_t i = 0; i < biases.size(); i++)
+        biases[i] = 0.5f * static_cast<float>(i);
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{batch, inChannels}});
+    auto fc = ngraph::builder::makeFullyConnected(params[0], ngraph::element::f32, outChannels, false,
+                                                  {inChannels, outChannels}, weights);
+    auto biasesNode = ngraph::builder::makeConstant(ngraph::element::f32, {1, outChannels}, biases);
+    auto add = std::make_shared<ngraph::opset1::Add>(fc, biasesNode);
+    auto result = std::make_shared<ngraph::opset1::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, params));
+}
+
+std::vector<float> infer(ExecutableNetwork& execNet, const std::vector<float>& input) {
+    auto request = execNet.CreateInferRequest();
+    auto inputName = execNet.GetInputsInfo().begin()->first;
+    auto outputName = execNet.GetOutputsInfo().begin()->first;
+
+    auto inBlob = request.GetBlob(inputName);
+    std::copy(input.begin(), input.end(), inBlob->buffer().as<float *>());
+    request.Infer();
+
+    auto outBlob = request.GetBlob(outputName);
+    const float *out = outBlob->cbuffer().as<const float *>();
+    return std::vector<float>(out, out + outBlob->size());
+}
+
+std::string fullyConnectedExecType(InferRequest& request) {
+    for (auto&& counter : request.GetPerformanceCounts()) {
+        if (std::string(counter.second.layer_type) == "FullyConnected")
+            return counter.second.exec_type;
+    }
+    return "";
+}
+
+}  // namespace
+
+TEST(SparseFullyConnectedTest, SparseWeightsMatchDense) {
+    Core ie;
+    auto network = makeSparseFCNetwork();
+
+    std::vector<float> input(batch * inChannels);
+    for (size_t i = 0; i < input.size(); i++)
+        input[i] = static_cast<float>(i % 13) * 0.25f - 1.0f;
+
+    auto denseNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto sparseNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                    {{PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, "0.8"},
+                                     {PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}});
+
+    auto request = sparseNet.CreateInferRequest();
+    request.Infer();
+    ASSERT_NE(std::string::npos, fullyConnectedExecType(request).find("sparse"));
+
+    auto expected = infer(denseNet, input);
+    auto actual = infer(sparseNet, input);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_NEAR(expected[i], actual[i], 1e-4f) << "at index " << i;
+}
+
+TEST(SparseFullyConnectedTest, DenseWeightsAboveThreshold) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeSparseFCNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, "0.95"},
+                                   {PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}});
+
+    auto request = execNet.CreateInferRequest();
+    request.Infer();
+    auto execType = fullyConnectedExecType(request);
+    ASSERT_FALSE(execType.empty());
+    ASSERT_EQ(std::string::npos, execType.find("sparse"));
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,48 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+TEST(StreamDefaultsCPUTest, AutoStreamsFitAvailableProcessors) {
+    Core ie;
+    auto available = ie.GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(CPU_AVAILABLE_PROCESSORS)).as<unsigned int>();
+    ASSERT_EQ(static_cast<unsigned int>(getNumberOfLogicalCPUCores()), available);
+    auto range = ie.GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(RANGE_FOR_STREAMS)).as<std::tuple<unsigned int, unsigned int>>();
+    ASSERT_LE(std::get<1>(range), std::max(1u, available));
+
+    CNNNetwork network(ngraph::builder::subgraph::makeSingleRelu({1, 3, 16, 16}));
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, PluginConfigParams::CPU_THROUGHPUT_AUTO}});
+    auto streams = std::stoul(execNet.GetConfig(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS).as<std::string>());
+    auto threads = execNet.GetMetric(METRIC_KEY(CPU_STREAM_THREADS)).as<unsigned int>();
+    ASSERT_GE(threads, 1u);
+    ASSERT_LE(streams * threads, std::max(1u, available));
+}
+
+TEST(StreamDefaultsCPUTest, StreamThreadsAreNotReportedForExclusiveRequests) {
+    Core ie;
+    CNNNetwork network(ngraph::builder::subgraph::makeSingleRelu({1, 3, 16, 16}));
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::YES}});
+    std::vector<std::string> metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_EQ(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_STREAM_THREADS)));
+    ASSERT_THROW(execNet.GetMetric(METRIC_KEY(CPU_STREAM_THREADS)), InferenceEngine::details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
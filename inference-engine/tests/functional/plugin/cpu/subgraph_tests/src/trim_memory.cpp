@@ -0,0 +1,74 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+// 4 MB intermediate tensors, so the arena takes many pages
+CNNNetwork makeEltwiseNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 256, 256});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(
+        relu, ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 16, 1, 1}, std::vector<float>(16, 2.f)));
+    auto add = std::make_shared<ngraph::opset1::Add>(multiply, param);
+    auto result = std::make_shared<ngraph::opset1::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr infer(ExecutableNetwork& execNet, const CNNNetwork& network) {
+    auto request = execNet.CreateInferRequest();
+    for (auto&& input : network.getInputsInfo()) {
+        auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc());
+        request.SetBlob(input.first, blob);
+    }
+    request.Infer();
+    return request.GetBlob(network.getOutputsInfo().begin()->first);
+}
+
+}  // namespace
+
+TEST(TrimMemoryCPUTest, TrimmedNetworkKeepsResults) {
+    Core ie;
+    auto network = makeEltwiseNetwork();
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}});
+    auto refExecNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto refOutput = infer(refExecNet, network);
+    infer(execNet, network);
+
+    ASSERT_NO_THROW(execNet.SetConfig({{PluginConfigParams::KEY_CPU_TRIM_MEMORY, Parameter{std::string{PluginConfigParams::YES}}}}));
+    auto trimmed = execNet.GetMetric(METRIC_KEY(CPU_TRIMMED_MEMORY_SIZE)).as<uint64_t>();
+#ifdef __linux__
+    ASSERT_GT(trimmed, 0u);
+#endif
+    ASSERT_LE(trimmed, 2 * execNet.GetMetric(METRIC_KEY(CPU_MEMORY_ARENA_SIZE)).as<uint64_t>());
+
+    // the memory is faulted in again by the next inference
+    auto output = infer(execNet, network);
+    FuncTestUtils::compareBlobs(output, refOutput);
+}
+
+TEST(TrimMemoryCPUTest, ThrowsOnWrongValue) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeEltwiseNetwork(), CommonTestUtils::DEVICE_CPU);
+    ASSERT_THROW(execNet.SetConfig({{PluginConfigParams::KEY_CPU_TRIM_MEMORY, Parameter{std::string{"ON"}}}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
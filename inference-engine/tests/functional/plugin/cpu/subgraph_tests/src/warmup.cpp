@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeMatMulReluNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 64});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{64, 64},
+                                                    std::vector<float>(64 * 64, 0.01f));
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(param, weights, false, true);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(matMul);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr infer(ExecutableNetwork& execNet, const CNNNetwork& network) {
+    auto request = execNet.CreateInferRequest();
+    for (auto&& input : network.getInputsInfo()) {
+        auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc());
+        request.SetBlob(input.first, blob);
+    }
+    request.Infer();
+    return request.GetBlob(network.getOutputsInfo().begin()->first);
+}
+
+}  // namespace
+
+TEST(WarmupCPUTest, WarmedUpNetworkKeepsResults) {
+    Core ie;
+    auto network = makeMatMulReluNetwork();
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_WARMUP, PluginConfigParams::YES},
+                                   {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}});
+    auto refExecNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ(PluginConfigParams::YES, execNet.GetConfig(PluginConfigParams::KEY_CPU_WARMUP).as<std::string>());
+
+    auto output = infer(execNet, network);
+    auto refOutput = infer(refExecNet, network);
+    FuncTestUtils::compareBlobs(output, refOutput);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+namespace {
+
+CNNNetwork makeNetwork() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+    auto softmax = std::make_shared<ngraph::opset1::Softmax>(param, 1);
+    auto result = std::make_shared<ngraph::opset1::Result>(softmax);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+void fill(float* data, size_t size) {
+    for (size_t i = 0; i < size; i++)
+        data[i] = 0.1f * i;
+}
+
+void checkSoftmax(const float* in, const float* out, size_t size) {
+    float sum = 0.f;
+    for (size_t i = 0; i < size; i++)
+        sum += std::exp(in[i]);
+    for (size_t i = 0; i < size; i++)
+        ASSERT_NEAR(std::exp(in[i]) / sum, out[i], 1e-5f) << "element " << i;
+}
+
+std::string execType(const InferRequest& req, const std::string& layerName) {
+    auto perfCounts = req.GetPerformanceCounts();
+    auto it = perfCounts.find(layerName);
+    return it == perfCounts.end() ? std::string{} : std::string{it->second.exec_type};
+}
+
+const std::map<std::string, std::string> perfCountConfig = {
+    {PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}
+};
+
+}  // namespace
+
+TEST(ZeroCopyTest, CompatibleBlobsAreBoundWithoutCopy) {
+    Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, perfCountConfig);
+    auto req = execNet.CreateInferRequest();
+
+    auto input = make_shared_blob<float>({Precision::FP32, {1, 16}, Layout::NC});
+    input->allocate();
+    fill(input->buffer().as<float*>(), input->size());
+    auto output = make_shared_blob<float>({Precision::FP32, {1, 16}, Layout::NC});
+    output->allocate();
+    req.SetBlob(inputName, input);
+    req.SetBlob(outputName, output);
+    req.Infer();
+
+    checkSoftmax(input->cbuffer().as<const float*>(), output->cbuffer().as<const float*>(), output->size());
+    ASSERT_EQ("zero_copy", execType(req, inputName));
+    ASSERT_EQ("zero_copy", execType(req, "out_" + outputName));
+}
+
+TEST(ZeroCopyTest, MisalignedBlobIsCopied) {
+    Core ie;
+    auto network = makeNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, perfCountConfig);
+    auto req = execNet.CreateInferRequest();
+
+    std::vector<float> in(16);
+    fill(in.data(), in.size());
+    std::vector<char> storage(in.size() * sizeof(float) + 1);
+    std::memcpy(storage.data() + 1, in.data(), in.size() * sizeof(float));
+    auto input = make_shared_blob<float>({Precision::FP32, {1, 16}, Layout::NC}, reinterpret_cast<float*>(storage.data() + 1));
+    req.SetBlob(inputName, input);
+    req.Infer();
+
+    auto output = req.GetBlob(outputName);
+    checkSoftmax(in.data(), output->cbuffer().as<const float*>(), output->size());
+    ASSERT_EQ("memcpy", execType(req, inputName));
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
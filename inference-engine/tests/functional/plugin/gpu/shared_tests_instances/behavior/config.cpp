@@ -3,6 +3,7 @@
 //
 
 #include "multi-device/multi_device_config.hpp"
+#include "cldnn/cldnn_config.hpp"
 
 #include "behavior/config.hpp"
 
@@ -19,7 +20,14 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CONFIG_FILE, "unknown_file"}},
             {{InferenceEngine::PluginConfigParams::KEY_DUMP_KERNELS, "ON"}},
             {{InferenceEngine::PluginConfigParams::KEY_TUNING_MODE, "TUNING_UNKNOWN_MODE"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID, "DEVICE_UNKNOWN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID, "DEVICE_UNKNOWN"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_PIPELINED_UPLOAD, "ON"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_TUNING_WARMUP_INFERENCES, "-1"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_MEM_POOL_CACHE_LIMIT, "-1"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_QUEUE, "ON"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_ENABLE_FUSED_ATTENTION, "ON"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_PLUGIN_PRIORITY, "4"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_PLUGIN_THROTTLE, "4"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -51,7 +59,12 @@ namespace {
 
 
     const std::vector<std::map<std::string, std::string>> conf = {
-            {}
+            {},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_PIPELINED_UPLOAD, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_TUNING_WARMUP_INFERENCES, "5"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_MEM_POOL_CACHE_LIMIT, "64"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_QUEUE, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_ENABLE_FUSED_ATTENTION, InferenceEngine::PluginConfigParams::YES}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiconf = {
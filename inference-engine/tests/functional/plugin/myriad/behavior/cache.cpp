@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <vpu/vpu_config.hpp>
+
+class CompiledBlobsCacheTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::shared_ptr<ngraph::Function> function;
+    const std::map<std::string, std::string> config = {{ CONFIG_KEY(CACHE_DIR), "." }};
+
+    void SetUp() override {
+        function = ngraph::builder::subgraph::makeConvPoolRelu();
+        CommonTestUtils::removeFilesWithExt(".", "blob");
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(".", "blob");
+    }
+};
+
+TEST_F(CompiledBlobsCacheTest, OptionsSetViaCoreAreTheCacheKeyPart) {
+    InferenceEngine::Core ie;
+    InferenceEngine::CNNNetwork cnnNet(function);
+
+    ie.SetConfig({{ InferenceEngine::MYRIAD_ENABLE_HW_ACCELERATION, CONFIG_VALUE(YES) }}, CommonTestUtils::DEVICE_MYRIAD);
+    ASSERT_NO_THROW(ie.LoadNetwork(cnnNet, CommonTestUtils::DEVICE_MYRIAD, config));
+    // the same options, the blob is imported
+    ASSERT_NO_THROW(ie.LoadNetwork(cnnNet, CommonTestUtils::DEVICE_MYRIAD, config));
+
+    // the network compiled without HW stages is another cache entry
+    ie.SetConfig({{ InferenceEngine::MYRIAD_ENABLE_HW_ACCELERATION, CONFIG_VALUE(NO) }}, CommonTestUtils::DEVICE_MYRIAD);
+    ASSERT_NO_THROW(ie.LoadNetwork(cnnNet, CommonTestUtils::DEVICE_MYRIAD, config));
+
+    ASSERT_EQ(2, CommonTestUtils::removeFilesWithExt(".", "blob"));
+}
@@ -317,7 +317,12 @@ INSTANTIATE_TEST_CASE_P(smoke_EltwiseBroadcast, DynamicToStaticShapeEltwise, tes
         ngraph::opset3::Subtract::type_info,
         ngraph::opset3::Maximum::type_info,
         ngraph::opset3::Minimum::type_info,
-        ngraph::opset3::Less::type_info),
+        ngraph::opset3::Less::type_info,
+        ngraph::opset3::NotEqual::type_info,
+        ngraph::opset3::GreaterEqual::type_info,
+        ngraph::opset3::LessEqual::type_info,
+        ngraph::opset3::SquaredDifference::type_info,
+        ngraph::opset3::FloorMod::type_info),
     testing::Values(
         EltwiseParams{DataDims{1000}, DataDims{1}, DynamicToStaticShapeEltwise::reference_simple},
         EltwiseParams{DataDims{1000, 1, 1}, DataDims{1000, 1, 1}, DynamicToStaticShapeEltwise::reference_simple},
@@ -344,7 +349,12 @@ INSTANTIATE_TEST_CASE_P(smoke_EltwiseBroadcastSingleDSR, DynamicToStaticShapeElt
         ngraph::opset3::Subtract::type_info,
         ngraph::opset3::Maximum::type_info,
         ngraph::opset3::Minimum::type_info,
-        ngraph::opset3::Less::type_info),
+        ngraph::opset3::Less::type_info,
+        ngraph::opset3::NotEqual::type_info,
+        ngraph::opset3::GreaterEqual::type_info,
+        ngraph::opset3::LessEqual::type_info,
+        ngraph::opset3::SquaredDifference::type_info,
+        ngraph::opset3::FloorMod::type_info),
     testing::Values(
         EltwiseParams{DataDims{1000}, DataDims{1}, DynamicToStaticShapeEltwiseSingleDSR::reference_simple},
         EltwiseParams{DataDims{1000, 1, 1}, DataDims{1000, 1, 1}, DynamicToStaticShapeEltwiseSingleDSR::reference_simple},
@@ -97,6 +97,8 @@ INSTANTIATE_TEST_CASE_P(smoke_NGraph, DynamicToStaticShapeUnaryElementwise, test
         ngraph::opset3::Sigmoid::type_info,
         ngraph::opset3::Softmax::type_info,
         ngraph::opset3::Sqrt::type_info,
-        ngraph::opset3::LogicalNot::type_info)));
+        ngraph::opset3::LogicalNot::type_info,
+        ngraph::opset3::Tanh::type_info,
+        ngraph::opset3::Erf::type_info)));
 
 }  // namespace
@@ -32,6 +32,9 @@ namespace {
             {{InferenceEngine::MYRIAD_TILING_CMX_LIMIT_KB, "0"}},
             {{InferenceEngine::MYRIAD_TILING_CMX_LIMIT_KB, "10"}},
 
+            {{InferenceEngine::MYRIAD_HW_TILING_SEARCH_DEPTH, "1"}},
+            {{InferenceEngine::MYRIAD_HW_TILING_SEARCH_DEPTH, "8"}},
+
             {{InferenceEngine::MYRIAD_ENABLE_RECEIVING_TENSOR_TIME, CONFIG_VALUE(YES)}},
             {{InferenceEngine::MYRIAD_ENABLE_RECEIVING_TENSOR_TIME, CONFIG_VALUE(NO)}},
             {{InferenceEngine::MYRIAD_PROTOCOL, InferenceEngine::MYRIAD_USB}},
@@ -41,6 +44,13 @@ namespace {
             {{InferenceEngine::MYRIAD_THROUGHPUT_STREAMS, "2"}},
             {{InferenceEngine::MYRIAD_THROUGHPUT_STREAMS, "3"}},
 
+            {{InferenceEngine::MYRIAD_PIPELINE_DEPTH, "-1"}},
+            {{InferenceEngine::MYRIAD_PIPELINE_DEPTH, "1"}},
+            {{InferenceEngine::MYRIAD_PIPELINE_DEPTH, "4"}},
+
+            {{InferenceEngine::MYRIAD_SHARE_DEVICE, CONFIG_VALUE(YES)}},
+            {{InferenceEngine::MYRIAD_SHARE_DEVICE, CONFIG_VALUE(NO)}},
+
             {{InferenceEngine::MYRIAD_ENABLE_WEIGHTS_ANALYSIS, CONFIG_VALUE(YES)}},
             {{InferenceEngine::MYRIAD_ENABLE_WEIGHTS_ANALYSIS, CONFIG_VALUE(NO)}},
 
@@ -100,12 +110,20 @@ namespace {
 
             {{InferenceEngine::MYRIAD_TILING_CMX_LIMIT_KB, "-10"}},
 
+            {{InferenceEngine::MYRIAD_HW_TILING_SEARCH_DEPTH, "0"}},
+            {{InferenceEngine::MYRIAD_HW_TILING_SEARCH_DEPTH, "-1"}},
+
             {{InferenceEngine::MYRIAD_ENABLE_RECEIVING_TENSOR_TIME, "ON"}},
             {{InferenceEngine::MYRIAD_ENABLE_RECEIVING_TENSOR_TIME, "OFF"}},
 
             {{InferenceEngine::MYRIAD_THROUGHPUT_STREAMS, "Two"}},
             {{InferenceEngine::MYRIAD_THROUGHPUT_STREAMS, "SINGLE"}},
 
+            {{InferenceEngine::MYRIAD_PIPELINE_DEPTH, "0"}},
+            {{InferenceEngine::MYRIAD_PIPELINE_DEPTH, "DEEP"}},
+
+            {{InferenceEngine::MYRIAD_SHARE_DEVICE, "ON"}},
+
             {{InferenceEngine::MYRIAD_ENABLE_WEIGHTS_ANALYSIS, "ON"}},
             {{InferenceEngine::MYRIAD_ENABLE_WEIGHTS_ANALYSIS, "OFF"}},
 
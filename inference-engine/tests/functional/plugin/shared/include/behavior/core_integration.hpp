@@ -461,6 +461,23 @@ TEST_P(IEClassNetworkTestP, LoadNetworkActualNoThrow) {
     ASSERT_NO_THROW(ie.LoadNetwork(actualNetwork, deviceName));
 }
 
+TEST_P(IEClassNetworkTestP, LoadNetworkFromFileWithCacheNoThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Core ie;
+    const std::string modelName = "LoadNetworkFromFileWithCache_" + deviceName;
+    const std::string xmlPath = modelName + ".xml", binPath = modelName + ".bin";
+    ASSERT_NO_THROW(simpleNetwork.serialize(xmlPath, binPath));
+    const std::map<std::string, std::string> config = {{CONFIG_KEY(CACHE_DIR), "."}};
+    // the first load compiles the network (and stores it if the device can export it), the second one imports it
+    for (int i = 0; i < 2; ++i) {
+        ExecutableNetwork exeNetwork;
+        ASSERT_NO_THROW(exeNetwork = ie.LoadNetwork(xmlPath, deviceName, config));
+        ASSERT_NO_THROW(exeNetwork.CreateInferRequest().Infer());
+    }
+    CommonTestUtils::removeIRFiles(xmlPath, binPath);
+    CommonTestUtils::removeFilesWithExt(".", "blob");
+}
+
 TEST_P(IEClassNetworkTestP, LoadNetworkActualHeteroDeviceNoThrow) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
     Core ie;
@@ -473,6 +490,22 @@ TEST_P(IEClassNetworkTestP, LoadNetworkActualHeteroDevice2NoThrow) {
     ASSERT_NO_THROW(ie.LoadNetwork(actualNetwork, CommonTestUtils::DEVICE_HETERO, {{"TARGET_FALLBACK", deviceName}}));
 }
 
+TEST_P(IEClassNetworkTestP, LoadNetworkActualHeteroDeviceCostBasedAffinityNoThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Core ie;
+    ExecutableNetwork exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = ie.LoadNetwork(actualNetwork, CommonTestUtils::DEVICE_HETERO + std::string(":") + deviceName,
+        {{HETERO_CONFIG_KEY(COST_BASED_AFFINITY), YES}, {HETERO_CONFIG_KEY(MAX_SUBGRAPHS), "1"}}));
+
+    CNNNetwork execGraph;
+    ASSERT_NO_THROW(execGraph = exeNetwork.GetExecGraphInfo());
+    auto function = execGraph.getFunction();
+    ASSERT_NE(nullptr, function);
+    for (auto&& node : function->get_ops()) {
+        ASSERT_NE(node->get_rt_info().end(), node->get_rt_info().find("affinity")) << node->get_friendly_name();
+    }
+}
+
 //
 // ImportExportNetwork
 //
@@ -873,6 +906,24 @@ TEST_P(IEClassGetAvailableDevices, GetAvailableDevicesNoThrow) {
     ASSERT_TRUE(deviceFound);
 }
 
+TEST_P(IEClassGetAvailableDevices, GetAvailableDevicesAfterCacheResetNoThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    Core ie;
+    std::vector<std::string> devices, cachedDevices, refreshedDevices;
+
+    ASSERT_NO_THROW(devices = ie.GetAvailableDevices());
+    ASSERT_NO_THROW(cachedDevices = ie.GetAvailableDevices());
+    ASSERT_EQ(devices, cachedDevices);
+
+    ASSERT_NO_THROW(ie.ResetDevicesCache(deviceName));
+    ASSERT_NO_THROW(refreshedDevices = ie.GetAvailableDevices());
+    ASSERT_EQ(devices, refreshedDevices);
+
+    ASSERT_NO_THROW(ie.ResetDevicesCache());
+    ASSERT_NO_THROW(refreshedDevices = ie.GetAvailableDevices());
+    ASSERT_EQ(devices, refreshedDevices);
+}
+
 //
 // ExecutableNetwork GetMetric / GetConfig
 //
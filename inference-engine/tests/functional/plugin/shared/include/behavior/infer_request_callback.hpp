@@ -52,6 +52,38 @@ TEST_P(CallbackTests, canCallSyncAndAsyncWithCompletionCallback) {
     ASSERT_TRUE(isCalled);
 }
 
+TEST_P(CallbackTests, canStartInferRequestGroupWithGroupCallback) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // Create CNNNetwork from ngrpah::Function
+    InferenceEngine::CNNNetwork cnnNet(function);
+    // Load CNNNetwork to target plugins
+    auto execNet = ie->LoadNetwork(cnnNet, targetDevice, configuration);
+    // Create InferRequestGroup
+    const std::size_t numRequests = 3;
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (std::size_t i = 0; i < numRequests; ++i) {
+        requests.push_back(execNet.CreateInferRequest());
+    }
+    InferenceEngine::InferRequestGroup group(requests);
+    std::atomic<int> numCalls = {0};
+    group.SetCompletionCallback([&](std::vector<InferenceEngine::InferRequest>& groupRequests,
+                                    InferenceEngine::StatusCode status) {
+        ASSERT_EQ(numRequests, groupRequests.size());
+        ASSERT_EQ(static_cast<int>(InferenceEngine::StatusCode::OK), status);
+        numCalls++;
+    });
+
+    ASSERT_EQ(static_cast<int>(InferenceEngine::StatusCode::INFER_NOT_STARTED),
+              group.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+    for (int iteration = 1; iteration <= 2; ++iteration) {
+        ASSERT_NO_THROW(group.StartAsync());
+        ASSERT_EQ(static_cast<int>(InferenceEngine::StatusCode::OK),
+                  group.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+        ASSERT_EQ(iteration, numCalls);
+    }
+}
+
 // test that can wait all callbacks on dtor
 TEST_P(CallbackTests, canStartSeveralAsyncInsideCompletionCallbackWithSafeDtor) {
     // Skip test according to plugin specific disabledTestPatterns() (if any)
@@ -192,6 +192,16 @@ static std::shared_ptr<ngraph::Function> makeSingleConv(std::vector<size_t> inpu
     return fn_ptr;
 }
 
+static std::shared_ptr<ngraph::Function> makeSingleRelu(std::vector<size_t> inputShape = {1, 16},
+                                                        ngraph::element::Type_t type = ngraph::element::Type_t::f32) {
+    auto param0 = std::make_shared<ngraph::opset1::Parameter>(type, ngraph::Shape(inputShape));
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param0);
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    auto fn_ptr = std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param0});
+    fn_ptr->set_friendly_name("SingleRelu");
+    return fn_ptr;
+}
+
 static std::shared_ptr<ngraph::Function> makeMultiSingleConv(std::vector<size_t> inputShape = {1, 3, 24, 24}) {
     ngraph::element::Type type = ngraph::element::Type_t::f32;
     auto param0 = std::make_shared<ngraph::opset1::Parameter>(type, ngraph::Shape(inputShape));
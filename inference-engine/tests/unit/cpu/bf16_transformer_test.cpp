@@ -167,3 +167,62 @@ TEST(BF16TransformerTest, DISABLED_KeepMemoryPrecisionWithGEMM) {
     ASSERT_EQ(prc_mem_r, Precision::BF16);
     ASSERT_EQ(prc_mem_w, Precision::BF16);
 }
+
+TEST(BF16TransformerTest, KeepFP32LayersFromList) {
+    /*
+     *  Suggested pattern
+     *         _____
+     *        [_inp_]
+     *         __|__
+     *        [_sig_]
+     *         __|__
+     *        [_fc1_]  <- kept in FP32
+     *         __|___
+     *        [_sig2_]
+     *         __|__
+     *        [_fc2_]
+     *         __|__
+     *        [_out_]
+     *
+     *  Input of fc1 is returned to FP32, fc2 is still executed in BF16.
+     */
+    Shape shape = {3, 2};
+    Type type = ngraph::element::f32;
+    auto input = make_shared<Parameter>(type, shape);
+    auto sig = make_shared<Sigmoid>(input);
+    sig->set_friendly_name("sig");
+
+    auto fc1_w = make_shared<Constant>(type, Shape{2, 2}, 1);
+    auto fc1_b = make_shared<Constant>(type, Shape{2}, 1);
+    auto fc1 = make_shared<FullyConnected>(sig, fc1_w, fc1_b, shape);
+    fc1->set_friendly_name("fc1");
+
+    auto sig2 = make_shared<Sigmoid>(fc1);
+    sig2->set_friendly_name("sig2");
+
+    auto fc2_w = make_shared<Constant>(type, Shape{2, 2}, 1);
+    auto fc2_b = make_shared<Constant>(type, Shape{2}, 1);
+    auto fc2 = make_shared<FullyConnected>(sig2, fc2_w, fc2_b, shape);
+
+    auto function = make_shared<ngraph::Function>(
+            ngraph::NodeVector      {fc2},
+            ngraph::ParameterVector {input});
+
+    auto net = create_net(function, IE);
+    MKLDNNPlugin::BF16Transformer defaultTransformer;
+    defaultTransformer.convertToBFloat16(net);
+    auto layers = get_layer_collection(net);
+    IE_SUPPRESS_DEPRECATED_START
+    ASSERT_EQ(Precision::BF16, layers["sig"]->outData[0]->getPrecision());
+    ASSERT_EQ(Precision::BF16, layers["sig2"]->outData[0]->getPrecision());
+    IE_SUPPRESS_DEPRECATED_END
+
+    net = create_net(function, IE);
+    MKLDNNPlugin::BF16Transformer transformer({"fc1"});
+    transformer.convertToBFloat16(net);
+    layers = get_layer_collection(net);
+    IE_SUPPRESS_DEPRECATED_START
+    ASSERT_EQ(Precision::FP32, layers["sig"]->outData[0]->getPrecision());
+    ASSERT_EQ(Precision::BF16, layers["sig2"]->outData[0]->getPrecision());
+    IE_SUPPRESS_DEPRECATED_END
+}
@@ -273,3 +273,60 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, BestFitIsBetterThanGreedy) {
+    int n = 0;                //  |            ____
+    std::vector<Box> boxes{   //  |      _____|_1__|
+            {2, 4, 3, n++},   //  |__   |_0___|____
+            {4, 6, 4, n++},   //  |  |__|     |_4__|
+            {0, 2, 4, n++},   //  |__|_2|_____|____
+            {0, 0, 4, n++},   //  |_3|____________
+            {4, 5, 2, n++},   //     0  1  2  3  4  5  6
+    };
+
+    MKLDNNPlugin::MemorySolver greedy(boxes);
+    EXPECT_EQ(greedy.solve(MKLDNNPlugin::MemorySolver::Strategy::Greedy), 11);
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(MKLDNNPlugin::MemorySolver::Strategy::BestFit), 9);
+    EXPECT_EQ(ms.maxDepth(), 9);
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = ms.getOffset(box1.id);
+        int off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+TEST(MemSolverTest, BestFitIsNotWorseThanGreedy) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {4, 8, 1, n++},
+            {6, 7, 3, n++},
+            {2, 3, 3, n++},
+            {2, 4, 2, n++},
+    };
+
+    MKLDNNPlugin::MemorySolver greedy(boxes);
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    EXPECT_LE(ms.solve(MKLDNNPlugin::MemorySolver::Strategy::BestFit), greedy.solve());
+}
+
+TEST(MemSolverTest, MaxDepthIsPeakOfAliveSizes) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {0, 1, 4, n++},
+            {1, 2, 1, n++},
+            {2, 3, 8, n++},
+            {0, 3, 2, n++},
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    EXPECT_EQ(ms.maxDepth(), 11);
+    EXPECT_EQ(ms.solve(MKLDNNPlugin::MemorySolver::Strategy::BestFit), 11);
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(SimpleDataHashTest, SmallDataMatchesReferenceXXHash64) {
+    const std::string data = "abc";
+    EXPECT_EQ(0x44bc2cf5ad770999ull, SimpleDataHash().hash(reinterpret_cast<const unsigned char*>(data.data()), data.size()));
+    EXPECT_EQ(0xef46db3751d8e999ull, SimpleDataHash().hash(nullptr, 0));
+}
+
+TEST(SimpleDataHashTest, LargeDataHashDependsOnEveryChunk) {
+    std::vector<unsigned char> data((3 << 20) + 17, 7);
+    const SimpleDataHash hasher;
+    const auto reference = hasher.hash(data.data(), data.size());
+    EXPECT_EQ(reference, hasher.hash(data.data(), data.size()));
+
+    for (size_t pos : {size_t(0), data.size() / 2, data.size() - 1}) {
+        data[pos]++;
+        EXPECT_NE(reference, hasher.hash(data.data(), data.size())) << "changed byte " << pos;
+        data[pos]--;
+    }
+}
+
+#ifndef _WIN32
+
+namespace {
+
+const mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+const mkldnn::memory::desc desc({16, 8}, mkldnn::memory::data_type::f32, mkldnn::memory::format::nc);
+
+MKLDNNMemoryPtr makeWeights(float value) {
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng));
+    ptr->Create(desc);
+    auto data = static_cast<float*>(ptr->GetData());
+    for (size_t i = 0; i < ptr->GetElementsCount(); i++)
+        data[i] = value;
+    return ptr;
+}
+
+}  // namespace
+
+TEST(SharedMemoryWeightsTest, SecondStoreReusesDataWithoutCreate) {
+    // each store has its own in-process map, so they behave like two processes
+    MKLDNNSharedMemoryWeights store1(0), store2(0);
+    int created = 0;
+
+    auto w1 = store1.findOrCreate("SecondStoreReuses_conv_0", eng, desc, [&] { created++; return makeWeights(3.f); });
+    auto w2 = store2.findOrCreate("SecondStoreReuses_conv_0", eng, desc, [&] { created++; return makeWeights(5.f); });
+
+    ASSERT_EQ(1, created);
+    ASSERT_NE(w1->GetData(), w2->GetData());
+    EXPECT_EQ(3.f, static_cast<float*>(w2->GetData())[0]);
+
+    // the region is shared, not copied
+    static_cast<float*>(w1->GetData())[1] = 7.f;
+    EXPECT_EQ(7.f, static_cast<float*>(w2->GetData())[1]);
+}
+
+TEST(SharedMemoryWeightsTest, RegionIsRemovedWithLastUser) {
+    MKLDNNSharedMemoryWeights store1(0), store2(0);
+    int created = 0;
+    auto create = [&] { created++; return makeWeights(1.f); };
+
+    store1.findOrCreate("RegionIsRemoved_conv_0", eng, desc, create);
+    store2.findOrCreate("RegionIsRemoved_conv_0", eng, desc, create);
+
+    ASSERT_EQ(2, created);
+}
+
+TEST(SharedMemoryWeightsTest, DifferentKeysAreNotShared) {
+    MKLDNNSharedMemoryWeights store1(0), store2(0);
+    int created = 0;
+    auto create = [&] { created++; return makeWeights(1.f); };
+
+    auto w1 = store1.findOrCreate("DifferentKeys_conv_0", eng, desc, create);
+    auto w2 = store2.findOrCreate("DifferentKeys_conv_1", eng, desc, create);
+
+    ASSERT_EQ(2, created);
+}
+
+#endif
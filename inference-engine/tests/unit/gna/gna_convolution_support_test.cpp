@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "layers/gna_layer_type.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+class GNAConvolutionSupportTest : public ::testing::Test {
+protected:
+    std::shared_ptr<ConvolutionLayer> makeConvolution(const SizeVector& inputDims,
+                                                      size_t kernel_x, size_t kernel_y,
+                                                      const CNNLayerPtr& creator = nullptr) {
+        input = std::make_shared<Data>("input", TensorDesc(Precision::FP32, inputDims, Layout::NCHW));
+        if (creator) {
+            getCreatorLayer(input) = creator;
+        }
+        auto convolution = std::make_shared<ConvolutionLayer>(LayerParams{"conv", "Convolution", Precision::FP32});
+        convolution->_kernel.insert(X_AXIS, kernel_x);
+        convolution->_kernel.insert(Y_AXIS, kernel_y);
+        convolution->_dilation.insert(X_AXIS, 1);
+        convolution->_dilation.insert(Y_AXIS, 1);
+        convolution->insData.push_back(input);
+        return convolution;
+    }
+
+    DataPtr input;
+    std::string reason;
+};
+
+TEST_F(GNAConvolutionSupportTest, Conv1DIsSupported) {
+    auto convolution = makeConvolution({1, 8, 1, 16}, 3, 1);
+    EXPECT_TRUE(GNAPluginNS::IsConvolutionSupported(convolution, reason)) << reason;
+}
+
+TEST_F(GNAConvolutionSupportTest, Conv2DKernelIsNotSupported) {
+    auto convolution = makeConvolution({1, 8, 1, 16}, 3, 3);
+    EXPECT_FALSE(GNAPluginNS::IsConvolutionSupported(convolution, reason));
+}
+
+TEST_F(GNAConvolutionSupportTest, DilationIsNotSupported) {
+    auto convolution = makeConvolution({1, 8, 1, 16}, 3, 1);
+    convolution->_dilation[X_AXIS] = 2;
+    EXPECT_FALSE(GNAPluginNS::IsConvolutionSupported(convolution, reason));
+}
+
+TEST_F(GNAConvolutionSupportTest, NCHWInputWithSeveralRowsIsNotSupported) {
+    auto convolution = makeConvolution({1, 1, 4, 16}, 3, 1);
+    EXPECT_FALSE(GNAPluginNS::IsConvolutionSupported(convolution, reason));
+}
+
+TEST_F(GNAConvolutionSupportTest, InputPermutedFromNHWCIsSupported) {
+    auto permute = std::make_shared<CNNLayer>(LayerParams{"permute", "Permute", Precision::FP32});
+    auto convolution = makeConvolution({1, 8, 4, 1}, 1, 1, permute);
+    EXPECT_TRUE(GNAPluginNS::IsConvolutionSupported(convolution, reason)) << reason;
+}
+
+}  // namespace
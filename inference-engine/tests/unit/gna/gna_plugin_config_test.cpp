@@ -22,6 +22,8 @@ const std::map<std::string, std::string>  supportedConfigKeysWithDefaults = {
     {GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN), CONFIG_VALUE(NO)},
     {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(LIB_N_THREADS), "1"},
+    {GNA_CONFIG_KEY(COALESCE_N_REQUESTS), "1"},
+    {GNA_CONFIG_KEY(DEVICE_POOL_SIZE), "1"},
     {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)}
 };
 
@@ -169,6 +171,27 @@ TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsTest) {
     ExpectThrow(GNA_CONFIG_KEY(LIB_N_THREADS), "abc");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigCoalesceNRequestsTest) {
+    SetAndCompare(GNA_CONFIG_KEY(COALESCE_N_REQUESTS), "4");
+    EXPECT_EQ(config.gnaFlags.coalesced_requests_num, 4);
+    SetAndCompare(GNA_CONFIG_KEY(COALESCE_N_REQUESTS), "8");
+    EXPECT_EQ(config.gnaFlags.coalesced_requests_num, 8);
+    ExpectThrow(GNA_CONFIG_KEY(COALESCE_N_REQUESTS), "");
+    ExpectThrow(GNA_CONFIG_KEY(COALESCE_N_REQUESTS), "0");
+    ExpectThrow(GNA_CONFIG_KEY(COALESCE_N_REQUESTS), "9");
+    ExpectThrow(GNA_CONFIG_KEY(COALESCE_N_REQUESTS), "abc");
+}
+
+TEST_F(GNAPluginConfigTest, GnaConfigDevicePoolSizeTest) {
+    SetAndCompare(GNA_CONFIG_KEY(DEVICE_POOL_SIZE), "2");
+    EXPECT_EQ(config.gnaFlags.device_pool_size, 2);
+    SetAndCompare(GNA_CONFIG_KEY(DEVICE_POOL_SIZE), "16");
+    EXPECT_EQ(config.gnaFlags.device_pool_size, 16);
+    ExpectThrow(GNA_CONFIG_KEY(DEVICE_POOL_SIZE), "0");
+    ExpectThrow(GNA_CONFIG_KEY(DEVICE_POOL_SIZE), "17");
+    ExpectThrow(GNA_CONFIG_KEY(DEVICE_POOL_SIZE), "abc");
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigSingleThreadTest) {
     SetAndCheckFlag(CONFIG_KEY(SINGLE_THREAD),
                     config.gnaFlags.gna_openmp_multithreading,
@@ -0,0 +1,52 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include <gtest/gtest.h>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "frontend/quantization.h"
+
+namespace {
+
+TEST(GnaQuantizationTest, QuantizeVector16RoundsAndSaturates) {
+    std::vector<float> input = {0.f, 0.24f, 0.26f, -0.24f, -0.26f, 1.f, -1.f, 100.f, -100.f};
+    std::vector<int16_t> output(input.size());
+    QuantizeVector16(input.data(), output.data(), static_cast<uint32_t>(input.size()), 2.f);
+    EXPECT_EQ(output, std::vector<int16_t>({0, 0, 1, 0, -1, 2, -2, 200, -200}));
+
+    QuantizeVector16(input.data(), output.data(), static_cast<uint32_t>(input.size()), 1000.f);
+    EXPECT_EQ(output, std::vector<int16_t>({0, 240, 260, -240, -260, 1000, -1000, 32767, -32768}));
+}
+
+TEST(GnaQuantizationTest, QuantizeAffine8PadsRowsAndColumns) {
+    std::vector<float> weights = {1.f, -0.5f, 0.25f,
+                                  -2.f, 1.f, 0.f};
+    std::vector<int8_t> int_weights(4 * 4, 1);
+    std::vector<gna_compound_bias_t> int_biases(4);
+    float weight_scale_factor = 1.f, output_scale_factor = 1.f;
+    bool quantized_weights = false;
+
+    QuantizationCallback<int8_t, gna_compound_bias_t>{weights.data(), nullptr, int_weights.data(), int_biases.data(),
+        1.f, &weight_scale_factor, &output_scale_factor, 2, 3, 4, 4,
+        0, nullptr, nullptr, nullptr, nullptr, &quantized_weights}.runQuantize();
+
+    // the biggest weight goes to the max multiplier, every row is scaled to the 8-bit range
+    EXPECT_FLOAT_EQ(weight_scale_factor, MAX_OUT_MULTIPLIER * MAX_VAL_1B_WEIGHT / 2.f);
+    for (size_t row = 0; row < 2; row++) {
+        const float scale = weight_scale_factor / int_biases[row].multiplier;
+        for (size_t col = 0; col < 3; col++) {
+            EXPECT_NEAR(int_weights[row * 4 + col], weights[row * 3 + col] * scale, 0.5f + 1e-3f);
+        }
+        EXPECT_EQ(int_weights[row * 4 + 3], 0);
+    }
+    for (size_t i = 2 * 4; i < int_weights.size(); i++) {
+        EXPECT_EQ(int_weights[i], 0);
+    }
+    EXPECT_EQ(int_biases[2].multiplier, 0);
+    EXPECT_EQ(int_biases[3].multiplier, 0);
+}
+
+}  // namespace
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <deque>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -261,6 +263,42 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
 
+TEST_F(InferRequestThreadSafeDefaultTests, requestIsDroppedIfNotStartedBeforeDeadline) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    StatusCode callbackStatus = OK;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                callbackStatus = status;
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(0);
+
+    testRequest->SetDeadline(std::chrono::milliseconds{1});
+    cppRequest.StartAsync();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    taskExecutor->executeAll();
+    ASSERT_EQ(INFER_DEADLINE_EXPIRED, cppRequest.Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(INFER_DEADLINE_EXPIRED, callbackStatus);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, requestStartedBeforeDeadlineIsExecuted) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+
+    testRequest->SetDeadline(std::chrono::seconds{10});
+    testRequest->StartAsync();
+    taskExecutor->executeAll();
+    ASSERT_EQ(OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
 
 class AsyncInferRequestThreadSafeInternalTests : public ::testing::Test {
 protected:
@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+
+#include <ie_blob.h>
+
+#include "unit_test_utils/mocks/cpp_interfaces/impl/mock_infer_request_internal.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class InferRequestInternalTests : public ::testing::Test {
+protected:
+    shared_ptr<MockInferRequestInternal> request;
+    Blob::Ptr input;
+    Blob::Ptr output;
+
+    virtual void SetUp() {
+        InputsDataMap networkInputs;
+        OutputsDataMap networkOutputs;
+        auto inputInfo = make_shared<InputInfo>();
+        inputInfo->setInputData(make_shared<Data>("input", TensorDesc(Precision::FP32, {1, 3}, Layout::NC)));
+        networkInputs["input"] = inputInfo;
+        networkOutputs["output"] = make_shared<Data>("output", TensorDesc(Precision::FP32, {1, 2}, Layout::NC));
+        request = make_shared<MockInferRequestInternal>(networkInputs, networkOutputs);
+
+        input = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 3}, Layout::NC));
+        input->allocate();
+        output = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 2}, Layout::NC));
+        output->allocate();
+        request->SetBlob("input", input);
+        request->SetBlob("output", output);
+        EXPECT_CALL(*request, InferImpl()).WillRepeatedly(Return());
+    }
+};
+
+TEST_F(InferRequestInternalTests, canInferSeveralTimesWithTheSameBlobs) {
+    ASSERT_NO_THROW(request->Infer());
+    ASSERT_NO_THROW(request->Infer());
+}
+
+TEST_F(InferRequestInternalTests, checksBlobAgainAfterDeallocation) {
+    ASSERT_NO_THROW(request->Infer());
+    input->deallocate();
+    ASSERT_THROW(request->Infer(), details::InferenceEngineException);
+}
+
+TEST_F(InferRequestInternalTests, checksBlobAgainAfterResize) {
+    ASSERT_NO_THROW(request->Infer());
+    output->getTensorDesc().setDims({1, 4});
+    ASSERT_THROW(request->Infer(), details::InferenceEngineException);
+}
+
+TEST_F(InferRequestInternalTests, checksBlobAgainAfterReplacement) {
+    ASSERT_NO_THROW(request->Infer());
+    auto newInput = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 3}, Layout::NC));
+    newInput->allocate();
+    request->SetBlob("input", newInput);
+    newInput->deallocate();
+    ASSERT_THROW(request->Infer(), details::InferenceEngineException);
+}
@@ -47,6 +47,7 @@ public:
 
 class NV12BlobTests : public CompoundBlobTests {};
 class I420BlobTests : public CompoundBlobTests {};
+class ROIBatchedBlobTests : public CompoundBlobTests {};
 
 TEST(BlobConversionTests, canWorkWithMemoryBlob) {
     Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
@@ -425,3 +426,38 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
 }
 
 
+
+TEST_F(ROIBatchedBlobTests, canCreateROIBatchedBlobFromImageAndROIs) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 8, 12}, NHWC));
+    image->allocate();
+    std::vector<ROI> rois = {{0, 0, 0, 4, 4}, {0, 2, 3, 10, 5}, {0, 6, 1, 6, 7}};
+
+    Blob::Ptr blob = make_shared_blob<ROIBatchedBlob>(image, rois);
+    verifyCompoundBlob(blob);
+
+    ROIBatchedBlob::Ptr batched = as<ROIBatchedBlob>(blob);
+    ASSERT_NE(nullptr, batched);
+    EXPECT_EQ(image, batched->image());
+    EXPECT_EQ(rois.size(), batched->size());
+    EXPECT_EQ(SizeVector({3, 3, 8, 12}), batched->getTensorDesc().getDims());
+    EXPECT_EQ(SizeVector({1, 3, 5, 10}), batched->getBlob(1)->getTensorDesc().getDims());
+}
+
+TEST_F(ROIBatchedBlobTests, cannotCreateROIBatchedBlobFromNullptrImage) {
+    EXPECT_THROW(make_shared_blob<ROIBatchedBlob>(nullptr, std::vector<ROI>{{0, 0, 0, 1, 1}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(ROIBatchedBlobTests, cannotCreateROIBatchedBlobFromEmptyROIs) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 8, 12}, NHWC));
+    image->allocate();
+    EXPECT_THROW(make_shared_blob<ROIBatchedBlob>(image, std::vector<ROI>{}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(ROIBatchedBlobTests, cannotCreateROIOfROIBatchedBlob) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 8, 12}, NHWC));
+    image->allocate();
+    Blob::Ptr blob = make_shared_blob<ROIBatchedBlob>(image, std::vector<ROI>{{0, 0, 0, 4, 4}});
+    EXPECT_THROW(blob->createROI({0, 0, 0, 1, 1}), InferenceEngine::details::InferenceEngineException);
+}
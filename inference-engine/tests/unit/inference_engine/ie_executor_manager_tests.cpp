@@ -2,6 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <threading/ie_executor_manager.hpp>
 
@@ -36,3 +41,38 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, sharedStreamsExecutorsTakeTurns) {
+    ExecutorManagerImpl _manager;
+    auto executorA = _manager.getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"SharedStreams", 1, 1});
+    auto executorB = _manager.getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"SharedStreams", 1, 1});
+    ASSERT_NE(executorA, executorB);
+
+    std::promise<void> started, unblock;
+    auto blocker = unblock.get_future().share();
+    executorA->run([&] {
+        started.set_value();
+        blocker.wait();
+    });
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    std::vector<std::future<void>> futures;
+    auto push = [&] (IStreamsExecutor::Ptr& executor, const std::string& name) {
+        auto task = std::make_shared<std::packaged_task<void()>>([&, name] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(name);
+        });
+        futures.emplace_back(task->get_future());
+        executor->run([task] {(*task)();});
+    };
+    push(executorA, "a0");
+    push(executorA, "a1");
+    push(executorA, "a2");
+    push(executorB, "b0");
+    unblock.set_value();
+    for (auto&& future : futures) future.get();
+
+    ASSERT_EQ((std::vector<std::string>{"a0", "b0", "a1", "a2"}), order);
+}
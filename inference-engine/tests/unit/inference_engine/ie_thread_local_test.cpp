@@ -0,0 +1,60 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <threading/ie_thread_local.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+TEST(ThreadLocalTests, keepsValuePerThread) {
+    constexpr int numThreads = 8;
+    ThreadLocal<int> local{-1};
+    vector<thread> threads;
+    vector<int> results(numThreads, 0);
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t] {
+            ASSERT_EQ(-1, local.local());
+            local.local() = t;
+            for (int i = 0; i < 1000; ++i) {
+                local.local() += 1;
+            }
+            results[t] = local.local();
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    for (int t = 0; t < numThreads; ++t) {
+        ASSERT_EQ(t + 1000, results[t]);
+    }
+    int sum = 0;
+    for (auto&& value : local) {
+        sum += value;
+    }
+    ASSERT_EQ(numThreads * 1000 + numThreads * (numThreads - 1) / 2, sum);
+}
+
+TEST(ThreadLocalTests, distinguishesObjectsAtSameAddress) {
+    for (int i = 0; i < 10; ++i) {
+        unique_ptr<ThreadLocal<int>> local{new ThreadLocal<int>{i}};
+        ASSERT_EQ(i, local->local());
+    }
+}
+
+TEST(ThreadLocalTests, followsMovedValues) {
+    ThreadLocal<int> first{1};
+    first.local() = 2;
+    ThreadLocal<int> second{std::move(first)};
+    ASSERT_EQ(2, second.local());
+    ThreadLocal<int> third{3};
+    ASSERT_EQ(3, third.local());
+    third = std::move(second);
+    ASSERT_EQ(2, third.local());
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <threading/ie_thread_safe_containers.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+TEST(ThreadSafeBoundedQueueTests, failsToPushAndPopWithoutCapacity) {
+    ThreadSafeBoundedQueue<int> queue;
+    int value = 0;
+    ASSERT_FALSE(queue.try_push(1));
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(ThreadSafeBoundedQueueTests, keepsOrderAndCapacity) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(ThreadSafeBoundedQueueTests, zeroCapacityClosesQueue) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(2);
+    ASSERT_TRUE(queue.try_push(1));
+    queue.set_capacity(0);
+    int value = 0;
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_FALSE(queue.try_push(2));
+}
+
+// the scheduling pattern of the MULTI device: every thread takes an idle worker and returns it back
+TEST(ThreadSafeBoundedQueueTests, passesAllElementsBetweenThreads) {
+    constexpr int numWorkers = 16;
+    constexpr int numIterations = 100000;
+    const int numThreads = std::max(2u, std::thread::hardware_concurrency());
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    std::vector<std::atomic<int>> owners(numWorkers);
+    for (auto&& owner : owners) {
+        owner = 0;
+    }
+    std::atomic<int> errors{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&] {
+            int worker = -1;
+            for (int i = 0; i < numIterations; ++i) {
+                if (queue.try_pop(worker)) {
+                    if (0 != owners[worker].fetch_add(1)) {
+                        errors++;
+                    }
+                    owners[worker].fetch_sub(1);
+                    if (!queue.try_push(worker)) {
+                        errors++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(0, errors);
+    int value = -1;
+    int count = 0;
+    while (queue.try_pop(value)) {
+        count++;
+    }
+    ASSERT_EQ(numWorkers, count);
+}
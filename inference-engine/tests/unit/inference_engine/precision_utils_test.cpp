@@ -0,0 +1,68 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "precision_utils.h"
+
+using namespace InferenceEngine;
+
+// arrays conversions may be vectorized, results must stay bit exact with per element conversions
+
+TEST(PrecisionUtilsTests, f16tof32ArraysMatchesScalarForAllValues) {
+    std::vector<ie_fp16> src(1 << 16);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<ie_fp16>(i);
+    }
+    const float scale = 1.f, bias = 0.f;
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(), scale, bias);
+
+    for (size_t i = 0; i < src.size(); i++) {
+        // the bias is always added, so -0 becomes 0 like in the arrays conversion
+        const float ref = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+        ASSERT_EQ(0, std::memcmp(&ref, &dst[i], sizeof(float))) << "f16 value 0x" << std::hex << i;
+    }
+}
+
+TEST(PrecisionUtilsTests, f32tof16ArraysMatchesScalar) {
+    std::vector<float> src = {0.f, -0.f, 1.f, -1.f, 0.1f, 65504.f, 65519.f, 65520.f, 1e10f, -1e10f,
+                              6.1035156e-05f, 3.0517578e-05f, 3.0e-05f, 1e-8f, -1e-8f,
+                              std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                              std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min()};
+    for (int i = -1000; i < 1000; i++) {
+        src.push_back(i * 0.731f);
+    }
+    for (const float scale : {1.f, 0.5f, 3.f}) {
+        for (const float bias : {0.f, -2.5f}) {
+            std::vector<ie_fp16> dst(src.size());
+            PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size(), scale, bias);
+            for (size_t i = 0; i < src.size(); i++) {
+                ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * scale + bias), dst[i]) << "f32 value " << src[i];
+            }
+        }
+    }
+}
+
+TEST(PrecisionUtilsTests, ArraysConversionsHandleTails) {
+    for (size_t size = 0; size < 20; size++) {
+        std::vector<float> src(size), back(size + 1, 42.f);
+        for (size_t i = 0; i < size; i++) {
+            src[i] = static_cast<float>(i) - 3.f;
+        }
+        std::vector<ie_fp16> half(size + 1, 0x1234);
+        PrecisionUtils::f32tof16Arrays(half.data(), src.data(), size);
+        PrecisionUtils::f16tof32Arrays(back.data(), half.data(), size);
+
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(src[i], back[i]);
+        }
+        ASSERT_EQ(0x1234, half[size]);
+        ASSERT_EQ(42.f, back[size]);
+    }
+}
@@ -66,4 +66,72 @@ TEST_F(SystemAllocatorTests, canLockAndUnlockAllocatedMemory) {
     EXPECT_EQ(ptr[9999], 11);
     allocator->unlock(ptr);
     allocator->free(handle);
-}
\ No newline at end of file
+}
+
+TEST(NumaAllocatorTests, canWriteAllocatedMemoryAndFreeIt) {
+    NumaMemoryAllocator allocator(0);
+    void *handle = allocator.alloc(10000);
+    ASSERT_NE(handle, nullptr);
+    char *ptr = reinterpret_cast<char *>(allocator.lock(handle));
+    ptr[0] = 1;
+    ptr[9999] = 11;
+    EXPECT_EQ(ptr[9999], 11);
+    allocator.unlock(ptr);
+    EXPECT_TRUE(allocator.free(handle));
+}
+
+TEST(NumaAllocatorTests, cannotFreeForeignHandle) {
+    NumaMemoryAllocator allocator(0);
+    char foreign[16];
+    EXPECT_FALSE(allocator.free(foreign));
+    EXPECT_EQ(allocator.alloc(0), nullptr);
+}
+
+TEST(PooledAllocatorTests, allocatesAlignedBlocks) {
+    PooledMemoryAllocator allocator(false);
+    void *handle = allocator.alloc(100);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(handle) % 64, 0);
+    EXPECT_TRUE(allocator.free(handle));
+    EXPECT_EQ(allocator.alloc(0), nullptr);
+}
+
+TEST(PooledAllocatorTests, reusesFreedBlockOfTheSameSize) {
+    PooledMemoryAllocator allocator(false);
+    void *handle = allocator.alloc(1000);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_TRUE(allocator.free(handle));
+    EXPECT_EQ(allocator.cachedBytes(), 1024);
+    EXPECT_EQ(allocator.alloc(1000), handle);
+    EXPECT_EQ(allocator.cachedBytes(), 0);
+    EXPECT_TRUE(allocator.free(handle));
+}
+
+TEST(PooledAllocatorTests, doesNotCacheBlocksOverLimit) {
+    PooledMemoryAllocator allocator(false, 1024);
+    void *handle0 = allocator.alloc(1024);
+    void *handle1 = allocator.alloc(1024);
+    EXPECT_TRUE(allocator.free(handle0));
+    EXPECT_TRUE(allocator.free(handle1));
+    EXPECT_EQ(allocator.cachedBytes(), 1024);
+}
+
+TEST(PooledAllocatorTests, alignsLargeBlocksToHugePages) {
+    PooledMemoryAllocator allocator(true);
+    const size_t hugePageSize = 2 * 1024 * 1024;
+    void *handle = allocator.alloc(hugePageSize + 1);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(handle) % hugePageSize, 0);
+    char *ptr = reinterpret_cast<char *>(allocator.lock(handle));
+    ptr[hugePageSize] = 11;
+    EXPECT_EQ(ptr[hugePageSize], 11);
+    allocator.unlock(ptr);
+    EXPECT_TRUE(allocator.free(handle));
+    EXPECT_EQ(allocator.cachedBytes(), 2 * hugePageSize);
+}
+
+TEST(PooledAllocatorTests, cannotFreeForeignHandle) {
+    PooledMemoryAllocator allocator(false);
+    char foreign[16];
+    EXPECT_FALSE(allocator.free(foreign));
+}
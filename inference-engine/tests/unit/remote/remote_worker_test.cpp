@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <details/ie_exception.hpp>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "remote_transport.hpp"
+#include "remote_worker.hpp"
+
+using namespace RemotePlugin;
+
+namespace {
+
+std::vector<char> MakeLoadPayload(const std::map<std::string, std::string>& config) {
+    PayloadWriter payload;
+    payload.Append(std::string{"CPU"});
+    payload.Append(static_cast<std::uint64_t>(config.size()));
+    for (auto&& item : config) {
+        payload.Append(item.first);
+        payload.Append(item.second);
+    }
+    payload.Append(std::uint64_t{0});  // inputs
+    payload.Append(std::uint64_t{0});  // outputs
+    payload.Append(std::string{});     // xml
+    payload.Append(std::string{});     // weights
+    return payload._data;
+}
+
+}  // namespace
+
+TEST(RemotePayloadTests, readsWrittenValues) {
+    PayloadWriter writer;
+    writer.Append(std::string{"CPU"});
+    writer.Append(std::uint64_t{42});
+    writer.Append(std::string{});
+
+    PayloadReader reader{writer._data};
+    ASSERT_EQ("CPU", reader.ReadString());
+    ASSERT_EQ(42u, reader.ReadInteger());
+    ASSERT_EQ("", reader.ReadString());
+    ASSERT_THROW(reader.ReadInteger(), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST(RemotePayloadTests, rejectsStringLongerThanPayload) {
+    PayloadWriter writer;
+    writer.Append(std::uint64_t{100});
+    writer._data.resize(writer._data.size() + 3);
+
+    PayloadReader reader{writer._data};
+    ASSERT_THROW(reader.ReadString(), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST(RemoteSocketTests, listenRejectsNotIPv4Address) {
+    ASSERT_THROW(Socket::Listen("localhost:9797", 0), InferenceEngine::details::InferenceEngineException);
+}
+
+class RemoteWorkerTests : public ::testing::Test {
+protected:
+    void TearDown() override {
+        if (_worker.joinable()) {
+            _worker.join();
+        }
+    }
+
+    // runs the worker loop for a single connection on the loopback interface
+    Socket StartWorker() {
+        _listener = Socket::Listen("127.0.0.1", 0);
+        _worker = std::thread([this] {
+            ServeConnection(_core, _listener.Accept(), _options);
+        });
+        return Socket::Connect("127.0.0.1:" + std::to_string(_listener.LocalPort()));
+    }
+
+    static std::string ReadError(Socket& socket) {
+        auto reply = socket.ReadHeader();
+        EXPECT_EQ(static_cast<std::uint32_t>(MessageType::Error), reply.type);
+        auto payload = socket.ReadPayload(reply, kMaxControlPayloadSize);
+        return PayloadReader{payload}.ReadString();
+    }
+
+    InferenceEngine::Core   _core;
+    WorkerOptions           _options;
+    Socket                  _listener;
+    std::thread             _worker;
+};
+
+TEST_F(RemoteWorkerTests, rejectsConfigKeysWritingFiles) {
+    auto socket = StartWorker();
+    auto payload = MakeLoadPayload({{CONFIG_KEY(CACHE_DIR), "."}});
+    MessageHeader header;
+    header.type = static_cast<std::uint32_t>(MessageType::Load);
+    header.size = payload.size();
+    socket.Write(header, payload.data());
+
+    auto error = ReadError(socket);
+    ASSERT_NE(std::string::npos, error.find(CONFIG_KEY(CACHE_DIR))) << error;
+}
+
+TEST_F(RemoteWorkerTests, rejectsNetworkExceedingLimit) {
+    _options.maxNetworkSize = 16;
+    auto socket = StartWorker();
+    // the payload is not sent, the worker must reply without reading it
+    MessageHeader header;
+    header.type = static_cast<std::uint32_t>(MessageType::Load);
+    header.size = std::uint64_t{1} << 40;
+    socket.Write({{&header, sizeof(header)}});
+
+    auto error = ReadError(socket);
+    ASSERT_NE(std::string::npos, error.find("exceeds the limit")) << error;
+}
+
+TEST_F(RemoteWorkerTests, requiresLoadMessageFirst) {
+    auto socket = StartWorker();
+    MessageHeader header;
+    header.type = static_cast<std::uint32_t>(MessageType::Infer);
+    socket.Write(header);
+
+    auto error = ReadError(socket);
+    ASSERT_NE(std::string::npos, error.find("Load")) << error;
+}
@@ -0,0 +1,74 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <vpu/middleend/allocator/allocator.hpp>
+
+namespace vpu {
+
+class AllocateResourcesTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+        ASSERT_NO_FATAL_FAILURE(InitPipeline());
+
+        _testModel = CreateTestModel();
+    }
+
+    void Compile() {
+        _pipeline.run(_testModel.getBaseModel());
+    }
+
+    void InitPipeline() {
+        _pipeline = PassSet();
+        _pipeline.addPass(passManager->dumpModel("before-allocate-resources"));
+        _pipeline.addPass(passManager->allocateResources());
+        _pipeline.addPass(passManager->dumpModel("after-allocate-resources"));
+    }
+
+protected:
+    PassSet _pipeline;
+    TestModel _testModel;
+};
+
+TEST_F(AllocateResourcesTests, DDRIsPackedByLiveRanges) {
+    //
+    // Allocation on the fly leaves the hole of the first small data too small for the large one:
+    //
+    //   Stage 0 : Input -> small 0, small 1
+    //   Stage 1 : small 0 -> small 2
+    //   Stage 2 : small 2 -> large
+    //   Stage 3 : small 1, large -> Output
+    //
+    // so it takes 3 small + 1 large buffers, while live ranges allow 2 small + 1 large.
+    //
+
+    const DataDesc smallDesc{64};
+    const DataDesc largeDesc{128};
+
+    _testModel.createInputs({smallDesc});
+    _testModel.createOutputs({smallDesc});
+
+    _testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::intermediate(smallDesc), OutputInfo::intermediate(smallDesc)});
+    _testModel.addStage({InputInfo::fromPrevStage(0, 0)}, {OutputInfo::intermediate(smallDesc)});
+    _testModel.addStage({InputInfo::fromPrevStage(1)}, {OutputInfo::intermediate(largeDesc)});
+    _testModel.addStage({InputInfo::fromPrevStage(0, 1), InputInfo::fromPrevStage(2)}, {OutputInfo::fromNetwork()});
+
+    ASSERT_NO_THROW(Compile());
+
+    const auto& model = _testModel.getBaseModel();
+    const auto usedMemory = model->attrs().get<UsedMemory>("usedMemory");
+
+    const auto smallSize = smallDesc.totalDimSize() * smallDesc.elemSize();
+    const auto largeSize = largeDesc.totalDimSize() * largeDesc.elemSize();
+    ASSERT_EQ(usedMemory.BSS, 2 * smallSize + largeSize);
+
+    for (const auto& stage : model->getStages()) {
+        ASSERT_TRUE(stage->attrs().has("cmxUsage"));
+    }
+}
+
+} // namespace vpu
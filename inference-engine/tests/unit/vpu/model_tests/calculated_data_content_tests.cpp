@@ -0,0 +1,69 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "vpu/model/data_contents/calculated_data_content.hpp"
+
+namespace {
+
+class CountingContent final : public vpu::CalculatedDataContent {
+public:
+    explicit CountingContent(size_t size) : _size(size) {}
+
+    size_t byteSize() const override {
+        return _size;
+    }
+
+    int numCalculations() const {
+        return _numCalculations;
+    }
+
+protected:
+    void fillTempBuf(void* tempBuf) const override {
+        ++_numCalculations;
+        auto dst = static_cast<uint8_t*>(tempBuf);
+        for (size_t i = 0; i < _size; ++i) {
+            dst[i] = static_cast<uint8_t>(i);
+        }
+    }
+
+private:
+    size_t _size;
+    mutable std::atomic<int> _numCalculations{0};
+};
+
+}  // namespace
+
+TEST(VPU_CalculatedDataContentTest, ConcurrentAccessReturnsSameBuffer) {
+    const size_t size = 1 << 16;
+    const int numThreads = 8;
+    CountingContent content(size);
+
+    std::vector<const uint8_t*> results(numThreads, nullptr);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&content, &results, t] {
+            results[t] = content.get<uint8_t>();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 0; t < numThreads; ++t) {
+        ASSERT_EQ(results[0], results[t]);
+    }
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(static_cast<uint8_t>(i), results[0][i]);
+    }
+
+    const int numCalculations = content.numCalculations();
+    EXPECT_GE(numCalculations, 1);
+    EXPECT_EQ(results[0], content.get<uint8_t>());
+    EXPECT_EQ(numCalculations, content.numCalculations());
+}
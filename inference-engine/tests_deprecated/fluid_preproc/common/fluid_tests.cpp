@@ -659,6 +659,39 @@ TEST_P(ConvertDepthTestGAPI, AccuracyTest)
         EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
     }
 }
+
+TEST_P(ConvertDepthMeanScaleTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int in_depth      = std::get<0>(params);
+    cv::Size sz       = std::get<1>(params);
+    double tolerance  = std::get<2>(params);
+
+    const float mean  = 123.5f;
+    const float scale = 0.017f;
+
+    initMatrixRandU(CV_MAKETYPE(in_depth,1), sz, CV_32FC1);
+
+    // G-API code //////////////////////////////////////////////////////////////
+    ConvertDepthMeanScaleComputation cc(to_test(in_mat1), to_test(out_mat_gapi), mean, scale);
+    cc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ cc.apply(); },
+        400, "ConvDepthMeanScale GAPI %s %dx%d", depthToString(in_mat1.depth()).c_str(), sz.width, sz.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        in_mat1.convertTo(out_mat_ocv, CV_32FC1);
+        out_mat_ocv = (out_mat_ocv - mean) * scale;
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
 //----------------------------------------------------------------------
 
 TEST_P(ResizeTestIE, AccuracyTest)
@@ -180,9 +180,19 @@ INSTANTIATE_TEST_CASE_P(ConvertDepthFluid, ConvertDepthTestGAPI,
                                        cv::Size( 960,  720),
                                        cv::Size( 640,  480),
                                        cv::Size( 300,  300),
-                                       cv::Size( 320,  200)),
+                                       cv::Size( 320,  200),
+                                       cv::Size( 113,   71)),
                                 Values(1)));
 
+INSTANTIATE_TEST_CASE_P(ConvertDepthMeanScaleFluid, ConvertDepthMeanScaleTestGAPI,
+                        Combine(Values(CV_16U, CV_32F, CV_8U),
+                                Values(cv::Size(1920, 1080),
+                                       cv::Size( 640,  480),
+                                       cv::Size( 300,  300),
+                                       cv::Size( 320,  200),
+                                       cv::Size( 113,   71)),
+                                Values(1e-4)));
+
 INSTANTIATE_TEST_CASE_P(ResizeRoiTestFluid, ResizeRoiTestGAPI,
                         Combine(Values(CV_8UC1, CV_8UC3),
                                 Values(cv::INTER_LINEAR),
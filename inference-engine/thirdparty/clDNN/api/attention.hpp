@@ -0,0 +1,80 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "primitive.hpp"
+#include <vector>
+
+namespace cldnn {
+/// @addtogroup cpp_api C++ API
+/// @{
+/// @addtogroup cpp_topology Network Topology
+/// @{
+/// @addtogroup cpp_primitives Primitives
+/// @{
+
+/// @brief Scaled dot-product attention: softmax(scale * query * key^T + mask) * value.
+/// @details Inputs are 4D tensors in [batch, heads, sequence, head size] order (b, f, y, x):
+/// query [B, H, Lq, D], key [B, H, Lk, D] (or [B, H, D, Lk] if @p transpose_key is false) and value [B, H, Lk, Dv].
+/// Optional additive mask is broadcast to [B, H, Lq, Lk]. Output is [B, H, Lq, Dv].
+/// Batch and heads dimensions of query, key and value must be equal, they are not broadcast.
+struct attention : public primitive_base<attention> {
+    CLDNN_DECLARE_PRIMITIVE(attention)
+
+    /// @brief Constructs attention primitive.
+    /// @param id This primitive id.
+    /// @param query Query primitive id.
+    /// @param key Key primitive id.
+    /// @param value Value primitive id.
+    /// @param scale Scale applied to the query-key products.
+    /// @param transpose_key If true, key is given as [B, H, Lk, D] and transposed for the product.
+    attention(const primitive_id& id,
+              const primitive_id& query,
+              const primitive_id& key,
+              const primitive_id& value,
+              float scale = 1.0f,
+              bool transpose_key = true,
+              const padding& output_padding = padding())
+        : primitive_base(id, {query, key, value}, output_padding), scale(scale), transpose_key(transpose_key) {}
+
+    /// @brief Constructs attention primitive with additive mask.
+    /// @param id This primitive id.
+    /// @param query Query primitive id.
+    /// @param key Key primitive id.
+    /// @param value Value primitive id.
+    /// @param mask Mask primitive id, added to the scaled query-key products before softmax.
+    /// @param scale Scale applied to the query-key products.
+    /// @param transpose_key If true, key is given as [B, H, Lk, D] and transposed for the product.
+    attention(const primitive_id& id,
+              const primitive_id& query,
+              const primitive_id& key,
+              const primitive_id& value,
+              const primitive_id& mask,
+              float scale = 1.0f,
+              bool transpose_key = true,
+              const padding& output_padding = padding())
+        : primitive_base(id, {query, key, value, mask}, output_padding), scale(scale), transpose_key(transpose_key) {}
+
+    /// @brief Scale applied to the query-key products.
+    float scale;
+    /// @brief If true, key is given as [B, H, Lk, D] and transposed for the product.
+    bool transpose_key;
+};
+/// @}
+/// @}
+/// @}
+}  // namespace cldnn
@@ -52,6 +52,15 @@ enum class throttle_mode_types : int16_t {
     high
 };
 
+/// @brief Defines available memory allocation types
+enum class allocation_type {
+    unknown,     ///< Not specified (i.e simple_attached_memory class).
+    cl_mem,      ///< Use standard OpenCL cl_mem allocations.
+    usm_host,    ///< Accessible only by host. Not Migratable
+    usm_shared,  ///< Accessible by host and device. Migrtable.
+    usm_device,  ///< Accessible only by device. Not migratable.
+};
+
 /// @brief Configuration parameters for created engine.
 struct engine_configuration {
     const bool enable_profiling;              ///< Enable per-primitive profiling.
@@ -74,6 +83,9 @@ struct engine_configuration {
     uint16_t n_streams;                       ///< Number of queues executed in parallel
     const std::string kernels_cache_path;     ///< Path to compiled kernels cache
     const std::string tuning_cache_path;      ///< Path to tuning kernel cache
+    uint64_t memory_pool_cache_limit;         ///< Max size in bytes of memory released by destroyed networks which is kept
+                                              ///< for reuse by other networks of the engine. 0 (default) means no caching.
+    bool out_of_order_queue;                  ///< Use out-of-order queues where supported, so independent primitives may overlap
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -95,7 +107,9 @@ struct engine_configuration {
         bool memory_pool = true,
         uint16_t n_streams = 1,
         const std::string& kernels_cache_path = "",
-        const std::string& tuning_cache_path = "cache.json")
+        const std::string& tuning_cache_path = "cache.json",
+        uint64_t memory_pool_cache_limit = 0,
+        bool out_of_order_queue = true)
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -109,7 +123,9 @@ struct engine_configuration {
         , enable_memory_pool(memory_pool)
         , n_streams(n_streams)
         , kernels_cache_path(kernels_cache_path)
-        , tuning_cache_path(tuning_cache_path) {
+        , tuning_cache_path(tuning_cache_path)
+        , memory_pool_cache_limit(memory_pool_cache_limit)
+        , out_of_order_queue(out_of_order_queue) {
         if (n_streams == 0) {
             throw std::invalid_argument("Invalid streams count set in engine config");
         }
@@ -172,9 +188,18 @@ struct engine {
     /// @brief Returns total size of currently resources allocated using given engine
     uint64_t get_temp_used_device_memory_size() const;
 
+    /// @brief Returns total size of memory requests served by reusing already allocated resources
+    uint64_t get_reused_device_memory_size() const;
+
+    /// @brief Returns size of resources released by destroyed networks and kept for reuse by other networks
+    uint64_t get_cached_device_memory_size() const;
+
     /// @brief Returns type of the engine.
     engine_types get_type() const;
 
+    /// @brief Checks if the memory of allocation @p type can be allocated explicitly with memory::allocate().
+    bool supports_allocation(allocation_type type) const;
+
     /// @brief get C API engine handler.
     engine_impl* get() const { return _impl; }
 
@@ -21,6 +21,7 @@
 #include "compounds.h"
 #include "layout.hpp"
 #include "engine.hpp"
+#include "event.hpp"
 #include <memory>
 #include <iterator>
 #include <string>
@@ -53,7 +54,10 @@ enum class shared_mem_type {
     shared_mem_vasurface,
 
     /// @brief Structure describes shared D3D11 buffer
-    shared_mem_dxbuffer
+    shared_mem_dxbuffer,
+
+    /// @brief Structure describes unified shared memory allocation, mem is the USM pointer
+    shared_mem_usm
 };
 
 using shared_handle = void*;
@@ -83,6 +87,15 @@ struct memory {
     /// Allocate memory on @p engine using specified @p layout
     static memory allocate(const engine& engine, const layout& layout, uint32_t net_id = 0, bool reset = true);
 
+    /// Allocate memory on @p engine of the specified allocation @p type, e.g. USM host memory
+    /// which is accessed by host and device without copies on integrated GPUs
+    /// @note Use engine::supports_allocation() to check that the @p type is available
+    static memory allocate(const engine& engine, const layout& layout, allocation_type type, uint32_t net_id = 0,
+        bool reset = true);
+
+    /// Returns the allocation type of the memory
+    allocation_type get_allocation_type() const;
+
     /// Create shared memory object on @p engine using user-supplied memory buffer @p buf using specified @p layout
     static memory share_buffer(const engine& engine, const layout& layout, shared_handle buf, uint32_t net_id = 0);
 
@@ -158,6 +171,12 @@ struct memory {
 
     shared_mem_params get_internal_params() const;
 
+    /// @brief Copies memory size bytes from @p host_ptr to the memory without blocking the caller.
+    /// @details Buffers allocated by the engine are written through a separate command queue, so the copy
+    /// may overlap the execution of networks. @p host_ptr must stay valid until the returned @ref event is set.
+    /// The event may be passed as a dependency to network::execute().
+    event copy_from_async(const void* host_ptr) const;
+
     /// Creates the @ref pointer object to get an access memory data
     template <typename T>
     friend struct cldnn::pointer;
@@ -148,6 +148,11 @@ struct network {
     /// @brief Returns @ref event object for particular @p primitive. Can't be called before network execution
     event get_primitive_event(const primitive_id& output_id) const;
 
+    /// @brief Copies the @p output_id output to @p host_ptr after the network execution without blocking the caller.
+    /// @details The next execution of the network doesn't overwrite the output until the copy is finished.
+    /// @p host_ptr must stay valid until the returned @ref event is set. Can't be called before network execution
+    event copy_output_async(const primitive_id& output_id, void* host_ptr) const;
+
     /// @brief Returns @ref network_output object for particular @p output. Can't be called before network execution
     network_output get_output(const primitive_id& output_id) const {
         return network_output(get_primitive_event(output_id), get_output_memory(output_id));
@@ -71,7 +71,11 @@ enum class build_option_type {
     /// @brief Name for serialization process
     serialize_network,
     load_program,
-    force_implementations
+    force_implementations,
+
+    /// @brief Priority and throttle hints of the command queues of networks built from the program
+    /// (default: hints of the engine configuration).
+    queue_hints
 };
 
 /// @brief Tuning mode.
@@ -91,7 +95,12 @@ enum class tuning_mode {
     tuning_use_and_update,
 
     /// @brief Retune the cache data even if it exists.
-    tuning_retune_and_cache
+    tuning_retune_and_cache,
+
+    /// @brief Tuning using the cached data if exist, offline tuning data otherwise.
+    /// @details Missing cache file is not an error and cache file is re-read when it is updated by other programs.
+    /// No tuning and no updates of the cache file.
+    tuning_use_cache_or_offline
 };
 
 /// @brief Tuning configuration.
@@ -161,6 +170,11 @@ struct build_option {
     /// @brief Specifies user defined implementation details to use.
     static std::shared_ptr<const build_option> force_implementations(implementation_forcing_map forcing);
 
+    /// @brief Sets priority and throttle hints of the command queues of networks built from the program.
+    /// @details Disabled hint means the hint of the engine configuration is used.
+    static std::shared_ptr<const build_option> queue_hints(priority_mode_types priority = priority_mode_types::disabled,
+                                                           throttle_mode_types throttle = throttle_mode_types::disabled);
+
     virtual ~build_option() = default;
 
 private:
@@ -310,6 +324,25 @@ private:
     build_option_force_implementations& operator=(const build_option_force_implementations& other) = delete;
 };
 
+/// @brief @ref build_option specialization for command queue hints.
+struct build_option_queue_hints : build_option {
+    /// @brief Priority hint of the command queues.
+    const priority_mode_types priority;
+    /// @brief Throttle hint of the command queues.
+    const throttle_mode_types throttle;
+
+    /// @brief Constructs queue hints option.
+    build_option_queue_hints(priority_mode_types priority, throttle_mode_types throttle)
+        : priority(priority), throttle(throttle) {}
+
+private:
+    /// @brief Returns build_option_type::queue_hints.
+    build_option_type get_type() const override { return build_option_type::queue_hints; }
+
+    build_option_queue_hints(const build_option_queue_hints& other) = delete;
+    build_option_queue_hints& operator=(const build_option_queue_hints& other) = delete;
+};
+
 namespace detail {
 /// @brief Helper template to convert @ref build_option_type value to particular @ref build_option class.
 template <build_option_type OptType>
@@ -381,6 +414,11 @@ struct build_option_traits<build_option_type::force_implementations> {
     using object_type = build_option_force_implementations;
     static std::shared_ptr<const build_option> make_default() { return build_option::force_implementations({}); }
 };
+template <>
+struct build_option_traits<build_option_type::queue_hints> {
+    using object_type = build_option_queue_hints;
+    static std::shared_ptr<const build_option> make_default() { return build_option::queue_hints(); }
+};
 
 #endif
 }  // namespace detail
@@ -430,6 +468,10 @@ inline std::shared_ptr<const build_option> build_option::load_program(const std:
 inline std::shared_ptr<const build_option> build_option::force_implementations(implementation_forcing_map forcing) {
     return std::make_shared<build_option_force_implementations>(std::move(forcing));
 }
+inline std::shared_ptr<const build_option> build_option::queue_hints(priority_mode_types priority,
+                                                                     throttle_mode_types throttle) {
+    return std::make_shared<build_option_queue_hints>(priority, throttle);
+}
 #endif
 
 /// @brief Represents program build options list.
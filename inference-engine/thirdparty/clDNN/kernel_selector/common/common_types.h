@@ -75,7 +75,8 @@ enum class KernelType {
     CTC_GREEDY_DECODER,
     CUM_SUM,
     EMBEDDING_BAG,
-    EXTRACT_IMAGE_PATCHES
+    EXTRACT_IMAGE_PATCHES,
+    ATTENTION
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -462,13 +463,16 @@ enum class TuningMode {
     TUNING_USE_AND_UPDATE,   // Tuning using the cached data and other updating tasks.
                              // Performs updating tasks like removal of invalid caches, promoting to new formats, etc.
                              // No tuning for non-existing data.
-    TUNING_RETUNE_AND_CACHE  // Perform tuning even if the cached data exists.
+    TUNING_RETUNE_AND_CACHE,     // Perform tuning even if the cached data exists.
+    TUNING_USE_CACHE_OR_OFFLINE  // Tuning using the cached data if exist, offline cache data otherwise.
+                                 // Missing cache file is allowed. No tuning for non-existing data.
 };
 
 inline bool UseCached(const TuningMode& mode) {
     return mode == TuningMode::TUNING_USE_CACHE
         || mode == TuningMode::TUNING_TUNE_AND_CACHE
-        || mode == TuningMode::TUNING_USE_AND_UPDATE;
+        || mode == TuningMode::TUNING_USE_AND_UPDATE
+        || mode == TuningMode::TUNING_USE_CACHE_OR_OFFLINE;
 }
 
 inline bool PerformTuning(const TuningMode& mode) {
@@ -0,0 +1,112 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "attention_kernel_ref.h"
+#include "kernel_selector_utils.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace kernel_selector {
+namespace {
+size_t GetKeyLength(const attention_params& params) {
+    const auto& key = params.inputs[1];
+    return params.transpose_key ? key.Y().v : key.X().v;
+}
+}  // namespace
+
+ParamsKey AttentionKernelRef::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    k.EnableDifferentTypes();
+    return k;
+}
+
+bool AttentionKernelRef::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::ATTENTION || o.GetType() != KernelType::ATTENTION)
+        return false;
+
+    const auto& params = static_cast<const attention_params&>(p);
+    if (params.inputs.size() < 3 || params.inputs.size() > 4)
+        return false;
+
+    // all scores of the query row are kept in local memory
+    if (GetKeyLength(params) * sizeof(float) > params.engineInfo.maxLocalMemSize)
+        return false;
+
+    return true;
+}
+
+CommonDispatchData AttentionKernelRef::SetDefault(const attention_params& params, const optional_params&) const {
+    CommonDispatchData dispatchData;
+
+    // one work group computes one query row
+    const size_t local_size = std::min<size_t>(64, static_cast<size_t>(params.engineInfo.maxWorkGroupSize));
+
+    dispatchData.gws = { local_size,
+                         params.output.Y().v,
+                         params.output.Batch().v * params.output.Feature().v };
+    dispatchData.lws = { local_size, 1, 1 };
+
+    return dispatchData;
+}
+
+JitConstants AttentionKernelRef::GetJitConstants(const attention_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+
+    jit.AddConstants({
+        MakeJitConstant("SCALE", params.scale),
+        MakeJitConstant("KEY_LENGTH", GetKeyLength(params)),
+        MakeJitConstant("HEAD_SIZE", params.inputs[0].X().v),
+    });
+
+    if (params.transpose_key)
+        jit.AddConstant(MakeJitConstant("TRANSPOSE_KEY", 1));
+    if (params.inputs.size() == 4)
+        jit.AddConstant(MakeJitConstant("HAS_MASK", 1));
+
+    return jit;
+}
+
+KernelsData AttentionKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options))
+        return {};
+
+    KernelData kd = KernelData::Default<attention_params>(params);
+    attention_params& newParams = *static_cast<attention_params*>(kd.params.get());
+
+    auto dispatchData = SetDefault(newParams, options);
+    auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
+    auto cldnn_jit = GetJitConstants(newParams);
+    std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+    auto& kernel = kd.kernels[0];
+
+    FillCLKernelData(kernel, dispatchData, params.engineInfo, kernelName, jit, entry_point, "", false, false,
+                     static_cast<int>(newParams.inputs.size()));
+
+    kd.estimatedTime = DONT_USE_IF_HAVE_SOMETHING_ELSE;
+
+    return {kd};
+}
+}  // namespace kernel_selector
@@ -0,0 +1,52 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "kernel_base_opencl.h"
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// attention_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct attention_params : public base_params {
+    attention_params() : base_params(KernelType::ATTENTION), scale(1.0f), transpose_key(true) {}
+
+    float scale;
+    bool transpose_key;
+
+    virtual ParamsKey GetParamsKey() const { return base_params::GetParamsKey(); }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// attention_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct attention_optional_params : optional_params {
+    attention_optional_params() : optional_params(KernelType::ATTENTION) {}
+};
+
+class AttentionKernelRef : public KernelBaseOpenCL {
+public:
+    AttentionKernelRef() : KernelBaseOpenCL("attention_ref") {}
+    virtual ~AttentionKernelRef() {}
+    virtual JitConstants GetJitConstants(const attention_params& params) const;
+    virtual CommonDispatchData SetDefault(const attention_params& params, const optional_params&) const;
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+};
+}  // namespace kernel_selector
@@ -30,6 +30,8 @@ struct gemm_params : public base_params {
     bool transpose_input0;
     bool transpose_input1;
     QuantizationType quantization = QuantizationType::NONE;
+    int32_t input0_zero_point = 0;
+    int32_t input1_zero_point = 0;
 
     virtual ParamsKey GetParamsKey() const {
         ParamsKey k = base_params::GetParamsKey();
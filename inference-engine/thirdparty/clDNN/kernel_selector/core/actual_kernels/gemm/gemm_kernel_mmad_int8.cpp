@@ -40,6 +40,7 @@ ParamsKey GemmKernelMMADint8::GetSupportedKey() const {
     k.EnableDifferentTypes();
     k.EnableTensorPitches();
     k.EnableQuantization(QuantizationType::SYMMETRIC);
+    k.EnableQuantization(QuantizationType::ASYMMETRIC_DATA);
 
     return k;
 }
@@ -61,6 +62,11 @@ JitConstants GemmKernelMMADint8::GetJitConstants(const gemm_params& params) cons
     jit.AddConstant(MakeJitConstant("OUTPUT_LEFTOVERS_N", td.size_n % td.simd_size));
     jit.AddConstant(MakeJitConstant("OUTPUT_LEFTOVERS_K", td.size_k % (td.simd_size * td.pack_size)));
 
+    if (params.input0_zero_point != 0)
+        jit.AddConstant(MakeJitConstant("INPUT0_ZERO_POINT", params.input0_zero_point));
+    if (params.input1_zero_point != 0)
+        jit.AddConstant(MakeJitConstant("INPUT1_ZERO_POINT", params.input1_zero_point));
+
     if (!params.fused_ops.empty()) {
         auto input_dt = GetActivationType(params);
         FusedOpsConfiguration conf = { "", {"b", "f", "output_y", "output_x"}, "dequantized", input_dt, 1 };
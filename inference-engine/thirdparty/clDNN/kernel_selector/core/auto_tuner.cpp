@@ -25,9 +25,23 @@
 #include <memory>
 #include <utility>
 #include <tuple>
+#include <thread>
+#include <cstdio>
+#include <functional>
+#include <sys/stat.h>
 
 namespace kernel_selector {
 
+namespace {
+// Returns string identifying current state of the file, or empty string if the file doesn't exist.
+std::string GetFileStamp(const std::string& filePath) {
+    struct stat fileStat;
+    if (stat(filePath.c_str(), &fileStat) != 0)
+        return "";
+    return std::to_string(static_cast<int64_t>(fileStat.st_mtime)) + "_" + std::to_string(static_cast<int64_t>(fileStat.st_size));
+}
+}  // namespace
+
 TuningCache::TuningCache(const std::string& cacheFilePath, bool createMode)
     : cache(), needsSave(false) {
     // Read cache file
@@ -207,7 +221,12 @@ void TuningCache::StoreKernel(const Params& params, uint32_t computeUnitsCount,
     implDetails.PushBack(implName, cache.GetAllocator());
     implDetails.PushBack(implIndex, cache.GetAllocator());
 
-    deviceCache.AddMember(paramName, implDetails, cache.GetAllocator());
+    auto paramIt = deviceCache.FindMember(paramStr.c_str());
+    if (paramIt != deviceCache.MemberEnd()) {
+        paramIt->value = implDetails;
+    } else {
+        deviceCache.AddMember(paramName, implDetails, cache.GetAllocator());
+    }
 
     // Remove from old version if present
     RemoveKernel_v1(params, computeUnitsCount);
@@ -271,7 +290,9 @@ bool TuningCache::RemoveKernel_v2(const Params& params, uint32_t computeUnitsCou
 }
 
 void TuningCache::Save(const std::string& cacheFilePath) {
-    std::ofstream cachedKernelsFile(cacheFilePath);
+    const std::string tmpFilePath = cacheFilePath + ".tmp" +
+        std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    std::ofstream cachedKernelsFile(tmpFilePath);
     rapidjson::StringBuffer buffer(0, 1024);
     rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
     writer.SetFormatOptions(rapidjson::PrettyFormatOptions::kFormatSingleLineArray);
@@ -280,21 +301,41 @@ void TuningCache::Save(const std::string& cacheFilePath) {
     cachedKernelsFile << temp;
     cachedKernelsFile.close();
 
+    if (std::rename(tmpFilePath.c_str(), cacheFilePath.c_str()) != 0) {
+        // rename doesn't replace existing files on Windows
+        std::remove(cacheFilePath.c_str());
+        if (std::rename(tmpFilePath.c_str(), cacheFilePath.c_str()) != 0) {
+            std::remove(tmpFilePath.c_str());
+            throw std::runtime_error("Tuning file: " + cacheFilePath + " could not be written!");
+        }
+    }
+
     needsSave = false;
 }
 
+void AutoTuner::LoadCacheIfNeeded(const std::string& cacheFilePath, bool createMode) {
+    auto stamp = GetFileStamp(cacheFilePath);
+    if (!onlineCache || lastCachePath != cacheFilePath || lastCacheStamp != stamp) {
+        onlineCache = std::make_shared<TuningCache>(cacheFilePath, createMode);
+        lastCachePath = cacheFilePath;
+        lastCacheStamp = stamp;
+    }
+}
+
+void AutoTuner::SaveCache(const std::string& cacheFilePath) {
+    onlineCache->Save(cacheFilePath);
+    lastCacheStamp = GetFileStamp(cacheFilePath);
+}
+
 std::tuple<std::string, int> AutoTuner::LoadKernelOnline(const TuningMode tuningMode,
                                                          const std::string& cacheFilePath,
                                                          const Params& params) {
     std::lock_guard<std::mutex> lock(mutex);
-    if (!onlineCache || lastCachePath != cacheFilePath) {
-        onlineCache = std::make_shared<TuningCache>(cacheFilePath, PerformTuning(tuningMode));
-        lastCachePath = cacheFilePath;
-    }
+    LoadCacheIfNeeded(cacheFilePath, PerformTuning(tuningMode) || tuningMode == TuningMode::TUNING_USE_CACHE_OR_OFFLINE);
     auto result = onlineCache->LoadKernel(params, PerformUpdates(tuningMode));
 
     if (onlineCache->NeedsSave() && PerformUpdates(tuningMode)) {
-        onlineCache->Save(cacheFilePath);
+        SaveCache(cacheFilePath);
     }
     return result;
 }
@@ -304,24 +345,19 @@ void AutoTuner::StoreKernel(const std::string& cacheFilePath,
                             std::string implementationName,
                             const int tuneIndex) {
     std::lock_guard<std::mutex> lock(mutex);
-    if (!onlineCache || lastCachePath != cacheFilePath) {
-        onlineCache = std::make_shared<TuningCache>(cacheFilePath, true);
-        lastCachePath = cacheFilePath;
-    }
+    // Re-read the file if it was updated by other programs to not lose their results
+    LoadCacheIfNeeded(cacheFilePath, true);
     onlineCache->StoreKernel(params, implementationName, tuneIndex);
-    onlineCache->Save(cacheFilePath);
+    SaveCache(cacheFilePath);
 }
 
 void AutoTuner::RemoveKernel(const std::string& cacheFilePath,
                              const Params& params) {
     std::lock_guard<std::mutex> lock(mutex);
-    if (!onlineCache || lastCachePath != cacheFilePath) {
-        onlineCache = std::make_shared<TuningCache>(cacheFilePath, false);
-        lastCachePath = cacheFilePath;
-    }
+    LoadCacheIfNeeded(cacheFilePath, false);
     onlineCache->RemoveKernel(params);
     if (onlineCache->NeedsSave()) {
-        onlineCache->Save(cacheFilePath);
+        SaveCache(cacheFilePath);
     }
 }
 
@@ -54,6 +54,7 @@ public:
     // Removes the cached kernel for specified params if it exists, for all cache versions.
     void RemoveKernel(const Params& params);
     // Saves the internal cache to specified file.
+    // The file is written to a temporary file first and then renamed, so concurrent readers never see partial data.
     void Save(const std::string& cacheFilePath);
 
     bool NeedsSave() const { return needsSave; }
@@ -89,7 +90,12 @@ public:
                                                    const Params& params);
 
 private:
+    // (Re)loads online cache if it was not loaded yet for specified path or the file was changed by somebody else.
+    void LoadCacheIfNeeded(const std::string& cacheFilePath, bool createMode);
+    void SaveCache(const std::string& cacheFilePath);
+
     std::string lastCachePath;
+    std::string lastCacheStamp;
     std::shared_ptr<TuningCache> onlineCache;
     std::mutex mutex;  // Mutex to synchronize cache updates
 
@@ -0,0 +1,73 @@
+// Copyright (c) 2020-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+KERNEL(attention_ref)(const __global INPUT0_TYPE* query,
+                      const __global INPUT1_TYPE* key,
+                      const __global INPUT2_TYPE* value,
+#if HAS_MASK
+                      const __global INPUT3_TYPE* mask,
+#endif
+                      __global OUTPUT_TYPE* output)
+{
+    const uint lid = (uint)get_local_id(0);
+    const uint lws = (uint)get_local_size(0);
+    const uint q = (uint)get_global_id(1);
+    const uint b = (uint)get_global_id(2) / OUTPUT_FEATURE_NUM;
+    const uint h = (uint)get_global_id(2) % OUTPUT_FEATURE_NUM;
+
+    __local float scores[KEY_LENGTH];
+
+    // scaled query-key products with additive mask
+    for (uint k = lid; k < KEY_LENGTH; k += lws) {
+        float score = 0.0f;
+        for (uint d = 0; d < HEAD_SIZE; ++d) {
+#if TRANSPOSE_KEY
+            const uint key_idx = INPUT1_GET_INDEX(b, h, k, d);
+#else
+            const uint key_idx = INPUT1_GET_INDEX(b, h, d, k);
+#endif
+            score += (float)query[INPUT0_GET_INDEX(b, h, q, d)] * (float)key[key_idx];
+        }
+        score *= SCALE;
+#if HAS_MASK
+        score += (float)mask[INPUT3_GET_INDEX(b % INPUT3_BATCH_NUM, h % INPUT3_FEATURE_NUM, q % INPUT3_SIZE_Y, k)];
+#endif
+        scores[k] = score;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // softmax along the row, the row is short enough to be scanned by each work item
+    float max_score = scores[0];
+    for (uint k = 1; k < KEY_LENGTH; ++k)
+        max_score = fmax(max_score, scores[k]);
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (uint k = lid; k < KEY_LENGTH; k += lws)
+        scores[k] = exp(scores[k] - max_score);
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    float denominator = 0.0f;
+    for (uint k = 0; k < KEY_LENGTH; ++k)
+        denominator += scores[k];
+
+    // probabilities by values
+    for (uint v = lid; v < OUTPUT_SIZE_X; v += lws) {
+        float acc = 0.0f;
+        for (uint k = 0; k < KEY_LENGTH; ++k)
+            acc += scores[k] * (float)value[INPUT2_GET_INDEX(b, h, k, v)];
+        output[OUTPUT_GET_INDEX(b, h, q, v)] = TO_OUTPUT_TYPE(acc / denominator);
+    }
+}
@@ -98,6 +98,18 @@ inline uint FUNC(get_current_input0_offset)(uint common_input0_offset, uint i, u
 #endif // !TRANSPOSE_INPUT0
 }
 
+#ifdef INPUT0_ZERO_POINT
+// Sum of the input1 column of the work item over the rows of the tile, used for input0 zero point compensation
+inline int FUNC(get_input1_column_sum)(PACKED_INPUT1_TYPE_VEC tile_input1) {
+    int sum = 0;
+    for (uint i = 0; i < SUB_GROUP_SIZE; i++) {
+        MAKE_VECTOR_TYPE(INPUT1_TYPE, PACK_SIZE) unpacked = AS_TYPE(MAKE_VECTOR_TYPE(INPUT1_TYPE, PACK_SIZE), tile_input1[i]);
+        sum += (int)unpacked.s0 + (int)unpacked.s1 + (int)unpacked.s2 + (int)unpacked.s3;
+    }
+    return sum;
+}
+#endif // INPUT0_ZERO_POINT
+
 __attribute__((reqd_work_group_size(SUB_GROUP_SIZE, 1, 1)))
 __attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE)))
 KERNEL(gemm_mmad_int8)(
@@ -163,6 +175,13 @@ KERNEL(gemm_mmad_int8)(
 #endif // INPUT2_TYPE
 
     ACCUMULATOR_TYPE_VEC tile_output = (ACCUMULATOR_TYPE_VEC)(ACCUMULATOR_VAL_ZERO);
+#ifdef INPUT0_ZERO_POINT
+    int input1_column_sum = 0;
+#endif // INPUT0_ZERO_POINT
+#ifdef INPUT1_ZERO_POINT
+    const PACKED_INPUT1_TYPE_VEC tile_ones = (PACKED_INPUT1_TYPE_VEC)(0x01010101);
+    ACCUMULATOR_TYPE_VEC input0_row_sum = (ACCUMULATOR_TYPE_VEC)(ACCUMULATOR_VAL_ZERO);
+#endif // INPUT1_ZERO_POINT
 
 #if !TRANSPOSE_INPUT0
     const uint K_BLOCK_NUM = (INPUT0_SIZE_X - 1) / TILE_SIZE_K + 1;
@@ -257,8 +276,24 @@ KERNEL(gemm_mmad_int8)(
         }
 
         tile_output = MMAD(tile_input0, tile_input1, tile_output);
+#ifdef INPUT0_ZERO_POINT
+        input1_column_sum += FUNC_CALL(get_input1_column_sum)(tile_input1);
+#endif // INPUT0_ZERO_POINT
+#ifdef INPUT1_ZERO_POINT
+        input0_row_sum = MMAD(tile_input0, tile_ones, input0_row_sum);
+#endif // INPUT1_ZERO_POINT
     }
 
+#ifdef INPUT0_ZERO_POINT
+    tile_output -= (ACCUMULATOR_TYPE_VEC)(INPUT0_ZERO_POINT * input1_column_sum);
+#endif // INPUT0_ZERO_POINT
+#ifdef INPUT1_ZERO_POINT
+    tile_output -= INPUT1_ZERO_POINT * input0_row_sum;
+#endif // INPUT1_ZERO_POINT
+#if defined(INPUT0_ZERO_POINT) && defined(INPUT1_ZERO_POINT)
+    tile_output += (ACCUMULATOR_TYPE_VEC)((int)K_SIZE * INPUT0_ZERO_POINT * INPUT1_ZERO_POINT);
+#endif // defined(INPUT0_ZERO_POINT) && defined(INPUT1_ZERO_POINT)
+
 #if HAS_FUSED_OPS && FUSED_OPS_CAN_USE_PRELOAD
     FUSED_OPS_PRELOAD;
 #endif // HAS_FUSED_OPS && FUSED_OPS_CAN_USE_PRELOAD
@@ -337,6 +372,16 @@ KERNEL(gemm_mmad_int8)(
 #if TILE_NUM == 2
     ACCUMULATOR_TYPE_VEC tile_output01 = (ACCUMULATOR_TYPE_VEC)(ACCUMULATOR_VAL_ZERO);
 #endif // TILE_NUM == 2
+#ifdef INPUT0_ZERO_POINT
+    int input1_column_sum = 0;
+#endif // INPUT0_ZERO_POINT
+#ifdef INPUT1_ZERO_POINT
+    const PACKED_INPUT1_TYPE_VEC tile_ones = (PACKED_INPUT1_TYPE_VEC)(0x01010101);
+    ACCUMULATOR_TYPE_VEC input0_row_sum00 = (ACCUMULATOR_TYPE_VEC)(ACCUMULATOR_VAL_ZERO);
+#if TILE_NUM == 2
+    ACCUMULATOR_TYPE_VEC input0_row_sum01 = (ACCUMULATOR_TYPE_VEC)(ACCUMULATOR_VAL_ZERO);
+#endif // TILE_NUM == 2
+#endif // INPUT1_ZERO_POINT
 
 #if !TRANSPOSE_INPUT0
     const uint K_BLOCK_NUM = INPUT0_SIZE_X / TILE_SIZE_K;
@@ -404,6 +449,10 @@ KERNEL(gemm_mmad_int8)(
 
 #endif // !TRANSPOSE_INPUT1
 
+#ifdef INPUT0_ZERO_POINT
+        input1_column_sum += FUNC_CALL(get_input1_column_sum)(tile_input10);
+#endif // INPUT0_ZERO_POINT
+
 #if !TRANSPOSE_INPUT0
         const uint common_input0_offset = batch_offset_input0 + output_y_tile * TILE_SIZE_M * INPUT0_SIZE_X + k * TILE_SIZE_K;
 
@@ -412,6 +461,9 @@ KERNEL(gemm_mmad_int8)(
         }
 
         tile_output00 = MMAD(tile_input00, tile_input10, tile_output00);
+#ifdef INPUT1_ZERO_POINT
+        input0_row_sum00 = MMAD(tile_input00, tile_ones, input0_row_sum00);
+#endif // INPUT1_ZERO_POINT
 
 #if TILE_NUM == 2
         for (uint i = 0; i < SUB_GROUP_SIZE; i++) {
@@ -419,6 +471,9 @@ KERNEL(gemm_mmad_int8)(
         }
 
         tile_output01 = MMAD(tile_input00, tile_input10, tile_output01);
+#ifdef INPUT1_ZERO_POINT
+        input0_row_sum01 = MMAD(tile_input00, tile_ones, input0_row_sum01);
+#endif // INPUT1_ZERO_POINT
 #endif // TILE_NUM == 2
 
 #else // !TRANSPOSE_INPUT0
@@ -435,6 +490,9 @@ KERNEL(gemm_mmad_int8)(
         }
 
         tile_output00 = MMAD(tile_input00, tile_input10, tile_output00);
+#ifdef INPUT1_ZERO_POINT
+        input0_row_sum00 = MMAD(tile_input00, tile_ones, input0_row_sum00);
+#endif // INPUT1_ZERO_POINT
 
 #if TILE_NUM == 2
         for (uint i = 0; i < SUB_GROUP_SIZE; i++) {
@@ -447,11 +505,33 @@ KERNEL(gemm_mmad_int8)(
         }
 
         tile_output01 = MMAD(tile_input00, tile_input10, tile_output01);
+#ifdef INPUT1_ZERO_POINT
+        input0_row_sum01 = MMAD(tile_input00, tile_ones, input0_row_sum01);
+#endif // INPUT1_ZERO_POINT
 #endif // TILE_NUM == 2
 
 #endif // !TRANSPOSE_INPUT0
     }
 
+#ifdef INPUT0_ZERO_POINT
+    tile_output00 -= (ACCUMULATOR_TYPE_VEC)(INPUT0_ZERO_POINT * input1_column_sum);
+#if TILE_NUM == 2
+    tile_output01 -= (ACCUMULATOR_TYPE_VEC)(INPUT0_ZERO_POINT * input1_column_sum);
+#endif // TILE_NUM == 2
+#endif // INPUT0_ZERO_POINT
+#ifdef INPUT1_ZERO_POINT
+    tile_output00 -= INPUT1_ZERO_POINT * input0_row_sum00;
+#if TILE_NUM == 2
+    tile_output01 -= INPUT1_ZERO_POINT * input0_row_sum01;
+#endif // TILE_NUM == 2
+#endif // INPUT1_ZERO_POINT
+#if defined(INPUT0_ZERO_POINT) && defined(INPUT1_ZERO_POINT)
+    tile_output00 += (ACCUMULATOR_TYPE_VEC)((int)(K_BLOCK_NUM * TILE_SIZE_K) * INPUT0_ZERO_POINT * INPUT1_ZERO_POINT);
+#if TILE_NUM == 2
+    tile_output01 += (ACCUMULATOR_TYPE_VEC)((int)(K_BLOCK_NUM * TILE_SIZE_K) * INPUT0_ZERO_POINT * INPUT1_ZERO_POINT);
+#endif // TILE_NUM == 2
+#endif // defined(INPUT0_ZERO_POINT) && defined(INPUT1_ZERO_POINT)
+
 #if HAS_FUSED_OPS && FUSED_OPS_CAN_USE_PRELOAD
     FUSED_OPS_PRELOAD;
 #endif // HAS_FUSED_OPS && FUSED_OPS_CAN_USE_PRELOAD
@@ -19,6 +19,7 @@
 #include <string>
 #include <memory>
 #include <utility>
+#include <atomic>
 
 #include <quantize/quantize_kernel_params.h>
 #include <eltwise/eltwise_kernel_base.h>
@@ -1460,7 +1461,7 @@ JitConstants FusedOpsCodeGenerator::MakeLoadJitConstants(const FusedOpsConfigura
     auto fused_op_config = conf;
 
     std::string load_decls = "";
-    static int i = 0;
+    static std::atomic<int> i{0};
     // TODO: check if there is a use case for index reuse or it can be removed
     bool reuse_index = false;
     bool safe_load = conf.boundary_check == FusedOpsConfiguration::BoundaryCheck::ENABLED;
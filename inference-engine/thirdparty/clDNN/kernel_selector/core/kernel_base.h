@@ -64,7 +64,8 @@ public:
     virtual const std::string GetName() const { return kernelName; }
 
     static const primitive_db& get_db() { return db; }
-    static void ResetCounter() { counter = 0; }
+    static void ResetCounter(size_t value = 0) { counter = value; }
+    static size_t GetCounter() { return counter; }
 
 protected:
     static const primitive_db db;
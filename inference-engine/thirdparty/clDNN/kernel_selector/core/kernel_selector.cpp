@@ -141,6 +141,12 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
         cachedKernelConfig = autoTuner.LoadKernelOnline(options.tuningParams.mode,
                                                         options.tuningParams.cacheFilePath,
                                                         params);
+#if ENABLE_OFFLINE_TUNING_CACHE
+        if (std::get<0>(cachedKernelConfig).empty() &&
+            options.tuningParams.mode == TuningMode::TUNING_USE_CACHE_OR_OFFLINE) {
+            cachedKernelConfig = autoTuner.LoadKernelOffline(params.engineInfo.deviceCache, params);
+        }
+#endif
     }
     bool hashFoundInCache = !std::get<0>(cachedKernelConfig).empty();
 
@@ -0,0 +1,109 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "attention_inst.h"
+
+#include "primitive_type_base.h"
+#include "error_handler.h"
+#include "json_object.h"
+#include <string>
+
+namespace cldnn {
+primitive_type_id attention::type_id() {
+    static primitive_type_base<attention> instance;
+    return &instance;
+}
+
+layout attention_inst::calc_output_layout(attention_node const& node) {
+    auto prim = node.get_primitive();
+
+    auto query_layout = node.input(0).get_output_layout();
+    auto value_layout = node.input(2).get_output_layout();
+
+    auto output_size = query_layout.size;
+    output_size.spatial[0] = value_layout.size.spatial[0];
+
+    return layout(query_layout.data_type, query_layout.format, output_size, prim->output_padding);
+}
+
+std::string attention_inst::to_string(attention_node const& node) {
+    auto desc = node.get_primitive();
+    auto node_info = node.desc_to_json();
+
+    std::stringstream primitive_description;
+
+    json_composite attention_info;
+    attention_info.add("query id", node.input(0).id());
+    attention_info.add("key id", node.input(1).id());
+    attention_info.add("value id", node.input(2).id());
+    if (node.has_mask())
+        attention_info.add("mask id", node.input(3).id());
+    attention_info.add("scale", desc->scale);
+    attention_info.add("transpose key", desc->transpose_key);
+
+    node_info->add("attention info", attention_info);
+    node_info->dump(primitive_description);
+
+    return primitive_description.str();
+}
+
+attention_inst::typed_primitive_inst(network_impl& network, attention_node const& node) : parent(network, node) {
+    auto query_layout = node.input(0).get_output_layout();
+    auto key_layout = node.input(1).get_output_layout();
+    auto value_layout = node.input(2).get_output_layout();
+    bool transpose_key = node.get_primitive()->transpose_key;
+
+    auto key_head_size = transpose_key ? key_layout.size.spatial[0] : key_layout.size.spatial[1];
+    auto key_length = transpose_key ? key_layout.size.spatial[1] : key_layout.size.spatial[0];
+
+    for (auto& input_layout : { key_layout, value_layout }) {
+        CLDNN_ERROR_NOT_EQUAL(node.id(),
+                              "Query batch size",
+                              query_layout.size.batch[0],
+                              "Key/value batch size",
+                              input_layout.size.batch[0],
+                              "");
+        CLDNN_ERROR_NOT_EQUAL(node.id(),
+                              "Query heads number",
+                              query_layout.size.feature[0],
+                              "Key/value heads number",
+                              input_layout.size.feature[0],
+                              "");
+    }
+    CLDNN_ERROR_NOT_EQUAL(node.id(),
+                          "Query head size",
+                          query_layout.size.spatial[0],
+                          "Key head size",
+                          key_head_size,
+                          "");
+    CLDNN_ERROR_NOT_EQUAL(node.id(),
+                          "Key sequence length",
+                          key_length,
+                          "Value sequence length",
+                          value_layout.size.spatial[1],
+                          "");
+
+    if (node.has_mask()) {
+        auto mask_layout = node.input(3).get_output_layout();
+        CLDNN_ERROR_NOT_EQUAL(node.id(),
+                              "Key sequence length",
+                              key_length,
+                              "Mask columns number",
+                              mask_layout.size.spatial[0],
+                              "");
+    }
+}
+}  // namespace cldnn
@@ -66,6 +66,18 @@ uint64_t engine::get_temp_used_device_memory_size() const {
     return _impl->get_used_device_memory();
 }
 
+uint64_t engine::get_reused_device_memory_size() const {
+    return _impl->get_memory_pool().get_reused_memory();
+}
+
+uint64_t engine::get_cached_device_memory_size() const {
+    return _impl->get_memory_pool().get_cached_memory();
+}
+
+bool engine::supports_allocation(allocation_type type) const {
+    return _impl->supports_allocation(type);
+}
+
 engine_types engine::get_type() const {
     return _impl->type();
 }
@@ -86,7 +98,7 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf) {
     result.meaningful_kernels_names = conf.meaningful_kernels_names != 0;
     result.dump_custom_program = conf.dump_custom_program != 0;
     result.single_kernel_name = conf.single_kernel_name;
-    result.host_out_of_order = true;
+    result.host_out_of_order = conf.out_of_order_queue;
     result.use_unifed_shared_memory = true;  // Switch on/off USM.
     result.log = conf.engine_log;
     result.ocl_sources_dumps_dir = conf.sources_dumps_dir;
@@ -281,8 +293,6 @@ bool engine_impl::use_unified_shared_memory() const {
 bool engine_impl::supports_allocation(allocation_type type) const {
     if (memory_capabilities::is_usm_type(type) && !use_unified_shared_memory())
         return false;
-    if (allocation_type::usm_shared == type)
-        return false;
     return get_context()->memory_caps().support_allocation_type(type);
 }
 
@@ -296,12 +306,11 @@ allocation_type engine_impl::get_lockable_preffered_memory_allocation_type(bool
         Const buffers are propagated to device if possible.
     */
 
-    bool support_usm_host = supports_allocation(allocation_type::usm_host);
-    bool support_usm_shared = supports_allocation(allocation_type::usm_shared);
-
-    if (support_usm_shared)
-        return allocation_type::usm_shared;
-    if (support_usm_host)
+    /*
+        Shared allocations are used only when requested explicitly,
+        host memory is preferred for the lockable buffers.
+    */
+    if (supports_allocation(allocation_type::usm_host))
         return allocation_type::usm_host;
 
     throw std::runtime_error("[clDNN internal error] Could not find proper allocation type!");
@@ -0,0 +1,71 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "attention_inst.h"
+#include "primitive_gpu_base.h"
+#include "implementation_map.h"
+#include "kernel_selector_helper.h"
+#include "attention/attention_kernel_selector.h"
+#include "attention/attention_kernel_ref.h"
+#include "error_handler.h"
+
+using namespace cldnn;
+
+namespace cldnn {
+namespace gpu {
+
+struct attention_gpu : typed_primitive_gpu_impl<attention> {
+    using parent = typed_primitive_gpu_impl<attention>;
+    using parent::parent;
+
+public:
+    static primitive_impl* create(const attention_node& arg) {
+        auto attention_params = get_default_params<kernel_selector::attention_params>(arg);
+        auto attention_optional_params =
+            get_default_optional_params<kernel_selector::attention_optional_params>(arg.get_program());
+
+        for (size_t i = 1; i < arg.inputs_count(); i++) {
+            attention_params.inputs.push_back(convert_data_tensor(arg.input(i).get_output_layout()));
+        }
+
+        attention_params.scale = arg.get_primitive()->scale;
+        attention_params.transpose_key = arg.get_primitive()->transpose_key;
+
+        auto& kernel_selector = kernel_selector::attention_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(attention_params, attention_optional_params);
+
+        CLDNN_ERROR_BOOL(arg.id(),
+                         "Best_kernel.empty()",
+                         best_kernels.empty(),
+                         "Cannot find a proper kernel with this arguments");
+
+        auto attention = new attention_gpu(arg, best_kernels[0]);
+
+        return attention;
+    }
+};
+
+namespace detail {
+
+attach_attention_gpu::attach_attention_gpu() {
+    auto val_fw = attention_gpu::create;
+    implementation_map<attention>::add(std::make_tuple(engine_types::ocl, data_types::f16, format::bfyx), val_fw);
+    implementation_map<attention>::add(std::make_tuple(engine_types::ocl, data_types::f32, format::bfyx), val_fw);
+}
+
+}  // namespace detail
+}  // namespace gpu
+}  // namespace cldnn
@@ -44,8 +44,13 @@ public:
         gemm_params.transpose_input0 = desc->transpose_input0;
         gemm_params.transpose_input1 = desc->transpose_input1;
 
-        if (arg.get_output_layout().data_type == data_types::i8 ||
-            arg.get_output_layout().data_type == data_types::u8) {
+        gemm_params.input0_zero_point = arg.get_input0_zero_point();
+        gemm_params.input1_zero_point = arg.get_input1_zero_point();
+
+        if (gemm_params.input0_zero_point != 0 || gemm_params.input1_zero_point != 0) {
+            gemm_params.quantization = kernel_selector::QuantizationType::ASYMMETRIC_DATA;
+        } else if (arg.get_output_layout().data_type == data_types::i8 ||
+                   arg.get_output_layout().data_type == data_types::u8) {
             gemm_params.quantization = kernel_selector::QuantizationType::SYMMETRIC;
         } else {
             gemm_params.quantization = kernel_selector::QuantizationType::NONE;
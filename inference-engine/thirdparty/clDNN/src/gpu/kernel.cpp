@@ -21,6 +21,7 @@
 #include "memory_gpu.h"
 #include "memory_impl.h"
 #include "refcounted_obj.h"
+#include <cstring>
 #include <vector>
 
 namespace cldnn {
@@ -40,203 +41,152 @@ inline cl::NDRange toNDRange(const std::vector<size_t>& v) {
     }
 }
 
+using bound_arguments = std::vector<kernel::bound_argument>;
+
+// Sets the argument unless the cl kernel already has the same value of it
+template <typename T>
+cl_int set_arg(kernels_cache::kernel_type& kernel, uint32_t idx, const T& value, bound_arguments& bound) {
+    static_assert(sizeof(T) <= sizeof(uint64_t), "scalar kernel argument doesn't fit into bound argument cache");
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T));
+    if (bound[idx].is_set && bound[idx].value == bits)
+        return CL_SUCCESS;
+
+    bound[idx].is_set = false;
+    cl_int status = kernel.setArg(idx, value);
+    if (status == CL_SUCCESS) {
+        bound[idx].is_set = true;
+        bound[idx].value = bits;
+    }
+    return status;
+}
+
+cl_int set_memory_arg(kernels_cache::kernel_type& kernel, uint32_t idx, const memory_impl& mem, bound_arguments& bound) {
+    const bool is_image = mem.get_layout().format.is_image_2d();
+    const bool is_usm = !is_image && memory_capabilities::is_usm_type(mem.get_allocation_type());
+    // a released buffer handle may be given to a new buffer, so the memory is identified by its id
+    const auto bits = mem.get_unique_id();
+    if (bound[idx].is_set && bound[idx].value == bits)
+        return CL_SUCCESS;
+
+    bound[idx].is_set = false;
+    cl_int status = CL_INVALID_ARG_VALUE;
+    if (is_image)
+        status = kernel.setArg(idx, dynamic_cast<const gpu::gpu_image2d&>(mem).get_buffer());
+    else if (is_usm)
+        status = kernel.setArgUsm(idx, dynamic_cast<const gpu::gpu_usm&>(mem).get_buffer());
+    else
+        status = kernel.setArg(idx, dynamic_cast<const gpu::gpu_buffer&>(mem).get_buffer());
+    if (status == CL_SUCCESS) {
+        bound[idx].is_set = true;
+        bound[idx].value = bits;
+    }
+    return status;
+}
+
 void set_arguments_impl(kernels_cache::kernel_type& kernel,
                         const kernel_selector::kernel_arguments& args,
-                        const kernel::kernel_arguments_data& data) {
+                        const kernel::kernel_arguments_data& data,
+                        bound_arguments& bound) {
+    bound.resize(args.size());
     for (uint32_t i = 0; i < static_cast<uint32_t>(args.size()); i++) {
         cl_int status = CL_INVALID_ARG_VALUE;
+        memory_impl::cptr mem;
         switch (args[i].t) {
             case kernel_selector::kernel_argument_types::INPUT:
-                if (args[i].index < data.inputs.size() && data.inputs[args[i].index]) {
-                    const auto& input_mem = data.inputs[args[i].index];
-                    if (input_mem) {
-                        if (input_mem->get_layout().format.is_image_2d())
-                            status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*input_mem).get_buffer());
-                        else if (memory_capabilities::is_usm_type(input_mem->get_allocation_type()))
-                            status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*input_mem).get_buffer());
-                        else
-                            status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*input_mem).get_buffer());
-                    }
-                }
+                if (args[i].index < data.inputs.size())
+                    mem = data.inputs[args[i].index];
                 break;
             case kernel_selector::kernel_argument_types::INPUT_OF_FUSED_PRIMITIVE:
-                if (args[i].index < data.fused_op_inputs.size() && data.fused_op_inputs[args[i].index]) {
-                    const auto& input_mem = data.fused_op_inputs[args[i].index];
-                    if (input_mem) {
-                        if (memory_capabilities::is_usm_type(input_mem->get_allocation_type()))
-                            status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*input_mem).get_buffer());
-                        else
-                            status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*input_mem).get_buffer());
-                    }
-                }
+                if (args[i].index < data.fused_op_inputs.size())
+                    mem = data.fused_op_inputs[args[i].index];
                 break;
             case kernel_selector::kernel_argument_types::INTERNAL_BUFFER:
-                if (args[i].index < data.intermediates.size() && data.intermediates[args[i].index]) {
-                    const auto& input_mem = data.intermediates[args[i].index];
-                    if (input_mem) {
-                        if (memory_capabilities::is_usm_type(input_mem->get_allocation_type()))
-                            status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*input_mem).get_buffer());
-                        else
-                            status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*input_mem).get_buffer());
-                    }
-                }
+                if (args[i].index < data.intermediates.size())
+                    mem = data.intermediates[args[i].index];
                 break;
             case kernel_selector::kernel_argument_types::OUTPUT:
-                if (data.output) {
-                     if (data.output->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.output).get_buffer());
-                     else if (memory_capabilities::is_usm_type(data.output->get_allocation_type()))
-                         status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*data.output).get_buffer());
-                     else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.output).get_buffer());
-                }
+                mem = data.output;
                 break;
             case kernel_selector::kernel_argument_types::WEIGHTS:
-                if (data.weights) {
-                    if (data.weights->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.weights).get_buffer());
-                    else if (memory_capabilities::is_usm_type(data.weights->get_allocation_type()))
-                        status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*data.weights).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.weights).get_buffer());
-                }
+                mem = data.weights;
                 break;
             case kernel_selector::kernel_argument_types::BIAS:
-                if (data.bias) {
-                    if (memory_capabilities::is_usm_type(data.bias->get_allocation_type()))
-                        status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*data.bias).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.bias).get_buffer());
-                }
+                mem = data.bias;
                 break;
             case kernel_selector::kernel_argument_types::WEIGHTS_ZERO_POINTS:
-                if (data.weights_zero_points) {
-                    if (memory_capabilities::is_usm_type(data.weights_zero_points->get_allocation_type()))
-                        status = kernel.setArgUsm(
-                            i,
-                            dynamic_cast<const gpu::gpu_usm&>(*data.weights_zero_points).get_buffer());
-                    else
-                        status = kernel.setArg(
-                            i,
-                            dynamic_cast<const gpu::gpu_buffer&>(*data.weights_zero_points).get_buffer());
-                }
+                mem = data.weights_zero_points;
                 break;
             case kernel_selector::kernel_argument_types::ACTIVATIONS_ZERO_POINTS:
-                if (data.activations_zero_points) {
-                    if (memory_capabilities::is_usm_type(data.activations_zero_points->get_allocation_type()))
-                        status = kernel.setArgUsm(
-                            i,
-                            dynamic_cast<const gpu::gpu_usm&>(*data.activations_zero_points).get_buffer());
-                    else
-                        status = kernel.setArg(
-                            i,
-                            dynamic_cast<const gpu::gpu_buffer&>(*data.activations_zero_points).get_buffer());
-                }
+                mem = data.activations_zero_points;
                 break;
             case kernel_selector::kernel_argument_types::COMPENSATION:
-                if (data.compensation) {
-                    if (memory_capabilities::is_usm_type(data.compensation->get_allocation_type()))
-                        status = kernel.setArgUsm(
-                                i,
-                                dynamic_cast<const gpu::gpu_usm&>(*data.compensation).get_buffer());
-                    else
-                        status = kernel.setArg(
-                                 i,
-                                 dynamic_cast<const gpu::gpu_buffer&>(*data.compensation).get_buffer());
-                }
+                mem = data.compensation;
                 break;
             case kernel_selector::kernel_argument_types::SCALE_TABLE:
-                if (data.scale_table) {
-                    if (memory_capabilities::is_usm_type(data.scale_table->get_allocation_type()))
-                        status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*data.scale_table).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.scale_table).get_buffer());
-                }
+                mem = data.scale_table;
                 break;
             case kernel_selector::kernel_argument_types::SLOPE:
-                if (data.slope) {
-                    if (memory_capabilities::is_usm_type(data.slope->get_allocation_type()))
-                        status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*data.slope).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.slope).get_buffer());
-                }
+                mem = data.slope;
+                break;
+            case kernel_selector::kernel_argument_types::RECURRENT:  // RNN/LSTM/GRU layers
+                mem = data.recurrent;
+                break;
+            case kernel_selector::kernel_argument_types::HIDDEN:  // RNN/LSTM/GRU layers
+                mem = data.hidden;
+                break;
+            case kernel_selector::kernel_argument_types::CELL:  // LSTMlayers
+                mem = data.cell;
                 break;
             case kernel_selector::kernel_argument_types::SPLIT:
-                status = kernel.setArg(i, data.split);
+                status = set_arg(kernel, i, data.split, bound);
                 break;
             case kernel_selector::kernel_argument_types::SCALAR:
                 if (data.scalars && args[i].index < data.scalars->size()) {
                     const auto& scalar = (*data.scalars)[args[i].index];
                     switch (scalar.t) {
                         case kernel_selector::kernel_scalar_argument_types::UINT8:
-                            status = kernel.setArg(i, scalar.v.u8);
+                            status = set_arg(kernel, i, scalar.v.u8, bound);
                             break;
                         case kernel_selector::kernel_scalar_argument_types::UINT16:
-                            status = kernel.setArg(i, scalar.v.u16);
+                            status = set_arg(kernel, i, scalar.v.u16, bound);
                             break;
                         case kernel_selector::kernel_scalar_argument_types::UINT32:
-                            status = kernel.setArg(i, scalar.v.u32);
+                            status = set_arg(kernel, i, scalar.v.u32, bound);
                             break;
                         case kernel_selector::kernel_scalar_argument_types::UINT64:
-                            status = kernel.setArg(i, scalar.v.u64);
+                            status = set_arg(kernel, i, scalar.v.u64, bound);
                             break;
                         case kernel_selector::kernel_scalar_argument_types::INT8:
-                            status = kernel.setArg(i, scalar.v.s8);
+                            status = set_arg(kernel, i, scalar.v.s8, bound);
                             break;
                         case kernel_selector::kernel_scalar_argument_types::INT16:
-                            status = kernel.setArg(i, scalar.v.s16);
+                            status = set_arg(kernel, i, scalar.v.s16, bound);
                             break;
                         case kernel_selector::kernel_scalar_argument_types::INT32:
-                            status = kernel.setArg(i, scalar.v.s32);
+                            status = set_arg(kernel, i, scalar.v.s32, bound);
                             break;
                         case kernel_selector::kernel_scalar_argument_types::INT64:
-                            status = kernel.setArg(i, scalar.v.s64);
+                            status = set_arg(kernel, i, scalar.v.s64, bound);
                             break;
                         case kernel_selector::kernel_scalar_argument_types::FLOAT32:
-                            status = kernel.setArg(i, scalar.v.f32);
+                            status = set_arg(kernel, i, scalar.v.f32, bound);
                             break;
                         case kernel_selector::kernel_scalar_argument_types::FLOAT64:
-                            status = kernel.setArg(i, scalar.v.f64);
+                            status = set_arg(kernel, i, scalar.v.f64, bound);
                             break;
                         default:
                             break;
                     }
                 }
                 break;
-            case kernel_selector::kernel_argument_types::RECURRENT:  // RNN/LSTM/GRU layers
-                if (data.recurrent) {
-                    if (data.recurrent->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.recurrent).get_buffer());
-                    else if (memory_capabilities::is_usm_type(data.recurrent->get_allocation_type()))
-                        status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*data.recurrent).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.recurrent).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::HIDDEN:  // RNN/LSTM/GRU layers
-                if (data.hidden) {
-                    if (data.hidden->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.hidden).get_buffer());
-                    else if (memory_capabilities::is_usm_type(data.hidden->get_allocation_type()))
-                        status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*data.hidden).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.hidden).get_buffer());
-                }
-                break;
-            case kernel_selector::kernel_argument_types::CELL:  // LSTMlayers
-                if (data.cell) {
-                    if (data.cell->get_layout().format.is_image_2d())
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_image2d&>(*data.cell).get_buffer());
-                    else if (memory_capabilities::is_usm_type(data.cell->get_allocation_type()))
-                        status = kernel.setArgUsm(i, dynamic_cast<const gpu::gpu_usm&>(*data.cell).get_buffer());
-                    else
-                        status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.cell).get_buffer());
-                }
-                break;
             default:
                 break;
         }
 
+        if (mem)
+            status = set_memory_arg(kernel, i, *mem, bound);
+
         if (status != CL_SUCCESS) {
             throw std::runtime_error("Error set arg " + std::to_string(i) + ", error code: " + std::to_string(status) + "\n");
         }
@@ -248,18 +198,24 @@ void kernel::set_arguments(uint32_t queue_id,
                            const kernel_selector::cl_kernel_data& kernel_data,
                            const kernel_arguments_data& args) {
     static std::mutex m;
-    std::lock_guard<std::mutex> guard(m);
-    auto compiled_kernel = context()->get_kernels_cache(_prog_id).get_kernel(_kernel_id, _one_time_kernel);
+    std::unique_lock<std::mutex> guard(m);
 
     // Create a copy of cl kernel for each stream if it doesn't exist
     // Copy is needed to avoid data races between streams, but we create it only once for each stream
     // because the cloning is quite expensive.
     // Mutex is still needed to ensure that insert operation into the map is thread safe
-    if (_cl_kernels.find(queue_id) == _cl_kernels.end())
-        _cl_kernels[queue_id] = compiled_kernel.clone();
+    auto cl_kernel = _cl_kernels.find(queue_id);
+    if (cl_kernel == _cl_kernels.end()) {
+        auto compiled_kernel = context()->get_kernels_cache(_prog_id).get_kernel(_kernel_id, _one_time_kernel);
+        cl_kernel = _cl_kernels.emplace(queue_id, compiled_kernel.clone()).first;
+        _bound_args[queue_id].clear();
+    }
+    auto& bound = _bound_args[queue_id];
+    // Map nodes are stable, and the kernel of the stream is only set by the stream itself
+    guard.unlock();
 
     try {
-        set_arguments_impl(_cl_kernels.at(queue_id), kernel_data.arguments, args);
+        set_arguments_impl(cl_kernel->second, kernel_data.arguments, args, bound);
     } catch (cl::Error const& err) {
         throw ocl_error(err);
     }
@@ -267,6 +223,7 @@ void kernel::set_arguments(uint32_t queue_id,
 
 void kernel::cleanup(uint32_t queue_id) {
     _cl_kernels.erase(queue_id);
+    _bound_args.erase(queue_id);
 }
 
 event_impl::ptr kernel::run(uint32_t queue_id,
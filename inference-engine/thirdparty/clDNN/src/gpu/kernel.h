@@ -37,6 +37,17 @@ class kernel : public context_holder {
 
     std::map<uint32_t, kernels_cache::kernel_type> _cl_kernels;
 
+public:
+    // Value of the argument last set to the cl kernel: unique id of the memory object or bits of the scalar
+    struct bound_argument {
+        bool is_set = false;
+        uint64_t value = 0;
+    };
+
+private:
+    // Arguments set to the cl kernel of each stream, only the changed ones are passed to OpenCL again
+    std::map<uint32_t, std::vector<bound_argument>> _bound_args;
+
 public:
     explicit kernel(std::shared_ptr<gpu_toolkit> context,
                     const std::shared_ptr<kernel_selector::kernel_string>& kernel_string,
@@ -47,14 +58,16 @@ public:
         , _prog_id(prog_id)
         , _kernel_id(context->get_kernels_cache(prog_id).set_kernel_source(kernel_string, dump_custom_program, one_time_kernel))
         , _one_time_kernel(one_time_kernel)
-        , _cl_kernels({}) {}
+        , _cl_kernels({})
+        , _bound_args({}) {}
 
     kernel(const kernel& other)
         : context_holder(other.context())
         , _prog_id(other._prog_id)
         , _kernel_id(other._kernel_id)
         , _one_time_kernel(other._one_time_kernel)
-        , _cl_kernels(other._cl_kernels) {}
+        , _cl_kernels(other._cl_kernels)
+        , _bound_args(other._bound_args) {}
 
     kernel& operator=(const kernel& other) {
         if (this == &other) {
@@ -65,6 +78,7 @@ public:
         _prog_id = other._prog_id;
         _one_time_kernel = other._one_time_kernel;
         _cl_kernels = other._cl_kernels;
+        _bound_args = other._bound_args;
 
         return *this;
     }
@@ -19,12 +19,16 @@
 #include "ocl_toolkit.h"
 #include <algorithm>
 #include <cassert>
+#include <cctype>
 #include <sstream>
 #include <fstream>
 #include <set>
 #include <string>
 #include <memory>
 #include <utility>
+#include <thread>
+#include <atomic>
+#include <exception>
 
 #include "kernel_selector_helper.h"
 
@@ -176,6 +180,30 @@ inline bool does_options_support_batch_compilation(const std::string& options) {
     return options.find("-D") == std::string::npos && options.find("-I") == std::string::npos;
 }
 
+// replaces the entry point in the kernel source; the names end with a number, so "conv_1" does not match "conv_12"
+std::string replace_entry_point(const std::string& code, const std::string& from, const std::string& to) {
+    std::string result;
+    result.reserve(code.size());
+    size_t pos = 0;
+    for (auto found = code.find(from); found != std::string::npos; found = code.find(from, found + 1)) {
+        const auto end = found + from.size();
+        if (found < pos || (end < code.size() && std::isdigit(static_cast<unsigned char>(code[end]))))
+            continue;
+        result.append(code, pos, found - pos);
+        result += to;
+        pos = end;
+    }
+    result.append(code, pos, std::string::npos);
+    return result;
+}
+
+// the entry point contains a position of the kernel in the program, so cached kernels are named by their content
+// to be found by other programs and networks
+std::string get_content_entry_point(const std::string& code, const std::string& entry_point) {
+    const auto normalized = replace_entry_point(code, entry_point, "__KERNEL_ENTRY_POINT__");
+    return "kernel_" + std::to_string(std::hash<std::string>()(normalized));
+}
+
 }  // namespace
 
 namespace cldnn {
@@ -198,7 +226,12 @@ bool kernels_cache::is_cache_enabled() const {
 }
 
 size_t kernels_cache::get_max_kernels_per_batch() const {
-    return 10;
+    // cached binaries contain a single kernel, so they are reused by any network which has the same kernel
+    return is_cache_enabled() ? 1 : 10;
+}
+
+size_t kernels_cache::get_max_compilation_threads() const {
+    return std::max(1u, std::thread::hardware_concurrency());
 }
 
 kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code) const {
@@ -207,8 +240,13 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
     for (const auto& code : kernels_source_code) {
         std::string full_code = code.kernel_strings->jit + code.kernel_strings->str;
         full_code += get_undef_jit({full_code});
-        const source_code org_source_code = { full_code };
         std::string entry_point = code.kernel_strings->entry_point;
+        if (is_cache_enabled()) {
+            auto content_entry_point = get_content_entry_point(full_code, entry_point);
+            full_code = replace_entry_point(full_code, entry_point, content_entry_point);
+            entry_point = content_entry_point;
+        }
+        const source_code org_source_code = { full_code };
         std::string options = code.kernel_strings->options;
         bool batch_compilation = code.kernel_strings->batch_compilation;
         bool dump_custom_program = code.dump_custom_program;
@@ -242,12 +280,17 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
             current_bucket.options = options;
         }
 
+        // the same kernel used by several nodes is compiled once
+        const bool compiled = current_bucket.entry_point_to_id.count(entry_point) != 0;
+        current_bucket.entry_point_to_id.emplace(entry_point, code.id);
+        if (compiled)
+            continue;
+
         // Create new kernels bucket when the limit is reached
         if ((current_bucket.kernels_counter % get_max_kernels_per_batch()) == 0) {
             current_bucket.source.push_back({});
         }
 
-        current_bucket.entry_point_to_id[entry_point] = code.id;
         assert(org_source_code.size() == 1);
 
         current_bucket.source.back().push_back(std::move(org_source_code.front()));
@@ -258,13 +301,14 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
     // Compute hash value for each bucket
     // Hash calculation might require additional optimizations, but currently execution time of this part is much smaller than loading
     // of the precompiled binaries or get_undef_jit calls
-    // Hash is computed for string that contains compilation options + driver version +
+    // Hash is computed for string that contains compilation options + device name + driver version +
     // full source code (jit + template + undef sections) of all kernels in the bucket
     for (auto& c : scode) {
         program_code& code = c.second;
         auto options = c.first;
         for (size_t i = 0; i < code.source.size(); i++) {
-            std::string full_code = options + " " + _context.get_device_info().driver_version;
+            std::string full_code = options + " " + _context.get_device_info().dev_name + " " +
+                                    _context.get_device_info().driver_version;
             for (auto& ss : code.source[i])
                 full_code += ss;
             code.hash_values.push_back(std::hash<std::string>()(full_code));
@@ -312,7 +356,7 @@ static std::vector<unsigned char> getProgramBinaries(cl::Program program) {
 }
 
 kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const {
-    static uint32_t current_file_index = 0;
+    static std::atomic<uint32_t> current_file_index{0};
 
     bool dump_sources = !_context.get_configuration().ocl_sources_dumps_dir.empty() || program_source.dump_custom_program;
 
@@ -374,9 +418,9 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
                     program.createKernels(&kernels);
                     if (is_cache_enabled()) {
                         // If kernels caching is enabled, then we save compiled bucket to binary file with name ${code_hash_value}.cl_cache
-                        // Note: Bin file contains full bucket, not separate kernels, so kernels reuse across different models is quite limited
-                        // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
-                        // compile time.
+                        // Buckets contain single kernels in this case (see get_max_kernels_per_batch()), so the binaries are shared
+                        // by all networks with the same kernel. Longer compilation of single kernels is hidden by compiling
+                        // buckets in parallel in build_all().
                         saveBinaryToFile(cached_bin_name, getProgramBinaries(program));
                     }
                 } else {
@@ -431,17 +475,59 @@ void kernels_cache::build_all() {
 
     auto sorted_program_code = get_program_source(_kernels_code);
 
-    _one_time_kernels.clear();
+    // with the cache each bucket is a separate program, so the missing kernels are compiled in parallel
+    std::vector<program_code> programs;
     for (auto& program : sorted_program_code) {
-        auto kernels = build_program(program.second);
-
-        for (auto& k : kernels) {
-            const auto& entry_point = k.first;
-            const auto& k_id = program.second.entry_point_to_id[entry_point];
-            if (program.second.one_time) {
-                _one_time_kernels[k_id] = k.second;
-            } else {
-                _kernels[k_id] = k.second;
+        if (!is_cache_enabled()) {
+            programs.push_back(std::move(program.second));
+            continue;
+        }
+        for (size_t i = 0; i < program.second.source.size(); i++) {
+            program_code bucket;
+            bucket.source = {std::move(program.second.source[i])};
+            bucket.hash_values = {program.second.hash_values[i]};
+            bucket.options = program.second.options;
+            bucket.dump_custom_program = program.second.dump_custom_program;
+            bucket.one_time = program.second.one_time;
+            bucket.entry_point_to_id = program.second.entry_point_to_id;
+            programs.push_back(std::move(bucket));
+        }
+    }
+
+    std::vector<kernels_map> programs_kernels(programs.size());
+    std::vector<std::exception_ptr> errors(programs.size());
+    const size_t threads_num = is_cache_enabled() ? std::min(get_max_compilation_threads(), programs.size()) : 1;
+    std::atomic<size_t> next_program{0};
+    auto build_programs = [&] {
+        for (size_t i = next_program++; i < programs.size(); i = next_program++) {
+            try {
+                programs_kernels[i] = build_program(programs[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < threads_num; t++)
+        threads.emplace_back(build_programs);
+    build_programs();
+    for (auto& thread : threads)
+        thread.join();
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    _one_time_kernels.clear();
+    for (size_t i = 0; i < programs.size(); i++) {
+        for (auto& k : programs_kernels[i]) {
+            const auto ids = programs[i].entry_point_to_id.equal_range(k.first);
+            for (auto id = ids.first; id != ids.second; ++id) {
+                if (programs[i].one_time) {
+                    _one_time_kernels[id->second] = k.second;
+                } else {
+                    _kernels[id->second] = k.second;
+                }
             }
         }
     }
@@ -50,7 +50,8 @@ public:
         std::string options;
         bool dump_custom_program = false;
         bool one_time = false;
-        std::map<std::string, std::string> entry_point_to_id;
+        // the kernels shared by several nodes have several ids
+        std::multimap<std::string, std::string> entry_point_to_id;
     };
 
     struct kernel_code {
@@ -100,6 +101,7 @@ private:
     std::string get_cache_path() const;
     bool is_cache_enabled() const;
     size_t get_max_kernels_per_batch() const;
+    size_t get_max_compilation_threads() const;
 public:
     explicit kernels_cache(gpu_toolkit& context, uint32_t prog_id);
     kernel_id set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string,
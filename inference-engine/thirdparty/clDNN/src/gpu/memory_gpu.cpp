@@ -69,6 +69,44 @@ void gpu_buffer::fill(unsigned char pattern, event_impl::ptr ev) {
     _context->queue(_net_id).enqueueFillBuffer<unsigned char>(_buffer, pattern, 0, size(), 0, &ev_ocl);
 }
 
+event_impl::ptr gpu_buffer::copy_from_async(const void* host_ptr) {
+    {
+        std::lock_guard<std::mutex> locker(_mutex);
+        if (0 == _lock_count) {
+            // upload goes through the separate copy queue, so it may overlap kernels of the networks queues
+            cl::Event ev_ocl;
+            auto& queue = _context->copy_queue();
+            queue.enqueueWriteBuffer(_buffer, CL_FALSE, 0, size(), host_ptr, nullptr, &ev_ocl);
+            queue.flush();
+            return event_impl::ptr{ new base_event(_context, ev_ocl), false };
+        }
+    }
+    // writing to the mapped buffer has undefined results, so the data is copied to the mapped pointer instead
+    return memory_impl::copy_from_async(host_ptr);
+}
+
+event_impl::ptr gpu_buffer::copy_to_async(void* host_ptr, uint32_t net_id, const std::vector<event_impl::ptr>& deps) {
+    {
+        std::lock_guard<std::mutex> locker(_mutex);
+        if (0 == _lock_count) {
+            // download goes through the network queue, so it is ordered after the commands producing the data
+            std::vector<cl::Event> dep_events;
+            for (auto& dep : deps) {
+                if (auto ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get())) {
+                    if (ocl_base_ev->get().get() != nullptr)
+                        dep_events.push_back(ocl_base_ev->get());
+                }
+            }
+            cl::Event ev_ocl;
+            auto& queue = _context->queue(net_id);
+            queue.enqueueReadBuffer(_buffer, CL_FALSE, 0, size(), host_ptr, &dep_events, &ev_ocl);
+            queue.flush();
+            return event_impl::ptr{ new base_event(_context, ev_ocl), false };
+        }
+    }
+    return memory_impl::copy_to_async(host_ptr, net_id, deps);
+}
+
 shared_mem_params gpu_buffer::get_internal_params() const {
     return {shared_mem_type::shared_mem_buffer, static_cast<shared_handle>(_context->context().get()), nullptr,
             static_cast<shared_handle>(_buffer.get()),
@@ -305,10 +343,10 @@ void gpu_usm::copy_from_other(const gpu_usm& other) {
 
 shared_mem_params gpu_usm::get_internal_params() const {
     return {
-        shared_mem_type::shared_mem_empty,  // shared_mem_type
+        shared_mem_type::shared_mem_usm,  // shared_mem_type
         static_cast<shared_handle>(_engine->get_context()->context().get()),  // context handle
         nullptr,  // user_device handle
-        nullptr,  // mem handle
+        _buffer.get(),  // mem handle
 #ifdef WIN32
         nullptr,  // surface handle
 #else
@@ -86,6 +86,8 @@ struct gpu_buffer : public lockable_gpu_mem, public memory_impl {
     void* lock() override;
     void unlock() override;
     void fill(unsigned char pattern, event_impl::ptr ev) override;
+    event_impl::ptr copy_from_async(const void* host_ptr) override;
+    event_impl::ptr copy_to_async(void* host_ptr, uint32_t net_id, const std::vector<event_impl::ptr>& deps) override;
     shared_mem_params get_internal_params() const override;
     const cl::Buffer& get_buffer() const {
         assert(0 == _lock_count);
@@ -93,6 +93,7 @@ public:
 
     cl::Event get() override { return _last_ocl_event; }
     std::shared_ptr<gpu_toolkit> get_context() const { return _ctx; }
+    const std::vector<event_impl::ptr>& get_events() const { return _events; }
 
     void reset() override {
         ocl_base_event::reset();
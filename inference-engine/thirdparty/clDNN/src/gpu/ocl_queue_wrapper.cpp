@@ -85,20 +85,16 @@ event_impl::ptr gpu_queue::enqueue_kernel(kernels_cache::kernel_type const& kern
             }
         }
     } else {
-        dep_events_ptr = nullptr;
-
-        sync_events(deps);
+        // out-of-order queue waits only for the direct dependencies, so independent branches may overlap
+        sync_events(deps, dep_events);
+        if (dep_events.empty())
+            dep_events_ptr = nullptr;
     }
 
     cl::Event ret_ev;
 
     try {
-        if (!context()->get_configuration().host_out_of_order || _output_event ||
-            context()->get_configuration().enable_profiling) {
-            _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
-        } else {
-            _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, nullptr);
-        }
+        _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
     } catch (cl::Error const& err) {
         throw ocl_error(err);
     }
@@ -135,11 +131,44 @@ event_impl::ptr gpu_queue::enqueue_marker(std::vector<event_impl::ptr> const& de
 
         return _events_pool->get_from_base_pool(context(), ret_ev, ++_queue_counter);
     } else {
-        sync_events(deps);
-        return _events_pool->get_from_base_pool(context(), _last_barrier_ev, _last_barrier);
+        std::vector<cl::Event> dep_events;
+        sync_events(deps, dep_events);
+        if (dep_events.empty())
+            return _events_pool->get_from_base_pool(context(), _last_barrier_ev, _last_barrier);
+
+        cl::Event ret_ev;
+        try {
+            _command_queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
+        } catch (cl::Error const& err) {
+            throw ocl_error(err);
+        }
+        return _events_pool->get_from_base_pool(context(), ret_ev, ++_queue_counter);
     }
 }
 
+void gpu_queue::enqueue_barrier(std::vector<event_impl::ptr> const& deps) {
+    // unlike the markers, the barrier waits for the events in both in-order and out-of-order queues,
+    // so it's used for the events from other queues (e.g. asynchronous uploads)
+    std::vector<cl::Event> dep_events;
+    for (auto& dep : deps) {
+        if (auto ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get()))
+            dep_events.push_back(ocl_base_ev->get());
+    }
+    if (dep_events.empty())
+        return;
+
+    try {
+        if (_output_event)
+            _command_queue.enqueueBarrierWithWaitList(&dep_events, &_last_barrier_ev);
+        else
+            _command_queue.enqueueBarrierWithWaitList(&dep_events, nullptr);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    _last_barrier = ++_queue_counter;
+}
+
 event_impl::ptr gpu_queue::group_events(std::vector<event_impl::ptr> const& deps) {
     return _events_pool->get_from_group_pool(context(), deps);
 }
@@ -169,16 +198,31 @@ void gpu_queue::release_pending_memory() {
     _mm_free(ptr);
 }
 
-void gpu_queue::sync_events(std::vector<event_impl::ptr> const& deps) {
-    bool needs_barrier = false;
+bool gpu_queue::collect_pending_events(std::vector<event_impl::ptr> const& deps,
+                                       std::vector<cl::Event>& dep_events) const {
     for (auto& dep : deps) {
-        auto* ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get());
-        if (ocl_base_ev->get_queue_stamp() > _last_barrier) {
-            needs_barrier = true;
+        if (auto multiple_events = dynamic_cast<base_events*>(dep.get())) {
+            if (!collect_pending_events(multiple_events->get_events(), dep_events))
+                return false;
+            continue;
         }
+
+        auto* ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get());
+        // events enqueued before the last barrier are already synchronized
+        if (!ocl_base_ev || ocl_base_ev->get_queue_stamp() <= _last_barrier)
+            continue;
+
+        auto ev = ocl_base_ev->get();
+        if (ev.get() == nullptr)
+            return false;
+        dep_events.push_back(ev);
     }
+    return true;
+}
 
-    if (needs_barrier) {
+void gpu_queue::sync_events(std::vector<event_impl::ptr> const& deps, std::vector<cl::Event>& dep_events) {
+    if (!collect_pending_events(deps, dep_events)) {
+        dep_events.clear();
         try {
             if (_output_event)
                 _command_queue.enqueueBarrierWithWaitList(nullptr, &_last_barrier_ev);
@@ -76,7 +76,8 @@ public:
 
     ~gpu_queue() = default;
 
-    void sync_events(std::vector<event_impl::ptr> const& deps);
+    // fills dep_events with events which have to be waited for, or enqueues a barrier if some of them is unavailable
+    void sync_events(std::vector<event_impl::ptr> const& deps, std::vector<cl::Event>& dep_events);
     void release_pending_memory();
     void flush();
 
@@ -87,6 +88,7 @@ public:
                                    cl::NDRange const& local,
                                    std::vector<event_impl::ptr> const& deps);
     event_impl::ptr enqueue_marker(std::vector<event_impl::ptr> const& deps);
+    void enqueue_barrier(std::vector<event_impl::ptr> const& deps);
     event_impl::ptr group_events(std::vector<event_impl::ptr> const& deps);
     void reset_events();
     event_impl::ptr create_user_event(bool set);
@@ -94,6 +96,8 @@ public:
     std::shared_ptr<gpu_toolkit> context() { return _context.lock(); }
 
 private:
+    bool collect_pending_events(std::vector<event_impl::ptr> const& deps, std::vector<cl::Event>& dep_events) const;
+
     uint32_t id;
     std::weak_ptr<gpu_toolkit> _context;
     queue_type _command_queue;
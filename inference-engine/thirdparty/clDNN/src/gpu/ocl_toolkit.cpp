@@ -165,7 +165,7 @@ kernels_cache& gpu_toolkit::get_kernels_cache(uint32_t prog_id) {
     return get_program_state(prog_id)._kernels_cache;
 }
 
-void gpu_toolkit::add_network(uint32_t net_id) {
+void gpu_toolkit::add_network(uint32_t net_id, priority_mode_types priority, throttle_mode_types throttle) {
     std::lock_guard<std::mutex> lock(toolkit_mutex);
     command_queues_builder queue_builder(context(), device(), _device->get_platform());
     queue_builder.set_profiling(_configuration.enable_profiling);
@@ -173,17 +173,32 @@ void gpu_toolkit::add_network(uint32_t net_id) {
 
     bool priorty_extensions =
         extension_supported("cl_khr_priority_hints") && extension_supported("cl_khr_create_command_queue");
-    queue_builder.set_priority_mode(_configuration.priority_mode, priorty_extensions);
+    if (priority == priority_mode_types::disabled)
+        priority = _configuration.priority_mode;
+    queue_builder.set_priority_mode(priority, priorty_extensions);
 
     bool throttle_extensions =
         extension_supported("cl_khr_throttle_hints") && extension_supported("cl_khr_create_command_queue");
-    queue_builder.set_throttle_mode(_configuration.throttle_mode, throttle_extensions);
+    if (throttle == throttle_mode_types::disabled)
+        throttle = _configuration.throttle_mode;
+    queue_builder.set_throttle_mode(throttle, throttle_extensions);
 
     queue_builder.build();
     _command_queues_w.emplace(std::make_pair(net_id,
         gpu_queue(net_id, queue_builder.queue(), shared_from_this())));
 }
 
+const queue_type& gpu_toolkit::copy_queue() {
+    std::lock_guard<std::mutex> lock(toolkit_mutex);
+    if (_copy_queue.get() == nullptr) {
+        command_queues_builder queue_builder(context(), device(), _device->get_platform());
+        queue_builder.set_profiling(_configuration.enable_profiling);
+        queue_builder.build();
+        _copy_queue = queue_builder.queue();
+    }
+    return _copy_queue;
+}
+
 void gpu_toolkit::remove_network(uint32_t net_id) {
     std::lock_guard<std::mutex> lock(toolkit_mutex);
     auto net_iter = _command_queues_w.find(net_id);
@@ -205,6 +220,10 @@ event_impl::ptr gpu_toolkit::enqueue_marker(uint32_t queue_id, std::vector<event
     return get_command_queue(queue_id).enqueue_marker(deps);
 }
 
+void gpu_toolkit::enqueue_barrier(uint32_t queue_id, std::vector<event_impl::ptr> const& deps) {
+    get_command_queue(queue_id).enqueue_barrier(deps);
+}
+
 event_impl::ptr gpu_toolkit::group_events(uint32_t queue_id, std::vector<event_impl::ptr> const& deps) {
     return get_command_queue(queue_id).group_events(deps);
 }
@@ -81,6 +81,7 @@ public:
     const cl::Device device() const { return _device->get_device(); }
     const memory_capabilities memory_caps() const { return _device->mem_caps(); }
     const queue_type& queue(uint32_t id) { return get_command_queue(id).queue(); }
+    const queue_type& copy_queue();
 
     const configuration& get_configuration() const { return _configuration; }
     device_info_internal get_device_info() const { return _device->get_info(); }
@@ -106,6 +107,7 @@ public:
                                    cl::NDRange const& local,
                                    std::vector<event_impl::ptr> const& deps);
     event_impl::ptr enqueue_marker(uint32_t queue_id, std::vector<event_impl::ptr> const& deps);
+    void enqueue_barrier(uint32_t queue_id, std::vector<event_impl::ptr> const& deps);
     event_impl::ptr group_events(uint32_t queue_id, std::vector<event_impl::ptr> const& deps);
     void reset_events(uint32_t queue_id);
     event_impl::ptr create_user_event(uint32_t queue_id, bool set);
@@ -119,7 +121,10 @@ public:
     void log(uint64_t id, std::string const& msg);
     bool logging_enabled() const { return !_configuration.log.empty(); }
     bool is_neo_driver() { return _neo_driver; }
-    void add_network(uint32_t net_id);
+    // Disabled priority or throttle hint means the hint from the engine configuration
+    void add_network(uint32_t net_id,
+                     priority_mode_types priority = priority_mode_types::disabled,
+                     throttle_mode_types throttle = throttle_mode_types::disabled);
     void remove_network(uint32_t net_id);
 
     void add_program(uint32_t prog_id);
@@ -133,6 +138,7 @@ private:
     bool _neo_driver = false;
     std::map<uint32_t, std::shared_ptr<gpu_program_state>> _program_states;
     std::map<uint32_t, gpu_queue> _command_queues_w;
+    queue_type _copy_queue;
     std::shared_ptr<kernel_selector::TuningCache> _device_cache;
     bool _serialize = false;
 
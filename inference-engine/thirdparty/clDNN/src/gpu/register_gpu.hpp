@@ -155,6 +155,7 @@ REGISTER_GPU(ctc_greedy_decoder);
 REGISTER_GPU(cum_sum);
 REGISTER_GPU(embedding_bag);
 REGISTER_GPU(extract_image_patches);
+REGISTER_GPU(attention);
 
 #undef REGISTER_GPU
 
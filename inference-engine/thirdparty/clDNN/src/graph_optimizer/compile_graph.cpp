@@ -22,16 +22,27 @@
 #include "mutable_data_inst.h"
 #include "program_node.h"
 #include "engine_impl.h"
+#include "program_helpers.h"
+#include <thread>
+#include <vector>
 
 using namespace cldnn;
 
 void compile_graph::run(program_impl& p) {
+    // output layouts are calculated recursively through the dependencies, so it's done before
+    // the kernels are selected in parallel
+    std::vector<program_node*> nodes;
     for (auto& node : p.get_processing_order()) {
         if (!node->is_type<internal_primitive>() && !node->is_type<data>()) {
             node->get_output_layout();
             if (!node->is_type<data>() && !(node->is_type<mutable_data>() && node->get_dependencies().empty())) {
-                node->selected_impl = node->type()->choose_impl(p.get_engine(), *node);
+                nodes.push_back(node);
             }
         }
     }
+
+    // on-line tuning runs the kernels on the device, so it's kept sequential
+    auto tuning_mode = p.get_options().get<build_option_type::tuning_config>()->config.mode;
+    bool tuning = tuning_mode == tuning_mode::tuning_tune_and_cache || tuning_mode == tuning_mode::tuning_retune_and_cache;
+    program_helpers::choose_impls(p, nodes, tuning ? 1 : std::thread::hardware_concurrency());
 }
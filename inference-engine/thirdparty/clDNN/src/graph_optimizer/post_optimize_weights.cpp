@@ -23,6 +23,9 @@
 #include "include/binary_convolution_inst.h"
 #include "include/deformable_convolution_inst.h"
 #include "lstm_dynamic_input_inst.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 namespace cldnn {
 
@@ -46,7 +49,7 @@ post_optimize_weights::weights_bias_offset post_optimize_weights::get_weights_bi
 
 // function which prepares given primitive for weights optimization
 template<typename T>
-void post_optimize_weights::optimize_weights(T& node, program_impl& p) {
+void post_optimize_weights::optimize_weights(T& node, program_impl& p, std::vector<program_node*>& generic_layers) {
     auto offsets = get_weights_bias_offset(node);
     auto* impl = node.get_selected_impl().get();
     auto output_layout = node.get_output_layout();
@@ -67,8 +70,9 @@ void post_optimize_weights::optimize_weights(T& node, program_impl& p) {
 
             // Don't run impl selection to avoid double compilation of reorder kernels
             // in main program and internal program for constant propagation
-            if (!g_node.is_constant())
-                g_node.selected_impl = g_node.type()->choose_impl(p.get_engine(), g_node);
+            // Cached reorders may be shared by several nodes, their implementation is selected once
+            if (!g_node.is_constant() && std::find(generic_layers.begin(), generic_layers.end(), &g_node) == generic_layers.end())
+                generic_layers.push_back(&g_node);
         }
     }
 
@@ -82,24 +86,27 @@ void post_optimize_weights::optimize_weights(T& node, program_impl& p) {
 }
 
 void post_optimize_weights::run(program_impl& p) {
+    // reorders are added to the graph sequentially, their implementations are selected in parallel afterwards
+    std::vector<program_node*> generic_layers;
     for (auto& node : p.get_processing_order()) {
         if (node->type() == convolution::type_id()) {
-            optimize_weights(node->as<convolution>(), p);
+            optimize_weights(node->as<convolution>(), p, generic_layers);
         }
         if (node->type() == binary_convolution::type_id()) {
-            optimize_weights(node->as<binary_convolution>(), p);
+            optimize_weights(node->as<binary_convolution>(), p, generic_layers);
         } else if (node->type() == deconvolution::type_id()) {
-            optimize_weights(node->as<deconvolution>(), p);
+            optimize_weights(node->as<deconvolution>(), p, generic_layers);
         } else if (node->type() == deformable_conv::type_id()) {
-            optimize_weights(node->as<deformable_conv>(), p);
+            optimize_weights(node->as<deformable_conv>(), p, generic_layers);
         } else if (node->type() == fully_connected::type_id()) {
-            optimize_weights(node->as<fully_connected>(), p);
+            optimize_weights(node->as<fully_connected>(), p, generic_layers);
         } else if (node->type() == fused_conv_eltwise::type_id()) {
-            optimize_weights(node->as<fused_conv_eltwise>(), p);
+            optimize_weights(node->as<fused_conv_eltwise>(), p, generic_layers);
         } else if (node->type() == lstm_dynamic_input::type_id()) {
-            optimize_weights(node->as<lstm_dynamic_input>(), p);
+            optimize_weights(node->as<lstm_dynamic_input>(), p, generic_layers);
         }
     }
+    program_helpers::choose_impls(p, generic_layers, std::thread::hardware_concurrency());
 }
 
 }  // namespace cldnn
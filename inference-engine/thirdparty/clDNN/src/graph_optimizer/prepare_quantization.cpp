@@ -25,6 +25,7 @@
 #include "binary_convolution_inst.h"
 #include "scale_inst.h"
 #include "eltwise_inst.h"
+#include "gemm_inst.h"
 #include "data_inst.h"
 #include "pass_manager.h"
 #include "program_helpers.h"
@@ -721,6 +722,80 @@ void prepare_quantization::prepare_asymmetric_quantization(program_impl &p) {
     }
 }
 
+void prepare_quantization::prepare_gemm_zero_points(program_impl &p) {
+    // Returns true and the value of the zero point if the node subtracts a per-tensor zero point from quantized data
+    auto get_zero_point = [](program_node& node, int32_t& zero_point) -> bool {
+        if (!node.is_type<eltwise>() || node.is_output() || node.get_users().size() != 1 ||
+            node.get_dependencies().size() != 2 || node.as<eltwise>().get_primitive()->mode != eltwise_mode::sub ||
+            !node.get_fused_primitives().empty() || !node.get_fused_activations_funcs().empty())
+            return false;
+
+        auto& zp_node = node.get_dependency(1);
+        auto in_dt = node.get_dependency(0).get_output_layout().data_type;
+        if (!zp_node.is_type<data>() || (in_dt != data_types::u8 && in_dt != data_types::i8) ||
+            zp_node.get_output_layout().data_type != in_dt)
+            return false;
+
+        auto& zp_mem = zp_node.as<data>().get_attached_memory();
+        auto count = zp_mem.get_layout().count();
+        std::vector<int32_t> values;
+        if (in_dt == data_types::u8) {
+            mem_lock<uint8_t> zp_lock{zp_mem};
+            values.assign(zp_lock.data(), zp_lock.data() + count);
+        } else {
+            mem_lock<int8_t> zp_lock{zp_mem};
+            values.assign(zp_lock.data(), zp_lock.data() + count);
+        }
+
+        if (values.empty() || std::any_of(values.begin(), values.end(), [&](int32_t v) { return v != values[0]; }))
+            return false;
+
+        zero_point = values[0];
+        return true;
+    };
+
+    auto itr = p.get_processing_order().begin();
+    while (itr != p.get_processing_order().end()) {
+        auto& node = (*itr++);
+
+        program_helpers::do_for_types<gemm>(*node, [&p, &get_zero_point](gemm_node& gemm_node) {
+            if (gemm_node.get_input0_zero_point() != 0 || gemm_node.get_input1_zero_point() != 0)
+                return;
+
+            int32_t zero_points[2] = {0, 0};
+            bool has_zero_point[2] = {false, false};
+            for (size_t i = 0; i < 2; i++) {
+                has_zero_point[i] = get_zero_point(gemm_node.input(i), zero_points[i]);
+                auto& data_node = has_zero_point[i] ? gemm_node.input(i).get_dependency(0) : gemm_node.input(i);
+                auto dt = data_node.get_output_layout().data_type;
+                // Zero points are applied by int8 kernels only, so both inputs have to stay quantized
+                if (dt != data_types::u8 && dt != data_types::i8)
+                    return;
+            }
+
+            if (!has_zero_point[0] && !has_zero_point[1])
+                return;
+
+            for (size_t i = 0; i < 2; i++) {
+                if (!has_zero_point[i])
+                    continue;
+
+                auto& sub_node = gemm_node.input(i);
+                auto& zp_node = sub_node.get_dependency(1);
+                p.replace_all_usages(sub_node, sub_node.get_dependency(0));
+                p.add_optimized_primitive_info(sub_node.id(), {gemm_node.id()});
+                p.remove_all_connections(sub_node);
+                p.remove_if_dangling(sub_node);
+                p.remove_if_dangling(zp_node);
+            }
+
+            gemm_node.set_input0_zero_point(zero_points[0]);
+            gemm_node.set_input1_zero_point(zero_points[1]);
+            gemm_node.recalc_output_layout();
+        });
+    }
+}
+
 void prepare_quantization::prepare_dequantize_merge(program_impl &p) {
     auto itr = p.get_processing_order().begin();
     while (itr != p.get_processing_order().end()) {
@@ -801,4 +876,5 @@ void prepare_quantization::run(program_impl& p) {
     prepare_dequantize_merge(p);
     remove_fake_reorders(p);
     prepare_asymmetric_quantization(p);
+    prepare_gemm_zero_points(p);
 }
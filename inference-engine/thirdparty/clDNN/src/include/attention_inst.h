@@ -0,0 +1,50 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "api/attention.hpp"
+
+#include "primitive_inst.h"
+#include <string>
+
+namespace cldnn {
+template <>
+struct typed_program_node<attention> : public typed_program_node_base<attention> {
+    using parent = typed_program_node_base<attention>;
+
+public:
+    using parent::parent;
+
+    program_node& input(size_t index = 0) const { return get_dependency(index); }
+    size_t inputs_count() const { return get_dependencies().size(); }
+    bool has_mask() const { return inputs_count() == 4; }
+};
+
+using attention_node = typed_program_node<attention>;
+
+template <>
+class typed_primitive_inst<attention> : public typed_primitive_inst_base<attention> {
+    using parent = typed_primitive_inst_base<attention>;
+
+public:
+    static layout calc_output_layout(attention_node const& node);
+    static std::string to_string(attention_node const& node);
+    typed_primitive_inst(network_impl& network, attention_node const& desc);
+};
+
+using attention_inst = typed_primitive_inst<attention>;
+}  // namespace cldnn
@@ -22,6 +22,7 @@
 #include <cl2_wrapper.h>
 #include "gpu/device_info.h"
 #include "api/device.hpp"
+#include "api/engine.hpp"
 #include "refcounted_obj.h"
 #include "gpu/configuration.h"
 
@@ -31,14 +32,6 @@
 #include <algorithm>
 
 namespace cldnn {
-enum class allocation_type {
-    unknown,     // Not specified (i.e simple_attached_memory class).
-    cl_mem,      // Use standard OpenCL cl_mem allocations.
-    usm_host,    // Accessible only by host. Not Migratable
-    usm_shared,  // Accessible by host and device. Migrtable.
-    usm_device,  // Accessible only by device. Not migratable.
-};
-
 struct device_impl;
 
 class memory_capabilities {
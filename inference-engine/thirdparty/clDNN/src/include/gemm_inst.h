@@ -30,6 +30,16 @@ public:
 
     program_node& input(size_t idx = 0) const { return get_dependency(idx); }
     size_t inputs_count() const { return this->get_primitive()->input_size(); }
+
+    // Per-tensor zero points of the quantized inputs, subtracted inside of the kernel
+    void set_input0_zero_point(int32_t zero_point) { input0_zero_point = zero_point; }
+    void set_input1_zero_point(int32_t zero_point) { input1_zero_point = zero_point; }
+    int32_t get_input0_zero_point() const { return input0_zero_point; }
+    int32_t get_input1_zero_point() const { return input1_zero_point; }
+
+private:
+    int32_t input0_zero_point = 0;
+    int32_t input1_zero_point = 0;
 };
 
 using gemm_node = typed_program_node<gemm>;
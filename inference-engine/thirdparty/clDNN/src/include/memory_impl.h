@@ -20,12 +20,17 @@
 
 #include "engine_impl.h"
 #include "refcounted_obj.h"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
 
 namespace cldnn {
 
 struct memory_impl : refcounted_obj<memory_impl> {
     memory_impl(const engine_impl::ptr& engine, const layout& layout, uint32_t net_id,  allocation_type type, bool reused = false)
-        : _engine(engine.get()), _layout(layout), _net_id(net_id), _bytes_count(_layout.bytes_count()), _type(type), _reused(reused) {}
+        : _engine(engine.get()), _layout(layout), _net_id(net_id), _bytes_count(_layout.bytes_count()), _type(type), _reused(reused),
+          _unique_id(next_unique_id()) {}
 
     virtual ~memory_impl() {
         if (_engine != nullptr && !_reused) {
@@ -35,6 +40,19 @@ struct memory_impl : refcounted_obj<memory_impl> {
     virtual void* lock() = 0;
     virtual void unlock() = 0;
     virtual void fill(unsigned char pattern, event_impl::ptr ev) = 0;
+    // copies size() bytes from host memory, returned event is set when the copy is finished
+    virtual event_impl::ptr copy_from_async(const void* host_ptr) {
+        std::memcpy(lock(), host_ptr, size());
+        unlock();
+        return _engine->create_user_event(_net_id, true);
+    }
+    // copies size() bytes to host memory after the events, returned event is set when the copy is finished
+    virtual event_impl::ptr copy_to_async(void* host_ptr, uint32_t net_id, const std::vector<event_impl::ptr>& deps) {
+        _engine->wait_for_events(deps);
+        std::memcpy(host_ptr, lock(), size());
+        unlock();
+        return _engine->create_user_event(net_id, true);
+    }
     size_t size() const { return _bytes_count; }
     virtual shared_mem_params get_internal_params() const = 0;
     virtual bool is_allocated_by(const engine_impl& engine) const { return &engine == _engine; }
@@ -43,6 +61,8 @@ struct memory_impl : refcounted_obj<memory_impl> {
     uint32_t get_net_id() const { return _net_id; }
     void set_net(uint32_t id) { _net_id = id; }
     allocation_type get_allocation_type() const { return _type; }
+    // unlike the buffer handle, the id is never reused by another memory object once this one is released
+    uint64_t get_unique_id() const { return _unique_id; }
     virtual bool is_memory_reset_needed(layout l) {
         // To avoid memory reset, output memory must meet the following requirements:
         // - To be Weights format (Data memory can be reused by memory_pool, which can lead to errors)
@@ -74,6 +94,12 @@ private:
     // before run of memory_impl destructor, when engine is static
     allocation_type _type;
     bool _reused;
+    const uint64_t _unique_id;
+
+    static uint64_t next_unique_id() {
+        static std::atomic<uint64_t> counter{0};
+        return ++counter;
+    }
 };
 
 struct simple_attached_memory : memory_impl {
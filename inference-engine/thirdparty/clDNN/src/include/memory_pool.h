@@ -26,6 +26,8 @@
 #include <map>
 #include <list>
 #include <string>
+#include <mutex>
+#include <atomic>
 
 namespace cldnn {
 
@@ -94,16 +96,21 @@ struct padded_pool_comparer {
 // - images 2d arrays - not implemented yet
 // - immutable - if user request for non reusable resource don't use pool, return
 
+// - cached - buffers of destroyed networks are kept up to engine_configuration::memory_pool_cache_limit bytes
+//     and given to new allocations of padded/non padded pools of any network of the engine
+
 // TODO list:
 // - resolve engine <--> memory_pool circular dependency
 // - add padded buffers pool
 // - add decreasing memory limit in gpu_buffer/image dctor
-// - add support for multi networks reuse
 
 class memory_pool {
     memory_pool();
 
     refcounted_obj_ptr<memory_impl> alloc_memory(const layout& layout, allocation_type type, uint32_t network_id, bool reset = true);
+    // takes buffer from the cache of released memory or allocates new one
+    refcounted_obj_ptr<memory_impl> alloc_or_reuse_cached(const layout& layout, allocation_type type, uint32_t network_id);
+    void cache_released_memory(refcounted_obj_ptr<memory_impl>& memory);
     static bool has_conflict(const memory_set&, const std::set<primitive_id>&, uint32_t network_id);
 
     std::multimap<uint64_t, memory_record> _non_padded_pool;
@@ -112,6 +119,11 @@ class memory_pool {
     engine_impl* _engine;
     std::atomic<uint64_t> _temp_memory_used;
     std::atomic<uint64_t> _max_peak_memory_used;
+    std::atomic<uint64_t> _reused_memory;
+
+    std::multimap<uint64_t, refcounted_obj_ptr<memory_impl>> _cached_pool;
+    uint64_t _cached_memory;
+    mutable std::mutex _cached_pool_mutex;
 
 public:
     explicit memory_pool(engine_impl& engine);
@@ -147,6 +159,8 @@ public:
 
     uint64_t get_temp_memory_used() const { return _temp_memory_used; }
     uint64_t get_max_peak_device_memory_used() const { return _max_peak_memory_used; }
+    uint64_t get_reused_memory() const { return _reused_memory; }
+    uint64_t get_cached_memory() const;
     void add_memory_used(size_t value);
     void subtract_memory_used(size_t value);
 };
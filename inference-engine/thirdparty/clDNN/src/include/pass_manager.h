@@ -165,6 +165,7 @@ private:
     void prepare_dequantize_merge(program_impl& p);
     void remove_fake_reorders(program_impl& p);
     void prepare_asymmetric_quantization(program_impl& p);
+    void prepare_gemm_zero_points(program_impl& p);
 };
 
 class prepare_conv_eltw_fusing : public base_pass {
@@ -266,7 +267,7 @@ private:
     template<typename T>
     weights_bias_offset get_weights_bias_offset(const T& node);
     template<typename T>
-    void optimize_weights(T& node, program_impl& p);
+    void optimize_weights(T& node, program_impl& p, std::vector<program_node*>& generic_layers);
     reorder_factory& _rf;
 };
 
@@ -107,6 +107,9 @@ struct program_helpers {
         else
             do_for_types<RestOfT...>(node, rest...);
     }
+    // selects implementations of the given nodes on a pool of worker threads, exceptions are rethrown on the calling thread
+    static void choose_impls(program_impl& p, const std::vector<program_node*>& nodes, size_t threads_num);
+
     static void merge_buffers(engine_impl& engine,
                               program_node& node,
                               const layout& target_layout,
@@ -22,6 +22,7 @@
 
 #include "refcounted_obj.h"
 #include "engine_impl.h"
+#include "memory_impl.h"
 
 #include <list>
 #include <string>
@@ -30,6 +31,8 @@
 #include <map>
 #include <utility>
 #include <set>
+#include <mutex>
+#include <functional>
 
 namespace cldnn {
 
@@ -164,6 +167,11 @@ public:
     std::shared_ptr<program_node> get_node_ptr(const primitive_id& prim) const { return nodes_map.at(prim); }
     void dump_memory_pool() const;
 
+    // returns device copy of constant data 'id' shared between all networks built from this program,
+    // the copy is created with 'create' by the first network which requests it
+    memory_impl::ptr get_or_create_shared_constant(const primitive_id& id,
+                                                   const std::function<memory_impl::ptr()>& create) const;
+
     // returns already existing program_node for given primitive 'prim' (lookup in 'nodes_map')
     // if it was previously created, otherwise creates and then returns program_node
     program_node& get_or_create(std::shared_ptr<primitive> prim);
@@ -238,6 +246,9 @@ private:
     primitives_info prim_info;
     graph_optimizer_info optimizer_passes_info;
 
+    mutable std::mutex shared_constants_mutex;
+    mutable std::map<primitive_id, memory_impl::ptr> shared_constants;
+
     primitives_info get_current_stage_info() const;
     /*
     ** High-level functions, in order of usage
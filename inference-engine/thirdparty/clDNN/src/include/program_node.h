@@ -78,6 +78,7 @@ struct program_node {
     friend class prepare_conv_eltw_read_write_opt;  // to be removed when possible
     friend class propagate_constants;               // to be removed when possible
     friend class post_optimize_weights;             // to be removed when possible - requires an access to selected_impl
+    friend struct program_helpers;                  // to be removed when possible - requires an access to selected_impl
 
     template <class PType>
     friend struct typed_program_node;
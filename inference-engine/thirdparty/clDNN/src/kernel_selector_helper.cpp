@@ -531,6 +531,8 @@ kernel_selector::tuning_mode to_tuning_mode(cldnn::tuning_mode mode) {
             return kernel_selector::tuning_mode::TUNING_USE_AND_UPDATE;
         case cldnn::tuning_mode::tuning_retune_and_cache:
             return kernel_selector::tuning_mode::TUNING_RETUNE_AND_CACHE;
+        case cldnn::tuning_mode::tuning_use_cache_or_offline:
+            return kernel_selector::tuning_mode::TUNING_USE_CACHE_OR_OFFLINE;
         default:
             return kernel_selector::tuning_mode::TUNING_DISABLED;
     }
@@ -18,6 +18,7 @@
 #include "api/memory.hpp"
 #include "memory_impl.h"
 #include "engine_impl.h"
+#include <stdexcept>
 
 namespace cldnn {
 
@@ -30,6 +31,25 @@ memory memory::allocate(const engine& engine, const layout& layout, uint32_t net
     return memory(engine.get()->allocate_memory(layout, type, net_id, reset).detach());
 }
 
+memory memory::allocate(const engine& engine, const layout& layout, allocation_type type, uint32_t net_id, bool reset) {
+    size_t size = layout.bytes_count();
+    if (size == 0)
+        throw std::invalid_argument("size should be more than 0");
+
+    if (!engine.supports_allocation(type))
+        throw std::invalid_argument("allocation type is not supported by engine");
+
+    if (type != allocation_type::cl_mem && layout.format.is_image_2d())
+        throw std::invalid_argument("image layouts support only cl_mem allocations");
+
+    return memory(engine.get()->allocate_memory(layout, type, net_id, reset).detach());
+}
+
+allocation_type memory::get_allocation_type() const {
+    if (_impl) return _impl->get_allocation_type();
+    else return allocation_type::unknown;
+}
+
 memory memory::share_buffer(const engine& engine, const layout& layout, shared_handle buf, uint32_t net_id) {
     shared_mem_params params = { shared_mem_type::shared_mem_buffer, nullptr, nullptr, buf,
 #ifdef WIN32
@@ -123,6 +143,12 @@ memory memory::attach_impl(const cldnn::layout& layout, void* ptr, uint32_t net_
     return memory(new simple_attached_memory(layout, ptr, net_id));
 }
 
+event memory::copy_from_async(const void* host_ptr) const {
+    if (!_impl || !_impl->get_engine())
+        throw std::runtime_error("Asynchronous copy is supported only for memory allocated by engine");
+    return event(_impl->copy_from_async(host_ptr).detach());
+}
+
 void* memory::lock_impl() const {
     if (_impl)  return _impl->lock();
     else return nullptr;
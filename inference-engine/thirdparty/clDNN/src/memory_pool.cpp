@@ -225,6 +225,7 @@ memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
              (layout.size.feature[0] % 32 == 0)) &&
             !has_conflict(it->second._users, restrictions, network_id)) {
             it->second._users.insert(memory_user(id, network_id));
+            _reused_memory += layout.bytes_count();
             auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
             return ret_mem;
         } else {
@@ -232,11 +233,13 @@ memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
         }
     }
     // didn't find anything for you? create new resource
-    auto mem = alloc_memory(layout, type, network_id);
+    auto mem = alloc_or_reuse_cached(layout, type, network_id);
     {
-        _non_padded_pool.emplace(layout.bytes_count(),
+        _non_padded_pool.emplace(mem->size(),
                                  memory_record({{id, network_id}}, mem, network_id, type));
     }
+    if (mem->get_layout() != layout)
+        return _engine->reinterpret_buffer(*mem, layout);
     return mem;
 }
 
@@ -260,6 +263,7 @@ memory_impl::ptr memory_pool::get_from_padded_pool(const layout& layout,
                 layout.format != format::fs_b_yx_fsv32 &&
                 !has_conflict(rec_list._users, restrictions, network_id)) {
                 rec_list._users.insert({id, network_id});
+                _reused_memory += layout.bytes_count();
                 auto ret_mem = _engine->reinterpret_buffer(*(rec_list._memory), layout);
                 return ret_mem;
             }
@@ -290,6 +294,7 @@ memory_impl::ptr memory_pool::get_from_across_networks_pool(const layout& layout
             it->second._type == type) {  // don't use non reusable resources within the same network
             if (!has_conflict(it->second._users, {}, network_id)) {
                 it->second._users.insert(memory_user(id, network_id));
+                _reused_memory += layout.bytes_count();
                 auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
                 return ret_mem;
             }
@@ -343,6 +348,7 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
 
             if (record._memory->get_net_id() == network_id &&
                 record._network_id == network_id) {
+                cache_released_memory(record._memory);
                 itr = _non_padded_pool.erase(itr);
             } else {
                 itr++;
@@ -392,7 +398,48 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
     }
 }
 
-memory_pool::memory_pool(engine_impl& engine) : _engine(&engine), _temp_memory_used(0), _max_peak_memory_used(0) {
+memory_pool::memory_pool(engine_impl& engine)
+    : _engine(&engine), _temp_memory_used(0), _max_peak_memory_used(0), _reused_memory(0), _cached_memory(0) {
+}
+
+memory_impl::ptr memory_pool::alloc_or_reuse_cached(const layout& layout, allocation_type type, uint32_t network_id) {
+    {
+        std::lock_guard<std::mutex> lock(_cached_pool_mutex);
+        auto it = _cached_pool.lower_bound(layout.bytes_count());
+        // don't waste big buffers for small requests
+        while (it != _cached_pool.end() && it->first <= 2 * layout.bytes_count()) {
+            auto& mem = it->second;
+            // buffer can still be referenced by primitives of the network which is being destroyed
+            if (mem->get_allocation_type() == type && mem->get_ref_count() == 1) {
+                auto ret_mem = mem;
+                _cached_memory -= it->first;
+                _cached_pool.erase(it);
+                ret_mem->set_net(network_id);
+                _reused_memory += layout.bytes_count();
+                return ret_mem;
+            }
+            ++it;
+        }
+    }
+    return alloc_memory(layout, type, network_id);
+}
+
+void memory_pool::cache_released_memory(memory_impl::ptr& memory) {
+    auto limit = _engine->configuration().memory_pool_cache_limit;
+    auto size = memory->size();
+    if (limit == 0 || memory->get_layout().format.is_image())
+        return;
+
+    std::lock_guard<std::mutex> lock(_cached_pool_mutex);
+    if (_cached_memory + size > limit)
+        return;
+    _cached_pool.emplace(size, memory);
+    _cached_memory += size;
+}
+
+uint64_t memory_pool::get_cached_memory() const {
+    std::lock_guard<std::mutex> lock(_cached_pool_mutex);
+    return _cached_memory;
 }
 
 void memory_pool::dump_memory_pool(const program_impl& program, std::string& path, std::string& dep) {
@@ -121,6 +121,11 @@ event network::get_primitive_event(const primitive_id& output_id) const {
     return event(out_event.detach());
 }
 
+event network::copy_output_async(const primitive_id& output_id, void* host_ptr) const {
+    auto copy_event = _impl->copy_output_async(output_id, host_ptr);
+    return event(copy_event.detach());
+}
+
 std::map<primitive_id, network_output> network::execute(const std::vector<event>& dependencies) const {
     std::vector<refcounted_obj_ptr<event_impl>> dep_impls(dependencies.size());
 
@@ -292,7 +297,8 @@ network_impl::network_impl(const program_impl& program, uint16_t stream_id, bool
         net_id = ++id_gen;
     }
     if (net_id) {
-        get_engine().get_context()->add_network(net_id);
+        auto queue_hints = program.get_options().get<build_option_type::queue_hints>();
+        get_engine().get_context()->add_network(net_id, queue_hints->priority, queue_hints->throttle);
     }
 
     allocate_primitives();
@@ -376,8 +382,10 @@ void network_impl::set_input_data(const primitive_id& id, memory_impl& data) {
 
     auto input = std::static_pointer_cast<input_layout_inst>(primitive_inst);
 
-    // Wait for previous execution completion
-    reset_execution(true);
+    // Wait for previous execution completion if the data is copied to the input buffer,
+    // engine memory is just bound to the input and the next execution is ordered on the device
+    if (!data.is_allocated_by(get_engine()))
+        reset_execution(true);
     input->set_data(data);
 }
 
@@ -494,8 +502,25 @@ void network_impl::add_to_exec_order(const primitive_id& id) {
     _exec_order.push_back(inst);
 }
 
+event_impl::ptr network_impl::copy_output_async(const primitive_id& id, void* host_ptr) {
+    auto copy_event = get_primitive(id)->output_memory().copy_to_async(host_ptr, get_id(), {get_primitive_event(id)});
+    _output_copy_events.push_back(copy_event);
+    return copy_event;
+}
+
 void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& events) {
-    // Wait for previous execution completion
+    std::vector<event_impl::ptr> wait_events(events);
+    // Previous execution isn't necessarily waited by host, out-of-order queue has to finish it before the buffers
+    // are reused. The copies of outputs are waited in any case, they aren't tracked by the queue.
+    if (get_engine().get_context()->get_configuration().host_out_of_order) {
+        for (auto& ev : _events) {
+            if (!ev.second->is_set())
+                wait_events.push_back(ev.second);
+        }
+    }
+    wait_events.insert(wait_events.end(), _output_copy_events.begin(), _output_copy_events.end());
+    _output_copy_events.clear();
+
     reset_execution(false);
 
     // collect all shared media surfaces and enqueue acquire/relese
@@ -518,6 +543,10 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
     cl_int err;
     cl::SharedSurfLock lock(get_engine().get_context()->queue(get_id()).get(), surfaces, &err);
 
+    // dependencies may come from other queues, which out-of-order network queue doesn't synchronize with
+    if (!wait_events.empty())
+        get_engine().get_context()->enqueue_barrier(get_id(), wait_events);
+
     set_arguments();
 
     for (auto& inst : _exec_order) {
@@ -758,11 +787,18 @@ void network_impl::transfer_memory_to_device(std::shared_ptr<primitive_inst> ins
     if (alloc_type == allocation_type::usm_host || alloc_type == allocation_type::usm_shared) {
         // Allocate and transfer memory
         auto& mem_pool = inst_mem.get_engine()->get_memory_pool();
-        auto device_mem = inst_mem.get_engine()->allocate_memory(
-            inst_mem.get_layout(),
-            allocation_type::usm_device,
-            inst_mem.get_net_id());
-        dynamic_cast<gpu::gpu_usm&>(*device_mem).copy_from_other(dynamic_cast<gpu::gpu_usm&>(inst_mem));
+        auto transfer = [&]() {
+            auto device_mem = inst_mem.get_engine()->allocate_memory(
+                inst_mem.get_layout(),
+                allocation_type::usm_device,
+                inst_mem.get_net_id());
+            dynamic_cast<gpu::gpu_usm&>(*device_mem).copy_from_other(dynamic_cast<gpu::gpu_usm&>(inst_mem));
+            return device_mem;
+        };
+        // Data primitives are never written by the network, so networks of the same program
+        // (e.g. one per stream) can share single device copy of them
+        auto device_mem = node.is_type<data>() ? _program->get_or_create_shared_constant(node.id(), transfer)
+                                               : transfer();
         mem_pool.release_memory(&inst_mem, node.id());
         instance->set_output_memory(*device_mem);
     }
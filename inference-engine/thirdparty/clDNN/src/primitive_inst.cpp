@@ -62,6 +62,7 @@ void primitive_inst::check_memory_to_set(const memory_impl& mem, const layout& l
             break;
         case shared_mem_type::shared_mem_buffer:
         case shared_mem_type::shared_mem_dxbuffer:
+        case shared_mem_type::shared_mem_usm:
             if (layout.format.is_image_2d())
                 CLDNN_ERROR_MESSAGE(_node.id(), "Attempt to set user-supplied input or output buffer instead of an image");
             break;
@@ -977,6 +977,18 @@ void program_impl::remove_nodes(std::list<program_node*>& to_remove) {
     }
 }
 
+memory_impl::ptr program_impl::get_or_create_shared_constant(const primitive_id& id,
+                                                            const std::function<memory_impl::ptr()>& create) const {
+    std::lock_guard<std::mutex> lock(shared_constants_mutex);
+    auto it = shared_constants.find(id);
+    if (it != shared_constants.end())
+        return it->second;
+
+    auto mem = create();
+    shared_constants.emplace(id, mem);
+    return mem;
+}
+
 void program_impl::dump_memory_pool() const {
     if (!get_engine().configuration().enable_memory_pool)
         return;
@@ -19,11 +19,47 @@
 #include "program_helpers.h"
 #include "program_impl.h"
 #include "data_inst.h"
+#include "kernel_base.h"
 #include <algorithm>
 #include <utility>
 #include <vector>
+#include <thread>
+#include <atomic>
+#include <exception>
 
 namespace cldnn {
+void program_helpers::choose_impls(program_impl& p, const std::vector<program_node*>& nodes, size_t threads_num) {
+    // every node gets its own range of kernel ids, so the kernels entry points (and the hashes of cached kernels)
+    // don't depend on the order in which worker threads pick up the nodes
+    const size_t ids_per_node = 1 << 16;
+    const size_t ids_base = kernel_selector::KernelBase::GetCounter();
+    std::vector<std::exception_ptr> errors(nodes.size());
+    std::atomic<size_t> next_node{0};
+    auto choose = [&] {
+        for (size_t i = next_node++; i < nodes.size(); i = next_node++) {
+            try {
+                kernel_selector::KernelBase::ResetCounter(ids_base + i * ids_per_node);
+                nodes[i]->selected_impl = nodes[i]->type()->choose_impl(p.get_engine(), *nodes[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < std::min(threads_num, nodes.size()); t++)
+        threads.emplace_back(choose);
+    choose();
+    for (auto& thread : threads)
+        thread.join();
+    kernel_selector::KernelBase::ResetCounter(ids_base + nodes.size() * ids_per_node);
+
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
 // helper function for merging the weights/biases buffers on cpu side for depthwise separable convolution optimization
 void program_helpers::merge_buffers(engine_impl& engine,
                                     program_node& node,
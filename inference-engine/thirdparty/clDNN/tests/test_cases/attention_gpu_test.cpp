@@ -0,0 +1,175 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+
+#include <api/input_layout.hpp>
+#include <api/memory.hpp>
+#include <api/attention.hpp>
+#include <api/topology.hpp>
+#include <api/network.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <tests/test_utils/test_utils.h>
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace {
+const size_t batch_num = 1, heads = 2, query_len = 3, key_len = 5, head_size = 4, value_size = 3;
+
+std::vector<float> make_values(size_t count, float step) {
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; i++)
+        values[i] = std::sin(step * (i + 1));
+    return values;
+}
+
+// key is [B, H, Lk, D] if transpose_key, otherwise [B, H, D, Lk]; mask is [1, 1, 1, Lk]
+std::vector<float> attention_ref(const std::vector<float>& q, const std::vector<float>& k, const std::vector<float>& v,
+                                 const std::vector<float>& mask, float scale, bool transpose_key) {
+    std::vector<float> out(batch_num * heads * query_len * value_size);
+    for (size_t bh = 0; bh < batch_num * heads; bh++) {
+        for (size_t i = 0; i < query_len; i++) {
+            std::vector<float> scores(key_len);
+            for (size_t j = 0; j < key_len; j++) {
+                float s = 0.f;
+                for (size_t d = 0; d < head_size; d++) {
+                    size_t k_idx = transpose_key ? (bh * key_len + j) * head_size + d
+                                                 : (bh * head_size + d) * key_len + j;
+                    s += q[(bh * query_len + i) * head_size + d] * k[k_idx];
+                }
+                scores[j] = s * scale + (mask.empty() ? 0.f : mask[j]);
+            }
+            float max_score = *std::max_element(scores.begin(), scores.end());
+            float sum = 0.f;
+            for (auto& s : scores) {
+                s = std::exp(s - max_score);
+                sum += s;
+            }
+            for (size_t c = 0; c < value_size; c++) {
+                float acc = 0.f;
+                for (size_t j = 0; j < key_len; j++)
+                    acc += scores[j] * v[(bh * key_len + j) * value_size + c];
+                out[(bh * query_len + i) * value_size + c] = acc / sum;
+            }
+        }
+    }
+    return out;
+}
+}  // namespace
+
+TEST(attention_gpu_test, fp32_with_mask) {
+    engine engine;
+
+    auto query = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 4, 3 } });
+    auto key = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 4, 5 } });
+    auto value = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 3, 5 } });
+    auto mask = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 5, 1 } });
+    const float scale = 0.5f;
+
+    auto query_values = make_values(batch_num * heads * query_len * head_size, 0.3f);
+    auto key_values = make_values(batch_num * heads * key_len * head_size, 0.7f);
+    auto value_values = make_values(batch_num * heads * key_len * value_size, 1.1f);
+    std::vector<float> mask_values = { 0.f, 0.f, -10000.f, 0.f, -10000.f };
+
+    set_values(query, query_values);
+    set_values(key, key_values);
+    set_values(value, value_values);
+    set_values(mask, mask_values);
+
+    topology topology;
+    topology.add(input_layout("query", query.get_layout()));
+    topology.add(input_layout("key", key.get_layout()));
+    topology.add(input_layout("value", value.get_layout()));
+    topology.add(input_layout("mask", mask.get_layout()));
+    topology.add(attention("attention", "query", "key", "value", "mask", scale, true));
+
+    network network(engine, topology);
+
+    network.set_input_data("query", query);
+    network.set_input_data("key", key);
+    network.set_input_data("value", value);
+    network.set_input_data("mask", mask);
+
+    auto outputs = network.execute();
+
+    auto output = outputs.at("attention").get_memory();
+    EXPECT_EQ(output.get_layout().size, tensor(1, 2, 3, 3));
+    auto output_ptr = output.pointer<float>();
+
+    auto expected_results = attention_ref(query_values, key_values, value_values, mask_values, scale, true);
+    for (size_t i = 0; i < expected_results.size(); ++i) {
+        EXPECT_NEAR(expected_results[i], output_ptr[i], 1e-5f);
+    }
+}
+
+TEST(attention_gpu_test, fp32_transposed_key_no_mask) {
+    engine engine;
+
+    auto query = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 4, 3 } });
+    auto key = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 5, 4 } });
+    auto value = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 3, 5 } });
+    const float scale = 1.f;
+
+    auto query_values = make_values(batch_num * heads * query_len * head_size, 0.2f);
+    auto key_values = make_values(batch_num * heads * key_len * head_size, 0.9f);
+    auto value_values = make_values(batch_num * heads * key_len * value_size, 1.3f);
+
+    set_values(query, query_values);
+    set_values(key, key_values);
+    set_values(value, value_values);
+
+    topology topology;
+    topology.add(input_layout("query", query.get_layout()));
+    topology.add(input_layout("key", key.get_layout()));
+    topology.add(input_layout("value", value.get_layout()));
+    topology.add(attention("attention", "query", "key", "value", scale, false));
+
+    network network(engine, topology);
+
+    network.set_input_data("query", query);
+    network.set_input_data("key", key);
+    network.set_input_data("value", value);
+
+    auto outputs = network.execute();
+
+    auto output = outputs.at("attention").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    auto expected_results = attention_ref(query_values, key_values, value_values, {}, scale, false);
+    for (size_t i = 0; i < expected_results.size(); ++i) {
+        EXPECT_NEAR(expected_results[i], output_ptr[i], 1e-5f);
+    }
+}
+
+TEST(attention_gpu_test, heads_number_mismatch_is_rejected) {
+    engine engine;
+
+    // key and value have a single head, the kernel does not broadcast them to the query heads
+    auto query = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 4, 3 } });
+    auto key = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 5 } });
+    auto value = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 3, 5 } });
+
+    topology topology;
+    topology.add(input_layout("query", query.get_layout()));
+    topology.add(input_layout("key", key.get_layout()));
+    topology.add(input_layout("value", value.get_layout()));
+    topology.add(attention("attention", "query", "key", "value"));
+
+    ASSERT_ANY_THROW(network network(engine, topology));
+}
@@ -19,6 +19,8 @@
 #include <api/input_layout.hpp>
 #include <api/memory.hpp>
 #include <api/gemm.hpp>
+#include <api/data.hpp>
+#include <api/eltwise.hpp>
 #include <api/topology.hpp>
 #include <api/network.hpp>
 
@@ -26,6 +28,7 @@
 #include "test_utils/uniform_quantized_real_distribution.hpp"
 
 #include <cstddef>
+#include <algorithm>
 
 using namespace cldnn;
 using namespace ::tests;
@@ -3237,6 +3240,78 @@ TEST(gemm_gpu, basic_smarcink2) {
     }
 }
 
+static void test_gemm_int8_zero_points(size_t b, size_t f, size_t m, size_t n, size_t k, bool transpose_input1) {
+    const auto& engine = get_test_engine();
+    const uint8_t a_zp = 128;
+    const int8_t b_zp = 3;
+
+    tensor a_size(batch(b), feature(f), spatial(k, m));
+    tensor b_size = transpose_input1 ? tensor(batch(b), feature(f), spatial(k, n)) : tensor(batch(b), feature(f), spatial(n, k));
+    auto input0 = memory::allocate(engine, { data_types::u8, format::bfyx, a_size });
+    auto input1 = memory::allocate(engine, { data_types::i8, format::bfyx, b_size });
+    auto a_zp_mem = memory::allocate(engine, { data_types::u8, format::bfyx, { 1, 1, 1, 1 } });
+    auto b_zp_mem = memory::allocate(engine, { data_types::i8, format::bfyx, { 1, 1, 1, 1 } });
+
+    std::vector<uint8_t> input0_data(b * f * m * k);
+    std::vector<int8_t> input1_data(b * f * k * n);
+    for (size_t i = 0; i < input0_data.size(); i++)
+        input0_data[i] = static_cast<uint8_t>((i * 7) % 256);
+    for (size_t i = 0; i < input1_data.size(); i++)
+        input1_data[i] = static_cast<int8_t>(static_cast<int>((i * 5) % 31) - 15);
+    set_values(input0, input0_data);
+    set_values(input1, input1_data);
+    set_values<uint8_t>(a_zp_mem, { a_zp });
+    set_values<int8_t>(b_zp_mem, { b_zp });
+
+    topology topology(
+        input_layout("input0", input0.get_layout()),
+        input_layout("input1", input1.get_layout()),
+        data("a_zp", a_zp_mem),
+        data("b_zp", b_zp_mem),
+        eltwise("input0_sub", { "input0", "a_zp" }, eltwise_mode::sub, data_types::f32),
+        eltwise("input1_sub", { "input1", "b_zp" }, eltwise_mode::sub, data_types::f32),
+        gemm("gemm", { "input0_sub", "input1_sub" }, data_types::f32, false, transpose_input1)
+    );
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    network network(engine, topology, options);
+    network.set_input_data("input0", input0);
+    network.set_input_data("input1", input1);
+    auto outputs = network.execute();
+
+    // zero points are subtracted by the gemm itself
+    auto executed = network.get_executed_primitive_ids();
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "input0_sub"), executed.end());
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "input1_sub"), executed.end());
+
+    auto output = outputs.at("gemm").get_memory();
+    auto output_ptr = output.pointer<float>();
+    ASSERT_EQ(output_ptr.size(), b * f * m * n);
+
+    for (size_t bf = 0; bf < b * f; bf++) {
+        for (size_t y = 0; y < m; y++) {
+            for (size_t x = 0; x < n; x++) {
+                int32_t expected = 0;
+                for (size_t i = 0; i < k; i++) {
+                    int32_t a = input0_data[bf * m * k + y * k + i] - a_zp;
+                    int32_t b_val = transpose_input1 ? input1_data[bf * n * k + x * k + i] : input1_data[bf * k * n + i * n + x];
+                    expected += a * (b_val - b_zp);
+                }
+                EXPECT_FLOAT_EQ(output_ptr[bf * m * n + y * n + x], static_cast<float>(expected));
+            }
+        }
+    }
+}
+
+TEST(gemm_gpu, int8_zero_points_batched) {
+    test_gemm_int8_zero_points(2, 3, 32, 16, 64, false);
+}
+
+TEST(gemm_gpu, int8_zero_points_batched_leftovers_transposed) {
+    test_gemm_int8_zero_points(1, 4, 17, 9, 30, true);
+}
+
 struct gemm_base_test_params {
     size_t m_size;
     size_t n_size;
@@ -0,0 +1,93 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+
+#include "test_utils/test_utils.h"
+
+#include <api/engine.hpp>
+#include <api/topology.hpp>
+#include <api/network.hpp>
+#include <api/input_layout.hpp>
+#include <api/activation.hpp>
+
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+
+const std::string cache_suffix = ".cl_cache";
+
+size_t count_cache_files(const std::string& dir) {
+    size_t count = 0;
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA((dir + "\\*" + cache_suffix).c_str(), &data);
+    if (handle == INVALID_HANDLE_VALUE)
+        return 0;
+    do {
+        count++;
+    } while (FindNextFileA(handle, &data));
+    FindClose(handle);
+#else
+    DIR* d = opendir(dir.c_str());
+    if (d == nullptr)
+        return 0;
+    while (auto entry = readdir(d)) {
+        std::string name = entry->d_name;
+        if (name.size() > cache_suffix.size() &&
+            name.compare(name.size() - cache_suffix.size(), cache_suffix.size(), cache_suffix) == 0)
+            count++;
+    }
+    closedir(d);
+#endif
+    return count;
+}
+
+void run_relu_network(const engine& engine, const std::string& name) {
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 3, 8, 8 } });
+    topology topology(
+        input_layout(name + "_input", input.get_layout()),
+        activation(name + "_relu", name + "_input", activation_func::relu));
+    network network(engine, topology);
+    network.set_input_data(name + "_input", input);
+    network.execute();
+}
+
+}  // namespace
+
+TEST(kernels_cache_gpu, kernels_are_reused_by_other_networks) {
+    // kernel names contain a unique number, so the cache must not depend on them
+    const std::string cache_dir = ".";
+    engine_configuration configuration(false, false, false, std::string(), std::string(), true, std::string(),
+                                       std::string(), priority_mode_types::disabled, throttle_mode_types::disabled,
+                                       true, 1, cache_dir);
+    engine engine(configuration);
+
+    run_relu_network(engine, "first");
+    const auto cached = count_cache_files(cache_dir);
+    ASSERT_GT(cached, 0u);
+
+    run_relu_network(engine, "second");
+    EXPECT_EQ(cached, count_cache_files(cache_dir));
+}
@@ -569,3 +569,35 @@ TEST(memory_pool, add_mem_dep_test) {
     EXPECT_EQ(out2_ptr[2], 7.0f);
     EXPECT_EQ(out2_ptr[3], 8.0f);
 }
+
+TEST(memory_pool, copy_output_async_before_next_execution) {
+    engine_configuration cfg{ false, false, false, std::string(), std::string(), true /*oooq*/ };
+    engine engine{ cfg };
+    auto input_layout1 = layout(cldnn::data_types::f32, cldnn::format::bfyx, { 1, 2, 2, 2 });
+
+    auto input_memory1 = cldnn::memory::allocate(engine, input_layout1);
+    auto input_memory2 = cldnn::memory::allocate(engine, input_layout1);
+    set_values(input_memory1, { -1.0f, 2.0f, -3.0f, 4.0f, -5.0f, 6.0f, -7.0f, 8.0f });
+    set_values(input_memory2, { 10.0f, -20.0f, 30.0f, -40.0f, 50.0f, -60.0f, 70.0f, -80.0f });
+
+    topology topology(
+        input_layout("input1", input_layout1),
+        activation("out", "input1", activation_func::abs)
+    );
+
+    network network(engine, topology);
+    std::vector<float> out1(8), out2(8);
+
+    // the second execution is enqueued before the host waits for the copy of the first output
+    network.set_input_data("input1", input_memory1);
+    network.execute();
+    auto copy1 = network.copy_output_async("out", out1.data());
+    network.set_input_data("input1", input_memory2);
+    network.execute();
+    auto copy2 = network.copy_output_async("out", out2.data());
+    copy1.wait();
+    copy2.wait();
+
+    EXPECT_EQ(out1, std::vector<float>({ 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f }));
+    EXPECT_EQ(out2, std::vector<float>({ 10.0f, 20.0f, 30.0f, 40.0f, 50.0f, 60.0f, 70.0f, 80.0f }));
+}
@@ -2323,7 +2323,23 @@ inline v_uint16x8 v_mulhi(const v_uint16x8& a, uint16_t b) {
     return result;
 }
 
+static inline void v_deinterleave(const v_float32x4& low, const v_float32x4& high,
+                                        v_float32x4& even,      v_float32x4& odd) {
+    float32x4x2_t r = vuzpq_f32(low.val, high.val);
+    even.val = r.val[0];
+    odd .val = r.val[1];
+}
+
+// for each j=mapsx[x + k], load two floats src[j] and src[j+1]
+static inline void v_gather_pairs(const float src[], const int mapsx[], int x,
+                                  v_float32x4& low, v_float32x4& high) {
+    low.val  = vcombine_f32(vld1_f32(&src[mapsx[x + 0]]), vld1_f32(&src[mapsx[x + 1]]));
+    high.val = vcombine_f32(vld1_f32(&src[mapsx[x + 2]]), vld1_f32(&src[mapsx[x + 3]]));
+}
 
+static inline v_float32x4 v_fma(const v_float32x4& a, float b, const v_float32x4& c) {
+    return v_fma(a, v_setall_f32(b), c);
+}
 
 CV_CPU_OPTIMIZATION_HAL_NAMESPACE_END
 
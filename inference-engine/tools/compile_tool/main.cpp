@@ -33,7 +33,9 @@ static constexpr char targetDeviceMessage[] =
 "                                             The application looks for a suitable plugin for the specified device.";
 
 static constexpr char output_message[] =
-                                             "Optional. Path to the output file. Default value: \"<model_xml_file>.blob\".";
+                                             "Optional. Path to the output file. Default value: \"<model_xml_file>.blob\".\n"
+"                                             For GPU it is a path to the directory with compiled kernels.\n"
+"                                             Default value: \"<model_xml_file>_cl_cache\".";
 
 static constexpr char config_message[] =
                                              "Optional. Path to the configuration file.";
@@ -78,6 +80,12 @@ static constexpr char tiling_cmx_limit_message[] =
 "                                             Value should be equal or greater than -1.\n"
 "                                             Overwrites value from config.";
 
+// CPU-specific
+static constexpr char cpu_max_isa_message[] =
+                                             "Optional. Specifies maximal instruction set of implementations selected for the network:\n"
+"                                             SSE42, AVX, AVX2 or AVX512. Use it to run the blob on machines with older CPUs.\n"
+"                                             Overwrites value from config.";
+
 // FPGA-specific
 static constexpr char dla_arch_name[] =
                                              "Optional. Specify architecture name used to compile executable network for FPGA device.";
@@ -96,6 +104,7 @@ DEFINE_string(iol, "", iol_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
 DEFINE_string(VPU_TILING_CMX_LIMIT_KB, "", tiling_cmx_limit_message);
+DEFINE_string(CPU_MAX_ISA, "", cpu_max_isa_message);
 DEFINE_string(DLA_ARCH_NAME, "", dla_arch_name);
 
 static void showUsage() {
@@ -119,6 +128,9 @@ static void showUsage() {
     std::cout << "      -VPU_NUMBER_OF_CMX_SLICES  <value>     "   << number_of_cmx_slices_message << std::endl;
     std::cout << "      -VPU_TILING_CMX_LIMIT_KB   <value>     "   << tiling_cmx_limit_message     << std::endl;
     std::cout                                                                                      << std::endl;
+    std::cout << " CPU-specific options:                       "                                   << std::endl;
+    std::cout << "      -CPU_MAX_ISA               <value>     "   << cpu_max_isa_message          << std::endl;
+    std::cout                                                                                      << std::endl;
     std::cout << " FPGA-specific options:                      "                                   << std::endl;
     std::cout << "      -DLA_ARCH_NAME             <value>     "   << dla_arch_name                << std::endl;
     std::cout << std::endl;
@@ -171,8 +183,13 @@ static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
     return config;
 }
 
+static bool isGPU() {
+    return FLAGS_d.compare(0, 3, "GPU") == 0;
+}
+
 static std::map<std::string, std::string> configure() {
     const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
+    const bool isCPU = FLAGS_d.find("CPU") != std::string::npos;
     const bool isFPGA = FLAGS_d.find("FPGA") != std::string::npos;
 
     auto config = parseConfigFile();
@@ -195,6 +212,14 @@ IE_SUPPRESS_DEPRECATED_END
         }
     }
 
+    if (isCPU) {
+        if (!FLAGS_CPU_MAX_ISA.empty()) {
+            std::string isa = FLAGS_CPU_MAX_ISA;
+            std::transform(isa.begin(), isa.end(), isa.begin(), ::toupper);
+            config[CONFIG_KEY(CPU_MAX_ISA)] = isa;
+        }
+    }
+
     if (isFPGA) {
         if (!FLAGS_DLA_ARCH_NAME.empty()) {
             config["DLIA_ARCH_NAME"] = FLAGS_DLA_ARCH_NAME;
@@ -493,21 +518,35 @@ int main(int argc, char* argv[]) {
         }
         std::cout << std::endl;
 
-        auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-        auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure());
-        loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+        auto config = configure();
 
+        // GPU plugin can't export networks, so compiled OpenCL kernels are stored to the kernels cache
+        // directory instead, loading the network with the same CACHE_DIR skips their compilation
         std::string outputName = FLAGS_o;
-        if (outputName.empty()) {
+        if (isGPU()) {
+            if (outputName.empty()) {
+                outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + "_cl_cache";
+            }
+            config[CONFIG_KEY(CACHE_DIR)] = outputName;
+        } else if (outputName.empty()) {
             outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
         }
 
-        std::ofstream outputFile{outputName};
-        if (!outputFile.is_open()) {
-            std::cout << "Output file " << outputName << " can't be opened for writing" << std::endl;
-            return EXIT_FAILURE;
+        auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+        auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, config);
+        loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+
+        if (isGPU()) {
+            std::cout << "Compiled kernels are stored to " << outputName << ". Set CACHE_DIR to this directory "
+                      << "to load the network without kernels compilation." << std::endl;
         } else {
-            executableNetwork.Export(outputFile);
+            std::ofstream outputFile{outputName, std::ios::out | std::ios::binary};
+            if (!outputFile.is_open()) {
+                std::cout << "Output file " << outputName << " can't be opened for writing" << std::endl;
+                return EXIT_FAILURE;
+            } else {
+                executableNetwork.Export(outputFile);
+            }
         }
     } catch (const std::exception& error) {
         std::cerr << error.what() << std::endl;
@@ -0,0 +1,86 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+#include "remote_worker.hpp"
+
+using namespace InferenceEngine;
+using namespace RemotePlugin;
+
+static constexpr char help_message[] =
+                                             "Optional. Print the usage message.";
+
+static constexpr char port_message[] =
+                                             "Optional. The TCP port to accept the connections of the REMOTE plugin. Default value: 9797.";
+
+static constexpr char bind_message[] =
+                                             "Optional. The IPv4 address to accept the connections on, e.g. 0.0.0.0 for all the interfaces. "
+                                             "Default value: 127.0.0.1.";
+
+static constexpr char max_network_size_message[] =
+                                             "Optional. The limit of the network (IR xml and weights) size in megabytes. Default value: 1024.";
+
+static constexpr char allow_config_message[] =
+                                             "Optional. Comma-separated device config keys the REMOTE plugin may set in addition to the default "
+                                             "ones. The keys that write files (e.g. CACHE_DIR) are not allowed by default.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_int32(port, 9797, port_message);
+DEFINE_string(bind, "127.0.0.1", bind_message);
+DEFINE_uint32(max_network_size, 1024, max_network_size_message);
+DEFINE_string(allow_config, "", allow_config_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "remote_worker [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                                       " << help_message << std::endl;
+    std::cout << "    -port                  <value>           " << port_message << std::endl;
+    std::cout << "    -bind                  <address>         " << bind_message << std::endl;
+    std::cout << "    -max_network_size      <value>           " << max_network_size_message << std::endl;
+    std::cout << "    -allow_config          <keys>            " << allow_config_message << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+        if (FLAGS_h) {
+            showUsage();
+            return EXIT_SUCCESS;
+        }
+
+        WorkerOptions options;
+        options.maxNetworkSize = std::uint64_t{FLAGS_max_network_size} << 20;
+        std::istringstream keys(FLAGS_allow_config);
+        for (std::string key; std::getline(keys, key, ',');) {
+            if (!key.empty()) {
+                options.allowedConfigKeys.insert(key);
+            }
+        }
+
+        Core core;
+        auto listener = Socket::Listen(FLAGS_bind, FLAGS_port);
+        std::cout << "[ INFO ] Waiting for the REMOTE plugin connections on " << FLAGS_bind << ":" << FLAGS_port << std::endl;
+        while (true) {
+            std::thread(ServeConnection, std::ref(core), listener.Accept(), std::cref(options)).detach();
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+}
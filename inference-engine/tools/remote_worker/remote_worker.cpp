@@ -0,0 +1,247 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "inference_engine.hpp"
+#include <cldnn/cldnn_config.hpp>
+#include "remote_worker.hpp"
+
+using namespace InferenceEngine;
+
+namespace RemotePlugin {
+
+namespace {
+
+void SendError(Socket& socket, std::uint64_t id, const std::string& error) {
+    PayloadWriter payload;
+    payload.Append(error);
+    MessageHeader header;
+    header.type = static_cast<std::uint32_t>(MessageType::Error);
+    header.id = id;
+    header.size = payload._data.size();
+    socket.Write(header, payload._data.data());
+}
+
+/**
+ * @brief The executable network of a connection. The infer requests are started as soon as their inputs are
+ * received and the results are sent from the completion callbacks, so the requests of the plugin are pipelined
+ */
+class ConnectionNetwork {
+public:
+    ConnectionNetwork(Core& core, Socket& socket, const std::vector<char>& loadPayload, const WorkerOptions& options)
+        : _socket{socket} {
+        PayloadReader reader{loadPayload};
+        auto device = reader.ReadString();
+        std::map<std::string, std::string> config;
+        for (auto numKeys = reader.ReadInteger(); numKeys > 0; --numKeys) {
+            auto key = reader.ReadString();
+            if (options.allowedConfigKeys.count(key) == 0) {
+                THROW_IE_EXCEPTION << "The " << key << " config key is not allowed by the REMOTE worker";
+            }
+            config[key] = reader.ReadString();
+        }
+        std::map<std::string, std::pair<std::string, std::uint64_t>> inputs, outputs;
+        for (auto numInputs = reader.ReadInteger(); numInputs > 0; --numInputs) {
+            auto name = reader.ReadString();
+            auto precision = reader.ReadString();
+            inputs[name] = {precision, reader.ReadInteger()};
+        }
+        for (auto numOutputs = reader.ReadInteger(); numOutputs > 0; --numOutputs) {
+            auto name = reader.ReadString();
+            auto precision = reader.ReadString();
+            outputs[name] = {precision, reader.ReadInteger()};
+        }
+        auto xml = reader.ReadString();
+        auto bin = reader.ReadString();
+
+        auto weights = make_shared_blob<std::uint8_t>({Precision::U8, {bin.size()}, Layout::C});
+        weights->allocate();
+        std::copy(bin.begin(), bin.end(), weights->buffer().as<char*>());
+        auto network = core.ReadNetwork(xml, weights);
+        for (auto&& input : network.getInputsInfo()) {
+            auto& info = inputs.at(input.first);
+            input.second->setPrecision(Precision::FromStr(info.first));
+            input.second->setLayout(static_cast<Layout>(info.second));
+        }
+        for (auto&& output : network.getOutputsInfo()) {
+            auto& info = outputs.at(output.first);
+            output.second->setPrecision(Precision::FromStr(info.first));
+            output.second->setLayout(static_cast<Layout>(info.second));
+        }
+        _network = core.LoadNetwork(network, device, config);
+        // the blobs are sent in the order of the names, as the plugin does
+        for (auto&& input : _network.GetInputsInfo()) {
+            _inputNames.push_back(input.first);
+        }
+        for (auto&& output : _network.GetOutputsInfo()) {
+            _outputNames.push_back(output.first);
+        }
+
+        unsigned int numRequests = 1;
+        try {
+            numRequests = _network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const std::exception&) {}
+        _requests.resize(numRequests);
+        _ids.resize(numRequests);
+        for (unsigned int i = 0; i < numRequests; ++i) {
+            _requests[i] = _network.CreateInferRequest();
+            _requests[i].SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [this, i] (InferRequest, StatusCode status) {
+                    Completed(i, status);
+                });
+            _idleRequests.push_back(i);
+        }
+    }
+
+    ~ConnectionNetwork() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _idleCondition.wait(lock, [this] { return _idleRequests.size() == _requests.size(); });
+    }
+
+    std::size_t NumRequests() const {
+        return _requests.size();
+    }
+
+    // receives the inputs directly to the blobs of an idle request and starts it
+    void Infer(const MessageHeader& header) {
+        std::size_t idx = 0;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _idleCondition.wait(lock, [this] { return !_idleRequests.empty(); });
+            idx = _idleRequests.front();
+            _idleRequests.pop_front();
+        }
+        auto& request = _requests[idx];
+        _ids[idx] = header.id;
+        try {
+            std::uint64_t inputsSize = 0;
+            for (auto&& name : _inputNames) {
+                inputsSize += request.GetBlob(name)->byteSize();
+            }
+            if (inputsSize != header.size) {
+                THROW_IE_EXCEPTION << "Received " << header.size << " bytes of the inputs, while " << inputsSize << " bytes are expected";
+            }
+            for (auto&& name : _inputNames) {
+                auto blob = as<MemoryBlob>(request.GetBlob(name));
+                _socket.Read(blob->wmap().as<void*>(), blob->byteSize());
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _idleRequests.push_back(idx);
+            _idleCondition.notify_all();
+            throw;
+        }
+        request.StartAsync();
+    }
+
+private:
+    void Completed(std::size_t idx, StatusCode status) {
+        auto& request = _requests[idx];
+        try {
+            if (StatusCode::OK != status) {
+                std::lock_guard<std::mutex> lock(_writeMutex);
+                SendError(_socket, _ids[idx], "the request failed with the status " + std::to_string(status));
+            } else {
+                std::vector<MemoryBlob::Ptr> blobs;
+                MessageHeader header;
+                header.type = static_cast<std::uint32_t>(MessageType::Result);
+                header.id = _ids[idx];
+                std::vector<iovec> buffers = {{&header, sizeof(header)}};
+                for (auto&& name : _outputNames) {
+                    blobs.push_back(as<MemoryBlob>(request.GetBlob(name)));
+                    buffers.push_back({const_cast<std::uint8_t*>(blobs.back()->rmap().as<const std::uint8_t*>()), blobs.back()->byteSize()});
+                    header.size += blobs.back()->byteSize();
+                }
+                std::lock_guard<std::mutex> lock(_writeMutex);
+                _socket.Write(std::move(buffers));
+            }
+        } catch (const std::exception&) {
+            // the connection is broken, the reading loop stops on the next read
+            _socket.Shutdown();
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        _idleRequests.push_back(idx);
+        _idleCondition.notify_all();
+    }
+
+    Socket&                     _socket;
+    ExecutableNetwork           _network;
+    std::vector<std::string>    _inputNames;
+    std::vector<std::string>    _outputNames;
+    std::vector<InferRequest>   _requests;
+    std::vector<std::uint64_t>  _ids;
+    std::mutex                  _mutex;
+    std::mutex                  _writeMutex;
+    std::condition_variable     _idleCondition;
+    std::deque<std::size_t>     _idleRequests;
+};
+
+}  // namespace
+
+std::set<std::string> WorkerOptions::DefaultAllowedConfigKeys() {
+    return {
+        CONFIG_KEY(CPU_THREADS_NUM),
+        CONFIG_KEY(CPU_BIND_THREAD),
+        CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
+        CONFIG_KEY(GPU_THROUGHPUT_STREAMS),
+        CONFIG_KEY(PERF_COUNT),
+        CONFIG_KEY(DYN_BATCH_LIMIT),
+        CONFIG_KEY(DYN_BATCH_ENABLED),
+        CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
+        CONFIG_KEY(ENFORCE_BF16),
+        CLDNN_CONFIG_KEY(PLUGIN_PRIORITY),
+        CLDNN_CONFIG_KEY(PLUGIN_THROTTLE),
+        CLDNN_CONFIG_KEY(ENABLE_FP16_FOR_QUANTIZED_MODELS),
+    };
+}
+
+void ServeConnection(Core& core, Socket socket, const WorkerOptions& options) {
+    try {
+        std::unique_ptr<ConnectionNetwork> network;
+        MessageHeader header;
+        try {
+            header = socket.ReadHeader();
+            if (header.type != static_cast<std::uint32_t>(MessageType::Load)) {
+                THROW_IE_EXCEPTION << "The connection does not start with the Load message";
+            }
+            auto payload = socket.ReadPayload(header, options.maxNetworkSize);
+            network.reset(new ConnectionNetwork(core, socket, payload, options));
+        } catch (const std::exception& e) {
+            SendError(socket, header.id, e.what());
+            throw;
+        }
+        PayloadWriter loaded;
+        loaded.Append(static_cast<std::uint64_t>(network->NumRequests()));
+        MessageHeader reply;
+        reply.type = static_cast<std::uint32_t>(MessageType::Loaded);
+        reply.size = loaded._data.size();
+        socket.Write(reply, loaded._data.data());
+        std::cout << "[ INFO ] Loaded a network with " << network->NumRequests() << " infer requests" << std::endl;
+
+        // the connection is closed by the plugin when the executable network is destroyed
+        while (true) {
+            header = socket.ReadHeader();
+            if (header.type != static_cast<std::uint32_t>(MessageType::Infer)) {
+                THROW_IE_EXCEPTION << "Unexpected message " << header.type;
+            }
+            network->Infer(header);
+        }
+    } catch (const std::exception& e) {
+        std::cout << "[ INFO ] The connection is closed: " << e.what() << std::endl;
+    }
+}
+
+}  // namespace RemotePlugin
@@ -0,0 +1,34 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <string>
+
+#include <ie_core.hpp>
+#include "remote_transport.hpp"
+
+namespace RemotePlugin {
+
+/**
+ * @brief The limits of the worker. The messages come from the network, so the payload sizes and the config keys
+ * are checked before anything is allocated or passed to the device
+ */
+struct WorkerOptions {
+    // the limit of the Load message, that contains the IR xml and weights
+    std::uint64_t           maxNetworkSize = std::uint64_t{1} << 30;
+    // the device config keys the plugin may set, the keys that write files are not allowed by default
+    std::set<std::string>   allowedConfigKeys = DefaultAllowedConfigKeys();
+
+    static std::set<std::string> DefaultAllowedConfigKeys();
+};
+
+/**
+ * @brief Loads the network of the Load message and runs the Infer messages until the connection is closed
+ */
+void ServeConnection(InferenceEngine::Core& core, Socket socket, const WorkerOptions& options);
+
+}  // namespace RemotePlugin
@@ -74,7 +74,7 @@ namespace ngraph
 // More information about this is at:
 // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
 
-class ngraph::event::Manager
+class NGRAPH_API ngraph::event::Manager
 {
     friend class Duration;
     friend class Object;
@@ -117,6 +117,9 @@ public:
     /// This funtion has an implicit stop() if stop() has not been previously called
     void write();
 
+    /// \brief replace the arguments of the event, e.g. with values known only at the end
+    void set_args(const std::string& args) { m_args = args; }
+
     Duration(const Duration&) = delete;
     Duration& operator=(Duration const&) = delete;
 
@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+
+namespace ngraph
+{
+    /// \brief Prepared evaluation of a Function for repeated calls.
+    ///
+    /// Function::evaluate allocates a new tensor for every intermediate value on every call. The
+    /// plan orders the ops once and assigns every statically shaped intermediate value to a slot
+    /// of a preallocated arena. Values which are never alive at the same time share a slot, so
+    /// the arena is as large as the peak of simultaneously alive values. Constants are read in
+    /// place. Only values with a dynamic shape are allocated per call.
+    ///
+    /// The function must not be modified while the plan is used. Calls share the arena, so one
+    /// plan must not be evaluated from several threads at once.
+    class NGRAPH_API EvaluationPlan
+    {
+    public:
+        explicit EvaluationPlan(const std::shared_ptr<const Function>& function);
+
+        /// \brief Evaluates the function, the same as Function::evaluate
+        /// \param output_tensors Tensors for the results of the function
+        /// \param input_tensors Tensors for the parameters of the function
+        bool evaluate(const HostTensorVector& output_tensors,
+                      const HostTensorVector& input_tensors) const;
+
+        /// \brief Size of the arena holding the intermediate values
+        size_t get_arena_size() const { return m_arena ? m_arena->get_size_in_bytes() : 0; }
+    private:
+        struct Step
+        {
+            Node* node;
+            std::vector<size_t> inputs;
+            std::vector<size_t> outputs;
+        };
+
+        std::shared_ptr<const Function> m_function;
+        std::vector<Step> m_steps;
+        /// \brief Value slots. Statically shaped intermediates and constants are bound to
+        ///        tensors here, parameter, result and dynamic slots are empty
+        HostTensorVector m_tensors;
+        /// \brief Outputs producing the dynamic slots
+        std::vector<std::pair<size_t, Output<Node>>> m_dynamic_values;
+        std::vector<size_t> m_parameter_slots;
+        std::vector<size_t> m_result_slots;
+        HostTensorPtr m_arena;
+    };
+}
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -109,6 +110,13 @@ namespace ngraph
 
         void validate_nodes_and_infer_types();
 
+        /// \brief Re-infers output types and shapes of nodes changed since their last
+        /// validation (see Node::needs_revalidation) and all nodes below them.
+        ///
+        /// Unlike validate_nodes_and_infer_types, nodes which are not reachable from a changed
+        /// node are not validated, so a rewrite of a small part of a big function is cheap.
+        void validate_changed_nodes_and_infer_types();
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
@@ -146,6 +154,9 @@ namespace ngraph
         /// \brief Evaluate the function on inputs, putting results in outputs.
         /// \param outputs Tensors for the outputs to compute. One for each result
         /// \param inputs Tensors for the inputs. One for each inputs.
+        ///
+        /// Intermediate tensors are allocated on every call, use EvaluationPlan to evaluate the
+        /// same function many times.
         bool evaluate(const HostTensorVector& output_tensors,
                       const HostTensorVector& input_tensors) const;
 
@@ -174,6 +185,7 @@ namespace ngraph
         Function(const Function&) = delete;
         Function(const Function&&) = delete;
         Function& operator=(const Function&) = delete;
+        void check_parameter_is_declared(const std::shared_ptr<Node>& node) const;
 
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
@@ -181,6 +193,14 @@ namespace ngraph
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
 
+        // The last topological order and its validity flag, which is shared with the nodes of
+        // the order, so any change of their inputs or control dependencies resets it. The nodes
+        // are held weakly to not prolong the lifetime of the nodes removed from the graph.
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
+        std::shared_ptr<std::atomic_bool> m_ordered_ops_valid{
+            std::make_shared<std::atomic_bool>(false)};
+
         ResultVector m_results;
 
         // List of the nodes with side effect in graph.
@@ -18,7 +18,6 @@
 
 #include <atomic>
 #include <cstring>
-#include <deque>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -43,6 +42,7 @@
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/output_vector.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -141,6 +141,9 @@ namespace ngraph
         template <typename NodeType>
         friend class Output;
 
+        // For access to the cached topological orders which contain the node.
+        friend class Function;
+
     public:
         /// \brief Verifies that attributes and inputs are consistent and computes output shapes
         /// and element types. Must be implemented by concrete child classes so that it
@@ -233,7 +236,20 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        void revalidate_and_infer_types()
+        {
+            validate_and_infer_types();
+            m_needs_revalidation = false;
+        }
+        /// \brief Marks the node for re-inference of its outputs by
+        ///        Function::validate_changed_nodes_and_infer_types.
+        ///
+        /// Changes of inputs and output types are tracked automatically. Code which changes
+        /// attributes of an existing node in place must call this method if the change affects
+        /// output shapes or element types.
+        void mark_for_revalidation() { m_needs_revalidation = true; }
+        /// \returns true if the node was changed since its last validation
+        bool needs_revalidation() const { return m_needs_revalidation; }
         /// \brief Get the string name for the type of the node, such as `Add` or `Multiply`.
         ///        The class name, must not contain spaces as it is used for codegen.
         /// \returns A const reference to the node's type name
@@ -468,19 +484,36 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// \brief Marks the topological orders cached by the functions which contain this node
+        ///        as outdated. Called whenever inputs or control dependencies of the node change.
+        void invalidate_ordered_ops_caches();
+        /// \brief Remembers a validity flag of a topological order which contains this node.
+        void add_ordered_ops_cache(const std::shared_ptr<std::atomic_bool>& valid);
+
+        /// \brief Provenance data is used by a few frontends only, so it is allocated on first
+        ///        use instead of being kept by every node.
+        struct Provenance
+        {
+            std::unordered_set<std::string> tags;
+            std::set<std::shared_ptr<Node>> group;
+        };
+        Provenance& get_provenance();
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
+        bool m_needs_revalidation{true};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        std::unique_ptr<Provenance> m_provenance;
+        // Outputs keep pointers to connected inputs and inputs keep pointers to outputs, so
+        // descriptors must not move in memory when a node gets new inputs or outputs
+        StableVector<descriptor::Input> m_inputs;
+        StableVector<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        std::vector<std::weak_ptr<std::atomic_bool>> m_ordered_ops_caches;
     };
 
     using NodeTypeInfo = Node::type_info_t;
@@ -343,6 +343,72 @@ namespace ngraph
                 /// \return The initialization literals for the tensor constant.
                 std::vector<std::string> get_value_strings() const;
 
+                /// \brief Read-only view of the Constant's data, the data is not copied.
+                /// The view is valid while the Constant is alive.
+                template <typename T>
+                class DataView
+                {
+                public:
+                    DataView(const T* data, size_t size)
+                        : m_begin(data)
+                        , m_end(data + size)
+                    {
+                    }
+                    const T* begin() const { return m_begin; }
+                    const T* end() const { return m_end; }
+                    const T* data() const { return m_begin; }
+                    size_t size() const { return m_end - m_begin; }
+                    bool empty() const { return m_begin == m_end; }
+                    const T& operator[](size_t index) const { return m_begin[index]; }
+                private:
+                    const T* m_begin;
+                    const T* m_end;
+                };
+
+                /// \brief Return a view of the Constant's data, an alternative to get_vector
+                /// which doesn't allocate memory.
+                ///
+                /// \tparam T  Type of the Constant's data elements.
+                template <typename T>
+                DataView<T> get_data_view() const
+                {
+                    return DataView<T>(get_data_ptr<T>(), shape_size(m_shape));
+                }
+
+                /// \brief Check whether \p pred is true for all the Constant's values cast to type T.
+                /// The values are cast one by one, unlike cast_vector no memory is allocated.
+                ///
+                /// \tparam T  Type to which data vector's entries will be cast.
+                /// \param pred  Predicate called for the cast values until it returns false.
+                template <typename T, typename Pred>
+                bool cast_all_of(Pred pred) const
+                {
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4244)
+#endif
+                    switch (get_element_type())
+                    {
+                    case element::Type_t::boolean: return cast_all_of_values<char, T>(pred);
+                    case element::Type_t::bf16: return cast_all_of_values<bfloat16, T>(pred);
+                    case element::Type_t::f16: return cast_all_of_values<float16, T>(pred);
+                    case element::Type_t::f32: return cast_all_of_values<float, T>(pred);
+                    case element::Type_t::f64: return cast_all_of_values<double, T>(pred);
+                    case element::Type_t::i8: return cast_all_of_values<int8_t, T>(pred);
+                    case element::Type_t::i16: return cast_all_of_values<int16_t, T>(pred);
+                    case element::Type_t::i32: return cast_all_of_values<int32_t, T>(pred);
+                    case element::Type_t::i64: return cast_all_of_values<int64_t, T>(pred);
+                    case element::Type_t::u8: return cast_all_of_values<uint8_t, T>(pred);
+                    case element::Type_t::u16: return cast_all_of_values<uint16_t, T>(pred);
+                    case element::Type_t::u32: return cast_all_of_values<uint32_t, T>(pred);
+                    case element::Type_t::u64: return cast_all_of_values<uint64_t, T>(pred);
+                    default: throw std::runtime_error("unsupported type");
+                    }
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+                }
+
                 template <typename T>
                 std::vector<T> get_vector() const
                 {
@@ -470,19 +536,34 @@ namespace ngraph
                 template <typename IN_T, typename OUT_T>
                 void cast_vector(std::vector<OUT_T>& output_vector) const
                 {
-                    auto source_vector = get_vector<IN_T>();
-                    output_vector.reserve(source_vector.size());
+                    auto source = get_data_view<IN_T>();
+                    output_vector.reserve(source.size());
 
-                    std::transform(source_vector.begin(),
-                                   source_vector.end(),
+                    std::transform(source.begin(),
+                                   source.end(),
                                    std::back_inserter(output_vector),
                                    [](IN_T c) { return static_cast<OUT_T>(c); });
                 }
 
+                template <typename IN_T, typename OUT_T, typename Pred>
+                bool cast_all_of_values(Pred& pred) const
+                {
+                    for (const IN_T& c : get_data_view<IN_T>())
+                    {
+                        if (!pred(static_cast<OUT_T>(c)))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
                 /// \brief Allocate a buffer and return a pointer to it
                 void* allocate_buffer();
 
-                void* get_data_ptr_nc() { return (m_data ? m_data->get_ptr() : nullptr); }
+                /// \brief Returns a writable pointer to the data. The data shared with the copies
+                /// of the constant is copied first, so the copies are not modified.
+                void* get_data_ptr_nc();
                 template <element::Type_t ET>
                 typename element_type_traits<ET>::value_type* get_data_ptr_nc()
                 {
@@ -58,11 +58,13 @@ namespace ngraph
                 void set_partial_shape(const PartialShape& partial_shape)
                 {
                     m_partial_shape = partial_shape;
+                    mark_for_revalidation();
                 }
                 const element::Type& get_element_type() const { return m_element_type; }
                 void set_element_type(const element::Type& element_type)
                 {
                     m_element_type = element_type;
+                    mark_for_revalidation();
                 }
 
             protected:
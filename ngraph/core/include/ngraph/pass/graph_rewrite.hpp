@@ -89,6 +89,8 @@ public:
     const std::vector<std::shared_ptr<ngraph::Node>>& get_new_nodes() { return m_new_nodes; }
     void clear_new_nodes() { m_new_nodes.clear(); }
     std::shared_ptr<pattern::Matcher> get_matcher() { return m_matcher; }
+    /// \return Number of apply calls which changed the graph
+    size_t get_applied_count() const { return m_applied_count; }
 protected:
     void register_matcher(const std::shared_ptr<pattern::Matcher>& m,
                           const ngraph::graph_rewrite_callback& callback,
@@ -98,6 +100,7 @@ private:
     handler_callback m_handler;
     std::shared_ptr<pattern::Matcher> m_matcher;
     std::vector<std::shared_ptr<ngraph::Node>> m_new_nodes;
+    size_t m_applied_count = 0;
 };
 
 /// \brief GraphRewrite is a container for MatcherPasses that allows to run them on Function in
@@ -170,6 +173,11 @@ public:
 
     void set_pass_config(const std::shared_ptr<PassConfig>& pass_config) override;
 
+    const std::vector<std::shared_ptr<ngraph::pass::MatcherPass>>& get_matchers() const
+    {
+        return m_matchers;
+    }
+
 protected:
     bool m_enable_shape_inference = false;
 
@@ -18,10 +18,12 @@ namespace ngraph
 } // namespace ngraph
 
 /**
- * @brief The transformation finds all TensorIterator layers in the network, processes all back
- * edges that describe a connection between Result and Parameter of the TensorIterator body,
- * and inserts ReadValue layer between Parameter and the next layers after this Parameter,
- * and Assign layer after the layers before the Result layer.
+ * @brief The transformation finds all TensorIterator and Loop layers in the network, processes all
+ * back edges that describe a connection between Result and Parameter of the body, and inserts
+ * ReadValue layer between Parameter and the next layers after this Parameter, and Assign layer
+ * after the layers before the Result layer.
+ * Loop is processed only if the number of its iterations is known, the back edge of its execution
+ * condition is not converted to a state.
  * Supported platforms: CPU, GNA.
  *
  *  The example below describes the changes to the inner part (body, back edges) of the Tensor
@@ -38,7 +40,8 @@ namespace ngraph
  *                                                               -> Result ] -> back_edge_1
  *
  *  It is recommended to use this transformation in conjunction with the Reshape feature to set
- *  sequence dimension to 1 and with the UnrollTensorIterator transformation.
+ *  sequence dimension to 1 or to the number of iterations processed by one inference and with the
+ *  UnrollTensorIterator transformation.
  *  For convenience, we have already enabled the unconditional execution of the UnrollTensorIterator
  *  transformation when using the LowLatency transformation for CPU, GNA plugins, no action is
  *  required here.
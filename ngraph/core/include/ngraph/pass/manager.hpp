@@ -18,7 +18,10 @@
 
 #include <list>
 #include <memory>
+#include <ostream>
+#include <string>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 #include "ngraph/pass/pass.hpp"
@@ -29,6 +32,18 @@ namespace ngraph
     namespace pass
     {
         class Manager;
+
+        /// \brief Statistics of a single pass run collected by Manager when profiling is enabled
+        struct PassProfile
+        {
+            std::string name;
+            size_t microseconds = 0;
+            size_t nodes_before = 0;
+            size_t nodes_after = 0;
+            bool function_changed = false;
+            /// \brief Number of successful applications of every matcher in the pass
+            std::vector<std::pair<std::string, size_t>> matcher_hits;
+        };
     }
 }
 
@@ -102,6 +117,15 @@ public:
     /// This object allows to disable/enable transformations execution, set callback to particular
     /// transformation. For mo details see PassConfig class.
     std::shared_ptr<PassConfig> get_pass_config() { return m_pass_config; }
+    /// \brief Enables collection of per pass statistics: time, number of nodes before and
+    /// after the pass and matcher hits. Enabled by default by NGRAPH_PROFILE_PASS_ENABLE.
+    /// The same statistics are written to the chrome trace when NGRAPH_ENABLE_TRACING is set.
+    void set_profiling(bool new_state) { m_profile_enabled = new_state; }
+    /// \return Statistics of the last run_passes call
+    const std::vector<PassProfile>& get_profile() const { return m_profile; }
+    /// \brief Writes statistics of the last run_passes call as JSON array
+    void write_profile(std::ostream& out) const;
+
 protected:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args)
@@ -117,4 +141,6 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_profile_enabled = false;
+    std::vector<PassProfile> m_profile;
 };
@@ -28,6 +28,8 @@ namespace ngraph
         ///
         /// \details The verification and inference is done via invoking each node's specific
         /// implementation of \link ngraph::Node::validate_and_infer_types() \endlink function.
+        /// Only nodes changed since their last validation and nodes below them are processed,
+        /// see \link ngraph::Function::validate_changed_nodes_and_infer_types() \endlink.
         ///
         /// By default, the \ref ngraph::pass::Manager runs this pass after executing every
         /// optimization pass. This is to ensure that any update to the graph by an optimization
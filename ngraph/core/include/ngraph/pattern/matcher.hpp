@@ -17,6 +17,7 @@
 #pragma once
 
 #include <algorithm>
+#include <deque>
 #include <functional>
 #include <memory.h>
 
@@ -191,10 +192,16 @@ namespace ngraph
             OutputVector m_matched_list;
 
         protected:
-            bool match_permutation(const OutputVector& pattern_args, const OutputVector& args);
+            bool match_permutation(const OutputVector& pattern_args,
+                                   const std::shared_ptr<Node>& graph_node);
 
             std::string m_name{"unnamed"};
             bool m_strict_mode{false};
+            // Permutations of the pattern arguments of the commutative nodes being matched, one
+            // vector per nesting level. The vectors are kept between the matches, so matching the
+            // same pattern again does not allocate them.
+            std::deque<OutputVector> m_commutative_args;
+            size_t m_commutative_depth{0};
         };
 
         class NGRAPH_API RecurrentMatcher
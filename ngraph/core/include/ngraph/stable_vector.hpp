@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief Sequence container which never moves its elements in memory.
+    ///
+    /// Elements are allocated one by one and referenced from a vector, so references to the
+    /// elements stay valid when the container grows. Unlike std::deque an empty container does
+    /// not allocate and a container with a few elements takes a few dozens of bytes, which
+    /// matters for containers held by every node of a graph.
+    template <typename T>
+    class StableVector
+    {
+        using storage_type = std::vector<std::unique_ptr<T>>;
+
+        template <typename Value, typename BaseIterator>
+        class iterator_impl
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = Value;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            iterator_impl() = default;
+            explicit iterator_impl(BaseIterator it)
+                : m_it(it)
+            {
+            }
+
+            reference operator*() const { return **m_it; }
+            pointer operator->() const { return m_it->get(); }
+            reference operator[](difference_type n) const { return *m_it[n]; }
+            iterator_impl& operator++()
+            {
+                ++m_it;
+                return *this;
+            }
+            iterator_impl operator++(int) { return iterator_impl(m_it++); }
+            iterator_impl& operator--()
+            {
+                --m_it;
+                return *this;
+            }
+            iterator_impl operator--(int) { return iterator_impl(m_it--); }
+            iterator_impl& operator+=(difference_type n)
+            {
+                m_it += n;
+                return *this;
+            }
+            iterator_impl& operator-=(difference_type n)
+            {
+                m_it -= n;
+                return *this;
+            }
+            iterator_impl operator+(difference_type n) const { return iterator_impl(m_it + n); }
+            iterator_impl operator-(difference_type n) const { return iterator_impl(m_it - n); }
+            difference_type operator-(const iterator_impl& other) const
+            {
+                return m_it - other.m_it;
+            }
+            bool operator==(const iterator_impl& other) const { return m_it == other.m_it; }
+            bool operator!=(const iterator_impl& other) const { return m_it != other.m_it; }
+            bool operator<(const iterator_impl& other) const { return m_it < other.m_it; }
+
+        private:
+            BaseIterator m_it;
+        };
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = iterator_impl<T, typename storage_type::iterator>;
+        using const_iterator = iterator_impl<const T, typename storage_type::const_iterator>;
+
+        StableVector() = default;
+        StableVector(StableVector&&) = default;
+        StableVector& operator=(StableVector&&) = default;
+
+        StableVector(const StableVector& other) { *this = other; }
+        StableVector& operator=(const StableVector& other)
+        {
+            if (this != &other)
+            {
+                storage_type elements;
+                elements.reserve(other.size());
+                for (const auto& element : other)
+                {
+                    elements.emplace_back(new T(element));
+                }
+                m_elements = std::move(elements);
+            }
+            return *this;
+        }
+
+        template <typename... Args>
+        reference emplace_back(Args&&... args)
+        {
+            m_elements.emplace_back(new T(std::forward<Args>(args)...));
+            return *m_elements.back();
+        }
+
+        void reserve(size_type n) { m_elements.reserve(n); }
+        void clear() { m_elements.clear(); }
+        size_type size() const { return m_elements.size(); }
+        bool empty() const { return m_elements.empty(); }
+
+        reference operator[](size_type i) { return *m_elements[i]; }
+        const_reference operator[](size_type i) const { return *m_elements[i]; }
+        reference at(size_type i) { return *m_elements.at(i); }
+        const_reference at(size_type i) const { return *m_elements.at(i); }
+        reference back() { return *m_elements.back(); }
+        const_reference back() const { return *m_elements.back(); }
+
+        iterator begin() { return iterator(m_elements.begin()); }
+        iterator end() { return iterator(m_elements.end()); }
+        const_iterator begin() const { return const_iterator(m_elements.begin()); }
+        const_iterator end() const { return const_iterator(m_elements.end()); }
+
+    private:
+        storage_type m_elements;
+    };
+}
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <iterator>
 
+#include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/strides.hpp"
@@ -213,8 +214,38 @@ namespace ngraph
                 return ReverseRange(source_shape, reversed_axis);
             }
 
+            /// \brief Class allows to iterate over Tensor with permuted axes part by part.
+            ///
+            /// Source tensor is walked in the order of the output tensor, so every returned range
+            /// describes one row of the output. To create ReshapeRange use _reshape_ function.
+            ///
+            class ReshapeRange : public RangeBase<ReshapeRange>
+            {
+            public:
+                using value_type = Range;
+                ReshapeRange(const Shape& source_shape, const AxisVector& axis_order);
+
+                value_type get_value() const;
+
+                bool increment();
+
+                bool is_valid() const noexcept { return !has_zeros(m_source_shape); }
+            private:
+                const Shape m_source_shape;
+                const AxisVector m_axis_order;
+                const std::vector<size_t> m_memory_strides;
+                Coordinate m_coordinate;
+                size_t m_index{0};
+            };
+
+            inline ReshapeRange reshape(const Shape& source_shape, const AxisVector& axis_order)
+            {
+                return ReshapeRange(source_shape, axis_order);
+            }
+
         } // namespace impl
         using impl::Direction;
+        using impl::reshape;
         using impl::reverse;
         using impl::slice;
     } // namespace coordinates
@@ -21,6 +21,7 @@
 #include <utility>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -31,6 +32,19 @@ namespace ngraph
         {
             namespace internal
             {
+                /// \brief Calls func(i) for every i in [0, count), large ranges are split
+                ///        between several threads.
+                template <typename Functor>
+                inline void elementwise_for(size_t count, Functor func)
+                {
+                    parallel_for(count, parallel_grain, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            func(i);
+                        }
+                    });
+                }
+
                 inline void
                     row_major_strides(const Shape& shape, size_t* strides, size_t size) noexcept
                 {
@@ -126,10 +140,9 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
+                    internal::elementwise_for(shape_size(arg0_shape), [&](size_t i) {
                         out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -205,8 +218,9 @@ namespace ngraph
 
                         if (axis == 0)
                         {
-                            for (size_t i = 0, end = strides0[0]; i < end; ++i)
+                            internal::elementwise_for(strides0[0], [&](size_t i) {
                                 out[i] = elementwise_functor(arg0[i], arg1[i]);
+                            });
                         }
                         else if (strides0[axis] == 1 &&
                                  value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
@@ -376,10 +390,9 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
+                    internal::elementwise_for(shape_size(arg0_shape), [&](size_t i) {
                         out[i] = elementwise_functor(arg0[i], arg1[i], arg2[i]);
-                    }
+                    });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // Uses same approach as autobroadcast_binop.
@@ -23,6 +23,7 @@
 #include <functional>
 #include "convolution.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -31,6 +32,54 @@ namespace ngraph
     {
         namespace reference
         {
+            namespace internal
+            {
+                /// \brief Multiplies row major matrices arg0 [m x k] and arg1 [k x n].
+                ///
+                /// Output rows are computed in parallel. Every row is accumulated by blocks of
+                /// columns with contiguous innermost loop over arg1 and the output, the reduction
+                /// axis is walked in the same order as in the generic dot.
+                template <typename INPUT0, typename INPUT1, typename OUTPUT, typename ACCUMULATION>
+                void matrix_multiply(const INPUT0* arg0,
+                                     const INPUT1* arg1,
+                                     OUTPUT* out,
+                                     size_t m,
+                                     size_t k,
+                                     size_t n)
+                {
+                    constexpr size_t column_block = 256;
+                    const size_t row_operations = std::max<size_t>(k * n, 1);
+                    parallel_for(
+                        m, parallel_grain / row_operations + 1, [&](size_t begin, size_t end) {
+                            std::vector<ACCUMULATION> sums(std::min(n, column_block));
+                            for (size_t row = begin; row < end; ++row)
+                            {
+                                const INPUT0* arg0_row = arg0 + row * k;
+                                OUTPUT* out_row = out + row * n;
+                                for (size_t first = 0; first < n; first += column_block)
+                                {
+                                    const size_t columns = std::min(n - first, column_block);
+                                    std::fill(sums.begin(), sums.begin() + columns, 0);
+                                    for (size_t i = 0; i < k; ++i)
+                                    {
+                                        const auto a = static_cast<ACCUMULATION>(arg0_row[i]);
+                                        const INPUT1* arg1_row = arg1 + i * n + first;
+                                        for (size_t j = 0; j < columns; ++j)
+                                        {
+                                            sums[j] = sums[j] +
+                                                      a * static_cast<ACCUMULATION>(arg1_row[j]);
+                                        }
+                                    }
+                                    for (size_t j = 0; j < columns; ++j)
+                                    {
+                                        out_row[first + j] = sums[j];
+                                    }
+                                }
+                            }
+                        });
+                }
+            }
+
             template <typename INPUT0,
                       typename INPUT1,
                       typename OUTPUT,
@@ -58,6 +107,22 @@ namespace ngraph
 
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
+
+                if (!is_quantized)
+                {
+                    // Both arguments are row major, so arg0 [M..., K...] and arg1 [K..., N...]
+                    // are matrices [M x K] and [K x N]
+                    const size_t k = shape_size(Shape(arg1_shape.begin(),
+                                                      arg1_shape.begin() + reduction_axes_count));
+                    const size_t m = shape_size(Shape(
+                        arg0_shape.begin(), arg0_shape.end() - reduction_axes_count));
+                    const size_t n = shape_size(
+                        Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+                    internal::matrix_multiply<INPUT0, INPUT1, OUTPUT, ACCUMULATION>(
+                        arg0, arg1, out, m, k, n);
+                    std::fesetround(old_mode);
+                    return;
+                }
                 // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
                 // they're right up front.
                 Shape dot_axis_sizes(reduction_axes_count);
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Splits range [0, count) into contiguous chunks of at least grain elements
+            ///        and calls func(begin, end) for every chunk. Chunks are processed on
+            ///        separate threads, small ranges are processed on the calling thread.
+            template <typename F>
+            void parallel_for(size_t count, size_t grain, F func)
+            {
+                const size_t max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+                const size_t chunks =
+                    std::min<size_t>(max_threads, count / std::max<size_t>(grain, 1));
+                if (chunks <= 1)
+                {
+                    func(size_t{0}, count);
+                    return;
+                }
+
+                std::vector<std::exception_ptr> errors(chunks);
+                auto run_chunk = [&](size_t chunk) {
+                    try
+                    {
+                        func(count * chunk / chunks, count * (chunk + 1) / chunks);
+                    }
+                    catch (...)
+                    {
+                        errors[chunk] = std::current_exception();
+                    }
+                };
+
+                std::vector<std::thread> threads;
+                threads.reserve(chunks - 1);
+                for (size_t chunk = 1; chunk < chunks; ++chunk)
+                {
+                    threads.emplace_back(run_chunk, chunk);
+                }
+                run_chunk(0);
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                for (const auto& error : errors)
+                {
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+
+            /// \brief Minimal amount of elementary operations worth processing on a separate
+            ///        thread.
+            constexpr size_t parallel_grain = 1 << 15;
+        }
+    }
+}
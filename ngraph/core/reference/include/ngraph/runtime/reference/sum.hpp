@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -52,6 +53,50 @@ namespace ngraph
                 return true;
             }
 
+            template <typename T>
+            void kahan_add(T& z, T& c, T x)
+            {
+                if (is_finite(x) && is_finite(z))
+                {
+                    T t = z + (x - c);
+                    c = (t - z) - (x - c);
+                    z = t;
+                }
+                else
+                {
+                    z = z + x;
+                }
+            }
+
+            /// \brief Sums the input viewed as [outer x reduced x inner] over the middle axis.
+            ///
+            /// Output elements are independent, so they are computed in parallel, and each of
+            /// them accumulates the reduced elements in the same order as the generic sum.
+            template <typename T>
+            void sum_middle_axis(const T* arg, T* out, size_t outer, size_t reduced, size_t inner)
+            {
+                const size_t row_operations = std::max<size_t>(reduced * inner, 1);
+                parallel_for(
+                    outer, parallel_grain / row_operations + 1, [&](size_t begin, size_t end) {
+                        std::vector<T> cs(inner);
+                        for (size_t o = begin; o < end; ++o)
+                        {
+                            T* out_row = out + o * inner;
+                            std::fill(out_row, out_row + inner, T(0));
+                            std::fill(cs.begin(), cs.end(), T(0));
+                            const T* arg_block = arg + o * reduced * inner;
+                            for (size_t r = 0; r < reduced; ++r)
+                            {
+                                const T* arg_row = arg_block + r * inner;
+                                for (size_t i = 0; i < inner; ++i)
+                                {
+                                    kahan_add(out_row[i], cs[i], arg_row[i]);
+                                }
+                            }
+                        }
+                    });
+            }
+
             template <typename T>
             void sum(const T* arg,
                      T* out,
@@ -59,6 +104,22 @@ namespace ngraph
                      const AxisSet& reduction_axes,
                      bool keep_dims)
             {
+                // Contiguous range of reduced axes does not need per element coordinate math
+                if (!reduction_axes.empty() &&
+                    *reduction_axes.rbegin() - *reduction_axes.begin() + 1 ==
+                        reduction_axes.size())
+                {
+                    const size_t first = *reduction_axes.begin();
+                    const size_t last = *reduction_axes.rbegin() + 1;
+                    sum_middle_axis(arg,
+                                    out,
+                                    shape_size(Shape(in_shape.begin(), in_shape.begin() + first)),
+                                    shape_size(Shape(in_shape.begin() + first,
+                                                     in_shape.begin() + last)),
+                                    shape_size(Shape(in_shape.begin() + last, in_shape.end())));
+                    return;
+                }
+
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
                 CoordinateTransform output_transform(out_shape);
                 std::vector<T> cs(shape_size(out_shape));
@@ -78,17 +139,7 @@ namespace ngraph
                     T x = arg[input_transform.index(input_coord)];
                     T& z = out[output_transform.index(output_coord)];
 
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
+                    kahan_add(z, cs[output_transform.index(output_coord)], x);
                 }
             }
         }
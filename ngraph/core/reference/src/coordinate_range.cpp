@@ -228,6 +228,75 @@ namespace ngraph
                 return false;
             }
 
+            namespace
+            {
+                AxisVector checked_axis_order(const Shape& source_shape,
+                                              const AxisVector& axis_order)
+                {
+                    AxisVector sorted_axes(axis_order);
+                    std::sort(sorted_axes.begin(), sorted_axes.end());
+                    for (size_t i = 0; i < sorted_axes.size(); ++i)
+                    {
+                        if (sorted_axes.size() != source_shape.size() || sorted_axes[i] != i)
+                        {
+                            throw std::domain_error(
+                                "Axis order is not a permutation of the source space axes");
+                        }
+                    }
+                    return axis_order;
+                }
+
+            } // namespace
+
+            ReshapeRange::ReshapeRange(const Shape& source_shape, const AxisVector& axis_order)
+                : m_source_shape{source_shape}
+                , m_axis_order(checked_axis_order(source_shape, axis_order))
+                , m_memory_strides(memory_strides(source_shape))
+                , m_coordinate(source_shape.size(), 0)
+            {
+            }
+
+            ReshapeRange::value_type ReshapeRange::get_value() const
+            {
+                if (m_source_shape.empty())
+                {
+                    // scalar is a single element row
+                    return Range{0, 1, 1, Direction::forward};
+                }
+
+                const auto last_axis = m_axis_order.back();
+                return Range{m_index,
+                             m_source_shape[last_axis],
+                             m_memory_strides[last_axis],
+                             Direction::forward};
+            }
+
+            bool ReshapeRange::increment()
+            {
+                // during increment rage omit last dim so at least two dims are required to proceed
+                if (m_coordinate.size() < 2)
+                {
+                    return false;
+                }
+                // omit last dim - it will be return in reshape_range
+                for (auto axis = m_coordinate.size() - 1; axis-- > 0;)
+                {
+                    const auto source_axis = m_axis_order[axis];
+                    ++m_coordinate[axis];
+                    m_index += m_memory_strides[source_axis];
+                    if (m_coordinate[axis] < m_source_shape[source_axis])
+                    {
+                        assert(m_index < shape_size(m_source_shape));
+                        return true;
+                    }
+                    m_coordinate[axis] = 0;
+
+                    // back on beginning of axis memory
+                    m_index -= m_source_shape[source_axis] * m_memory_strides[source_axis];
+                }
+                return false;
+            }
+
         } // namespace impl
 
     } // namespace coordinates
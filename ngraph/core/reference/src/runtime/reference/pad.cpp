@@ -16,12 +16,104 @@
 
 #include "ngraph/runtime/reference/pad.hpp"
 
+#include <cstring>
+
 namespace ngraph
 {
     namespace runtime
     {
         namespace reference
         {
+            namespace
+            {
+                /// \brief Constant padding done row by row: the output is filled with the pad
+                ///        value and then every source row overlapping the output is copied with
+                ///        a single memcpy.
+                void pad_constant(const char* data,
+                                  const char* pad_value,
+                                  char* out,
+                                  const size_t elem_size,
+                                  const Shape& data_shape,
+                                  const Shape& out_shape,
+                                  const CoordinateDiff& padding_below)
+                {
+                    const size_t out_size = shape_size(out_shape) * elem_size;
+                    if (out_size == 0)
+                    {
+                        return;
+                    }
+                    std::memcpy(out, pad_value, elem_size);
+                    for (size_t filled = elem_size; filled < out_size; filled *= 2)
+                    {
+                        std::memcpy(out + filled, out, std::min(filled, out_size - filled));
+                    }
+                    if (shape_size(data_shape) == 0)
+                    {
+                        return;
+                    }
+                    if (data_shape.empty())
+                    {
+                        std::memcpy(out, data, elem_size);
+                        return;
+                    }
+
+                    const size_t rank = data_shape.size();
+                    std::vector<size_t> data_strides(rank, 1);
+                    for (size_t i = rank - 1; i > 0; --i)
+                    {
+                        data_strides[i - 1] = data_strides[i] * data_shape[i];
+                    }
+
+                    // overlap of the output row with the source row
+                    const ptrdiff_t data_row = data_shape.back();
+                    const ptrdiff_t out_row = out_shape.back();
+                    const ptrdiff_t below = padding_below.back();
+                    const ptrdiff_t out_begin = std::max<ptrdiff_t>(below, 0);
+                    const ptrdiff_t out_end = std::min(out_row, below + data_row);
+                    if (out_begin >= out_end)
+                    {
+                        return;
+                    }
+                    const size_t row_bytes = (out_end - out_begin) * elem_size;
+                    const size_t data_begin = out_begin - below;
+
+                    Coordinate out_coord(rank, 0);
+                    const size_t rows = shape_size(out_shape) / out_row;
+                    for (size_t row = 0; row < rows; ++row)
+                    {
+                        bool inside = true;
+                        size_t data_index = data_begin;
+                        for (size_t i = 0; i + 1 < rank; ++i)
+                        {
+                            const ptrdiff_t c =
+                                static_cast<ptrdiff_t>(out_coord[i]) - padding_below[i];
+                            if (c < 0 || c >= static_cast<ptrdiff_t>(data_shape[i]))
+                            {
+                                inside = false;
+                                break;
+                            }
+                            data_index += c * data_strides[i];
+                        }
+                        if (inside)
+                        {
+                            std::memcpy(out + (row * out_row + out_begin) * elem_size,
+                                        data + data_index * elem_size,
+                                        row_bytes);
+                        }
+
+                        // next row of the output
+                        for (size_t i = rank - 1; i-- > 0;)
+                        {
+                            if (++out_coord[i] < out_shape[i])
+                            {
+                                break;
+                            }
+                            out_coord[i] = 0;
+                        }
+                    }
+                }
+            }
+
             void pad(const char* data,
                      const char* pad_value,
                      char* out,
@@ -32,6 +124,13 @@ namespace ngraph
                      const CoordinateDiff& padding_above,
                      const op::PadMode pad_mode)
             {
+                if (pad_mode == op::PadMode::CONSTANT)
+                {
+                    pad_constant(
+                        data, pad_value, out, elem_size, data_shape, out_shape, padding_below);
+                    return;
+                }
+
                 Coordinate input_start(data_shape.size(), 0); // start at (0,0,...,0)
                 Coordinate input_end = out_shape; // end at (d'0,d'1,...,d'n), the outer corner of
                                                   // the post-padding shape
@@ -14,10 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cmath>
-#include <stdio.h>
+#include <cstring>
 
 #include "ngraph/check.hpp"
+#include "ngraph/coordinate_range.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
 
 using namespace ngraph;
@@ -29,31 +29,24 @@ void runtime::reference::reshape(const char* arg,
                                  const Shape& out_shape,
                                  size_t elem_size)
 {
-    // Unfortunately we don't yet have a constructor for CoordinateTransform that lets
-    // us pass only source_space_shape
-    // and source_axis_order so we have to construct the defaults here.
-    Shape in_start_corner(in_shape.size(), 0); // (0,...0)
-    Strides in_strides(in_shape.size(), 1);    // (1,...,1)
+    NGRAPH_CHECK(shape_size(in_shape) == shape_size(out_shape));
 
-    CoordinateTransform input_transform(
-        in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
-    CoordinateTransform output_transform(out_shape);
-
-    NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                 shape_size(output_transform.get_target_shape()));
-
-    CoordinateTransform::Iterator output_it = output_transform.begin();
-
-    for (const Coordinate& input_coord : input_transform)
+    auto dst_mem = out;
+    for (auto range : coordinates::reshape(in_shape, in_axis_order))
     {
-        if (output_it == output_transform.end())
-            break;
-        const Coordinate& output_coord = *output_it;
-
-        memcpy(out + output_transform.index(output_coord) * elem_size,
-               arg + input_transform.index(input_coord) * elem_size,
-               elem_size);
-
-        ++output_it;
+        auto src_index = range.begin_index;
+        if (range.step == 1)
+        {
+            // innermost axis is not permuted, so the whole row is contiguous
+            std::memcpy(dst_mem, arg + src_index * elem_size, range.element_number * elem_size);
+            std::advance(dst_mem, range.element_number * elem_size);
+            continue;
+        }
+        for (size_t i = 0; i < range.element_number; src_index += range.step, ++i)
+        {
+            const auto src_mem = arg + src_index * elem_size;
+            std::memcpy(dst_mem, src_mem, elem_size);
+            std::advance(dst_mem, elem_size);
+        }
     }
 }
@@ -0,0 +1,254 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <map>
+
+#include "ngraph/evaluation_plan.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/util/op_types.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    constexpr size_t arena_alignment = 64;
+
+    size_t aligned_size(size_t size)
+    {
+        return (size + arena_alignment - 1) / arena_alignment * arena_alignment;
+    }
+
+    bool has_static_layout(const Output<Node>& value)
+    {
+        return value.get_partial_shape().is_static() && value.get_element_type().is_static();
+    }
+}
+
+EvaluationPlan::EvaluationPlan(const shared_ptr<const Function>& function)
+    : m_function(function)
+{
+    map<RawNodeOutput, size_t> slots;
+    vector<Output<Node>> values;
+    auto add_slot = [&](const Output<Node>& value) {
+        slots[value] = m_tensors.size();
+        m_tensors.emplace_back();
+        values.push_back(value);
+        return m_tensors.size() - 1;
+    };
+
+    for (const auto& parameter : m_function->get_parameters())
+    {
+        m_parameter_slots.push_back(add_slot(parameter->output(0)));
+    }
+    for (const auto& result : m_function->get_results())
+    {
+        m_result_slots.push_back(add_slot(result->output(0)));
+    }
+
+    // Planned values with the index of the step producing them
+    vector<pair<size_t, size_t>> planned;
+    for (const auto& node : m_function->get_ordered_ops())
+    {
+        if (op::is_parameter(node))
+        {
+            continue;
+        }
+        if (auto constant = as_type_ptr<op::v0::Constant>(node))
+        {
+            m_tensors[add_slot(constant->output(0))] =
+                make_shared<HostTensor>(constant->get_element_type(),
+                                        constant->get_shape(),
+                                        const_cast<void*>(constant->get_data_ptr()));
+            continue;
+        }
+
+        Step step{node.get(), {}, {}};
+        for (const auto& input : node->input_values())
+        {
+            step.inputs.push_back(slots.at(input));
+        }
+        if (op::is_output(node))
+        {
+            step.outputs.push_back(slots.at(node->output(0)));
+        }
+        else
+        {
+            for (const auto& output : node->outputs())
+            {
+                const auto slot = add_slot(output);
+                step.outputs.push_back(slot);
+                if (has_static_layout(output))
+                {
+                    planned.emplace_back(slot, m_steps.size());
+                }
+                else
+                {
+                    m_dynamic_values.emplace_back(slot, output);
+                }
+            }
+        }
+        m_steps.push_back(move(step));
+    }
+
+    // Liveness: a value is alive from the step producing it to its last consumer
+    vector<size_t> last_use(m_tensors.size(), 0);
+    for (size_t i = 0; i < m_steps.size(); ++i)
+    {
+        for (auto slot : m_steps[i].inputs)
+        {
+            last_use[slot] = i;
+        }
+    }
+    vector<vector<size_t>> released_after(m_steps.size());
+    vector<vector<size_t>> produced_by(m_steps.size());
+    for (const auto& value : planned)
+    {
+        released_after[max(last_use[value.first], value.second)].push_back(value.first);
+        produced_by[value.second].push_back(value.first);
+    }
+
+    // Greedy assignment of the values to arena blocks. Outputs of a step are assigned before
+    // its inputs are released, so an op never writes to the memory it reads.
+    struct Block
+    {
+        size_t size;
+        bool free;
+    };
+    vector<Block> blocks;
+    vector<size_t> block_of(m_tensors.size(), 0);
+    for (size_t i = 0; i < m_steps.size(); ++i)
+    {
+        for (auto slot : produced_by[i])
+        {
+            const auto& output = values[slot];
+            const auto size =
+                aligned_size(shape_size(output.get_shape()) * output.get_element_type().size());
+
+            // best fit among free blocks, otherwise grow the largest free one
+            size_t chosen = blocks.size();
+            for (size_t b = 0; b < blocks.size(); ++b)
+            {
+                if (!blocks[b].free)
+                {
+                    continue;
+                }
+                if (chosen == blocks.size())
+                {
+                    chosen = b;
+                    continue;
+                }
+                const bool fits = blocks[b].size >= size;
+                const bool chosen_fits = blocks[chosen].size >= size;
+                if ((fits && (!chosen_fits || blocks[b].size < blocks[chosen].size)) ||
+                    (!fits && !chosen_fits && blocks[b].size > blocks[chosen].size))
+                {
+                    chosen = b;
+                }
+            }
+            if (chosen == blocks.size())
+            {
+                blocks.push_back({size, false});
+            }
+            blocks[chosen].size = max(blocks[chosen].size, size);
+            blocks[chosen].free = false;
+            block_of[slot] = chosen;
+        }
+        for (auto slot : released_after[i])
+        {
+            blocks[block_of[slot]].free = true;
+        }
+    }
+
+    vector<size_t> block_offset(blocks.size(), 0);
+    size_t arena_size = 0;
+    for (size_t b = 0; b < blocks.size(); ++b)
+    {
+        block_offset[b] = arena_size;
+        arena_size += blocks[b].size;
+    }
+    if (arena_size == 0)
+    {
+        return;
+    }
+    m_arena = make_shared<HostTensor>(element::u8, Shape{arena_size});
+    auto arena = static_cast<char*>(m_arena->get_data_ptr());
+    for (const auto& value : planned)
+    {
+        const auto& output = values[value.first];
+        m_tensors[value.first] = make_shared<HostTensor>(output.get_element_type(),
+                                                         output.get_shape(),
+                                                         arena + block_offset[block_of[value.first]]);
+    }
+}
+
+bool EvaluationPlan::evaluate(const HostTensorVector& output_tensors,
+                              const HostTensorVector& input_tensors) const
+{
+    NGRAPH_CHECK(input_tensors.size() == m_parameter_slots.size(),
+                 "Expected ",
+                 m_parameter_slots.size(),
+                 " input tensors, got ",
+                 input_tensors.size());
+    NGRAPH_CHECK(output_tensors.size() == m_result_slots.size(),
+                 "Expected ",
+                 m_result_slots.size(),
+                 " output tensors, got ",
+                 output_tensors.size());
+
+    HostTensorVector tensors(m_tensors);
+    const auto& parameters = m_function->get_parameters();
+    for (size_t i = 0; i < input_tensors.size(); ++i)
+    {
+        NGRAPH_CHECK(input_tensors[i]->get_partial_shape().refines(
+                         parameters[i]->get_partial_shape()),
+                     "Input tensor shape ",
+                     input_tensors[i]->get_partial_shape(),
+                     " is not compatible with the parameter shape ",
+                     parameters[i]->get_partial_shape());
+        tensors[m_parameter_slots[i]] = input_tensors[i];
+    }
+    for (size_t i = 0; i < output_tensors.size(); ++i)
+    {
+        tensors[m_result_slots[i]] = output_tensors[i];
+    }
+    for (const auto& value : m_dynamic_values)
+    {
+        tensors[value.first] = make_shared<HostTensor>(value.second);
+    }
+
+    HostTensorVector inputs;
+    HostTensorVector outputs;
+    for (const auto& step : m_steps)
+    {
+        inputs.clear();
+        outputs.clear();
+        for (auto slot : step.inputs)
+        {
+            inputs.push_back(tensors[slot]);
+        }
+        for (auto slot : step.outputs)
+        {
+            outputs.push_back(tensors[slot]);
+        }
+        NGRAPH_CHECK(step.node->evaluate(outputs, inputs), "Evaluation failed on ", step.node);
+    }
+    return true;
+}
@@ -107,16 +107,45 @@ void Function::validate_nodes_and_infer_types()
     for (auto& node : get_ordered_ops())
     {
         node->revalidate_and_infer_types();
+        check_parameter_is_declared(node);
+    }
+}
 
-        // If we find a parameter make sure it is in the list of parameters of the function
-        if (op::is_parameter(node))
+void Function::validate_changed_nodes_and_infer_types()
+{
+    OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraphPass_LT,
+                       "Function::validate_changed_nodes_and_infer_types");
+
+    for (auto& node : get_ordered_ops())
+    {
+        if (node->needs_revalidation())
         {
-            auto it = std::find(m_parameters.begin(), m_parameters.end(), node);
-            if (it == m_parameters.end())
+            node->revalidate_and_infer_types();
+            // Outputs of consumers may depend on values and not only on types and shapes of
+            // the node outputs (e.g. ShapeOf -> Reshape), so the whole cone below the changed
+            // node is re-inferred
+            for (const auto& output : node->outputs())
             {
-                throw ngraph_error("Function references undeclared parameter");
+                for (const auto& input : output.get_target_inputs())
+                {
+                    input.get_node()->mark_for_revalidation();
+                }
             }
         }
+        check_parameter_is_declared(node);
+    }
+}
+
+void Function::check_parameter_is_declared(const std::shared_ptr<Node>& node) const
+{
+    // If we find a parameter make sure it is in the list of parameters of the function
+    if (op::is_parameter(node))
+    {
+        auto it = std::find(m_parameters.begin(), m_parameters.end(), node);
+        if (it == m_parameters.end())
+        {
+            throw ngraph_error("Function references undeclared parameter");
+        }
     }
 }
 
@@ -124,6 +153,26 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    if (*m_ordered_ops_valid)
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_cached_ordered_ops.size());
+        for (const auto& cached_op : m_cached_ordered_ops)
+        {
+            auto op = cached_op.lock();
+            if (!op)
+            {
+                break;
+            }
+            ordered_ops.push_back(op);
+        }
+        if (ordered_ops.size() == m_cached_ordered_ops.size())
+        {
+            return ordered_ops;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -138,7 +187,14 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    m_cached_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    for (const auto& op : ordered_ops)
+    {
+        op->add_ordered_ops_cache(m_ordered_ops_valid);
+    }
+    *m_ordered_ops_valid = true;
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -302,11 +358,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    *m_ordered_ops_valid = false;
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    *m_ordered_ops_valid = false;
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -376,12 +434,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    *m_ordered_ops_valid = false;
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    *m_ordered_ops_valid = false;
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -390,11 +450,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    *m_ordered_ops_valid = false;
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    *m_ordered_ops_valid = false;
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -404,6 +466,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    *m_ordered_ops_valid = false;
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
@@ -36,12 +36,10 @@ atomic<size_t> Node::m_next_instance_id(0);
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
     , m_control_dependencies(node.m_control_dependencies)
-    // skip m_node_type -- will be generated automatically
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_friendly_name(node.m_friendly_name)
     // skip m_unique_name -- will be generated automatically
-    , m_provenance_tags(node.m_provenance_tags)
-    , m_provenance_group(node.m_provenance_group)
+    , m_provenance(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr)
     , m_inputs(node.m_inputs) // will be modified in the body
     // skip m_outputs -- should be initialized outside
     , m_op_annotations(node.m_op_annotations)
@@ -61,8 +59,7 @@ Node& Node::operator=(const Node& node)
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
     this->m_friendly_name = node.m_friendly_name;
-    this->m_provenance_tags = node.m_provenance_tags;
-    this->m_provenance_group = node.m_provenance_group;
+    this->m_provenance.reset(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr);
     this->m_inputs = node.m_inputs;
     this->m_op_annotations = node.m_op_annotations;
     this->m_rt_info = node.m_rt_info;
@@ -72,6 +69,8 @@ Node& Node::operator=(const Node& node)
         input = descriptor::Input(this, input.get_index(), input.get_output());
         input.get_output().add_input(&input);
     }
+    invalidate_ordered_ops_caches();
+    m_needs_revalidation = true;
     return *this;
 }
 
@@ -197,6 +196,8 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->m_outputs.at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    invalidate_ordered_ops_caches();
+    m_needs_revalidation = true;
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -230,6 +231,7 @@ void Node::set_argument(size_t position, const Output<Node>& argument)
 void Node::constructor_validate_and_infer_types()
 {
     validate_and_infer_types();
+    m_needs_revalidation = false;
 }
 
 void Node::set_output_size(size_t n)
@@ -266,7 +268,18 @@ void Node::set_input_is_relevant_to_value(size_t i, bool relevant)
 
 void Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape)
 {
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    auto& output = get_output_descriptor(i);
+    auto& tensor = output.get_tensor();
+    if (tensor.get_element_type() != element_type ||
+        !tensor.get_partial_shape().same_scheme(pshape))
+    {
+        // consumers have to re-infer their outputs
+        for (auto input : output.get_inputs())
+        {
+            input->get_raw_pointer_node()->m_needs_revalidation = true;
+        }
+    }
+    tensor.set_tensor_type(element_type, pshape);
 }
 
 std::string Node::description() const
@@ -297,14 +310,26 @@ void Node::set_friendly_name(const string& name)
     m_friendly_name = name;
 }
 
+Node::Provenance& Node::get_provenance()
+{
+    if (!m_provenance)
+    {
+        m_provenance.reset(new Provenance());
+    }
+    return *m_provenance;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_provenance().group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_provenance)
+    {
+        m_provenance->group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -323,7 +348,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty;
+    return m_provenance ? m_provenance->group : empty;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -355,7 +381,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (m_provenance->group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -393,13 +419,15 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const std::unordered_set<std::string> empty;
+    return m_provenance ? m_provenance->tags : empty;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    auto& provenance = get_provenance();
+    provenance.tags.insert(tag);
+    for (auto node : provenance.group)
     {
         node->add_provenance_tag(tag);
     }
@@ -407,7 +435,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance)
+    {
+        m_provenance->tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -481,6 +512,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         {
             node->m_control_dependents.push_back(this);
         }
+        invalidate_ordered_ops_caches();
     }
 }
 
@@ -513,6 +545,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            invalidate_ordered_ops_caches();
         }
     }
     {
@@ -535,6 +568,37 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    invalidate_ordered_ops_caches();
+}
+
+void Node::invalidate_ordered_ops_caches()
+{
+    for (const auto& cache : m_ordered_ops_caches)
+    {
+        if (auto valid = cache.lock())
+        {
+            *valid = false;
+        }
+    }
+}
+
+void Node::add_ordered_ops_cache(const std::shared_ptr<std::atomic_bool>& valid)
+{
+    bool registered = false;
+    // drop the flags of the functions which are already destroyed
+    m_ordered_ops_caches.erase(
+        remove_if(m_ordered_ops_caches.begin(),
+                  m_ordered_ops_caches.end(),
+                  [&](const std::weak_ptr<std::atomic_bool>& cache) {
+                      auto cache_valid = cache.lock();
+                      registered |= cache_valid == valid;
+                      return !cache_valid;
+                  }),
+        m_ordered_ops_caches.end());
+    if (!registered)
+    {
+        m_ordered_ops_caches.push_back(valid);
+    }
 }
 
 void Node::clear_control_dependents()
@@ -812,7 +876,7 @@ bool Node::match_node(pattern::Matcher* matcher, const Output<Node>& graph_value
     // Not exact matching allows using base classes in the patterns and successfully matching such
     // patterns
     // with sub-graph of descent nodes types.
-    if (graph_value.get_node_shared_ptr()->get_type_info().is_castable(get_type_info()) &&
+    if (graph_value.get_node()->get_type_info().is_castable(get_type_info()) &&
         matcher->match_arguments(this, graph_value.get_node_shared_ptr()))
     {
         auto& pattern_map = matcher->get_pattern_value_map();
@@ -965,7 +1029,13 @@ bool Node::constant_fold(OutputVector& output_values, const OutputVector& input_
     {
         if (auto constant = as_type_ptr<op::v0::Constant>(input.get_node_shared_ptr()))
         {
-            auto host_tensor = make_shared<runtime::HostTensor>(constant);
+            // Refer to the constant data instead of copying it, inputs are not modified by
+            // evaluate
+            auto host_tensor = make_shared<runtime::HostTensor>(
+                constant->get_element_type(),
+                constant->get_shape(),
+                const_cast<void*>(constant->get_data_ptr()),
+                constant->output(0).get_tensor().get_name());
             input_tensors.push_back(host_tensor);
         }
         else
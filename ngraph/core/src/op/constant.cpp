@@ -308,6 +308,18 @@ void* op::Constant::allocate_buffer()
     return get_data_ptr_nc();
 }
 
+void* op::Constant::get_data_ptr_nc()
+{
+    if (m_data && m_data.use_count() > 1)
+    {
+        // Copies made by clone_with_new_inputs share the buffer, copy it on the first write
+        auto data = make_shared<runtime::AlignedBuffer>(m_data->size(), host_alignment());
+        std::memcpy(data->get_ptr(), m_data->get_ptr(), m_data->size());
+        m_data = data;
+    }
+    return (m_data ? m_data->get_ptr() : nullptr);
+}
+
 op::Constant::Constant(const element::Type& type, const Shape& shape, const void* data)
     : Constant(type, shape)
 {
@@ -14,8 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
 #include "constant_folding.hpp"
 #include <ngraph/rt_info.hpp>
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 
 using namespace std;
@@ -23,53 +32,293 @@ using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    // Minimal number of input elements of operations folded in one wave to fold them in parallel
+    const size_t parallel_threshold = 1 << 16;
+
+    // Splits nodes into groups by the length of the longest path from a graph input. Nodes of a
+    // group don't depend on each other, and producers of a node are in preceding groups.
+    std::vector<NodeVector> split_into_waves(const NodeVector& ordered_ops)
+    {
+        std::vector<NodeVector> waves;
+        std::unordered_map<const Node*, size_t> depths;
+        for (const auto& node : ordered_ops)
+        {
+            size_t depth = 0;
+            for (const auto& input : node->input_values())
+            {
+                depth = std::max(depth, depths[input.get_node()] + 1);
+            }
+            depths[node.get()] = depth;
+            if (waves.size() <= depth)
+            {
+                waves.resize(depth + 1);
+            }
+            waves[depth].push_back(node);
+        }
+        return waves;
+    }
+
+    bool has_constant_inputs(const std::shared_ptr<Node>& node, size_t& input_elements)
+    {
+        for (const auto& input : node->input_values())
+        {
+            auto constant = as_type<op::v0::Constant>(input.get_node());
+            if (!constant)
+            {
+                return false;
+            }
+            input_elements += shape_size(constant->get_shape());
+        }
+        return node->get_input_size() > 0;
+    }
+
+    // Collects attributes of a node into a string. Fails for attributes which have no generic
+    // representation.
+    class FoldingKeyVisitor : public AttributeVisitor
+    {
+    public:
+        FoldingKeyVisitor() { m_key.precision(std::numeric_limits<double>::max_digits10); }
+
+        std::ostringstream m_key;
+        bool m_valid = true;
+
+        void on_adapter(const std::string& name, ValueAccessor<void>& adapter) override
+        {
+            m_valid = false;
+        }
+        void on_adapter(const std::string& name, ValueAccessor<void*>& adapter) override
+        {
+            m_valid = false;
+        }
+        void on_adapter(const std::string& name, ValueAccessor<std::string>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+        void on_adapter(const std::string& name, ValueAccessor<bool>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+        void on_adapter(const std::string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+        void on_adapter(const std::string& name, ValueAccessor<double>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<int32_t>>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<int64_t>>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<uint64_t>>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<float>>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<std::string>>& adapter) override
+        {
+            write(name, adapter.get());
+        }
+
+    private:
+        template <typename T>
+        void write(const std::string& name, const T& value)
+        {
+            m_key << get_name_with_context() << '.' << name << '=' << value << ';';
+        }
+        template <typename T>
+        void write(const std::string& name, const std::vector<T>& values)
+        {
+            m_key << get_name_with_context() << '.' << name << "=[";
+            for (const auto& value : values)
+            {
+                m_key << value << ',';
+            }
+            m_key << "];";
+        }
+    };
+
+    // Builds a key which is equal for operations of the same type with the same attributes and
+    // inputs
+    bool get_folding_key(const std::shared_ptr<Node>& node, std::string& key)
+    {
+        FoldingKeyVisitor visitor;
+        const auto& type_info = node->get_type_info();
+        visitor.m_key << type_info.name << '.' << type_info.version << ';';
+        if (!node->visit_attributes(visitor) || !visitor.m_valid)
+        {
+            return false;
+        }
+        for (const auto& input : node->input_values())
+        {
+            visitor.m_key << input.get_node() << ':' << input.get_index() << ';';
+        }
+        key = visitor.m_key.str();
+        return true;
+    }
+
+    // Calls func for indices [0, count) on the current thread and additional threads
+    template <typename F>
+    void parallel_for(size_t count, F func)
+    {
+        const size_t threads_count = std::min<size_t>(count, std::thread::hardware_concurrency());
+        std::atomic<size_t> next{0};
+        std::vector<std::exception_ptr> errors(std::max<size_t>(threads_count, 1));
+        auto worker = [&](size_t worker_index) {
+            try
+            {
+                for (size_t i = next++; i < count; i = next++)
+                {
+                    func(i);
+                }
+            }
+            catch (...)
+            {
+                errors[worker_index] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t worker_index = 1; worker_index < threads_count; ++worker_index)
+        {
+            threads.emplace_back(worker, worker_index);
+        }
+        worker(0);
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        for (const auto& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = false;
 
-    for (const auto& node : f->get_ordered_ops())
+    for (const auto& wave : split_into_waves(f->get_ordered_ops()))
     {
-        node->revalidate_and_infer_types();
-
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values()))
+        for (const auto& node : wave)
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
+            node->revalidate_and_infer_types();
+        }
 
-            for (size_t i = 0; i < replacements.size(); ++i)
+        // Identical operations over the same constants are folded once
+        std::vector<size_t> origin(wave.size());
+        std::unordered_map<std::string, size_t> folding_keys;
+        // Evaluation of operations over constants is the expensive part of folding, it's done in
+        // parallel when there is enough work; other operations are folded on the current thread
+        std::vector<size_t> heavy;
+        std::vector<size_t> light;
+        size_t heavy_elements = 0;
+        for (size_t i = 0; i < wave.size(); ++i)
+        {
+            origin[i] = i;
+            const auto& node = wave[i];
+            size_t input_elements = 0;
+            if (!is_type<op::v0::Constant>(node) && has_constant_inputs(node, input_elements))
             {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                std::string key;
+                if (get_folding_key(node, key))
                 {
-                    if (replacements.size() == 1)
+                    auto it = folding_keys.find(key);
+                    if (it != folding_keys.end())
                     {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
+                        origin[i] = it->second;
+                        continue;
                     }
-                    else
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
+                    folding_keys.emplace(std::move(key), i);
                 }
+                heavy.push_back(i);
+                heavy_elements += input_elements;
             }
+            else
+            {
+                light.push_back(i);
+            }
+        }
+
+        std::vector<OutputVector> replacements(wave.size());
+        std::vector<char> folded(wave.size(), false);
+        auto fold = [&](size_t i) {
+            const auto& node = wave[i];
+            replacements[i].resize(node->get_output_size());
+            folded[i] = node->constant_fold(replacements[i], node->input_values());
+        };
+        if (heavy.size() > 1 && heavy_elements >= parallel_threshold)
+        {
+            parallel_for(heavy.size(), [&](size_t i) { fold(heavy[i]); });
         }
         else
         {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            std::for_each(heavy.begin(), heavy.end(), fold);
+        }
+        std::for_each(light.begin(), light.end(), fold);
+
+        for (size_t node_index = 0; node_index < wave.size(); ++node_index)
+        {
+            const auto& node = wave[node_index];
+            if (folded[origin[node_index]])
+            {
+                const auto& node_replacements = replacements[origin[node_index]];
+                NGRAPH_CHECK(node_replacements.size() == node->get_output_size(),
+                             "constant_fold_default returned incorrect number of replacements for ",
+                             node);
+
+                for (size_t i = 0; i < node_replacements.size(); ++i)
+                {
+                    auto node_output = node->output(i);
+                    auto replacement = node_replacements.at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                    {
+                        if (node_replacements.size() == 1)
+                        {
+                            replacement.get_node_shared_ptr()->set_friendly_name(
+                                node->get_friendly_name());
+                        }
+                        else
+                        {
+                            replacement.get_node_shared_ptr()->set_friendly_name(
+                                node->get_friendly_name() + "." + std::to_string(i));
+                        }
+                        node_output.replace(replacement);
+                        // Propagate runtime info attributes to replacement consumer nodes
+                        copy_runtime_info_to_target_inputs(node, replacement);
+
+                        rewritten = true;
+                    }
+                }
+            }
+            else
             {
-                if (const auto& sub_graph = sub_graph_node->get_function())
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator,
+                // Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
                 {
-                    rewritten |= run_on_function(sub_graph);
+                    if (const auto& sub_graph = sub_graph_node->get_function())
+                    {
+                        rewritten |= run_on_function(sub_graph);
+                    }
                 }
             }
         }
@@ -37,7 +37,7 @@ void pass::ConvertFP32ToFP16::convert_constants_precision()
 
         if (constant->get_element_type() == element::f32)
         {
-            auto data = constant->get_vector<float>();
+            auto data = constant->get_data_view<float>();
             std::vector<ngraph::float16> new_data(data.size());
             for (size_t i = 0; i < data.size(); ++i)
             {
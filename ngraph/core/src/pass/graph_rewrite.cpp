@@ -81,20 +81,27 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         nodes_to_run.emplace_back(node);
     }
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers which root node has a known type (operation from opset or pattern::op::WrapType)
+    // are indexed by this type, so for each node only matchers with suitable root type are
+    // checked. Matchers with arbitrary root (e.g. pattern::op::Label) can't be indexed and are
+    // checked against each node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> wildcard_matchers;
+    // ITT task per matcher to see time spent in each matcher pass
+    std::vector<openvino::itt::handle_t> matcher_tasks(m_matchers.size());
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index)
     {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
+        matcher_tasks[matcher_index] = openvino::itt::handle(m_matchers[matcher_index]->get_name());
+
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher)
         {
-            all_roots_has_type = false;
-            break;
+            wildcard_matchers.push_back(matcher_index);
+            continue;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -106,9 +113,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         }
 
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
+        // it's type and use it in unordered_map as key for fast MatcherPass search. Otherwise type
+        // is unknown and matcher is checked for every node.
         NodeTypeInfo root_type_info = root->get_type_info();
         if (auto p = dynamic_pointer_cast<pattern::op::Pattern>(root))
         {
@@ -118,21 +124,44 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             }
             else
             {
-                all_roots_has_type = false;
-                break;
+                wildcard_matchers.push_back(matcher_index);
+                continue;
             }
         }
         type_to_matcher[root_type_info].push_back(matcher_index);
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // Complete list of matchers for a node type: matchers registered for the type itself, for
+    // its parents and wildcard matchers in order of the registration. Lists are built on first
+    // occurrence of the type.
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> node_type_to_matchers;
+    auto get_matchers = [&](const DiscreteTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto it = node_type_to_matchers.find(&type_info);
+        if (it != node_type_to_matchers.end())
+        {
+            return it->second;
+        }
+
+        std::vector<size_t> matchers = wildcard_matchers;
+        for (auto node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent)
+        {
+            auto typed_matchers = type_to_matcher.find(*node_type_info);
+            if (typed_matchers != type_to_matcher.end())
+            {
+                matchers.insert(
+                    matchers.end(), typed_matchers->second.begin(), typed_matchers->second.end());
+            }
+        }
+        std::sort(matchers.begin(), matchers.end());
+        return node_type_to_matchers.emplace(&type_info, std::move(matchers)).first->second;
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass,
-                                std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic())
@@ -146,7 +175,11 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status = false;
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::nGraph, matcher_tasks[matcher_index]);
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -164,9 +197,6 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty())
     {
         auto node = nodes_to_run.front();
@@ -180,59 +210,24 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             }
         }
         // Temporary keep this GraphRewrite property for backward compatibility
-        if (m_enable_shape_inference)
+        if (m_enable_shape_inference && node->needs_revalidation())
         {
             node->revalidate_and_infer_types();
-        }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type)
-        {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info)
+            for (const auto& output : node->outputs())
             {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end())
+                for (const auto& input : output.get_target_inputs())
                 {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run)
-            {
-                if (run_matcher_pass(m_matchers[matcher_index], node))
-                {
-                    rewritten = true;
-                    break;
+                    input.get_node()->mark_for_revalidation();
                 }
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else
+
+        for (size_t matcher_index : get_matchers(node->get_type_info()))
         {
-            for (auto& m_pass : m_matchers)
+            if (run_matcher_pass(matcher_index, node))
             {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node))
-                {
-                    rewritten = true;
-                    break;
-                }
+                rewritten = true;
+                break;
             }
         }
     }
@@ -401,5 +396,10 @@ bool ngraph::pass::MatcherPass::apply(std::shared_ptr<ngraph::Node> node)
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "ngraph::pass::MatcherPass::apply");
     m_new_nodes.clear();
-    return m_handler(node);
+    const bool status = m_handler(node);
+    if (status)
+    {
+        ++m_applied_count;
+    }
+    return status;
 }
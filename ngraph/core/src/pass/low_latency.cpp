@@ -7,21 +7,35 @@
 #include <memory>
 
 #include <ngraph/opsets/opset5.hpp>
-#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/label.hpp>
 #include <ngraph/variant.hpp>
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::LowLatency, "LowLatency", 0);
 
 ngraph::pass::LowLatency::LowLatency()
 {
-    auto tensor_iterator = ngraph::pattern::wrap_type<opset5::TensorIterator>();
+    auto sub_graph_op = ngraph::pattern::any_input([](const Output<Node>& output) {
+        const auto node = output.get_node();
+        return is_type<opset5::TensorIterator>(node) || is_type<opset5::Loop>(node);
+    });
     ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
-        auto ti = std::dynamic_pointer_cast<ngraph::opset5::TensorIterator>(m.get_match_root());
+        auto ti = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(m.get_match_root());
         if (!ti)
         {
             return false;
         }
 
+        int64_t condition_output_idx = -1;
+        if (const auto& loop = std::dynamic_pointer_cast<ngraph::opset5::Loop>(ti))
+        {
+            // Only a Loop with the number of iterations known in advance can be unrolled
+            if (loop->get_num_iterations() <= 0)
+            {
+                return false;
+            }
+            condition_output_idx = loop->get_special_body_ports().body_condition_output_idx;
+        }
+
         // Mark the TI layer to be unrolled. Enable unconditional ti unrolling for all plugins.
         auto& rt_info = ti->get_rt_info();
         rt_info["UNROLL_TI"] = std::make_shared<ngraph::VariantWrapper<int64_t>>(1);
@@ -32,8 +46,11 @@ ngraph::pass::LowLatency::LowLatency()
         for (const auto& in : ti->get_input_descriptions())
         {
             // Process all back edges
-            if (const auto& merged_in = std::dynamic_pointer_cast<
-                    ngraph::opset5::TensorIterator::MergedInputDescription>(in))
+            const auto& merged_in = std::dynamic_pointer_cast<
+                ngraph::op::util::SubGraphOp::MergedInputDescription>(in);
+            // The back edge of the Loop execution condition is not a state
+            if (merged_in &&
+                static_cast<int64_t>(merged_in->m_body_value_index) != condition_output_idx)
             {
                 // Insert ReadValue nodes: Parameter -> (new ReadValue) -> consumers
                 const auto& inputs_to = func->get_parameters()
@@ -66,6 +83,6 @@ ngraph::pass::LowLatency::LowLatency()
         return false;
     };
 
-    auto m = std::make_shared<ngraph::pattern::Matcher>(tensor_iterator, "LowLatency");
+    auto m = std::make_shared<ngraph::pattern::Matcher>(sub_graph_op, "LowLatency");
     register_matcher(m, callback);
 }
@@ -22,6 +22,7 @@
 #include <unordered_map>
 
 #include "itt.hpp"
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -73,6 +74,50 @@ namespace ngraph
                 static PerfCounters counters;
                 return counters;
             }
+
+            std::vector<std::shared_ptr<MatcherPass>>
+                matchers_of(const std::shared_ptr<PassBase>& pass)
+            {
+                if (auto matcher_pass = std::dynamic_pointer_cast<MatcherPass>(pass))
+                {
+                    return {matcher_pass};
+                }
+                if (auto graph_rewrite = std::dynamic_pointer_cast<GraphRewrite>(pass))
+                {
+                    return graph_rewrite->get_matchers();
+                }
+                return {};
+            }
+
+            std::string json_string(const std::string& value)
+            {
+                std::string result = "\"";
+                for (auto c : value)
+                {
+                    if (c == '"' || c == '\\')
+                    {
+                        result += '\\';
+                    }
+                    result += c;
+                }
+                return result + "\"";
+            }
+
+            std::string to_json(const PassProfile& profile)
+            {
+                std::string hits;
+                for (const auto& hit : profile.matcher_hits)
+                {
+                    hits += (hits.empty() ? "" : ",") + json_string(hit.first) + ":" +
+                            std::to_string(hit.second);
+                }
+                return R"({"name":)" + json_string(profile.name) + R"(,"microseconds":)" +
+                       std::to_string(profile.microseconds) + R"(,"nodes_before":)" +
+                       std::to_string(profile.nodes_before) + R"(,"nodes_after":)" +
+                       std::to_string(profile.nodes_after) + R"(,"function_changed":)" +
+                       (profile.function_changed ? "true" : "false") + R"(,"matcher_hits":{)" +
+                       hits + "}}";
+            }
         }
     }
 }
@@ -80,6 +125,7 @@ namespace ngraph
 pass::Manager::Manager()
     : m_visualize(getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING"))
     , m_pass_config(std::make_shared<PassConfig>())
+    , m_profile_enabled(getenv_bool("NGRAPH_PROFILE_PASS_ENABLE"))
 {
 }
 
@@ -89,6 +135,7 @@ pass::Manager::~Manager()
 
 pass::Manager::Manager(std::shared_ptr<ngraph::pass::PassConfig> pass_config)
     : m_pass_config(std::move(pass_config))
+    , m_profile_enabled(getenv_bool("NGRAPH_PROFILE_PASS_ENABLE"))
 {
 }
 
@@ -96,7 +143,8 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::Manager::run_passes");
 
-    static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    const bool collect_profile = m_profile_enabled || event::Manager::is_tracing_enabled();
+    m_profile.clear();
 
     size_t index = 0;
     stopwatch pass_timer;
@@ -116,6 +164,21 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
 
         pass_timer.start();
 
+        PassProfile profile;
+        std::vector<std::shared_ptr<MatcherPass>> matchers;
+        std::vector<size_t> applied_before;
+        event::Duration trace_event(pass->get_name(), "Pass");
+        if (collect_profile)
+        {
+            profile.name = pass->get_name();
+            profile.nodes_before = func->get_ops().size();
+            matchers = matchers_of(pass);
+            for (const auto& matcher : matchers)
+            {
+                applied_before.push_back(matcher->get_applied_count());
+            }
+        }
+
         NGRAPH_SUPPRESS_DEPRECATED_START
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass))
         {
@@ -191,13 +254,42 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
         }
         index++;
         pass_timer.stop();
-        if (profile_enabled)
+        trace_event.stop();
+        if (collect_profile)
+        {
+            profile.microseconds = pass_timer.get_microseconds();
+            profile.nodes_after = func->get_ops().size();
+            profile.function_changed = function_changed;
+            for (size_t i = 0; i < matchers.size(); ++i)
+            {
+                const auto hits = matchers[i]->get_applied_count() - applied_before[i];
+                if (hits > 0)
+                {
+                    profile.matcher_hits.emplace_back(matchers[i]->get_name(), hits);
+                }
+            }
+            trace_event.set_args(to_json(profile));
+            m_profile.push_back(std::move(profile));
+        }
+        if (m_profile_enabled)
         {
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << " ("
+                 << m_profile.back().nodes_before << " -> " << m_profile.back().nodes_after
+                 << " nodes)\n";
         }
     }
-    if (profile_enabled)
+    if (m_profile_enabled)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
 }
+
+void pass::Manager::write_profile(std::ostream& out) const
+{
+    out << "[";
+    for (size_t i = 0; i < m_profile.size(); ++i)
+    {
+        out << (i == 0 ? "\n" : ",\n") << pass::to_json(m_profile[i]);
+    }
+    out << "\n]\n";
+}
@@ -140,8 +140,8 @@ namespace ngraph
         bool Matcher::match_value(const ngraph::Output<Node>& pattern_value,
                                   const ngraph::Output<Node>& graph_value)
         {
-            std::shared_ptr<Node> pattern_node = pattern_value.get_node_shared_ptr();
-            std::shared_ptr<Node> graph_node = graph_value.get_node_shared_ptr();
+            Node* pattern_node = pattern_value.get_node();
+            Node* graph_node = graph_value.get_node();
 
             // This env var allows one to specify node name patterns to abort pattern matching
             // at particular nodes. The upshot is that one can quickly zero in on an offending
@@ -160,11 +160,12 @@ namespace ngraph
             return pattern_node->match_value(this, pattern_value, graph_value);
         }
 
-        bool Matcher::match_permutation(const OutputVector& pattern_args, const OutputVector& args)
+        bool Matcher::match_permutation(const OutputVector& pattern_args,
+                                        const std::shared_ptr<Node>& graph_node)
         {
-            for (size_t i = 0; i < args.size(); i++)
+            for (size_t i = 0; i < pattern_args.size(); i++)
             {
-                if (!match_value(pattern_args.at(i), args.at(i)))
+                if (!match_value(pattern_args[i], graph_node->input_value(i)))
                 {
                     return false;
                 }
@@ -177,10 +178,9 @@ namespace ngraph
             NGRAPH_DEBUG << "[MATCHER] Match arguments at " << *graph_node << " for pattern "
                          << *pattern_node;
 
-            auto args = graph_node->input_values();
-            auto pattern_args = pattern_node->input_values();
-
-            if (args.size() != pattern_args.size())
+            // Most of the attempts fail here, so nothing is copied before the inputs are counted
+            const size_t num_args = graph_node->get_input_size();
+            if (num_args != pattern_node->get_input_size())
             {
                 NGRAPH_DEBUG << "[MATCHER] Aborting at " << *graph_node << " for pattern "
                              << *pattern_node;
@@ -189,6 +189,18 @@ namespace ngraph
 
             if (ngraph::op::is_commutative(graph_node))
             {
+                if (m_commutative_depth == m_commutative_args.size())
+                {
+                    m_commutative_args.emplace_back();
+                }
+                // deque keeps the references valid when the nested levels are added
+                OutputVector& pattern_args = m_commutative_args[m_commutative_depth++];
+                pattern_args.clear();
+                for (size_t i = 0; i < num_args; i++)
+                {
+                    pattern_args.push_back(pattern_node->input_value(i));
+                }
+
                 // TODO: [nikolayk] we don't really have to use lexicographically-based perms,
                 // heap's algo should be faster
                 std::sort(begin(pattern_args),
@@ -198,8 +210,9 @@ namespace ngraph
                 do
                 {
                     auto saved = start_match();
-                    if (match_permutation(pattern_args, args))
+                    if (match_permutation(pattern_args, graph_node))
                     {
+                        m_commutative_depth--;
                         return saved.finish(true);
                     }
                 } while (std::next_permutation(
@@ -207,10 +220,18 @@ namespace ngraph
                     end(pattern_args),
                     [](const ngraph::Output<ngraph::Node>& n1,
                        const ngraph::Output<ngraph::Node>& n2) { return n1 < n2; }));
+                m_commutative_depth--;
             }
             else
             {
-                return match_permutation(pattern_args, args);
+                for (size_t i = 0; i < num_args; i++)
+                {
+                    if (!match_value(pattern_node->input_value(i), graph_node->input_value(i)))
+                    {
+                        return false;
+                    }
+                }
+                return true;
             }
 
             NGRAPH_DEBUG << "[MATCHER] Aborting at " << *graph_node << " for pattern "
@@ -251,6 +272,8 @@ namespace ngraph
             m_pattern_map.clear();
             m_pattern_value_maps.clear();
             m_matched_list.clear();
+            // a predicate may have thrown in the middle of the previous match
+            m_commutative_depth = 0;
         }
 
         namespace
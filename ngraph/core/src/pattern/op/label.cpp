@@ -46,6 +46,25 @@ bool pattern::op::Label::match_value(Matcher* matcher,
     if (m_predicate(graph_value))
     {
         auto& pattern_map = matcher->get_pattern_value_map();
+        // A label without a wrapped pattern (any_input) matches anything, so its match cannot be
+        // reverted and the matcher state is not saved
+        if (is_type<pattern::op::True>(input_value(0).get_node()))
+        {
+            auto it = pattern_map.find(shared_from_this());
+            if (it != pattern_map.end())
+            {
+                if (it->second != graph_value)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                pattern_map[shared_from_this()] = graph_value;
+            }
+            matcher->add_node(graph_value);
+            return true;
+        }
         auto saved = matcher->start_match();
         matcher->add_node(graph_value);
         if (pattern_map.count(shared_from_this()))
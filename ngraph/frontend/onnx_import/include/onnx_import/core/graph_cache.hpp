@@ -19,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "ngraph/node.hpp"
 namespace ngraph
@@ -54,7 +55,7 @@ namespace ngraph
             virtual bool contains(const std::string& name) const;
 
         private:
-            std::map<std::string, Output<ngraph::Node>> m_graph_cache_map;
+            std::unordered_map<std::string, Output<ngraph::Node>> m_graph_cache_map;
         };
 
         class SubgraphCache : public GraphCache
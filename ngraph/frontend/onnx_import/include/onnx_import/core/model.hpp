@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -42,6 +43,14 @@ namespace ngraph
             Model() = delete;
             explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
 
+            /// \brief      Constructs a model which shares ownership of the model proto.
+            ///
+            /// \note       Constants of the initializers refer to raw data of the model proto
+            ///             instead of copying it, so the proto lives as long as they do.
+            ///
+            /// \param[in]  model_proto  The ONNX model protobuf representation.
+            explicit Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto);
+
             Model(const Model&) = default;
             Model(Model&&) = default;
 
@@ -57,6 +66,12 @@ namespace ngraph
                 return m_model_proto->producer_version();
             }
 
+            /// \brief      Returns the owner of the model proto, nullptr if it is not shared.
+            const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& get_model_proto_owner() const
+            {
+                return m_model_proto_owner;
+            }
+
             /// \brief Access an operator object by its type name and domain name
             /// The function will return the operator object if it exists, or report an error
             /// in case of domain or operator absence.
@@ -84,6 +99,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto_owner;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
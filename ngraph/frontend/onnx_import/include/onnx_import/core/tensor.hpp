@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -483,8 +484,16 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+
+            /// \brief      Constructs a tensor over the tensor proto.
+            ///
+            /// \param[in]  tensor      The ONNX tensor protobuf representation.
+            /// \param[in]  data_owner  The owner of the tensor proto. If it is set, constants
+            ///                         refer to raw data of the tensor proto instead of copying it.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<const void> data_owner = nullptr)
                 : m_tensor_proto{&tensor}
+                , m_data_owner{std::move(data_owner)}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
             {
                 if (m_shape == Shape{0})
@@ -606,8 +615,11 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                auto constant = make_shared_ng_constant(type);
+                if (!constant)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -615,7 +627,37 @@ namespace ngraph
                 return constant;
             }
 
+            /// \brief  Creates a constant which refers to the mapped external data or to the raw
+            ///         data of the tensor proto, nullptr if the data has to be copied
+            std::shared_ptr<ngraph::op::Constant>
+                make_shared_ng_constant(const element::Type& type) const
+            {
+                if (m_tensor_proto->has_segment())
+                {
+                    return nullptr;
+                }
+                const size_t byte_size = shape_size(m_shape) * type.size();
+                std::shared_ptr<detail::TensorExternalData::SharedData> data;
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    data = detail::TensorExternalData(*m_tensor_proto).map_external_data();
+                }
+                else if (m_data_owner && m_tensor_proto->has_raw_data())
+                {
+                    auto raw_data = const_cast<char*>(m_tensor_proto->raw_data().data());
+                    data = std::make_shared<detail::TensorExternalData::SharedData>(
+                        raw_data, m_tensor_proto->raw_data().size(), m_data_owner);
+                }
+                // Mismatched sizes are handled by the copying path
+                if (!data || byte_size == 0 || data->size() != byte_size)
+                {
+                    return nullptr;
+                }
+                return std::make_shared<ngraph::op::Constant>(type, m_shape, data);
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<const void> m_data_owner;
             Shape m_shape;
         };
 
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
@@ -28,6 +31,9 @@ namespace ngraph
             class TensorExternalData
             {
             public:
+                /// \brief  Buffer which keeps its owner alive while it refers to the owner's data
+                using SharedData = runtime::SharedBuffer<std::shared_ptr<const void>>;
+
                 TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
                 /// \brief      Load external data from tensor passed to constructor
@@ -39,6 +45,16 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Map external data from tensor passed to constructor into memory
+                ///
+                /// \note       Every external file is mapped entirely once and shared by all
+                ///             tensors which refer to it. The mapping is private, so writes to
+                ///             the data do not reach the file.
+                ///
+                /// \return     Buffer referring to the mapped data or nullptr if the file
+                ///             cannot be mapped or does not contain the data
+                std::shared_ptr<SharedData> map_external_data() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
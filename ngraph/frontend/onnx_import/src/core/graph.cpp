@@ -14,14 +14,21 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
 #include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
 #include <numeric>
 #include <sstream>
+#include <vector>
 
+#include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/provenance.hpp"
+#include "ngraph/util.hpp"
 #include "onnx_import/core/graph.hpp"
 #include "onnx_import/core/node.hpp"
 #include "onnx_import/exceptions.hpp"
@@ -61,6 +68,28 @@ namespace ngraph
                 std::string domain = get_node_domain(node_proto);
                 return (domain.empty() ? "" : domain + ".") + node_proto.op_type();
             }
+
+            static void print_profile(
+                const std::string& graph_name,
+                std::size_t milliseconds,
+                const std::map<std::string, std::pair<std::size_t, std::size_t>>& profile)
+            {
+                // The slowest converters go first
+                std::vector<std::pair<std::string, std::pair<std::size_t, std::size_t>>> ops{
+                    std::begin(profile), std::end(profile)};
+                std::sort(std::begin(ops), std::end(ops), [](const decltype(ops)::value_type& a,
+                                                             const decltype(ops)::value_type& b) {
+                    return a.second.second > b.second.second;
+                });
+
+                std::cout << "ONNX graph '" << graph_name << "' converted in " << milliseconds
+                          << "ms\n";
+                for (const auto& op : ops)
+                {
+                    std::cout << std::setw(10) << op.second.second << "us " << std::setw(7)
+                              << op.second.first << " x " << op.first << "\n";
+                }
+            }
         } // namespace detail
 
         Graph::Graph(const ONNX_NAMESPACE::GraphProto& graph_proto, Model& model)
@@ -81,7 +110,7 @@ namespace ngraph
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
+                    Tensor tensor = Tensor{initializer_tensor, m_model->get_model_proto_owner()};
                     std::shared_ptr<default_opset::Constant> ng_constant;
                     // For each initializer create a Constant node and store it in cache
                     try
@@ -170,13 +199,28 @@ namespace ngraph
                          "nGraph does not support the following ONNX operations: ",
                          detail::to_string(unknown_operators));
 
+            static const bool profile_enabled = getenv_bool("NGRAPH_PROFILE_ONNX_IMPORT_ENABLE");
+            // Number of nodes and total conversion time of every operation type
+            std::map<std::string, std::pair<std::size_t, std::size_t>> profile;
+            stopwatch node_timer;
+            stopwatch overall_timer;
+            overall_timer.start();
+
             // Process ONNX graph nodes, convert to nGraph nodes
             for (const auto& node_proto : m_graph_proto->node())
             {
                 m_nodes.emplace_back(node_proto, *this);
                 const Node& node{m_nodes.back()};
 
+                node_timer.start();
                 OutputVector ng_nodes{node.get_ng_nodes()};
+                node_timer.stop();
+                if (profile_enabled)
+                {
+                    auto& op_profile = profile[detail::get_op_domain_and_name(node_proto)];
+                    ++op_profile.first;
+                    op_profile.second += node_timer.get_microseconds();
+                }
                 // Iterate over the number of outputs for given node in graph.
                 // Some of them may be optional and trimmed. See:
                 // https://github.com/onnx/onnx/blob/master/docs/IR.md#optional-inputs-and-outputs
@@ -185,6 +229,12 @@ namespace ngraph
                     m_cache->emplace_node(node.output(i), std::move(ng_nodes.at(i)));
                 }
             }
+
+            overall_timer.stop();
+            if (profile_enabled)
+            {
+                detail::print_profile(get_name(), overall_timer.get_milliseconds(), profile);
+            }
         }
 
         const GraphCache& Graph::get_graph_cache() const { return *m_cache.get(); }
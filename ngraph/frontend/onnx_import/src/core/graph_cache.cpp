@@ -28,14 +28,12 @@ namespace ngraph
 
         Output<ngraph::Node> GraphCache::get_node(const std::string& name) const
         {
-            try
-            {
-                return m_graph_cache_map.at(name);
-            }
-            catch (const std::out_of_range&)
+            const auto it = m_graph_cache_map.find(name);
+            if (it == std::end(m_graph_cache_map))
             {
                 throw ngraph_error(name + " node not found in graph cache");
             }
+            return it->second;
         }
 
         bool GraphCache::contains(const std::string& name) const
@@ -15,8 +15,22 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "onnx_import/exceptions.hpp"
@@ -28,6 +42,127 @@ namespace ngraph
     {
         namespace detail
         {
+            namespace
+            {
+                /// \brief  Whole file mapped into memory with copy-on-write semantics
+                class MappedFile
+                {
+                public:
+                    MappedFile(const MappedFile&) = delete;
+                    MappedFile& operator=(const MappedFile&) = delete;
+
+                    ~MappedFile()
+                    {
+#ifdef _WIN32
+                        UnmapViewOfFile(m_data);
+#else
+                        munmap(m_data, m_size);
+#endif
+                    }
+
+                    char* data() const { return m_data; }
+                    size_t size() const { return m_size; }
+                    /// \brief  Returns mapping of the file at path, nullptr if it cannot be mapped
+                    static std::shared_ptr<MappedFile> get(const std::string& path)
+                    {
+                        static std::mutex mutex;
+                        static std::map<std::string, std::weak_ptr<MappedFile>> mapped;
+
+                        std::lock_guard<std::mutex> lock(mutex);
+                        auto file = mapped[path].lock();
+                        if (file)
+                        {
+                            return file;
+                        }
+                        for (auto it = mapped.begin(); it != mapped.end();)
+                        {
+                            it = it->second.expired() ? mapped.erase(it) : std::next(it);
+                        }
+                        file = create(path);
+                        if (file)
+                        {
+                            mapped[path] = file;
+                        }
+                        return file;
+                    }
+
+                private:
+                    MappedFile(char* data, size_t size)
+                        : m_data{data}
+                        , m_size{size}
+                    {
+                    }
+
+                    static std::shared_ptr<MappedFile> create(const std::string& path)
+                    {
+#ifdef _WIN32
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+                        HANDLE file =
+                            CreateFileW(file_util::multi_byte_char_to_wstring(path.c_str()).c_str(),
+#else
+                        HANDLE file = CreateFileA(path.c_str(),
+#endif
+                                        GENERIC_READ,
+                                        FILE_SHARE_READ,
+                                        nullptr,
+                                        OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL,
+                                        nullptr);
+                        if (file == INVALID_HANDLE_VALUE)
+                        {
+                            return nullptr;
+                        }
+                        LARGE_INTEGER file_size;
+                        void* data = nullptr;
+                        if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+                        {
+                            HANDLE mapping =
+                                CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                            if (mapping != nullptr)
+                            {
+                                data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                                CloseHandle(mapping);
+                            }
+                        }
+                        CloseHandle(file);
+                        if (data == nullptr)
+                        {
+                            return nullptr;
+                        }
+                        const auto size = static_cast<size_t>(file_size.QuadPart);
+#else
+                        const int fd = open(path.c_str(), O_RDONLY);
+                        if (fd == -1)
+                        {
+                            return nullptr;
+                        }
+                        struct stat file_stat;
+                        void* data = MAP_FAILED;
+                        if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+                        {
+                            data = mmap(nullptr,
+                                        static_cast<size_t>(file_stat.st_size),
+                                        PROT_READ | PROT_WRITE,
+                                        MAP_PRIVATE,
+                                        fd,
+                                        0);
+                        }
+                        close(fd);
+                        if (data == MAP_FAILED)
+                        {
+                            return nullptr;
+                        }
+                        const auto size = static_cast<size_t>(file_stat.st_size);
+#endif
+                        return std::shared_ptr<MappedFile>(
+                            new MappedFile(static_cast<char*>(data), size));
+                    }
+
+                    char* m_data;
+                    size_t m_size;
+                };
+            }
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -84,6 +219,28 @@ namespace ngraph
                 return read_data;
             }
 
+            std::shared_ptr<TensorExternalData::SharedData>
+                TensorExternalData::map_external_data() const
+            {
+                const auto file = MappedFile::get(m_data_location);
+                if (!file || m_offset < 0 || m_data_lenght < 0 ||
+                    static_cast<size_t>(m_offset) + m_data_lenght > file->size())
+                {
+                    return nullptr;
+                }
+                // the whole rest of the file is the data if the length is not specified
+                const size_t length =
+                    m_data_lenght == 0 ? file->size() - m_offset : m_data_lenght;
+
+                if (m_sha1_digest != 0)
+                {
+                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                }
+
+                std::shared_ptr<const void> owner = file;
+                return std::make_shared<SharedData>(file->data() + m_offset, length, owner);
+            }
+
             std::string TensorExternalData::to_string() const
             {
                 std::stringstream s;
@@ -21,8 +21,13 @@
 #include "ngraph/ngraph.hpp"
 #include "util/test_tools.hpp"
 
+#include <fstream>
 #include <memory>
 
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
 NGRAPH_SUPPRESS_DEPRECATED_START
 
 using namespace std;
@@ -363,3 +368,61 @@ TEST(build_graph, build_graph_with_remove_result)
     nodes = f->get_ops();
     EXPECT_EQ(nodes.size(), 5);
 }
+
+namespace
+{
+    // Resident memory of the process in bytes or 0 if it is not available on the platform
+    size_t get_resident_memory()
+    {
+#ifdef __linux__
+        std::ifstream statm("/proc/self/statm");
+        size_t total_pages = 0;
+        size_t resident_pages = 0;
+        if (statm >> total_pages >> resident_pages)
+        {
+            return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+#endif
+        return 0;
+    }
+}
+
+TEST(benchmark, large_graph_memory)
+{
+    const size_t layers = 25000;
+
+    const auto memory_before = get_resident_memory();
+    stopwatch timer;
+    timer.start();
+
+    // Every layer adds 4 nodes: Constant, Add, Relu and Multiply with two consumers of Relu
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 16});
+    Output<Node> last = data;
+    for (size_t i = 0; i < layers; ++i)
+    {
+        auto bias = op::Constant::create(element::f32, Shape{1, 16}, {static_cast<float>(i)});
+        auto add = make_shared<op::v1::Add>(last, bias);
+        auto relu = make_shared<op::Relu>(add);
+        last = make_shared<op::v1::Multiply>(relu, relu);
+    }
+    auto f = make_shared<Function>(OutputVector{last}, ParameterVector{data});
+    const auto node_count = f->get_ordered_ops().size();
+
+    timer.stop();
+    const auto memory_after = get_resident_memory();
+
+    EXPECT_EQ(node_count, layers * 4 + 2);
+    NGRAPH_INFO << "built " << node_count << " nodes in " << timer.get_milliseconds() << "ms";
+    if (memory_after > memory_before)
+    {
+        NGRAPH_INFO << "resident memory growth " << (memory_after - memory_before) / 1024
+                    << "KB, " << (memory_after - memory_before) / node_count << " bytes per node";
+    }
+
+    timer.start();
+    f.reset();
+    last = Output<Node>();
+    data.reset();
+    timer.stop();
+    NGRAPH_INFO << "destroyed graph in " << timer.get_milliseconds() << "ms";
+}
@@ -1022,6 +1022,59 @@ TEST(constant, shared_data)
     EXPECT_EQ(p1, p2);
 }
 
+namespace
+{
+    class WritableConstant : public op::Constant
+    {
+    public:
+        using op::Constant::Constant;
+        using op::Constant::get_data_ptr_nc;
+    };
+}
+
+TEST(constant, shared_data_copy_on_write)
+{
+    Shape shape{100, 200};
+    auto c1 = make_shared<WritableConstant>(element::f32, shape, vector<float>{1.0f});
+    auto c2 = make_shared<WritableConstant>(*c1);
+    EXPECT_EQ(c1->get_data_ptr(), c2->get_data_ptr());
+
+    auto p2 = c2->get_data_ptr_nc<element::Type_t::f32>();
+    EXPECT_NE(c1->get_data_ptr(), c2->get_data_ptr());
+    p2[0] = 2.0f;
+    EXPECT_EQ(c1->get_data_ptr<float>()[0], 1.0f);
+    EXPECT_EQ(c2->get_data_ptr<float>()[0], 2.0f);
+    EXPECT_EQ(c2->get_data_ptr<float>()[1], 1.0f);
+
+    // the buffer isn't shared anymore
+    EXPECT_EQ(c2->get_data_ptr_nc(), c2->get_data_ptr());
+}
+
+TEST(constant, data_view)
+{
+    vector<int32_t> values{1, 2, 3, 4, 5, 6};
+    op::Constant c(element::i32, Shape{2, 3}, values);
+    auto view = c.get_data_view<int32_t>();
+    EXPECT_EQ(view.data(), c.get_data_ptr());
+    ASSERT_EQ(view.size(), values.size());
+    EXPECT_EQ(view[5], 6);
+    EXPECT_EQ(vector<int32_t>(view.begin(), view.end()), values);
+}
+
+TEST(constant, cast_all_of)
+{
+    op::Constant c(element::i8, Shape{4}, vector<int8_t>{0, 3, -2, 5});
+    EXPECT_TRUE(c.cast_all_of<float>([](float value) { return value < 5.5f; }));
+    EXPECT_FALSE(c.cast_all_of<float>([](float value) { return value >= 0.f; }));
+
+    size_t calls = 0;
+    EXPECT_FALSE(c.cast_all_of<int64_t>([&calls](int64_t value) {
+        calls++;
+        return value != 3;
+    }));
+    EXPECT_EQ(calls, 2u);
+}
+
 template <typename T1, typename T2>
 ::testing::AssertionResult test_convert()
 {
@@ -888,6 +888,51 @@ TEST(constant_folding, const_reducesum_keepdims)
     ASSERT_EQ(values_expected, values_out);
 }
 
+TEST(constant_folding, const_reducesum_large)
+{
+    // large enough to be reduced by several threads
+    Shape input_shape{64, 32, 64};
+    vector<int32_t> values_in(shape_size(input_shape));
+    for (size_t i = 0; i < values_in.size(); ++i)
+    {
+        values_in[i] = static_cast<int32_t>(i % 17) - 8;
+    }
+    auto constant = op::Constant::create(element::i32, input_shape, values_in);
+
+    auto reduce = [&](const vector<int64_t>& axes) {
+        auto constant_axes = op::Constant::create(element::i64, Shape{axes.size()}, axes);
+        auto sum = make_shared<op::v1::ReduceSum>(constant, constant_axes);
+        auto f = make_shared<Function>(sum, ParameterVector{});
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
+        pass_manager.run_passes(f);
+
+        auto new_const = as_type_ptr<op::Constant>(
+            f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+        EXPECT_TRUE(new_const);
+        return new_const ? new_const->get_vector<int32_t>() : vector<int32_t>{};
+    };
+
+    vector<int32_t> expected_middle(64 * 64, 0);
+    vector<int32_t> expected_outer(32, 0);
+    for (size_t i = 0; i < 64; ++i)
+    {
+        for (size_t j = 0; j < 32; ++j)
+        {
+            for (size_t k = 0; k < 64; ++k)
+            {
+                const auto value = values_in[(i * 32 + j) * 64 + k];
+                expected_middle[i * 64 + k] += value;
+                expected_outer[j] += value;
+            }
+        }
+    }
+
+    ASSERT_EQ(reduce({1}), expected_middle);
+    ASSERT_EQ(reduce({0, 2}), expected_outer);
+}
+
 TEST(constant_folding, const_reducemax)
 {
     Shape input_shape{3, 2};
@@ -3170,3 +3215,54 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, identical_subexpressions_are_folded_once)
+{
+    auto a = op::Constant::create(element::f32, Shape{3}, {1, 2, 3});
+    auto b = op::Constant::create(element::f32, Shape{3}, {4, 5, 6});
+    auto add_1 = make_shared<opset5::Add>(a, b);
+    auto add_2 = make_shared<opset5::Add>(a, b);
+    auto add_numpy = make_shared<opset5::Add>(a, b, op::AutoBroadcastType::NONE);
+    auto f = make_shared<Function>(NodeVector{add_1, add_2, add_numpy}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Add>(f), 0);
+    const auto& results = f->get_results();
+    // equal operations share the folded constant
+    EXPECT_EQ(results[0]->get_input_node_shared_ptr(0), results[1]->get_input_node_shared_ptr(0));
+    // operations with different attributes are folded separately
+    EXPECT_NE(results[0]->get_input_node_shared_ptr(0), results[2]->get_input_node_shared_ptr(0));
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(get_result_constant<float>(f, i), vector<float>({5, 7, 9}));
+    }
+}
+
+TEST(constant_folding, independent_large_subgraphs)
+{
+    const size_t size = 1 << 16;
+    const size_t branches = 8;
+    NodeVector outputs;
+    for (size_t i = 0; i < branches; ++i)
+    {
+        auto data = op::Constant::create(element::f32, Shape{size}, vector<float>(size, i));
+        auto multiply = make_shared<opset5::Multiply>(
+            data, op::Constant::create(element::f32, Shape{1}, {2}));
+        outputs.push_back(make_shared<opset5::Convert>(multiply, element::i32));
+    }
+    auto f = make_shared<Function>(outputs, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset5::Convert>(f), 0);
+    for (size_t i = 0; i < branches; ++i)
+    {
+        EXPECT_EQ(get_result_constant<int32_t>(f, i), vector<int32_t>(size, 2 * i));
+    }
+}
@@ -468,3 +468,90 @@ TEST(coordinate_range, reverse_2_range_3d)
                                                << std::distance(expected_val, end(expected))
                                                << " is missing)";
 }
+
+///
+///
+///     ReshapeRange
+///
+///
+
+TEST(coordinate_range, reshape_range_shape0d)
+{
+    const Shape s;
+
+    auto reshape_range = reshape(s, AxisVector{});
+    auto it = reshape_range.begin();
+    EXPECT_FALSE(it == reshape_range.end());
+    EXPECT_EQ((*it).element_number, 1);
+    EXPECT_TRUE(++it == reshape_range.end());
+}
+
+TEST(coordinate_range, reshape_range_input_validataion)
+{
+    const Shape s{2, 3};
+    EXPECT_THROW(reshape(s, AxisVector{0}), std::domain_error);
+    EXPECT_THROW(reshape(s, AxisVector{0, 0}), std::domain_error);
+    EXPECT_THROW(reshape(s, AxisVector{1, 2}), std::domain_error);
+}
+
+TEST(coordinate_range, reshape_range_2d)
+{
+    const Shape s{2, 3};
+    const AxisVector axis_order{1, 0};
+
+    // clang-format off
+    const ExpectedOutput expected{
+        {0, {0, 0}}, {3, {1, 0}},
+        {1, {0, 1}}, {4, {1, 1}},
+        {2, {0, 2}}, {5, {1, 2}}};
+    // clang-format on
+
+    auto expected_val = begin(expected);
+    for (auto reshape_range : reshape(s, axis_order))
+    {
+        auto index = reshape_range.begin_index;
+        ASSERT_EQ(reshape_range.direction, Direction::forward);
+        ASSERT_EQ(reshape_range.step, 3);
+        for (size_t i = 0; i < reshape_range.element_number; index += reshape_range.step, ++i)
+        {
+            EXPECT_EQ(index, expected_val->first);
+            ++expected_val;
+        }
+    }
+
+    EXPECT_TRUE(expected_val == end(expected)) << "not all expected values return, ("
+                                               << std::distance(expected_val, end(expected))
+                                               << " is missing)";
+}
+
+TEST(coordinate_range, reshape_range_3d)
+{
+    const Shape s{2, 3, 2};
+    const AxisVector axis_order{1, 0, 2};
+
+    // clang-format off
+    const ExpectedOutput expected{
+        {0, {0, 0, 0}},  {1, {0, 0, 1}},
+        {6, {1, 0, 0}},  {7, {1, 0, 1}},
+        {2, {0, 1, 0}},  {3, {0, 1, 1}},
+        {8, {1, 1, 0}},  {9, {1, 1, 1}},
+        {4, {0, 2, 0}},  {5, {0, 2, 1}},
+        {10, {1, 2, 0}}, {11, {1, 2, 1}}};
+    // clang-format on
+
+    auto expected_val = begin(expected);
+    for (auto reshape_range : reshape(s, axis_order))
+    {
+        auto index = reshape_range.begin_index;
+        ASSERT_EQ(reshape_range.step, 1);
+        for (size_t i = 0; i < reshape_range.element_number; index += reshape_range.step, ++i)
+        {
+            EXPECT_EQ(index, expected_val->first);
+            ++expected_val;
+        }
+    }
+
+    EXPECT_TRUE(expected_val == end(expected)) << "not all expected values return, ("
+                                               << std::distance(expected_val, end(expected))
+                                               << " is missing)";
+}
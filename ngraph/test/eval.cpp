@@ -22,6 +22,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "ngraph/evaluation_plan.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/node_output.hpp"
 #include "ngraph/op/abs.hpp"
@@ -2057,3 +2058,53 @@ TEST(eval, evaluate_dynamic_scatter_update_one_elem_i32)
     vector<int32_t> out{0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0, 0, 0};
     ASSERT_EQ(cval, out);
 }
+
+TEST(eval, evaluation_plan_reuses_buffers)
+{
+    const Shape shape{1024};
+    auto p = make_shared<op::Parameter>(element::f32, shape);
+    auto shift = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 1.f));
+    auto add = make_shared<op::v1::Add>(p, shift);
+    auto relu = make_shared<op::Relu>(add);
+    auto sqrt = make_shared<op::Sqrt>(relu);
+    auto negative = make_shared<op::Negative>(sqrt);
+    auto abs = make_shared<op::Abs>(negative);
+    auto fun = make_shared<Function>(OutputVector{abs}, ParameterVector{p});
+
+    EvaluationPlan plan(fun);
+    // four intermediate values, at most two of them are alive at once
+    EXPECT_LE(plan.get_arena_size(), 2 * shape_size(shape) * sizeof(float));
+
+    for (float value : {3.f, 8.f, -5.f})
+    {
+        auto input = make_host_tensor<element::Type_t::f32>(
+            shape, vector<float>(shape_size(shape), value));
+        auto expected = make_shared<HostTensor>();
+        auto result = make_shared<HostTensor>();
+        ASSERT_TRUE(fun->evaluate({expected}, {input}));
+        ASSERT_TRUE(plan.evaluate({result}, {input}));
+        EXPECT_EQ(result->get_partial_shape(), (PartialShape{shape}));
+        EXPECT_EQ(read_vector<float>(result), read_vector<float>(expected));
+    }
+}
+
+TEST(eval, evaluation_plan_dynamic_shapes)
+{
+    auto p = make_shared<op::Parameter>(element::f32, PartialShape{-1, -1});
+    auto shape_of = make_shared<op::v3::ShapeOf>(p);
+    auto axis = op::Constant::create(element::i64, Shape{}, {0});
+    auto indices = op::Constant::create(element::i64, Shape{1}, {1});
+    auto gather = make_shared<op::v1::Gather>(shape_of, indices, axis);
+    auto fun = make_shared<Function>(OutputVector{gather}, ParameterVector{p});
+
+    EvaluationPlan plan(fun);
+    for (size_t width : {3, 7})
+    {
+        auto result = make_shared<HostTensor>();
+        ASSERT_TRUE(plan.evaluate(
+            {result},
+            {make_host_tensor<element::Type_t::f32>(Shape{2, width},
+                                                    vector<float>(2 * width, 0.f))}));
+        EXPECT_EQ(read_vector<int64_t>(result), vector<int64_t>{static_cast<int64_t>(width)});
+    }
+}
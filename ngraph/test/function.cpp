@@ -0,0 +1,172 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset5.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    bool contains(const NodeVector& nodes, const shared_ptr<Node>& node)
+    {
+        return find(nodes.begin(), nodes.end(), node) != nodes.end();
+    }
+
+    size_t position(const NodeVector& nodes, const shared_ptr<Node>& node)
+    {
+        return distance(nodes.begin(), find(nodes.begin(), nodes.end(), node));
+    }
+}
+
+TEST(function, ordered_ops_are_reused)
+{
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{2});
+    auto relu = make_shared<opset5::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+
+    EXPECT_EQ(f->get_ordered_ops(), f->get_ordered_ops());
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(function, ordered_ops_after_replace_node)
+{
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{2});
+    auto relu = make_shared<opset5::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+    f->get_ordered_ops();
+
+    auto abs = make_shared<opset5::Abs>(data);
+    replace_node(relu, abs);
+
+    const auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops.size(), 3);
+    EXPECT_TRUE(contains(ops, abs));
+    EXPECT_FALSE(contains(ops, relu));
+}
+
+TEST(function, ordered_ops_after_input_change)
+{
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{2});
+    auto relu = make_shared<opset5::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+    f->get_ordered_ops();
+
+    auto abs = make_shared<opset5::Abs>(data);
+    relu->input(0).replace_source_output(abs);
+
+    const auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops.size(), 4);
+    EXPECT_LT(position(ops, abs), position(ops, relu));
+}
+
+TEST(function, ordered_ops_after_control_dependency)
+{
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{2});
+    auto relu = make_shared<opset5::Relu>(data);
+    auto abs = make_shared<opset5::Abs>(data);
+    auto f = make_shared<Function>(NodeVector{relu, abs}, ParameterVector{data});
+
+    abs->add_control_dependency(relu);
+    auto ops = f->get_ordered_ops();
+    EXPECT_LT(position(ops, relu), position(ops, abs));
+
+    abs->remove_control_dependency(relu);
+    relu->add_control_dependency(abs);
+    ops = f->get_ordered_ops();
+    EXPECT_LT(position(ops, abs), position(ops, relu));
+}
+
+TEST(function, ordered_ops_after_results_change)
+{
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{2});
+    auto relu = make_shared<opset5::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+    f->get_ordered_ops();
+
+    auto abs = make_shared<opset5::Abs>(data);
+    auto result = make_shared<opset5::Result>(abs);
+    f->add_results({result});
+    EXPECT_TRUE(contains(f->get_ordered_ops(), abs));
+
+    f->remove_result(result);
+    EXPECT_FALSE(contains(f->get_ordered_ops(), abs));
+}
+
+TEST(function, ordered_ops_do_not_hold_removed_nodes)
+{
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{2});
+    auto relu = make_shared<opset5::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+    f->get_ordered_ops();
+
+    weak_ptr<Node> removed = relu;
+    replace_node(relu, make_shared<opset5::Abs>(data));
+    relu.reset();
+
+    EXPECT_TRUE(removed.expired());
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(function, validate_changed_nodes_after_reshape)
+{
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{2});
+    auto relu = make_shared<opset5::Relu>(data);
+    auto abs = make_shared<opset5::Abs>(relu);
+    auto other_data = make_shared<opset5::Parameter>(element::f32, Shape{3});
+    auto other_relu = make_shared<opset5::Relu>(other_data);
+    auto f = make_shared<Function>(NodeVector{abs, other_relu}, ParameterVector{data, other_data});
+    f->validate_nodes_and_infer_types();
+    for (const auto& node : f->get_ordered_ops())
+    {
+        EXPECT_FALSE(node->needs_revalidation());
+    }
+
+    data->set_partial_shape(Shape{4});
+    EXPECT_TRUE(data->needs_revalidation());
+    EXPECT_FALSE(other_data->needs_revalidation());
+
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(abs->get_output_shape(0), Shape{4});
+    EXPECT_EQ(f->get_results()[0]->get_output_shape(0), Shape{4});
+    EXPECT_EQ(other_relu->get_output_shape(0), Shape{3});
+    for (const auto& node : f->get_ordered_ops())
+    {
+        EXPECT_FALSE(node->needs_revalidation());
+    }
+}
+
+TEST(function, validate_changed_nodes_after_replace_node)
+{
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{2, 3});
+    auto relu = make_shared<opset5::Relu>(data);
+    auto abs = make_shared<opset5::Abs>(relu);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{data});
+    f->validate_nodes_and_infer_types();
+
+    auto axes = opset5::Constant::create(element::i64, Shape{1}, {0});
+    auto reduce = make_shared<opset5::ReduceSum>(data, axes);
+    replace_node(relu, reduce);
+    EXPECT_TRUE(abs->needs_revalidation());
+
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(abs->get_output_shape(0), Shape{3});
+    EXPECT_EQ(f->get_results()[0]->get_output_shape(0), Shape{3});
+}
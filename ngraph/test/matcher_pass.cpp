@@ -19,6 +19,7 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <sstream>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/rt_info.hpp>
 
@@ -117,4 +118,35 @@ TEST(pattern, matcher_pass)
         // Parameter->Relu->Result
         ASSERT_TRUE(f->get_ops().size() == 3);
     }
-}
\ No newline at end of file
+}
+TEST(pattern, matcher_pass_profile)
+{
+    auto a = make_shared<opset3::Parameter>(element::f32, Shape{1});
+    auto b = make_shared<opset3::Relu>(a);
+    auto c = make_shared<opset3::Relu>(b);
+    auto d = make_shared<opset3::Relu>(c);
+    auto f = std::make_shared<Function>(ngraph::NodeVector{d}, ParameterVector{a});
+
+    pass::Manager manager;
+    manager.set_profiling(true);
+    auto anchor = manager.register_pass<pass::GraphRewrite>();
+    anchor->add_matcher<TestMatcherPass>();
+    anchor->set_name("ReluFusions");
+    manager.run_passes(f);
+
+    const auto& profile = manager.get_profile();
+    auto it = std::find_if(profile.begin(), profile.end(), [](const pass::PassProfile& p) {
+        return p.name == "ReluFusions";
+    });
+    ASSERT_NE(it, profile.end());
+    EXPECT_EQ(it->nodes_before, 5);
+    EXPECT_EQ(it->nodes_after, 3);
+    EXPECT_TRUE(it->function_changed);
+    ASSERT_EQ(it->matcher_hits.size(), 1);
+    EXPECT_EQ(it->matcher_hits[0].first, "ReluReluFusion");
+    EXPECT_EQ(it->matcher_hits[0].second, 2);
+
+    std::stringstream json;
+    manager.write_profile(json);
+    EXPECT_NE(json.str().find(R"("matcher_hits":{"ReluReluFusion":2})"), std::string::npos);
+}
@@ -852,3 +852,35 @@ TEST(pattern, wrap_type)
         ASSERT_TRUE(matcher->match(static_pointer_cast<Node>(mul2)));
     }
 }
+
+TEST(pattern, matcher_reuse_with_commutative_args)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto c = make_shared<op::Parameter>(element::f32, Shape{1});
+
+    auto x = pattern::any_input();
+    auto y = pattern::wrap_type<op::Abs>();
+    auto z = pattern::any_input();
+    auto add = pattern::wrap_type<op::v1::Add>({x, y});
+    auto mul = pattern::wrap_type<op::v1::Multiply>({add, z});
+    pattern::Matcher m(mul, "MatcherReuse");
+
+    auto abs_b = make_shared<op::Abs>(b);
+    auto graph = make_shared<op::v1::Multiply>(c, make_shared<op::v1::Add>(abs_b, a));
+    auto no_abs = make_shared<op::v1::Multiply>(c, make_shared<op::v1::Add>(a, b));
+    auto other_type = make_shared<op::Relu>(a);
+
+    // the storage of the nested commutative arguments is reused by the following matches
+    for (size_t i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(m.match(graph->output(0)));
+        ASSERT_EQ(m.get_matched_nodes().size(), 5);
+        ASSERT_EQ(m.get_pattern_value_map()[x], a->output(0));
+        ASSERT_EQ(m.get_pattern_value_map()[y], abs_b->output(0));
+        ASSERT_EQ(m.get_pattern_value_map()[z], c->output(0));
+
+        ASSERT_FALSE(m.match(no_abs->output(0)));
+        ASSERT_FALSE(m.match(other_type->output(0)));
+    }
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_benchmark.hpp"
+
+#include <ngraph/opsets/opset5.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace ngraph;
+
+namespace {
+
+void Interpolate(benchmark::State& state, element::Type precision, op::v4::Interpolate::InterpolateMode mode) {
+    const auto shape = NodeBenchmarks::shapeFromArgs(state);
+    auto data = std::make_shared<opset5::Parameter>(precision, shape);
+    op::v4::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = mode;
+    attrs.shape_calculation_mode = op::v4::Interpolate::ShapeCalcMode::scales;
+    attrs.pads_begin = std::vector<size_t>(shape.size(), 0);
+    attrs.pads_end = std::vector<size_t>(shape.size(), 0);
+    const Shape outShape{shape[0], shape[1], shape[2] * 2, shape[3] * 2};
+    auto interpolate = std::make_shared<opset5::Interpolate>(
+        data,
+        opset5::Constant::create(element::i64, Shape{2}, std::vector<size_t>{outShape[2], outShape[3]}),
+        opset5::Constant::create(element::f32, Shape{2}, std::vector<float>{2.f, 2.f}),
+        opset5::Constant::create(element::i64, Shape{2}, std::vector<int64_t>{2, 3}),
+        attrs);
+    auto function = std::make_shared<Function>(std::make_shared<opset5::Result>(interpolate), ParameterVector{data});
+    // weighting of 4 source pixels for linear mode
+    NodeBenchmarks::runFunction(state, function,
+                                mode == op::v4::Interpolate::InterpolateMode::nearest ? 0 : 8 * shape_size(outShape));
+}
+
+void Gather(benchmark::State& state, element::Type precision) {
+    const auto shape = NodeBenchmarks::shapeFromArgs(state);
+    auto data = std::make_shared<opset5::Parameter>(precision, shape);
+    // every second channel in reversed order
+    std::vector<int32_t> indices;
+    for (int32_t i = static_cast<int32_t>(shape[1]) - 1; i >= 0; i -= 2)
+        indices.push_back(i);
+    auto gather = std::make_shared<opset5::Gather>(
+        data,
+        opset5::Constant::create(element::i32, Shape{indices.size()}, indices),
+        opset5::Constant::create(element::i64, Shape{}, std::vector<int64_t>{1}));
+    auto function = std::make_shared<Function>(std::make_shared<opset5::Result>(gather), ParameterVector{data});
+    NodeBenchmarks::runFunction(state, function);
+}
+
+void Transpose(benchmark::State& state, std::vector<int64_t> order) {
+    const auto shape = NodeBenchmarks::shapeFromArgs(state);
+    auto data = std::make_shared<opset5::Parameter>(element::f32, shape);
+    auto transpose = std::make_shared<opset5::Transpose>(
+        data, opset5::Constant::create(element::i64, Shape{order.size()}, order));
+    auto function = std::make_shared<Function>(std::make_shared<opset5::Result>(transpose), ParameterVector{data});
+    NodeBenchmarks::runFunction(state, function);
+}
+
+void Convert(benchmark::State& state, element::Type srcPrecision, element::Type dstPrecision) {
+    auto data = std::make_shared<opset5::Parameter>(srcPrecision, NodeBenchmarks::shapeFromArgs(state));
+    auto convert = std::make_shared<opset5::Convert>(data, dstPrecision);
+    auto function = std::make_shared<Function>(std::make_shared<opset5::Result>(convert), ParameterVector{data});
+    NodeBenchmarks::runFunction(state, function);
+}
+
+void Shapes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->Args({1, 64, 56, 56})->Args({1, 256, 14, 14})->Args({1, 3, 224, 224});
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(Interpolate, nearest_f32, element::f32, op::v4::Interpolate::InterpolateMode::nearest)->Apply(Shapes);
+BENCHMARK_CAPTURE(Interpolate, nearest_u8, element::u8, op::v4::Interpolate::InterpolateMode::nearest)->Apply(Shapes);
+BENCHMARK_CAPTURE(Interpolate, linear_onnx_f32, element::f32, op::v4::Interpolate::InterpolateMode::linear_onnx)->Apply(Shapes);
+BENCHMARK_CAPTURE(Gather, f32, element::f32)->Apply(Shapes);
+BENCHMARK_CAPTURE(Gather, u8, element::u8)->Apply(Shapes);
+BENCHMARK_CAPTURE(Transpose, nchw_to_nhwc, std::vector<int64_t>{0, 2, 3, 1})->Apply(Shapes);
+// attention heads of transformers: batch, sequence, heads, head size
+BENCHMARK_CAPTURE(Transpose, heads_0213, std::vector<int64_t>{0, 2, 1, 3})->Args({1, 384, 12, 64});
+BENCHMARK_CAPTURE(Transpose, heads_0231, std::vector<int64_t>{0, 2, 3, 1})->Args({1, 384, 12, 64});
+BENCHMARK_CAPTURE(Convert, u8_to_f32, element::u8, element::f32)->Apply(Shapes);
+BENCHMARK_CAPTURE(Convert, f32_to_i32, element::f32, element::i32)->Apply(Shapes);
+BENCHMARK_CAPTURE(Convert, i64_to_i32, element::i64, element::i32)->Apply(Shapes);
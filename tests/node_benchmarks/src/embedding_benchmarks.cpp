@@ -0,0 +1,72 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_benchmark.hpp"
+
+#include <inference_engine.hpp>
+#include <ngraph/opsets/opset3.hpp>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ngraph;
+
+namespace {
+
+// Recommender-sized tables are looked up by all NUMA streams at once, so the benchmark runs
+// as many requests as the network has streams in every iteration.
+// arguments: table rows, embedding size, bags, indices per bag, sharding threshold in MB (0 - a single not sharded table)
+void EmbeddingBagPackedSum(benchmark::State& state) {
+    static InferenceEngine::Core ie;
+
+    const size_t rows = state.range(0), embeddingSize = state.range(1);
+    const size_t bags = state.range(2), bagSize = state.range(3);
+    auto table = std::make_shared<opset3::Constant>(element::f32, Shape{rows, embeddingSize},
+                                                    std::vector<float>(rows * embeddingSize, 0.5f));
+    auto indices = std::make_shared<opset3::Parameter>(element::i32, Shape{bags, bagSize});
+    auto bag = std::make_shared<opset3::EmbeddingBagPackedSum>(table, indices);
+    auto function = std::make_shared<Function>(std::make_shared<opset3::Result>(bag), ParameterVector{indices});
+
+    InferenceEngine::CNNNetwork network(function);
+    const std::map<std::string, std::string> config = {
+        {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), CONFIG_VALUE(CPU_THROUGHPUT_NUMA)},
+        {CONFIG_KEY(CPU_NUMA_SHARDING_THRESHOLD), std::to_string(state.range(4))}};
+    auto execNetwork = ie.LoadNetwork(network, "CPU", config);
+    const auto requestsNum = execNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int32_t> distribution(0, static_cast<int32_t>(rows) - 1);
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (unsigned int i = 0; i < requestsNum; i++) {
+        requests.push_back(execNetwork.CreateInferRequest());
+        auto blob = requests.back().GetBlob(network.getInputsInfo().begin()->first);
+        auto data = blob->buffer().as<int32_t*>();
+        for (size_t j = 0; j < blob->size(); j++)
+            data[j] = distribution(generator);
+        // the first inference initializes memory of the graph
+        requests.back().Infer();
+    }
+
+    for (auto _ : state) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+    }
+
+    // rows read from the table by all requests
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * requestsNum * bags * bagSize *
+                                                 embeddingSize * sizeof(float)));
+    state.counters["requests"] = requestsNum;
+}
+
+}  // namespace
+
+// 1M and 8M rows of 64 floats (256 MB and 2 GB), not sharded and sharded across NUMA nodes
+BENCHMARK(EmbeddingBagPackedSum)->Args({1 << 20, 64, 2048, 32, 0})->Args({1 << 20, 64, 2048, 32, 128})
+                                ->Args({1 << 23, 64, 2048, 32, 0})->Args({1 << 23, 64, 2048, 32, 128})
+                                ->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,83 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_benchmark.hpp"
+
+#include <inference_engine.hpp>
+#include <ngraph/op/constant.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+namespace NodeBenchmarks {
+
+namespace {
+
+template <typename T>
+void fillRandom(const InferenceEngine::Blob::Ptr& blob, T min, T max) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(static_cast<float>(min), static_cast<float>(max));
+    auto data = blob->buffer().as<T*>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = static_cast<T>(distribution(generator));
+}
+
+void fillBlob(const InferenceEngine::Blob::Ptr& blob) {
+    switch (blob->getTensorDesc().getPrecision()) {
+    case InferenceEngine::Precision::FP32:
+        fillRandom<float>(blob, 0.f, 1.f);
+        break;
+    case InferenceEngine::Precision::U8:
+        fillRandom<uint8_t>(blob, 0, 255);
+        break;
+    case InferenceEngine::Precision::I8:
+        fillRandom<int8_t>(blob, -128, 127);
+        break;
+    default:
+        std::fill_n(blob->buffer().as<uint8_t*>(), blob->byteSize(), 0);
+    }
+}
+
+}  // namespace
+
+void runFunction(benchmark::State& state, const std::shared_ptr<ngraph::Function>& function, uint64_t operations) {
+    static InferenceEngine::Core ie;
+
+    InferenceEngine::CNNNetwork network(function);
+    auto execNetwork = ie.LoadNetwork(network, "CPU", {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "1"}});
+    auto request = execNetwork.CreateInferRequest();
+
+    size_t bytes = 0;
+    for (auto&& input : execNetwork.GetInputsInfo()) {
+        auto blob = request.GetBlob(input.first);
+        fillBlob(blob);
+        bytes += blob->byteSize();
+    }
+    for (auto&& output : execNetwork.GetOutputsInfo())
+        bytes += request.GetBlob(output.first)->byteSize();
+    for (auto&& node : function->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node))
+            bytes += ngraph::shape_size(constant->get_shape()) * constant->get_element_type().size();
+    }
+
+    // the first inference initializes memory of the graph
+    request.Infer();
+    for (auto _ : state)
+        request.Infer();
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+    if (operations != 0) {
+        state.counters["ops"] = benchmark::Counter(static_cast<double>(operations),
+                                                   benchmark::Counter::kIsIterationInvariantRate,
+                                                   benchmark::Counter::OneK::kIs1000);
+    }
+}
+
+ngraph::Shape shapeFromArgs(const benchmark::State& state) {
+    return ngraph::Shape{static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)),
+                         static_cast<size_t>(state.range(2)), static_cast<size_t>(state.range(3))};
+}
+
+}  // namespace NodeBenchmarks
@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <ngraph/function.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace NodeBenchmarks {
+
+/**
+ * @brief Loads the function to CPU plugin with one stream and runs it synchronously in the benchmark loop.
+ * Reports processed bytes (inputs, outputs and constants per inference) as GB/s and, if operations count
+ * of one inference is not zero, achieved operations per second as "ops" counter.
+ * @param state state of the benchmark
+ * @param function single-op function, its float inputs are filled with random values in [0, 1) range
+ * @param operations number of operations performed by one inference
+ */
+void runFunction(benchmark::State& state, const std::shared_ptr<ngraph::Function>& function, uint64_t operations = 0);
+
+/**
+ * @brief Returns 4D shape from four arguments of the benchmark
+ */
+ngraph::Shape shapeFromArgs(const benchmark::State& state);
+
+}  // namespace NodeBenchmarks
@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_benchmark.hpp"
+
+#include <ngraph/opsets/opset5.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace ngraph;
+
+namespace {
+
+void MVN(benchmark::State& state, bool acrossChannels) {
+    const auto shape = NodeBenchmarks::shapeFromArgs(state);
+    auto data = std::make_shared<opset5::Parameter>(element::f32, shape);
+    auto mvn = std::make_shared<opset5::MVN>(data, acrossChannels, true);
+    auto function = std::make_shared<Function>(std::make_shared<opset5::Result>(mvn), ParameterVector{data});
+    // mean, variance and normalization
+    NodeBenchmarks::runFunction(state, function, 7 * shape_size(shape));
+}
+
+void ReduceMean(benchmark::State& state, std::vector<int64_t> axes) {
+    const auto shape = NodeBenchmarks::shapeFromArgs(state);
+    auto data = std::make_shared<opset5::Parameter>(element::f32, shape);
+    auto reduce = std::make_shared<opset5::ReduceMean>(
+        data, opset5::Constant::create(element::i64, Shape{axes.size()}, axes), true);
+    auto function = std::make_shared<Function>(std::make_shared<opset5::Result>(reduce), ParameterVector{data});
+    NodeBenchmarks::runFunction(state, function, shape_size(shape));
+}
+
+void Shapes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->Args({1, 64, 56, 56})->Args({1, 256, 14, 14})->Args({8, 32, 112, 112})->Args({1, 3, 224, 224});
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(MVN, across_channels, true)->Apply(Shapes);
+BENCHMARK_CAPTURE(MVN, per_channel, false)->Apply(Shapes);
+BENCHMARK_CAPTURE(ReduceMean, spatial, std::vector<int64_t>{2, 3})->Apply(Shapes);
+BENCHMARK_CAPTURE(ReduceMean, channels, std::vector<int64_t>{1})->Apply(Shapes);
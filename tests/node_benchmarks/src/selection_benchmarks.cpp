@@ -0,0 +1,74 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_benchmark.hpp"
+
+#include <ngraph/opsets/opset5.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace ngraph;
+
+namespace {
+
+// arguments: batch, channels, spatial dims, k; TopK selects along channels
+void TopK(benchmark::State& state, opset5::TopK::SortType sort) {
+    const Shape shape{static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)),
+                      static_cast<size_t>(state.range(2)), static_cast<size_t>(state.range(2))};
+    auto data = std::make_shared<opset5::Parameter>(element::f32, shape);
+    auto topk = std::make_shared<opset5::TopK>(
+        data, opset5::Constant::create(element::i64, Shape{}, std::vector<int64_t>{state.range(3)}),
+        1, opset5::TopK::Mode::MAX, sort);
+    auto function = std::make_shared<Function>(OutputVector{topk->output(0), topk->output(1)}, ParameterVector{data});
+    NodeBenchmarks::runFunction(state, function);
+}
+
+// arguments: batch, classes, boxes, max output boxes per class
+void NonMaxSuppression(benchmark::State& state) {
+    const size_t batch = state.range(0), classes = state.range(1), boxesCount = state.range(2);
+    auto boxes = std::make_shared<opset5::Parameter>(element::f32, Shape{batch, boxesCount, 4});
+    auto scores = std::make_shared<opset5::Parameter>(element::f32, Shape{batch, classes, boxesCount});
+    auto nms = std::make_shared<opset5::NonMaxSuppression>(
+        boxes, scores,
+        opset5::Constant::create(element::i64, Shape{}, std::vector<int64_t>{state.range(3)}),
+        opset5::Constant::create(element::f32, Shape{}, std::vector<float>{0.5f}),
+        opset5::Constant::create(element::f32, Shape{}, std::vector<float>{0.05f}),
+        opset5::NonMaxSuppression::BoxEncodingType::CENTER);
+    auto function = std::make_shared<Function>(OutputVector{nms->output(0)}, ParameterVector{boxes, scores});
+    NodeBenchmarks::runFunction(state, function);
+}
+
+// arguments: batch, classes, priors; confidences are uniform, so the threshold keeps 10% of them as in SSD models
+void DetectionOutput(benchmark::State& state) {
+    const size_t batch = state.range(0), classes = state.range(1), priors = state.range(2);
+    auto locations = std::make_shared<opset5::Parameter>(element::f32, Shape{batch, priors * 4});
+    auto confidences = std::make_shared<opset5::Parameter>(element::f32, Shape{batch, priors * classes});
+    auto proposals = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 2, priors * 4});
+
+    op::DetectionOutputAttrs attrs;
+    attrs.num_classes = static_cast<int>(classes);
+    attrs.top_k = 400;
+    attrs.keep_top_k = {200};
+    attrs.code_type = "caffe.PriorBoxParameter.CENTER_SIZE";
+    attrs.nms_threshold = 0.45f;
+    attrs.confidence_threshold = 0.9f;
+    attrs.normalized = true;
+    auto detectionOutput = std::make_shared<opset5::DetectionOutput>(locations, confidences, proposals, attrs);
+    auto function = std::make_shared<Function>(OutputVector{detectionOutput->output(0)},
+                                               ParameterVector{locations, confidences, proposals});
+    NodeBenchmarks::runFunction(state, function);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(TopK, sort_values, opset5::TopK::SortType::SORT_VALUES)
+    ->Args({1, 1000, 1, 5})->Args({1, 1000, 1, 100})->Args({1, 64, 56, 1})->Args({16, 1000, 1, 5})
+    ->Args({1, 30000, 1, 300})->Args({8, 30000, 1, 100});
+BENCHMARK_CAPTURE(TopK, sort_indices, opset5::TopK::SortType::SORT_INDICES)
+    ->Args({1, 1000, 1, 5})->Args({1, 64, 56, 1});
+BENCHMARK(NonMaxSuppression)->Args({1, 1, 1000, 100})->Args({1, 80, 1000, 100})->Args({1, 80, 10000, 100})
+    ->Args({1, 1, 100000, 100});
+// SSD300 VOC, SSD MobileNet COCO and a model with 100k priors
+BENCHMARK(DetectionOutput)->Args({1, 21, 8732})->Args({1, 91, 1917})->Args({1, 2, 100000})->Args({4, 21, 8732});
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+# Copyright (C) 2020 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+"""
+This script runs benchmark_app several times and aggregates
+throughput, latency and load time it reports.
+"""
+
+# pylint: disable=redefined-outer-name
+
+import argparse
+import csv
+import json
+import logging
+import statistics
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+from pprint import pprint
+import yaml
+
+# metrics collected from benchmark_app reports. Values of throughput should be
+# higher than references, values of other metrics should be lower
+REPORT_METRICS = {
+    "throughput": "throughput",
+    "latency": "latency (ms)",
+    "p99 latency": "p99 latency (ms)",
+}
+STARTUP_METRICS = {
+    "load time": "load network",
+    "first inference": "first inference",
+}
+HIGHER_IS_BETTER = ["throughput"]
+
+
+def run_cmd(args: list, log=None, verbose=True):
+    """ Run command
+    """
+    if log is None:
+        log = logging.getLogger('run_cmd')
+    log_out = log.info if verbose else log.debug
+
+    log.info(f'========== cmd: {" ".join(args)}')  # pylint: disable=logging-fstring-interpolation
+
+    proc = subprocess.Popen(args,
+                            stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT,
+                            encoding='utf-8',
+                            universal_newlines=True)
+    output = []
+    for line in iter(proc.stdout.readline, ''):
+        log_out(line.strip('\n'))
+        output.append(line)
+    outs = proc.communicate()[0]
+
+    if outs:
+        log_out(outs.strip('\n'))
+        output.append(outs)
+    log.info('========== Completed. Exit code: %d', proc.returncode)
+    return proc.returncode, ''.join(output)
+
+
+def read_execution_results(report_path: Path):
+    """Read "Execution results" section of benchmark_app CSV report"""
+    results = {}
+    with open(report_path, "r") as file:
+        section = None
+        for row in csv.reader(file, delimiter=';'):
+            row = [item for item in row if item]
+            if len(row) == 1:
+                section = row[0]
+            elif len(row) == 2 and section == "Execution results":
+                results[row[0]] = row[1]
+    return {name: float(results[key]) for name, key in REPORT_METRICS.items() if key in results}
+
+
+def read_startup_report(report_path: Path):
+    """Read phases of benchmark_app startup report"""
+    with open(report_path, "r") as file:
+        phases = {phase["name"]: phase["time"] for phase in json.load(file)["phases_ms"]}
+    if "import network" in phases:
+        phases["load network"] = phases["import network"]
+    return {name: float(phases[key]) for name, key in STARTUP_METRICS.items() if key in phases}
+
+
+def aggregate_stats(stats: dict):
+    """Aggregate provided statistics. Median is used as it is robust to a single noisy run"""
+    return {metric: {"median": statistics.median(values),
+                     "stdev": statistics.stdev(values) if len(values) > 1 else 0}
+            for metric, values in stats.items()}
+
+
+def prepare_executable_cmd(args: dict):
+    """Generate common part of cmd from arguments to execute"""
+    cmd = [str(args["executable"].resolve(strict=True)),
+           "-m", str(args["model"].resolve(strict=True)),
+           "-d", args["device"],
+           "-t", str(args["time"])]
+    for name, value in args.get("benchmark_args", {}).items():
+        cmd += ["-" + name, str(value)]
+    return cmd
+
+
+def run_perftest(args: dict, log=None):
+    """Run benchmark_app several times and aggregate collected statistics"""
+
+    if log is None:
+        log = logging.getLogger('run_perftest')
+
+    cmd_common = prepare_executable_cmd(args)
+
+    # Run executable and collect statistics
+    stats = {}
+    for run_iter in range(args["niter"]):
+        with tempfile.TemporaryDirectory() as report_dir:
+            report_dir = Path(report_dir)
+            startup_report = report_dir / "startup_report.json"
+            retcode, msg = run_cmd(cmd_common + ["-report_type", "no_counters",
+                                                 "-report_folder", str(report_dir),
+                                                 "-startup_report", str(startup_report)], log=log)
+            if retcode != 0:
+                log.error("Run of executable '{}' failed with return code '{}'. Error: {}\n"
+                          "Statistics aggregation is skipped.".format(args["executable"], retcode, msg))
+                return retcode, {}
+
+            raw_data = read_execution_results(report_dir / "benchmark_report.csv")
+            raw_data.update(read_startup_report(startup_report))
+        log.debug("Raw statistics after run of executable #{}: {}".format(run_iter, raw_data))
+
+        # Combine statistics from several runs
+        for metric, value in raw_data.items():
+            stats.setdefault(metric, []).append(value)
+
+    # Aggregate results
+    aggregated_stats = aggregate_stats(stats)
+    log.debug("Aggregated statistics after full run: {}".format(aggregated_stats))
+
+    return 0, aggregated_stats
+
+
+def compare_with_references(stats: dict, references: dict, tolerance: float, log=None):
+    """Compare aggregated statistics with references.
+
+    A metric fails when it is worse than its reference by more than `tolerance`
+    (relative). Returns a list of failure messages.
+    """
+    if log is None:
+        log = logging.getLogger('compare_with_references')
+
+    failures = []
+    for metric, reference in references.items():
+        if metric not in stats:
+            failures.append("Metric '{}' is not collected".format(metric))
+            continue
+        current = stats[metric]["median"]
+        reference = reference["median"]
+        if metric in HIGHER_IS_BETTER:
+            passed = current >= reference * (1 - tolerance)
+        else:
+            passed = current <= reference * (1 + tolerance)
+        msg = "Comparison {} for '{}' metric. Reference: {}. Current value: {}. Tolerance: {:.0%}" \
+            .format("passed" if passed else "failed", metric, reference, current, tolerance)
+        if passed:
+            log.info(msg)
+        else:
+            log.error(msg)
+            failures.append(msg)
+    return failures
+
+
+def check_positive_int(val):
+    """Check argsparse argument is positive integer and return it"""
+    value = int(val)
+    if value < 1:
+        msg = "%r is less than 1" % val
+        raise argparse.ArgumentTypeError(msg)
+    return value
+
+
+def cli_parser():
+    """parse command-line arguments"""
+    parser = argparse.ArgumentParser(description='Run benchmark_app and aggregate performance statistics')
+    parser.add_argument('executable',
+                        type=Path,
+                        help='path to benchmark_app binary')
+    parser.add_argument('-m',
+                        required=True,
+                        dest="model",
+                        type=Path,
+                        help='path to an .xml/.onnx/.prototxt file with a trained model or'
+                             ' to a .blob file with a trained compiled model')
+    parser.add_argument('-d',
+                        default="CPU",
+                        dest="device",
+                        type=str,
+                        help='target device to infer on')
+    parser.add_argument('-t',
+                        default=20,
+                        dest="time",
+                        type=check_positive_int,
+                        help='duration of every benchmark_app run in seconds')
+    parser.add_argument('-niter',
+                        default=3,
+                        type=check_positive_int,
+                        help='number of times to execute binary to aggregate statistics of')
+    parser.add_argument('-s',
+                        dest="stats_path",
+                        type=Path,
+                        help='path to a file to save aggregated statistics')
+
+    args = parser.parse_args()
+
+    return args
+
+
+if __name__ == "__main__":
+    args = cli_parser()
+
+    logging.basicConfig(format="[ %(levelname)s ] %(message)s",
+                        level=logging.DEBUG, stream=sys.stdout)
+
+    exit_code, aggr_stats = run_perftest(dict(args._get_kwargs()), log=logging)  # pylint: disable=protected-access
+
+    if args.stats_path:
+        # Save aggregated results to a file
+        with open(args.stats_path, "w") as file:
+            yaml.safe_dump(aggr_stats, file)
+        logging.info("Aggregated statistics saved to a file: '{}'".format(
+            args.stats_path.resolve()))
+    else:
+        logging.info("Aggregated statistics:")
+        pprint(aggr_stats)
+
+    sys.exit(exit_code)
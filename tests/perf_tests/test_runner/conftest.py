@@ -0,0 +1,220 @@
+# Copyright (C) 2020 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+"""
+Basic high-level plugin file for pytest.
+
+See [Writing plugins](https://docs.pytest.org/en/latest/writing_plugins.html)
+for more information.
+
+This plugin adds the following command-line options:
+
+* `--test_conf` - Path to test configuration file. Used to parametrize tests.
+  Format: YAML file.
+* `--exe` - Path to benchmark_app binary to execute.
+* `--niter` - Number of times to run executable.
+* `--time` - Duration of every executable run in seconds.
+* `--tolerance` - Default relative tolerance of comparison with references.
+"""
+
+import json
+import logging
+# pylint:disable=import-error
+from pathlib import Path
+
+import pytest
+import yaml
+from jsonschema import validate, ValidationError
+
+from scripts.run_perftest import check_positive_int
+
+
+# -------------------- CLI options --------------------
+
+
+def pytest_addoption(parser):
+    """Specify command-line options for all plugins"""
+    test_args_parser = parser.getgroup("perftest test run")
+    test_args_parser.addoption(
+        "--test_conf",
+        type=Path,
+        help="path to a test config",
+        default=Path(__file__).parent / "test_config.yml"
+    )
+    test_args_parser.addoption(
+        "--exe",
+        required=True,
+        dest="executable",
+        type=Path,
+        help="path to benchmark_app binary to execute"
+    )
+    test_args_parser.addoption(
+        "--niter",
+        type=check_positive_int,
+        help="number of iterations to run executable and aggregate results",
+        default=3
+    )
+    test_args_parser.addoption(
+        "--time",
+        type=check_positive_int,
+        help="duration of every executable run in seconds",
+        default=20
+    )
+    test_args_parser.addoption(
+        "--tolerance",
+        type=float,
+        help="relative tolerance of comparison with references used when a test case doesn't set own one",
+        default=0.1
+    )
+    helpers_args_parser = parser.getgroup("test helpers")
+    helpers_args_parser.addoption(
+        "--dump_refs",
+        type=Path,
+        help="path to dump test config with references updated with statistics collected while run",
+    )
+
+
+@pytest.fixture(scope="session")
+def test_conf(request):
+    """Fixture function for command-line option."""
+    return request.config.getoption('test_conf')
+
+
+@pytest.fixture(scope="session")
+def executable(request):
+    """Fixture function for command-line option."""
+    return request.config.getoption('executable')
+
+
+@pytest.fixture(scope="session")
+def niter(request):
+    """Fixture function for command-line option."""
+    return request.config.getoption('niter')
+
+
+@pytest.fixture(scope="session")
+def run_time(request):
+    """Fixture function for command-line option."""
+    return request.config.getoption('time')
+
+
+@pytest.fixture(scope="session")
+def tolerance(request):
+    """Fixture function for command-line option."""
+    return request.config.getoption('tolerance')
+
+
+@pytest.fixture(scope="session")
+def dump_refs(request):
+    """Fixture function for command-line option."""
+    return request.config.getoption('dump_refs')
+
+
+# -------------------- CLI options --------------------
+
+
+@pytest.fixture(scope="function")
+def test_info(request, pytestconfig):
+    """Fixture for collecting perftests information.
+
+    Current fixture fills in `request` and `pytestconfig` global
+    fixtures with perftests information which will be used for
+    internal purposes.
+    """
+    setattr(request.node._request, "test_info", {"orig_instance": request.node.funcargs["instance"],
+                                                 "results": {}})
+    if not hasattr(pytestconfig, "session_info"):
+        setattr(pytestconfig, "session_info", [])
+
+    yield request.node._request.test_info
+
+    pytestconfig.session_info.append(request.node._request.test_info)
+
+
+@pytest.fixture(scope="function")
+def validate_test_case(request, test_info):
+    """Fixture for validating test case on correctness.
+
+    Fixture checks current test case contains all fields required for
+    a correct work.
+    """
+    schema = """
+    {
+        "type": "object",
+        "properties": {
+            "device": {
+                "type": "object",
+                "properties": {
+                    "name": {"type": "string"}
+                },
+                "required": ["name"]
+            },
+            "model": {
+                "type": "object",
+                "properties": {
+                    "path": {"type": "string"}
+                },
+                "required": ["path"]
+            },
+            "benchmark_args": {"type": "object"},
+            "tolerance": {"type": "number", "minimum": 0},
+            "references": {"type": "object"}
+        },
+        "required": ["device", "model"],
+        "additionalProperties": false
+    }
+    """
+    schema = json.loads(schema)
+
+    validate(instance=request.node.funcargs["instance"], schema=schema)
+    yield
+
+
+@pytest.fixture(scope="session", autouse=True)
+def prepare_tconf_with_refs(pytestconfig):
+    """Fixture for preparing test config based on original test config
+    with perftests results saved as references.
+    """
+    yield
+    new_tconf_path = pytestconfig.getoption('dump_refs')
+    if new_tconf_path:
+        logging.info("Save new test config with test results as references to {}".format(new_tconf_path))
+        upd_cases = pytestconfig.orig_cases.copy()
+        for record in getattr(pytestconfig, "session_info", []):
+            if not record["results"]:
+                continue
+            rec_i = upd_cases.index(record["orig_instance"])
+            upd_cases[rec_i]["references"] = record["results"]
+        with open(new_tconf_path, "w") as tconf:
+            yaml.safe_dump(upd_cases, tconf)
+
+
+def pytest_generate_tests(metafunc):
+    """Pytest hook for test generation.
+
+    Generate parameterized tests from discovered modules and test config
+    parameters.
+    """
+    with open(metafunc.config.getoption('test_conf'), "r") as file:
+        test_cases = yaml.safe_load(file)
+    if test_cases:
+        metafunc.parametrize("instance", test_cases)
+        setattr(metafunc.config, "orig_cases", test_cases)
+
+
+def pytest_make_parametrize_id(config, val, argname):
+    """Pytest hook for user-friendly test name representation"""
+
+    def get_dict_values(d):
+        """Unwrap dictionary to get all values of nested dictionaries"""
+        if isinstance(d, dict):
+            for v in d.values():
+                yield from get_dict_values(v)
+        else:
+            yield d
+
+    keys = ["device", "model"]
+    values = {key: val[key] for key in keys}
+    values = list(get_dict_values(values))
+
+    return "-".join(["_".join([key, str(val)]) for key, val in zip(keys, values)])
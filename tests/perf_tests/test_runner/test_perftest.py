@@ -0,0 +1,62 @@
+# Copyright (C) 2020 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+"""Main entry-point to run perftests tests.
+
+Default run:
+$ pytest test_perftest.py
+
+Options[*]:
+--test_conf     Path to test config
+--exe           Path to benchmark_app binary to execute
+--niter         Number of times to run executable
+--time          Duration of every executable run in seconds
+--tolerance     Default relative tolerance of comparison with references
+
+[*] For more information see conftest.py
+"""
+
+from pathlib import Path
+import logging
+
+from scripts.run_perftest import run_perftest, compare_with_references
+from test_runner.utils import expand_env_vars
+
+
+def test_perftest(instance, executable, niter, run_time, tolerance, dump_refs, test_info, validate_test_case):
+    """Parameterized test.
+
+    :param instance: test instance. Should not be changed during test run
+    :param executable: benchmark_app executable to run
+    :param niter: number of times to run executable
+    :param run_time: duration of every executable run in seconds
+    :param tolerance: relative tolerance used when test instance doesn't specify own one
+    :param dump_refs: path to dump test config with references, the test cases without references pass only with it
+    :param test_info: custom `test_info` field of built-in `request` pytest fixture
+    :param validate_test_case: custom pytest fixture. Should be declared as test argument to be enabled
+    """
+    model_path = instance["model"].get("path")
+    assert model_path, "Model path is empty"
+
+    exe_args = {
+        "executable": Path(executable),
+        "model": Path(expand_env_vars(model_path)),
+        "device": instance["device"]["name"],
+        "niter": niter,
+        "time": run_time,
+        "benchmark_args": instance.get("benchmark_args", {})
+    }
+    retcode, aggr_stats = run_perftest(exe_args, log=logging)
+    assert retcode == 0, "Run of executable failed"
+
+    # Add results to save in new test conf as references
+    test_info["results"] = aggr_stats
+
+    # a test case without references checks nothing, so it fails unless the references are being collected
+    references = instance.get("references")
+    if not references:
+        assert dump_refs, "No references for the test case, collect them on a baseline build with --dump_refs"
+        return
+
+    failures = compare_with_references(aggr_stats, references, instance.get("tolerance", tolerance), log=logging)
+    assert not failures, "Comparison with references failed:\n" + "\n".join(failures)
@@ -0,0 +1,20 @@
+# Copyright (C) 2020 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+"""Utility module."""
+
+import os
+
+
+def expand_env_vars(obj):
+    """Expand environment variables in provided object."""
+
+    if isinstance(obj, list):
+        for i, value in enumerate(obj):
+            obj[i] = expand_env_vars(value)
+    elif isinstance(obj, dict):
+        for name, value in obj.items():
+            obj[name] = expand_env_vars(value)
+    else:
+        obj = os.path.expandvars(obj)
+    return obj